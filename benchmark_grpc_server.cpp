@@ -0,0 +1,239 @@
+#include "src/network/grpc_server.h"
+#include <grpcpp/grpcpp.h>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <fstream>
+#include <filesystem>
+#include <cstdio>
+
+// gRPC 服务基准：同一个数据库分别挂同步服务（旧实现）和异步完成队列服务，比较
+// 1. 一元 Get/Put 的 RPS 与 p50/p99
+// 2. Scan 按 KV 逐条发送与按字节预算分批发送
+// 3. 大量空闲订阅时服务端占用的线程数，以及此时 Put 的延迟
+class GRPCServerBenchmark {
+public:
+    void run() {
+        std::cout << "=== gRPC 服务基准测试 ===\n\n";
+        cleanup();
+
+        KVDB db("grpc_bench.wal");
+        prepare_data(db);
+
+        std::cout << "测试配置:\n";
+        std::cout << "• 数据量: " << kNumKeys << " 个 key, value " << kValueSize << " 字节\n";
+        std::cout << "• 客户端线程: " << kClientThreads << ", 每线程请求数: " << kRequestsPerThread << "\n";
+        std::cout << "• 空闲订阅数: " << kIdleSubscribers << "\n\n";
+
+        GRPCServerOptions sync_options;
+        sync_options.async = false;
+        run_suite("同步服务 (ServerBuilder 线程池)", db, sync_options);
+
+        GRPCServerOptions async_options;
+        run_suite("异步服务 (每核一个完成队列)", db, async_options);
+
+        cleanup();
+    }
+
+private:
+    static constexpr int kNumKeys = 10000;
+    static constexpr size_t kValueSize = 64;
+    static constexpr int kClientThreads = 8;
+    static constexpr int kRequestsPerThread = 1000;
+    static constexpr int kIdleSubscribers = 500;
+
+    struct LatencyResult {
+        size_t requests = 0;
+        double seconds = 0.0;
+        double p50_us = 0.0;
+        double p99_us = 0.0;
+    };
+
+    static std::string make_key(int i) {
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "key_%08d", i);
+        return buf;
+    }
+
+    // 全部数据留在 MemTable 中（总写入量低于 MEMTABLE_LIMIT），测的是服务本身而不是 SSTable 读取
+    void prepare_data(KVDB& db) {
+        std::string value(kValueSize, 'v');
+        for (int i = 0; i < kNumKeys; i++) {
+            db.put(make_key(i), value);
+        }
+    }
+
+    void run_suite(const std::string& name, KVDB& db, const GRPCServerOptions& options) {
+        std::cout << "--- " << name << " ---\n";
+        GRPCServer server(db, "127.0.0.1:0", options);
+        server.start();
+        auto channel = grpc::CreateChannel("127.0.0.1:" + std::to_string(server.port()),
+                                           grpc::InsecureChannelCredentials());
+        auto stub = kvdb::KVDBService::NewStub(channel);
+
+        print_latency("Get", run_unary(*stub, false));
+        print_latency("Put", run_unary(*stub, true));
+        run_scan(*stub, 1, "Scan 逐条发送 (batch_bytes=1)");
+        run_scan(*stub, 0, "Scan 分批发送 (默认 64KB)");
+        run_idle_subscribers(*stub);
+
+        server.stop();
+        std::cout << "\n";
+    }
+
+    LatencyResult run_unary(kvdb::KVDBService::Stub& stub, bool write, int requests_per_thread = kRequestsPerThread) {
+        std::vector<std::vector<double>> latencies(kClientThreads);
+        std::vector<std::thread> threads;
+        auto start = std::chrono::steady_clock::now();
+
+        for (int t = 0; t < kClientThreads; t++) {
+            threads.emplace_back([&, t]() {
+                latencies[t].reserve(requests_per_thread);
+                std::string value(kValueSize, 'w');
+                for (int i = 0; i < requests_per_thread; i++) {
+                    std::string key = make_key((t * requests_per_thread + i) % kNumKeys);
+                    grpc::ClientContext context;
+                    auto begin = std::chrono::steady_clock::now();
+                    grpc::Status status;
+                    if (write) {
+                        kvdb::PutRequest request;
+                        kvdb::PutResponse response;
+                        request.set_key(key);
+                        request.set_value(value);
+                        status = stub.Put(&context, request, &response);
+                    } else {
+                        kvdb::GetRequest request;
+                        kvdb::GetResponse response;
+                        request.set_key(key);
+                        status = stub.Get(&context, request, &response);
+                    }
+                    auto end = std::chrono::steady_clock::now();
+                    if (status.ok()) {
+                        latencies[t].push_back(std::chrono::duration<double, std::micro>(end - begin).count());
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        LatencyResult result;
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::vector<double> all;
+        for (const auto& l : latencies) {
+            all.insert(all.end(), l.begin(), l.end());
+        }
+        std::sort(all.begin(), all.end());
+        result.requests = all.size();
+        if (!all.empty()) {
+            result.p50_us = all[all.size() / 2];
+            result.p99_us = all[std::min(all.size() - 1, all.size() * 99 / 100)];
+        }
+        return result;
+    }
+
+    void run_scan(kvdb::KVDBService::Stub& stub, uint32_t batch_bytes, const std::string& name) {
+        grpc::ClientContext context;
+        kvdb::ScanRequest request;
+        request.set_start_key(make_key(0));
+        request.set_end_key(make_key(kNumKeys - 1));
+        request.set_batch_bytes(batch_bytes);
+
+        auto start = std::chrono::steady_clock::now();
+        auto reader = stub.Scan(&context, request);
+        kvdb::ScanResponse response;
+        size_t messages = 0;
+        size_t entries = 0;
+        while (reader->Read(&response)) {
+            messages++;
+            entries += response.pairs_size();
+        }
+        grpc::Status status = reader->Finish();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << name << ": " << entries << " 条, " << messages << " 条消息, 耗时 " << ms << " ms"
+                  << (status.ok() ? "" : " (失败: " + status.error_message() + ")") << "\n";
+    }
+
+    static int process_threads() {
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line)) {
+            if (line.compare(0, 8, "Threads:") == 0) {
+                return std::stoi(line.substr(8));
+            }
+        }
+        return -1;
+    }
+
+    void run_idle_subscribers(kvdb::KVDBService::Stub& stub) {
+        int threads_before = process_threads();
+
+        // 客户端用一个完成队列持有所有订阅流，不为每个流开线程
+        grpc::CompletionQueue cq;
+        std::vector<std::unique_ptr<grpc::ClientContext>> contexts;
+        std::vector<std::unique_ptr<grpc::ClientAsyncReader<kvdb::SubscribeResponse>>> readers;
+        kvdb::SubscribeRequest request;
+        request.set_key_pattern("idle:*");
+        for (int i = 0; i < kIdleSubscribers; i++) {
+            contexts.push_back(std::make_unique<grpc::ClientContext>());
+            readers.push_back(stub.AsyncSubscribe(contexts.back().get(), request, &cq,
+                                                  reinterpret_cast<void*>(static_cast<intptr_t>(i))));
+        }
+        void* tag = nullptr;
+        bool ok = false;
+        for (int i = 0; i < kIdleSubscribers; i++) {
+            cq.Next(&tag, &ok);
+        }
+        // 等服务端处理完所有订阅请求
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+        int threads_after = process_threads();
+        std::cout << "空闲订阅 " << kIdleSubscribers << " 个, 进程线程数 " << threads_before
+                  << " -> " << threads_after << "\n";
+        // 订阅匹配在通知线程完成，写路径只发布事件
+        print_latency("有空闲订阅时 Put", run_unary(stub, true));
+
+        for (auto& context : contexts) {
+            context->TryCancel();
+        }
+        // 每个流还有一个 Finish 事件
+        kvdb::SubscribeResponse unused;
+        std::vector<grpc::Status> statuses(kIdleSubscribers);
+        for (int i = 0; i < kIdleSubscribers; i++) {
+            readers[i]->Finish(&statuses[i], reinterpret_cast<void*>(static_cast<intptr_t>(i)));
+        }
+        for (int i = 0; i < kIdleSubscribers; i++) {
+            cq.Next(&tag, &ok);
+        }
+        cq.Shutdown();
+        while (cq.Next(&tag, &ok)) {
+        }
+    }
+
+    void print_latency(const std::string& name, const LatencyResult& r) {
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << name << ": " << r.requests << " 次请求, RPS "
+                  << (r.seconds > 0 ? r.requests / r.seconds : 0.0)
+                  << ", p50 " << r.p50_us << " us, p99 " << r.p99_us << " us\n";
+    }
+
+    void cleanup() {
+        std::filesystem::remove_all("data");
+        std::remove("MANIFEST");
+        std::remove("grpc_bench.wal");
+    }
+};
+
+int main() {
+    GRPCServerBenchmark benchmark;
+    benchmark.run();
+    return 0;
+}
@@ -0,0 +1,145 @@
+#include "src/sstable/sstable_writer.h"
+#include "src/sstable/sstable_meta_util.h"
+#include "src/storage/memtable.h"
+#include "src/iterator/memtable_iterator.h"
+#include "src/iterator/sstable_iterator.h"
+#include "src/iterator/merge_iterator.h"
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <iomanip>
+#include <filesystem>
+#include <cstdio>
+
+// 扫描吞吐基准：1KB value，比较拷贝接口 (key()/value()) 与零拷贝接口 (key_slice()/value_slice())，
+// 以及固定小预读与自适应预读
+class ScanPerformanceBenchmark {
+public:
+    void run() {
+        std::cout << "=== 迭代器扫描吞吐基准测试 ===\n\n";
+        prepare_data();
+        
+        std::cout << "测试配置:\n";
+        std::cout << "• SSTable 数量: " << kNumTables << "\n";
+        std::cout << "• 每个 SSTable key 数: " << kKeysPerTable << "\n";
+        std::cout << "• Value 大小: " << kValueSize << " 字节\n\n";
+        
+        ReadOptions fixed_readahead;
+        fixed_readahead.readahead_size = 4096;
+        ReadOptions adaptive_readahead;
+        
+        print_result("拷贝接口 + 固定 4KB 预读", scan(fixed_readahead, false));
+        print_result("拷贝接口 + 自适应预读", scan(adaptive_readahead, false));
+        print_result("Slice 接口 + 固定 4KB 预读", scan(fixed_readahead, true));
+        print_result("Slice 接口 + 自适应预读", scan(adaptive_readahead, true));
+        
+        ReadOptions bounded;
+        bounded.iterate_upper_bound = make_key(kKeysPerTable * kNumTables / 10);
+        print_result("Slice 接口 + 上界 (10% 数据)", scan(bounded, true));
+        
+        print_result("Slice 接口 + 反向扫描", scan_reverse(adaptive_readahead));
+        
+        cleanup();
+    }
+
+private:
+    static constexpr int kNumTables = 4;
+    static constexpr int kKeysPerTable = 5000;
+    static constexpr size_t kValueSize = 1024;
+    
+    struct ScanResult {
+        size_t entries = 0;
+        size_t bytes = 0;
+        double seconds = 0.0;
+    };
+    
+    std::vector<SSTableMeta> tables_;
+    
+    static std::string make_key(int i) {
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "key_%08d", i);
+        return buf;
+    }
+    
+    void prepare_data() {
+        std::filesystem::create_directories("bench_scan_data");
+        std::string value(kValueSize, 'v');
+        
+        // key 交错分布到各个 SSTable，使 MergeIterator 每一步都需要切换子迭代器
+        for (int t = 0; t < kNumTables; t++) {
+            std::map<std::string, std::vector<VersionedValue>> data;
+            for (int i = t; i < kKeysPerTable * kNumTables; i += kNumTables) {
+                data[make_key(i)].push_back({static_cast<uint64_t>(i + 1), value});
+            }
+            std::string filename = "bench_scan_data/sstable_" + std::to_string(t) + ".dat";
+            SSTableWriter::write(filename, data);
+            tables_.push_back(SSTableMetaUtil::get_meta_from_file(filename));
+        }
+    }
+    
+    std::unique_ptr<MergeIterator> make_iterator(const ReadOptions& options) {
+        std::vector<std::unique_ptr<Iterator>> children;
+        for (const auto& meta : tables_) {
+            children.push_back(std::make_unique<SSTableIterator>(meta, UINT64_MAX, options));
+        }
+        return std::make_unique<MergeIterator>(std::move(children), options);
+    }
+    
+    ScanResult scan(const ReadOptions& options, bool use_slice) {
+        ScanResult result;
+        auto iter = make_iterator(options);
+        auto start = std::chrono::high_resolution_clock::now();
+        
+        for (iter->seek_to_first(); iter->valid(); iter->next()) {
+            if (use_slice) {
+                Slice k = iter->key_slice();
+                Slice v = iter->value_slice();
+                result.bytes += k.size() + v.size();
+            } else {
+                std::string k = iter->key();
+                std::string v = iter->value();
+                result.bytes += k.size() + v.size();
+            }
+            result.entries++;
+        }
+        
+        auto end = std::chrono::high_resolution_clock::now();
+        result.seconds = std::chrono::duration<double>(end - start).count();
+        return result;
+    }
+    
+    ScanResult scan_reverse(const ReadOptions& options) {
+        ScanResult result;
+        auto iter = make_iterator(options);
+        auto start = std::chrono::high_resolution_clock::now();
+        
+        for (iter->seek_to_last(); iter->valid(); iter->prev()) {
+            result.bytes += iter->key_slice().size() + iter->value_slice().size();
+            result.entries++;
+        }
+        
+        auto end = std::chrono::high_resolution_clock::now();
+        result.seconds = std::chrono::duration<double>(end - start).count();
+        return result;
+    }
+    
+    void print_result(const std::string& name, const ScanResult& r) {
+        double mb = static_cast<double>(r.bytes) / (1024.0 * 1024.0);
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << name << ":\n";
+        std::cout << "  条目数: " << r.entries << ", 数据量: " << mb << " MB"
+                  << ", 耗时: " << r.seconds * 1000 << " ms"
+                  << ", 吞吐: " << (r.seconds > 0 ? mb / r.seconds : 0.0) << " MB/s\n";
+    }
+    
+    void cleanup() {
+        std::filesystem::remove_all("bench_scan_data");
+    }
+};
+
+int main() {
+    ScanPerformanceBenchmark benchmark;
+    benchmark.run();
+    return 0;
+}
@@ -6,6 +6,7 @@ echo "Building KVDB Monitoring Integration Example..."
 g++ -std=c++17 -O2 \
     monitoring_integration_example.cpp \
     src/monitoring/metrics_collector.cpp \
+    src/monitoring/metrics_registry.cpp \
     src/monitoring/alert_manager.cpp \
     -I. \
     -pthread \
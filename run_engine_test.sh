@@ -0,0 +1,34 @@
+#!/bin/bash
+# 引擎回归测试的公共入口：源文件列表只在 CMakeLists.txt 中维护，
+# 这里用 CMake 构建 test_<name>，在临时目录中运行并输出摘要。
+# 用法: ./run_engine_test.sh <name> <标题> [摘要过滤正则]
+
+name=$1
+title=$2
+pattern=${3:-"✓|===|🎉|  "}
+root=$(cd "$(dirname "$0")" && pwd)
+build_dir=${KVDB_TEST_BUILD_DIR:-$root/build_tests}
+
+echo "=== $title ==="
+echo ""
+echo "编译 test_$name ..."
+
+if cmake -S "$root" -B "$build_dir" -DCMAKE_CXX_FLAGS=-O2 > /dev/null && \
+   cmake --build "$build_dir" --target "test_$name" -j"$(nproc)" > /dev/null; then
+
+    echo "编译成功，运行测试..."
+    echo ""
+    work_dir=$(mktemp -d)
+    log="$work_dir/test_$name.log"
+    (cd "$work_dir" && "$build_dir/test_$name") > "$log" 2>&1
+    status=$?
+    grep -E "$pattern" "$log"
+    if [ $status -ne 0 ]; then
+        tail -20 "$log"
+    fi
+    rm -rf "$work_dir"
+    exit $status
+else
+    echo "编译失败！请检查错误信息。"
+    exit 1
+fi
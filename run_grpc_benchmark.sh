@@ -0,0 +1,81 @@
+#!/bin/bash
+
+echo "=== gRPC 服务基准测试 ==="
+
+# 依赖与 CMake 的 ENABLE_NETWORK 相同
+if ! pkg-config --exists grpc++ protobuf; then
+    echo "未找到 gRPC / protobuf 开发包，请先运行 ./install_network_deps.sh"
+    exit 1
+fi
+
+GRPC_CPP_PLUGIN=$(command -v grpc_cpp_plugin)
+if ! command -v protoc > /dev/null || [ -z "$GRPC_CPP_PLUGIN" ]; then
+    echo "未找到 protoc 或 grpc_cpp_plugin"
+    exit 1
+fi
+
+# 与 CMake 一样按本机 protoc / gRPC 版本重新生成代码
+echo "生成 protobuf 代码..."
+protoc --cpp_out=src/network --grpc_out=src/network \
+    --plugin=protoc-gen-grpc="$GRPC_CPP_PLUGIN" -Iproto proto/kvdb.proto || exit 1
+
+echo "编译基准测试程序..."
+
+if g++ -std=c++17 -O2 -I. -Isrc -Isrc/network \
+    benchmark_grpc_server.cpp \
+    src/network/grpc_server.cpp \
+    src/network/change_notifier.cpp \
+    src/network/kvdb.pb.cc \
+    src/network/kvdb.grpc.pb.cc \
+    src/db/kv_db.cpp \
+    src/monitoring/metrics_registry.cpp \
+    src/db/write_batch.cpp \
+    src/storage/memtable.cpp \
+    src/storage/range_tombstone.cpp \
+    src/storage/merge_operator.cpp \
+    src/log/wal.cpp \
+    src/sstable/sstable_writer.cpp \
+    src/sstable/sst_file_writer.cpp \
+    src/sstable/sstable_reader.cpp \
+    src/sstable/sstable_meta_util.cpp \
+    src/sstable/block_index.cpp \
+    src/sstable/data_block.cpp \
+    src/compaction/compactor.cpp \
+    src/blob/blob_file.cpp \
+    src/blob/blob_manager.cpp \
+    src/blob/blob_iterator.cpp \
+    src/compaction/compaction_filter.cpp \
+    src/iterator/ttl_iterator.cpp \
+    src/compaction/compaction_strategy.cpp \
+    src/bloom/bloom_filter.cpp \
+    src/cache/block_cache.cpp \
+    src/cache/cache_manager.cpp \
+    src/cache/multi_level_cache.cpp \
+    src/version/version_set.cpp \
+    src/snapshot/snapshot_manager.cpp \
+    src/iterator/memtable_iterator.cpp \
+    src/iterator/sstable_iterator.cpp \
+    src/iterator/merge_iterator.cpp \
+    src/iterator/concurrent_iterator.cpp \
+    src/index/secondary_index.cpp \
+    src/index/composite_index.cpp \
+    src/index/tokenizer.cpp \
+    src/index/posting_list.cpp \
+    src/index/fulltext_index.cpp \
+    src/index/inverted_index.cpp \
+    src/index/index_manager.cpp \
+    src/index/persistent_index.cpp \
+    $(pkg-config --cflags --libs grpc++ protobuf) \
+    -o grpc_benchmark -pthread; then
+
+    echo "编译成功，开始运行基准测试..."
+    echo ""
+
+    ./grpc_benchmark 2>&1 | grep -vE "^\[(WAL|WAL重放|KVDB|CacheManager|VersionSet)\]"
+
+    # 清理
+    rm -f grpc_benchmark
+else
+    echo "编译失败，请检查依赖文件"
+    exit 1
+fi
@@ -0,0 +1,28 @@
+#!/bin/bash
+
+echo "=== 迭代器扫描吞吐基准测试 ==="
+
+# 源文件列表见 CMakeLists.txt 中的 KVDB_ENGINE_SOURCES，基准程序链接 kvdb_engine
+root=$(cd "$(dirname "$0")" && pwd)
+build_dir=${KVDB_TEST_BUILD_DIR:-$root/build_tests}
+
+echo "编译基准测试程序..."
+
+if cmake -S "$root" -B "$build_dir" -DCMAKE_CXX_FLAGS=-O2 > /dev/null && \
+   cmake --build "$build_dir" --target scan_benchmark -j"$(nproc)" > /dev/null; then
+    
+    echo "编译成功，开始运行基准测试..."
+    echo ""
+    
+    # 在临时目录中运行，生成的 SSTable 不落在源码树里
+    work_dir=$(mktemp -d)
+    (cd "$work_dir" && "$build_dir/scan_benchmark")
+    status=$?
+    
+    # 清理
+    rm -rf "$work_dir"
+    exit $status
+else
+    echo "编译失败，请检查依赖文件"
+    exit 1
+fi
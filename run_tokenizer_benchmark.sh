@@ -0,0 +1,23 @@
+#!/bin/bash
+
+echo "=== 分词与全文索引构建基准测试 ==="
+
+# 编译基准测试程序
+echo "编译基准测试程序..."
+
+if g++ -std=c++17 -I. -Isrc -O2 benchmark_tokenizer_performance.cpp \
+   src/index/tokenizer.cpp src/index/posting_list.cpp \
+   src/index/fulltext_index.cpp src/index/inverted_index.cpp \
+   -o tokenizer_benchmark -pthread; then
+    
+    echo "编译成功，开始运行基准测试..."
+    echo ""
+    
+    ./tokenizer_benchmark
+    
+    # 清理
+    rm -f tokenizer_benchmark
+else
+    echo "编译失败，请检查依赖文件"
+    exit 1
+fi
@@ -205,7 +205,9 @@ public:
         kvdb::ScanResponse response;
         
         while (reader->Read(&response)) {
-            result.emplace_back(response.key(), response.value());
+            for (const auto& pair : response.pairs()) {
+                result.emplace_back(pair.key(), pair.value());
+            }
         }
         
         grpc::Status status = reader->Finish();
@@ -230,7 +232,9 @@ public:
         kvdb::PrefixScanResponse response;
         
         while (reader->Read(&response)) {
-            result.emplace_back(response.key(), response.value());
+            for (const auto& pair : response.pairs()) {
+                result.emplace_back(pair.key(), pair.value());
+            }
         }
         
         grpc::Status status = reader->Finish();
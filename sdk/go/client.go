@@ -369,10 +369,12 @@ func (c *Client) Scan(ctx context.Context, options *ScanOptions) ([]KeyValue, er
 			return nil, fmt.Errorf("scan stream error: %w", err)
 		}
 		
-		result = append(result, KeyValue{
-			Key:   resp.Key,
-			Value: resp.Value,
-		})
+		for _, pair := range resp.Pairs {
+			result = append(result, KeyValue{
+				Key:   pair.Key,
+				Value: pair.Value,
+			})
+		}
 	}
 	
 	return result, nil
@@ -407,10 +409,12 @@ func (c *Client) PrefixScan(ctx context.Context, prefix string, limit int32) ([]
 			return nil, fmt.Errorf("prefix scan stream error: %w", err)
 		}
 		
-		result = append(result, KeyValue{
-			Key:   resp.Key,
-			Value: resp.Value,
-		})
+		for _, pair := range resp.Pairs {
+			result = append(result, KeyValue{
+				Key:   pair.Key,
+				Value: pair.Value,
+			})
+		}
 	}
 	
 	return result, nil
@@ -6,6 +6,7 @@ import io.grpc.ManagedChannel;
 import io.grpc.ManagedChannelBuilder;
 import io.grpc.stub.StreamObserver;
 
+import java.util.ArrayList;
 import java.util.List;
 import java.util.Map;
 import java.util.concurrent.CompletableFuture;
@@ -303,9 +304,10 @@ public class KVDBClient implements AutoCloseable {
                 .setLimit(options.getLimit())
                 .build();
             
-            return blockingStub.scan(request)
-                .forEachRemaining(response -> new KeyValue(response.getKey(), response.getValue()))
-                .collect(Collectors.toList());
+            List<KeyValue> result = new ArrayList<>();
+            blockingStub.scan(request).forEachRemaining(response ->
+                response.getPairsList().forEach(pair -> result.add(new KeyValue(pair.getKey(), pair.getValue()))));
+            return result;
         } catch (Exception e) {
             throw new KVDBException("Scan operation failed", e);
         }
@@ -321,9 +323,10 @@ public class KVDBClient implements AutoCloseable {
                 .setLimit(limit)
                 .build();
             
-            return blockingStub.prefixScan(request)
-                .forEachRemaining(response -> new KeyValue(response.getKey(), response.getValue()))
-                .collect(Collectors.toList());
+            List<KeyValue> result = new ArrayList<>();
+            blockingStub.prefixScan(request).forEachRemaining(response ->
+                response.getPairsList().forEach(pair -> result.add(new KeyValue(pair.getKey(), pair.getValue()))));
+            return result;
         } catch (Exception e) {
             throw new KVDBException("Prefix scan operation failed", e);
         }
@@ -314,7 +314,8 @@ class KVDBClient:
         try:
             result = []
             for response in self._stub.Scan(request, timeout=self.config.request_timeout):
-                result.append(KeyValue(key=response.key, value=response.value))
+                for pair in response.pairs:
+                    result.append(KeyValue(key=pair.key, value=pair.value))
             return result
         except grpc.RpcError as e:
             raise KVDBError(f"gRPC error: {e.details()}")
@@ -351,7 +352,8 @@ class KVDBClient:
         try:
             result = []
             for response in self._stub.PrefixScan(request, timeout=self.config.request_timeout):
-                result.append(KeyValue(key=response.key, value=response.value))
+                for pair in response.pairs:
+                    result.append(KeyValue(key=pair.key, value=pair.value))
             return result
         except grpc.RpcError as e:
             raise KVDBError(f"gRPC error: {e.details()}")
@@ -36,6 +36,10 @@ void YCSBBenchmark::set_scan_length(size_t length) {
     scan_length_ = length;
 }
 
+void YCSBBenchmark::set_use_merge_operator(bool enabled) {
+    use_merge_operator_ = enabled;
+}
+
 void YCSBBenchmark::load_data() {
     std::cout << "Loading " << record_count_ << " records..." << std::endl;
     
@@ -183,6 +187,9 @@ bool YCSBBenchmark::execute_scan(const std::string& start_key) {
 }
 
 bool YCSBBenchmark::execute_read_modify_write(const std::string& key) {
+    if (use_merge_operator_) {
+        return db_.merge(key, "_modified");
+    }
     std::string value;
     if (db_.get(key, value)) {
         // 修改值
@@ -67,6 +67,8 @@ public:
     void set_key_size(size_t size);
     void set_value_size(size_t size);
     void set_scan_length(size_t length);
+    // 读改写改用 KVDB::merge 盲写追加（默认列族需设置 ListAppendMergeOperator("")），不再先读后写
+    void set_use_merge_operator(bool enabled);
     
     // 执行基准测试
     BenchmarkResult run_benchmark();
@@ -88,6 +90,7 @@ private:
     size_t key_size_ = 10;
     size_t value_size_ = 100;
     size_t scan_length_ = 10;
+    bool use_merge_operator_ = false;
     
     // 统计信息
     std::vector<OperationStat> operation_stats_;
@@ -0,0 +1,64 @@
+#include "blob/blob_file.h"
+#include <sstream>
+
+std::string BlobIndex::encode() const {
+    return std::string(PREFIX) + std::to_string(file_number) + ":" +
+           std::to_string(offset) + ":" + std::to_string(size);
+}
+
+bool BlobIndex::is_blob_index(const std::string& stored) {
+    return stored.compare(0, std::char_traits<char>::length(PREFIX), PREFIX) == 0;
+}
+
+bool BlobIndex::decode(const std::string& stored, BlobIndex& index) {
+    if (!is_blob_index(stored)) {
+        return false;
+    }
+    std::istringstream iss(stored.substr(std::char_traits<char>::length(PREFIX)));
+    char sep1 = 0, sep2 = 0;
+    if (!(iss >> index.file_number >> sep1 >> index.offset >> sep2 >> index.size) ||
+        sep1 != ':' || sep2 != ':') {
+        return false;
+    }
+    return true;
+}
+
+BlobFileWriter::BlobFileWriter(uint64_t file_number, const std::string& path)
+    : file_number_(file_number), path_(path), out_(path, std::ios::binary | std::ios::trunc) {}
+
+BlobIndex BlobFileWriter::add(const std::string& key, const std::string& value) {
+    uint32_t key_len = static_cast<uint32_t>(key.size());
+    uint32_t value_len = static_cast<uint32_t>(value.size());
+    out_.write(reinterpret_cast<const char*>(&key_len), sizeof(key_len));
+    out_.write(reinterpret_cast<const char*>(&value_len), sizeof(value_len));
+    out_.write(key.data(), key.size());
+
+    BlobIndex index;
+    index.file_number = file_number_;
+    index.offset = file_size_ + sizeof(key_len) + sizeof(value_len) + key.size();
+    index.size = value.size();
+    out_.write(value.data(), value.size());
+
+    file_size_ = index.offset + value.size();
+    blob_count_++;
+    blob_bytes_ += value.size();
+    return index;
+}
+
+bool BlobFileWriter::finish() {
+    out_.flush();
+    bool ok = out_.good();
+    out_.close();
+    return ok;
+}
+
+bool BlobFileReader::read(const std::string& path, const BlobIndex& index, std::string& value) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) {
+        return false;
+    }
+    in.seekg(static_cast<std::streamoff>(index.offset));
+    value.resize(index.size);
+    in.read(&value[0], static_cast<std::streamsize>(index.size));
+    return static_cast<uint64_t>(in.gcount()) == index.size;
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <string>
+#include <cstdint>
+#include <fstream>
+
+// 值在 blob 文件中的位置。SSTable 中以 "__BLOB__<文件号>:<偏移>:<长度>" 代替原值存放，
+// 压缩只搬动这个引用，不再重写值本身
+struct BlobIndex {
+    static constexpr const char* PREFIX = "__BLOB__";
+
+    uint64_t file_number = 0;
+    uint64_t offset = 0;  // 值在 blob 文件中的起始偏移
+    uint64_t size = 0;    // 值的字节数
+
+    std::string encode() const;
+    static bool decode(const std::string& stored, BlobIndex& index);
+    static bool is_blob_index(const std::string& stored);
+};
+
+// 追加写的 blob 文件。记录格式：key 长度(4 字节) | value 长度(4 字节) | key | value，
+// 保留 key 便于离线校验与按文件扫描；BlobIndex 直接指向 value 起点，读取只需一次定位
+class BlobFileWriter {
+public:
+    BlobFileWriter(uint64_t file_number, const std::string& path);
+
+    BlobIndex add(const std::string& key, const std::string& value);
+    bool finish();
+
+    uint64_t file_number() const { return file_number_; }
+    const std::string& path() const { return path_; }
+    uint64_t file_size() const { return file_size_; }
+    uint64_t blob_count() const { return blob_count_; }
+    uint64_t blob_bytes() const { return blob_bytes_; }
+
+private:
+    uint64_t file_number_;
+    std::string path_;
+    std::ofstream out_;
+    uint64_t file_size_ = 0;
+    uint64_t blob_count_ = 0;
+    uint64_t blob_bytes_ = 0;
+};
+
+class BlobFileReader {
+public:
+    static bool read(const std::string& path, const BlobIndex& index, std::string& value);
+};
@@ -0,0 +1,20 @@
+#include "blob/blob_iterator.h"
+
+BlobResolvingIterator::BlobResolvingIterator(std::unique_ptr<Iterator> inner, const BlobManager& blob_manager,
+                                             BlockCache& cache, BlockCache::Priority priority)
+    : inner_(std::move(inner)), blob_manager_(blob_manager), cache_(cache), priority_(priority) {}
+
+Slice BlobResolvingIterator::value_slice() const {
+    Slice stored = inner_->value_slice();
+    if (stored.size() < std::char_traits<char>::length(BlobIndex::PREFIX) ||
+        std::memcmp(stored.data(), BlobIndex::PREFIX, std::char_traits<char>::length(BlobIndex::PREFIX)) != 0) {
+        return stored;
+    }
+    if (!resolved_) {
+        if (!blob_manager_.resolve(stored.to_string(), value_, cache_, priority_)) {
+            value_.clear();
+        }
+        resolved_ = true;
+    }
+    return Slice(value_);
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "iterator/iterator.h"
+#include "blob/blob_manager.h"
+#include <memory>
+#include <string>
+
+// 包装合并迭代器：遇到 blob 引用时经 Block Cache 读出原值，普通值不拷贝直接透传
+class BlobResolvingIterator : public Iterator {
+public:
+    BlobResolvingIterator(std::unique_ptr<Iterator> inner, const BlobManager& blob_manager,
+                          BlockCache& cache, BlockCache::Priority priority);
+
+    bool valid() const override { return inner_->valid(); }
+    void next() override { inner_->next(); resolved_ = false; }
+    void prev() override { inner_->prev(); resolved_ = false; }
+
+    Slice key_slice() const override { return inner_->key_slice(); }
+    Slice value_slice() const override;
+    uint64_t seq() const override { return inner_->seq(); }
+
+    void seek(const std::string& target) override { inner_->seek(target); resolved_ = false; }
+    void seek_for_prev(const std::string& target) override { inner_->seek_for_prev(target); resolved_ = false; }
+    void seek_to_first() override { inner_->seek_to_first(); resolved_ = false; }
+    void seek_to_last() override { inner_->seek_to_last(); resolved_ = false; }
+    void seek_with_prefix(const std::string& prefix) override {
+        inner_->seek_with_prefix(prefix);
+        resolved_ = false;
+    }
+
+private:
+    std::unique_ptr<Iterator> inner_;
+    const BlobManager& blob_manager_;
+    BlockCache& cache_;
+    BlockCache::Priority priority_;
+    // 当前位置解析出的值，迭代器移动后失效
+    mutable std::string value_;
+    mutable bool resolved_ = false;
+};
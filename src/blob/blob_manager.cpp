@@ -0,0 +1,271 @@
+#include "blob/blob_manager.h"
+#include "sstable/sstable_meta_util.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <cctype>
+
+namespace {
+
+constexpr const char* BLOB_FILE_PREFIX = "blob_";
+constexpr const char* BLOB_FILE_SUFFIX = ".blob";
+
+// 从 "blob_<n>.blob" 中取出文件号，不是 blob 文件返回 false
+bool parse_blob_filename(const std::string& name, uint64_t& file_number) {
+    std::string prefix = BLOB_FILE_PREFIX;
+    std::string suffix = BLOB_FILE_SUFFIX;
+    if (name.size() <= prefix.size() + suffix.size() || name.compare(0, prefix.size(), prefix) != 0 ||
+        name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
+        return false;
+    }
+    std::string digits = name.substr(prefix.size(), name.size() - prefix.size() - suffix.size());
+    if (!std::all_of(digits.begin(), digits.end(), ::isdigit)) {
+        return false;
+    }
+    file_number = std::stoull(digits);
+    return true;
+}
+
+} // namespace
+
+BlobManager::BlobManager(const std::string& dir, const std::string& manifest_path)
+    : dir_(dir), manifest_path_(manifest_path) {}
+
+void BlobManager::recover() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    files_.clear();
+
+    std::ifstream in(manifest_path_);
+    std::string line;
+    while (std::getline(in, line)) {
+        std::istringstream iss(line);
+        std::string op;
+        uint64_t file_number = 0;
+        if (!(iss >> op >> file_number)) {
+            continue;
+        }
+        next_file_number_ = std::max(next_file_number_, file_number + 1);
+
+        uint64_t count = 0, bytes = 0;
+        if (op == "ADD" && iss >> count >> bytes) {
+            BlobFileMeta& meta = files_[file_number];
+            meta.file_number = file_number;
+            meta.total_count = count;
+            meta.total_bytes = bytes;
+        } else if (op == "GARBAGE" && iss >> count >> bytes) {
+            auto it = files_.find(file_number);
+            if (it != files_.end()) {
+                it->second.garbage_count += count;
+                it->second.garbage_bytes += bytes;
+            }
+        } else if (op == "DEL") {
+            files_.erase(file_number);
+        }
+    }
+
+    // 未登记的文件是写到一半的刷盘或压缩留下的，没有 SSTable 引用它们
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(dir_, ec)) {
+        uint64_t file_number = 0;
+        if (!parse_blob_filename(entry.path().filename().string(), file_number)) {
+            continue;
+        }
+        next_file_number_ = std::max(next_file_number_, file_number + 1);
+        if (files_.count(file_number) == 0) {
+            std::filesystem::remove(entry.path());
+            std::cout << "[Blob] 删除未登记的 blob 文件: " << entry.path().string() << std::endl;
+        }
+    }
+
+    if (!files_.empty()) {
+        std::cout << "[Blob] 从 " << manifest_path_ << " 恢复 " << files_.size() << " 个 blob 文件\n";
+    }
+}
+
+void BlobManager::set_options(const BlobOptions& options) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    options_ = options;
+}
+
+BlobOptions BlobManager::options() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return options_;
+}
+
+bool BlobManager::should_separate(const std::string& value) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return options_.min_blob_size > 0 && value.size() >= options_.min_blob_size;
+}
+
+bool BlobManager::empty() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return files_.empty();
+}
+
+bool BlobManager::resolve(const std::string& stored, std::string& value, BlockCache& cache,
+                          BlockCache::Priority priority) const {
+    BlobIndex index;
+    if (!BlobIndex::decode(stored, index)) {
+        value = stored;
+        return true;
+    }
+
+    // blob 文件只追加且文件号不复用，(文件号, 偏移) 可以直接作为缓存 key
+    std::string cache_key = "blob:" + std::to_string(index.file_number) + ":" + std::to_string(index.offset);
+    auto cached = cache.get(cache_key);
+    if (cached.has_value()) {
+        value = std::move(cached.value());
+        return true;
+    }
+    if (!read(index, value)) {
+        std::cerr << "[Blob] 读取失败: " << stored << std::endl;
+        return false;
+    }
+    cache.put(cache_key, value, priority);
+    return true;
+}
+
+bool BlobManager::read(const BlobIndex& index, std::string& value) const {
+    return BlobFileReader::read(blob_path(index.file_number), index, value);
+}
+
+bool BlobManager::needs_relocation(const BlobIndex& index) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = files_.find(index.file_number);
+    return it != files_.end() && it->second.garbage_ratio() >= options_.gc_garbage_ratio;
+}
+
+std::string BlobManager::blob_path(uint64_t file_number) const {
+    return dir_ + "/" + BLOB_FILE_PREFIX + std::to_string(file_number) + BLOB_FILE_SUFFIX;
+}
+
+uint64_t BlobManager::new_file_number() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return next_file_number_++;
+}
+
+void BlobManager::add_file(const BlobFileWriter& writer) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    BlobFileMeta& meta = files_[writer.file_number()];
+    meta.file_number = writer.file_number();
+    meta.total_count = writer.blob_count();
+    meta.total_bytes = writer.blob_bytes();
+    append_manifest("ADD " + std::to_string(meta.file_number) + " " + std::to_string(meta.total_count) +
+                    " " + std::to_string(meta.total_bytes));
+}
+
+BlobRefCounts BlobManager::collect_references(const std::vector<std::string>& sstables) {
+    BlobRefCounts refs;
+    for (const auto& file : sstables) {
+        SSTableMetaUtil::for_each_record(file,
+            [&](const std::string&, uint64_t, const std::string& value) {
+                BlobIndex index;
+                if (BlobIndex::decode(value, index)) {
+                    auto& ref = refs[index.file_number];
+                    ref.first++;
+                    ref.second += index.size;
+                }
+            });
+    }
+    return refs;
+}
+
+void BlobManager::record_garbage(const BlobRefCounts& before, const BlobRefCounts& after) {
+    std::vector<uint64_t> obsolete;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& [file_number, ref] : before) {
+            uint64_t live_count = 0, live_bytes = 0;
+            auto it = after.find(file_number);
+            if (it != after.end()) {
+                live_count = it->second.first;
+                live_bytes = it->second.second;
+            }
+            if (ref.first <= live_count) {
+                continue;
+            }
+
+            auto meta_it = files_.find(file_number);
+            if (meta_it == files_.end()) {
+                continue;
+            }
+            BlobFileMeta& meta = meta_it->second;
+            uint64_t garbage_count = ref.first - live_count;
+            uint64_t garbage_bytes = ref.second > live_bytes ? ref.second - live_bytes : 0;
+            meta.garbage_count += garbage_count;
+            meta.garbage_bytes += garbage_bytes;
+            append_manifest("GARBAGE " + std::to_string(file_number) + " " + std::to_string(garbage_count) +
+                            " " + std::to_string(garbage_bytes));
+
+            if (meta.garbage_count >= meta.total_count) {
+                append_manifest("DEL " + std::to_string(file_number));
+                files_.erase(meta_it);
+                obsolete.push_back(file_number);
+            }
+        }
+    }
+
+    for (uint64_t file_number : obsolete) {
+        std::filesystem::remove(blob_path(file_number));
+        std::cout << "[Blob] 删除已无引用的 blob 文件: " << blob_path(file_number) << std::endl;
+    }
+}
+
+std::vector<BlobFileMeta> BlobManager::files() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<BlobFileMeta> result;
+    for (const auto& [file_number, meta] : files_) {
+        result.push_back(meta);
+    }
+    return result;
+}
+
+void BlobManager::append_manifest(const std::string& line) {
+    std::ofstream ofs(manifest_path_, std::ios::app);
+    ofs << line << "\n";
+    ofs.flush();
+}
+
+BlobBuilder::BlobBuilder(BlobManager& manager)
+    : manager_(manager), file_size_limit_(manager.options().blob_file_size) {}
+
+BlobBuilder::~BlobBuilder() {
+    // 未 commit 的文件没有登记，也没有 SSTable 引用，直接删除
+    if (writer_) {
+        finished_.push_back(std::move(writer_));
+    }
+    for (auto& writer : finished_) {
+        writer->finish();
+        std::filesystem::remove(writer->path());
+    }
+}
+
+std::string BlobBuilder::add(const std::string& key, const std::string& value) {
+    if (!writer_) {
+        uint64_t file_number = manager_.new_file_number();
+        writer_ = std::make_unique<BlobFileWriter>(file_number, manager_.blob_path(file_number));
+    }
+    BlobIndex index = writer_->add(key, value);
+    blob_count_++;
+    if (file_size_limit_ > 0 && writer_->file_size() >= file_size_limit_) {
+        finish_current();
+    }
+    return index.encode();
+}
+
+void BlobBuilder::finish_current() {
+    if (writer_) {
+        writer_->finish();
+        finished_.push_back(std::move(writer_));
+    }
+}
+
+void BlobBuilder::commit() {
+    finish_current();
+    for (const auto& writer : finished_) {
+        manager_.add_file(*writer);
+    }
+    finished_.clear();
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include "blob/blob_file.h"
+#include "cache/block_cache.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+
+// 键值分离选项
+struct BlobOptions {
+    size_t min_blob_size = 0;                      // 值不小于此大小时在刷盘时写入 blob 文件；0 表示关闭
+    uint64_t blob_file_size = 256ULL * 1024 * 1024; // 单个 blob 文件达到此大小后换新文件
+    double gc_garbage_ratio = 0.5;                 // 垃圾比例达到此值的文件，压缩时把仍存活的值搬到新文件
+};
+
+// 单个 blob 文件的统计：写入时记下总量，压缩丢弃引用时累加垃圾量
+struct BlobFileMeta {
+    uint64_t file_number = 0;
+    uint64_t total_count = 0;
+    uint64_t total_bytes = 0;
+    uint64_t garbage_count = 0;
+    uint64_t garbage_bytes = 0;
+
+    double garbage_ratio() const {
+        return total_bytes == 0 ? 0.0 : static_cast<double>(garbage_bytes) / total_bytes;
+    }
+};
+
+// 每个 blob 文件被引用的次数与字节数：file_number -> (count, bytes)
+using BlobRefCounts = std::map<uint64_t, std::pair<uint64_t, uint64_t>>;
+
+// 管理全部 blob 文件及其垃圾统计。统计以追加日志 BLOB_MANIFEST 持久化：
+//   ADD <file> <count> <bytes>      新文件写完（先于引用它的 SSTable 落盘）
+//   GARBAGE <file> <count> <bytes>  压缩或删除列族丢弃了这些引用
+//   DEL <file>                      文件已不再被引用，物理删除
+class BlobManager {
+public:
+    static constexpr const char* MANIFEST = "BLOB_MANIFEST";
+
+    explicit BlobManager(const std::string& dir = "data", const std::string& manifest_path = MANIFEST);
+
+    // 重放 BLOB_MANIFEST；目录中未登记的 blob 文件是崩溃前未写完的，直接删除
+    void recover();
+
+    void set_options(const BlobOptions& options);
+    BlobOptions options() const;
+
+    bool should_separate(const std::string& value) const;
+    // 没有任何 blob 文件时读路径可以跳过解析
+    bool empty() const;
+
+    // stored 是 SSTable 中存放的值：普通值原样返回，blob 引用经 Block Cache 读出原值
+    bool resolve(const std::string& stored, std::string& value, BlockCache& cache,
+                 BlockCache::Priority priority = BlockCache::Priority::LOW) const;
+    bool read(const BlobIndex& index, std::string& value) const;
+    // 引用所在文件的垃圾比例已达阈值，压缩时应搬迁
+    bool needs_relocation(const BlobIndex& index) const;
+
+    std::string blob_path(uint64_t file_number) const;
+    uint64_t new_file_number();
+    void add_file(const BlobFileWriter& writer);
+
+    // 扫描 SSTable 数据区中的全部版本，统计对各 blob 文件的引用
+    static BlobRefCounts collect_references(const std::vector<std::string>& sstables);
+    // 压缩前后引用的差值记为垃圾；文件的引用全部变成垃圾后删除
+    void record_garbage(const BlobRefCounts& before, const BlobRefCounts& after);
+
+    std::vector<BlobFileMeta> files() const;
+
+private:
+    void append_manifest(const std::string& line);
+
+    std::string dir_;
+    std::string manifest_path_;
+    BlobOptions options_;
+    std::map<uint64_t, BlobFileMeta> files_;
+    uint64_t next_file_number_ = 1;
+    mutable std::mutex mutex_;
+};
+
+// 一次刷盘或压缩写出的 blob 文件：按 blob_file_size 换文件，commit 时登记到 BlobManager。
+// 必须在引用它们的 SSTable 写入 MANIFEST 之前 commit
+class BlobBuilder {
+public:
+    explicit BlobBuilder(BlobManager& manager);
+    ~BlobBuilder();
+
+    // 写入 value，返回存入 SSTable 的引用
+    std::string add(const std::string& key, const std::string& value);
+    void commit();
+
+    uint64_t blob_count() const { return blob_count_; }
+
+private:
+    void finish_current();
+
+    BlobManager& manager_;
+    uint64_t file_size_limit_;
+    std::unique_ptr<BlobFileWriter> writer_;
+    std::vector<std::unique_ptr<BlobFileWriter>> finished_;
+    uint64_t blob_count_ = 0;
+};
@@ -32,6 +32,11 @@ void BloomFilter::serialize(std::ostream& out) const {
 void BloomFilter::deserialize(std::istream& in) {
     std::string line;
     std::getline(in, line);
+    // 位数以文件中实际写入的长度为准：各列族可以配置不同大小的过滤器
+    if (!line.empty() && line.size() != bit_size_) {
+        bit_size_ = line.size();
+        bits_.assign(bit_size_, false);
+    }
     for (size_t i = 0; i < bit_size_ && i < line.size(); ++i) {
         bits_[i] = (line[i] == '1');
     }
@@ -1,9 +1,17 @@
 #include "block_cache.h"
+#include "../storage/memory_budget.h"
 
-BlockCache::BlockCache(size_t capacity)
-    : capacity_(capacity) {}
+BlockCache::BlockCache(size_t capacity, double high_pri_pool_ratio)
+    : capacity_(capacity), high_pri_pool_ratio_(high_pri_pool_ratio) {}
+
+BlockCache::~BlockCache() {
+    if (budget_) {
+        budget_->release(MemoryBudget::Component::BLOCK_CACHE, bytes_);
+    }
+}
 
 std::optional<std::string> BlockCache::get(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
     auto it = cache_.find(key);
     if (it == cache_.end()) {
         misses_++;
@@ -11,33 +19,106 @@ std::optional<std::string> BlockCache::get(const std::string& key) {
     }
 
     hits_++;
-    // 移到 LRU 头部
-    lru_.splice(lru_.begin(), lru_, it->second.first);
-    return it->second.second;
+    // 移到所在 LRU 的头部
+    auto& lru = lru_of(it->second.priority);
+    lru.splice(lru.begin(), lru, it->second.lru_it);
+    return it->second.value;
 }
 
 double BlockCache::get_hit_rate() const {
+    std::lock_guard<std::mutex> lock(mutex_);
     size_t total = hits_ + misses_;
     if (total == 0) return 0.0;
     return (double)hits_ / total * 100.0;
 }
 
-void BlockCache::put(const std::string& key, const std::string& value) {
+size_t BlockCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cache_.size();
+}
+
+size_t BlockCache::bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_;
+}
+
+void BlockCache::set_memory_budget(MemoryBudget* budget) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (budget_) {
+        budget_->release(MemoryBudget::Component::BLOCK_CACHE, bytes_);
+    }
+    budget_ = budget;
+    if (budget_) {
+        budget_->charge(MemoryBudget::Component::BLOCK_CACHE, bytes_);
+    }
+}
+
+void BlockCache::set_byte_limit(size_t byte_limit) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    byte_limit_ = byte_limit;
+    while (!cache_.empty() && over_limit(0)) {
+        evict_one();
+    }
+}
+
+size_t BlockCache::byte_limit() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return byte_limit_;
+}
+
+void BlockCache::put(const std::string& key, const std::string& value, Priority priority) {
+    std::lock_guard<std::mutex> lock(mutex_);
     auto it = cache_.find(key);
     if (it != cache_.end()) {
-        // 更新
-        it->second.second = value;
-        lru_.splice(lru_.begin(), lru_, it->second.first);
+        // 更新：优先级变化时换到对应的 LRU
+        Entry& entry = it->second;
+        bytes_ = bytes_ - entry.value.size() + value.size();
+        if (budget_) {
+            budget_->release(MemoryBudget::Component::BLOCK_CACHE, entry.value.size());
+            budget_->charge(MemoryBudget::Component::BLOCK_CACHE, value.size());
+        }
+        entry.value = value;
+        auto& from = lru_of(entry.priority);
+        auto& to = lru_of(priority);
+        to.splice(to.begin(), from, entry.lru_it);
+        entry.priority = priority;
         return;
     }
 
-    if (cache_.size() >= capacity_) {
-        // 淘汰 LRU 尾部
-        auto old = lru_.back();
-        lru_.pop_back();
-        cache_.erase(old);
+    size_t entry_bytes = key.size() + value.size();
+    if (byte_limit_ > 0 && entry_bytes > byte_limit_) {
+        return;  // 单个条目就超过上限，不缓存
+    }
+    while (!cache_.empty() && (cache_.size() >= capacity_ || over_limit(entry_bytes))) {
+        evict_one();
+    }
+
+    auto& lru = lru_of(priority);
+    lru.push_front(key);
+    cache_[key] = {lru.begin(), value, priority};
+    bytes_ += entry_bytes;
+    if (budget_) {
+        budget_->charge(MemoryBudget::Component::BLOCK_CACHE, entry_bytes);
     }
+}
+
+bool BlockCache::over_limit(size_t incoming_bytes) const {
+    return byte_limit_ > 0 && bytes_ + incoming_bytes > byte_limit_;
+}
 
-    lru_.push_front(key);
-    cache_[key] = {lru_.begin(), value};
+void BlockCache::evict_one() {
+    // 高优先级池未超出配额时只淘汰 LOW 尾部
+    bool high_over_quota = high_lru_.size() > static_cast<size_t>(capacity_ * high_pri_pool_ratio_);
+    auto& victim_lru = (low_lru_.empty() || high_over_quota) && !high_lru_.empty() ? high_lru_ : low_lru_;
+    if (victim_lru.empty()) {
+        return;
+    }
+    auto it = cache_.find(victim_lru.back());
+    size_t entry_bytes = it->first.size() + it->second.value.size();
+    bytes_ -= entry_bytes;
+    if (budget_) {
+        budget_->release(MemoryBudget::Component::BLOCK_CACHE, entry_bytes);
+    }
+    cache_.erase(it);
+    victim_lru.pop_back();
 }
@@ -3,25 +3,56 @@
 #include <list>
 #include <string>
 #include <optional>
+#include <mutex>
+
+class MemoryBudget;
 
 class BlockCache {
 public:
-    explicit BlockCache(size_t capacity);
+    // 缓存优先级：HIGH 条目占用高优先级池，淘汰时先淘汰 LOW 条目，
+    // 只有高优先级池超过 high_pri_pool_ratio 时才淘汰 HIGH 条目。全部使用 LOW 时就是普通 LRU
+    enum class Priority { HIGH, LOW };
+
+    explicit BlockCache(size_t capacity, double high_pri_pool_ratio = 0.5);
+    ~BlockCache();
 
     std::optional<std::string> get(const std::string& key);
-    void put(const std::string& key, const std::string& value);
+    void put(const std::string& key, const std::string& value, Priority priority = Priority::LOW);
     
     double get_hit_rate() const;
+    size_t size() const;
+    size_t bytes() const;  // 缓存中键值的字节数
+
+    // 条目按键值字节数向统一内存预算记账
+    void set_memory_budget(MemoryBudget* budget);
+    // 字节上限（0 表示只受条目数限制）；调低时立即淘汰到上限以内，内存压力下由 KVDB 收缩
+    void set_byte_limit(size_t byte_limit);
+    size_t byte_limit() const;
 
 private:
+    struct Entry {
+        std::list<std::string>::iterator lru_it;
+        std::string value;
+        Priority priority;
+    };
+
+    std::list<std::string>& lru_of(Priority priority) {
+        return priority == Priority::HIGH ? high_lru_ : low_lru_;
+    }
+    bool over_limit(size_t incoming_bytes) const;
+    void evict_one();
+
     size_t capacity_;
+    size_t byte_limit_ = 0;
+    size_t bytes_ = 0;
+    MemoryBudget* budget_ = nullptr;
+    mutable std::mutex mutex_;
+    double high_pri_pool_ratio_;
     mutable size_t hits_ = 0;
     mutable size_t misses_ = 0;
 
     // LRU: list front = most recent
-    std::list<std::string> lru_;
-    std::unordered_map<
-        std::string,
-        std::pair<std::list<std::string>::iterator, std::string>
-    > cache_;
+    std::list<std::string> high_lru_;
+    std::list<std::string> low_lru_;
+    std::unordered_map<std::string, Entry> cache_;
 };
@@ -119,7 +119,7 @@ void CacheManager::switch_to_legacy() {
     multi_level_cache_.reset();
     
     // 创建新缓存
-    legacy_cache_ = std::make_unique<BlockCache>(l2_capacity_);
+    legacy_cache_ = make_block_cache();
     current_type_ = CacheType::LEGACY_BLOCK_CACHE;
 }
 
@@ -130,8 +130,29 @@ BlockCache& CacheManager::get_block_cache() {
         // 如果是多级缓存，我们需要创建一个临时的BlockCache或者抛出异常
         // 为了简单起见，我们切换到legacy模式
         if (!legacy_cache_) {
-            legacy_cache_ = std::make_unique<BlockCache>(l2_capacity_);
+            legacy_cache_ = make_block_cache();
         }
         return *legacy_cache_;
     }
-}
\ No newline at end of file
+}
+
+void CacheManager::set_memory_budget(MemoryBudget* budget) {
+    budget_ = budget;
+    if (legacy_cache_) {
+        legacy_cache_->set_memory_budget(budget);
+    }
+}
+
+void CacheManager::set_block_cache_byte_limit(size_t byte_limit) {
+    block_cache_byte_limit_ = byte_limit;
+    if (legacy_cache_) {
+        legacy_cache_->set_byte_limit(byte_limit);
+    }
+}
+
+std::unique_ptr<BlockCache> CacheManager::make_block_cache() const {
+    auto cache = std::make_unique<BlockCache>(l2_capacity_);
+    cache->set_memory_budget(budget_);
+    cache->set_byte_limit(block_cache_byte_limit_);
+    return cache;
+}
@@ -38,6 +38,10 @@ public:
     // 获取底层BlockCache引用（用于兼容旧接口）
     BlockCache& get_block_cache();
     
+    // 读路径的 BlockCache 向统一内存预算记账；重新创建 BlockCache 时沿用预算与字节上限
+    void set_memory_budget(MemoryBudget* budget);
+    void set_block_cache_byte_limit(size_t byte_limit);
+    
 private:
     CacheType current_type_;
     
@@ -47,4 +51,9 @@ private:
     
     size_t l1_capacity_;
     size_t l2_capacity_;
+    
+    MemoryBudget* budget_ = nullptr;
+    size_t block_cache_byte_limit_ = 0;
+    
+    std::unique_ptr<BlockCache> make_block_cache() const;
 };
\ No newline at end of file
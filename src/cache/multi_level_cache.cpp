@@ -255,7 +255,11 @@ MultiLevelCache::MultiLevelCache(size_t l1_capacity, size_t l2_capacity)
 }
 
 MultiLevelCache::~MultiLevelCache() {
-    stop_adjustment_.store(true);
+    {
+        std::lock_guard<std::mutex> lock(adjustment_mutex_);
+        stop_adjustment_.store(true);
+    }
+    adjustment_cv_.notify_all();
     if (adjustment_thread_.joinable()) {
         adjustment_thread_.join();
     }
@@ -369,7 +373,12 @@ void MultiLevelCache::adjust_strategy() {
 
 void MultiLevelCache::adjustment_worker() {
     while (!stop_adjustment_.load()) {
-        std::this_thread::sleep_for(std::chrono::seconds(30)); // 每30秒调整一次
+        {
+            // 每30秒调整一次；析构时通过条件变量提前唤醒，避免关闭数据库时阻塞最多30秒
+            std::unique_lock<std::mutex> lock(adjustment_mutex_);
+            adjustment_cv_.wait_for(lock, std::chrono::seconds(30),
+                                    [this] { return stop_adjustment_.load(); });
+        }
         
         if (!stop_adjustment_.load()) {
             adjust_strategy();
@@ -9,6 +9,7 @@
 #include <chrono>
 #include <vector>
 #include <thread>
+#include <condition_variable>
 #include <functional>
 
 // 缓存项元数据
@@ -156,6 +157,8 @@ private:
     // 后台调整线程
     std::thread adjustment_thread_;
     std::atomic<bool> stop_adjustment_{false};
+    std::mutex adjustment_mutex_;
+    std::condition_variable adjustment_cv_;  // 析构时立即唤醒调整线程
     
     void adjustment_worker();
 };
\ No newline at end of file
@@ -23,7 +23,7 @@ std::vector<std::string> REPL::commands_ = {
     "PUT", "GET", "DEL", "FLUSH", "COMPACT", 
     "SNAPSHOT", "GET_AT", "RELEASE", "SCAN", "PREFIX_SCAN",
     "CONCURRENT_TEST", "BENCHMARK", "SET_COMPACTION", 
-    "START_NETWORK", "STOP_NETWORK", "STATS", "LSM", "HELP", "MAN", 
+    "START_NETWORK", "STOP_NETWORK", "STATS", "LSM", "CF", "HELP", "MAN", 
     "SOURCE", "MULTILINE", "HIGHLIGHT", "HISTORY", "CLEAR", "ECHO",
     // 新增高级查询命令
     "BATCH", "GET_WHERE", "COUNT", "SUM", "AVG", "MIN_MAX", "SCAN_ORDER",
@@ -91,6 +91,7 @@ void REPL::setup_colors() {
     color_map_["STOP_NETWORK"] = RED;
     color_map_["STATS"] = WHITE + BOLD;
     color_map_["LSM"] = WHITE + BOLD;
+    color_map_["CF"] = WHITE + BOLD;
     color_map_["HELP"] = CYAN;
     color_map_["MAN"] = CYAN;
     color_map_["SOURCE"] = MAGENTA;
@@ -586,6 +587,8 @@ void REPL::execute_command(const std::vector<std::string>& tokens) {
             cmd_stats();
         } else if (cmd == "LSM") {
             cmd_lsm();
+        } else if (cmd == "CF") {
+            cmd_column_family(tokens);
         } else if (cmd == "HELP") {
             cmd_help();
         } else if (cmd == "MAN") {
@@ -1042,6 +1045,12 @@ void REPL::cmd_stats() {
     // 获取基本统计信息
     std::cout << "=== Database Statistics ===\n";
     std::cout << "MemTable: " << db_.get_memtable_size() << " bytes\n";
+    auto column_families = db_.list_column_families();
+    if (column_families.size() > 1) {
+        for (const auto& name : column_families) {
+            std::cout << "  [" << name << "] " << db_.get_memtable_size(db_.get_column_family(name)) << " bytes\n";
+        }
+    }
     std::cout << "WAL: " << db_.get_wal_size() << " bytes\n";
     std::cout << "Active Snapshots: " << active_snapshots_.size() << "\n";
     if (!active_snapshots_.empty()) {
@@ -1054,6 +1063,14 @@ void REPL::cmd_stats() {
     }
     std::cout << "Cache Hit Rate: " << std::fixed << std::setprecision(2) 
               << db_.get_cache_hit_rate() << "%\n";
+    
+    const MemoryBudget& budget = db_.get_memory_budget();
+    std::cout << "Memory Budget: " << budget.total_usage() << " / " << budget.total_budget()
+              << " bytes (write buffer " << budget.write_buffer_size() << " bytes)\n";
+    for (size_t i = 0; i < MemoryBudget::COMPONENT_COUNT; i++) {
+        auto component = static_cast<MemoryBudget::Component>(i);
+        std::cout << "  " << MemoryBudget::component_name(component) << ": " << budget.usage(component) << " bytes\n";
+    }
 }
 
 void REPL::cmd_lsm() {
@@ -1061,6 +1078,91 @@ void REPL::cmd_lsm() {
     db_.print_lsm_structure();
 }
 
+void REPL::cmd_column_family(const std::vector<std::string>& tokens) {
+    std::string sub_cmd = tokens.size() >= 2 ? tokens[1] : "";
+    for (char& c : sub_cmd) {
+        c = std::toupper(c);
+    }
+    
+    if (sub_cmd == "LIST") {
+        for (const auto& name : db_.list_column_families()) {
+            std::cout << name << " (MemTable: " << db_.get_memtable_size(db_.get_column_family(name))
+                      << " bytes)\n";
+        }
+        return;
+    }
+    
+    if (sub_cmd.empty() || tokens.size() < 3) {
+        std::cout << "Usage: CF <CREATE|DROP|LIST|PUT|GET|DEL|FLUSH> <name> [args...]\n";
+        return;
+    }
+    
+    const std::string& name = tokens[2];
+    if (sub_cmd == "CREATE") {
+        ColumnFamilyOptions options;
+        try {
+            if (tokens.size() >= 4) {
+                options.write_buffer_size = std::stoul(tokens[3]) * 1024;
+            }
+        } catch (const std::exception&) {
+            std::cout << "Invalid write buffer size: " << tokens[3] << "\n";
+            return;
+        }
+        if (tokens.size() >= 5) {
+            const std::string& strategy = tokens[4];
+            if (strategy == "LEVELED") {
+                options.compaction_style = CompactionStrategyType::LEVELED;
+            } else if (strategy == "TIERED") {
+                options.compaction_style = CompactionStrategyType::TIERED;
+            } else if (strategy == "SIZE_TIERED") {
+                options.compaction_style = CompactionStrategyType::SIZE_TIERED;
+            } else if (strategy == "TIME_WINDOW") {
+                options.compaction_style = CompactionStrategyType::TIME_WINDOW;
+            } else {
+                std::cout << "Invalid strategy: " << strategy << "\n";
+                return;
+            }
+        }
+        if (tokens.size() >= 6) {
+            options.cache_priority = tokens[5] == "HIGH" ? BlockCache::Priority::HIGH : BlockCache::Priority::LOW;
+        }
+        if (db_.create_column_family(name, options)) {
+            std::cout << "OK\n";
+        } else {
+            std::cout << "Failed to create column family: " << name << "\n";
+        }
+        return;
+    }
+    
+    ColumnFamilyHandle* cf = db_.get_column_family(name);
+    if (!cf) {
+        std::cout << "Column family not found: " << name << "\n";
+        return;
+    }
+    
+    if (sub_cmd == "DROP") {
+        std::cout << (db_.drop_column_family(cf) ? "OK\n" : "Cannot drop column family\n");
+    } else if (sub_cmd == "FLUSH") {
+        db_.flush(cf);
+        std::cout << "OK\n";
+    } else if (sub_cmd == "PUT" && tokens.size() >= 5) {
+        db_.put(cf, tokens[3], tokens[4]);
+        std::cout << "OK\n";
+    } else if (sub_cmd == "GET" && tokens.size() >= 4) {
+        std::string value;
+        if (db_.get(cf, tokens[3], value)) {
+            std::cout << value << "\n";
+        } else {
+            std::cout << "(nil)\n";
+        }
+    } else if (sub_cmd == "DEL" && tokens.size() >= 4) {
+        db_.del(cf, tokens[3]);
+        std::cout << "OK\n";
+    } else {
+        std::cout << "Usage: CF <CREATE|DROP|LIST|PUT|GET|DEL|FLUSH> <name> [args...]\n";
+    }
+}
+
 void REPL::cmd_help() {
     if (syntax_highlighting_) {
         std::cout << BOLD << CYAN << "Available commands:" << RESET << "\n";
@@ -1083,6 +1185,7 @@ void REPL::cmd_help() {
 #endif
         std::cout << "  " << WHITE << BOLD << "STATS" << RESET << "                      - Show database statistics\n";
         std::cout << "  " << WHITE << BOLD << "LSM" << RESET << "                        - Show LSM tree structure\n";
+        std::cout << "  " << WHITE << BOLD << "CF" << RESET << " <CREATE|DROP|LIST|PUT|GET|DEL|FLUSH> - Manage column families\n";
         std::cout << "\n" << BOLD << MAGENTA << "Advanced Query Features:" << RESET << "\n";
         std::cout << "  " << MAGENTA << BOLD << "BATCH" << RESET << " <PUT|GET|DEL> <args> - Batch operations\n";
         std::cout << "  " << BLUE << BOLD << "GET_WHERE" << RESET << " <field> <op> <val> - Conditional queries\n";
@@ -1130,6 +1233,7 @@ void REPL::cmd_help() {
 #endif
         std::cout << "  STATS                      - Show database statistics\n";
         std::cout << "  LSM                        - Show LSM tree structure\n";
+        std::cout << "  CF <CREATE|DROP|LIST|PUT|GET|DEL|FLUSH> - Manage column families\n";
         std::cout << "\nAdvanced Query Features:\n";
         std::cout << "  BATCH <PUT|GET|DEL> <args> - Batch operations\n";
         std::cout << "  GET_WHERE <field> <op> <val> - Conditional queries\n";
@@ -1162,7 +1266,7 @@ void REPL::cmd_help() {
 void REPL::cmd_man(const std::vector<std::string>& tokens) {
     if (tokens.size() < 2) {
         std::cout << "Usage: MAN <command>\n";
-        std::cout << "Available commands: PUT, GET, DEL, FLUSH, COMPACT, SNAPSHOT, GET_AT, RELEASE, SCAN, PREFIX_SCAN, CONCURRENT_TEST, BENCHMARK, SET_COMPACTION, STATS, LSM, HELP\n";
+        std::cout << "Available commands: PUT, GET, DEL, FLUSH, COMPACT, SNAPSHOT, GET_AT, RELEASE, SCAN, PREFIX_SCAN, CONCURRENT_TEST, BENCHMARK, SET_COMPACTION, STATS, LSM, CF, HELP\n";
         return;
     }
     
@@ -1486,9 +1590,10 @@ void REPL::show_man_page(const std::string& command) {
         std::cout << "    STATS\n\n";
         std::cout << "DESCRIPTION\n";
         std::cout << "    The STATS command displays various statistics about the database\n";
-        std::cout << "    including MemTable size, WAL size, active snapshots, and cache\n";
-        std::cout << "    hit rate. This information is useful for monitoring performance\n";
-        std::cout << "    and resource usage.\n\n";
+        std::cout << "    including MemTable size, WAL size, active snapshots, cache hit\n";
+        std::cout << "    rate, and the memory charged to the global budget by MemTables,\n";
+        std::cout << "    the block cache, in-memory indexes and MVCC version chains. This\n";
+        std::cout << "    information is useful for monitoring performance and resource usage.\n\n";
         std::cout << "EXAMPLES\n";
         std::cout << "    STATS\n\n";
         std::cout << "RETURN VALUE\n";
@@ -1511,7 +1616,34 @@ void REPL::show_man_page(const std::string& command) {
         std::cout << "RETURN VALUE\n";
         std::cout << "    Returns formatted LSM tree structure information\n\n";
         std::cout << "SEE ALSO\n";
-        std::cout << "    STATS, COMPACT, FLUSH\n";
+        std::cout << "    STATS, COMPACT, FLUSH, CF\n";
+        
+    } else if (command == "CF") {
+        std::cout << "NAME\n";
+        std::cout << "    CF - Manage column families\n\n";
+        std::cout << "SYNOPSIS\n";
+        std::cout << "    CF CREATE <name> [write_buffer_kb] [strategy] [HIGH|LOW]\n";
+        std::cout << "    CF DROP <name>\n";
+        std::cout << "    CF LIST\n";
+        std::cout << "    CF PUT <name> <key> <value>\n";
+        std::cout << "    CF GET <name> <key>\n";
+        std::cout << "    CF DEL <name> <key>\n";
+        std::cout << "    CF FLUSH <name>\n\n";
+        std::cout << "DESCRIPTION\n";
+        std::cout << "    A column family is a named keyspace with its own MemTable, LSM\n";
+        std::cout << "    levels, compaction strategy and block cache priority. All column\n";
+        std::cout << "    families share one WAL, so batches spanning several of them are\n";
+        std::cout << "    atomic. Plain PUT/GET/DEL operate on the 'default' column family.\n\n";
+        std::cout << "PARAMETERS\n";
+        std::cout << "    write_buffer_kb  MemTable size that triggers a flush (default 4096)\n";
+        std::cout << "    strategy         LEVELED, TIERED, SIZE_TIERED or TIME_WINDOW\n";
+        std::cout << "    HIGH|LOW         Block cache priority (default LOW)\n\n";
+        std::cout << "EXAMPLES\n";
+        std::cout << "    CF CREATE counters 1024 TIERED HIGH\n";
+        std::cout << "    CF PUT counters page:1 42\n";
+        std::cout << "    CF GET counters page:1\n\n";
+        std::cout << "SEE ALSO\n";
+        std::cout << "    LSM, STATS, FLUSH\n";
         
     } else if (command == "HELP") {
         std::cout << "NAME\n";
@@ -1552,7 +1684,7 @@ void REPL::show_man_page(const std::string& command) {
         
     } else {
         std::cout << "No manual entry for '" << command << "'\n";
-        std::cout << "Available commands: PUT, GET, DEL, FLUSH, COMPACT, SNAPSHOT, GET_AT, RELEASE, SCAN, PREFIX_SCAN, CONCURRENT_TEST, BENCHMARK, SET_COMPACTION, STATS, LSM, HELP, MAN\n";
+        std::cout << "Available commands: PUT, GET, DEL, FLUSH, COMPACT, SNAPSHOT, GET_AT, RELEASE, SCAN, PREFIX_SCAN, CONCURRENT_TEST, BENCHMARK, SET_COMPACTION, STATS, LSM, CF, HELP, MAN\n";
         std::cout << "Use 'HELP' to see all commands or 'MAN <command>' for specific help.\n";
     }
 }
@@ -93,6 +93,7 @@ private:
     void cmd_stop_network(const std::vector<std::string>& tokens);
     void cmd_stats();
     void cmd_lsm();
+    void cmd_column_family(const std::vector<std::string>& tokens);  // 列族管理
     void cmd_help();
     void cmd_man(const std::vector<std::string>& tokens);
     
@@ -0,0 +1,37 @@
+#include "compaction/compaction_filter.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+
+CompactionFilter::Decision TtlCompactionFilter::filter(int /*level*/, const std::string& /*key*/,
+                                                       const std::string& value,
+                                                       std::string* /*new_value*/) const {
+    std::string user_value;
+    uint64_t timestamp = 0;
+    if (decode(value, user_value, timestamp) && is_expired(timestamp, now())) {
+        return Decision::REMOVE;
+    }
+    return Decision::KEEP;
+}
+
+std::string TtlCompactionFilter::encode(const std::string& value, uint64_t timestamp) {
+    return value + TIMESTAMP_MARKER + std::to_string(timestamp);
+}
+
+bool TtlCompactionFilter::decode(const std::string& stored, std::string& value, uint64_t& timestamp) {
+    size_t pos = stored.rfind(TIMESTAMP_MARKER);
+    size_t digits = pos == std::string::npos ? pos : pos + std::char_traits<char>::length(TIMESTAMP_MARKER);
+    if (pos == std::string::npos || digits == stored.size() || stored.size() - digits > 19 ||
+        !std::all_of(stored.begin() + digits, stored.end(), ::isdigit)) {
+        value = stored;
+        return false;
+    }
+    timestamp = std::stoull(stored.substr(digits));
+    value = stored.substr(0, pos);
+    return true;
+}
+
+uint64_t TtlCompactionFilter::now() {
+    return std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <string>
+#include <cstdint>
+
+// 压缩过滤器：流式压缩时对每个保留下来的 key（最新版本、非墓碑）调用一次，
+// 可以保留、删除或改写它的值。过滤器可能被后台压缩线程并发调用，实现需线程安全
+class CompactionFilter {
+public:
+    enum class Decision { KEEP, REMOVE, CHANGE_VALUE };
+
+    virtual ~CompactionFilter() = default;
+
+    // level 为压缩输出所在层级；返回 CHANGE_VALUE 时把新值写入 new_value
+    virtual Decision filter(int level, const std::string& key, const std::string& value,
+                            std::string* new_value) const = 0;
+    virtual const char* name() const = 0;
+};
+
+// TTL 过滤器：值以 "<原值>__TS__<写入时间>" 的形式存放（Unix 秒），写入超过 ttl_seconds 的条目被删除。
+// 没有时间戳的值（开启 TTL 之前写入的数据）永不过期
+class TtlCompactionFilter : public CompactionFilter {
+public:
+    static constexpr const char* TIMESTAMP_MARKER = "__TS__";
+
+    explicit TtlCompactionFilter(uint64_t ttl_seconds) : ttl_seconds_(ttl_seconds) {}
+
+    Decision filter(int level, const std::string& key, const std::string& value,
+                    std::string* new_value) const override;
+    const char* name() const override { return "TtlCompactionFilter"; }
+
+    uint64_t ttl_seconds() const { return ttl_seconds_; }
+    // 写入时间为 timestamp 的数据在 now 时刻是否已过期
+    bool is_expired(uint64_t timestamp, uint64_t now) const {
+        return ttl_seconds_ > 0 && now > timestamp && now - timestamp > ttl_seconds_;
+    }
+
+    static std::string encode(const std::string& value, uint64_t timestamp);
+    // 拆出原值与写入时间；没有时间戳时返回 false，value 原样返回
+    static bool decode(const std::string& stored, std::string& value, uint64_t& timestamp);
+    static uint64_t now();
+
+private:
+    uint64_t ttl_seconds_;
+};
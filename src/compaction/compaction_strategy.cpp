@@ -34,6 +34,35 @@ double CompactionStrategy::calculate_priority(const CompactionTask& task) {
     return file_count_factor * size_factor * level_factor;
 }
 
+// KeyRangeSet 实现
+void KeyRangeSet::add(const std::string& min_key, const std::string& max_key) {
+    ranges_.emplace_back(min_key, max_key);
+}
+
+void KeyRangeSet::seal() {
+    std::sort(ranges_.begin(), ranges_.end());
+    std::vector<std::pair<std::string, std::string>> merged;
+    for (auto& range : ranges_) {
+        if (!merged.empty() && range.first <= merged.back().second) {
+            if (range.second > merged.back().second) {
+                merged.back().second = std::move(range.second);
+            }
+        } else {
+            merged.push_back(std::move(range));
+        }
+    }
+    ranges_ = std::move(merged);
+}
+
+bool KeyRangeSet::overlaps(const std::string& smallest, const std::string& largest) const {
+    // 第一个 max_key >= smallest 的区间是唯一可能相交的候选
+    auto it = std::lower_bound(ranges_.begin(), ranges_.end(), smallest,
+        [](const std::pair<std::string, std::string>& range, const std::string& key) {
+            return range.second < key;
+        });
+    return it != ranges_.end() && it->first < largest;
+}
+
 // LeveledCompactionStrategy 实现
 LeveledCompactionStrategy::LeveledCompactionStrategy(const std::vector<size_t>& level_limits)
     : level_size_limits_(level_limits) {
@@ -343,7 +372,12 @@ TimeWindowCompactionStrategy::group_files_by_time_window(
 std::chrono::system_clock::time_point TimeWindowCompactionStrategy::get_file_timestamp(
     const SSTableMeta& meta) {
     
-    // 从文件名中提取时间戳
+    // 优先使用 SSTable 属性块记录的最晚写入时间（Unix 秒）
+    if (meta.properties.has_timestamps()) {
+        return std::chrono::system_clock::time_point(std::chrono::seconds(meta.properties.max_timestamp));
+    }
+
+    // 旧文件没有属性块：从文件名中提取时间戳
     // 假设文件名格式为 "data/sstable_<id>.dat"
     std::string filename = meta.filename;
     size_t start = filename.find("sstable_");
@@ -3,6 +3,8 @@
 #include <vector>
 #include <memory>
 #include <chrono>
+#include <string>
+#include <utility>
 
 // 压缩策略类型
 enum class CompactionStrategyType {
@@ -26,6 +28,23 @@ struct CompactionTask {
           estimated_output_size(0), priority(0.0) {}
 };
 
+// 若干闭区间 [min_key, max_key] 的并集：add 收集，seal 排序并合并相交区间，
+// 之后 overlaps 用二分查找回答，不再访问层元数据也不加锁
+class KeyRangeSet {
+public:
+    void add(const std::string& min_key, const std::string& max_key);
+    void seal();
+
+    // 是否与半开区间 [smallest, largest) 相交；须在 seal 之后调用
+    bool overlaps(const std::string& smallest, const std::string& largest) const;
+
+    bool empty() const { return ranges_.empty(); }
+
+private:
+    // 合并后按 min_key 升序且互不相交，因此 max_key 同样升序
+    std::vector<std::pair<std::string, std::string>> ranges_;
+};
+
 // 压缩统计信息
 struct CompactionStats {
     size_t total_compactions = 0;
@@ -1,5 +1,6 @@
 #include "compaction/compactor.h"
 #include "sstable/sstable_writer.h"
+#include "sstable/sstable_meta_util.h"
 #include "storage/versioned_value.h"
 #include <map>
 #include <fstream>
@@ -10,78 +11,47 @@
 
 static const std::string TOMBSTONE = "__TOMBSTONE__";
 
-static uint64_t read_index_offset(const std::string& filename) {
-    std::ifstream in(filename);
-    in.seekg(0, std::ios::end);
-    std::streampos file_size = in.tellg();
-    
-    std::string last_line;
-    long pos = (long)file_size - 1;
-    
-    in.seekg(pos);
-    char c;
-    while (pos > 0 && in.get(c) && c == '\n') {
-        pos--;
-        in.seekg(pos);
-    }
-    
-    while (pos > 0) {
-        in.seekg(pos);
-        in.get(c);
-        if (c == '\n') {
-            pos++;
-            break;
-        }
-        pos--;
-    }
-    
-    in.clear();
-    in.seekg(pos);
-    std::getline(in, last_line);
-    
-    // Footer: index_offset bloom_offset
-    std::istringstream iss(last_line);
-    uint64_t index_offset;
-    iss >> index_offset;
-    
-    return index_offset;
-}
-
 std::string Compactor::compact(
     const std::vector<std::string>& sstables,
     const std::string& output_dir,
     const std::string& output_filename,
-    uint64_t min_snapshot_seq
+    uint64_t min_snapshot_seq,
+    const std::function<std::string(const std::string& key, const std::string& value)>& value_rewriter
 ) {
     // 使用多版本格式：map<key, vector<VersionedValue>>
     std::map<std::string, std::vector<VersionedValue>> merged;
+    std::vector<RangeTombstone> range_tombstones;
 
-    // 1. 从旧到新合并（只读 data block，格式：key seq value）
+    // 1. 从旧到新合并（只读数据区）
     for (const auto& file : sstables) {
-        uint64_t index_offset = read_index_offset(file);
-        
-        std::ifstream in(file);
-        std::string line;
-        uint64_t bytes_read = 0;
-
         std::cout << "[Compaction] 读取: " << file << std::endl;
 
-        while (std::getline(in, line) && bytes_read < index_offset) {
-            bytes_read += line.size() + 1;
-            
-            std::istringstream iss(line);
-            std::string key;
-            uint64_t seq;
-            std::string value;
-            if (iss >> key >> seq >> value) {
-                merged[key].push_back({seq, value});
-            }
+        if (auto tombstones = SSTableMetaUtil::read_range_tombstones(file)) {
+            auto list = tombstones->to_tombstones();
+            range_tombstones.insert(range_tombstones.end(), list.begin(), list.end());
         }
+
+        SSTableMetaUtil::for_each_record(file, [&](const std::string& key, uint64_t seq, const std::string& value) {
+            merged[key].push_back({seq, value});
+        });
     }
 
     // 2. 对每个 key 的版本进行清理和保留
+    // 范围删除覆盖的版本：所有活跃 snapshot 都能看到的范围删除之前的版本可以直接丢弃
+    FragmentedRangeTombstoneList fragments(range_tombstones);
+    uint64_t visible_to_all = min_snapshot_seq == 0 ? UINT64_MAX : min_snapshot_seq;
     std::map<std::string, std::vector<VersionedValue>> filtered;
     for (auto& [key, versions] : merged) {
+        uint64_t tombstone_seq;
+        if (fragments.max_covering_seq(key, visible_to_all, tombstone_seq)) {
+            versions.erase(std::remove_if(versions.begin(), versions.end(),
+                               [tombstone_seq](const VersionedValue& v) { return v.seq < tombstone_seq; }),
+                           versions.end());
+            if (versions.empty()) {
+                continue;
+            }
+        }
+
         // 按 seq DESC 排序
         std::sort(versions.begin(), versions.end(),
                   [](const VersionedValue& a, const VersionedValue& b) {
@@ -120,6 +90,13 @@ std::string Compactor::compact(
         }
         
         if (!all_tombstone || min_snapshot_seq > 0) {
+            if (value_rewriter) {
+                for (auto& v : kept) {
+                    if (v.value != TOMBSTONE) {
+                        v.value = value_rewriter(key, v.value);
+                    }
+                }
+            }
             filtered[key] = kept;
         } else {
             std::cout << "[Compaction] 清理所有 Tombstone: " << key << std::endl;
@@ -135,7 +112,7 @@ std::string Compactor::compact(
     }
     
     // 直接写入最终文件（多版本格式）
-    SSTableWriter::write(final_output, filtered);
+    SSTableWriter::write(final_output, filtered, SSTableWriter::DEFAULT_BLOOM_BITS, fragments.to_tombstones());
     std::cout << "[Compaction] 输出到文件: " << final_output << std::endl;
 
     // 4. 删除旧 SSTable
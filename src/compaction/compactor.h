@@ -2,6 +2,7 @@
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <functional>
 
 class Compactor {
 public:
@@ -9,6 +10,8 @@ public:
         const std::vector<std::string>& sstables,
         const std::string& output_dir,
         const std::string& output_filename = "",
-        uint64_t min_snapshot_seq = 0  // 最小活跃 snapshot seq，用于保留版本
+        uint64_t min_snapshot_seq = 0,  // 最小活跃 snapshot seq，用于保留版本
+        // 写出前改写保留下来的值（非墓碑），例如把 blob 引用搬到新的 blob 文件
+        const std::function<std::string(const std::string& key, const std::string& value)>& value_rewriter = nullptr
     );
 };
\ No newline at end of file
@@ -1,7 +1,6 @@
 #pragma once
 #include <coroutine>
 #include <memory>
-#include <queue>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
@@ -9,20 +8,34 @@
 #include <functional>
 #include <future>
 #include <vector>
+#include <optional>
+#include <string>
+#include <utility>
+#include "work_stealing_pool.h"
 
-// 简单的协程任务结构
+// 协程任务：惰性启动，被 co_await 或 get() 时才开始执行；结束时直接转回等待它的协程（对称转移，不占调用栈）
 template<typename T>
 struct Task {
     struct promise_type {
-        T value;
+        std::optional<T> value;
         std::exception_ptr exception;
+        std::coroutine_handle<> continuation;
         
         Task get_return_object() {
             return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
         }
         
-        std::suspend_never initial_suspend() { return {}; }
-        std::suspend_never final_suspend() noexcept { return {}; }
+        struct FinalAwaiter {
+            bool await_ready() noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) noexcept {
+                auto continuation = h.promise().continuation;
+                return continuation ? continuation : std::noop_coroutine();
+            }
+            void await_resume() noexcept {}
+        };
+        
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        FinalAwaiter final_suspend() noexcept { return {}; }
         
         void return_value(T val) { value = std::move(val); }
         void unhandled_exception() { exception = std::current_exception(); }
@@ -30,7 +43,7 @@ struct Task {
     
     std::coroutine_handle<promise_type> handle;
     
-    Task(std::coroutine_handle<promise_type> h) : handle(h) {}
+    explicit Task(std::coroutine_handle<promise_type> h) : handle(h) {}
     ~Task() { if (handle) handle.destroy(); }
     
     Task(const Task&) = delete;
@@ -45,15 +58,73 @@ struct Task {
         return *this;
     }
     
+    // co_await task：记下等待者后转入任务执行，任务结束时恢复等待者
+    struct Awaiter {
+        std::coroutine_handle<promise_type> handle;
+        
+        bool await_ready() const noexcept { return handle.done(); }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+            handle.promise().continuation = awaiting;
+            return handle;
+        }
+        T await_resume() { return take_result(handle); }
+    };
+    Awaiter operator co_await() noexcept { return Awaiter{handle}; }
+    
+    // 阻塞等待结果：在当前线程启动任务，任务挂起后在其他线程恢复时，等它结束再返回
     T get() {
+        auto state = std::make_shared<SyncState>();
+        join(handle, state);
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->cv.wait(lock, [&] { return state->done; });
+        return take_result(handle);
+    }
+    
+private:
+    struct SyncState {
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool done = false;
+    };
+    
+    // 不被等待的驱动协程：启动后自行运行，结束时自行销毁
+    struct Detached {
+        struct promise_type {
+            Detached get_return_object() noexcept { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept { std::terminate(); }
+        };
+    };
+    
+    struct Join {
+        std::coroutine_handle<promise_type> handle;
+        bool await_ready() const noexcept { return handle.done(); }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+            handle.promise().continuation = awaiting;
+            return handle;
+        }
+        void await_resume() noexcept {}
+    };
+    
+    static Detached join(std::coroutine_handle<promise_type> handle, std::shared_ptr<SyncState> state) {
+        co_await Join{handle};
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->done = true;
+        state->cv.notify_all();
+    }
+    
+    static T take_result(std::coroutine_handle<promise_type> handle) {
         if (handle.promise().exception) {
             std::rethrow_exception(handle.promise().exception);
         }
-        return std::move(handle.promise().value);
+        return std::move(*handle.promise().value);
     }
 };
 
-// 协程调度器
+// 协程调度器：任务交给工作窃取线程池执行，工作线程上派生的任务（协程恢复、扇出读取）
+// 压入本线程队列，空闲线程从别处窃取
 class CoroutineScheduler {
 public:
     CoroutineScheduler(size_t num_threads = std::thread::hardware_concurrency());
@@ -64,30 +135,44 @@ public:
     auto submit(Func&& func) -> std::future<decltype(func())> {
         using ReturnType = decltype(func());
         
-        auto task = std::make_shared<std::packaged_task<ReturnType()>>(
-            std::forward<Func>(func)
-        );
-        
-        auto future = task->get_future();
+        std::packaged_task<ReturnType()> task(std::forward<Func>(func));
+        auto future = task.get_future();
         
-        {
-            std::lock_guard<std::mutex> lock(queue_mutex_);
-            task_queue_.emplace([task]() { (*task)(); });
-        }
-        
-        condition_.notify_one();
+        post(std::move(task));
         return future;
     }
     
-    // 批量提交任务
+    // 不需要结果的任务：省去 packaged_task 与 future，小闭包不额外分配
+    template<typename Func>
+    void post(Func&& task) {
+        pool_.submit(std::forward<Func>(task));
+    }
+    
+    // co_await scheduler.schedule()：挂起当前协程，在调度器的工作线程上恢复
+    auto schedule() {
+        struct Awaiter {
+            CoroutineScheduler& scheduler;
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> h) { scheduler.post([h] { h.resume(); }); }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{*this};
+    }
+    
+    // 批量提交任务：一次性入队，外部线程只加一次锁
     template<typename Func>
     auto submit_batch(const std::vector<Func>& funcs) -> std::vector<std::future<decltype(funcs[0]())>> {
         using ReturnType = decltype(funcs[0]());
         std::vector<std::future<ReturnType>> futures;
+        std::vector<std::packaged_task<ReturnType()>> tasks;
+        futures.reserve(funcs.size());
+        tasks.reserve(funcs.size());
         
         for (const auto& func : funcs) {
-            futures.push_back(submit(func));
+            tasks.emplace_back(func);
+            futures.push_back(tasks.back().get_future());
         }
+        pool_.submit_batch(std::move(tasks));
         
         return futures;
     }
@@ -96,55 +181,86 @@ public:
     void wait_all();
     
     // 获取统计信息
-    struct Stats {
-        std::atomic<uint64_t> total_tasks{0};
-        std::atomic<uint64_t> completed_tasks{0};
-        std::atomic<uint64_t> active_threads{0};
-        std::atomic<uint64_t> queue_size{0};
-    };
+    using Stats = WorkStealingPool::Stats;
     
-    const Stats& get_stats() const { return stats_; }
+    const Stats& get_stats() const { return pool_.get_stats(); }
     void print_stats() const;
     
 private:
-    std::vector<std::thread> workers_;
-    std::queue<std::function<void()>> task_queue_;
-    std::mutex queue_mutex_;
-    std::condition_variable condition_;
-    std::atomic<bool> stop_{false};
-    
-    mutable Stats stats_;
-    
-    void worker_thread();
+    WorkStealingPool pool_;
 };
 
-// 并发数据库操作协程
-class ConcurrentDBOperations {
-public:
-    ConcurrentDBOperations(CoroutineScheduler& scheduler);
-    
-    // 协程化的数据库操作
-    Task<bool> async_put(const std::string& key, const std::string& value);
-    Task<std::optional<std::string>> async_get(const std::string& key);
-    Task<bool> async_delete(const std::string& key);
-    
-    // 批量操作
-    Task<std::vector<bool>> async_batch_put(
-        const std::vector<std::pair<std::string, std::string>>& operations);
-    Task<std::vector<std::optional<std::string>>> async_batch_get(
-        const std::vector<std::string>& keys);
-    
-    // 并发统计
-    struct ConcurrentStats {
-        std::atomic<uint64_t> concurrent_reads{0};
-        std::atomic<uint64_t> concurrent_writes{0};
-        std::atomic<uint64_t> batch_operations{0};
-        std::atomic<uint64_t> lock_free_operations{0};
+// 阻塞调用的协程化：没有 io_uring 时的退化实现。fn 交给 io 调度器的线程执行，当前协程挂起，
+// fn 完成后在 resume_on 上恢复并得到其结果。少量 I/O 线程就能让大量协程的读取同时在途
+template<typename Func>
+auto offload(CoroutineScheduler& io, CoroutineScheduler& resume_on, Func fn) {
+    using Result = decltype(fn());
+    struct Awaiter {
+        CoroutineScheduler& io;
+        CoroutineScheduler& resume_on;
+        Func fn;
+        std::optional<Result> result;
+        std::exception_ptr exception;
+        
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> h) {
+            io.post([this, h] {
+                try {
+                    result.emplace(fn());
+                } catch (...) {
+                    exception = std::current_exception();
+                }
+                resume_on.post([h] { h.resume(); });
+            });
+        }
+        Result await_resume() {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+            return std::move(*result);
+        }
     };
-    
-    const ConcurrentStats& get_stats() const { return stats_; }
-    
-private:
-    CoroutineScheduler& scheduler_;
-    mutable ConcurrentStats stats_;
-};
\ No newline at end of file
+    return Awaiter{io, resume_on, std::move(fn), std::nullopt, nullptr};
+}
+
+// 一组阻塞调用同时交给 io 调度器，全部完成后在 resume_on 上恢复一次，按原顺序返回结果；
+// 结果类型需可默认构造，任一调用抛出异常时在恢复后重新抛出
+template<typename Func>
+auto offload_all(CoroutineScheduler& io, CoroutineScheduler& resume_on, std::vector<Func> fns) {
+    using Result = decltype(fns[0]());
+    struct Awaiter {
+        CoroutineScheduler& io;
+        CoroutineScheduler& resume_on;
+        std::vector<Func> fns;
+        std::vector<Result> results;
+        std::atomic<size_t> remaining{0};
+        std::mutex exception_mutex;
+        std::exception_ptr exception;
+        
+        bool await_ready() const noexcept { return fns.empty(); }
+        void await_suspend(std::coroutine_handle<> h) {
+            results.resize(fns.size());
+            remaining.store(fns.size());
+            for (size_t i = 0; i < fns.size(); ++i) {
+                io.post([this, h, i] {
+                    try {
+                        results[i] = fns[i]();
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(exception_mutex);
+                        exception = std::current_exception();
+                    }
+                    if (remaining.fetch_sub(1) == 1) {
+                        resume_on.post([h] { h.resume(); });
+                    }
+                });
+            }
+        }
+        std::vector<Result> await_resume() {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+            return std::move(results);
+        }
+    };
+    return Awaiter{io, resume_on, std::move(fns)};
+}
@@ -0,0 +1,285 @@
+#include "work_stealing_pool.h"
+#include <iostream>
+#include <chrono>
+#include <exception>
+
+namespace {
+// 当前线程所属的线程池及其下标，用于判断提交是否来自池内工作线程
+thread_local const WorkStealingPool* tls_pool = nullptr;
+thread_local size_t tls_index = 0;
+}
+
+// WorkStealingDeque 实现
+WorkStealingDeque::Array::Array(size_t cap)
+    : capacity(cap), mask(cap - 1), slots(new std::atomic<PoolTask*>[cap]) {}
+
+WorkStealingDeque::WorkStealingDeque(size_t initial_capacity) {
+    size_t capacity = 1;
+    while (capacity < initial_capacity) {
+        capacity <<= 1;
+    }
+    arrays_.push_back(std::make_unique<Array>(capacity));
+    array_.store(arrays_.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+    while (PoolTask* task = pop()) {
+        delete task;
+    }
+}
+
+void WorkStealingDeque::push(PoolTask* task) {
+    int64_t b = bottom_.load(std::memory_order_relaxed);
+    int64_t t = top_.load(std::memory_order_acquire);
+    Array* a = array_.load(std::memory_order_relaxed);
+    if (b - t > static_cast<int64_t>(a->capacity) - 1) {
+        auto grown = std::make_unique<Array>(a->capacity * 2);
+        for (int64_t i = t; i < b; ++i) {
+            grown->put(i, a->get(i));
+        }
+        a = grown.get();
+        arrays_.push_back(std::move(grown));
+        array_.store(a, std::memory_order_release);
+    }
+    a->put(b, task);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(b + 1, std::memory_order_relaxed);
+}
+
+PoolTask* WorkStealingDeque::pop() {
+    int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    Array* a = array_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top_.load(std::memory_order_relaxed);
+
+    if (t > b) {
+        // 队列已空，恢复 bottom
+        bottom_.store(b + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    PoolTask* task = a->get(b);
+    if (t == b) {
+        // 只剩最后一个元素，与窃取者竞争 top
+        if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            task = nullptr;
+        }
+        bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return task;
+}
+
+PoolTask* WorkStealingDeque::steal() {
+    int64_t t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = bottom_.load(std::memory_order_acquire);
+    if (t >= b) {
+        return nullptr;
+    }
+
+    Array* a = array_.load(std::memory_order_acquire);
+    PoolTask* task = a->get(t);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    return task;
+}
+
+bool WorkStealingDeque::empty_approx() const {
+    int64_t b = bottom_.load(std::memory_order_relaxed);
+    int64_t t = top_.load(std::memory_order_relaxed);
+    return t >= b;
+}
+
+// WorkStealingPool 实现
+WorkStealingPool::WorkStealingPool(size_t num_threads) {
+    if (num_threads == 0) {
+        num_threads = 1;
+    }
+    workers_.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+    // 所有队列建好后再启动线程，窃取时可以安全遍历 workers_
+    for (size_t i = 0; i < num_threads; ++i) {
+        workers_[i]->thread = std::thread(&WorkStealingPool::worker_loop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(park_mutex_);
+        stop_.store(true);
+        ++wake_epoch_;
+    }
+    park_cv_.notify_all();
+
+    for (auto& worker : workers_) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+
+    // 停止后才从外部提交的任务不再执行
+    for (PoolTask* task : injected_) {
+        delete task;
+    }
+}
+
+bool WorkStealingPool::in_worker_thread() const {
+    return tls_pool == this;
+}
+
+void WorkStealingPool::push_task(PoolTask* task) {
+    stats_.total_tasks.fetch_add(1, std::memory_order_relaxed);
+    if (tls_pool == this) {
+        workers_[tls_index]->deque.push(task);
+        stats_.local_pushes.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        std::lock_guard<std::mutex> lock(inject_mutex_);
+        injected_.push_back(task);
+        injected_size_.store(injected_.size(), std::memory_order_relaxed);
+        stats_.injected.fetch_add(1, std::memory_order_relaxed);
+    }
+    wake(1);
+}
+
+void WorkStealingPool::push_batch(const std::vector<PoolTask*>& tasks) {
+    if (tasks.empty()) {
+        return;
+    }
+    stats_.total_tasks.fetch_add(tasks.size(), std::memory_order_relaxed);
+    if (tls_pool == this) {
+        auto& deque = workers_[tls_index]->deque;
+        for (PoolTask* task : tasks) {
+            deque.push(task);
+        }
+        stats_.local_pushes.fetch_add(tasks.size(), std::memory_order_relaxed);
+    } else {
+        std::lock_guard<std::mutex> lock(inject_mutex_);
+        injected_.insert(injected_.end(), tasks.begin(), tasks.end());
+        injected_size_.store(injected_.size(), std::memory_order_relaxed);
+        stats_.injected.fetch_add(tasks.size(), std::memory_order_relaxed);
+    }
+    wake(tasks.size());
+}
+
+// 任务入队与挂起计数之间用 seq_cst 栅栏配对：要么提交方看到有线程挂起去唤醒，
+// 要么挂起方在等待前的复查中看到新任务
+void WorkStealingPool::wake(size_t count) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (parked_.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(park_mutex_);
+        ++wake_epoch_;
+    }
+    if (count > 1) {
+        park_cv_.notify_all();
+    } else {
+        park_cv_.notify_one();
+    }
+}
+
+bool WorkStealingPool::has_visible_work() const {
+    if (injected_size_.load(std::memory_order_relaxed) > 0) {
+        return true;
+    }
+    for (const auto& worker : workers_) {
+        if (!worker->deque.empty_approx()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+PoolTask* WorkStealingPool::find_task(size_t index, uint64_t& rng) {
+    if (PoolTask* task = workers_[index]->deque.pop()) {
+        return task;
+    }
+
+    if (injected_size_.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> lock(inject_mutex_);
+        if (!injected_.empty()) {
+            PoolTask* task = injected_.front();
+            injected_.pop_front();
+            injected_size_.store(injected_.size(), std::memory_order_relaxed);
+            return task;
+        }
+    }
+
+    // xorshift 选随机起点，避免所有空闲线程同时盯着同一个受害者
+    size_t n = workers_.size();
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    size_t start = static_cast<size_t>(rng % n);
+    for (size_t i = 0; i < n; ++i) {
+        size_t victim = (start + i) % n;
+        if (victim == index) continue;
+        if (PoolTask* task = workers_[victim]->deque.steal()) {
+            stats_.steals.fetch_add(1, std::memory_order_relaxed);
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+void WorkStealingPool::run_task(PoolTask* task) {
+    try {
+        (*task)();
+    } catch (const std::exception& e) {
+        std::cerr << "[WorkStealingPool] 任务执行异常: " << e.what() << "\n";
+    }
+    delete task;
+    stats_.completed_tasks.fetch_add(1, std::memory_order_release);
+}
+
+void WorkStealingPool::worker_loop(size_t index) {
+    tls_pool = this;
+    tls_index = index;
+    stats_.active_threads.fetch_add(1);
+    uint64_t rng = 0x9E3779B97F4A7C15ull * (index + 1);
+
+    while (true) {
+        PoolTask* task = nullptr;
+        for (int spin = 0; spin < SPIN_ROUNDS && !task; ++spin) {
+            task = find_task(index, rng);
+            if (!task) {
+                if (stop_.load() && !has_visible_work()) break;
+                std::this_thread::yield();
+            }
+        }
+        if (task) {
+            run_task(task);
+            continue;
+        }
+        if (stop_.load() && !has_visible_work()) {
+            break;
+        }
+
+        parked_.fetch_add(1, std::memory_order_seq_cst);
+        {
+            std::unique_lock<std::mutex> lock(park_mutex_);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!has_visible_work() && !stop_.load()) {
+                stats_.parks.fetch_add(1, std::memory_order_relaxed);
+                uint64_t epoch = wake_epoch_;
+                park_cv_.wait(lock, [&] { return wake_epoch_ != epoch || stop_.load(); });
+            }
+        }
+        parked_.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    stats_.active_threads.fetch_sub(1);
+    tls_pool = nullptr;
+}
+
+void WorkStealingPool::wait_idle() const {
+    while (stats_.completed_tasks.load(std::memory_order_acquire) <
+           stats_.total_tasks.load(std::memory_order_acquire)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
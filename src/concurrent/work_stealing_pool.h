@@ -0,0 +1,207 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// 线程池任务：只可移动的可调用对象。捕获不超过 INLINE_SIZE 字节的闭包直接放在对象内部，
+// 避免 std::function + packaged_task 那样每个任务额外的堆分配
+class PoolTask {
+public:
+    static constexpr size_t INLINE_SIZE = 48;
+
+    PoolTask() = default;
+
+    template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, PoolTask>>>
+    PoolTask(F&& fn) {
+        using Fn = std::decay_t<F>;
+        if constexpr (sizeof(Fn) <= INLINE_SIZE && alignof(Fn) <= alignof(std::max_align_t) &&
+                      std::is_nothrow_move_constructible_v<Fn>) {
+            new (storage_) Fn(std::forward<F>(fn));
+            ops_ = &inline_ops<Fn>;
+        } else {
+            *reinterpret_cast<Fn**>(storage_) = new Fn(std::forward<F>(fn));
+            ops_ = &heap_ops<Fn>;
+        }
+    }
+
+    PoolTask(PoolTask&& other) noexcept { move_from(other); }
+    PoolTask& operator=(PoolTask&& other) noexcept {
+        if (this != &other) {
+            reset();
+            move_from(other);
+        }
+        return *this;
+    }
+    PoolTask(const PoolTask&) = delete;
+    PoolTask& operator=(const PoolTask&) = delete;
+
+    ~PoolTask() { reset(); }
+
+    void operator()() { ops_->invoke(storage_); }
+    explicit operator bool() const noexcept { return ops_ != nullptr; }
+
+private:
+    struct Ops {
+        void (*invoke)(void*);
+        void (*move)(void* from, void* to) noexcept;
+        void (*destroy)(void*) noexcept;
+    };
+
+    template<typename Fn>
+    static constexpr Ops inline_ops = {
+        [](void* p) { (*static_cast<Fn*>(p))(); },
+        [](void* from, void* to) noexcept {
+            new (to) Fn(std::move(*static_cast<Fn*>(from)));
+            static_cast<Fn*>(from)->~Fn();
+        },
+        [](void* p) noexcept { static_cast<Fn*>(p)->~Fn(); },
+    };
+
+    template<typename Fn>
+    static constexpr Ops heap_ops = {
+        [](void* p) { (**static_cast<Fn**>(p))(); },
+        [](void* from, void* to) noexcept { *static_cast<Fn**>(to) = *static_cast<Fn**>(from); },
+        [](void* p) noexcept { delete *static_cast<Fn**>(p); },
+    };
+
+    void move_from(PoolTask& other) noexcept {
+        if (other.ops_) {
+            other.ops_->move(other.storage_, storage_);
+            ops_ = std::exchange(other.ops_, nullptr);
+        }
+    }
+
+    void reset() noexcept {
+        if (ops_) {
+            ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char storage_[INLINE_SIZE];
+    const Ops* ops_ = nullptr;
+};
+
+// Chase-Lev 工作窃取双端队列（按 Lê 等人给出的 C11 内存序版本实现）。
+// 所有者在底部无锁地 push/pop（LIFO，刚提交的任务缓存最热），其他线程在顶部 steal（FIFO）。
+// 数组满时所有者换成两倍大小的新数组，旧数组可能仍被窃取者读取，保留到队列析构时释放
+class WorkStealingDeque {
+public:
+    explicit WorkStealingDeque(size_t initial_capacity = 256);
+    ~WorkStealingDeque();
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // 仅所有者线程调用
+    void push(PoolTask* task);
+    PoolTask* pop();
+
+    // 任意线程调用；队列为空或与其他线程竞争失败时返回 nullptr
+    PoolTask* steal();
+
+    bool empty_approx() const;
+
+private:
+    struct Array {
+        size_t capacity;
+        size_t mask;
+        std::unique_ptr<std::atomic<PoolTask*>[]> slots;
+
+        explicit Array(size_t cap);
+        PoolTask* get(int64_t i) const { return slots[static_cast<size_t>(i) & mask].load(std::memory_order_relaxed); }
+        void put(int64_t i, PoolTask* task) { slots[static_cast<size_t>(i) & mask].store(task, std::memory_order_relaxed); }
+    };
+
+    alignas(64) std::atomic<int64_t> top_{0};
+    alignas(64) std::atomic<int64_t> bottom_{0};
+    std::atomic<Array*> array_;
+    std::vector<std::unique_ptr<Array>> arrays_;  // 当前及扩容前的全部数组，仅所有者修改
+};
+
+// 工作窃取线程池：每个工作线程一个 Chase-Lev 队列，外部线程提交的任务进入一个加锁的注入队列。
+// 工作线程取任务的顺序为 自己的队列 → 注入队列 → 随机起点轮询窃取其他线程；
+// 找不到任务时先自旋让出若干轮，仍然没有才挂起，提交方只在有线程挂起时才去加锁唤醒
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(size_t num_threads = std::thread::hardware_concurrency());
+    ~WorkStealingPool();  // 先执行完已提交的任务再退出
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    template<typename Func>
+    void submit(Func&& func) {
+        push_task(new PoolTask(std::forward<Func>(func)));
+    }
+
+    // 批量提交：外部线程只加一次注入队列的锁，工作线程则全部压入自己的队列
+    template<typename Func>
+    void submit_batch(std::vector<Func> funcs) {
+        std::vector<PoolTask*> tasks;
+        tasks.reserve(funcs.size());
+        for (auto& func : funcs) {
+            tasks.push_back(new PoolTask(std::move(func)));
+        }
+        push_batch(tasks);
+    }
+
+    // 等待已提交的任务（包括执行中派生的任务）全部完成；不能在池内线程上调用
+    void wait_idle() const;
+
+    size_t size() const { return workers_.size(); }
+
+    // 当前线程是否为本池的工作线程
+    bool in_worker_thread() const;
+
+    struct Stats {
+        std::atomic<uint64_t> total_tasks{0};
+        std::atomic<uint64_t> completed_tasks{0};
+        std::atomic<uint64_t> local_pushes{0};   // 工作线程压入自己队列的任务数
+        std::atomic<uint64_t> injected{0};       // 外部线程经注入队列提交的任务数
+        std::atomic<uint64_t> steals{0};         // 从其他线程队列窃取成功的次数
+        std::atomic<uint64_t> parks{0};          // 自旋后仍无任务而挂起的次数
+        std::atomic<uint64_t> active_threads{0};
+    };
+
+    const Stats& get_stats() const { return stats_; }
+
+private:
+    struct Worker {
+        WorkStealingDeque deque;
+        std::thread thread;
+    };
+
+    static constexpr int SPIN_ROUNDS = 64;
+
+    void push_task(PoolTask* task);
+    void push_batch(const std::vector<PoolTask*>& tasks);
+    void worker_loop(size_t index);
+    PoolTask* find_task(size_t index, uint64_t& rng);
+    void run_task(PoolTask* task);
+    bool has_visible_work() const;
+    void wake(size_t count);
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    std::mutex inject_mutex_;
+    std::deque<PoolTask*> injected_;
+    std::atomic<size_t> injected_size_{0};  // 无锁检查注入队列是否为空
+
+    std::mutex park_mutex_;
+    std::condition_variable park_cv_;
+    std::atomic<size_t> parked_{0};
+    uint64_t wake_epoch_ = 0;  // park_mutex_ 保护，每次唤醒加一，防止挂起前的唤醒丢失
+
+    std::atomic<bool> stop_{false};
+    Stats stats_;
+};
@@ -0,0 +1,155 @@
+#pragma once
+#include "storage/memtable.h"
+#include "version/version_set.h"
+#include "compaction/compaction_strategy.h"
+#include "compaction/compaction_filter.h"
+#include "storage/merge_operator.h"
+#include "cache/block_cache.h"
+#include "sstable/sstable_writer.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+
+// 列族选项：每个列族独立的写缓冲、压缩策略、Bloom Filter、前缀提取器、缓存优先级、TTL、压缩过滤器与合并操作符
+struct ColumnFamilyOptions {
+    size_t write_buffer_size = 4 * 1024 * 1024;  // MemTable 达到此大小时刷盘
+    CompactionStrategyType compaction_style = CompactionStrategyType::LEVELED;
+    std::vector<size_t> level_size_limits = {
+        4ULL * 1024 * 1024,    // L0: 4MB
+        40ULL * 1024 * 1024,   // L1: 40MB
+        400ULL * 1024 * 1024,  // L2: 400MB
+        4000ULL * 1024 * 1024  // L3: 4GB
+    };
+    size_t bloom_filter_bits = SSTableWriter::DEFAULT_BLOOM_BITS;  // 0 表示不使用 Bloom Filter
+    // 设置后新写出的 SSTable 带前缀 Bloom Filter（与 bloom_filter_bits 同样大小），前缀扫描跳过不含该前缀的文件。
+    // 不持久化；文件记下提取器名称，名称不一致的文件不按前缀过滤
+    std::shared_ptr<const PrefixExtractor> prefix_extractor;
+    BlockCache::Priority cache_priority = BlockCache::Priority::LOW;
+    // 大于 0 时写入的值带上写入时间：读取时跳过、压缩时删除写入超过 ttl_seconds 的数据，
+    // 整个文件都过期时不读取直接删除。随列族清单持久化，开启后不应再关闭
+    uint64_t ttl_seconds = 0;
+    // 压缩时对每个 key 调用的过滤器，看到的是去掉时间戳后的原值；不持久化，重启后需重新设置
+    std::shared_ptr<CompactionFilter> compaction_filter;
+    // KVDB::merge 写入的操作数在读取与压缩时由它折叠；不持久化，已有合并条目的列族重启后需重新设置。
+    // 不能与 TTL 同时使用
+    std::shared_ptr<MergeOperator> merge_operator;
+};
+
+class ColumnFamilyData;
+
+// 列族句柄：由 KVDB 持有，列族被删除后句柄仍然有效，但读写都会失败
+class ColumnFamilyHandle {
+public:
+    uint32_t id() const { return id_; }
+    const std::string& name() const { return name_; }
+
+private:
+    friend class KVDB;
+    friend class ColumnFamilyData;
+    ColumnFamilyHandle(ColumnFamilyData* cfd, uint32_t id, const std::string& name)
+        : cfd_(cfd), id_(id), name_(name) {}
+
+    ColumnFamilyData* cfd_;
+    uint32_t id_;
+    std::string name_;
+};
+
+// 单个列族的全部 LSM 状态：MemTable、各层 SSTable、MANIFEST 与压缩策略。
+// 序列号、WAL、Block Cache 和快照由所有列族共享
+class ColumnFamilyData {
+public:
+    static constexpr uint32_t DEFAULT_ID = 0;
+    static constexpr const char* DEFAULT_NAME = "default";
+
+    struct Level {
+        std::vector<SSTableMeta> sstables;
+        mutable std::mutex mutex;
+
+        Level() = default;
+        Level(const Level& other) {
+            std::lock_guard<std::mutex> lock(other.mutex);
+            sstables = other.sstables;
+        }
+        Level& operator=(const Level& other) {
+            if (this != &other) {
+                std::lock_guard<std::mutex> lock_this(mutex, std::adopt_lock);
+                std::lock_guard<std::mutex> lock_other(other.mutex, std::adopt_lock);
+                sstables = other.sstables;
+            }
+            return *this;
+        }
+    };
+
+    // manifest_dir 为空时 MANIFEST 放在当前目录
+    ColumnFamilyData(uint32_t id, const std::string& name, const ColumnFamilyOptions& options, int max_level,
+                     MemoryBudget* memory_budget = nullptr, const std::string& manifest_dir = "")
+        : id(id), name(name), options(options),
+          version_set(max_level, manifest_path(manifest_dir, id)),
+          handle(this, id, name) {
+        levels.resize(max_level);
+        memtable.set_memory_budget(memory_budget);
+        compaction_strategy = CompactionStrategyFactory::create_strategy(
+            options.compaction_style, options.level_size_limits);
+    }
+
+    static std::string manifest_path(const std::string& dir, uint32_t id) {
+        std::string name = id == DEFAULT_ID ? "MANIFEST" : "MANIFEST-" + std::to_string(id);
+        return dir.empty() ? name : dir + "/" + name;
+    }
+
+    // 更新选项；压缩策略类型或层级上限变化时重建压缩策略（统计随之清零）
+    void set_options(const ColumnFamilyOptions& new_options) {
+        std::lock_guard<std::mutex> lock(compaction_strategy_mutex);
+        bool strategy_changed = new_options.compaction_style != options.compaction_style ||
+                                new_options.level_size_limits != options.level_size_limits;
+        options = new_options;
+        if (strategy_changed) {
+            compaction_strategy = CompactionStrategyFactory::create_strategy(
+                options.compaction_style, options.level_size_limits);
+        }
+    }
+
+    // set_options 可能替换合并操作符，读取方在锁内拷贝一份
+    std::shared_ptr<MergeOperator> merge_operator() const {
+        std::lock_guard<std::mutex> lock(compaction_strategy_mutex);
+        return options.merge_operator;
+    }
+
+    std::shared_ptr<const PrefixExtractor> prefix_extractor() const {
+        std::lock_guard<std::mutex> lock(compaction_strategy_mutex);
+        return options.prefix_extractor;
+    }
+
+    // 当前各层文件的拷贝，供压缩策略挑选任务
+    std::vector<std::vector<SSTableMeta>> level_files() const {
+        std::vector<std::vector<SSTableMeta>> files(levels.size());
+        for (size_t level = 0; level < levels.size(); level++) {
+            std::lock_guard<std::mutex> lock(levels[level].mutex);
+            files[level] = levels[level].sstables;
+        }
+        return files;
+    }
+
+    const uint32_t id;
+    const std::string name;
+    ColumnFamilyOptions options;  // compaction_style 受 compaction_strategy_mutex 保护
+
+    MemTable memtable;
+    std::vector<Level> levels;
+    VersionSet version_set;
+    std::unique_ptr<CompactionStrategy> compaction_strategy;
+    mutable std::mutex compaction_strategy_mutex;
+    std::mutex compaction_mutex;  // 同一列族同时只执行一个压缩任务；删除列族时也需持有
+
+    std::atomic<bool> flush_requested{false};
+    std::atomic<bool> dropped{false};
+
+    // 统计
+    std::atomic<uint64_t> num_writes{0};
+    std::atomic<uint64_t> num_flushes{0};
+
+    ColumnFamilyHandle handle;
+};
@@ -2,38 +2,333 @@
 #include <iostream>
 #include <chrono>
 #include <algorithm>
+#include <filesystem>
 
-ConcurrentKVDB::ConcurrentKVDB(const std::string& wal_file, size_t num_threads)
-    : concurrent_memtable_(std::make_unique<ReadWriteSeparatedMemTable>()),
+ConcurrentKVDB::ConcurrentKVDB(const std::string& wal_file, size_t num_threads, size_t io_threads,
+                               const std::string& db_path)
+    : active_(std::make_shared<ConcurrentMemTable>()),
       scheduler_(std::make_unique<CoroutineScheduler>(num_threads)),
-      concurrent_ops_(std::make_unique<ConcurrentDBOperations>(*scheduler_)),
-      legacy_db_(std::make_unique<KVDB>(wal_file)),
-      perf_monitor_thread_(&ConcurrentKVDB::performance_monitor_worker, this) {
+      io_executor_(std::make_unique<CoroutineScheduler>(io_threads)),
+      legacy_db_(std::make_unique<KVDB>(wal_file, db_path.empty() ? default_db_path(wal_file) : db_path)),
+      wal_file_(wal_file) {
+    recover();
+    flush_thread_ = std::thread(&ConcurrentKVDB::flush_worker, this);
+    perf_monitor_thread_ = std::thread(&ConcurrentKVDB::performance_monitor_worker, this);
     
     std::cout << "[ConcurrentKVDB] 初始化并发数据库，线程数: " << num_threads << "\n";
-    std::cout << "[ConcurrentKVDB] 启用读写分离和无锁优化\n";
+    std::cout << "[ConcurrentKVDB] 启用组提交 WAL、无锁 MemTable 与后台刷盘\n";
 }
 
 ConcurrentKVDB::~ConcurrentKVDB() {
+    // 先停掉异步任务，它们可能还在读写磁盘层
+    io_executor_.reset();
+    scheduler_.reset();
+    
     stop_perf_monitor_.store(true);
+    perf_monitor_cv_.notify_all();
     if (perf_monitor_thread_.joinable()) {
         perf_monitor_thread_.join();
     }
+    
+    // 正在排队的不可变 MemTable 刷完再退出；活跃 MemTable 留在 WAL 段中，重启时重放
+    {
+        std::lock_guard<std::mutex> lock(flush_mutex_);
+        stop_flush_ = true;
+    }
+    flush_cv_.notify_all();
+    if (flush_thread_.joinable()) {
+        flush_thread_.join();
+    }
+}
+
+std::string ConcurrentKVDB::default_db_path(const std::string& wal_file) {
+    return wal_file + ".db";
+}
+
+std::string ConcurrentKVDB::segment_name(uint64_t segment) const {
+    return wal_file_ + "." + std::to_string(segment);
+}
+
+void ConcurrentKVDB::recover() {
+    KVDB& db = *legacy_db_;
+    // 序列号 0 留给“什么都不可见”的快照
+    if (db.seq_->load() == 0) {
+        db.seq_->store(1);
+    }
+    
+    // 上次未刷盘的 WAL 段按编号顺序重放，记录使用新的序列号，排在已落盘的数据之后
+    std::filesystem::path base(wal_file_);
+    std::filesystem::path dir = base.has_parent_path() ? base.parent_path() : std::filesystem::path(".");
+    std::string prefix = base.filename().string() + ".";
+    std::vector<std::pair<uint64_t, std::string>> segments;
+    for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+        std::string name = entry.path().filename().string();
+        if (name.size() <= prefix.size() || name.compare(0, prefix.size(), prefix) != 0) {
+            continue;
+        }
+        std::string number = name.substr(prefix.size());
+        if (std::all_of(number.begin(), number.end(), ::isdigit)) {
+            segments.emplace_back(std::stoull(number), entry.path().string());
+        }
+    }
+    std::sort(segments.begin(), segments.end());
+    
+    for (const auto& [segment, path] : segments) {
+        WAL(path).replay(
+            [&](const std::string& key, const std::string& value) { active_->put(key, value, db.next_seq()); },
+            [&](const std::string& key) { active_->del(key, db.next_seq()); });
+    }
+    published_seq_.store(db.seq_->load() - 1);
+    
+    // 重放的数据直接刷成 SSTable，旧段随之删除，新写入从下一个编号的段开始
+    if (active_->size() > 0) {
+        write_l0_table(*active_);
+        active_ = std::make_shared<ConcurrentMemTable>();
+    }
+    for (const auto& [segment, path] : segments) {
+        std::filesystem::remove(path);
+    }
+    wal_segment_ = segments.empty() ? 0 : segments.back().first + 1;
+    wal_ = std::make_unique<WAL>(segment_name(wal_segment_));
+}
+
+bool ConcurrentKVDB::write(const WriteBatch& batch) {
+    Writer writer;
+    writer.batch = &batch;
+    join_write_group(writer);
+    perf_stats_.concurrent_writes.fetch_add(1);
+    return true;
+}
+
+void ConcurrentKVDB::join_write_group(Writer& writer) {
+    std::unique_lock<std::mutex> lock(write_mutex_);
+    writers_.push_back(&writer);
+    writer.cv.wait(lock, [&] { return writer.insert_ready || writer.done || writers_.front() == &writer; });
+    
+    if (writer.insert_ready) {
+        // 跟随者：leader 已写好 WAL，与组内其他写入者并行插入 MemTable
+        lock.unlock();
+        insert_into_memtable(writer);
+        lock.lock();
+        if (--pending_inserts_ == 0) {
+            writers_.front()->cv.notify_one();
+        }
+    }
+    if (writer.insert_ready || writer.done) {
+        writer.cv.wait(lock, [&] { return writer.done; });
+        return;
+    }
+    
+    // leader：带上排在后面的写入者，最多 batch_size_ 个
+    std::vector<Writer*> group;
+    bool force_flush = false;
+    size_t num_ops = 0;
+    size_t max_group = std::max<size_t>(1, batch_size_.load());
+    for (Writer* member : writers_) {
+        if (group.size() >= max_group) {
+            break;
+        }
+        group.push_back(member);
+        force_flush = force_flush || member->force_flush;
+        num_ops += member->batch ? member->batch->count() : 0;
+    }
+    if (group.size() > 1) {
+        perf_stats_.batch_operations.fetch_add(1);
+    }
+    lock.unlock();
+    
+    // 组与组串行执行，MemTable 切换与 WAL 段只由当前 leader 操作
+    uint64_t flush_target = make_room_for_write(force_flush);
+    std::shared_ptr<ConcurrentMemTable> memtable = std::atomic_load(&active_);
+    uint64_t seq = legacy_db_->seq_->fetch_add(num_ops);
+    if (num_ops > 0) {
+        // 整组一条 BATCH 记录、一次 flush；组内的写入都还没有确认，崩溃截断时整组丢弃
+        if (group.size() == 1) {
+            wal_->log_batch(*writer.batch);
+        } else {
+            WriteBatch combined;
+            for (Writer* member : group) {
+                if (!member->batch) {
+                    continue;
+                }
+                for (const auto& op : member->batch->ops()) {
+                    if (op.type == WriteBatch::OpType::DEL) {
+                        combined.del(op.key);
+                    } else {
+                        combined.put(op.key, op.value);
+                    }
+                }
+            }
+            wal_->log_batch(combined);
+        }
+    }
+    
+    bool parallel = group.size() > 1 && num_ops > PARALLEL_INSERT_MIN_OPS;
+    for (Writer* member : group) {
+        member->first_seq = seq;
+        member->memtable = memtable;
+        member->flush_target = flush_target;
+        seq += member->batch ? member->batch->count() : 0;
+    }
+    if (parallel) {
+        lock.lock();
+        pending_inserts_ = group.size() - 1;
+        for (Writer* member : group) {
+            if (member != &writer) {
+                member->insert_ready = true;
+                member->cv.notify_one();
+            }
+        }
+        lock.unlock();
+        insert_into_memtable(writer);
+    } else {
+        for (Writer* member : group) {
+            insert_into_memtable(*member);
+        }
+    }
+    
+    // 组内全部插入后才推进可见序列号，读取不会看到只插入了一半的组
+    lock.lock();
+    writer.cv.wait(lock, [&] { return pending_inserts_ == 0; });
+    if (num_ops > 0) {
+        published_seq_.store(seq - 1);
+    }
+    for (Writer* member : group) {
+        writers_.pop_front();
+        member->done = true;
+        if (member != &writer) {
+            member->cv.notify_one();
+        }
+    }
+    if (!writers_.empty()) {
+        writers_.front()->cv.notify_one();
+    }
+}
+
+uint64_t ConcurrentKVDB::make_room_for_write(bool force) {
+    std::shared_ptr<ConcurrentMemTable> active = std::atomic_load(&active_);
+    size_t used = active->size();
+    std::unique_lock<std::mutex> lock(flush_mutex_);
+    if (used < write_buffer_size_.load() && !(force && used > 0)) {
+        return switches_;
+    }
+    
+    // 上一个不可变 MemTable 还没刷完时写入停顿
+    if (flushed_ < switches_) {
+        perf_stats_.lock_contentions.fetch_add(1);
+        flush_cv_.wait(lock, [this] { return flushed_ == switches_; });
+    }
+    // 先挂上不可变 MemTable 再换活跃 MemTable，读取者不会漏掉其中的数据
+    std::atomic_store(&immutable_, active);
+    std::atomic_store(&active_, std::make_shared<ConcurrentMemTable>());
+    immutable_wal_ = segment_name(wal_segment_);
+    wal_ = std::make_unique<WAL>(segment_name(++wal_segment_));
+    switches_++;
+    flush_cv_.notify_all();
+    return switches_;
+}
+
+void ConcurrentKVDB::insert_into_memtable(const Writer& writer) const {
+    if (!writer.batch) {
+        return;
+    }
+    uint64_t seq = writer.first_seq;
+    for (const auto& op : writer.batch->ops()) {
+        if (op.type == WriteBatch::OpType::DEL) {
+            writer.memtable->del(op.key, seq++);
+        } else {
+            writer.memtable->put(op.key, op.value, seq++);
+        }
+    }
 }
 
-uint64_t ConcurrentKVDB::get_next_seq() {
-    return next_seq_.fetch_add(1);
+bool ConcurrentKVDB::get_internal(const std::string& key, uint64_t snapshot_seq, std::string& value) const {
+    // 活跃 MemTable → 不可变 MemTable → 磁盘各层，遇到墓碑即停止
+    switch (get_from_memtables(key, snapshot_seq, value)) {
+        case MemTableLookup::FOUND:
+            return true;
+        case MemTableLookup::DELETED:
+            return false;
+        case MemTableLookup::MISSING:
+            break;
+    }
+    return legacy_db_->get(key, Snapshot(snapshot_seq), value);
+}
+
+ConcurrentKVDB::MemTableLookup ConcurrentKVDB::get_from_memtables(const std::string& key, uint64_t snapshot_seq,
+                                                                  std::string& value) const {
+    VersionedValue version;
+    std::shared_ptr<ConcurrentMemTable> active = std::atomic_load(&active_);
+    bool found = active->get_version(key, snapshot_seq, version);
+    if (!found) {
+        std::shared_ptr<ConcurrentMemTable> immutable = std::atomic_load(&immutable_);
+        found = immutable && immutable->get_version(key, snapshot_seq, version);
+    }
+    if (!found) {
+        return MemTableLookup::MISSING;
+    }
+    if (version.value == ConcurrentMemTable::TOMBSTONE) {
+        return MemTableLookup::DELETED;
+    }
+    value = std::move(version.value);
+    return MemTableLookup::FOUND;
+}
+
+std::optional<std::string> ConcurrentKVDB::get_from_disk(const std::string& key, uint64_t snapshot_seq) const {
+    // 查 MemTable 之后刷盘的数据已先登记为 SSTable 再摘掉不可变 MemTable，这里同样能读到
+    std::string value;
+    if (legacy_db_->get(key, Snapshot(snapshot_seq), value)) {
+        return value;
+    }
+    return std::nullopt;
+}
+
+void ConcurrentKVDB::flush_worker() {
+    std::unique_lock<std::mutex> lock(flush_mutex_);
+    while (true) {
+        flush_cv_.wait(lock, [this] { return stop_flush_ || flushed_ < switches_; });
+        if (flushed_ == switches_) {
+            break;
+        }
+        lock.unlock();
+        flush_immutable();
+        lock.lock();
+        flushed_++;
+        flush_cv_.notify_all();
+    }
+}
+
+void ConcurrentKVDB::flush_immutable() {
+    // 刷完之前不会再切换 MemTable，immutable_ 与 immutable_wal_ 不会变化
+    std::shared_ptr<ConcurrentMemTable> immutable = std::atomic_load(&immutable_);
+    write_l0_table(*immutable);
+    // SSTable 已登记，读取可以从磁盘找到这些数据，再摘掉不可变 MemTable 并删除其 WAL 段
+    std::atomic_store(&immutable_, std::shared_ptr<ConcurrentMemTable>());
+    std::filesystem::remove(immutable_wal_);
+}
+
+void ConcurrentKVDB::write_l0_table(const ConcurrentMemTable& memtable) {
+    auto all_versions = memtable.get_all_versions();
+    if (all_versions.empty()) {
+        return;
+    }
+    KVDB& db = *legacy_db_;
+    ColumnFamilyData& cfd = *db.default_cf_;
+    db.begin_write_operation();
+    db.install_l0_table(cfd, std::move(all_versions), {}, SSTableProperties());
+    db.end_write_operation();
+    if (db.need_compaction(cfd)) {
+        db.request_compaction();
+    }
 }
 
 // 基础操作实现
 bool ConcurrentKVDB::put(const std::string& key, const std::string& value) {
     auto start = std::chrono::high_resolution_clock::now();
     
-    bool result = execute_write_operation([&]() {
-        uint64_t seq = get_next_seq();
-        concurrent_memtable_->put(key, value, seq);
-        return true;
-    });
+    WriteBatch batch;
+    batch.put(key, value);
+    bool result = write(batch);
     
     auto end = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration<double, std::milli>(end - start).count();
@@ -46,8 +341,7 @@ bool ConcurrentKVDB::get(const std::string& key, std::string& value) {
     auto start = std::chrono::high_resolution_clock::now();
     
     bool result = execute_read_operation([&]() {
-        uint64_t snapshot_seq = next_seq_.load();
-        return concurrent_memtable_->get(key, snapshot_seq, value);
+        return get_internal(key, published_seq_.load(), value);
     });
     
     auto end = std::chrono::high_resolution_clock::now();
@@ -58,11 +352,9 @@ bool ConcurrentKVDB::get(const std::string& key, std::string& value) {
 }
 
 bool ConcurrentKVDB::del(const std::string& key) {
-    return execute_write_operation([&]() {
-        uint64_t seq = get_next_seq();
-        concurrent_memtable_->del(key, seq);
-        return true;
-    });
+    WriteBatch batch;
+    batch.del(key);
+    return write(batch);
 }
 
 // 异步操作实现
@@ -94,21 +386,80 @@ std::future<bool> ConcurrentKVDB::async_delete(const std::string& key) {
     });
 }
 
+// 协程接口实现
+Task<std::optional<std::string>> ConcurrentKVDB::get_async(std::string key) {
+    perf_stats_.async_operations.fetch_add(1);
+    uint64_t snapshot_seq = published_seq_.load();
+    std::string value;
+    switch (get_from_memtables(key, snapshot_seq, value)) {
+        case MemTableLookup::FOUND:
+            co_return value;
+        case MemTableLookup::DELETED:
+            co_return std::nullopt;
+        case MemTableLookup::MISSING:
+            break;
+    }
+    perf_stats_.io_suspensions.fetch_add(1);
+    co_return co_await offload(*io_executor_, *scheduler_,
+                               [this, &key, snapshot_seq] { return get_from_disk(key, snapshot_seq); });
+}
+
+Task<bool> ConcurrentKVDB::put_async(std::string key, std::string value) {
+    perf_stats_.async_operations.fetch_add(1);
+    perf_stats_.io_suspensions.fetch_add(1);
+    // 组提交要等 WAL 写完，交给 I/O 线程等待
+    co_return co_await offload(*io_executor_, *scheduler_, [this, &key, &value] { return put(key, value); });
+}
+
+Task<bool> ConcurrentKVDB::del_async(std::string key) {
+    perf_stats_.async_operations.fetch_add(1);
+    perf_stats_.io_suspensions.fetch_add(1);
+    co_return co_await offload(*io_executor_, *scheduler_, [this, &key] { return del(key); });
+}
+
+Task<std::vector<std::optional<std::string>>> ConcurrentKVDB::multi_get_async(std::vector<std::string> keys) {
+    perf_stats_.async_operations.fetch_add(1);
+    perf_stats_.batch_operations.fetch_add(1);
+    uint64_t snapshot_seq = published_seq_.load();
+    
+    std::vector<std::optional<std::string>> results(keys.size());
+    std::vector<size_t> misses;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        std::string value;
+        MemTableLookup lookup = get_from_memtables(keys[i], snapshot_seq, value);
+        if (lookup == MemTableLookup::FOUND) {
+            results[i] = std::move(value);
+        } else if (lookup == MemTableLookup::MISSING) {
+            misses.push_back(i);
+        }
+    }
+    if (misses.empty()) {
+        co_return results;
+    }
+    
+    std::vector<std::function<std::optional<std::string>()>> reads;
+    reads.reserve(misses.size());
+    for (size_t i : misses) {
+        reads.emplace_back([this, &key = keys[i], snapshot_seq] { return get_from_disk(key, snapshot_seq); });
+    }
+    perf_stats_.io_suspensions.fetch_add(1);
+    auto disk_results = co_await offload_all(*io_executor_, *scheduler_, std::move(reads));
+    for (size_t j = 0; j < misses.size(); ++j) {
+        results[misses[j]] = std::move(disk_results[j]);
+    }
+    co_return results;
+}
+
 // 批量操作实现
 bool ConcurrentKVDB::batch_put(const std::vector<std::pair<std::string, std::string>>& operations) {
     perf_stats_.batch_operations.fetch_add(1);
     
-    return execute_write_operation([&]() {
-        std::vector<std::tuple<std::string, std::string, uint64_t>> batch_ops;
-        batch_ops.reserve(operations.size());
-        
-        for (const auto& [key, value] : operations) {
-            batch_ops.emplace_back(key, value, get_next_seq());
-        }
-        
-        concurrent_memtable_->batch_write(batch_ops);
-        return true;
-    });
+    // 整批一个写入者：序列号连续、一条 WAL 记录，原子可见
+    WriteBatch batch;
+    for (const auto& [key, value] : operations) {
+        batch.put(key, value);
+    }
+    return write(batch);
 }
 
 std::vector<std::optional<std::string>> ConcurrentKVDB::batch_get(const std::vector<std::string>& keys) {
@@ -118,11 +469,11 @@ std::vector<std::optional<std::string>> ConcurrentKVDB::batch_get(const std::vec
         std::vector<std::optional<std::string>> results;
         results.reserve(keys.size());
         
-        uint64_t snapshot_seq = next_seq_.load();
+        uint64_t snapshot_seq = published_seq_.load();
         
         for (const auto& key : keys) {
             std::string value;
-            if (concurrent_memtable_->get(key, snapshot_seq, value)) {
+            if (get_internal(key, snapshot_seq, value)) {
                 results.emplace_back(value);
             } else {
                 results.emplace_back(std::nullopt);
@@ -136,17 +487,11 @@ std::vector<std::optional<std::string>> ConcurrentKVDB::batch_get(const std::vec
 bool ConcurrentKVDB::batch_delete(const std::vector<std::string>& keys) {
     perf_stats_.batch_operations.fetch_add(1);
     
-    return execute_write_operation([&]() {
-        std::vector<std::tuple<std::string, std::string, uint64_t>> batch_ops;
-        batch_ops.reserve(keys.size());
-        
-        for (const auto& key : keys) {
-            batch_ops.emplace_back(key, "__TOMBSTONE__", get_next_seq());
-        }
-        
-        concurrent_memtable_->batch_write(batch_ops);
-        return true;
-    });
+    WriteBatch batch;
+    for (const auto& key : keys) {
+        batch.del(key);
+    }
+    return write(batch);
 }
 
 // 异步批量操作
@@ -183,8 +528,7 @@ bool ConcurrentKVDB::read_only_get(const std::string& key, std::string& value) c
     perf_stats_.lock_free_reads.fetch_add(1);
     
     // 完全无锁的读操作
-    uint64_t snapshot_seq = next_seq_.load();
-    return concurrent_memtable_->get(key, snapshot_seq, value);
+    return get_internal(key, published_seq_.load(), value);
 }
 
 std::vector<std::optional<std::string>> ConcurrentKVDB::read_only_batch_get(
@@ -195,11 +539,11 @@ std::vector<std::optional<std::string>> ConcurrentKVDB::read_only_batch_get(
     std::vector<std::optional<std::string>> results;
     results.reserve(keys.size());
     
-    uint64_t snapshot_seq = next_seq_.load();
+    uint64_t snapshot_seq = published_seq_.load();
     
     for (const auto& key : keys) {
         std::string value;
-        if (concurrent_memtable_->get(key, snapshot_seq, value)) {
+        if (get_internal(key, snapshot_seq, value)) {
             results.emplace_back(value);
         } else {
             results.emplace_back(std::nullopt);
@@ -222,7 +566,7 @@ void ConcurrentKVDB::set_batch_size(size_t batch_size) {
 
 void ConcurrentKVDB::set_write_buffer_size(size_t buffer_size) {
     write_buffer_size_.store(buffer_size);
-    std::cout << "[ConcurrentKVDB] 设置写缓冲区大小: " << buffer_size << "\n";
+    std::cout << "[ConcurrentKVDB] 设置写缓冲区大小: " << buffer_size << " 字节\n";
 }
 
 // 性能监控
@@ -231,8 +575,14 @@ void ConcurrentKVDB::performance_monitor_worker() {
     uint64_t last_reads = 0;
     uint64_t last_writes = 0;
     
-    while (!stop_perf_monitor_.load()) {
-        std::this_thread::sleep_for(std::chrono::seconds(5));
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(perf_monitor_mutex_);
+            if (perf_monitor_cv_.wait_for(lock, std::chrono::seconds(5),
+                                          [this] { return stop_perf_monitor_.load(); })) {
+                break;
+            }
+        }
         
         auto current_time = std::chrono::steady_clock::now();
         auto duration = std::chrono::duration<double>(current_time - last_time).count();
@@ -273,6 +623,7 @@ void ConcurrentKVDB::print_performance_stats() const {
     std::cout << "批量操作次数: " << perf_stats_.batch_operations.load() << "\n";
     std::cout << "锁竞争次数: " << perf_stats_.lock_contentions.load() << "\n";
     std::cout << "异步操作次数: " << perf_stats_.async_operations.load() << "\n";
+    std::cout << "协程 I/O 挂起次数: " << perf_stats_.io_suspensions.load() << "\n";
     std::cout << "平均读取延迟: " << perf_stats_.avg_read_latency.load() << " ms\n";
     std::cout << "平均写入延迟: " << perf_stats_.avg_write_latency.load() << " ms\n";
     std::cout << "吞吐量: " << perf_stats_.throughput_qps.load() << " QPS\n";
@@ -293,6 +644,7 @@ void ConcurrentKVDB::reset_stats() {
     perf_stats_.batch_operations.store(0);
     perf_stats_.lock_contentions.store(0);
     perf_stats_.async_operations.store(0);
+    perf_stats_.io_suspensions.store(0);
     perf_stats_.avg_read_latency.store(0.0);
     perf_stats_.avg_write_latency.store(0.0);
     perf_stats_.throughput_qps.store(0.0);
@@ -300,7 +652,11 @@ void ConcurrentKVDB::reset_stats() {
 
 // 兼容接口
 size_t ConcurrentKVDB::get_memtable_size() const {
-    return concurrent_memtable_->size();
+    size_t total = std::atomic_load(&active_)->size();
+    if (auto immutable = std::atomic_load(&immutable_)) {
+        total += immutable->size();
+    }
+    return total;
 }
 
 double ConcurrentKVDB::get_cache_hit_rate() const {
@@ -308,7 +664,10 @@ double ConcurrentKVDB::get_cache_hit_rate() const {
 }
 
 void ConcurrentKVDB::flush() {
-    execute_write_operation([&]() {
-        legacy_db_->flush();
-    });
+    // 作为写入者排队：它之前确认的写入都在当前 MemTable 或正在刷盘的 MemTable 中
+    Writer writer;
+    writer.force_flush = true;
+    join_write_group(writer);
+    std::unique_lock<std::mutex> lock(flush_mutex_);
+    flush_cv_.wait(lock, [&] { return flushed_ >= writer.flush_target; });
 }
\ No newline at end of file
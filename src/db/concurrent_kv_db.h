@@ -6,13 +6,25 @@
 #include <thread>
 #include <atomic>
 #include <shared_mutex>
+#include <condition_variable>
+#include <deque>
+#include <optional>
 #include <vector>
 #include <future>
 
 // 并发优化的KV数据库
+// 写入：并发写入者排队，队首的 leader 把排在它后面的写入合成一组，一次分配连续序列号、
+// 写一条 WAL 记录并 flush，组内每个写入者再并行插入无锁 MemTable，全部插入后才对读可见。
+// MemTable 写满后转为不可变，换新的 WAL 段，由后台线程刷成 L0 SSTable 交给 KVDB 的版本与压缩；
+// 读取依次查活跃 MemTable、不可变 MemTable 与磁盘各层。重启时按顺序重放未刷盘的 WAL 段
 class ConcurrentKVDB {
 public:
-    explicit ConcurrentKVDB(const std::string& wal_file, size_t num_threads = std::thread::hardware_concurrency());
+    // num_threads 个工作线程运行异步任务与协程，io_threads 个线程执行协程交出的阻塞读写。
+    // 磁盘层（data/、MANIFEST 等）放在 db_path 下；为空时使用 default_db_path(wal_file)
+    explicit ConcurrentKVDB(const std::string& wal_file, size_t num_threads = std::thread::hardware_concurrency(),
+                            size_t io_threads = 16, const std::string& db_path = "");
+    // "<wal_file>.db"：同一工作目录下的多个实例互不共享磁盘层
+    static std::string default_db_path(const std::string& wal_file);
     ~ConcurrentKVDB();
     
     // 基础操作 - 并发优化版本
@@ -25,6 +37,14 @@ public:
     std::future<std::optional<std::string>> async_get(const std::string& key);
     std::future<bool> async_delete(const std::string& key);
     
+    // 协程接口：MemTable 命中时不挂起；需要读 SSTable 或写 WAL 时把阻塞调用交给 I/O 线程，
+    // 完成后在工作线程上恢复。协程需在数据库析构前结束
+    Task<std::optional<std::string>> get_async(std::string key);
+    Task<bool> put_async(std::string key, std::string value);
+    Task<bool> del_async(std::string key);
+    // 以同一快照读取；MemTable 未命中的 key 同时交给 I/O 线程，全部读完后恢复一次
+    Task<std::vector<std::optional<std::string>>> multi_get_async(std::vector<std::string> keys);
+    
     // 批量操作 - 减少锁竞争
     bool batch_put(const std::vector<std::pair<std::string, std::string>>& operations);
     std::vector<std::optional<std::string>> batch_get(const std::vector<std::string>& keys);
@@ -44,6 +64,7 @@ public:
     // 并发控制
     void enable_lock_free_reads(bool enable = true);
     void set_batch_size(size_t batch_size);
+    // MemTable 转为不可变并刷盘的字节数
     void set_write_buffer_size(size_t buffer_size);
     
     // 性能监控
@@ -54,6 +75,7 @@ public:
         std::atomic<uint64_t> batch_operations{0};
         std::atomic<uint64_t> lock_contentions{0};
         std::atomic<uint64_t> async_operations{0};
+        std::atomic<uint64_t> io_suspensions{0};  // 协程为等待磁盘读写而挂起的次数
         
         std::atomic<double> avg_read_latency{0.0};
         std::atomic<double> avg_write_latency{0.0};
@@ -67,35 +89,90 @@ public:
     // 传统接口兼容
     size_t get_memtable_size() const;
     double get_cache_hit_rate() const;
+    // 把已确认的写入全部刷成 SSTable 后返回
     void flush();
+    // 磁盘层（SSTable、版本与压缩），用于查看 LSM 结构与手动压缩
+    KVDB& disk_db() { return *legacy_db_; }
     
 private:
+    // 一次写入请求：由组的 leader 分配序列号并写 WAL，写入者自己插入 MemTable
+    struct Writer {
+        const WriteBatch* batch = nullptr;
+        bool force_flush = false;  // flush() 的请求：先让当前 MemTable 转为不可变
+        uint64_t first_seq = 0;
+        std::shared_ptr<ConcurrentMemTable> memtable;
+        uint64_t flush_target = 0;  // 包含此前写入的 MemTable 的刷盘编号
+        bool insert_ready = false;  // leader 已写 WAL，可以插入 MemTable
+        bool done = false;
+        std::condition_variable cv;  // 只唤醒这个写入者，避免每组唤醒全部排队者
+    };
+    // 组内操作数超过它时写入者各自并行插入 MemTable，否则由 leader 代为插入，省去一轮线程切换
+    static constexpr size_t PARALLEL_INSERT_MIN_OPS = 64;
+    
     // 核心组件
-    std::unique_ptr<ReadWriteSeparatedMemTable> concurrent_memtable_;
+    std::shared_ptr<ConcurrentMemTable> active_;     // 通过 std::atomic_load/store 访问
+    std::shared_ptr<ConcurrentMemTable> immutable_;  // 正在刷盘的 MemTable，没有时为空
     std::unique_ptr<CoroutineScheduler> scheduler_;
-    std::unique_ptr<ConcurrentDBOperations> concurrent_ops_;
+    std::unique_ptr<CoroutineScheduler> io_executor_;  // 只执行阻塞读写，协程在 scheduler_ 上恢复
     
-    // 传统组件（用于兼容）
+    // 磁盘层：共用其序列号、SSTable、MANIFEST 与后台压缩
     std::unique_ptr<KVDB> legacy_db_;
     
+    // WAL 段：<wal_file>.<编号>，每个 MemTable 一段，刷盘后删除
+    std::string wal_file_;
+    std::unique_ptr<WAL> wal_;
+    uint64_t wal_segment_ = 0;
+    std::string immutable_wal_;
+    
+    // 组提交
+    std::mutex write_mutex_;
+    std::deque<Writer*> writers_;
+    size_t pending_inserts_ = 0;
+    std::atomic<uint64_t> published_seq_{0};  // 不超过它的写入都已插入 MemTable，读取以它为快照
+    
+    // 不可变 MemTable 刷盘
+    std::thread flush_thread_;
+    std::mutex flush_mutex_;
+    std::condition_variable flush_cv_;
+    uint64_t switches_ = 0;   // MemTable 转为不可变的次数
+    uint64_t flushed_ = 0;    // 已刷盘的不可变 MemTable 数
+    bool stop_flush_ = false;
+    
     // 并发控制
     mutable std::shared_mutex global_rw_mutex_;
-    std::atomic<uint64_t> next_seq_{0};
     
     // 配置参数
     std::atomic<bool> lock_free_reads_enabled_{true};
     std::atomic<size_t> batch_size_{100};
-    std::atomic<size_t> write_buffer_size_{1000};
+    std::atomic<size_t> write_buffer_size_{4 * 1024 * 1024};
     
     // 性能统计
     mutable ConcurrentPerformanceStats perf_stats_;
     
     // 性能监控线程
     std::thread perf_monitor_thread_;
+    std::mutex perf_monitor_mutex_;
+    std::condition_variable perf_monitor_cv_;
     std::atomic<bool> stop_perf_monitor_{false};
     
     // 内部方法
-    uint64_t get_next_seq();
+    bool write(const WriteBatch& batch);
+    void join_write_group(Writer& writer);
+    // leader 在组内写入前调用：MemTable 写满或收到 flush() 请求时转为不可变，不可变 MemTable 仍在刷盘时等待
+    // 返回组内写入所在 MemTable 的刷盘编号
+    uint64_t make_room_for_write(bool force);
+    void insert_into_memtable(const Writer& writer) const;
+    bool get_internal(const std::string& key, uint64_t snapshot_seq, std::string& value) const;
+    // 只查活跃与不可变 MemTable：FOUND 时 value 为结果，DELETED 表示遇到墓碑，MISSING 需要继续查磁盘
+    enum class MemTableLookup { FOUND, DELETED, MISSING };
+    MemTableLookup get_from_memtables(const std::string& key, uint64_t snapshot_seq, std::string& value) const;
+    std::optional<std::string> get_from_disk(const std::string& key, uint64_t snapshot_seq) const;
+    std::string segment_name(uint64_t segment) const;
+    void recover();
+    void flush_worker();
+    void flush_immutable();
+    // 写成 L0 SSTable 并登记到磁盘层的 MANIFEST，需要时唤醒后台压缩
+    void write_l0_table(const ConcurrentMemTable& memtable);
     void performance_monitor_worker();
     void update_latency_stats(double read_latency, double write_latency);
     
@@ -112,10 +189,4 @@ private:
         }
     }
     
-    template<typename Func>
-    auto execute_write_operation(Func&& func) -> decltype(func()) {
-        std::unique_lock<std::shared_mutex> lock(global_rw_mutex_);
-        perf_stats_.concurrent_writes.fetch_add(1);
-        return func();
-    }
 };
\ No newline at end of file
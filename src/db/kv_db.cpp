@@ -9,72 +9,173 @@
 #include "iterator/merge_iterator.h"
 #include "iterator/concurrent_iterator.h"
 #include "index/index_manager.h"
+#include "blob/blob_iterator.h"
+#include "iterator/ttl_iterator.h"
 #include <filesystem>
 #include <fstream>
 #include <string>
 #include <iostream>
+#include <algorithm>
+#include <sstream>
+#include <cctype>
+#include <chrono>
+#include <unordered_set>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 static const std::string TOMBSTONE = "__TOMBSTONE__";
 
-KVDB::KVDB(const std::string& wal_file)
-    : wal_(wal_file), file_id_(0), version_set_(MAX_LEVEL) {
+namespace {
+
+const char* compaction_strategy_name(CompactionStrategyType type) {
+    switch (type) {
+        case CompactionStrategyType::LEVELED: return "Leveled Compaction";
+        case CompactionStrategyType::TIERED: return "Tiered Compaction";
+        case CompactionStrategyType::SIZE_TIERED: return "Size-Tiered Compaction";
+        case CompactionStrategyType::TIME_WINDOW: return "Time Window Compaction";
+    }
+    return "Unknown";
+}
+
+// 作用域结束时把经过的纳秒数记入直方图
+class LatencyTimer {
+public:
+    explicit LatencyTimer(kvdb::monitoring::HdrHistogram* histogram)
+        : histogram_(histogram), start_(std::chrono::steady_clock::now()) {}
+    ~LatencyTimer() {
+        histogram_->record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start_).count()));
+    }
+
+private:
+    kvdb::monitoring::HdrHistogram* histogram_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace
+
+KVDB::KVDB(const std::string& wal_file, const std::string& db_path)
+    : KVDB(wal_file, db_path, nullptr) {}
+
+KVDB::KVDB(const std::string& wal_file, const std::string& db_path, std::atomic<uint64_t>* shared_seq)
+    : db_path_(db_path), data_dir_(db_file("data")), wal_(wal_file),
+      blob_manager_(data_dir_, db_file(BlobManager::MANIFEST)),
+      seq_(shared_seq ? shared_seq : &own_seq_) {
+    auto op_latency = [this](const char* op) {
+        return &metrics_.histogram("kvdb_db_op_latency_seconds", "KVDB read/write latency in seconds by op",
+                                   1e-9, std::string("op=\"") + op + "\"");
+    };
+    get_latency_ = op_latency("get");
+    batch_latency_ = op_latency("write");
+    write_latency_[static_cast<size_t>(WriteBatch::OpType::PUT)] = op_latency("put");
+    write_latency_[static_cast<size_t>(WriteBatch::OpType::DEL)] = op_latency("delete");
+    write_latency_[static_cast<size_t>(WriteBatch::OpType::DELETE_RANGE)] = op_latency("delete_range");
+    write_latency_[static_cast<size_t>(WriteBatch::OpType::MERGE)] = op_latency("merge");
+    flush_latency_ = &metrics_.histogram("kvdb_flush_duration_seconds", "MemTable flush duration in seconds", 1e-9);
+    compaction_latency_ = &metrics_.histogram("kvdb_compaction_duration_seconds",
+                                              "Compaction task duration in seconds", 1e-9);
+
     // 创建数据目录
-    std::filesystem::create_directories("data");
-    
+    std::filesystem::create_directories(data_dir_);
+
     // 初始化多级缓存管理器
     cache_manager_ = std::make_unique<CacheManager>(
         CacheManager::CacheType::MULTI_LEVEL_CACHE, 1024, 8192);
-    
-    // 初始化多级结构
-    levels_.resize(MAX_LEVEL);
-    
-    // 初始化默认压缩策略
-    std::vector<size_t> level_limits = {
-        4ULL * 1024 * 1024,    // L0: 4MB
-        40ULL * 1024 * 1024,   // L1: 40MB  
-        400ULL * 1024 * 1024,  // L2: 400MB
-        4000ULL * 1024 * 1024  // L3: 4GB
-    };
-    compaction_strategy_ = CompactionStrategyFactory::create_strategy(
-        CompactionStrategyType::LEVELED, level_limits);
-    
+    // 读路径的 BlockCache 向统一内存预算记账；提前创建，避免并发读首次访问时才创建
+    cache_manager_->set_memory_budget(&memory_budget_);
+    cache_manager_->get_block_cache();
+
     std::cout << "[KVDB] 初始化，WAL文件: " << wal_file << std::endl;
-    
-    // 启动顺序：1. 读 Manifest 2. 重建 Version 3. 打开 WAL 4. 重放 WAL
-    version_set_.recover();
-    
-    // 从 VersionSet 恢复数据到 levels_
-    const Version& version = version_set_.current();
-    for (int level = 0; level < MAX_LEVEL; level++) {
-        std::lock_guard<std::mutex> lock(levels_[level].mutex);
-        levels_[level].sstables = version.levels[level];
-        if (!levels_[level].sstables.empty()) {
-            std::cout << "[KVDB] 从 MANIFEST 恢复 L" << level 
-                      << "，共 " << levels_[level].sstables.size() << " 个 SSTable\n";
+
+    // 启动顺序：1. 读列族清单与各列族 Manifest 2. 重建 Version 3. 打开 WAL 4. 重放 WAL
+    recover_column_families();
+    blob_manager_.recover();
+
+    uint64_t recovered_seq = 0;
+    for (ColumnFamilyData* cfd : live_column_families()) {
+        cfd->version_set.recover();
+
+        // 从 VersionSet 恢复数据到各层
+        const Version& version = cfd->version_set.current();
+        for (int level = 0; level < MAX_LEVEL; level++) {
+            std::lock_guard<std::mutex> lock(cfd->levels[level].mutex);
+            cfd->levels[level].sstables = version.levels[level];
+            for (auto& meta : cfd->levels[level].sstables) {
+                meta.range_tombstones = SSTableMetaUtil::read_range_tombstones(meta.filename);
+                meta.properties = SSTableMetaUtil::read_properties(meta.filename);
+                meta.prefix_bloom = SSTableMetaUtil::read_prefix_bloom(meta.filename);
+            }
+            if (!cfd->levels[level].sstables.empty()) {
+                std::cout << "[KVDB] 从 " << cfd->version_set.manifest_path() << " 恢复 [" << cfd->name
+                          << "] L" << level << "，共 " << cfd->levels[level].sstables.size() << " 个 SSTable\n";
+            }
+        }
+
+        // 序列号与文件编号接着已落盘的数据继续分配：否则重启后的新写入会被旧 SSTable 中
+        // 更大的序列号遮蔽，新刷盘的文件也可能覆盖 MANIFEST 中仍在使用的文件。
+        // 所有列族共享序列号和文件编号，取各列族的最大值
+        recovered_seq = std::max(recovered_seq, cfd->version_set.next_seq());
+        for (int level = 0; level < MAX_LEVEL; level++) {
+            for (const auto& meta : version.levels[level]) {
+                std::string stem = std::filesystem::path(meta.filename).stem().string();
+                size_t pos = stem.find_last_of('_');
+                if (pos != std::string::npos && pos + 1 < stem.size() &&
+                    std::all_of(stem.begin() + pos + 1, stem.end(), ::isdigit)) {
+                    file_id_ = std::max(file_id_.load(), std::stoi(stem.substr(pos + 1)) + 1);
+                }
+            }
         }
     }
-    
-    // 启动时 WAL 重放
+    // 共用分配器时其他分片可能已经分到更大的序列号，只能往大调
+    uint64_t current = seq_->load();
+    while (current < recovered_seq && !seq_->compare_exchange_weak(current, recovered_seq)) {
+    }
+
+    // 启动时 WAL 重放：记录按列族编号分发到各自的 MemTable，已删除列族的记录直接丢弃
     // 注意：WAL 重放时使用当前序列号，确保不会覆盖新数据
-    wal_.replay(
-        [this](const std::string& key, const std::string& value) {
-            std::cout << "[KVDB重放] 恢复 key: " << key << " = " << value << std::endl;
+    // 只统计条数，不逐条打印 key/value（既是隐私问题，大 WAL 时也拖慢启动）
+    size_t replayed = 0;
+    wal_.replay_column_families(
+        [this, &replayed](uint32_t cf_id, const std::string& key, const std::string& value) {
             uint64_t seq = next_seq();
-            memtable_.put(key, value, seq);
+            ColumnFamilyData* cfd = find_column_family(cf_id);
+            if (cfd) {
+                cfd->memtable.put(key, value, seq);
+                replayed++;
+            }
         },
-        [this](const std::string& key) {
-            std::cout << "[KVDB重放] 删除 key: " << key << std::endl;
+        [this, &replayed](uint32_t cf_id, const std::string& key) {
             uint64_t seq = next_seq();
-            memtable_.del(key, seq);
+            ColumnFamilyData* cfd = find_column_family(cf_id);
+            if (cfd) {
+                cfd->memtable.del(key, seq);
+                replayed++;
+            }
+        },
+        [this, &replayed](uint32_t cf_id, const std::string& begin, const std::string& end) {
+            uint64_t seq = next_seq();
+            ColumnFamilyData* cfd = find_column_family(cf_id);
+            if (cfd) {
+                cfd->memtable.delete_range(begin, end, seq);
+                replayed++;
+            }
         }
     );
-    
+    if (replayed > 0) {
+        std::cout << "[KVDB] WAL 重放 " << replayed << " 条记录" << std::endl;
+    }
+
     // 启动后台线程
     bg_flush_thread_ = std::thread(&KVDB::flush_worker, this);
     bg_compact_thread_ = std::thread(&KVDB::compact_worker, this);
-    
-    // 初始化索引管理器
+
+    // 初始化索引管理器，并从 LSM 中恢复索引定义
     index_manager_ = std::make_unique<IndexManager>(*this);
+    index_manager_->load_indexes_from_disk();
+    index_manager_->set_memory_budget(&memory_budget_);
+    rebalance_memory();
 }
 
 KVDB::~KVDB() {
@@ -90,14 +191,228 @@ KVDB::~KVDB() {
 }
 
 uint64_t KVDB::next_seq() {
-    return seq_.fetch_add(1, std::memory_order_relaxed);
+    return seq_->fetch_add(1, std::memory_order_relaxed);
+}
+
+std::string KVDB::db_file(const std::string& name) const {
+    return db_path_.empty() ? name : (std::filesystem::path(db_path_) / name).string();
+}
+
+void KVDB::recover_column_families() {
+    column_families_.clear();
+    column_families_.push_back(std::make_unique<ColumnFamilyData>(
+        ColumnFamilyData::DEFAULT_ID, ColumnFamilyData::DEFAULT_NAME, ColumnFamilyOptions(), MAX_LEVEL,
+        &memory_budget_, db_path_));
+    default_cf_ = column_families_.front().get();
+    next_cf_id_ = 1;
+
+    // 清单格式：
+    //   CREATE <编号> <名称> <写缓冲> <压缩策略> <Bloom 位数> <缓存优先级> <层数> <各层上限...> [TTL 秒数]
+    //   DROP <编号>
+    // 同一编号的 CREATE 出现多次时以最后一次的选项为准
+    std::ifstream ifs(db_file(COLUMN_FAMILY_MANIFEST));
+    std::string line;
+    while (std::getline(ifs, line)) {
+        std::istringstream iss(line);
+        std::string op;
+        uint32_t id;
+        if (!(iss >> op >> id)) {
+            continue;
+        }
+
+        if (op == "CREATE") {
+            std::string name;
+            int style, priority;
+            size_t level_count;
+            ColumnFamilyOptions options;
+            if (!(iss >> name >> options.write_buffer_size >> style >> options.bloom_filter_bits
+                      >> priority >> level_count)) {
+                continue;  // 崩溃留下的不完整记录
+            }
+            options.compaction_style = static_cast<CompactionStrategyType>(style);
+            options.cache_priority = static_cast<BlockCache::Priority>(priority);
+            options.level_size_limits.resize(level_count);
+            for (auto& limit : options.level_size_limits) {
+                iss >> limit;
+            }
+            if (!iss) {
+                continue;
+            }
+            iss >> options.ttl_seconds;  // 旧记录没有这一项
+
+            if (id == ColumnFamilyData::DEFAULT_ID) {
+                default_cf_->set_options(options);
+                continue;
+            }
+            if (id >= column_families_.size()) {
+                column_families_.resize(id + 1);
+            }
+            if (column_families_[id]) {
+                column_families_[id]->set_options(options);
+            } else {
+                column_families_[id] = std::make_unique<ColumnFamilyData>(id, name, options, MAX_LEVEL, &memory_budget_, db_path_);
+            }
+            next_cf_id_ = std::max(next_cf_id_, id + 1);
+        } else if (op == "DROP") {
+            if (id != ColumnFamilyData::DEFAULT_ID && id < column_families_.size()) {
+                column_families_[id].reset();
+            }
+        }
+    }
+
+    for (const auto& cfd : column_families_) {
+        if (cfd && cfd.get() != default_cf_) {
+            std::cout << "[KVDB] 恢复列族 [" << cfd->name << "]，编号 " << cfd->id << std::endl;
+        }
+    }
+}
+
+void KVDB::persist_column_family(const ColumnFamilyData& cfd) {
+    std::ofstream ofs(db_file(COLUMN_FAMILY_MANIFEST), std::ios::app);
+    const ColumnFamilyOptions& options = cfd.options;
+    ofs << "CREATE " << cfd.id << " " << cfd.name << " " << options.write_buffer_size << " "
+        << static_cast<int>(options.compaction_style) << " " << options.bloom_filter_bits << " "
+        << static_cast<int>(options.cache_priority) << " " << options.level_size_limits.size();
+    for (size_t limit : options.level_size_limits) {
+        ofs << " " << limit;
+    }
+    ofs << " " << options.ttl_seconds << "\n";
+    ofs.flush();
+}
+
+ColumnFamilyData* KVDB::find_column_family(uint32_t id) const {
+    std::shared_lock<std::shared_mutex> lock(cf_mutex_);
+    if (id >= column_families_.size() || !column_families_[id] || column_families_[id]->dropped) {
+        return nullptr;
+    }
+    return column_families_[id].get();
+}
+
+std::vector<ColumnFamilyData*> KVDB::live_column_families() const {
+    std::shared_lock<std::shared_mutex> lock(cf_mutex_);
+    std::vector<ColumnFamilyData*> result;
+    for (const auto& cfd : column_families_) {
+        if (cfd && !cfd->dropped) {
+            result.push_back(cfd.get());
+        }
+    }
+    return result;
+}
+
+ColumnFamilyData* KVDB::live(ColumnFamilyHandle* cf) const {
+    if (!cf || cf->cfd_->dropped) {
+        return nullptr;
+    }
+    return cf->cfd_;
+}
+
+ColumnFamilyHandle* KVDB::create_column_family(const std::string& name, const ColumnFamilyOptions& options) {
+    if (name.empty() || std::any_of(name.begin(), name.end(), ::isspace)) {
+        std::cerr << "[KVDB] 列族名称不能为空或包含空白字符: '" << name << "'" << std::endl;
+        return nullptr;
+    }
+
+    begin_write_operation();
+    ColumnFamilyData* cfd = nullptr;
+    bool created = false;
+    {
+        std::unique_lock<std::shared_mutex> lock(cf_mutex_);
+        for (const auto& existing : column_families_) {
+            if (existing && !existing->dropped && existing->name == name) {
+                cfd = existing.get();
+                break;
+            }
+        }
+        if (cfd) {
+            cfd->set_options(options);
+        } else {
+            uint32_t id = next_cf_id_++;
+            column_families_.resize(std::max<size_t>(column_families_.size(), id + 1));
+            column_families_[id] = std::make_unique<ColumnFamilyData>(id, name, options, MAX_LEVEL, &memory_budget_, db_path_);
+            cfd = column_families_[id].get();
+            // 编号不复用，同名的 MANIFEST 只可能是别的库留下的
+            std::filesystem::remove(cfd->version_set.manifest_path());
+            created = true;
+        }
+    }
+    persist_column_family(*cfd);
+    end_write_operation();
+
+    std::cout << "[KVDB] " << (created ? "创建" : "更新") << "列族 [" << name << "]，编号 " << cfd->id
+              << "，写缓冲 " << options.write_buffer_size << " 字节，"
+              << compaction_strategy_name(options.compaction_style) << std::endl;
+    return &cfd->handle;
+}
+
+bool KVDB::drop_column_family(ColumnFamilyHandle* cf) {
+    if (!cf || cf->id() == ColumnFamilyData::DEFAULT_ID) {
+        return false;
+    }
+
+    begin_write_operation();
+    ColumnFamilyData& cfd = *cf->cfd_;
+    if (cfd.dropped) {
+        end_write_operation();
+        return false;
+    }
+
+    // 等待正在进行的压缩结束，之后后台线程不会再碰这个列族
+    std::lock_guard<std::mutex> compaction_lock(cfd.compaction_mutex);
+    {
+        std::unique_lock<std::shared_mutex> lock(cf_mutex_);
+        cfd.dropped = true;
+    }
+    {
+        std::ofstream ofs(db_file(COLUMN_FAMILY_MANIFEST), std::ios::app);
+        ofs << "DROP " << cfd.id << "\n";
+    }
+
+    // WAL 中该列族的记录留到整体截断时清理；重放时按已删除列族丢弃
+    cfd.memtable.clear();
+    std::vector<std::string> dropped_files;
+    for (const auto& files : cfd.level_files()) {
+        for (const auto& meta : files) {
+            dropped_files.push_back(meta.filename);
+        }
+    }
+    // 被删除列族引用的 blob 全部记为垃圾
+    blob_manager_.record_garbage(BlobManager::collect_references(dropped_files), BlobRefCounts());
+    for (auto& level : cfd.levels) {
+        std::lock_guard<std::mutex> lock(level.mutex);
+        for (const auto& meta : level.sstables) {
+            std::filesystem::remove(meta.filename);
+        }
+        level.sstables.clear();
+    }
+    std::filesystem::remove(cfd.version_set.manifest_path());
+    end_write_operation();
+
+    std::cout << "[KVDB] 删除列族 [" << cfd.name << "]" << std::endl;
+    return true;
+}
+
+ColumnFamilyHandle* KVDB::get_column_family(const std::string& name) const {
+    for (ColumnFamilyData* cfd : live_column_families()) {
+        if (cfd->name == name) {
+            return &cfd->handle;
+        }
+    }
+    return nullptr;
+}
+
+std::vector<std::string> KVDB::list_column_families() const {
+    std::vector<std::string> names;
+    for (ColumnFamilyData* cfd : live_column_families()) {
+        names.push_back(cfd->name);
+    }
+    return names;
 }
 
 Snapshot KVDB::get_snapshot() {
     // Snapshot 应该看到创建时刻及之前的所有版本
     // fetch_add 返回的是旧值，所以当前 seq_ 是下一个 put 会得到的值
     // 我们需要返回 seq_ - 1，这样 snapshot 能看到所有已完成的 put
-    uint64_t current_seq = seq_.load(std::memory_order_relaxed);
+    uint64_t current_seq = seq_->load(std::memory_order_relaxed);
     // 如果 seq_ > 0，返回 seq_ - 1；否则返回 0
     uint64_t snapshot_seq = (current_seq > 0) ? current_seq - 1 : 0;
     return snapshot_manager_.create(snapshot_seq);
@@ -108,17 +423,26 @@ void KVDB::release_snapshot(const Snapshot& snapshot) {
 }
 
 bool KVDB::put(const std::string& key, const std::string& value) {
+    LatencyTimer timer(write_latency_[static_cast<size_t>(WriteBatch::OpType::PUT)]);
     begin_write_operation();
-    
-    // 获取旧值用于索引更新
+
+    // 只有内存索引（全文/倒排）需要旧值；持久化索引不做 read-before-write
     std::string old_value;
-    bool had_old_value = get(key, old_value);
-    
-    uint64_t seq = next_seq();
-    wal_.log_put(key, value);
-    memtable_.put(key, value, seq);
-    
-    // 更新索引
+    bool had_old_value = false;
+    if (index_manager_ && index_manager_->has_memory_indexes()) {
+        had_old_value = read_value(*default_cf_, key, seq_->load(std::memory_order_relaxed), old_value);
+    }
+
+    // 主记录与持久化索引条目在同一个批内原子写入
+    WriteBatch batch;
+    batch.put(key, value);
+    if (index_manager_ && !index_manager_->append_index_entries(key, value, batch)) {
+        end_write_operation();
+        return false;
+    }
+    apply_batch(batch);
+
+    // 更新内存索引
     if (index_manager_) {
         if (had_old_value) {
             index_manager_->update_indexes(key, old_value, value);
@@ -126,131 +450,464 @@ bool KVDB::put(const std::string& key, const std::string& value) {
             index_manager_->add_to_indexes(key, value);
         }
     }
-    
-    if (memtable_.size() >= MEMTABLE_LIMIT) {
-        request_flush();
-    }
-    
+
+    maybe_request_flush(*default_cf_);
+
     end_write_operation();
     return true;
 }
 
 bool KVDB::del(const std::string& key) {
+    LatencyTimer timer(write_latency_[static_cast<size_t>(WriteBatch::OpType::DEL)]);
     begin_write_operation();
-    
-    // 获取旧值用于索引更新
+
+    // 获取旧值用于内存索引更新；持久化索引的旧条目留给查询回表和 compaction 清理
     std::string old_value;
-    bool had_value = get(key, old_value);
-    
+    bool had_value = false;
+    if (index_manager_ && index_manager_->has_memory_indexes()) {
+        had_value = read_value(*default_cf_, key, seq_->load(std::memory_order_relaxed), old_value);
+    }
+
     uint64_t seq = next_seq();
     wal_.log_del(key);
-    memtable_.del(key, seq);
-    
+    default_cf_->memtable.del(key, seq);
+    default_cf_->num_writes++;
+
     // 从索引中移除
     if (index_manager_ && had_value) {
         index_manager_->remove_from_indexes(key, old_value);
     }
-    
-    if (memtable_.size() >= MEMTABLE_LIMIT) {
-        request_flush();
+
+    maybe_request_flush(*default_cf_);
+
+    end_write_operation();
+    return true;
+}
+
+bool KVDB::delete_range(const std::string& begin, const std::string& end) {
+    if (!(begin < end)) {
+        return false;
     }
-    
+    LatencyTimer timer(write_latency_[static_cast<size_t>(WriteBatch::OpType::DELETE_RANGE)]);
+    begin_write_operation();
+
+    // 内存索引需要逐个移除范围内的 key；持久化索引的旧条目同样留给查询回表和 compaction 清理
+    std::vector<std::pair<std::string, std::string>> removed;
+    if (index_manager_ && index_manager_->has_memory_indexes()) {
+        ReadOptions options;
+        options.iterate_lower_bound = begin;
+        options.iterate_upper_bound = end;
+        uint64_t current_seq = seq_->load();
+        auto iter = new_iterator_internal(*default_cf_, Snapshot(current_seq > 0 ? current_seq - 1 : 0), options);
+        for (iter->seek(begin); iter->valid(); iter->next()) {
+            removed.emplace_back(iter->key(), iter->value());
+        }
+    }
+
+    WriteBatch batch;
+    batch.delete_range(begin, end);
+    apply_batch(batch);
+
+    if (index_manager_) {
+        for (const auto& [key, old_value] : removed) {
+            index_manager_->remove_from_indexes(key, old_value);
+        }
+    }
+
+    maybe_request_flush(*default_cf_);
+
+    end_write_operation();
+    return true;
+}
+
+bool KVDB::merge(const std::string& key, const std::string& operand) {
+    return merge_supported(*default_cf_) && write_internal(*default_cf_, WriteBatch::OpType::MERGE, key, operand);
+}
+
+bool KVDB::put(ColumnFamilyHandle* cf, const std::string& key, const std::string& value) {
+    // 索引只建在默认列族上，默认列族走带索引维护的路径
+    if (cf && cf->id() == ColumnFamilyData::DEFAULT_ID) {
+        return put(key, value);
+    }
+    ColumnFamilyData* cfd = live(cf);
+    return cfd && write_internal(*cfd, WriteBatch::OpType::PUT, key, value);
+}
+
+bool KVDB::del(ColumnFamilyHandle* cf, const std::string& key) {
+    if (cf && cf->id() == ColumnFamilyData::DEFAULT_ID) {
+        return del(key);
+    }
+    ColumnFamilyData* cfd = live(cf);
+    return cfd && write_internal(*cfd, WriteBatch::OpType::DEL, key, "");
+}
+
+bool KVDB::delete_range(ColumnFamilyHandle* cf, const std::string& begin, const std::string& end) {
+    if (cf && cf->id() == ColumnFamilyData::DEFAULT_ID) {
+        return delete_range(begin, end);
+    }
+    ColumnFamilyData* cfd = live(cf);
+    return cfd && begin < end && write_internal(*cfd, WriteBatch::OpType::DELETE_RANGE, begin, end);
+}
+
+bool KVDB::merge(ColumnFamilyHandle* cf, const std::string& key, const std::string& operand) {
+    ColumnFamilyData* cfd = live(cf);
+    return cfd && merge_supported(*cfd) && write_internal(*cfd, WriteBatch::OpType::MERGE, key, operand);
+}
+
+bool KVDB::merge_supported(const ColumnFamilyData& cfd) const {
+    if (!cfd.merge_operator()) {
+        std::cerr << "[KVDB] 列族 [" << cfd.name << "] 没有设置合并操作符" << std::endl;
+        return false;
+    }
+    if (cfd.options.ttl_seconds > 0) {
+        std::cerr << "[KVDB] 列族 [" << cfd.name << "] 开启了 TTL，不支持合并" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool KVDB::write_internal(ColumnFamilyData& cfd, WriteBatch::OpType type, const std::string& key,
+                          const std::string& value) {
+    LatencyTimer timer(write_latency_[static_cast<size_t>(type)]);
+    begin_write_operation();
+    if (cfd.dropped) {
+        end_write_operation();
+        return false;
+    }
+
+    WriteBatch batch;
+    if (type == WriteBatch::OpType::PUT) {
+        batch.put(&cfd.handle, key, value);
+    } else if (type == WriteBatch::OpType::DELETE_RANGE) {
+        batch.delete_range(&cfd.handle, key, value);
+    } else if (type == WriteBatch::OpType::MERGE) {
+        batch.merge(&cfd.handle, key, value);
+    } else {
+        batch.del(&cfd.handle, key);
+    }
+    apply_batch(batch);
+    maybe_request_flush(cfd);
+
+    end_write_operation();
+    return true;
+}
+
+bool KVDB::write(const WriteBatch& batch) {
+    if (batch.empty()) {
+        return true;
+    }
+    LatencyTimer timer(batch_latency_);
+
+    begin_write_operation();
+
+    // 批内涉及的列族必须都存在，否则整批拒绝
+    std::vector<ColumnFamilyData*> touched;
+    for (const auto& op : batch.ops()) {
+        ColumnFamilyData* cfd = find_column_family(op.cf_id);
+        if (!cfd) {
+            end_write_operation();
+            std::cerr << "[KVDB] 批内引用了不存在的列族: " << op.cf_id << std::endl;
+            return false;
+        }
+        if (op.type == WriteBatch::OpType::MERGE && !merge_supported(*cfd)) {
+            end_write_operation();
+            return false;
+        }
+        if (std::find(touched.begin(), touched.end(), cfd) == touched.end()) {
+            touched.push_back(cfd);
+        }
+    }
+
+    apply_batch(batch);
+
+    for (ColumnFamilyData* cfd : touched) {
+        maybe_request_flush(*cfd);
+    }
+
     end_write_operation();
     return true;
 }
 
-std::unique_ptr<Iterator> KVDB::new_iterator(const Snapshot& snapshot) {
+bool KVDB::stamp_ttl(const WriteBatch& batch, WriteBatch& stamped) const {
+    bool has_ttl = std::any_of(batch.ops().begin(), batch.ops().end(), [this](const WriteBatch::Op& op) {
+        return op.type == WriteBatch::OpType::PUT && find_column_family(op.cf_id)->options.ttl_seconds > 0;
+    });
+    if (!has_ttl) {
+        return false;
+    }
+
+    uint64_t now = TtlCompactionFilter::now();
+    for (const auto& op : batch.ops()) {
+        ColumnFamilyData* cfd = find_column_family(op.cf_id);
+        if (op.type == WriteBatch::OpType::PUT) {
+            stamped.put(&cfd->handle, op.key,
+                        cfd->options.ttl_seconds > 0 ? TtlCompactionFilter::encode(op.value, now) : op.value);
+        } else if (op.type == WriteBatch::OpType::DELETE_RANGE) {
+            stamped.delete_range(&cfd->handle, op.key, op.value);
+        } else if (op.type == WriteBatch::OpType::MERGE) {
+            stamped.merge(&cfd->handle, op.key, op.value);
+        } else {
+            stamped.del(&cfd->handle, op.key);
+        }
+    }
+    return true;
+}
+
+void KVDB::apply_batch(const WriteBatch& original) {
+    // 开启 TTL 的列族：值在写 WAL 之前带上写入时间，重放得到的值与写入时一致
+    WriteBatch stamped;
+    const WriteBatch& batch = stamp_ttl(original, stamped) ? stamped : original;
+
+    // 单条记录直接沿用 PUT/DEL 格式，保持 WAL 与旧版本兼容
+    if (batch.count() == 1) {
+        const auto& op = batch.ops().front();
+        if (op.type == WriteBatch::OpType::PUT) {
+            wal_.log_put(op.cf_id, op.key, op.value);
+        } else if (op.type == WriteBatch::OpType::MERGE) {
+            wal_.log_put(op.cf_id, op.key, MergeEntry::encode_operand(op.value));
+        } else if (op.type == WriteBatch::OpType::DELETE_RANGE) {
+            wal_.log_delete_range(op.cf_id, op.key, op.value);
+        } else {
+            wal_.log_del(op.cf_id, op.key);
+        }
+    } else {
+        wal_.log_batch(batch);
+    }
+
+    ColumnFamilyData* cfd = default_cf_;
+    for (const auto& op : batch.ops()) {
+        if (op.cf_id != cfd->id) {
+            cfd = find_column_family(op.cf_id);
+        }
+        uint64_t seq = next_seq();
+        if (op.type == WriteBatch::OpType::PUT) {
+            cfd->memtable.put(op.key, op.value, seq);
+        } else if (op.type == WriteBatch::OpType::MERGE) {
+            // 盲写：不读取已有值，折叠推迟到读取、刷盘与压缩
+            cfd->memtable.put(op.key, MergeEntry::encode_operand(op.value), seq);
+        } else if (op.type == WriteBatch::OpType::DELETE_RANGE) {
+            cfd->memtable.delete_range(op.key, op.value, seq);
+        } else {
+            cfd->memtable.del(op.key, seq);
+        }
+        cfd->num_writes++;
+    }
+}
+
+void KVDB::maybe_request_flush(ColumnFamilyData& cfd) {
+    if (cfd.memtable.size() >= cfd.options.write_buffer_size) {
+        request_flush(cfd);
+    } else if (memory_budget_.should_flush()) {
+        // 全部 MemTable 合计超过写缓冲上限：刷掉最大的一个，即使没有列族单独写满
+        if (ColumnFamilyData* largest = largest_memtable()) {
+            request_flush(*largest);
+        }
+    }
+    if (memory_budget_.over_budget()) {
+        rebalance_memory();
+    }
+}
+
+ColumnFamilyData* KVDB::largest_memtable() const {
+    ColumnFamilyData* largest = nullptr;
+    for (ColumnFamilyData* cfd : live_column_families()) {
+        if (cfd->memtable.size() > 0 && (!largest || cfd->memtable.size() > largest->memtable.size())) {
+            largest = cfd;
+        }
+    }
+    return largest;
+}
+
+void KVDB::rebalance_memory() {
+    // Block Cache 只能使用其他组件剩下的预算；压力下立即淘汰，刷盘释放 MemTable 后再放宽
+    cache_manager_->set_block_cache_byte_limit(memory_budget_.cache_budget());
+}
+
+void KVDB::set_memory_budget(size_t total_bytes, size_t write_buffer_bytes) {
+    memory_budget_.set_limits(total_bytes, write_buffer_bytes);
+    rebalance_memory();
+    if (memory_budget_.should_flush()) {
+        std::shared_lock<std::shared_mutex> lock(db_rw_mutex_);
+        if (ColumnFamilyData* largest = largest_memtable()) {
+            request_flush(*largest);
+        }
+    }
+}
+
+void KVDB::set_blob_options(const BlobOptions& options) {
+    blob_manager_.set_options(options);
+}
+
+BlobOptions KVDB::get_blob_options() const {
+    return blob_manager_.options();
+}
+
+std::vector<BlobFileMeta> KVDB::get_blob_files() const {
+    return blob_manager_.files();
+}
+
+std::string KVDB::relocate_blob(BlobBuilder& builder, const std::string& key, const std::string& stored) {
+    BlobIndex index;
+    if (!BlobIndex::decode(stored, index) || !blob_manager_.needs_relocation(index)) {
+        return stored;
+    }
+    std::string value;
+    if (!blob_manager_.read(index, value)) {
+        std::cerr << "[Blob] 搬迁时读取失败，保留原引用: " << stored << std::endl;
+        return stored;
+    }
+    return builder.add(key, value);
+}
+
+std::unique_ptr<Iterator> KVDB::new_iterator(const Snapshot& snapshot, const ReadOptions& options) {
+    return new_iterator_internal(*default_cf_, snapshot, options);
+}
+
+std::unique_ptr<Iterator> KVDB::new_iterator(ColumnFamilyHandle* cf, const Snapshot& snapshot,
+                                             const ReadOptions& options) {
+    ColumnFamilyData* cfd = live(cf);
+    if (!cfd) {
+        return std::make_unique<MergeIterator>(std::vector<std::unique_ptr<Iterator>>(), options);
+    }
+    return new_iterator_internal(*cfd, snapshot, options);
+}
+
+std::unique_ptr<Iterator> KVDB::new_iterator_internal(ColumnFamilyData& cfd, const Snapshot& snapshot,
+                                                      const ReadOptions& options) {
     std::vector<std::unique_ptr<Iterator>> iters;
+    // 范围删除与子迭代器一一对应，MergeIterator 据此跳过被覆盖的区间
+    MergeRangeTombstones range_tombstones;
+    range_tombstones.snapshot_seq = snapshot.seq;
 
     // 1. 添加 MemTable Iterator
     iters.push_back(
-        std::make_unique<MemTableIterator>(memtable_, snapshot.seq));
+        std::make_unique<MemTableIterator>(cfd.memtable, snapshot.seq, options));
+    range_tombstones.per_child.push_back(cfd.memtable.fragmented_range_tombstones());
 
     // 2. 添加所有 SSTable Iterator（从 L0 到 LMAX，从新到旧）
-    const Version& version = version_set_.current();
     for (int level = 0; level < MAX_LEVEL; level++) {
-        std::lock_guard<std::mutex> lock(levels_[level].mutex);
+        std::lock_guard<std::mutex> lock(cfd.levels[level].mutex);
+        const auto& sstables = cfd.levels[level].sstables;
         // L0: 从新到旧（rbegin）
         // L1+: 从旧到新（begin）
         if (level == 0) {
-            for (auto it = levels_[level].sstables.rbegin(); 
-                 it != levels_[level].sstables.rend(); ++it) {
+            for (auto it = sstables.rbegin(); it != sstables.rend(); ++it) {
                 iters.push_back(
-                    std::make_unique<SSTableIterator>(*it, snapshot.seq));
+                    std::make_unique<SSTableIterator>(*it, snapshot.seq, options));
+                range_tombstones.per_child.push_back(it->range_tombstones);
             }
         } else {
-            for (const auto& meta : levels_[level].sstables) {
+            for (const auto& meta : sstables) {
                 iters.push_back(
-                    std::make_unique<SSTableIterator>(meta, snapshot.seq));
+                    std::make_unique<SSTableIterator>(meta, snapshot.seq, options));
+                range_tombstones.per_child.push_back(meta.range_tombstones);
             }
         }
     }
 
-    return std::make_unique<MergeIterator>(std::move(iters));
+    return wrap_iterator(
+        std::make_unique<MergeIterator>(std::move(iters), options, std::move(range_tombstones), merge_folder(cfd)),
+        cfd);
+}
+
+std::unique_ptr<Iterator> KVDB::new_prefix_iterator(const Snapshot& snapshot, const std::string& prefix,
+                                                    const ReadOptions& options) {
+    return new_prefix_iterator_internal(*default_cf_, snapshot, prefix, options);
+}
+
+std::unique_ptr<Iterator> KVDB::new_prefix_iterator(ColumnFamilyHandle* cf, const Snapshot& snapshot,
+                                                    const std::string& prefix, const ReadOptions& options) {
+    ColumnFamilyData* cfd = live(cf);
+    if (!cfd) {
+        return std::make_unique<MergeIterator>(std::vector<std::unique_ptr<Iterator>>(), options);
+    }
+    return new_prefix_iterator_internal(*cfd, snapshot, prefix, options);
 }
 
-std::unique_ptr<Iterator> KVDB::new_prefix_iterator(const Snapshot& snapshot, const std::string& prefix) {
+std::unique_ptr<Iterator> KVDB::new_prefix_iterator_internal(ColumnFamilyData& cfd, const Snapshot& snapshot,
+                                                             const std::string& prefix,
+                                                             const ReadOptions& options) {
     std::vector<std::unique_ptr<Iterator>> iters;
+    MergeRangeTombstones range_tombstones;
+    range_tombstones.snapshot_seq = snapshot.seq;
+
+    // 前缀内没有数据的子迭代器可以省掉，但带范围删除的必须保留：它可能覆盖更旧数据源中的 key
+    auto add_child = [&](std::unique_ptr<Iterator> iter,
+                         std::shared_ptr<const FragmentedRangeTombstoneList> tombstones) {
+        iter->seek_with_prefix(prefix);
+        if (iter->valid() || tombstones) {
+            iters.push_back(std::move(iter));
+            range_tombstones.per_child.push_back(std::move(tombstones));
+        }
+    };
 
     // 1. 添加 MemTable Iterator with prefix
-    auto mem_iter = std::make_unique<MemTableIterator>(memtable_, snapshot.seq);
-    mem_iter->seek_with_prefix(prefix);
-    if (mem_iter->valid()) {
-        iters.push_back(std::move(mem_iter));
-    }
+    add_child(std::make_unique<MemTableIterator>(cfd.memtable, snapshot.seq, options),
+              cfd.memtable.fragmented_range_tombstones());
 
-    // 2. 添加所有 SSTable Iterator with prefix（从 L0 到 LMAX，从新到旧）
-    const Version& version = version_set_.current();
+    // 2. 添加所有 SSTable Iterator with prefix（从 L0 到 LMAX，从新到旧）。
+    // 打开文件前先用键范围与前缀 Bloom Filter 排除不可能含有该前缀的文件
+    auto prefix_extractor = cfd.prefix_extractor();
+    auto add_sstable = [&](const SSTableMeta& meta) {
+        if (!meta.range_tombstones && !meta.may_contain_prefix(prefix, prefix_extractor.get())) {
+            return;
+        }
+        add_child(std::make_unique<SSTableIterator>(meta, snapshot.seq, options), meta.range_tombstones);
+    };
     for (int level = 0; level < MAX_LEVEL; level++) {
-        std::lock_guard<std::mutex> lock(levels_[level].mutex);
+        std::lock_guard<std::mutex> lock(cfd.levels[level].mutex);
+        const auto& sstables = cfd.levels[level].sstables;
         // L0: 从新到旧（rbegin）
         // L1+: 从旧到新（begin）
         if (level == 0) {
-            for (auto it = levels_[level].sstables.rbegin(); 
-                 it != levels_[level].sstables.rend(); ++it) {
-                auto sstable_iter = std::make_unique<SSTableIterator>(*it, snapshot.seq);
-                sstable_iter->seek_with_prefix(prefix);
-                if (sstable_iter->valid()) {
-                    iters.push_back(std::move(sstable_iter));
-                }
+            for (auto it = sstables.rbegin(); it != sstables.rend(); ++it) {
+                add_sstable(*it);
             }
         } else {
-            for (const auto& meta : levels_[level].sstables) {
-                auto sstable_iter = std::make_unique<SSTableIterator>(meta, snapshot.seq);
-                sstable_iter->seek_with_prefix(prefix);
-                if (sstable_iter->valid()) {
-                    iters.push_back(std::move(sstable_iter));
-                }
+            for (const auto& meta : sstables) {
+                add_sstable(meta);
             }
         }
     }
 
     if (iters.empty()) {
         // 返回一个空的迭代器
-        return std::make_unique<MergeIterator>(std::move(iters));
+        return std::make_unique<MergeIterator>(std::move(iters), options);
     }
 
-    auto merge_iter = std::make_unique<MergeIterator>(std::move(iters));
+    auto merge_iter = std::make_unique<MergeIterator>(std::move(iters), options, std::move(range_tombstones),
+                                                      merge_folder(cfd));
     merge_iter->seek_with_prefix(prefix);
-    return merge_iter;
+    return wrap_iterator(std::move(merge_iter), cfd);
+}
+
+std::unique_ptr<Iterator> KVDB::wrap_iterator(std::unique_ptr<Iterator> iter, const ColumnFamilyData& cfd) {
+    if (!blob_manager_.empty()) {
+        iter = std::make_unique<BlobResolvingIterator>(std::move(iter), blob_manager_,
+                                                       cache_manager_->get_block_cache(), cfd.options.cache_priority);
+    }
+    if (cfd.options.ttl_seconds > 0) {
+        iter = std::make_unique<TtlIterator>(std::move(iter), cfd.options.ttl_seconds);
+    }
+    return iter;
 }
 
 std::shared_ptr<ConcurrentIterator> KVDB::new_concurrent_iterator(const Snapshot& snapshot) {
     std::shared_lock<std::shared_mutex> lock(db_rw_mutex_);
-    
+
     auto inner_iter = new_iterator(snapshot);
     auto concurrent_iter = std::make_shared<ConcurrentIterator>(std::move(inner_iter));
-    
+
     IteratorManager::instance().register_iterator(concurrent_iter);
     return concurrent_iter;
 }
 
 std::shared_ptr<ConcurrentIterator> KVDB::new_concurrent_prefix_iterator(const Snapshot& snapshot, const std::string& prefix) {
     std::shared_lock<std::shared_mutex> lock(db_rw_mutex_);
-    
+
     auto inner_iter = new_prefix_iterator(snapshot, prefix);
     auto concurrent_iter = std::make_shared<ConcurrentIterator>(std::move(inner_iter));
-    
+
     IteratorManager::instance().register_iterator(concurrent_iter);
     return concurrent_iter;
 }
@@ -258,10 +915,10 @@ std::shared_ptr<ConcurrentIterator> KVDB::new_concurrent_prefix_iterator(const S
 void KVDB::begin_write_operation() {
     // 获取写锁，阻塞新的读操作
     db_rw_mutex_.lock();
-    
+
     // 使所有现有迭代器失效
     IteratorManager::instance().invalidate_all_iterators();
-    
+
     // 等待所有正在进行的读操作完成
     IteratorManager::instance().wait_for_iterators();
 }
@@ -271,46 +928,72 @@ void KVDB::end_write_operation() {
 }
 
 void KVDB::set_compaction_strategy(CompactionStrategyType type) {
-    std::lock_guard<std::mutex> lock(compaction_strategy_mutex_);
-    
-    std::vector<size_t> level_limits = {
-        4ULL * 1024 * 1024,    // L0: 4MB
-        40ULL * 1024 * 1024,   // L1: 40MB  
-        400ULL * 1024 * 1024,  // L2: 400MB
-        4000ULL * 1024 * 1024  // L3: 4GB
-    };
-    
-    compaction_strategy_ = CompactionStrategyFactory::create_strategy(type, level_limits);
-    
-    std::cout << "[Compaction] 切换到策略: ";
-    switch (type) {
-        case CompactionStrategyType::LEVELED:
-            std::cout << "Leveled Compaction\n";
-            break;
-        case CompactionStrategyType::TIERED:
-            std::cout << "Tiered Compaction\n";
-            break;
-        case CompactionStrategyType::SIZE_TIERED:
-            std::cout << "Size-Tiered Compaction\n";
-            break;
-        case CompactionStrategyType::TIME_WINDOW:
-            std::cout << "Time Window Compaction\n";
-            break;
+    set_compaction_strategy(default_column_family(), type);
+}
+
+void KVDB::set_compaction_strategy(ColumnFamilyHandle* cf, CompactionStrategyType type) {
+    ColumnFamilyData* cfd = live(cf);
+    if (!cfd) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(cfd->compaction_strategy_mutex);
+        cfd->options.compaction_style = type;
+        cfd->compaction_strategy = CompactionStrategyFactory::create_strategy(type, cfd->options.level_size_limits);
     }
+
+    std::cout << "[Compaction] [" << cfd->name << "] 切换到策略: " << compaction_strategy_name(type) << "\n";
 }
 
 CompactionStrategyType KVDB::get_compaction_strategy() const {
-    std::lock_guard<std::mutex> lock(compaction_strategy_mutex_);
-    return compaction_strategy_->get_type();
+    return get_compaction_strategy(default_column_family());
+}
+
+CompactionStrategyType KVDB::get_compaction_strategy(ColumnFamilyHandle* cf) const {
+    const ColumnFamilyData& cfd = *cf->cfd_;
+    std::lock_guard<std::mutex> lock(cfd.compaction_strategy_mutex);
+    return cfd.compaction_strategy->get_type();
 }
 
 const CompactionStats& KVDB::get_compaction_stats() const {
-    std::lock_guard<std::mutex> lock(compaction_strategy_mutex_);
-    return compaction_strategy_->get_stats();
+    return get_compaction_stats(default_column_family());
+}
+
+const CompactionStats& KVDB::get_compaction_stats(ColumnFamilyHandle* cf) const {
+    const ColumnFamilyData& cfd = *cf->cfd_;
+    std::lock_guard<std::mutex> lock(cfd.compaction_strategy_mutex);
+    return cfd.compaction_strategy->get_stats();
+}
+
+bool KVDB::pin_background_threads(int cpu) {
+#ifdef __linux__
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    bool ok = true;
+    for (std::thread* t : {&bg_flush_thread_, &bg_compact_thread_}) {
+        if (t->joinable() && pthread_setaffinity_np(t->native_handle(), sizeof(cpus), &cpus) != 0) {
+            ok = false;
+        }
+    }
+    return ok;
+#else
+    (void)cpu;
+    return false;
+#endif
 }
 
 size_t KVDB::get_memtable_size() const {
-    return memtable_.size();
+    return default_cf_->memtable.size();
+}
+
+size_t KVDB::get_memtable_size(ColumnFamilyHandle* cf) const {
+    ColumnFamilyData* cfd = live(cf);
+    return cfd ? cfd->memtable.size() : 0;
 }
 
 size_t KVDB::get_wal_size() const {
@@ -322,22 +1005,58 @@ size_t KVDB::get_wal_size() const {
 }
 
 void KVDB::print_lsm_structure() const {
-    const Version& version = version_set_.current();
+    for (ColumnFamilyData* cfd : live_column_families()) {
+        print_column_family(*cfd);
+    }
+
+    auto blob_files = blob_manager_.files();
+    if (!blob_files.empty()) {
+        std::cout << "Blob: (" << blob_files.size() << " 个文件)\n";
+        for (const auto& meta : blob_files) {
+            std::cout << "  blob_" << meta.file_number << ".blob " << meta.total_count << " 个值, "
+                      << meta.total_bytes << " 字节, 垃圾比例 " << meta.garbage_ratio() << "\n";
+        }
+    }
+}
+
+void KVDB::print_column_family(const ColumnFamilyData& cfd) const {
+    CompactionStrategyType type;
+    CompactionStats stats;
+    {
+        std::lock_guard<std::mutex> lock(cfd.compaction_strategy_mutex);
+        type = cfd.compaction_strategy->get_type();
+        stats = cfd.compaction_strategy->get_stats();
+    }
+
+    std::cout << "[" << cfd.name << "] MemTable " << cfd.memtable.size() << "/" << cfd.options.write_buffer_size
+              << " 字节, " << compaction_strategy_name(type)
+              << ", Bloom " << cfd.options.bloom_filter_bits << " 位"
+              << ", 缓存优先级 " << (cfd.options.cache_priority == BlockCache::Priority::HIGH ? "HIGH" : "LOW")
+              << "\n";
+    std::cout << "  写入 " << cfd.num_writes.load() << " 次, 刷盘 " << cfd.num_flushes.load()
+              << " 次, 压缩 " << stats.total_compactions << " 次, 写放大 " << stats.write_amplification << "\n";
+
     for (int level = 0; level < MAX_LEVEL; level++) {
-        std::lock_guard<std::mutex> lock(levels_[level].mutex);
-        if (levels_[level].sstables.empty()) continue;
-        
-        std::cout << "L" << level << ":\n";
-        for (const auto& meta : levels_[level].sstables) {
+        std::lock_guard<std::mutex> lock(cfd.levels[level].mutex);
+        if (cfd.levels[level].sstables.empty()) continue;
+
+        size_t level_bytes = 0;
+        for (const auto& meta : cfd.levels[level].sstables) {
+            level_bytes += meta.file_size;
+        }
+        std::cout << "L" << level << ": (" << cfd.levels[level].sstables.size() << " 个文件, "
+                  << level_bytes << " 字节)\n";
+        for (const auto& meta : cfd.levels[level].sstables) {
             std::filesystem::path p(meta.filename);
             std::string filename = p.filename().string();
-            std::cout << "  " << filename << " [" << meta.min_key 
+            std::cout << "  " << filename << " [" << meta.min_key
                       << ", " << meta.max_key << "]\n";
         }
     }
 }
 
-void KVDB::request_flush() {
+void KVDB::request_flush(ColumnFamilyData& cfd) {
+    cfd.flush_requested.store(true);
     flush_requested_.store(true);
     flush_cv_.notify_one();
 }
@@ -347,17 +1066,24 @@ void KVDB::request_compaction() {
     flush_cv_.notify_one();
 }
 
-bool KVDB::need_compaction() const {
-    std::lock_guard<std::mutex> strategy_lock(compaction_strategy_mutex_);
-    
-    // 构建当前层级状态
-    std::vector<std::vector<SSTableMeta>> current_levels(MAX_LEVEL);
-    for (int level = 0; level < MAX_LEVEL; level++) {
-        std::lock_guard<std::mutex> lock(levels_[level].mutex);
-        current_levels[level] = levels_[level].sstables;
+bool KVDB::need_compaction(const ColumnFamilyData& cfd) const {
+    // 有整体过期的文件时也需要压缩，由 compact_column_family 直接删除
+    if (cfd.options.ttl_seconds > 0) {
+        uint64_t now = TtlCompactionFilter::now();
+        for (int level = 0; level < MAX_LEVEL; level++) {
+            std::lock_guard<std::mutex> lock(cfd.levels[level].mutex);
+            for (const auto& meta : cfd.levels[level].sstables) {
+                if (is_file_expired(cfd, meta, now)) {
+                    return true;
+                }
+            }
+        }
     }
-    
-    return compaction_strategy_->needs_compaction(current_levels);
+
+    std::lock_guard<std::mutex> strategy_lock(cfd.compaction_strategy_mutex);
+
+    // 构建当前层级状态
+    return cfd.compaction_strategy->needs_compaction(cfd.level_files());
 }
 
 void KVDB::flush_worker() {
@@ -372,182 +1098,716 @@ void KVDB::flush_worker() {
         if (flush_requested_.load()) {
             flush_requested_.store(false);
             lock.unlock();
-            
-            flush();  // ⚠️ 真正的 IO
-            
-            if (need_compaction()) {
-                compact();
+
+            // 只刷写缓冲已满的列族
+            for (ColumnFamilyData* cfd : live_column_families()) {
+                if (!cfd->flush_requested.exchange(false)) {
+                    continue;
+                }
+                flush(&cfd->handle);  // ⚠️ 真正的 IO
+
+                if (need_compaction(*cfd)) {
+                    compact_column_family(*cfd);
+                }
             }
         } else if (compaction_requested_.load()) {
             compaction_requested_.store(false);
             lock.unlock();
-            
+
             compact();
         }
     }
 }
 
 void KVDB::flush() {
-    auto all_versions = memtable_.get_all_versions();
-    if (all_versions.empty()) {
-        std::cout << "MemTable 为空，无需刷盘\n";
+    begin_write_operation();
+    for (ColumnFamilyData* cfd : live_column_families()) {
+        flush_column_family(*cfd);
+    }
+    end_write_operation();
+}
+
+void KVDB::flush(ColumnFamilyHandle* cf) {
+    begin_write_operation();
+    ColumnFamilyData* cfd = live(cf);
+    if (cfd) {
+        flush_column_family(*cfd);
+    }
+    end_write_operation();
+}
+
+void KVDB::flush_column_family(ColumnFamilyData& cfd) {
+    auto all_versions = cfd.memtable.get_all_versions();
+    if (cfd.memtable.empty()) {
+        std::cout << "[" << cfd.name << "] MemTable 为空，无需刷盘\n";
         return;
     }
-    
+
+    // 写入 SSTable（多版本格式），范围删除以碎片化后的形式写入独立的范围删除块
+    std::vector<RangeTombstone> range_tombstones;
+    if (auto fragmented = cfd.memtable.fragmented_range_tombstones()) {
+        range_tombstones = fragmented->to_tombstones();
+    }
+    // 属性块记下 MemTable 的写入时间范围，TTL 据此判断整个文件是否过期
+    SSTableProperties properties;
+    properties.min_timestamp = cfd.memtable.min_write_time();
+    properties.max_timestamp = cfd.memtable.max_write_time();
+    install_l0_table(cfd, std::move(all_versions), range_tombstones, properties);
+
+    // 清空 MemTable，释放出的预算还给 Block Cache
+    cfd.memtable.clear();
+    cfd.num_flushes++;
+    rebalance_memory();
+
+    // WAL 由所有列族共享：全部 MemTable 都为空时截断，否则写入该列族的刷盘标记，
+    // 重放时跳过它在标记之前的记录
+    auto column_families = live_column_families();
+    bool all_flushed = std::all_of(column_families.begin(), column_families.end(),
+        [](const ColumnFamilyData* other) { return other->memtable.size() == 0; });
+    if (all_flushed) {
+        std::ofstream ofs(wal_.get_filename(), std::ios::trunc);
+    } else {
+        wal_.log_flushed(cfd.id);
+    }
+
+    std::cout << "刷盘完成，MemTable 已清空\n";
+}
+
+void KVDB::install_l0_table(ColumnFamilyData& cfd, std::map<std::string, std::vector<VersionedValue>> all_versions,
+                            const std::vector<RangeTombstone>& range_tombstones,
+                            const SSTableProperties& properties) {
+    LatencyTimer timer(flush_latency_);
     // 生成 SSTable 文件名
-    std::string filename = "data/sstable_" + std::to_string(file_id_++) + ".dat";
-    
-    std::cout << "刷盘到: " << filename << std::endl;
-    
-    // 写入 SSTable（多版本格式）
-    SSTableWriter::write(filename, all_versions);
-    
+    std::string filename = data_dir_ + "/sstable_" + std::to_string(file_id_++) + ".dat";
+
+    std::cout << "[" << cfd.name << "] 刷盘到: " << filename << std::endl;
+
+    // 合并操作数在刷盘时部分合并：每个 SSTable 中的合并条目都包含该文件里更旧的操作数
+    collapse_merge_operands(cfd, all_versions);
+
+    // 键值分离：大值写入 blob 文件，SSTable 中只留引用（合并条目留在 SSTable 中）
+    BlobBuilder blob_builder(blob_manager_);
+    for (auto& [key, versions] : all_versions) {
+        for (auto& version : versions) {
+            if (version.value != TOMBSTONE && !MergeEntry::matches(version.value) &&
+                blob_manager_.should_separate(version.value)) {
+                version.value = blob_builder.add(key, version.value);
+            }
+        }
+    }
+
+    SSTableWriter::write(filename, all_versions, cfd.options.bloom_filter_bits, range_tombstones, properties,
+                         cfd.prefix_extractor().get());
+    // blob 文件先于引用它的 SSTable 登记
+    blob_builder.commit();
+
     // 获取 SSTable 元数据并添加到 L0
     SSTableMeta meta = SSTableMetaUtil::get_meta_from_file(filename);
     {
-        std::lock_guard<std::mutex> lock(levels_[0].mutex);
-        levels_[0].sstables.push_back(meta);
-        std::cout << "添加到 L0，当前 L0 SSTable 数量: " << levels_[0].sstables.size() << std::endl;
-        
+        std::lock_guard<std::mutex> lock(cfd.levels[0].mutex);
+        cfd.levels[0].sstables.push_back(meta);
+        std::cout << "添加到 L0，当前 L0 SSTable 数量: " << cfd.levels[0].sstables.size() << std::endl;
+
         // 先写 Manifest，再改内存 Version
-        version_set_.persist_add(meta, 0);
-        version_set_.add_file(0, meta);
+        cfd.version_set.persist_add(meta, 0);
+        cfd.version_set.persist_next_seq(seq_->load());
+        cfd.version_set.add_file(0, meta);
+    }
+}
+
+bool KVDB::ingest_external_files(const std::vector<std::string>& paths,
+                                 const IngestExternalFileOptions& options) {
+    if (paths.empty()) {
+        return true;
+    }
+    
+    // 读取元数据，按键排序后检查文件之间互不重叠
+    std::vector<SSTableMeta> metas;
+    for (const auto& path : paths) {
+        if (!std::filesystem::exists(path)) {
+            std::cerr << "[Ingest] 文件不存在: " << path << std::endl;
+            return false;
+        }
+        SSTableMeta meta = SSTableMetaUtil::get_meta_from_file(path);
+        if (meta.min_key.empty() && meta.max_key.empty()) {
+            std::cerr << "[Ingest] 文件为空或格式无法识别: " << path << std::endl;
+            return false;
+        }
+        metas.push_back(meta);
+    }
+    std::sort(metas.begin(), metas.end(),
+              [](const SSTableMeta& a, const SSTableMeta& b) { return a.min_key < b.min_key; });
+    for (size_t i = 1; i < metas.size(); i++) {
+        if (metas[i - 1].overlaps_with(metas[i])) {
+            std::cerr << "[Ingest] 待导入文件键区间重叠: " << metas[i - 1].filename
+                      << " / " << metas[i].filename << std::endl;
+            return false;
+        }
+    }
+    
+    begin_write_operation();
+    
+    // 1. 与 MemTable 重叠时先刷盘，导入的文件才能排在这些写入之后
+    bool overlaps_memtable = std::any_of(metas.begin(), metas.end(),
+        [this](const SSTableMeta& meta) { return memtable_overlaps(meta); });
+    if (overlaps_memtable) {
+        if (!options.allow_blocking_flush) {
+            end_write_operation();
+            std::cerr << "[Ingest] 文件与 MemTable 重叠且不允许刷盘" << std::endl;
+            return false;
+        }
+        flush_column_family(*default_cf_);  // 持锁期间没有新写入进入 MemTable
+    }
+    
+    // 2. 选择层级：不与上层任何文件重叠的最深层级
+    std::vector<int> target_levels;
+    bool overlaps_any = false;
+    for (const auto& meta : metas) {
+        bool overlaps = false;
+        target_levels.push_back(pick_ingest_level(meta, overlaps));
+        overlaps_any = overlaps_any || overlaps;
+    }
+    if (overlaps_any && !options.allow_global_seqno) {
+        end_write_operation();
+        std::cerr << "[Ingest] 文件与现有数据重叠且不允许分配全局序列号" << std::endl;
+        return false;
+    }
+    
+    // 3. 整批共享一个全局序列号：比现有数据都新，之前获取的快照看不到导入的数据。
+    //    库中从未写入过数据时序列号为 0，此时文件与普通文件无异
+    uint64_t global_seq = options.allow_global_seqno ? next_seq() : 0;
+    
+    // 4. 硬链接进 data/；失败时回滚已链接的文件，源文件不受影响
+    std::vector<std::pair<int, SSTableMeta>> edits;
+    for (size_t i = 0; i < metas.size(); i++) {
+        std::string filename;
+        do {
+            filename = data_dir_ + "/sstable_" + std::to_string(file_id_++) + ".dat";
+        } while (std::filesystem::exists(filename));
+        
+        if (!link_ingested_file(metas[i].filename, filename, options.move_files)) {
+            for (const auto& edit : edits) {
+                std::filesystem::remove(edit.second.filename);
+            }
+            end_write_operation();
+            std::cerr << "[Ingest] 链接文件失败: " << metas[i].filename << " -> " << filename << std::endl;
+            return false;
+        }
+        
+        SSTableMeta linked = metas[i];
+        linked.filename = filename;
+        linked.global_seq = global_seq;
+        edits.emplace_back(target_levels[i], linked);
+    }
+    
+    // 5. 先把整批变更作为一条记录写入 Manifest，再改内存 Version
+    if (!default_cf_->version_set.persist_ingest(edits, seq_->load())) {
+        for (const auto& edit : edits) {
+            std::filesystem::remove(edit.second.filename);
+        }
+        end_write_operation();
+        std::cerr << "[Ingest] 写入 MANIFEST 失败" << std::endl;
+        return false;
+    }
+    for (const auto& [level, meta] : edits) {
+        std::lock_guard<std::mutex> lock(default_cf_->levels[level].mutex);
+        default_cf_->levels[level].sstables.push_back(meta);
+        default_cf_->version_set.add_file(level, meta);
+    }
+    
+    end_write_operation();
+    
+    if (options.move_files) {
+        for (const auto& meta : metas) {
+            std::error_code ec;
+            std::filesystem::remove(meta.filename, ec);
+        }
+    }
+    
+    std::cout << "[Ingest] 导入 " << edits.size() << " 个 SSTable，全局序列号 " << global_seq << "：";
+    for (const auto& [level, meta] : edits) {
+        std::cout << " " << meta.filename << "->L" << level;
+    }
+    std::cout << std::endl;
+    
+    if (need_compaction(*default_cf_)) {
+        request_compaction();
+    }
+    return true;
+}
+
+bool KVDB::memtable_overlaps(const SSTableMeta& meta) const {
+    const auto& table = default_cf_->memtable.get_table();
+    auto it = table.lower_bound(meta.min_key);
+    if (it != table.end() && it->first <= meta.max_key) {
+        return true;
+    }
+    // 范围删除同样要先刷盘，否则它会盖住排在其后的注入数据
+    for (const auto& tombstone : default_cf_->memtable.get_range_tombstones()) {
+        if (tombstone.start <= meta.max_key && meta.min_key < tombstone.end) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int KVDB::pick_ingest_level(const SSTableMeta& meta, bool& overlaps) const {
+    // 自上而下找到第一个有重叠的层级，放到它的上一层；L0 重叠时只能放入 L0（作为最新的文件）
+    overlaps = false;
+    int target = 0;
+    for (int level = 0; level < MAX_LEVEL; level++) {
+        std::lock_guard<std::mutex> lock(default_cf_->levels[level].mutex);
+        for (const auto& sstable : default_cf_->levels[level].sstables) {
+            if (sstable.overlaps_with(meta)) {
+                overlaps = true;
+                return target;
+            }
+        }
+        target = level;
+    }
+    return target;
+}
+
+bool KVDB::link_ingested_file(const std::string& src, const std::string& dst, bool move_files) {
+    // 硬链接不拷贝数据；跨文件系统或不允许链接时退化为拷贝
+    std::error_code ec;
+    if (move_files) {
+        std::filesystem::create_hard_link(src, dst, ec);
+        if (!ec) {
+            return true;
+        }
+    }
+    ec.clear();
+    std::filesystem::copy_file(src, dst, ec);
+    return !ec;
+}
+
+std::vector<std::string> KVDB::get_approximate_split_keys(size_t num_ranges) const {
+    std::vector<std::string> boundaries;
+    for (int level = 0; level < MAX_LEVEL; level++) {
+        std::lock_guard<std::mutex> lock(default_cf_->levels[level].mutex);
+        for (const auto& sstable : default_cf_->levels[level].sstables) {
+            boundaries.push_back(sstable.min_key);
+            boundaries.push_back(sstable.max_key);
+        }
+    }
+    std::sort(boundaries.begin(), boundaries.end());
+    boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+    
+    // 在 SSTable 边界中等间隔取 num_ranges - 1 个分割点
+    std::vector<std::string> split_keys;
+    if (num_ranges <= 1 || boundaries.size() < 2) {
+        return split_keys;
+    }
+    for (size_t i = 1; i < num_ranges; i++) {
+        const std::string& key = boundaries[i * boundaries.size() / num_ranges];
+        if (!key.empty() && (split_keys.empty() || split_keys.back() < key)) {
+            split_keys.push_back(key);
+        }
+    }
+    return split_keys;
+}
+
+bool KVDB::get(const std::string& key, std::string& value) {
+    // 使用当前最新序列号作为 snapshot
+    uint64_t current_seq = seq_->load(std::memory_order_relaxed);
+    return get_internal(*default_cf_, key, current_seq, value);
+}
+
+bool KVDB::get(const std::string& key, const Snapshot& snapshot, std::string& value) {
+    return get_internal(*default_cf_, key, snapshot.seq, value);
+}
+
+bool KVDB::get(ColumnFamilyHandle* cf, const std::string& key, std::string& value) {
+    ColumnFamilyData* cfd = live(cf);
+    return cfd && get_internal(*cfd, key, seq_->load(std::memory_order_relaxed), value);
+}
+
+bool KVDB::get(ColumnFamilyHandle* cf, const std::string& key, const Snapshot& snapshot, std::string& value) {
+    ColumnFamilyData* cfd = live(cf);
+    return cfd && get_internal(*cfd, key, snapshot.seq, value);
+}
+
+bool KVDB::get_internal(ColumnFamilyData& cfd, const std::string& key, uint64_t snapshot_seq, std::string& value) {
+    LatencyTimer timer(get_latency_);
+    return read_value(cfd, key, snapshot_seq, value);
+}
+
+bool KVDB::read_value(ColumnFamilyData& cfd, const std::string& key, uint64_t snapshot_seq, std::string& value) {
+    if (!get_stored(cfd, key, snapshot_seq, value)) {
+        return false;
+    }
+    if (MergeEntry::matches(value)) {
+        return resolve_merge(cfd, key, snapshot_seq, value);
+    }
+    if (cfd.options.ttl_seconds == 0) {
+        return true;
+    }
+
+    // TTL：过期的值视为不存在，其余去掉写入时间后返回
+    TtlCompactionFilter ttl(cfd.options.ttl_seconds);
+    std::string stored = std::move(value);
+    uint64_t timestamp = 0;
+    return !TtlCompactionFilter::decode(stored, value, timestamp) ||
+           !ttl.is_expired(timestamp, TtlCompactionFilter::now());
+}
+
+bool KVDB::get_stored(ColumnFamilyData& cfd, const std::string& key, uint64_t snapshot_seq, std::string& value) {
+    // 创建缓存引用；结果按列族的优先级进入缓存
+    BlockCache& cache = cache_manager_->get_block_cache();
+    BlockCache::Priority priority = cfd.options.cache_priority;
+
+    // 数据源从新到旧检查。某个数据源的范围删除覆盖 key 时，只有同一数据源中序列号更大的版本可见，
+    // 更旧的数据源整体被覆盖，不必再查
+    uint64_t tombstone_seq = 0;
+
+    // 1. 先检查MemTable
+    auto mem_tombstones = cfd.memtable.fragmented_range_tombstones();
+    if (mem_tombstones && mem_tombstones->max_covering_seq(key, snapshot_seq, tombstone_seq)) {
+        VersionedValue version;
+        if (cfd.memtable.get_version(key, snapshot_seq, version) && version.seq > tombstone_seq &&
+            version.value != TOMBSTONE) {
+            value = version.value;
+            return true;
+        }
+        return false;
+    }
+    // MemTable 中的墓碑同样遮蔽更旧的数据源，不能当作未命中继续查 SSTable
+    VersionedValue mem_version;
+    if (cfd.memtable.get_version(key, snapshot_seq, mem_version)) {
+        if (mem_version.value == TOMBSTONE) {
+            return false;
+        }
+        value = mem_version.value;
+        return true;
+    }
+
+    // 在单个 SSTable 中查找存储的值；covered 表示 key 在该文件中已被删除（范围删除或墓碑），不必再查更旧的文件
+    auto get_from_sstable = [&](const SSTableMeta& sstable, bool& covered) -> std::optional<std::string> {
+        if (sstable.range_tombstones &&
+            sstable.range_tombstones->max_covering_seq(key, snapshot_seq, tombstone_seq)) {
+            covered = true;
+            auto version = SSTableReader::get_version(sstable.filename, key, snapshot_seq);
+            if (version && version->seq > tombstone_seq && version->value != TOMBSTONE) {
+                return version->value;
+            }
+            return std::nullopt;
+        }
+        // 一次查找同时得到值或墓碑：墓碑说明 key 在此文件中被删除，否则会读到更旧文件中已删除的值
+        auto result = SSTableReader::get_including_tombstone(sstable.filename, key, snapshot_seq, cache, priority);
+        if (result && result.value() == TOMBSTONE) {
+            covered = true;
+            return std::nullopt;
+        }
+        return result;
+    };
+
+    // 2. 检查L0（所有SSTable，从最新到最旧）
+    {
+        std::lock_guard<std::mutex> lock(cfd.levels[0].mutex);
+        const auto& sstables = cfd.levels[0].sstables;
+        for (auto it = sstables.rbegin(); it != sstables.rend(); it++) {
+            if (it->contains_key(key) && it->global_seq <= snapshot_seq) {
+                bool covered = false;
+                auto result = get_from_sstable(*it, covered);
+                if (result.has_value()) {
+                    return blob_manager_.resolve(result.value(), value, cache, priority);
+                }
+                if (covered) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    // 3. 检查L1+层级（按文件的 key 范围过滤，文件内由 Bloom Filter 与索引定位）
+    for (int level = 1; level < MAX_LEVEL; level++) {
+        std::lock_guard<std::mutex> lock(cfd.levels[level].mutex);
+
+        for (const auto& sstable : cfd.levels[level].sstables) {
+            if (sstable.contains_key(key) && sstable.global_seq <= snapshot_seq) {
+                bool covered = false;
+                auto result = get_from_sstable(sstable, covered);
+                if (result.has_value()) {
+                    return blob_manager_.resolve(result.value(), value, cache, priority);
+                }
+                if (covered) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+bool KVDB::resolve_merge(ColumnFamilyData& cfd, const std::string& key, uint64_t snapshot_seq, std::string& value) {
+    auto merge_operator = cfd.merge_operator();
+    if (!merge_operator) {
+        std::cerr << "[KVDB] 列族 [" << cfd.name << "] 中有合并条目但没有设置合并操作符: " << key << std::endl;
+        return false;
+    }
+    BlockCache& cache = cache_manager_->get_block_cache();
+
+    // MemTable 中的操作数链先折叠；之后每个 SSTable 的最新版本都已包含该文件中更旧的操作数，逐个文件接上即可
+    MergeEntry entry;
+    bool found = cfd.memtable.get_merge_entry(key, snapshot_seq, entry);
+
+    std::vector<SSTableMeta> candidates;
+    for (int level = 0; level < MAX_LEVEL && !entry.terminated(); level++) {
+        std::lock_guard<std::mutex> lock(cfd.levels[level].mutex);
+        const auto& sstables = cfd.levels[level].sstables;
+        for (size_t i = 0; i < sstables.size(); i++) {
+            // L0 从新到旧
+            const SSTableMeta& sstable = level == 0 ? sstables[sstables.size() - 1 - i] : sstables[i];
+            if (sstable.contains_key(key) && sstable.global_seq <= snapshot_seq) {
+                candidates.push_back(sstable);
+            }
+        }
+    }
+
+    for (const auto& sstable : candidates) {
+        if (entry.terminated()) {
+            break;
+        }
+        uint64_t tombstone_seq = 0;
+        bool covered = sstable.range_tombstones &&
+                       sstable.range_tombstones->max_covering_seq(key, snapshot_seq, tombstone_seq);
+        auto version = SSTableReader::get_version(sstable.filename, key, snapshot_seq);
+        bool visible = version && (!covered || version->seq > tombstone_seq);
+        MergeEntry older;
+        if (visible && MergeEntry::decode(version->value, older)) {
+            if (found) {
+                entry.absorb_older(std::move(older));
+            } else {
+                entry = std::move(older);
+                found = true;
+            }
+            if (covered && !entry.terminated()) {
+                entry.terminate_deleted();  // 更旧的文件整体被覆盖
+            }
+        } else if (visible && version->value != TOMBSTONE) {
+            std::string base;
+            if (!blob_manager_.resolve(version->value, base, cache, cfd.options.cache_priority)) {
+                return false;
+            }
+            if (!found) {
+                value = std::move(base);  // 读到合并条目之后又被刷盘或压缩成了完整值
+                return true;
+            }
+            entry.terminate_with(base);
+        } else if (visible || covered) {
+            if (!found) {
+                return false;
+            }
+            entry.terminate_deleted();
+        }
+    }
+    if (!found) {
+        return false;
     }
 
-    // 清空 MemTable
-    memtable_.clear();
-    
-    // 清空 WAL 文件
-    std::ofstream ofs(wal_.get_filename(), std::ios::trunc);
-    
-    std::cout << "刷盘完成，MemTable 已清空\n";
+    BlobIndex index;
+    if (entry.base == MergeEntry::Base::VALUE && BlobIndex::decode(entry.base_value, index) &&
+        !blob_manager_.read(index, entry.base_value)) {
+        return false;
+    }
+    // 链没有终止说明更旧的数据源中没有该 key，按不存在合并
+    if (!merge_operator->merge_entry(key, entry, &value)) {
+        std::cerr << "[KVDB] " << merge_operator->name() << " 合并失败: " << key << std::endl;
+        return false;
+    }
+    return true;
 }
 
-bool KVDB::get(const std::string& key, std::string& value) {
-    // 使用当前最新序列号作为 snapshot
-    uint64_t current_seq = seq_.load(std::memory_order_relaxed);
-    return get(key, Snapshot(current_seq), value);
-}
+MergeFolder KVDB::merge_folder(ColumnFamilyData& cfd, const KeyRangeSet* outside_inputs) {
+    auto merge_operator = cfd.merge_operator();
+    return [this, &cfd, outside_inputs, merge_operator](const std::string& key, MergeEntry& entry, std::string& value) {
+        // 链终止处的完整值可能是 blob 引用，合并前读出原值；压缩时读取失败则保留引用，留给之后的读取
+        BlobIndex index;
+        if (entry.base == MergeEntry::Base::VALUE && BlobIndex::decode(entry.base_value, index) &&
+            !blob_manager_.read(index, entry.base_value)) {
+            std::cerr << "[Merge] 读取基础值失败: " << entry.base_value << std::endl;
+            if (!outside_inputs) {
+                return false;
+            }
+            value = entry.encode();
+            return true;
+        }
 
-bool KVDB::get(const std::string& key, const Snapshot& snapshot, std::string& value) {
-    uint64_t snapshot_seq = snapshot.seq;
-    
-    // 创建缓存引用
-    BlockCache& cache = cache_manager_->get_block_cache();
-    
-    // 1. 先检查MemTable
-    if (memtable_.get(key, snapshot_seq, value)) {
+        if (!outside_inputs) {
+            if (!merge_operator) {
+                std::cerr << "[KVDB] 列族 [" << cfd.name << "] 中有合并条目但没有设置合并操作符: " << key << std::endl;
+                return false;
+            }
+            if (!merge_operator->merge_entry(key, entry, &value)) {
+                std::cerr << "[KVDB] " << merge_operator->name() << " 合并失败: " << key << std::endl;
+                return false;
+            }
+            return true;
+        }
+
+        // 压缩：输入之外没有更旧的数据时链同样到此为止，可以完整合并；否则只缩短操作数链。
+        // 没有合并操作符或合并失败时原样保留，留给设置了操作符之后的读取与压缩
+        if (!entry.terminated() && !outside_inputs->overlaps(key, key + '\0')) {
+            entry.terminate_deleted();
+        }
+        if (merge_operator && entry.terminated() && merge_operator->merge_entry(key, entry, &value)) {
+            return true;
+        }
+        if (merge_operator) {
+            merge_operator->compress(key, entry.operands);
+        }
+        value = entry.encode();
         return true;
-    }
-    
-    // 2. 检查L0（所有SSTable，从最新到最旧）
-    {
-        std::lock_guard<std::mutex> lock(levels_[0].mutex);
-        for (auto it = levels_[0].sstables.rbegin(); it != levels_[0].sstables.rend(); it++) {
-            if (it->contains_key(key)) {
-                auto result = SSTableReader::get(it->filename, key, snapshot_seq, cache);
-                if (result.has_value()) {
-                    value = result.value();
-                    return true;
+    };
+}
+
+void KVDB::collapse_merge_operands(ColumnFamilyData& cfd,
+                                   std::map<std::string, std::vector<VersionedValue>>& all_versions) {
+    auto merge_operator = cfd.merge_operator();
+    auto tombstones = cfd.memtable.fragmented_range_tombstones();
+    for (auto& [key, versions] : all_versions) {
+        if (std::none_of(versions.begin(), versions.end(),
+                         [](const VersionedValue& v) { return MergeEntry::matches(v.value); })) {
+            continue;
+        }
+
+        // 版本按序列号从旧到新；每段连续的操作数只保留最新的一条，它包含该段以及下面的基础值
+        std::vector<VersionedValue> collapsed;
+        for (auto& version : versions) {
+            MergeEntry entry;
+            if (!MergeEntry::decode(version.value, entry)) {
+                collapsed.push_back(std::move(version));
+                continue;
+            }
+            // 与紧邻的更旧版本之间隔着范围删除时，更旧的数据都不可见
+            uint64_t tombstone_seq = 0;
+            if (tombstones && tombstones->max_covering_seq(key, version.seq, tombstone_seq) &&
+                (collapsed.empty() || tombstone_seq > collapsed.back().seq)) {
+                entry.terminate_deleted();
+            } else if (!entry.terminated() && !collapsed.empty()) {
+                MergeEntry older;
+                if (collapsed.back().value == TOMBSTONE) {
+                    entry.terminate_deleted();
+                } else if (MergeEntry::decode(collapsed.back().value, older)) {
+                    entry.absorb_older(std::move(older));
+                    collapsed.pop_back();
+                } else {
+                    entry.terminate_with(collapsed.back().value);
                 }
             }
-        }
-    }
-    
-    // 3. 检查L1+层级（使用二分查找优化）
-    for (int level = 1; level < MAX_LEVEL; level++) {
-        std::lock_guard<std::mutex> lock(levels_[level].mutex);
-        
-        for (const auto& sstable : levels_[level].sstables) {
-            if (sstable.contains_key(key)) {
-                auto result = SSTableReader::get(sstable.filename, key, snapshot_seq, cache);
-                if (result.has_value()) {
-                    value = result.value();
-                    return true;
+
+            std::string merged;
+            if (merge_operator && entry.terminated() && merge_operator->merge_entry(key, entry, &merged)) {
+                version.value = std::move(merged);
+            } else {
+                if (merge_operator) {
+                    merge_operator->compress(key, entry.operands);
                 }
+                version.value = entry.encode();
             }
+            collapsed.push_back(std::move(version));
         }
+        versions = std::move(collapsed);
     }
-    
-    return false;
 }
 
 void KVDB::compact_worker() {
+    auto any_needs_compaction = [this] {
+        auto column_families = live_column_families();
+        return std::any_of(column_families.begin(), column_families.end(),
+                           [this](const ColumnFamilyData* cfd) { return need_compaction(*cfd); });
+    };
+
     while (!stop_.load()) {
         std::unique_lock<std::mutex> lock(compact_mutex_);
-        compact_cv_.wait_for(lock, std::chrono::seconds(1), [this] {
-            return stop_.load() || need_compaction();
+        compact_cv_.wait_for(lock, std::chrono::seconds(1), [&] {
+            return stop_.load() || any_needs_compaction();
         });
-        
+
         if (stop_.load()) {
             break;
         }
-        
-        if (need_compaction()) {
-            compact();
+
+        for (ColumnFamilyData* cfd : live_column_families()) {
+            if (need_compaction(*cfd)) {
+                compact_column_family(*cfd);
+            }
         }
     }
 }
 
 void KVDB::compact() {
+    for (ColumnFamilyData* cfd : live_column_families()) {
+        compact_column_family(*cfd);
+    }
+}
+
+void KVDB::compact(ColumnFamilyHandle* cf) {
+    ColumnFamilyData* cfd = live(cf);
+    if (cfd) {
+        compact_column_family(*cfd);
+    }
+}
+
+void KVDB::compact_column_family(ColumnFamilyData& cfd) {
+    std::lock_guard<std::mutex> compaction_lock(cfd.compaction_mutex);
+    if (cfd.dropped) {
+        return;
+    }
+    drop_expired_files(cfd);
+
     std::unique_ptr<CompactionTask> task;
-    
     {
-        std::lock_guard<std::mutex> strategy_lock(compaction_strategy_mutex_);
-        
-        // 构建当前层级状态
-        std::vector<std::vector<SSTableMeta>> current_levels(MAX_LEVEL);
-        for (int level = 0; level < MAX_LEVEL; level++) {
-            std::lock_guard<std::mutex> lock(levels_[level].mutex);
-            current_levels[level] = levels_[level].sstables;
-        }
-        
-        // 选择压缩任务
-        task = compaction_strategy_->pick_compaction(current_levels);
+        std::lock_guard<std::mutex> strategy_lock(cfd.compaction_strategy_mutex);
+
+        // 构建当前层级状态，选择压缩任务
+        task = cfd.compaction_strategy->pick_compaction(cfd.level_files());
     }
-    
+
     if (task) {
-        std::cout << "[Compaction] 执行压缩任务: L" << task->source_level 
-                  << " -> L" << task->target_level 
+        std::cout << "[Compaction] [" << cfd.name << "] 执行压缩任务: L" << task->source_level
+                  << " -> L" << task->target_level
                   << ", 文件数: " << task->input_files.size() << std::endl;
-        execute_compaction_task(std::move(task));
+        execute_compaction_task(cfd, std::move(task));
     }
 }
 
-void KVDB::compact_level(int level) {
+void KVDB::compact_level(ColumnFamilyData& cfd, int level) {
     if (level >= MAX_LEVEL - 1) {
         std::cout << "[Compaction] L" << level << " 是最高层级，无法继续合并\n";
         return;
     }
-    
+
     std::vector<SSTableMeta> input_sstables;
     {
-        std::lock_guard<std::mutex> lock(levels_[level].mutex);
-        if (levels_[level].sstables.empty()) {
+        std::lock_guard<std::mutex> lock(cfd.levels[level].mutex);
+        if (cfd.levels[level].sstables.empty()) {
             std::cout << "[Compaction] L" << level << " 为空，跳过\n";
             return;
         }
-        
+
         std::cout << "[Compaction] 开始 L" << level << " → L" << level + 1 << " 合并\n";
-        std::cout << "[Compaction] L" << level << " 有 " << levels_[level].sstables.size() << " 个 SSTable\n";
-        
+        std::cout << "[Compaction] L" << level << " 有 " << cfd.levels[level].sstables.size() << " 个 SSTable\n";
+
         // L0: 选择所有SSTable
         // L1+: 选择一个SSTable（简化实现，选择第一个）
         if (level == 0) {
-            input_sstables = levels_[level].sstables;
+            input_sstables = cfd.levels[level].sstables;
         } else {
-            input_sstables.push_back(levels_[level].sstables[0]);
+            input_sstables.push_back(cfd.levels[level].sstables[0]);
         }
     }
-    
+
     // 获取下一层重叠的SSTable
     std::vector<SSTableMeta> next_level_sstables;
     for (const auto& input : input_sstables) {
-        auto overlapping = get_overlapping_sstables(level + 1, input);
-        next_level_sstables.insert(next_level_sstables.end(), 
+        auto overlapping = get_overlapping_sstables(cfd, level + 1, input);
+        next_level_sstables.insert(next_level_sstables.end(),
                                  overlapping.begin(), overlapping.end());
     }
-    
+
     // 合并所有需要合并的文件
     std::vector<std::string> all_files;
     for (const auto& meta : input_sstables) {
@@ -556,191 +1816,535 @@ void KVDB::compact_level(int level) {
     for (const auto& meta : next_level_sstables) {
         all_files.push_back(meta.filename);
     }
-    
+
     if (all_files.empty()) {
         std::cout << "[Compaction] 没有文件需要合并\n";
         return;
     }
-    
+
     // 执行合并（传递 min_snapshot_seq 以保留活跃版本）
     uint64_t min_snapshot_seq = snapshot_manager_.min_seq();
-    std::string new_filename = "data/sstable_compacted_L" + 
-                              std::to_string(level + 1) + "_" + 
+    std::string new_filename = data_dir_ + "/sstable_compacted_L" +
+                              std::to_string(level + 1) + "_" +
                               std::to_string(file_id_++) + ".dat";
-    
-    std::string new_table = Compactor::compact(all_files, "data", new_filename, min_snapshot_seq);
-    
+
+    // Compactor 会删除输入文件，先统计其中的 blob 引用
+    bool has_blobs = !blob_manager_.empty();
+    BlobRefCounts blob_refs_before;
+    if (has_blobs) {
+        blob_refs_before = BlobManager::collect_references(all_files);
+    }
+    BlobBuilder blob_builder(blob_manager_);
+    std::string new_table = Compactor::compact(all_files, data_dir_, new_filename, min_snapshot_seq,
+        [&](const std::string& key, const std::string& value) {
+            return has_blobs ? relocate_blob(blob_builder, key, value) : value;
+        });
+    blob_builder.commit();
+
     // 更新元数据
     SSTableMeta new_meta = SSTableMetaUtil::get_meta_from_file(new_table);
-    
+
     // 删除旧文件，添加新文件到下一层
     // 先写 Manifest，再改内存 Version
     for (const auto& old_file : input_sstables) {
-        version_set_.persist_del(old_file.filename, level);
+        cfd.version_set.persist_del(old_file.filename, level);
     }
     for (const auto& old_file : next_level_sstables) {
-        version_set_.persist_del(old_file.filename, level + 1);
+        cfd.version_set.persist_del(old_file.filename, level + 1);
     }
-    version_set_.persist_add(new_meta, level + 1);
-    
-    update_level_metadata(level, input_sstables);
+    cfd.version_set.persist_add(new_meta, level + 1);
+
+    update_level_metadata(cfd, level, input_sstables);
     {
-        std::lock_guard<std::mutex> lock(levels_[level + 1].mutex);
-        levels_[level + 1].sstables.push_back(new_meta);
-        std::cout << "[Compaction] 添加到 L" << level + 1 
-                  << ", 当前数量: " << levels_[level + 1].sstables.size() << std::endl;
-        
+        std::lock_guard<std::mutex> lock(cfd.levels[level + 1].mutex);
+        cfd.levels[level + 1].sstables.push_back(new_meta);
+        std::cout << "[Compaction] 添加到 L" << level + 1
+                  << ", 当前数量: " << cfd.levels[level + 1].sstables.size() << std::endl;
+
         // 更新内存 Version
         for (const auto& old_file : input_sstables) {
-            version_set_.delete_file(level, old_file.filename);
+            cfd.version_set.delete_file(level, old_file.filename);
         }
         for (const auto& old_file : next_level_sstables) {
-            version_set_.delete_file(level + 1, old_file.filename);
+            cfd.version_set.delete_file(level + 1, old_file.filename);
         }
-        version_set_.add_file(level + 1, new_meta);
+        cfd.version_set.add_file(level + 1, new_meta);
     }
-    
+
+    if (has_blobs) {
+        blob_manager_.record_garbage(blob_refs_before, BlobManager::collect_references({new_table}));
+    }
+
     std::cout << "[Compaction] L" << level << " → L" << level + 1 << " 完成\n";
 }
 
-std::vector<SSTableMeta> KVDB::get_overlapping_sstables(int level, const SSTableMeta& input) {
+KeyRangeSet KVDB::outside_input_ranges(ColumnFamilyData& cfd, const CompactionTask& task) {
+    std::unordered_set<std::string> inputs;
+    for (const auto& meta : task.input_files) {
+        inputs.insert(meta.filename);
+    }
+    for (const auto& meta : task.overlapping_files) {
+        inputs.insert(meta.filename);
+    }
+    // 更旧的数据只可能在源层级及以下
+    KeyRangeSet ranges;
+    for (int level = task.source_level; level < MAX_LEVEL; level++) {
+        std::lock_guard<std::mutex> lock(cfd.levels[level].mutex);
+        for (const auto& meta : cfd.levels[level].sstables) {
+            if (!inputs.count(meta.filename)) {
+                ranges.add(meta.min_key, meta.max_key);
+            }
+        }
+    }
+    ranges.seal();
+    return ranges;
+}
+
+bool KVDB::filter_compaction_value(ColumnFamilyData& cfd, const CompactionTask& task,
+                                   const KeyRangeSet& outside_inputs, const CompactionFilter* filter,
+                                   BlobBuilder& blob_builder, const std::string& key, std::string& value,
+                                   uint64_t now) {
+    // 过滤器看到的是原值：blob 引用先读出，TTL 时间戳先拆开
+    std::string stored = value;
+    BlobIndex index;
+    if (BlobIndex::decode(value, index) && !blob_manager_.read(index, stored)) {
+        return true;
+    }
+    std::string user_value;
+    uint64_t timestamp = 0;
+    bool stamped = cfd.options.ttl_seconds > 0 && TtlCompactionFilter::decode(stored, user_value, timestamp);
+    if (!stamped) {
+        user_value = stored;
+    } else if (TtlCompactionFilter(cfd.options.ttl_seconds).is_expired(timestamp, now)) {
+        return false;  // 更旧的版本写入得更早，同样已过期，直接删除即可
+    }
+    if (!filter) {
+        return true;
+    }
+
+    std::string new_value;
+    switch (filter->filter(task.target_level, key, user_value, &new_value)) {
+        case CompactionFilter::Decision::REMOVE:
+            // 删除最新版本会让压缩之外的旧版本重新可见：只有不存在这种可能时才删除，
+            // 否则先保留，留给之后更深层级的压缩
+            return outside_inputs.overlaps(key, key + '\0');
+        case CompactionFilter::Decision::CHANGE_VALUE:
+            if (stamped) {
+                new_value = TtlCompactionFilter::encode(new_value, timestamp);
+            }
+            value = blob_manager_.should_separate(new_value) ? blob_builder.add(key, new_value) : new_value;
+            return true;
+        case CompactionFilter::Decision::KEEP:
+            break;
+    }
+    return true;
+}
+
+bool KVDB::is_file_expired(const ColumnFamilyData& cfd, const SSTableMeta& meta, uint64_t now) const {
+    return meta.properties.has_timestamps() &&
+           TtlCompactionFilter(cfd.options.ttl_seconds).is_expired(meta.properties.max_timestamp, now);
+}
+
+void KVDB::drop_expired_files(ColumnFamilyData& cfd) {
+    if (cfd.options.ttl_seconds == 0) {
+        return;
+    }
+    uint64_t now = TtlCompactionFilter::now();
+    for (int level = 0; level < MAX_LEVEL; level++) {
+        std::vector<SSTableMeta> expired;
+        {
+            std::lock_guard<std::mutex> lock(cfd.levels[level].mutex);
+            for (const auto& meta : cfd.levels[level].sstables) {
+                if (is_file_expired(cfd, meta, now)) {
+                    expired.push_back(meta);
+                }
+            }
+        }
+        if (expired.empty()) {
+            continue;
+        }
+
+        // 只改元数据；有 blob 文件时还需统计这些文件引用的 blob，记为垃圾
+        std::vector<std::string> paths;
+        for (const auto& meta : expired) {
+            cfd.version_set.persist_del(meta.filename, level);
+            cfd.version_set.delete_file(level, meta.filename);
+            paths.push_back(meta.filename);
+        }
+        if (!blob_manager_.empty()) {
+            blob_manager_.record_garbage(BlobManager::collect_references(paths), BlobRefCounts());
+        }
+        update_level_metadata(cfd, level, expired);
+        std::cout << "[Compaction] [" << cfd.name << "] L" << level << " 删除 " << expired.size()
+                  << " 个整体过期的 SSTable" << std::endl;
+    }
+}
+
+std::vector<SSTableMeta> KVDB::get_overlapping_sstables(ColumnFamilyData& cfd, int level, const SSTableMeta& input) {
     std::vector<SSTableMeta> result;
-    
+
     if (level >= MAX_LEVEL) {
         return result;
     }
-    
-    std::lock_guard<std::mutex> lock(levels_[level].mutex);
-    
-    for (const auto& sstable : levels_[level].sstables) {
+
+    std::lock_guard<std::mutex> lock(cfd.levels[level].mutex);
+
+    for (const auto& sstable : cfd.levels[level].sstables) {
         if (input.overlaps_with(sstable)) {
             result.push_back(sstable);
         }
     }
-    
+
     return result;
 }
 
-void KVDB::update_level_metadata(int level, const std::vector<SSTableMeta>& old_files) {
-    std::lock_guard<std::mutex> lock(levels_[level].mutex);
-    
+void KVDB::update_level_metadata(ColumnFamilyData& cfd, int level, const std::vector<SSTableMeta>& old_files) {
+    std::lock_guard<std::mutex> lock(cfd.levels[level].mutex);
+    auto& sstables = cfd.levels[level].sstables;
+
     // 删除旧文件
     for (const auto& old_file : old_files) {
-        auto it = std::find_if(levels_[level].sstables.begin(), 
-                             levels_[level].sstables.end(),
+        auto it = std::find_if(sstables.begin(), sstables.end(),
                              [&](const SSTableMeta& meta) {
                                  return meta.filename == old_file.filename;
                              });
-        
-        if (it != levels_[level].sstables.end()) {
-            levels_[level].sstables.erase(it);
+
+        if (it != sstables.end()) {
+            sstables.erase(it);
             // 删除物理文件
             std::filesystem::remove(old_file.filename);
         }
     }
-    
-    std::cout << "[Compaction] L" << level << " 清理完成，剩余 " 
-              << levels_[level].sstables.size() << " 个 SSTable\n";
+
+    std::cout << "[Compaction] L" << level << " 清理完成，剩余 "
+              << sstables.size() << " 个 SSTable\n";
 }
 
-void KVDB::execute_compaction_task(std::unique_ptr<CompactionTask> task) {
+void KVDB::execute_compaction_task(ColumnFamilyData& cfd, std::unique_ptr<CompactionTask> task) {
+    LatencyTimer timer(compaction_latency_);
     auto start_time = std::chrono::high_resolution_clock::now();
-    
-    // 合并所有输入文件
+
+    // 合并所有输入文件，按数据源从新到旧排列：源层级在前（L0 内按刷盘先后倒序），目标层级的重叠文件在后
     std::vector<SSTableMeta> all_input_files = task->input_files;
-    all_input_files.insert(all_input_files.end(), 
-                          task->overlapping_files.begin(), 
+    if (task->source_level == 0) {
+        std::map<std::string, size_t> position;
+        {
+            std::lock_guard<std::mutex> lock(cfd.levels[0].mutex);
+            const auto& sstables = cfd.levels[0].sstables;
+            for (size_t i = 0; i < sstables.size(); i++) {
+                position[sstables[i].filename] = i;
+            }
+        }
+        std::stable_sort(all_input_files.begin(), all_input_files.end(),
+            [&position](const SSTableMeta& a, const SSTableMeta& b) {
+                return position[a.filename] > position[b.filename];
+            });
+    }
+    all_input_files.insert(all_input_files.end(),
+                          task->overlapping_files.begin(),
                           task->overlapping_files.end());
-    
+
     if (all_input_files.empty()) {
         std::cout << "[Compaction] 没有输入文件，跳过压缩\n";
         return;
     }
-    
-    // 创建合并迭代器
-    std::vector<std::unique_ptr<Iterator>> iterators;
-    for (const auto& meta : all_input_files) {
-        auto iter = std::make_unique<SSTableIterator>(meta, UINT64_MAX);
-        if (iter->valid()) {
-            iterators.push_back(std::move(iter));
+
+    // 活跃快照各自需要的旧版本在压缩后保留；没有快照时只保留最新版本
+    std::vector<uint64_t> snapshots = snapshot_manager_.active_seqs();
+    uint64_t visible_to_all = snapshots.empty() ? UINT64_MAX : snapshots.front();
+
+    // 被更新的输入文件中对所有快照可见的范围删除整个覆盖的文件、整体过期的文件都不必打开，直接随输入一起删除
+    uint64_t now = TtlCompactionFilter::now();
+    std::vector<bool> file_dropped(all_input_files.size(), false);
+    size_t covered_files = 0;
+    size_t expired_files = 0;
+    for (size_t i = 0; i < all_input_files.size(); i++) {
+        if (cfd.options.ttl_seconds > 0 && is_file_expired(cfd, all_input_files[i], now)) {
+            file_dropped[i] = true;
+            expired_files++;
+            continue;
+        }
+        for (size_t j = 0; j < i && !file_dropped[i]; j++) {
+            uint64_t tombstone_seq;
+            const auto& tombstones = all_input_files[j].range_tombstones;
+            if (tombstones && tombstones->covers_range(all_input_files[i].min_key, all_input_files[i].max_key,
+                                                       visible_to_all, tombstone_seq)) {
+                file_dropped[i] = true;
+                covered_files++;
+            }
         }
     }
-    
-    if (iterators.empty()) {
-        std::cout << "[Compaction] 没有有效的迭代器，跳过压缩\n";
-        return;
+
+    std::vector<RangeTombstone> input_tombstones;
+    // 输出文件的写入时间范围取保留下来的输入文件的并集，任一文件没有时间范围则输出也没有
+    SSTableProperties output_properties;
+    bool properties_known = true;
+    for (size_t i = 0; i < all_input_files.size(); i++) {
+        if (file_dropped[i]) {
+            continue;
+        }
+        const auto& meta = all_input_files[i];
+        if (!meta.properties.has_timestamps()) {
+            properties_known = false;
+        } else if (properties_known) {
+            output_properties.min_timestamp = output_properties.has_timestamps()
+                ? std::min(output_properties.min_timestamp, meta.properties.min_timestamp)
+                : meta.properties.min_timestamp;
+            output_properties.max_timestamp = std::max(output_properties.max_timestamp,
+                                                       meta.properties.max_timestamp);
+        }
+        if (meta.range_tombstones) {
+            auto tombstones = meta.range_tombstones->to_tombstones(true);
+            input_tombstones.insert(input_tombstones.end(), tombstones.begin(), tombstones.end());
+        }
     }
-    
-    auto merge_iter = std::make_unique<MergeIterator>(std::move(iterators));
-    
+
+    if (!properties_known) {
+        output_properties = SSTableProperties();
+    }
+
+    // 压缩之外还可能有更旧数据的 key 范围，本任务内按 key 查询都用这份快照
+    KeyRangeSet outside_inputs = outside_input_ranges(cfd, *task);
+
+    // 输出文件只需保留每个片段最新的范围删除（旧版本已在本次压缩中丢弃）；
+    // 输入之外再没有可能被覆盖的文件、也没有为快照保留的旧版本时，范围删除本身也可以丢弃
+    FragmentedRangeTombstoneList output_fragments(input_tombstones);
+    std::vector<RangeTombstone> output_tombstones;
+    if (!output_fragments.empty() &&
+        (!snapshots.empty() ||
+         outside_inputs.overlaps(output_fragments.smallest_key(), output_fragments.largest_key()))) {
+        output_tombstones = output_fragments.to_tombstones(true);
+    }
+
+    // 压缩只搬动 blob 引用；输入中的引用与输出中的引用之差就是这次产生的垃圾
+    bool has_blobs = !blob_manager_.empty();
+    BlobRefCounts blob_refs_before;
+    if (has_blobs) {
+        std::vector<std::string> input_paths;
+        for (const auto& meta : all_input_files) {
+            input_paths.push_back(meta.filename);
+        }
+        blob_refs_before = BlobManager::collect_references(input_paths);
+    }
+    BlobBuilder blob_builder(blob_manager_);
+
+    std::shared_ptr<CompactionFilter> user_filter;
+    {
+        std::lock_guard<std::mutex> strategy_lock(cfd.compaction_strategy_mutex);
+        user_filter = cfd.options.compaction_filter;
+    }
+    bool apply_filters = user_filter || cfd.options.ttl_seconds > 0;
+
     // 创建新的 SSTable
-    std::string new_filename = "data/sstable_" + std::to_string(file_id_++) + ".dat";
-    
+    std::string new_filename = data_dir_ + "/sstable_" + std::to_string(file_id_++) + ".dat";
+
     size_t written_keys = 0;
     size_t bytes_read = 0;
-    
+    size_t stale_index_entries = 0;
+    size_t filtered_keys = 0;
+    // 持久化索引条目只存在于默认列族
+    bool check_index_entries = index_manager_ && &cfd == default_cf_;
+
+    // 单遍读取所有输入：每次取出最小的 key 在各输入文件中的全部版本，放进窗口后按 MergeIterator 的规则
+    // 解析出最新视图与每个活跃快照的视图。范围删除随数据源传入，被覆盖的版本不可见；合并条目在解析时折叠：
+    // 链在输入内终止（或输入之外没有更旧的数据）时完整合并，否则部分合并；墓碑以空值返回，由 emit_key 决定能否丢弃
+    std::vector<std::unique_ptr<SSTableIterator>> inputs;
+    std::vector<std::shared_ptr<const FragmentedRangeTombstoneList>> input_range_tombstones;
+    for (size_t i = 0; i < all_input_files.size(); i++) {
+        if (file_dropped[i]) {
+            continue;
+        }
+        auto iter = std::make_unique<SSTableIterator>(all_input_files[i], UINT64_MAX);
+        if (iter->valid() || all_input_files[i].range_tombstones) {
+            inputs.push_back(std::move(iter));
+            input_range_tombstones.push_back(all_input_files[i].range_tombstones);
+        }
+    }
+    MergeKeyWindow window(std::move(input_range_tombstones), merge_folder(cfd, &outside_inputs));
+    auto input_before = [&inputs](int a, int b) {
+        if (!inputs[a]->valid() || !inputs[b]->valid()) {
+            return inputs[a]->valid() && !inputs[b]->valid();
+        }
+        int cmp = inputs[a]->key_slice().compare(inputs[b]->key_slice());
+        return cmp != 0 ? cmp < 0 : a < b;
+    };
+    LoserTree input_tree;
+    input_tree.build(static_cast<int>(inputs.size()), input_before);
+
     // 收集合并后的数据
     std::map<std::string, std::vector<VersionedValue>> merged_data;
-    
-    // 写入合并后的数据
-    for (merge_iter->seek_to_first(); merge_iter->valid(); merge_iter->next()) {
-        std::string key = merge_iter->key();
-        std::string value = merge_iter->value();
-        
-        // 跳过墓碑记录（在压缩时清理）
-        if (!value.empty()) {
-            VersionedValue vv;
-            vv.seq = UINT64_MAX; // 压缩后的数据使用最大序列号
-            vv.value = value;
-            merged_data[key].push_back(vv);
+
+    // 当前 key 各个活跃快照看到的版本（同一版本只记一次），按序列号升序
+    std::vector<VersionedValue> snapshot_versions;
+
+    // 一个 key 保留的版本（seq DESC）：最新版本之后接上快照需要的更旧版本。newest 为空表示最新版本被丢弃
+    // （newest_seq 为其序列号；UINT64_MAX 表示最新版本已被范围删除覆盖），这时写一个墓碑遮住保留下来的旧版本；
+    // 最旧的墓碑之下再没有数据时可以丢掉
+    auto emit_key = [&](const std::string& key, std::optional<VersionedValue> newest, uint64_t newest_seq) {
+        std::vector<VersionedValue> versions;
+        for (auto it = snapshot_versions.rbegin(); it != snapshot_versions.rend(); it++) {
+            if (it->seq >= newest_seq) {
+                continue;
+            }
+            if (has_blobs && it->value != TOMBSTONE) {
+                it->value = relocate_blob(blob_builder, key, it->value);
+            }
+            versions.push_back(std::move(*it));
+        }
+        if (newest) {
+            versions.insert(versions.begin(), std::move(*newest));
+        } else if (newest_seq != UINT64_MAX && !versions.empty()) {
+            versions.insert(versions.begin(), VersionedValue(newest_seq, TOMBSTONE));
+        }
+        while (!versions.empty() && versions.back().value == TOMBSTONE &&
+               !outside_inputs.overlaps(key, key + '\0')) {
+            versions.pop_back();
+        }
+        if (!versions.empty()) {
+            merged_data[key] = std::move(versions);
             written_keys++;
         }
-        
+    };
+
+    // 写入合并后的数据
+    while (input_tree.winner() >= 0 && inputs[input_tree.winner()]->valid()) {
+        std::string key = inputs[input_tree.winner()]->key();
+        window.reset(key);
+        while (input_tree.winner() >= 0 && inputs[input_tree.winner()]->valid() &&
+               inputs[input_tree.winner()]->key_slice() == Slice(key)) {
+            int id = input_tree.winner();
+            inputs[id]->current_versions(window.versions(id));
+            inputs[id]->next();
+            input_tree.replay(id, input_before);
+        }
+
+        snapshot_versions.clear();
+        for (uint64_t snapshot_seq : snapshots) {
+            uint64_t snapshot_version_seq;
+            std::string snapshot_value;
+            if (window.resolve(snapshot_seq, snapshot_version_seq, snapshot_value) &&
+                (snapshot_versions.empty() || snapshot_versions.back().seq != snapshot_version_seq)) {
+                snapshot_versions.emplace_back(snapshot_version_seq,
+                                               snapshot_value.empty() ? TOMBSTONE : snapshot_value);
+            }
+        }
+
+        uint64_t seq;
+        std::string value;
+        if (!window.resolve(UINT64_MAX, seq, value)) {
+            // 最新版本被范围删除覆盖，只剩快照版本
+            if (!snapshot_versions.empty()) {
+                emit_key(key, std::nullopt, UINT64_MAX);
+            }
+            continue;
+        }
+
+        // 过期的持久化索引条目（主记录已删除/已变更，或索引已删除）在压缩时惰性清除
+        if (!value.empty() && check_index_entries &&
+            key.compare(0, 4, PersistentIndex::ENTRY_PREFIX) == 0 &&
+            index_manager_->is_stale_index_entry(key)) {
+            stale_index_entries++;
+            bytes_read += key.size() + value.size();
+            emit_key(key, std::nullopt, seq);
+            continue;
+        }
+
         bytes_read += key.size() + value.size();
+
+        // TTL 与自定义压缩过滤器只作用于保留下来的最新版本（未能完整合并的合并条目不过滤）
+        std::string stored = value;
+        if (!value.empty() && apply_filters && !MergeEntry::matches(value) &&
+            !filter_compaction_value(cfd, *task, outside_inputs, user_filter.get(), blob_builder, key, stored, now)) {
+            filtered_keys++;
+            emit_key(key, std::nullopt, seq);
+            continue;
+        }
+
+        if (value.empty()) {
+            emit_key(key, VersionedValue(seq, TOMBSTONE), seq);
+            continue;
+        }
+        // 保留最新版本的原始序列号；被过滤器改写的值已按需写入新 blob，不再搬动旧引用
+        emit_key(key, VersionedValue(seq, stored != value ? stored : has_blobs ? relocate_blob(blob_builder, key, value) : value),
+                 seq);
     }
-    
-    // 写入 SSTable
-    SSTableWriter::write(new_filename, merged_data);
-    
-    // 获取新文件的元数据
-    SSTableMeta new_meta = SSTableMetaUtil::get_meta_from_file(new_filename);
-    size_t bytes_written = new_meta.file_size;
-    
+
+    // 写入 SSTable；输入全部被删除时不产生输出文件
+    std::optional<SSTableMeta> new_meta;
+    size_t bytes_written = 0;
+    if (!merged_data.empty() || !output_tombstones.empty()) {
+        SSTableWriter::write(new_filename, merged_data, cfd.options.bloom_filter_bits, output_tombstones,
+                             output_properties, cfd.prefix_extractor().get());
+        blob_builder.commit();
+
+        // 获取新文件的元数据
+        new_meta = SSTableMetaUtil::get_meta_from_file(new_filename);
+        bytes_written = new_meta->file_size;
+    }
+
+    // 先写 Manifest：输入文件删除与新文件添加都要记录，否则重启后会恢复出已删除的文件
+    for (const auto& old_file : task->input_files) {
+        cfd.version_set.persist_del(old_file.filename, task->source_level);
+    }
+    for (const auto& old_file : task->overlapping_files) {
+        cfd.version_set.persist_del(old_file.filename, task->target_level);
+    }
+    if (new_meta) {
+        cfd.version_set.persist_add(*new_meta, task->target_level);
+    }
+
     // 更新层级结构
     {
         // 从源层级删除输入文件
         if (task->source_level < MAX_LEVEL) {
-            update_level_metadata(task->source_level, task->input_files);
+            update_level_metadata(cfd, task->source_level, task->input_files);
         }
-        
+
         // 从目标层级删除重叠文件
         if (task->target_level < MAX_LEVEL && !task->overlapping_files.empty()) {
-            update_level_metadata(task->target_level, task->overlapping_files);
+            update_level_metadata(cfd, task->target_level, task->overlapping_files);
         }
-        
+
         // 将新文件添加到目标层级
-        if (task->target_level < MAX_LEVEL) {
-            std::lock_guard<std::mutex> lock(levels_[task->target_level].mutex);
-            levels_[task->target_level].sstables.push_back(new_meta);
-            std::cout << "[Compaction] 添加到 L" << task->target_level 
-                      << "，当前文件数: " << levels_[task->target_level].sstables.size() << std::endl;
+        if (new_meta && task->target_level < MAX_LEVEL) {
+            std::lock_guard<std::mutex> lock(cfd.levels[task->target_level].mutex);
+            cfd.levels[task->target_level].sstables.push_back(*new_meta);
+            std::cout << "[Compaction] 添加到 L" << task->target_level
+                      << "，当前文件数: " << cfd.levels[task->target_level].sstables.size() << std::endl;
         }
     }
-    
-    // 更新版本信息 - 使用现有的 persist 方法
-    version_set_.persist_add(new_meta, task->target_level);
-    
+
+    // 更新内存 Version
+    for (const auto& old_file : task->input_files) {
+        cfd.version_set.delete_file(task->source_level, old_file.filename);
+    }
+    for (const auto& old_file : task->overlapping_files) {
+        cfd.version_set.delete_file(task->target_level, old_file.filename);
+    }
+    if (new_meta) {
+        cfd.version_set.add_file(task->target_level, *new_meta);
+    }
+
+    if (has_blobs) {
+        blob_manager_.record_garbage(blob_refs_before, new_meta
+            ? BlobManager::collect_references({new_filename}) : BlobRefCounts());
+    }
+
     // 更新统计信息
     auto end_time = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
-    
+
     {
-        std::lock_guard<std::mutex> strategy_lock(compaction_strategy_mutex_);
-        compaction_strategy_->stats_.update(bytes_read, bytes_written, duration);
+        std::lock_guard<std::mutex> strategy_lock(cfd.compaction_strategy_mutex);
+        cfd.compaction_strategy->stats_.update(bytes_read, bytes_written, duration);
     }
-    
-    std::cout << "[Compaction] 完成: 处理 " << all_input_files.size() << " 个文件, "
+
+    std::cout << "[Compaction] [" << cfd.name << "] 完成: 处理 " << all_input_files.size() << " 个文件, "
               << "写入 " << written_keys << " 个键, "
+              << "整体删除被范围删除覆盖的文件 " << covered_files << " 个, "
+              << "整体过期的文件 " << expired_files << " 个, "
+              << "过滤 " << filtered_keys << " 个键, "
+              << "清除过期索引条目 " << stale_index_entries << " 个, "
               << "耗时 " << duration.count() << "ms, "
               << "写放大: " << (bytes_read > 0 ? static_cast<double>(bytes_written) / bytes_read : 0.0)
               << std::endl;
@@ -9,41 +9,104 @@
 #include "snapshot/snapshot_manager.h"
 #include "iterator/iterator.h"
 #include "iterator/concurrent_iterator.h"
+#include "iterator/merge_iterator.h"
 #include "compaction/compaction_strategy.h"
 #include "index/index_manager.h"
+#include "db/write_batch.h"
+#include "db/column_family.h"
+#include "blob/blob_manager.h"
+#include "monitoring/metrics_registry.h"
+#include <array>
 #include <vector>
 #include <thread>
 #include <condition_variable>
 #include <atomic>
 #include <mutex>
 #include <memory>
+#include <shared_mutex>
+
+// 外部 SSTable 导入选项
+struct IngestExternalFileOptions {
+    // true：硬链接进 data/ 后删除源文件；false：保留源文件（硬链接失败时都退化为拷贝）
+    bool move_files = true;
+    // 文件与现有数据重叠时分配全局序列号，使导入数据覆盖旧版本；为 false 时重叠即失败
+    bool allow_global_seqno = true;
+    // 与 MemTable 重叠时先同步刷盘；为 false 时重叠即失败
+    bool allow_blocking_flush = true;
+};
 
 class KVDB {
 public:
-    explicit KVDB(const std::string& wal_file);
+    // db_path 为空时数据文件放在当前目录的 data/ 下、MANIFEST 与列族清单放在当前目录（原有布局）；
+    // 指定后全部放在 db_path 之下，同一进程可以打开多个互不干扰的实例
+    explicit KVDB(const std::string& wal_file, const std::string& db_path = "");
     ~KVDB();
     
     bool put(const std::string& key, const std::string& value);
     bool get(const std::string& key, std::string& value);
     bool get(const std::string& key, const Snapshot& snapshot, std::string& value);
     bool del(const std::string& key);
+    // 范围删除：删除 [begin, end) 内的所有 key，只写一条范围墓碑；begin 必须小于 end
+    bool delete_range(const std::string& begin, const std::string& end);
+    // 合并：operand 作为合并操作数盲写，代价与 put 相同，读取、迭代与压缩时由列族的合并操作符折叠到已有值上。
+    // 列族没有设置合并操作符或开启了 TTL 时返回 false；不触发索引维护
+    bool merge(const std::string& key, const std::string& operand);
+    // 原子批量写：批内操作共享一条 WAL 记录，序列号连续，不触发索引维护
+    bool write(const WriteBatch& batch);
+    
+    // 列族：各自独立的 MemTable、LSM 层级、压缩策略、Bloom Filter 与缓存优先级，
+    // 共享 WAL、序列号与快照。不带列族参数的接口都作用于默认列族
+    // 同名列族已存在时更新其选项并返回已有句柄（重启后由此重新设置选项）
+    ColumnFamilyHandle* create_column_family(const std::string& name,
+                                             const ColumnFamilyOptions& options = ColumnFamilyOptions());
+    // 删除列族及其 SSTable；默认列族不能删除
+    bool drop_column_family(ColumnFamilyHandle* cf);
+    ColumnFamilyHandle* get_column_family(const std::string& name) const;
+    ColumnFamilyHandle* default_column_family() const { return &default_cf_->handle; }
+    std::vector<std::string> list_column_families() const;
+    
+    bool put(ColumnFamilyHandle* cf, const std::string& key, const std::string& value);
+    bool get(ColumnFamilyHandle* cf, const std::string& key, std::string& value);
+    bool get(ColumnFamilyHandle* cf, const std::string& key, const Snapshot& snapshot, std::string& value);
+    bool del(ColumnFamilyHandle* cf, const std::string& key);
+    bool delete_range(ColumnFamilyHandle* cf, const std::string& begin, const std::string& end);
+    bool merge(ColumnFamilyHandle* cf, const std::string& key, const std::string& operand);
+    std::unique_ptr<Iterator> new_iterator(ColumnFamilyHandle* cf, const Snapshot& snapshot,
+                                           const ReadOptions& options = ReadOptions());
+    std::unique_ptr<Iterator> new_prefix_iterator(ColumnFamilyHandle* cf, const Snapshot& snapshot,
+                                                  const std::string& prefix,
+                                                  const ReadOptions& options = ReadOptions());
     
     Snapshot get_snapshot();
     void release_snapshot(const Snapshot& snapshot);
-    std::unique_ptr<Iterator> new_iterator(const Snapshot& snapshot);
-    std::unique_ptr<Iterator> new_prefix_iterator(const Snapshot& snapshot, const std::string& prefix);
+    std::unique_ptr<Iterator> new_iterator(const Snapshot& snapshot,
+                                           const ReadOptions& options = ReadOptions());
+    std::unique_ptr<Iterator> new_prefix_iterator(const Snapshot& snapshot, const std::string& prefix,
+                                                  const ReadOptions& options = ReadOptions());
     
     // 并发安全的迭代器
     std::shared_ptr<ConcurrentIterator> new_concurrent_iterator(const Snapshot& snapshot);
     std::shared_ptr<ConcurrentIterator> new_concurrent_prefix_iterator(const Snapshot& snapshot, const std::string& prefix);
 
-    void flush();
-    void compact(); //手动触发Compaction
+    void flush();   // 刷盘所有列族
+    void compact(); //手动触发Compaction（所有列族）
+    void flush(ColumnFamilyHandle* cf);
+    void compact(ColumnFamilyHandle* cf);
+    
+    // 外部 SSTable 导入：文件由 SstFileWriter 离线构建，彼此不重叠；整批分配一个全局序列号，
+    // 每个文件放到不与上层数据重叠的最深层级（与 L0 重叠时放入 L0），不经过 WAL / MemTable
+    bool ingest_external_files(const std::vector<std::string>& paths,
+                               const IngestExternalFileOptions& options = IngestExternalFileOptions());
+    // 按 SSTable 边界估算的分割点（升序），用于把全库扫描切成若干键区间并行处理
+    std::vector<std::string> get_approximate_split_keys(size_t num_ranges) const;
     
     // 压缩策略管理
     void set_compaction_strategy(CompactionStrategyType type);
     CompactionStrategyType get_compaction_strategy() const;
     const CompactionStats& get_compaction_stats() const;
+    void set_compaction_strategy(ColumnFamilyHandle* cf, CompactionStrategyType type);
+    CompactionStrategyType get_compaction_strategy(ColumnFamilyHandle* cf) const;
+    const CompactionStats& get_compaction_stats(ColumnFamilyHandle* cf) const;
     
     // 缓存管理
     void enable_multi_level_cache();
@@ -52,11 +115,31 @@ public:
     void print_cache_stats() const;
     
     // REPL 支持方法
+    // 把后台刷盘与压缩线程绑定到指定 CPU（仅 Linux 生效），返回是否成功
+    bool pin_background_threads(int cpu);
+    
     size_t get_memtable_size() const;
+    size_t get_memtable_size(ColumnFamilyHandle* cf) const;
     size_t get_wal_size() const;
     double get_cache_hit_rate() const;
     void print_lsm_structure() const;
     
+    // 统一内存预算：MemTable、Block Cache 与内存索引向同一预算记账。全部 MemTable 超过
+    // write_buffer_bytes 时刷掉最大的一个，总用量超过 total_bytes 时收缩 Block Cache
+    void set_memory_budget(size_t total_bytes, size_t write_buffer_bytes);
+    MemoryBudget& get_memory_budget() { return memory_budget_; }
+    const MemoryBudget& get_memory_budget() const { return memory_budget_; }
+
+    // 延迟直方图（纳秒记录、秒导出）：读写按 op 标签记入 kvdb_db_op_latency_seconds，
+    // 刷盘与压缩分别记入 kvdb_flush_duration_seconds、kvdb_compaction_duration_seconds
+    kvdb::monitoring::MetricsRegistry& get_metrics_registry() { return metrics_; }
+    
+    // 键值分离：不小于 min_blob_size 的值在刷盘时写入 blob 文件，SSTable 只存 (文件, 偏移, 长度) 引用，
+    // 压缩只搬动引用；垃圾比例达到 gc_garbage_ratio 的 blob 文件在压缩时搬迁存活值，全部失效后删除
+    void set_blob_options(const BlobOptions& options);
+    BlobOptions get_blob_options() const;
+    std::vector<BlobFileMeta> get_blob_files() const;
+    
     // 索引管理
     IndexManager& get_index_manager() { return *index_manager_; }
     const IndexManager& get_index_manager() const { return *index_manager_; }
@@ -73,54 +156,116 @@ protected:
     uint64_t next_seq();
 
 private:
+    // ConcurrentKVDB 以 KVDB 为磁盘层：共用序列号，把不可变 MemTable 刷成 L0 SSTable 后交给这里的压缩
+    friend class ConcurrentKVDB;
+    // ShardedKVDB 让各分片共用一个全局序列号分配器，并在每个分片登记同一个快照
+    friend class ShardedKVDB;
+    // shared_seq 非空时序列号从它分配，恢复时只把它往大调
+    KVDB(const std::string& wal_file, const std::string& db_path, std::atomic<uint64_t>* shared_seq);
+
     // 读写隔离相关
     void begin_write_operation();
     void end_write_operation();
+    void apply_batch(const WriteBatch& batch);  // 调用方需持有写锁
+    // 批内有写入开启 TTL 列族的 PUT 时，生成值带写入时间的副本 stamped 并返回 true
+    bool stamp_ttl(const WriteBatch& batch, WriteBatch& stamped) const;
     mutable std::shared_mutex db_rw_mutex_; // 数据库级别的读写锁
     
-    // 压缩策略
-    std::unique_ptr<CompactionStrategy> compaction_strategy_;
-    mutable std::mutex compaction_strategy_mutex_;
-    static constexpr size_t MEMTABLE_LIMIT = 4 * 1024 * 1024; // 4MB
     static constexpr int MAX_LEVEL = 4;
-    static constexpr int LEVEL_LIMITS[MAX_LEVEL] = {4, 8, 16, 32};
-
-    struct Level {
-        std::vector<SSTableMeta> sstables;
-        mutable std::mutex mutex;
-        
-        Level() = default;
-        Level(const Level& other) {
-            std::lock_guard<std::mutex> lock(other.mutex);
-            sstables = other.sstables;
-        }
-        Level& operator=(const Level& other) {
-            if (this != &other) {
-                std::lock_guard<std::mutex> lock_this(mutex, std::adopt_lock);
-                std::lock_guard<std::mutex> lock_other(other.mutex, std::adopt_lock);
-                sstables = other.sstables;
-            }
-            return *this;
-        }
-    };
-    void request_flush();
+    static constexpr const char* COLUMN_FAMILY_MANIFEST = "COLUMN_FAMILIES";
+    // db_path_ 下的文件路径；db_path_ 为空时即 name 本身
+    std::string db_file(const std::string& name) const;
+    
+    // 列族管理
+    void recover_column_families();
+    void persist_column_family(const ColumnFamilyData& cfd);
+    ColumnFamilyData* find_column_family(uint32_t id) const;
+    std::vector<ColumnFamilyData*> live_column_families() const;
+    ColumnFamilyData* live(ColumnFamilyHandle* cf) const;  // 已删除的列族返回 nullptr
+    void maybe_request_flush(ColumnFamilyData& cfd);
+    ColumnFamilyData* largest_memtable() const;
+    void rebalance_memory();
+    void print_column_family(const ColumnFamilyData& cfd) const;
+    
+    // 用户读：记录 get 延迟后交给 read_value
+    bool get_internal(ColumnFamilyData& cfd, const std::string& key, uint64_t snapshot_seq, std::string& value);
+    // 读取用户可见的值（合并已折叠、TTL 已检查），不计入 get 延迟；写路径读旧值时使用
+    bool read_value(ColumnFamilyData& cfd, const std::string& key, uint64_t snapshot_seq, std::string& value);
+    // 按存储形式读取（blob 引用已解析，TTL 时间戳保留，合并条目未折叠）
+    bool get_stored(ColumnFamilyData& cfd, const std::string& key, uint64_t snapshot_seq, std::string& value);
+    // 列族能否接受合并操作数：设置了合并操作符且未开启 TTL
+    bool merge_supported(const ColumnFamilyData& cfd) const;
+    // 点查读到合并条目时，从 MemTable 到最深层依次接上更旧的版本，再完整合并
+    bool resolve_merge(ColumnFamilyData& cfd, const std::string& key, uint64_t snapshot_seq, std::string& value);
+    // MergeIterator 的折叠函数。outside_inputs 为空时用于读：链未终止说明 key 原本不存在，直接完整合并；
+    // 压缩时链未终止且输入之外可能还有更旧的数据（key 落在 outside_inputs 中），只做部分合并，输出合并条目
+    MergeFolder merge_folder(ColumnFamilyData& cfd, const KeyRangeSet* outside_inputs = nullptr);
+    // 刷盘前把每个 key 的连续操作数合成一条：下面有完整值、墓碑或范围删除时完整合并，否则部分合并
+    void collapse_merge_operands(ColumnFamilyData& cfd,
+                                 std::map<std::string, std::vector<VersionedValue>>& all_versions);
+    std::unique_ptr<Iterator> new_iterator_internal(ColumnFamilyData& cfd, const Snapshot& snapshot,
+                                                    const ReadOptions& options);
+    std::unique_ptr<Iterator> new_prefix_iterator_internal(ColumnFamilyData& cfd, const Snapshot& snapshot,
+                                                           const std::string& prefix, const ReadOptions& options);
+    // 有 blob 文件时用 BlobResolvingIterator 包装，把引用解析成原值；
+    // 开启 TTL 的列族再用 TtlIterator 包装，跳过过期条目并去掉写入时间
+    std::unique_ptr<Iterator> wrap_iterator(std::unique_ptr<Iterator> iter, const ColumnFamilyData& cfd);
+    // 压缩时处理一个保留下来的值：所在 blob 文件需要回收时把值搬到 builder 的新文件，返回新引用
+    std::string relocate_blob(BlobBuilder& builder, const std::string& key, const std::string& stored);
+    bool write_internal(ColumnFamilyData& cfd, WriteBatch::OpType type, const std::string& key,
+                        const std::string& value);
+    void flush_column_family(ColumnFamilyData& cfd);  // 调用方需持有写锁
+    // 把一组版本写成 L0 SSTable 并登记到 MANIFEST（合并操作数部分合并、大值分离到 blob 文件），调用方需持有写锁
+    void install_l0_table(ColumnFamilyData& cfd, std::map<std::string, std::vector<VersionedValue>> all_versions,
+                          const std::vector<RangeTombstone>& range_tombstones, const SSTableProperties& properties);
+    void compact_column_family(ColumnFamilyData& cfd);
+    
+    void request_flush(ColumnFamilyData& cfd);
     void flush_worker();
     void compact_worker();
-    bool need_compaction() const;
+    bool need_compaction(const ColumnFamilyData& cfd) const;
     void request_compaction();
-    void compact_level(int level);
-    void execute_compaction_task(std::unique_ptr<CompactionTask> task);
-    std::vector<SSTableMeta> get_overlapping_sstables(int level, const SSTableMeta& input);
-    void update_level_metadata(int level, const std::vector<SSTableMeta>& old_files);
+    void compact_level(ColumnFamilyData& cfd, int level);
+    void execute_compaction_task(ColumnFamilyData& cfd, std::unique_ptr<CompactionTask> task);
+    // 源层级及以下、不在压缩输入中的文件的 key 范围，即压缩之外还可能有更旧数据的范围：
+    // 决定输出能否丢弃范围删除与墓碑、压缩过滤器能否删除 key。每个任务开始时收集一次，之后按 key 查询不再加锁
+    KeyRangeSet outside_input_ranges(ColumnFamilyData& cfd, const CompactionTask& task);
+    // 对压缩中保留下来的一个值执行 TTL 与自定义压缩过滤器：返回 false 表示删除该 key，
+    // 改写后的值（存储形式）写回 value
+    bool filter_compaction_value(ColumnFamilyData& cfd, const CompactionTask& task, const KeyRangeSet& outside_inputs,
+                                 const CompactionFilter* filter, BlobBuilder& blob_builder, const std::string& key,
+                                 std::string& value, uint64_t now);
+    // TTL：写入时间都已超过 ttl_seconds 的文件整体过期，不读取内容直接删除
+    bool is_file_expired(const ColumnFamilyData& cfd, const SSTableMeta& meta, uint64_t now) const;
+    void drop_expired_files(ColumnFamilyData& cfd);  // 调用方需持有 compaction_mutex
+    std::vector<SSTableMeta> get_overlapping_sstables(ColumnFamilyData& cfd, int level, const SSTableMeta& input);
+    void update_level_metadata(ColumnFamilyData& cfd, int level, const std::vector<SSTableMeta>& old_files);
+    bool memtable_overlaps(const SSTableMeta& meta) const;        // 调用方需持有写锁
+    int pick_ingest_level(const SSTableMeta& meta, bool& overlaps) const;
+    bool link_ingested_file(const std::string& src, const std::string& dst, bool move_files);
 
-    MemTable memtable_;
+    std::string db_path_;
+    std::string data_dir_;  // SSTable 与 blob 文件所在目录
     WAL wal_;
+    MemoryBudget memory_budget_;  // 需先于缓存、列族与索引构造、后于它们析构
+    kvdb::monitoring::MetricsRegistry metrics_;
+    kvdb::monitoring::HdrHistogram* get_latency_ = nullptr;
+    kvdb::monitoring::HdrHistogram* batch_latency_ = nullptr;
+    std::array<kvdb::monitoring::HdrHistogram*, 4> write_latency_{};  // 按 WriteBatch::OpType 下标
+    kvdb::monitoring::HdrHistogram* flush_latency_ = nullptr;
+    kvdb::monitoring::HdrHistogram* compaction_latency_ = nullptr;
     std::unique_ptr<CacheManager> cache_manager_;
-    int file_id_ = 0;
-    std::vector<Level> levels_;
-    VersionSet version_set_{MAX_LEVEL};
+    BlobManager blob_manager_;
+    std::atomic<int> file_id_{0};
     SnapshotManager snapshot_manager_;
-    std::atomic<uint64_t> seq_{0}; // 全局序列号
+    std::atomic<uint64_t> own_seq_{0};
+    std::atomic<uint64_t>* seq_; // 全局序列号，所有列族共享；分片模式下指向 ShardedKVDB 的分配器
+
+    // 列族按编号存放，删除的列族保留（标记 dropped），句柄因此始终有效
+    std::vector<std::unique_ptr<ColumnFamilyData>> column_families_;
+    ColumnFamilyData* default_cf_ = nullptr;
+    uint32_t next_cf_id_ = 1;
+    mutable std::shared_mutex cf_mutex_;  // 保护 column_families_ 与 next_cf_id_
 
     // Background thread management
     std::thread bg_flush_thread_;
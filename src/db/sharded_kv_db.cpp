@@ -0,0 +1,286 @@
+#include "db/sharded_kv_db.h"
+#include "iterator/merge_iterator.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+
+// 路由用的哈希必须跨进程、跨编译器稳定（分片数据落盘），不用 std::hash
+uint64_t fnv1a(const std::string& key) {
+    uint64_t hash = 1469598103934665603ull;
+    for (unsigned char c : key) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+} // namespace
+
+ShardedKVDB::ShardedKVDB(const std::string& path, const ShardedKVDBOptions& options) : path_(path) {
+    std::filesystem::create_directories(path_);
+    size_t requested = options.num_shards > 0 ? options.num_shards
+                                              : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    size_t num_shards = load_or_init_shard_count(path_, requested);
+    size_t num_cpus = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+    shards_.reserve(num_shards);
+    for (size_t i = 0; i < num_shards; i++) {
+        std::string dir = (std::filesystem::path(path_) / ("shard_" + std::to_string(i))).string();
+        std::filesystem::create_directories(dir);
+        // KVDB 的分片构造函数是私有的，只能在这里直接 new
+        shards_.emplace_back(new KVDB(dir + "/wal.log", dir, &global_seq_));
+        int cpu = options.pin_background_threads ? static_cast<int>(i % num_cpus) : -1;
+        if (cpu >= 0) {
+            shards_.back()->pin_background_threads(cpu);
+        }
+        if (options.owner_threads) {
+            owners_.push_back(std::make_unique<ShardOwner>(cpu));
+        }
+    }
+
+    std::cout << "[ShardedKVDB] 打开 " << path_ << "，分片数 " << num_shards
+              << (options.owner_threads ? "（每分片一个所有者线程）" : "")
+              << "，当前序列号 " << global_seq_.load() << std::endl;
+}
+
+ShardedKVDB::~ShardedKVDB() {
+    // 所有者线程执行完已投递的消息再退出，之后才析构分片
+    owners_.clear();
+}
+
+ShardedKVDB::ShardOwner::ShardOwner(int cpu) : thread_(&ShardOwner::run, this, cpu) {}
+
+ShardedKVDB::ShardOwner::~ShardOwner() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+}
+
+void ShardedKVDB::ShardOwner::post(std::function<void()> message) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(message));
+    }
+    cv_.notify_one();
+}
+
+void ShardedKVDB::ShardOwner::run(int cpu) {
+#ifdef __linux__
+    if (cpu >= 0 && cpu < CPU_SETSIZE) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(cpu, &cpus);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    }
+#else
+    (void)cpu;
+#endif
+    std::vector<std::function<void()>> batch;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;  // stop_ 且没有剩余消息
+            }
+            batch.swap(queue_);
+        }
+        for (auto& message : batch) {
+            message();
+        }
+        batch.clear();
+    }
+}
+
+bool ShardedKVDB::run_on_all_shards(const std::function<bool(KVDB&)>& fn) {
+    std::vector<std::future<bool>> results;
+    results.reserve(shards_.size());
+    for (size_t i = 0; i < shards_.size(); i++) {
+        results.push_back(submit(i, fn));
+    }
+    bool ok = true;
+    for (auto& result : results) {
+        ok = result.get() && ok;
+    }
+    return ok;
+}
+
+size_t ShardedKVDB::load_or_init_shard_count(const std::string& path, size_t requested) {
+    std::string file = (std::filesystem::path(path) / "SHARDS").string();
+    std::ifstream ifs(file);
+    size_t stored = 0;
+    if (ifs >> stored && stored > 0) {
+        if (stored != requested) {
+            std::cerr << "[ShardedKVDB] 已有数据按 " << stored << " 个分片路由，忽略请求的分片数 "
+                      << requested << std::endl;
+        }
+        return stored;
+    }
+    std::ofstream ofs(file, std::ios::trunc);
+    ofs << requested << "\n";
+    return requested;
+}
+
+size_t ShardedKVDB::shard_for(const std::string& key) const {
+    return static_cast<size_t>(fnv1a(key) % shards_.size());
+}
+
+bool ShardedKVDB::put(const std::string& key, const std::string& value) {
+    return submit(shard_for(key), [&](KVDB& db) { return db.put(key, value); }).get();
+}
+
+bool ShardedKVDB::get(const std::string& key, std::string& value) {
+    return submit(shard_for(key), [&](KVDB& db) { return db.get(key, value); }).get();
+}
+
+bool ShardedKVDB::get(const std::string& key, const Snapshot& snapshot, std::string& value) {
+    return submit(shard_for(key), [&](KVDB& db) { return db.get(key, snapshot, value); }).get();
+}
+
+bool ShardedKVDB::del(const std::string& key) {
+    return submit(shard_for(key), [&](KVDB& db) { return db.del(key); }).get();
+}
+
+bool ShardedKVDB::merge(const std::string& key, const std::string& operand) {
+    return submit(shard_for(key), [&](KVDB& db) { return db.merge(key, operand); }).get();
+}
+
+std::future<bool> ShardedKVDB::put_async(std::string key, std::string value) {
+    size_t index = shard_for(key);
+    return submit(index, [key = std::move(key), value = std::move(value)](KVDB& db) { return db.put(key, value); });
+}
+
+std::future<std::optional<std::string>> ShardedKVDB::get_async(std::string key) {
+    size_t index = shard_for(key);
+    return submit(index, [key = std::move(key)](KVDB& db) {
+        std::string value;
+        return db.get(key, value) ? std::optional<std::string>(std::move(value)) : std::nullopt;
+    });
+}
+
+std::future<bool> ShardedKVDB::del_async(std::string key) {
+    size_t index = shard_for(key);
+    return submit(index, [key = std::move(key)](KVDB& db) { return db.del(key); });
+}
+
+bool ShardedKVDB::delete_range(const std::string& begin, const std::string& end) {
+    std::shared_lock<std::shared_mutex> lock(cross_shard_mutex_);
+    return run_on_all_shards([&](KVDB& db) { return db.delete_range(begin, end); });
+}
+
+bool ShardedKVDB::write(const WriteBatch& batch) {
+    std::vector<WriteBatch> per_shard(shards_.size());
+    for (const auto& op : batch.ops()) {
+        if (op.cf_id != ColumnFamilyData::DEFAULT_ID) {
+            std::cerr << "[ShardedKVDB] 批量写入只支持默认列族" << std::endl;
+            return false;
+        }
+        switch (op.type) {
+            case WriteBatch::OpType::PUT:
+                per_shard[shard_for(op.key)].put(op.key, op.value);
+                break;
+            case WriteBatch::OpType::DEL:
+                per_shard[shard_for(op.key)].del(op.key);
+                break;
+            case WriteBatch::OpType::MERGE:
+                per_shard[shard_for(op.key)].merge(op.key, op.value);
+                break;
+            case WriteBatch::OpType::DELETE_RANGE:
+                for (auto& sub : per_shard) {
+                    sub.delete_range(op.key, op.value);
+                }
+                break;
+        }
+    }
+
+    size_t touched = 0;
+    size_t last = 0;
+    for (size_t i = 0; i < per_shard.size(); i++) {
+        if (!per_shard[i].empty()) {
+            touched++;
+            last = i;
+        }
+    }
+    if (touched == 0) {
+        return true;
+    }
+    // 只落在一个分片上的批由该分片自己保证原子，不必与快照互斥
+    if (touched == 1) {
+        return submit(last, [&](KVDB& db) { return db.write(per_shard[last]); }).get();
+    }
+
+    // 各分片的子批同时投递，在各自的所有者线程上并行写入
+    std::shared_lock<std::shared_mutex> lock(cross_shard_mutex_);
+    std::vector<std::future<bool>> results;
+    for (size_t i = 0; i < per_shard.size(); i++) {
+        if (!per_shard[i].empty()) {
+            results.push_back(submit(i, [&sub = per_shard[i]](KVDB& db) { return db.write(sub); }));
+        }
+    }
+    bool ok = true;
+    for (auto& result : results) {
+        ok = result.get() && ok;
+    }
+    return ok;
+}
+
+Snapshot ShardedKVDB::get_snapshot() {
+    // 等正在执行的跨分片批全部写完；此后开始的批分到的序列号都大于快照
+    std::unique_lock<std::shared_mutex> lock(cross_shard_mutex_);
+    uint64_t current_seq = global_seq_.load();
+    uint64_t snapshot_seq = current_seq > 0 ? current_seq - 1 : 0;
+    for (auto& shard : shards_) {
+        shard->snapshot_manager_.create(snapshot_seq);
+    }
+    return Snapshot(snapshot_seq);
+}
+
+void ShardedKVDB::release_snapshot(const Snapshot& snapshot) {
+    for (auto& shard : shards_) {
+        shard->release_snapshot(snapshot);
+    }
+}
+
+std::unique_ptr<Iterator> ShardedKVDB::new_iterator(const Snapshot& snapshot, const ReadOptions& options) {
+    std::vector<std::unique_ptr<Iterator>> children;
+    children.reserve(shards_.size());
+    for (auto& shard : shards_) {
+        children.push_back(shard->new_iterator(snapshot, options));
+    }
+    return std::make_unique<MergeIterator>(std::move(children), options);
+}
+
+std::unique_ptr<Iterator> ShardedKVDB::new_prefix_iterator(const Snapshot& snapshot, const std::string& prefix,
+                                                           const ReadOptions& options) {
+    std::vector<std::unique_ptr<Iterator>> children;
+    children.reserve(shards_.size());
+    for (auto& shard : shards_) {
+        children.push_back(shard->new_prefix_iterator(snapshot, prefix, options));
+    }
+    return std::make_unique<MergeIterator>(std::move(children), options);
+}
+
+void ShardedKVDB::flush() {
+    run_on_all_shards([](KVDB& db) {
+        db.flush();
+        return true;
+    });
+}
+
+void ShardedKVDB::compact() {
+    run_on_all_shards([](KVDB& db) {
+        db.compact();
+        return true;
+    });
+}
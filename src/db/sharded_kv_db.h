@@ -0,0 +1,115 @@
+#pragma once
+#include "db/kv_db.h"
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <shared_mutex>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <optional>
+#include <vector>
+#include <string>
+
+struct ShardedKVDBOptions {
+    size_t num_shards = 0;                // 0 表示每个 CPU 核一个分片；已有数据时以 SHARDS 文件记录的分片数为准
+    bool pin_background_threads = true;   // 第 i 个分片的所有者、刷盘与压缩线程绑定到第 i % 核数 个 CPU
+    // 每个分片一个所有者线程，分片上的读写、刷盘与压缩都作为消息投递给它顺序执行；
+    // false 时调用线程直接操作分片（只做哈希分区）
+    bool owner_threads = true;
+};
+
+// 按核分片的 KV 数据库：N 个互不共享的 KVDB 实例，各自拥有 MemTable、WAL、层级与缓存，
+// 目录为 <path>/shard_<i>。key 按 FNV-1a 哈希路由到分片。每个分片由一个绑核的所有者线程独占执行，
+// 调用方把操作作为消息投进它的队列，分片内的写入不在调用线程之间争锁，跨分片请求在各分片上并行执行。
+// 所有分片从同一个全局序列号分配器取序列号，因此一个序列号就是跨分片一致的快照：
+// 跨分片的批量写入与范围删除持共享锁执行，创建快照持独占锁，快照不会落在一个批的中间。
+// 崩溃恢复按分片各自重放 WAL，跨分片的批在崩溃时不保证原子（需要两阶段提交）。
+// 只支持默认列族；分片级配置（合并操作符、压缩策略等）通过 shard(i) 逐个设置
+class ShardedKVDB {
+public:
+    explicit ShardedKVDB(const std::string& path, const ShardedKVDBOptions& options = ShardedKVDBOptions());
+    ~ShardedKVDB();
+
+    ShardedKVDB(const ShardedKVDB&) = delete;
+    ShardedKVDB& operator=(const ShardedKVDB&) = delete;
+
+    bool put(const std::string& key, const std::string& value);
+    bool get(const std::string& key, std::string& value);
+    bool get(const std::string& key, const Snapshot& snapshot, std::string& value);
+    bool del(const std::string& key);
+    bool merge(const std::string& key, const std::string& operand);
+    // 异步接口：消息投递到所有者线程后立即返回，调用方可以先发出多个请求再统一等待
+    std::future<bool> put_async(std::string key, std::string value);
+    std::future<std::optional<std::string>> get_async(std::string key);
+    std::future<bool> del_async(std::string key);
+    // 范围跨越所有哈希分区，在每个分片上执行
+    bool delete_range(const std::string& begin, const std::string& end);
+    // 按分片拆分后分别原子写入；DELETE_RANGE 发往所有分片。批内只能有默认列族的操作
+    bool write(const WriteBatch& batch);
+
+    // 全局快照：同一个序列号登记到每个分片，压缩期间各分片都保留它可见的版本
+    Snapshot get_snapshot();
+    void release_snapshot(const Snapshot& snapshot);
+
+    // 各分片在同一快照上的迭代器按 key 归并；分片间 key 不相交，归并结果即全局有序视图。
+    // 迭代器在调用线程上直接读分片，不经过所有者线程
+    std::unique_ptr<Iterator> new_iterator(const Snapshot& snapshot, const ReadOptions& options = ReadOptions());
+    std::unique_ptr<Iterator> new_prefix_iterator(const Snapshot& snapshot, const std::string& prefix,
+                                                  const ReadOptions& options = ReadOptions());
+
+    void flush();
+    void compact();
+
+    size_t num_shards() const { return shards_.size(); }
+    size_t shard_for(const std::string& key) const;
+    KVDB& shard(size_t index) { return *shards_[index]; }
+    uint64_t current_sequence() const { return global_seq_.load(); }
+
+private:
+    // 分片所有者线程：调用方投递消息，线程每次取走队列中全部消息依次执行；析构时执行完剩余消息再退出
+    class ShardOwner {
+    public:
+        explicit ShardOwner(int cpu);  // cpu < 0 表示不绑核
+        ~ShardOwner();
+        void post(std::function<void()> message);
+
+    private:
+        void run(int cpu);
+
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::vector<std::function<void()>> queue_;
+        bool stop_ = false;
+        std::thread thread_;
+    };
+
+    // 在 index 号分片上执行 fn(KVDB&)：有所有者线程时投递消息，否则在调用线程上直接执行
+    template <typename F>
+    auto submit(size_t index, F fn) -> std::future<decltype(fn(std::declval<KVDB&>()))> {
+        using Result = decltype(fn(std::declval<KVDB&>()));
+        KVDB& db = *shards_[index];
+        auto task = std::make_shared<std::packaged_task<Result()>>(
+            [fn = std::move(fn), &db]() mutable { return fn(db); });
+        std::future<Result> result = task->get_future();
+        if (owners_.empty()) {
+            (*task)();
+        } else {
+            owners_[index]->post([task] { (*task)(); });
+        }
+        return result;
+    }
+
+    // 在每个分片上并行执行 fn，全部完成后返回是否都成功
+    bool run_on_all_shards(const std::function<bool(KVDB&)>& fn);
+
+    // 读取 <path>/SHARDS 中记录的分片数；新库写入 requested
+    static size_t load_or_init_shard_count(const std::string& path, size_t requested);
+
+    std::string path_;
+    std::atomic<uint64_t> global_seq_{0};  // 各分片的 seq_ 指向这里，需先于分片构造、后于分片析构
+    std::vector<std::unique_ptr<KVDB>> shards_;
+    std::vector<std::unique_ptr<ShardOwner>> owners_;  // 先于分片析构，剩余消息执行时分片仍然有效
+    mutable std::shared_mutex cross_shard_mutex_;
+};
@@ -0,0 +1,47 @@
+#include "db/write_batch.h"
+#include "db/column_family.h"
+
+void WriteBatch::put(const std::string& key, const std::string& value) {
+    ops_.push_back({OpType::PUT, key, value});
+    approximate_size_ += key.size() + value.size();
+}
+
+void WriteBatch::del(const std::string& key) {
+    ops_.push_back({OpType::DEL, key, std::string()});
+    approximate_size_ += key.size();
+}
+
+void WriteBatch::put(ColumnFamilyHandle* cf, const std::string& key, const std::string& value) {
+    ops_.push_back({OpType::PUT, key, value, cf->id()});
+    approximate_size_ += key.size() + value.size();
+}
+
+void WriteBatch::del(ColumnFamilyHandle* cf, const std::string& key) {
+    ops_.push_back({OpType::DEL, key, std::string(), cf->id()});
+    approximate_size_ += key.size();
+}
+
+void WriteBatch::delete_range(const std::string& begin, const std::string& end) {
+    ops_.push_back({OpType::DELETE_RANGE, begin, end});
+    approximate_size_ += begin.size() + end.size();
+}
+
+void WriteBatch::delete_range(ColumnFamilyHandle* cf, const std::string& begin, const std::string& end) {
+    ops_.push_back({OpType::DELETE_RANGE, begin, end, cf->id()});
+    approximate_size_ += begin.size() + end.size();
+}
+
+void WriteBatch::merge(const std::string& key, const std::string& operand) {
+    ops_.push_back({OpType::MERGE, key, operand});
+    approximate_size_ += key.size() + operand.size();
+}
+
+void WriteBatch::merge(ColumnFamilyHandle* cf, const std::string& key, const std::string& operand) {
+    ops_.push_back({OpType::MERGE, key, operand, cf->id()});
+    approximate_size_ += key.size() + operand.size();
+}
+
+void WriteBatch::clear() {
+    ops_.clear();
+    approximate_size_ = 0;
+}
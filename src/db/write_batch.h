@@ -0,0 +1,44 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+class ColumnFamilyHandle;
+
+// WriteBatch：一组原子写入的 PUT/DEL/DELETE_RANGE/MERGE 操作
+// KVDB::write 在一次写锁内为批内操作分配连续的序列号，并以单条 BATCH 记录写入 WAL，
+// 重放时不完整的批（崩溃截断）整体丢弃，从而保证“全部可见或全部不可见”。
+// 批内操作可以属于不同列族，所有列族共享同一个 WAL，因此跨列族的批同样是原子的。
+class WriteBatch {
+public:
+    enum class OpType { PUT, DEL, DELETE_RANGE, MERGE };
+
+    struct Op {
+        OpType type;
+        std::string key;    // DELETE_RANGE 时为范围起点（含）
+        std::string value;  // DELETE_RANGE 时为范围终点（不含），MERGE 时为操作数
+        uint32_t cf_id = 0;  // 所属列族，0 为默认列族
+    };
+
+    void put(const std::string& key, const std::string& value);
+    void del(const std::string& key);
+    void put(ColumnFamilyHandle* cf, const std::string& key, const std::string& value);
+    void del(ColumnFamilyHandle* cf, const std::string& key);
+    // 删除 [begin, end) 内的所有 key，只占一条记录
+    void delete_range(const std::string& begin, const std::string& end);
+    void delete_range(ColumnFamilyHandle* cf, const std::string& begin, const std::string& end);
+    // 合并操作数：由所属列族的合并操作符在读取与压缩时折叠到已有值上
+    void merge(const std::string& key, const std::string& operand);
+    void merge(ColumnFamilyHandle* cf, const std::string& key, const std::string& operand);
+    void clear();
+
+    size_t count() const { return ops_.size(); }
+    bool empty() const { return ops_.empty(); }
+    size_t approximate_size() const { return approximate_size_; }
+    const std::vector<Op>& ops() const { return ops_; }
+
+private:
+    std::vector<Op> ops_;
+    size_t approximate_size_ = 0;
+};
@@ -15,64 +15,84 @@ FullTextIndex::~FullTextIndex() = default;
 void FullTextIndex::index_document(const std::string& document_id, const std::string& text) {
     std::unique_lock<std::shared_mutex> lock(mutex_);
     
-    // 如果文档已存在，先移除
-    auto doc_it = document_info_.find(document_id);
-    if (doc_it != document_info_.end()) {
-        // 从倒排索引中移除旧的词条
-        for (const std::string& term : doc_it->second.terms) {
-            auto inv_it = inverted_index_.find(term);
-            if (inv_it != inverted_index_.end()) {
-                inv_it->second.erase(document_id);
-                if (inv_it->second.empty()) {
-                    inverted_index_.erase(inv_it);
-                    term_frequencies_.erase(term);
-                }
-            }
+    // 如果文档已存在，先移除（旧 ID 打删除标记，新内容分配新 ID）
+    remove_document_internal(document_id);
+    
+    // 流式分词并按词条收集位置，词频即位置个数；词条只在首次出现时分配字符串
+    std::map<std::string, std::vector<uint32_t>, std::less<>> term_positions;
+    uint32_t term_count = 0;
+    tokenizer_.for_each_token(text, [&](std::string_view term) {
+        auto it = term_positions.find(term);
+        if (it == term_positions.end()) {
+            it = term_positions.emplace(std::string(term), std::vector<uint32_t>()).first;
+        }
+        it->second.push_back(term_count++);
+    });
+    
+    // 建立倒排索引：新 ID 总是最大的，倒排列表只需追加
+    uint32_t doc = doc_ids_.assign(document_id);
+    for (const auto& pair : term_positions) {
+        auto& posting_list = inverted_index_[pair.first];
+        if (!posting_list) {
+            posting_list = std::make_unique<CompressedPostingList>(pair.first);
         }
+        posting_list->append(doc, static_cast<uint32_t>(pair.second.size()),
+                             pair.second.data(), pair.second.size(), term_count);
     }
     
-    // 分词
-    std::vector<std::string> terms = tokenizer_.tokenize(text);
-    
-    // 创建文档信息
-    DocumentInfo doc_info;
-    doc_info.term_count = terms.size();
-    
-    // 建立倒排索引
-    for (const std::string& term : terms) {
-        inverted_index_[term].insert(document_id);
-        doc_info.terms.insert(term);
-        term_frequencies_[term]++;
+    if (term_counts_.size() <= doc) {
+        term_counts_.resize(doc + 1, 0);
     }
-    
-    document_info_[document_id] = std::move(doc_info);
+    term_counts_[doc] = term_count;
     stats_dirty_ = true;
 }
 
 void FullTextIndex::remove_document(const std::string& document_id) {
     std::unique_lock<std::shared_mutex> lock(mutex_);
+    remove_document_internal(document_id);
+}
+
+void FullTextIndex::remove_document_internal(const std::string& document_id) {
+    uint32_t doc = doc_ids_.find(document_id);
+    if (doc == DocIdMap::INVALID_ID) {
+        return;
+    }
+    
+    // 倒排列表中的 posting 在查询时按删除标记过滤，compact 时才真正丢弃
+    term_counts_[doc] = 0;
+    doc_ids_.remove(document_id);
+    stats_dirty_ = true;
     
-    auto doc_it = document_info_.find(document_id);
-    if (doc_it == document_info_.end()) {
+    maybe_compact();
+}
+
+void FullTextIndex::maybe_compact() {
+    size_t deleted = doc_ids_.deleted_count();
+    if (deleted < COMPACT_MIN_DELETED ||
+        deleted < COMPACT_DELETED_RATIO * (deleted + doc_ids_.live_count())) {
         return;
     }
     
-    // 从倒排索引中移除
-    for (const std::string& term : doc_it->second.terms) {
-        auto inv_it = inverted_index_.find(term);
-        if (inv_it != inverted_index_.end()) {
-            inv_it->second.erase(document_id);
-            if (inv_it->second.empty()) {
-                inverted_index_.erase(inv_it);
-                term_frequencies_.erase(term);
-            } else {
-                term_frequencies_[term]--;
-            }
+    std::vector<uint32_t> remap = doc_ids_.compact();
+    
+    std::vector<uint32_t> counts(doc_ids_.next_id(), 0);
+    for (uint32_t old_id = 0; old_id < remap.size(); ++old_id) {
+        if (remap[old_id] != DocIdMap::INVALID_ID) {
+            counts[remap[old_id]] = term_counts_[old_id];
         }
     }
     
-    document_info_.erase(doc_it);
-    stats_dirty_ = true;
+    for (auto it = inverted_index_.begin(); it != inverted_index_.end();) {
+        auto rebuilt = std::make_unique<CompressedPostingList>(it->second->remap(remap, counts));
+        if (rebuilt->empty()) {
+            it = inverted_index_.erase(it);
+        } else {
+            it->second = std::move(rebuilt);
+            ++it;
+        }
+    }
+    
+    term_counts_ = std::move(counts);
 }
 
 void FullTextIndex::update_document(const std::string& document_id, 
@@ -86,6 +106,35 @@ void FullTextIndex::update_document(const std::string& document_id,
     index_document(document_id, new_text);
 }
 
+std::vector<uint32_t> FullTextIndex::intersect_terms(const std::vector<std::string>& terms) const {
+    std::vector<PostingIterator> iters;
+    for (const std::string& term : terms) {
+        auto it = inverted_index_.find(term);
+        if (it == inverted_index_.end()) {
+            // 如果任何一个词不存在，返回空结果（AND 语义）
+            return {};
+        }
+        iters.emplace_back(it->second.get());
+    }
+    
+    std::vector<uint32_t> ids;
+    posting::intersect(iters,
+                       [this](uint32_t doc) { return doc_ids_.is_live(doc); },
+                       [&ids](uint32_t doc) { ids.push_back(doc); });
+    return ids;
+}
+
+std::vector<std::string> FullTextIndex::to_document_ids(const std::vector<uint32_t>& ids) const {
+    // 结果按文档 ID 字符串排序，与原先 std::set 的输出顺序一致
+    std::vector<std::string> result;
+    result.reserve(ids.size());
+    for (uint32_t id : ids) {
+        result.push_back(doc_ids_.name(id));
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
 std::vector<std::string> FullTextIndex::search(const std::string& query) {
     std::shared_lock<std::shared_mutex> lock(mutex_);
     
@@ -94,34 +143,7 @@ std::vector<std::string> FullTextIndex::search(const std::string& query) {
         return {};
     }
     
-    std::set<std::string> result_set;
-    bool first_term = true;
-    
-    for (const std::string& term : query_terms) {
-        auto it = inverted_index_.find(term);
-        if (it == inverted_index_.end()) {
-            // 如果任何一个词不存在，返回空结果（AND 语义）
-            return {};
-        }
-        
-        if (first_term) {
-            result_set = it->second;
-            first_term = false;
-        } else {
-            // 求交集
-            std::set<std::string> intersection;
-            std::set_intersection(result_set.begin(), result_set.end(),
-                                it->second.begin(), it->second.end(),
-                                std::inserter(intersection, intersection.begin()));
-            result_set = std::move(intersection);
-        }
-        
-        if (result_set.empty()) {
-            break;
-        }
-    }
-    
-    return std::vector<std::string>(result_set.begin(), result_set.end());
+    return to_document_ids(intersect_terms(query_terms));
 }
 
 std::vector<std::string> FullTextIndex::phrase_search(const std::vector<std::string>& terms) {
@@ -131,36 +153,60 @@ std::vector<std::string> FullTextIndex::phrase_search(const std::vector<std::str
     
     std::shared_lock<std::shared_mutex> lock(mutex_);
     
-    // 先找到包含所有词的文档
-    std::set<std::string> candidate_docs;
-    bool first_term = true;
-    
+    std::vector<std::string> normalized_terms;
+    normalized_terms.reserve(terms.size());
     for (const std::string& term : terms) {
-        std::string normalized_term = tokenizer_.normalize(term);
-        auto it = inverted_index_.find(normalized_term);
-        if (it == inverted_index_.end()) {
-            return {};
+        normalized_terms.push_back(tokenizer_.normalize(term));
+    }
+    
+    // 先找到包含所有词的文档，再只对候选文档解码位置流
+    std::vector<uint32_t> candidates = intersect_terms(normalized_terms);
+    if (candidates.empty()) {
+        return {};
+    }
+    
+    // 按词序打开游标；候选文档递增，游标只需向前 advance
+    std::vector<PostingIterator> term_iters;
+    for (const std::string& term : normalized_terms) {
+        term_iters.emplace_back(inverted_index_.find(term)->second.get());
+    }
+    
+    std::vector<uint32_t> matched;
+    for (uint32_t doc : candidates) {
+        if (check_phrase_match(term_iters, doc)) {
+            matched.push_back(doc);
         }
-        
-        if (first_term) {
-            candidate_docs = it->second;
-            first_term = false;
-        } else {
-            std::set<std::string> intersection;
-            std::set_intersection(candidate_docs.begin(), candidate_docs.end(),
-                                it->second.begin(), it->second.end(),
-                                std::inserter(intersection, intersection.begin()));
-            candidate_docs = std::move(intersection);
+    }
+    
+    return to_document_ids(matched);
+}
+
+bool FullTextIndex::check_phrase_match(std::vector<PostingIterator>& term_iters, uint32_t doc) const {
+    std::vector<std::vector<uint32_t>> term_positions(term_iters.size());
+    for (size_t i = 0; i < term_iters.size(); ++i) {
+        term_iters[i].advance(doc);
+        if (!term_iters[i].valid() || term_iters[i].doc() != doc) {
+            return false;
         }
-        
-        if (candidate_docs.empty()) {
-            break;
+        term_positions[i] = term_iters[i].positions();
+        if (term_positions[i].empty()) {
+            // 旧格式反序列化得到的 posting 没有位置信息，只能按包含所有词处理
+            return true;
         }
     }
     
-    // 注意：这里简化了短语搜索，实际应该检查词的位置
-    // 在完整实现中，需要存储词的位置信息
-    return std::vector<std::string>(candidate_docs.begin(), candidate_docs.end());
+    // 第 i 个词必须出现在 start + i
+    for (uint32_t start : term_positions[0]) {
+        bool found = true;
+        for (size_t i = 1; i < term_positions.size() && found; ++i) {
+            found = std::binary_search(term_positions[i].begin(), term_positions[i].end(),
+                                       start + static_cast<uint32_t>(i));
+        }
+        if (found) {
+            return true;
+        }
+    }
+    return false;
 }
 
 std::vector<std::string> FullTextIndex::boolean_search(const std::string& query) {
@@ -179,15 +225,19 @@ std::vector<std::string> FullTextIndex::boolean_search(const std::string& query)
 std::vector<std::string> FullTextIndex::wildcard_search(const std::string& pattern) {
     std::shared_lock<std::shared_mutex> lock(mutex_);
     
-    std::set<std::string> result_set;
-    
+    std::vector<PostingIterator> iters;
     for (const auto& pair : inverted_index_) {
         if (match_wildcard(pair.first, pattern)) {
-            result_set.insert(pair.second.begin(), pair.second.end());
+            iters.emplace_back(pair.second.get());
         }
     }
     
-    return std::vector<std::string>(result_set.begin(), result_set.end());
+    std::vector<uint32_t> ids;
+    posting::unite(iters,
+                   [this](uint32_t doc) { return doc_ids_.is_live(doc); },
+                   [&ids](uint32_t doc) { ids.push_back(doc); });
+    
+    return to_document_ids(ids);
 }
 
 std::vector<FullTextIndex::SearchResult> FullTextIndex::ranked_search(const std::string& query, size_t limit) {
@@ -198,41 +248,48 @@ std::vector<FullTextIndex::SearchResult> FullTextIndex::ranked_search(const std:
         return {};
     }
     
-    // 收集候选文档
-    std::set<std::string> candidate_docs;
+    // 每个查询词一个游标（重复的查询词各自计分，与原先逐词累加一致）
+    // TF = 1 / 文档长度，块内最短文档给出块级上界
+    std::vector<posting::ScoredCursor> cursors;
+    std::vector<const std::string*> cursor_terms;
     for (const std::string& term : query_terms) {
         auto it = inverted_index_.find(term);
-        if (it != inverted_index_.end()) {
-            candidate_docs.insert(it->second.begin(), it->second.end());
+        if (it == inverted_index_.end()) {
+            continue;
         }
+        size_t df = it->second->size();
+        cursors.emplace_back(it->second.get(),
+            [this, df](uint32_t doc, uint32_t) { return calculate_tf_idf(term_counts_[doc], df); },
+            [this, df](uint32_t, uint32_t min_length) { return calculate_tf_idf(std::max(min_length, 1u), df); });
+        cursor_terms.push_back(&term);
     }
     
-    // 计算每个文档的得分
+    // Block-Max WAND 只完整打分可能进入前 limit 的文档，结果已按得分降序
+    auto top = posting::top_k(cursors, limit,
+                              [this](uint32_t doc) { return doc_ids_.is_live(doc); });
+    
     std::vector<SearchResult> results;
-    for (const std::string& doc_id : candidate_docs) {
-        double score = calculate_document_score(doc_id, query_terms);
-        if (score > 0) {
-            SearchResult result(doc_id, score);
-            // 找到匹配的词条
-            for (const std::string& term : query_terms) {
-                auto it = inverted_index_.find(term);
-                if (it != inverted_index_.end() && it->second.count(doc_id) > 0) {
-                    result.matched_terms.push_back(term);
-                }
-            }
-            results.push_back(result);
-        }
+    results.reserve(top.size());
+    for (const auto& entry : top) {
+        results.emplace_back(doc_ids_.name(entry.first), entry.second);
     }
     
-    // 按得分排序
-    std::sort(results.begin(), results.end(), 
-              [](const SearchResult& a, const SearchResult& b) {
-                  return a.score > b.score;
-              });
-    
-    // 限制结果数量
-    if (limit > 0 && results.size() > limit) {
-        results.resize(limit);
+    // 只为入选文档补充匹配词条：按文档 ID 递增访问，游标只需向前 advance
+    std::vector<size_t> order(top.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(),
+              [&top](size_t a, size_t b) { return top[a].first < top[b].first; });
+    
+    for (size_t t = 0; t < cursors.size(); ++t) {
+        PostingIterator it(cursors[t].iter.list());
+        for (size_t i : order) {
+            it.advance(top[i].first);
+            if (it.valid() && it.doc() == top[i].first) {
+                results[i].matched_terms.push_back(*cursor_terms[t]);
+            }
+        }
     }
     
     return results;
@@ -240,7 +297,7 @@ std::vector<FullTextIndex::SearchResult> FullTextIndex::ranked_search(const std:
 
 size_t FullTextIndex::document_count() const {
     std::shared_lock<std::shared_mutex> lock(mutex_);
-    return document_info_.size();
+    return doc_ids_.live_count();
 }
 
 size_t FullTextIndex::term_count() const {
@@ -258,14 +315,12 @@ size_t FullTextIndex::total_terms() const {
 
 double FullTextIndex::average_document_length() const {
     std::shared_lock<std::shared_mutex> lock(mutex_);
-    if (document_info_.empty()) return 0.0;
+    if (doc_ids_.live_count() == 0) return 0.0;
     
-    size_t total_length = 0;
-    for (const auto& pair : document_info_) {
-        total_length += pair.second.term_count;
+    if (stats_dirty_) {
+        update_stats();
     }
-    
-    return static_cast<double>(total_length) / document_info_.size();
+    return static_cast<double>(total_terms_) / doc_ids_.live_count();
 }
 
 size_t FullTextIndex::memory_usage() const {
@@ -276,24 +331,17 @@ size_t FullTextIndex::memory_usage() const {
     // 倒排索引
     for (const auto& pair : inverted_index_) {
         usage += pair.first.size();
-        usage += sizeof(std::set<std::string>);
-        for (const auto& doc_id : pair.second) {
-            usage += doc_id.size();
-        }
+        usage += pair.second->memory_usage();
     }
     
-    // 文档信息
-    for (const auto& pair : document_info_) {
-        usage += pair.first.size();
-        usage += sizeof(DocumentInfo);
-        for (const auto& term : pair.second.terms) {
-            usage += term.size();
-        }
-    }
+    // 文档 ID 映射与词条数
+    usage += doc_ids_.memory_usage();
+    usage += term_counts_.capacity() * sizeof(uint32_t);
     
     return usage;
 }
 
+// 序列化格式保持不变（字符串文档 ID 集合 + 每个文档的词条集合），只写出未删除的文档
 void FullTextIndex::serialize(std::ostream& out) const {
     std::shared_lock<std::shared_mutex> lock(mutex_);
     
@@ -306,47 +354,71 @@ void FullTextIndex::serialize(std::ostream& out) const {
     out.write(reinterpret_cast<const char*>(&field_len), sizeof(field_len));
     out.write(field_.c_str(), field_len);
     
+    // 先按词条收集存活文档，顺带反推每个文档包含的词条
+    std::vector<std::pair<const std::string*, std::vector<const std::string*>>> postings;
+    std::vector<std::vector<const std::string*>> doc_terms(doc_ids_.next_id());
+    for (const auto& pair : inverted_index_) {
+        std::vector<const std::string*> docs;
+        for (PostingIterator it(pair.second.get()); it.valid(); it.next()) {
+            if (doc_ids_.is_live(it.doc())) {
+                docs.push_back(&doc_ids_.name(it.doc()));
+                doc_terms[it.doc()].push_back(&pair.first);
+            }
+        }
+        if (!docs.empty()) {
+            std::sort(docs.begin(), docs.end(),
+                      [](const std::string* a, const std::string* b) { return *a < *b; });
+            postings.emplace_back(&pair.first, std::move(docs));
+        }
+    }
+    
     // 写入倒排索引
-    size_t index_size = inverted_index_.size();
+    size_t index_size = postings.size();
     out.write(reinterpret_cast<const char*>(&index_size), sizeof(index_size));
     
-    for (const auto& pair : inverted_index_) {
+    for (const auto& pair : postings) {
         // 写入词条
-        size_t term_len = pair.first.size();
+        size_t term_len = pair.first->size();
         out.write(reinterpret_cast<const char*>(&term_len), sizeof(term_len));
-        out.write(pair.first.c_str(), term_len);
+        out.write(pair.first->c_str(), term_len);
         
         // 写入文档集合
         size_t doc_count = pair.second.size();
         out.write(reinterpret_cast<const char*>(&doc_count), sizeof(doc_count));
         
-        for (const auto& doc_id : pair.second) {
-            size_t doc_len = doc_id.size();
+        for (const std::string* doc_id : pair.second) {
+            size_t doc_len = doc_id->size();
             out.write(reinterpret_cast<const char*>(&doc_len), sizeof(doc_len));
-            out.write(doc_id.c_str(), doc_len);
+            out.write(doc_id->c_str(), doc_len);
         }
     }
     
     // 写入文档信息
-    size_t doc_info_size = document_info_.size();
+    size_t doc_info_size = doc_ids_.live_count();
     out.write(reinterpret_cast<const char*>(&doc_info_size), sizeof(doc_info_size));
     
-    for (const auto& pair : document_info_) {
+    for (uint32_t id = 0; id < doc_ids_.next_id(); ++id) {
+        if (!doc_ids_.is_live(id)) {
+            continue;
+        }
+        
         // 写入文档ID
-        size_t doc_id_len = pair.first.size();
+        const std::string& doc_id = doc_ids_.name(id);
+        size_t doc_id_len = doc_id.size();
         out.write(reinterpret_cast<const char*>(&doc_id_len), sizeof(doc_id_len));
-        out.write(pair.first.c_str(), doc_id_len);
+        out.write(doc_id.c_str(), doc_id_len);
         
         // 写入文档信息
-        out.write(reinterpret_cast<const char*>(&pair.second.term_count), sizeof(pair.second.term_count));
+        size_t term_count = term_counts_[id];
+        out.write(reinterpret_cast<const char*>(&term_count), sizeof(term_count));
         
-        size_t terms_count = pair.second.terms.size();
+        size_t terms_count = doc_terms[id].size();
         out.write(reinterpret_cast<const char*>(&terms_count), sizeof(terms_count));
         
-        for (const auto& term : pair.second.terms) {
-            size_t term_len = term.size();
+        for (const std::string* term : doc_terms[id]) {
+            size_t term_len = term->size();
             out.write(reinterpret_cast<const char*>(&term_len), sizeof(term_len));
-            out.write(term.c_str(), term_len);
+            out.write(term->c_str(), term_len);
         }
     }
 }
@@ -365,8 +437,8 @@ void FullTextIndex::deserialize(std::istream& in) {
     field_.resize(field_len);
     in.read(&field_[0], field_len);
     
-    // 读取倒排索引
-    inverted_index_.clear();
+    // 读取倒排索引（文档 ID 要等读完文档信息后统一分配）
+    std::vector<std::pair<std::string, std::vector<std::string>>> raw_index;
     size_t index_size;
     in.read(reinterpret_cast<char*>(&index_size), sizeof(index_size));
     
@@ -381,20 +453,22 @@ void FullTextIndex::deserialize(std::istream& in) {
         size_t doc_count;
         in.read(reinterpret_cast<char*>(&doc_count), sizeof(doc_count));
         
-        std::set<std::string> doc_set;
+        std::vector<std::string> docs;
         for (size_t j = 0; j < doc_count; ++j) {
             size_t doc_len;
             in.read(reinterpret_cast<char*>(&doc_len), sizeof(doc_len));
             std::string doc_id(doc_len, '\0');
             in.read(&doc_id[0], doc_len);
-            doc_set.insert(doc_id);
+            docs.push_back(std::move(doc_id));
         }
         
-        inverted_index_[term] = std::move(doc_set);
+        raw_index.emplace_back(std::move(term), std::move(docs));
     }
     
-    // 读取文档信息
-    document_info_.clear();
+    // 读取文档信息并分配整数 ID
+    inverted_index_.clear();
+    doc_ids_.clear();
+    term_counts_.clear();
     size_t doc_info_size;
     in.read(reinterpret_cast<char*>(&doc_info_size), sizeof(doc_info_size));
     
@@ -405,9 +479,9 @@ void FullTextIndex::deserialize(std::istream& in) {
         std::string doc_id(doc_id_len, '\0');
         in.read(&doc_id[0], doc_id_len);
         
-        // 读取文档信息
-        DocumentInfo doc_info;
-        in.read(reinterpret_cast<char*>(&doc_info.term_count), sizeof(doc_info.term_count));
+        // 读取文档信息（词条集合可由倒排索引推出，这里只需跳过）
+        size_t term_count;
+        in.read(reinterpret_cast<char*>(&term_count), sizeof(term_count));
         
         size_t terms_count;
         in.read(reinterpret_cast<char*>(&terms_count), sizeof(terms_count));
@@ -415,22 +489,44 @@ void FullTextIndex::deserialize(std::istream& in) {
         for (size_t j = 0; j < terms_count; ++j) {
             size_t term_len;
             in.read(reinterpret_cast<char*>(&term_len), sizeof(term_len));
-            std::string term(term_len, '\0');
-            in.read(&term[0], term_len);
-            doc_info.terms.insert(term);
+            in.ignore(static_cast<std::streamsize>(term_len));
         }
         
-        document_info_[doc_id] = std::move(doc_info);
+        uint32_t id = doc_ids_.assign(doc_id);
+        term_counts_.resize(id + 1, 0);
+        term_counts_[id] = static_cast<uint32_t>(term_count);
     }
     
+    // 旧格式没有词频和位置：词频记 1，位置为空（短语查询退化为包含所有词）
+    for (const auto& pair : raw_index) {
+        std::vector<uint32_t> ids;
+        for (const std::string& doc_id : pair.second) {
+            uint32_t id = doc_ids_.find(doc_id);
+            if (id != DocIdMap::INVALID_ID) {
+                ids.push_back(id);
+            }
+        }
+        if (ids.empty()) {
+            continue;
+        }
+        std::sort(ids.begin(), ids.end());
+        
+        auto posting_list = std::make_unique<CompressedPostingList>(pair.first);
+        for (uint32_t id : ids) {
+            posting_list->append(id, 1, nullptr, 0, term_counts_[id]);
+        }
+        inverted_index_[pair.first] = std::move(posting_list);
+    }
+    
+    stats_dirty_ = true;
     update_stats();
 }
 
 void FullTextIndex::clear() {
     std::unique_lock<std::shared_mutex> lock(mutex_);
     inverted_index_.clear();
-    document_info_.clear();
-    term_frequencies_.clear();
+    doc_ids_.clear();
+    term_counts_.clear();
     total_terms_ = 0;
     stats_dirty_ = true;
 }
@@ -439,27 +535,21 @@ void FullTextIndex::update_stats() const {
     if (!stats_dirty_) return;
     
     total_terms_ = 0;
-    for (const auto& pair : document_info_) {
-        total_terms_ += pair.second.term_count;
+    for (uint32_t id = 0; id < term_counts_.size(); ++id) {
+        total_terms_ += term_counts_[id];  // 已删除文档的词条数已清零
     }
     stats_dirty_ = false;
 }
 
-double FullTextIndex::calculate_tf_idf(const std::string& term, const std::string& document_id) const {
-    double tf = term_frequency(term, document_id);
-    double idf = inverse_document_frequency(term);
-    return tf * idf;
-}
-
-double FullTextIndex::calculate_document_score(const std::string& document_id, 
-                                              const std::vector<std::string>& query_terms) const {
-    double score = 0.0;
+double FullTextIndex::calculate_tf_idf(uint32_t term_count, size_t docs_with_term) const {
+    if (docs_with_term == 0 || term_count == 0) return 0.0;
     
-    for (const std::string& term : query_terms) {
-        score += calculate_tf_idf(term, document_id);
-    }
+    // 简化的TF计算：1 / 文档长度
+    double tf = 1.0 / term_count;
     
-    return score;
+    // IDF 的文档频率取倒排列表长度，含尚未 compact 的已删除文档
+    double idf = std::log(static_cast<double>(doc_ids_.live_count()) / docs_with_term);
+    return tf * idf;
 }
 
 std::vector<std::string> FullTextIndex::parse_boolean_query(const std::string& query) {
@@ -481,25 +571,3 @@ bool FullTextIndex::match_wildcard(const std::string& text, const std::string& p
         return false;
     }
 }
-
-double FullTextIndex::term_frequency(const std::string& term, const std::string& document_id) const {
-    auto doc_it = document_info_.find(document_id);
-    if (doc_it == document_info_.end()) return 0.0;
-    
-    if (doc_it->second.terms.count(term) == 0) return 0.0;
-    
-    // 简化的TF计算：1 / 文档长度
-    return 1.0 / doc_it->second.term_count;
-}
-
-double FullTextIndex::inverse_document_frequency(const std::string& term) const {
-    auto it = inverted_index_.find(term);
-    if (it == inverted_index_.end()) return 0.0;
-    
-    size_t doc_count = document_info_.size();
-    size_t term_doc_count = it->second.size();
-    
-    if (term_doc_count == 0) return 0.0;
-    
-    return std::log(static_cast<double>(doc_count) / term_doc_count);
-}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "index_types.h"
 #include "tokenizer.h"
+#include "posting_list.h"
 #include <map>
 #include <set>
 #include <string>
@@ -61,20 +62,16 @@ private:
     std::string name_;
     std::string field_;
     
-    // 倒排索引: term -> set<document_id>
-    std::map<std::string, std::set<std::string>> inverted_index_;
+    // 倒排索引: term -> 压缩倒排列表（整数文档 ID + 词频 + 位置）
+    std::map<std::string, std::unique_ptr<CompressedPostingList>> inverted_index_;
     
-    // 文档信息: document_id -> document_info
-    struct DocumentInfo {
-        std::set<std::string> terms;
-        size_t term_count;
-        
-        DocumentInfo() : term_count(0) {}
-    };
-    std::map<std::string, DocumentInfo> document_info_;
+    // 文档 ID 映射与每个文档的词条数（按整数 ID 下标）
+    DocIdMap doc_ids_;
+    std::vector<uint32_t> term_counts_;
     
-    // 词频统计: term -> document_frequency
-    std::map<std::string, size_t> term_frequencies_;
+    // 已删除文档超过该比例（且不少于 COMPACT_MIN_DELETED 个）时重排文档 ID
+    static constexpr double COMPACT_DELETED_RATIO = 0.5;
+    static constexpr size_t COMPACT_MIN_DELETED = 1024;
     
     // 分词器
     Tokenizer tokenizer_;
@@ -88,12 +85,14 @@ private:
     
     // 辅助方法
     void update_stats() const;
-    double calculate_tf_idf(const std::string& term, const std::string& document_id) const;
-    double calculate_document_score(const std::string& document_id, const std::vector<std::string>& query_terms) const;
+    void remove_document_internal(const std::string& document_id);
+    void maybe_compact();
+    std::vector<uint32_t> intersect_terms(const std::vector<std::string>& terms) const;
+    std::vector<std::string> to_document_ids(const std::vector<uint32_t>& ids) const;
+    bool check_phrase_match(std::vector<PostingIterator>& term_iters, uint32_t doc) const;
     std::vector<std::string> parse_boolean_query(const std::string& query);
     bool match_wildcard(const std::string& text, const std::string& pattern);
     
     // TF-IDF 计算
-    double term_frequency(const std::string& term, const std::string& document_id) const;
-    double inverse_document_frequency(const std::string& term) const;
+    double calculate_tf_idf(uint32_t term_count, size_t docs_with_term) const;
 };
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "index_manager.h"
 #include "db/kv_db.h"
+#include "db/write_batch.h"
+#include "storage/memory_budget.h"
 #include <fstream>
 #include <iostream>
 #include <chrono>
@@ -8,103 +10,63 @@
 IndexManager::IndexManager(KVDB& db) : db_(db) {
 }
 
-IndexManager::~IndexManager() = default;
+IndexManager::~IndexManager() {
+    if (budget_) {
+        budget_->release(MemoryBudget::Component::INDEX, charged_bytes_);
+    }
+}
 
 bool IndexManager::create_secondary_index(const std::string& name, const std::string& field, bool unique) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    
-    if (index_exists(name)) {
-        return false;
-    }
-    
-    try {
-        auto index = std::make_unique<SecondaryIndex>(name, field, unique);
-        
-        // 构建索引
-        auto snapshot = db_.get_snapshot();
-        auto iter = db_.new_iterator(snapshot);
-        
-        iter->seek_to_first();
-        while (iter->valid()) {
-            std::string key = iter->key();
-            std::string value = iter->value();
-            
-            if (field == "key") {
-                index->insert(key, key);
-            } else if (field == "value") {
-                index->insert(value, key);
-            }
-            
-            iter->next();
-        }
-        
-        db_.release_snapshot(snapshot);
-        
-        // 保存索引
-        secondary_indexes_[name] = std::move(index);
-        
-        // 保存元数据
-        IndexMetadata metadata(name, IndexType::SECONDARY, {field}, unique);
-        index_metadata_[name] = metadata;
-        
-        update_index_stats(name);
-        return true;
-        
-    } catch (const std::exception& e) {
-        std::cerr << "Failed to create secondary index: " << e.what() << std::endl;
-        return false;
-    }
+    return create_persistent_index(IndexMetadata(name, IndexType::SECONDARY, {field}, unique));
 }
 
 bool IndexManager::create_composite_index(const std::string& name, const std::vector<std::string>& fields) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    
-    if (index_exists(name) || fields.empty()) {
+    if (fields.empty()) {
         return false;
     }
+    return create_persistent_index(IndexMetadata(name, IndexType::COMPOSITE, fields));
+}
+
+bool IndexManager::create_persistent_index(const IndexMetadata& metadata) {
+    std::shared_ptr<PersistentIndex> index;
     
-    try {
-        auto index = std::make_unique<CompositeIndex>(name, fields);
-        
-        // 构建索引
-        auto snapshot = db_.get_snapshot();
-        auto iter = db_.new_iterator(snapshot);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
         
-        iter->seek_to_first();
-        while (iter->valid()) {
-            std::string key = iter->key();
-            std::string value = iter->value();
-            
-            std::vector<std::string> field_values;
-            for (const std::string& field : fields) {
-                if (field == "key") {
-                    field_values.push_back(key);
-                } else if (field == "value") {
-                    field_values.push_back(value);
-                } else {
-                    // 对于其他字段，可以扩展解析逻辑
-                    field_values.push_back("");
-                }
-            }
-            
-            index->insert(field_values, key);
-            iter->next();
+        if (index_exists(metadata.name)) {
+            return false;
         }
         
-        db_.release_snapshot(snapshot);
-        
-        // 保存索引
-        composite_indexes_[name] = std::move(index);
-        
-        // 保存元数据
-        IndexMetadata metadata(name, IndexType::COMPOSITE, fields);
-        index_metadata_[name] = metadata;
+        // 先注册再补建：注册之后的写入由写路径自己追加条目，
+        // 补建只需覆盖注册时刻之前的数据（重复写入同一条目是幂等的）
+        index = std::make_shared<PersistentIndex>(db_, metadata);
+        persistent_indexes_[metadata.name] = index;
+        index_metadata_[metadata.name] = metadata;
+    }
+    
+    // 补建期间不持有 mutex_：补建要通过 KVDB::write 获取数据库写锁，
+    // 而并发的 put 持有数据库写锁后会进入 append_index_entries
+    try {
+        WriteBatch meta_batch;
+        meta_batch.put(PersistentIndex::meta_key(metadata.name),
+                       PersistentIndex::serialize_metadata(metadata));
+        db_.write(meta_batch);
         
-        update_index_stats(name);
+        index->backfill();
         return true;
         
     } catch (const std::exception& e) {
-        std::cerr << "Failed to create composite index: " << e.what() << std::endl;
+        std::cerr << "Failed to create index " << metadata.name << ": " << e.what() << std::endl;
+        
+        // 已写入的条目不再属于任何索引，由 compaction 惰性清除
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            persistent_indexes_.erase(metadata.name);
+            index_metadata_.erase(metadata.name);
+        }
+        WriteBatch meta_batch;
+        meta_batch.del(PersistentIndex::meta_key(metadata.name));
+        db_.write(meta_batch);
         return false;
     }
 }
@@ -126,6 +88,10 @@ bool IndexManager::create_fulltext_index(const std::string& name, const std::str
         iter->seek_to_first();
         while (iter->valid()) {
             std::string key = iter->key();
+            if (PersistentIndex::is_internal_key(key)) {
+                iter->next();
+                continue;
+            }
             std::string value = iter->value();
             
             if (field == "key") {
@@ -172,6 +138,10 @@ bool IndexManager::create_inverted_index(const std::string& name, const std::str
         iter->seek_to_first();
         while (iter->valid()) {
             std::string key = iter->key();
+            if (PersistentIndex::is_internal_key(key)) {
+                iter->next();
+                continue;
+            }
             std::string value = iter->value();
             
             if (field == "key") {
@@ -201,39 +171,100 @@ bool IndexManager::create_inverted_index(const std::string& name, const std::str
     }
 }
 bool IndexManager::drop_index(const std::string& name) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    
-    if (!index_exists(name)) {
-        return false;
-    }
-    
-    IndexType type = get_index_type(name);
-    
-    switch (type) {
-        case IndexType::SECONDARY:
-            secondary_indexes_.erase(name);
-            break;
-        case IndexType::COMPOSITE:
-            composite_indexes_.erase(name);
-            break;
-        case IndexType::FULLTEXT:
-            fulltext_indexes_.erase(name);
-            break;
-        case IndexType::INVERTED:
-            inverted_indexes_.erase(name);
-            break;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        
+        if (!index_exists(name)) {
+            return false;
+        }
+        
+        IndexType type = get_index_type(name);
+        
+        switch (type) {
+            case IndexType::SECONDARY:
+            case IndexType::COMPOSITE:
+                persistent_indexes_.erase(name);
+                break;
+            case IndexType::FULLTEXT:
+                fulltext_indexes_.erase(name);
+                break;
+            case IndexType::INVERTED:
+                inverted_indexes_.erase(name);
+                break;
+        }
+        
+        index_metadata_.erase(name);
+        refresh_memory_charge_locked();
     }
     
-    index_metadata_.erase(name);
+    // 索引条目不在这里逐条删除：compaction 发现条目所属索引不存在时直接丢弃
+    WriteBatch meta_batch;
+    meta_batch.del(PersistentIndex::meta_key(name));
+    db_.write(meta_batch);
     return true;
 }
 
 IndexLookupResult IndexManager::lookup(const std::string& index_name, const IndexQuery& query) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    
     IndexLookupResult result;
     auto start_time = std::chrono::high_resolution_clock::now();
     
+    // 持久化索引的查询是 LSM 前缀扫描，不持有 mutex_，避免阻塞写路径
+    if (auto index = find_persistent_index(index_name)) {
+        // 复合索引的查询值按 '|' 连接成组合键，与写入时的格式一致
+        auto join_terms = [](std::vector<std::string>::const_iterator begin,
+                             std::vector<std::string>::const_iterator end) {
+            std::string joined;
+            for (auto it = begin; it != end; ++it) {
+                if (it != begin) {
+                    joined.push_back(PersistentIndex::FIELD_SEPARATOR);
+                }
+                joined += *it;
+            }
+            return joined;
+        };
+        bool composite = index->get_metadata().type == IndexType::COMPOSITE;
+        
+        try {
+            switch (query.type) {
+                case QueryType::EXACT_MATCH:
+                    result.keys = index->exact_lookup(
+                        composite ? join_terms(query.terms.begin(), query.terms.end()) : query.value);
+                    break;
+                case QueryType::PREFIX_MATCH:
+                    result.keys = index->prefix_lookup(
+                        composite ? join_terms(query.terms.begin(), query.terms.end()) : query.value);
+                    break;
+                case QueryType::RANGE_QUERY:
+                    if (!composite) {
+                        result.keys = index->range_lookup(query.range_start, query.range_end);
+                    } else if (query.terms.size() >= 2) {
+                        // 需要两个terms向量作为范围
+                        auto mid = query.terms.begin() + query.terms.size() / 2;
+                        result.keys = index->range_lookup(join_terms(query.terms.begin(), mid),
+                                                          join_terms(mid, query.terms.end()));
+                    }
+                    break;
+                default:
+                    result.success = false;
+                    result.error_message = composite ?
+                        "Unsupported query type for composite index" :
+                        "Unsupported query type for secondary index";
+                    return result;
+            }
+            result.success = true;
+        } catch (const std::exception& e) {
+            result.success = false;
+            result.error_message = e.what();
+        }
+        
+        auto end_time = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+        result.query_time_ms = duration.count() / 1000.0;
+        return result;
+    }
+    
+    std::lock_guard<std::mutex> lock(mutex_);
+    
     if (!index_exists(index_name)) {
         result.success = false;
         result.error_message = "Index not found: " + index_name;
@@ -244,50 +275,10 @@ IndexLookupResult IndexManager::lookup(const std::string& index_name, const Inde
         IndexType type = get_index_type(index_name);
         
         switch (type) {
-            case IndexType::SECONDARY: {
-                auto& index = secondary_indexes_[index_name];
-                switch (query.type) {
-                    case QueryType::EXACT_MATCH:
-                        result.keys = index->exact_lookup(query.value);
-                        break;
-                    case QueryType::RANGE_QUERY:
-                        result.keys = index->range_lookup(query.range_start, query.range_end);
-                        break;
-                    case QueryType::PREFIX_MATCH:
-                        result.keys = index->prefix_lookup(query.value);
-                        break;
-                    default:
-                        result.success = false;
-                        result.error_message = "Unsupported query type for secondary index";
-                        return result;
-                }
-                break;
-            }
-            
-            case IndexType::COMPOSITE: {
-                auto& index = composite_indexes_[index_name];
-                switch (query.type) {
-                    case QueryType::EXACT_MATCH:
-                        result.keys = index->exact_lookup(query.terms);
-                        break;
-                    case QueryType::PREFIX_MATCH:
-                        result.keys = index->prefix_lookup(query.terms);
-                        break;
-                    case QueryType::RANGE_QUERY:
-                        // 需要两个terms向量作为范围
-                        if (query.terms.size() >= 2) {
-                            std::vector<std::string> start_terms(query.terms.begin(), query.terms.begin() + query.terms.size()/2);
-                            std::vector<std::string> end_terms(query.terms.begin() + query.terms.size()/2, query.terms.end());
-                            result.keys = index->range_lookup(start_terms, end_terms);
-                        }
-                        break;
-                    default:
-                        result.success = false;
-                        result.error_message = "Unsupported query type for composite index";
-                        return result;
-                }
+            case IndexType::SECONDARY:
+            case IndexType::COMPOSITE:
+                // 持久化索引已在上面处理
                 break;
-            }
             
             case IndexType::FULLTEXT: {
                 auto& index = fulltext_indexes_[index_name];
@@ -419,7 +410,7 @@ std::string IndexManager::choose_best_index(const std::vector<std::string>& cand
     double best_selectivity = 0.0;
     
     for (const std::string& candidate : candidates) {
-        IndexStats stats = get_index_stats(candidate);
+        IndexStats stats = get_index_stats_locked(candidate);
         if (stats.selectivity > best_selectivity) {
             best_selectivity = stats.selectivity;
             best_index = candidate;
@@ -428,41 +419,64 @@ std::string IndexManager::choose_best_index(const std::vector<std::string>& cand
     
     return best_index;
 }
-void IndexManager::update_indexes(const std::string& key, const std::string& old_value, const std::string& new_value) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    
-    // 更新二级索引
-    for (auto& pair : secondary_indexes_) {
-        SecondaryIndex* index = pair.second.get();
-        
-        if (index->get_field() == "key") {
-            // key字段不会改变，无需更新
-            continue;
-        } else if (index->get_field() == "value") {
-            index->update(old_value, new_value, key);
+bool IndexManager::append_index_entries(const std::string& key, const std::string& value, WriteBatch& batch) {
+    std::vector<std::shared_ptr<PersistentIndex>> indexes;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (persistent_indexes_.empty() || PersistentIndex::is_internal_key(key)) {
+            return true;
+        }
+        for (const auto& pair : persistent_indexes_) {
+            indexes.push_back(pair.second);
         }
     }
     
-    // 更新复合索引
-    for (auto& pair : composite_indexes_) {
-        CompositeIndex* index = pair.second.get();
-        
-        std::vector<std::string> old_values, new_values;
-        for (const std::string& field : index->get_fields()) {
-            if (field == "key") {
-                old_values.push_back(key);
-                new_values.push_back(key);
-            } else if (field == "value") {
-                old_values.push_back(old_value);
-                new_values.push_back(new_value);
-            }
-        }
-        
-        if (old_values.size() == index->get_field_count()) {
-            index->update(old_values, new_values, key);
+    // 唯一索引的冲突检查要做前缀扫描，放在锁外
+    WriteBatch entries;
+    for (const auto& index : indexes) {
+        if (!index->append_entry(key, value, entries)) {
+            std::cerr << "Unique constraint violation in index " << index->get_name()
+                      << " for key: " << key << std::endl;
+            return false;
         }
     }
     
+    for (const auto& op : entries.ops()) {
+        batch.put(op.key, op.value);
+    }
+    return true;
+}
+
+bool IndexManager::is_stale_index_entry(const std::string& entry_key) {
+    std::string name, value, pk;
+    if (!PersistentIndex::decode_entry_key(entry_key, name, value, pk)) {
+        return false;
+    }
+    
+    auto index = find_persistent_index(name);
+    if (!index) {
+        return true;  // 索引已被删除
+    }
+    return index->is_stale(value, pk);
+}
+
+bool IndexManager::has_memory_indexes() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !fulltext_indexes_.empty() || !inverted_indexes_.empty();
+}
+
+std::shared_ptr<PersistentIndex> IndexManager::find_persistent_index(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = persistent_indexes_.find(name);
+    if (it == persistent_indexes_.end()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+void IndexManager::update_indexes(const std::string& key, const std::string& old_value, const std::string& new_value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
     // 更新全文索引
     for (auto& pair : fulltext_indexes_) {
         FullTextIndex* index = pair.second.get();
@@ -480,40 +494,13 @@ void IndexManager::update_indexes(const std::string& key, const std::string& old
             index->update_document(key, old_value, new_value);
         }
     }
+    
+    maybe_refresh_memory_charge_locked();
 }
 
 void IndexManager::remove_from_indexes(const std::string& key, const std::string& value) {
     std::lock_guard<std::mutex> lock(mutex_);
     
-    // 从二级索引中移除
-    for (auto& pair : secondary_indexes_) {
-        SecondaryIndex* index = pair.second.get();
-        
-        if (index->get_field() == "key") {
-            index->remove(key, key);
-        } else if (index->get_field() == "value") {
-            index->remove(value, key);
-        }
-    }
-    
-    // 从复合索引中移除
-    for (auto& pair : composite_indexes_) {
-        CompositeIndex* index = pair.second.get();
-        
-        std::vector<std::string> values;
-        for (const std::string& field : index->get_fields()) {
-            if (field == "key") {
-                values.push_back(key);
-            } else if (field == "value") {
-                values.push_back(value);
-            }
-        }
-        
-        if (values.size() == index->get_field_count()) {
-            index->remove(values, key);
-        }
-    }
-    
     // 从全文索引中移除
     for (auto& pair : fulltext_indexes_) {
         FullTextIndex* index = pair.second.get();
@@ -525,40 +512,13 @@ void IndexManager::remove_from_indexes(const std::string& key, const std::string
         InvertedIndex* index = pair.second.get();
         index->remove_document(key);
     }
+    
+    maybe_refresh_memory_charge_locked();
 }
 
 void IndexManager::add_to_indexes(const std::string& key, const std::string& value) {
     std::lock_guard<std::mutex> lock(mutex_);
     
-    // 添加到二级索引
-    for (auto& pair : secondary_indexes_) {
-        SecondaryIndex* index = pair.second.get();
-        
-        if (index->get_field() == "key") {
-            index->insert(key, key);
-        } else if (index->get_field() == "value") {
-            index->insert(value, key);
-        }
-    }
-    
-    // 添加到复合索引
-    for (auto& pair : composite_indexes_) {
-        CompositeIndex* index = pair.second.get();
-        
-        std::vector<std::string> values;
-        for (const std::string& field : index->get_fields()) {
-            if (field == "key") {
-                values.push_back(key);
-            } else if (field == "value") {
-                values.push_back(value);
-            }
-        }
-        
-        if (values.size() == index->get_field_count()) {
-            index->insert(values, key);
-        }
-    }
-    
     // 添加到全文索引
     for (auto& pair : fulltext_indexes_) {
         FullTextIndex* index = pair.second.get();
@@ -580,23 +540,36 @@ void IndexManager::add_to_indexes(const std::string& key, const std::string& val
             index->add_document(key, value);
         }
     }
+    
+    maybe_refresh_memory_charge_locked();
 }
 
 void IndexManager::rebuild_index(const std::string& name) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    IndexMetadata metadata;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        
+        if (!index_exists(name)) {
+            return;
+        }
+        metadata = index_metadata_[name];
+    }
     
-    if (!index_exists(name)) {
+    // 持久化索引：重新扫描补建即可，过期条目由查询回表和 compaction 处理
+    if (auto index = find_persistent_index(name)) {
+        try {
+            index->backfill();
+        } catch (const std::exception& e) {
+            std::cerr << "Failed to rebuild index " << name << ": " << e.what() << std::endl;
+        }
         return;
     }
     
-    IndexType type = get_index_type(name);
-    IndexMetadata metadata = index_metadata_[name];
-    
     // 删除旧索引
     drop_index(name);
     
     // 重新创建索引
-    switch (type) {
+    switch (metadata.type) {
         case IndexType::SECONDARY:
             create_secondary_index(name, metadata.fields[0], metadata.is_unique);
             break;
@@ -629,7 +602,10 @@ void IndexManager::rebuild_all_indexes() {
 
 IndexStats IndexManager::get_index_stats(const std::string& name) {
     std::lock_guard<std::mutex> lock(mutex_);
-    
+    return get_index_stats_locked(name);
+}
+
+IndexStats IndexManager::get_index_stats_locked(const std::string& name) {
     IndexStats stats;
     
     if (!index_exists(name)) {
@@ -639,20 +615,9 @@ IndexStats IndexManager::get_index_stats(const std::string& name) {
     IndexType type = get_index_type(name);
     
     switch (type) {
-        case IndexType::SECONDARY: {
-            auto& index = secondary_indexes_[name];
-            stats.total_entries = index->size();
-            stats.unique_values = index->unique_values();
-            stats.selectivity = index->selectivity();
-            stats.memory_bytes = index->memory_usage();
-            break;
-        }
+        case IndexType::SECONDARY:
         case IndexType::COMPOSITE: {
-            auto& index = composite_indexes_[name];
-            stats.total_entries = index->size();
-            stats.unique_values = index->unique_combinations();
-            stats.selectivity = index->selectivity();
-            stats.memory_bytes = index->memory_usage();
+            stats = persistent_indexes_[name]->stats();
             break;
         }
         case IndexType::FULLTEXT: {
@@ -704,11 +669,127 @@ IndexType IndexManager::get_index_type(const std::string& name) {
 }
 
 void IndexManager::update_index_stats(const std::string& name) {
-    IndexStats stats = get_index_stats(name);
+    IndexStats stats = get_index_stats_locked(name);
     
     auto it = index_metadata_.find(name);
     if (it != index_metadata_.end()) {
         it->second.memory_usage = stats.memory_bytes;
         // disk_usage 可以在序列化时计算
     }
-}
\ No newline at end of file
+    refresh_memory_charge_locked();
+}
+
+void IndexManager::set_memory_budget(MemoryBudget* budget) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (budget_) {
+        budget_->release(MemoryBudget::Component::INDEX, charged_bytes_);
+    }
+    budget_ = budget;
+    charged_bytes_ = 0;
+    refresh_memory_charge_locked();
+}
+
+size_t IndexManager::memory_usage() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return memory_usage_locked();
+}
+
+size_t IndexManager::memory_usage_locked() const {
+    size_t usage = 0;
+    for (const auto& pair : fulltext_indexes_) {
+        usage += pair.second->memory_usage();
+    }
+    for (const auto& pair : inverted_indexes_) {
+        usage += pair.second->memory_usage();
+    }
+    return usage;
+}
+
+void IndexManager::refresh_memory_charge_locked() {
+    updates_since_refresh_ = 0;
+    if (!budget_) {
+        return;
+    }
+    size_t usage = memory_usage_locked();
+    if (usage > charged_bytes_) {
+        budget_->charge(MemoryBudget::Component::INDEX, usage - charged_bytes_);
+    } else {
+        budget_->release(MemoryBudget::Component::INDEX, charged_bytes_ - usage);
+    }
+    charged_bytes_ = usage;
+}
+
+void IndexManager::maybe_refresh_memory_charge_locked() {
+    if (budget_ && ++updates_since_refresh_ >= MEMORY_REFRESH_INTERVAL) {
+        refresh_memory_charge_locked();
+    }
+}
+bool IndexManager::save_indexes_to_disk() {
+    // 持久化索引的条目本身就在 LSM 中，这里只需写入全部索引的元数据
+    WriteBatch batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& pair : index_metadata_) {
+            batch.put(PersistentIndex::meta_key(pair.first),
+                      PersistentIndex::serialize_metadata(pair.second));
+        }
+    }
+    
+    if (batch.empty()) {
+        return true;
+    }
+    return db_.write(batch);
+}
+
+bool IndexManager::load_indexes_from_disk() {
+    std::vector<IndexMetadata> loaded;
+    
+    {
+        const std::string prefix = PersistentIndex::META_PREFIX;
+        auto snapshot = db_.get_snapshot();
+        auto iter = db_.new_prefix_iterator(snapshot, prefix);
+        
+        for (; iter->valid(); iter->next()) {
+            std::string key = iter->key();
+            if (key.compare(0, prefix.size(), prefix) != 0) {
+                break;
+            }
+            
+            IndexMetadata metadata;
+            std::string name = PersistentIndex::unescape(key.substr(prefix.size()));
+            if (PersistentIndex::deserialize_metadata(name, iter->value(), metadata)) {
+                loaded.push_back(metadata);
+            } else {
+                std::cerr << "Failed to load index metadata: " << key << std::endl;
+            }
+        }
+        
+        db_.release_snapshot(snapshot);
+    }
+    
+    for (const IndexMetadata& metadata : loaded) {
+        switch (metadata.type) {
+            case IndexType::SECONDARY:
+            case IndexType::COMPOSITE: {
+                // 条目已随 LSM 恢复，只需重新挂载
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!index_exists(metadata.name)) {
+                    persistent_indexes_[metadata.name] = std::make_shared<PersistentIndex>(db_, metadata);
+                    index_metadata_[metadata.name] = metadata;
+                }
+                break;
+            }
+            case IndexType::FULLTEXT:
+                create_fulltext_index(metadata.name, metadata.fields[0]);
+                break;
+            case IndexType::INVERTED:
+                create_inverted_index(metadata.name, metadata.fields[0]);
+                break;
+        }
+    }
+    
+    if (!loaded.empty()) {
+        std::cout << "[IndexManager] 从 LSM 恢复 " << loaded.size() << " 个索引定义\n";
+    }
+    return true;
+}
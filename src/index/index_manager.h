@@ -4,11 +4,14 @@
 #include "composite_index.h"
 #include "fulltext_index.h"
 #include "inverted_index.h"
+#include "persistent_index.h"
 #include <memory>
 #include <unordered_map>
 #include <mutex>
 
 class KVDB;
+class WriteBatch;
+class MemoryBudget;
 
 class IndexManager {
 public:
@@ -31,7 +34,15 @@ public:
     std::vector<std::string> get_applicable_indexes(const std::string& field, QueryType type);
     std::string choose_best_index(const std::vector<std::string>& candidates, const IndexQuery& query);
     
-    // 索引维护
+    // 持久化索引维护（SECONDARY / COMPOSITE 存放在 LSM 中）
+    // 把 key 的索引条目追加到与主记录相同的 batch；违反唯一约束时返回 false
+    bool append_index_entries(const std::string& key, const std::string& value, WriteBatch& batch);
+    // compaction 调用：条目所属索引已删除，或主记录已不再匹配时返回 true
+    bool is_stale_index_entry(const std::string& entry_key);
+    // 是否存在需要旧值才能维护的内存索引（FULLTEXT / INVERTED）
+    bool has_memory_indexes();
+    
+    // 内存索引维护
     void update_indexes(const std::string& key, const std::string& old_value, const std::string& new_value);
     void remove_from_indexes(const std::string& key, const std::string& value);
     void add_to_indexes(const std::string& key, const std::string& value);
@@ -48,13 +59,22 @@ public:
     bool save_indexes_to_disk();
     bool load_indexes_from_disk();
     
+    // 内存索引（FULLTEXT / INVERTED）向统一内存预算记账；持久化索引的条目在 LSM 中，随 MemTable 记账
+    void set_memory_budget(MemoryBudget* budget);
+    size_t memory_usage();
+    
 private:
     KVDB& db_;
     std::mutex mutex_;
     
+    // 统计内存索引用量需要遍历全部词条，写路径上每 MEMORY_REFRESH_INTERVAL 次更新才重新核算一次
+    static constexpr size_t MEMORY_REFRESH_INTERVAL = 256;
+    MemoryBudget* budget_ = nullptr;
+    size_t charged_bytes_ = 0;
+    size_t updates_since_refresh_ = 0;
+    
     // 索引存储
-    std::unordered_map<std::string, std::unique_ptr<SecondaryIndex>> secondary_indexes_;
-    std::unordered_map<std::string, std::unique_ptr<CompositeIndex>> composite_indexes_;
+    std::unordered_map<std::string, std::shared_ptr<PersistentIndex>> persistent_indexes_;
     std::unordered_map<std::string, std::unique_ptr<FullTextIndex>> fulltext_indexes_;
     std::unordered_map<std::string, std::unique_ptr<InvertedIndex>> inverted_indexes_;
     
@@ -63,10 +83,12 @@ private:
     
     // 辅助方法
     bool index_exists(const std::string& name);
+    bool create_persistent_index(const IndexMetadata& metadata);
+    std::shared_ptr<PersistentIndex> find_persistent_index(const std::string& name);
+    IndexStats get_index_stats_locked(const std::string& name);
     IndexType get_index_type(const std::string& name);
     void update_index_stats(const std::string& name);
-    
-    // 序列化
-    void serialize_metadata(std::ostream& out);
-    void deserialize_metadata(std::istream& in);
+    size_t memory_usage_locked() const;
+    void refresh_memory_charge_locked();
+    void maybe_refresh_memory_charge_locked();
 };
\ No newline at end of file
@@ -7,127 +7,166 @@
 #include <shared_mutex>
 
 InvertedIndex::InvertedIndex(const std::string& name, const std::string& field)
-    : name_(name), field_(field), total_documents_(0), total_postings_(0), stats_dirty_(true) {
+    : name_(name), field_(field), total_document_length_(0),
+      total_documents_(0), total_postings_(0), stats_dirty_(true) {
 }
 
 InvertedIndex::~InvertedIndex() = default;
 
 void InvertedIndex::add_document(const std::string& document_id, const std::string& text) {
     std::unique_lock<std::shared_mutex> lock(mutex_);
-    
+
     // 如果文档已存在，先移除（内部调用，不加锁）
     remove_document_internal(document_id);
-    
-    // 分词并获取位置信息
-    std::vector<uint32_t> positions;
-    std::vector<std::string> terms = tokenize_with_positions(text, positions);
-    
-    if (terms.empty()) {
+
+    // 分词并按词条收集位置（词频即位置个数）
+    TermPositions term_positions;
+    uint32_t term_count = collect_term_positions(text, term_positions);
+
+    if (term_count == 0) {
         return;
     }
-    
-    // 统计词频
-    std::map<std::string, uint32_t> term_frequencies;
-    std::map<std::string, std::vector<uint32_t>> term_positions;
-    
-    for (size_t i = 0; i < terms.size(); ++i) {
-        const std::string& term = terms[i];
-        term_frequencies[term]++;
-        term_positions[term].push_back(positions[i]);
-    }
-    
-    // 更新倒排索引
-    for (const auto& pair : term_frequencies) {
-        const std::string& term = pair.first;
-        uint32_t frequency = pair.second;
-        
-        // 获取或创建倒排列表
-        if (index_.find(term) == index_.end()) {
-            index_[term] = std::make_unique<PostingList>(term);
-        }
-        
-        PostingList* posting_list = index_[term].get();
-        
-        // 创建文档词条
-        DocumentTerm doc_term(document_id);
-        doc_term.frequency = frequency;
-        
-        // 添加位置信息
-        for (uint32_t pos : term_positions[term]) {
-            doc_term.positions.emplace_back(pos);
+
+    // 新文档总是分配最大的 ID，倒排列表只需追加
+    uint32_t doc = doc_ids_.assign(document_id);
+
+    for (const auto& pair : term_positions) {
+        auto& posting_list = index_[pair.first];
+        if (!posting_list) {
+            posting_list = std::make_unique<PostingList>(pair.first);
         }
-        
-        posting_list->documents.push_back(std::move(doc_term));
-        posting_list->document_frequency++;
+        posting_list->append(doc, static_cast<uint32_t>(pair.second.size()),
+                             pair.second.data(), pair.second.size(), term_count);
     }
-    
+
     // 记录文档长度
-    document_lengths_[document_id] = static_cast<uint32_t>(terms.size());
+    if (document_lengths_.size() <= doc) {
+        document_lengths_.resize(doc + 1, 0);
+    }
+    document_lengths_[doc] = term_count;
+    total_document_length_ += term_count;
     stats_dirty_ = true;
 }
+
 void InvertedIndex::remove_document(const std::string& document_id) {
     std::unique_lock<std::shared_mutex> lock(mutex_);
     remove_document_internal(document_id);
 }
 
 void InvertedIndex::remove_document_internal(const std::string& document_id) {
-    // 从所有倒排列表中移除该文档
+    uint32_t doc = doc_ids_.find(document_id);
+    if (doc == DocIdMap::INVALID_ID) {
+        return;
+    }
+
+    // 只打删除标记：倒排列表中的 posting 在查询时被过滤，在 compact 时被真正丢弃
+    total_document_length_ -= document_lengths_[doc];
+    document_lengths_[doc] = 0;
+    doc_ids_.remove(document_id);
+    stats_dirty_ = true;
+
+    maybe_compact();
+}
+
+void InvertedIndex::maybe_compact() {
+    size_t deleted = doc_ids_.deleted_count();
+    if (deleted < COMPACT_MIN_DELETED ||
+        deleted < COMPACT_DELETED_RATIO * (deleted + doc_ids_.live_count())) {
+        return;
+    }
+
+    std::vector<uint32_t> remap = doc_ids_.compact();
+
+    std::vector<uint32_t> lengths(doc_ids_.next_id(), 0);
+    for (uint32_t old_id = 0; old_id < remap.size(); ++old_id) {
+        if (remap[old_id] != DocIdMap::INVALID_ID) {
+            lengths[remap[old_id]] = document_lengths_[old_id];
+        }
+    }
+
     for (auto it = index_.begin(); it != index_.end();) {
-        PostingList* posting_list = it->second.get();
-        
-        // 查找并移除文档
-        auto doc_it = std::find_if(posting_list->documents.begin(), 
-                                  posting_list->documents.end(),
-                                  [&document_id](const DocumentTerm& doc_term) {
-                                      return doc_term.document_id == document_id;
-                                  });
-        
-        if (doc_it != posting_list->documents.end()) {
-            posting_list->documents.erase(doc_it);
-            posting_list->document_frequency--;
-            
-            // 如果倒排列表为空，删除该词条
-            if (posting_list->documents.empty()) {
-                it = index_.erase(it);
-                continue;
-            }
+        auto rebuilt = std::make_unique<PostingList>(it->second->remap(remap, lengths));
+        if (rebuilt->empty()) {
+            it = index_.erase(it);
+        } else {
+            it->second = std::move(rebuilt);
+            ++it;
         }
-        
-        ++it;
     }
-    
-    // 移除文档长度记录
-    document_lengths_.erase(document_id);
+    document_lengths_ = std::move(lengths);
     stats_dirty_ = true;
 }
 
-void InvertedIndex::update_document(const std::string& document_id, 
-                                   const std::string& old_text, 
+void InvertedIndex::update_document(const std::string& document_id,
+                                   const std::string& old_text,
                                    const std::string& new_text) {
     if (old_text == new_text) {
         return;
     }
-    
+
     // 重新添加文档
     add_document(document_id, new_text);
 }
 
+std::vector<PostingIterator> InvertedIndex::open_postings(const std::vector<std::string>& terms,
+                                                          bool require_all) const {
+    std::vector<PostingIterator> iters;
+    iters.reserve(terms.size());
+
+    for (const std::string& term : terms) {
+        std::string normalized_term = tokenizer_.normalize(term);
+        auto it = index_.find(normalized_term);
+        if (it == index_.end()) {
+            if (require_all) {
+                return {}; // 如果任何词不存在，返回空结果
+            }
+            continue;
+        }
+        iters.emplace_back(it->second.get());
+    }
+
+    return iters;
+}
+
+std::vector<std::string> InvertedIndex::to_document_ids(const std::vector<uint32_t>& ids,
+                                                        bool sort_by_name) const {
+    std::vector<std::string> result;
+    result.reserve(ids.size());
+    for (uint32_t id : ids) {
+        result.push_back(doc_ids_.name(id));
+    }
+    if (sort_by_name) {
+        std::sort(result.begin(), result.end());
+    }
+    return result;
+}
+
+std::vector<uint32_t> InvertedIndex::intersect_terms(const std::vector<std::string>& terms) const {
+    std::vector<uint32_t> ids;
+    std::vector<PostingIterator> iters = open_postings(terms, true);
+
+    posting::intersect(iters,
+                       [this](uint32_t doc) { return doc_ids_.is_live(doc); },
+                       [&ids](uint32_t doc) { ids.push_back(doc); });
+    return ids;
+}
+
 std::vector<std::string> InvertedIndex::search_term(const std::string& term) {
     std::shared_lock<std::shared_mutex> lock(mutex_);
-    
+
     std::string normalized_term = tokenizer_.normalize(term);
     auto it = index_.find(normalized_term);
     if (it == index_.end()) {
         return {};
     }
-    
+
     std::vector<std::string> result;
-    const PostingList* posting_list = it->second.get();
-    
-    for (const DocumentTerm& doc_term : posting_list->documents) {
-        result.push_back(doc_term.document_id);
+    for (PostingIterator iter(it->second.get()); iter.valid(); iter.next()) {
+        if (doc_ids_.is_live(iter.doc())) {
+            result.push_back(doc_ids_.name(iter.doc()));
+        }
     }
-    
+
     return result;
 }
 
@@ -135,75 +174,51 @@ std::vector<std::string> InvertedIndex::search_terms_and(const std::vector<std::
     if (terms.empty()) {
         return {};
     }
-    
+
     std::shared_lock<std::shared_mutex> lock(mutex_);
-    
-    std::vector<std::vector<std::string>> document_lists;
-    
-    for (const std::string& term : terms) {
-        std::string normalized_term = tokenizer_.normalize(term);
-        auto it = index_.find(normalized_term);
-        if (it == index_.end()) {
-            return {}; // 如果任何词不存在，返回空结果
-        }
-        
-        std::vector<std::string> doc_list;
-        const PostingList* posting_list = it->second.get();
-        
-        for (const DocumentTerm& doc_term : posting_list->documents) {
-            doc_list.push_back(doc_term.document_id);
-        }
-        
-        document_lists.push_back(std::move(doc_list));
-    }
-    
-    return intersect_document_lists(document_lists);
+    return to_document_ids(intersect_terms(terms), true);
 }
 
 std::vector<std::string> InvertedIndex::search_terms_or(const std::vector<std::string>& terms) {
     if (terms.empty()) {
         return {};
     }
-    
+
     std::shared_lock<std::shared_mutex> lock(mutex_);
-    
-    std::vector<std::vector<std::string>> document_lists;
-    
-    for (const std::string& term : terms) {
-        std::string normalized_term = tokenizer_.normalize(term);
-        auto it = index_.find(normalized_term);
-        if (it != index_.end()) {
-            std::vector<std::string> doc_list;
-            const PostingList* posting_list = it->second.get();
-            
-            for (const DocumentTerm& doc_term : posting_list->documents) {
-                doc_list.push_back(doc_term.document_id);
-            }
-            
-            document_lists.push_back(std::move(doc_list));
-        }
-    }
-    
-    return union_document_lists(document_lists);
+
+    std::vector<PostingIterator> iters = open_postings(terms, false);
+    std::vector<uint32_t> ids;
+    posting::unite(iters,
+                   [this](uint32_t doc) { return doc_ids_.is_live(doc); },
+                   [&ids](uint32_t doc) { ids.push_back(doc); });
+
+    return to_document_ids(ids, true);
 }
+
 std::vector<std::string> InvertedIndex::phrase_search(const std::vector<std::string>& terms, uint32_t max_distance) {
     if (terms.empty()) {
         return {};
     }
-    
-    // 先进行AND搜索获取候选文档
-    std::vector<std::string> candidates = search_terms_and(terms);
-    
-    std::vector<std::string> result;
-    
-    // 检查每个候选文档是否满足短语条件
-    for (const std::string& doc_id : candidates) {
-        if (check_phrase_match(terms, doc_id, max_distance)) {
-            result.push_back(doc_id);
+
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+
+    // 先求交得到候选文档，只对候选文档解码位置流
+    std::vector<uint32_t> candidates = intersect_terms(terms);
+    if (candidates.empty()) {
+        return {};
+    }
+
+    // 按词序打开游标；候选文档递增，游标只需向前 advance
+    std::vector<PostingIterator> term_iters = open_postings(terms, true);
+
+    std::vector<uint32_t> matched;
+    for (uint32_t doc : candidates) {
+        if (check_phrase_match(term_iters, doc, max_distance)) {
+            matched.push_back(doc);
         }
     }
-    
-    return result;
+
+    return to_document_ids(matched, true);
 }
 
 std::vector<std::string> InvertedIndex::proximity_search(const std::vector<std::string>& terms, uint32_t max_distance) {
@@ -222,69 +237,68 @@ std::vector<InvertedIndex::SearchResult> InvertedIndex::ranked_search(const std:
     if (terms.empty()) {
         return {};
     }
-    
+
     std::shared_lock<std::shared_mutex> lock(mutex_);
-    
-    // 收集所有候选文档
-    std::set<std::string> candidate_docs;
+
+    // 每个查询词一个带 BM25 打分函数的游标；块内最大词频与最短文档长度给出块级上界
+    std::vector<posting::ScoredCursor> cursors;
+    std::vector<const std::string*> cursor_terms;
     for (const std::string& term : terms) {
-        std::string normalized_term = tokenizer_.normalize(term);
-        auto it = index_.find(normalized_term);
-        if (it != index_.end()) {
-            const PostingList* posting_list = it->second.get();
-            for (const DocumentTerm& doc_term : posting_list->documents) {
-                candidate_docs.insert(doc_term.document_id);
-            }
+        auto it = index_.find(tokenizer_.normalize(term));
+        if (it == index_.end()) {
+            continue;
         }
+        size_t df = it->second->size();
+        cursors.emplace_back(it->second.get(),
+            [this, df](uint32_t doc, uint32_t freq) {
+                return calculate_bm25_score(freq, document_lengths_[doc], df);
+            },
+            [this, df](uint32_t max_freq, uint32_t min_length) {
+                return calculate_bm25_score(max_freq, min_length, df);
+            });
+        cursor_terms.push_back(&term);
     }
-    
-    // 计算每个文档的得分
+
+    // Block-Max WAND 只完整打分可能进入前 limit 的文档，结果已按得分降序
+    auto top = posting::top_k(cursors, limit,
+                              [this](uint32_t doc) { return doc_ids_.is_live(doc); });
+
     std::vector<SearchResult> results;
-    for (const std::string& doc_id : candidate_docs) {
-        SearchResult result(doc_id);
-        result.score = calculate_document_score(terms, doc_id);
-        
-        if (result.score > 0) {
-            // 收集匹配的词条和位置
-            for (const std::string& term : terms) {
-                std::string normalized_term = tokenizer_.normalize(term);
-                auto it = index_.find(normalized_term);
-                if (it != index_.end()) {
-                    const PostingList* posting_list = it->second.get();
-                    
-                    for (const DocumentTerm& doc_term : posting_list->documents) {
-                        if (doc_term.document_id == doc_id) {
-                            result.matched_terms.push_back(term);
-                            result.match_positions.insert(result.match_positions.end(),
-                                                         doc_term.positions.begin(),
-                                                         doc_term.positions.end());
-                            break;
-                        }
-                    }
-                }
+    results.reserve(top.size());
+    for (const auto& entry : top) {
+        SearchResult result(doc_ids_.name(entry.first));
+        result.score = entry.second;
+        results.push_back(std::move(result));
+    }
+
+    // 只为入选文档补充匹配词条与位置：按文档 ID 递增访问，游标只需向前 advance
+    std::vector<size_t> order(top.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(),
+              [&top](size_t a, size_t b) { return top[a].first < top[b].first; });
+
+    for (size_t t = 0; t < cursors.size(); ++t) {
+        PostingIterator it(cursors[t].iter.list());
+        for (size_t i : order) {
+            it.advance(top[i].first);
+            if (!it.valid() || it.doc() != top[i].first) {
+                continue;
+            }
+            results[i].matched_terms.push_back(*cursor_terms[t]);
+            for (uint32_t pos : it.positions()) {
+                results[i].match_positions.emplace_back(pos);
             }
-            
-            results.push_back(result);
         }
     }
-    
-    // 按得分排序
-    std::sort(results.begin(), results.end(),
-              [](const SearchResult& a, const SearchResult& b) {
-                  return a.score > b.score;
-              });
-    
-    // 限制结果数量
-    if (limit > 0 && results.size() > limit) {
-        results.resize(limit);
-    }
-    
+
     return results;
 }
 
 const InvertedIndex::PostingList* InvertedIndex::get_posting_list(const std::string& term) const {
     std::shared_lock<std::shared_mutex> lock(mutex_);
-    
+
     std::string normalized_term = tokenizer_.normalize(term);
     auto it = index_.find(normalized_term);
     if (it != index_.end()) {
@@ -295,19 +309,19 @@ const InvertedIndex::PostingList* InvertedIndex::get_posting_list(const std::str
 
 std::vector<std::string> InvertedIndex::get_all_terms() const {
     std::shared_lock<std::shared_mutex> lock(mutex_);
-    
+
     std::vector<std::string> terms;
     terms.reserve(index_.size());
-    
+
     for (const auto& pair : index_) {
         terms.push_back(pair.first);
     }
-    
+
     return terms;
 }
 size_t InvertedIndex::document_count() const {
     std::shared_lock<std::shared_mutex> lock(mutex_);
-    return document_lengths_.size();
+    return doc_ids_.live_count();
 }
 
 size_t InvertedIndex::term_count() const {
@@ -325,50 +339,38 @@ size_t InvertedIndex::total_postings() const {
 
 double InvertedIndex::average_document_length() const {
     std::shared_lock<std::shared_mutex> lock(mutex_);
-    
-    if (document_lengths_.empty()) {
+
+    if (doc_ids_.live_count() == 0) {
         return 0.0;
     }
-    
-    uint64_t total_length = 0;
-    for (const auto& pair : document_lengths_) {
-        total_length += pair.second;
-    }
-    
-    return static_cast<double>(total_length) / document_lengths_.size();
+
+    return static_cast<double>(total_document_length_) / doc_ids_.live_count();
 }
 
 size_t InvertedIndex::memory_usage() const {
     std::shared_lock<std::shared_mutex> lock(mutex_);
-    
+
     size_t usage = sizeof(*this);
-    
+
     // 倒排索引
     for (const auto& pair : index_) {
         usage += pair.first.size();
-        usage += sizeof(PostingList);
-        
-        const PostingList* posting_list = pair.second.get();
-        for (const DocumentTerm& doc_term : posting_list->documents) {
-            usage += doc_term.document_id.size();
-            usage += sizeof(DocumentTerm);
-            usage += doc_term.positions.size() * sizeof(PositionInfo);
-        }
-    }
-    
-    // 文档长度
-    for (const auto& pair : document_lengths_) {
-        usage += pair.first.size();
-        usage += sizeof(uint32_t);
+        usage += pair.second->memory_usage();
     }
-    
+
+    // 文档 ID 映射与文档长度
+    usage += doc_ids_.memory_usage();
+    usage += document_lengths_.capacity() * sizeof(uint32_t);
+
     return usage;
 }
 
 void InvertedIndex::clear() {
     std::unique_lock<std::shared_mutex> lock(mutex_);
     index_.clear();
+    doc_ids_.clear();
     document_lengths_.clear();
+    total_document_length_ = 0;
     total_documents_ = 0;
     total_postings_ = 0;
     stats_dirty_ = true;
@@ -376,242 +378,176 @@ void InvertedIndex::clear() {
 
 void InvertedIndex::update_stats() const {
     if (!stats_dirty_) return;
-    
-    total_documents_ = document_lengths_.size();
+
+    total_documents_ = doc_ids_.live_count();
     total_postings_ = 0;
-    
+
+    // 包含尚未 compact 的已删除文档的 posting
     for (const auto& pair : index_) {
-        total_postings_ += pair.second->documents.size();
+        total_postings_ += pair.second->size();
     }
-    
-    stats_dirty_ = false;
-}
 
-std::vector<std::string> InvertedIndex::tokenize_with_positions(const std::string& text, 
-                                                               std::vector<uint32_t>& positions) {
-    std::vector<std::string> terms = tokenizer_.tokenize(text);
-    positions.clear();
-    positions.reserve(terms.size());
-    
-    // 简化的位置计算，实际应该基于原始文本位置
-    for (uint32_t i = 0; i < terms.size(); ++i) {
-        positions.push_back(i);
-    }
-    
-    return terms;
+    stats_dirty_ = false;
 }
 
-std::vector<std::string> InvertedIndex::intersect_document_lists(const std::vector<std::vector<std::string>>& lists) {
-    if (lists.empty()) {
-        return {};
-    }
-    
-    if (lists.size() == 1) {
-        return lists[0];
-    }
-    
-    std::set<std::string> result_set(lists[0].begin(), lists[0].end());
-    
-    for (size_t i = 1; i < lists.size(); ++i) {
-        std::set<std::string> current_set(lists[i].begin(), lists[i].end());
-        std::set<std::string> intersection;
-        
-        std::set_intersection(result_set.begin(), result_set.end(),
-                            current_set.begin(), current_set.end(),
-                            std::inserter(intersection, intersection.begin()));
-        
-        result_set = std::move(intersection);
-        
-        if (result_set.empty()) {
-            break;
+uint32_t InvertedIndex::collect_term_positions(const std::string& text,
+                                               TermPositions& term_positions) const {
+    // 简化的位置计算：词条序号，实际应该基于原始文本位置
+    uint32_t position = 0;
+    tokenizer_.for_each_token(text, [&](std::string_view term) {
+        auto it = term_positions.find(term);
+        if (it == term_positions.end()) {
+            it = term_positions.emplace(std::string(term), std::vector<uint32_t>()).first;
         }
-    }
-    
-    return std::vector<std::string>(result_set.begin(), result_set.end());
+        it->second.push_back(position++);
+    });
+    return position;
 }
 
-std::vector<std::string> InvertedIndex::union_document_lists(const std::vector<std::vector<std::string>>& lists) {
-    std::set<std::string> result_set;
-    
-    for (const auto& list : lists) {
-        result_set.insert(list.begin(), list.end());
-    }
-    
-    return std::vector<std::string>(result_set.begin(), result_set.end());
-}
-bool InvertedIndex::check_phrase_match(const std::vector<std::string>& terms, 
-                                       const std::string& document_id, 
-                                       uint32_t max_distance) {
-    if (terms.empty()) {
+bool InvertedIndex::check_phrase_match(std::vector<PostingIterator>& term_iters,
+                                       uint32_t doc,
+                                       uint32_t max_distance) const {
+    if (term_iters.empty()) {
         return false;
     }
-    
-    // 获取每个词在文档中的位置
-    std::vector<std::vector<uint32_t>> term_positions(terms.size());
-    
-    for (size_t i = 0; i < terms.size(); ++i) {
-        std::string normalized_term = tokenizer_.normalize(terms[i]);
-        auto it = index_.find(normalized_term);
-        if (it == index_.end()) {
+
+    // 获取每个词在文档中的位置（按需解码位置流）
+    std::vector<std::vector<uint32_t>> term_positions(term_iters.size());
+
+    for (size_t i = 0; i < term_iters.size(); ++i) {
+        term_iters[i].advance(doc);
+        if (!term_iters[i].valid() || term_iters[i].doc() != doc) {
             return false;
         }
-        
-        const PostingList* posting_list = it->second.get();
-        
-        // 查找文档
-        for (const DocumentTerm& doc_term : posting_list->documents) {
-            if (doc_term.document_id == document_id) {
-                for (const PositionInfo& pos_info : doc_term.positions) {
-                    term_positions[i].push_back(pos_info.position);
-                }
-                break;
-            }
-        }
-        
+        term_positions[i] = term_iters[i].positions();
         if (term_positions[i].empty()) {
             return false;
         }
     }
-    
+
     // 检查是否存在满足距离要求的位置组合
     return check_position_sequence(term_positions, max_distance);
 }
 
-double InvertedIndex::calculate_bm25_score(const std::string& term, const std::string& document_id) const {
-    auto term_it = index_.find(term);
-    if (term_it == index_.end()) {
+double InvertedIndex::calculate_bm25_score(uint32_t tf, uint32_t doc_length, size_t docs_with_term) const {
+    if (tf == 0 || doc_ids_.live_count() == 0) {
         return 0.0;
     }
-    
-    const PostingList* posting_list = term_it->second.get();
-    
-    // 查找文档中的词频
-    uint32_t tf = 0;
-    for (const DocumentTerm& doc_term : posting_list->documents) {
-        if (doc_term.document_id == document_id) {
-            tf = doc_term.frequency;
-            break;
-        }
-    }
-    
-    if (tf == 0) {
-        return 0.0;
-    }
-    
-    // 获取文档长度
-    auto doc_it = document_lengths_.find(document_id);
-    if (doc_it == document_lengths_.end()) {
-        return 0.0;
-    }
-    
-    uint32_t doc_length = doc_it->second;
-    double avg_doc_length = average_document_length();
-    
+
+    double avg_doc_length = static_cast<double>(total_document_length_) / doc_ids_.live_count();
+
     // 计算IDF
-    size_t total_docs = document_lengths_.size();
-    size_t docs_with_term = posting_list->document_frequency;
+    // 注意：docs_with_term 取倒排列表长度，包含尚未 compact 的已删除文档，是近似值
+    double total_docs = static_cast<double>(doc_ids_.live_count());
     double idf = std::log((total_docs - docs_with_term + 0.5) / (docs_with_term + 0.5));
-    
+
     // 计算BM25得分
     double tf_component = (tf * (K1 + 1)) / (tf + K1 * (1 - B + B * (doc_length / avg_doc_length)));
-    
-    return idf * tf_component;
-}
 
-double InvertedIndex::calculate_document_score(const std::vector<std::string>& terms, const std::string& document_id) const {
-    double score = 0.0;
-    
-    for (const std::string& term : terms) {
-        std::string normalized_term = tokenizer_.normalize(term);
-        score += calculate_bm25_score(normalized_term, document_id);
-    }
-    
-    return score;
+    return idf * tf_component;
 }
 
 // 序列化和反序列化方法
+// 格式保持不变（字符串文档 ID + 位置三元组），只写出未删除的文档；加载时重新分配整数 ID 并压缩
 void InvertedIndex::serialize(std::ostream& out) const {
     std::shared_lock<std::shared_mutex> lock(mutex_);
-    
+
     // 写入基本信息
     size_t name_len = name_.size();
     out.write(reinterpret_cast<const char*>(&name_len), sizeof(name_len));
     out.write(name_.c_str(), name_len);
-    
+
     size_t field_len = field_.size();
     out.write(reinterpret_cast<const char*>(&field_len), sizeof(field_len));
     out.write(field_.c_str(), field_len);
-    
+
     // 写入倒排索引
     size_t index_size = index_.size();
     out.write(reinterpret_cast<const char*>(&index_size), sizeof(index_size));
-    
+
     for (const auto& pair : index_) {
         const std::string& term = pair.first;
-        const PostingList* posting_list = pair.second.get();
-        
+
         // 写入词条
         size_t term_len = term.size();
         out.write(reinterpret_cast<const char*>(&term_len), sizeof(term_len));
         out.write(term.c_str(), term_len);
-        
+
+        // 先收集存活的 posting，文档频率需要写在列表之前
+        std::vector<uint32_t> docs, freqs;
+        std::vector<std::vector<uint32_t>> positions;
+        for (PostingIterator it(pair.second.get()); it.valid(); it.next()) {
+            if (doc_ids_.is_live(it.doc())) {
+                docs.push_back(it.doc());
+                freqs.push_back(it.freq());
+                positions.push_back(it.positions());
+            }
+        }
+
         // 写入文档频率
-        out.write(reinterpret_cast<const char*>(&posting_list->document_frequency), sizeof(posting_list->document_frequency));
-        
+        uint32_t document_frequency = static_cast<uint32_t>(docs.size());
+        out.write(reinterpret_cast<const char*>(&document_frequency), sizeof(document_frequency));
+
         // 写入文档列表
-        size_t doc_count = posting_list->documents.size();
+        size_t doc_count = docs.size();
         out.write(reinterpret_cast<const char*>(&doc_count), sizeof(doc_count));
-        
-        for (const DocumentTerm& doc_term : posting_list->documents) {
+
+        for (size_t i = 0; i < docs.size(); ++i) {
             // 写入文档ID
-            size_t doc_id_len = doc_term.document_id.size();
+            const std::string& document_id = doc_ids_.name(docs[i]);
+            size_t doc_id_len = document_id.size();
             out.write(reinterpret_cast<const char*>(&doc_id_len), sizeof(doc_id_len));
-            out.write(doc_term.document_id.c_str(), doc_id_len);
-            
+            out.write(document_id.c_str(), doc_id_len);
+
             // 写入词频
-            out.write(reinterpret_cast<const char*>(&doc_term.frequency), sizeof(doc_term.frequency));
-            
+            out.write(reinterpret_cast<const char*>(&freqs[i]), sizeof(freqs[i]));
+
             // 写入位置信息
-            size_t pos_count = doc_term.positions.size();
+            size_t pos_count = positions[i].size();
             out.write(reinterpret_cast<const char*>(&pos_count), sizeof(pos_count));
-            
-            for (const PositionInfo& pos_info : doc_term.positions) {
-                out.write(reinterpret_cast<const char*>(&pos_info.position), sizeof(pos_info.position));
-                out.write(reinterpret_cast<const char*>(&pos_info.sentence_id), sizeof(pos_info.sentence_id));
-                out.write(reinterpret_cast<const char*>(&pos_info.paragraph_id), sizeof(pos_info.paragraph_id));
+
+            const uint32_t zero = 0;
+            for (uint32_t pos : positions[i]) {
+                out.write(reinterpret_cast<const char*>(&pos), sizeof(pos));
+                out.write(reinterpret_cast<const char*>(&zero), sizeof(zero));  // sentence_id
+                out.write(reinterpret_cast<const char*>(&zero), sizeof(zero));  // paragraph_id
             }
         }
     }
-    
+
     // 写入文档长度信息
-    size_t doc_len_count = document_lengths_.size();
+    size_t doc_len_count = doc_ids_.live_count();
     out.write(reinterpret_cast<const char*>(&doc_len_count), sizeof(doc_len_count));
-    
-    for (const auto& pair : document_lengths_) {
-        size_t doc_id_len = pair.first.size();
+
+    for (uint32_t id = 0; id < doc_ids_.next_id(); ++id) {
+        if (!doc_ids_.is_live(id)) {
+            continue;
+        }
+        const std::string& document_id = doc_ids_.name(id);
+        size_t doc_id_len = document_id.size();
         out.write(reinterpret_cast<const char*>(&doc_id_len), sizeof(doc_id_len));
-        out.write(pair.first.c_str(), doc_id_len);
-        out.write(reinterpret_cast<const char*>(&pair.second), sizeof(pair.second));
+        out.write(document_id.c_str(), doc_id_len);
+        out.write(reinterpret_cast<const char*>(&document_lengths_[id]), sizeof(document_lengths_[id]));
     }
 }
 
 // 添加缺失的辅助方法
-bool InvertedIndex::check_position_sequence(const std::vector<std::vector<uint32_t>>& term_positions, 
+bool InvertedIndex::check_position_sequence(const std::vector<std::vector<uint32_t>>& term_positions,
                                            uint32_t max_distance) const {
     if (term_positions.empty()) {
         return false;
     }
-    
+
     // 简化实现：检查是否存在连续的位置序列
     // 实际实现应该更复杂，考虑所有可能的位置组合
-    
+
     for (uint32_t pos : term_positions[0]) {
         bool sequence_found = true;
         uint32_t last_pos = pos;
-        
+
         for (size_t i = 1; i < term_positions.size(); ++i) {
             bool found_next = false;
-            
+
             for (uint32_t next_pos : term_positions[i]) {
                 if (next_pos > last_pos && (next_pos - last_pos) <= max_distance + 1) {
                     last_pos = next_pos;
@@ -619,100 +555,140 @@ bool InvertedIndex::check_position_sequence(const std::vector<std::vector<uint32
                     break;
                 }
             }
-            
+
             if (!found_next) {
                 sequence_found = false;
                 break;
             }
         }
-        
+
         if (sequence_found) {
             return true;
         }
     }
-    
+
     return false;
 }
 void InvertedIndex::deserialize(std::istream& in) {
     std::unique_lock<std::shared_mutex> lock(mutex_);
-    
+
     // 读取基本信息
     size_t name_len;
     in.read(reinterpret_cast<char*>(&name_len), sizeof(name_len));
     name_.resize(name_len);
     in.read(&name_[0], name_len);
-    
+
     size_t field_len;
     in.read(reinterpret_cast<char*>(&field_len), sizeof(field_len));
     field_.resize(field_len);
     in.read(&field_[0], field_len);
-    
+
+    // 先读出全部 posting，文档 ID 要等读完文档长度后统一分配
+    struct RawPosting {
+        std::string document_id;
+        uint32_t frequency;
+        std::vector<uint32_t> positions;
+    };
+    std::vector<std::pair<std::string, std::vector<RawPosting>>> raw_index;
+
     // 读取倒排索引
-    index_.clear();
     size_t index_size;
     in.read(reinterpret_cast<char*>(&index_size), sizeof(index_size));
-    
+
     for (size_t i = 0; i < index_size; ++i) {
         // 读取词条
         size_t term_len;
         in.read(reinterpret_cast<char*>(&term_len), sizeof(term_len));
         std::string term(term_len, '\0');
         in.read(&term[0], term_len);
-        
-        auto posting_list = std::make_unique<PostingList>(term);
-        
+
         // 读取文档频率
-        in.read(reinterpret_cast<char*>(&posting_list->document_frequency), sizeof(posting_list->document_frequency));
-        
+        uint32_t document_frequency;
+        in.read(reinterpret_cast<char*>(&document_frequency), sizeof(document_frequency));
+
         // 读取文档列表
         size_t doc_count;
         in.read(reinterpret_cast<char*>(&doc_count), sizeof(doc_count));
-        
+
+        std::vector<RawPosting> postings;
         for (size_t j = 0; j < doc_count; ++j) {
+            RawPosting raw;
+
             // 读取文档ID
             size_t doc_id_len;
             in.read(reinterpret_cast<char*>(&doc_id_len), sizeof(doc_id_len));
-            std::string doc_id(doc_id_len, '\0');
-            in.read(&doc_id[0], doc_id_len);
-            
-            DocumentTerm doc_term(doc_id);
-            
+            raw.document_id.resize(doc_id_len);
+            in.read(&raw.document_id[0], doc_id_len);
+
             // 读取词频
-            in.read(reinterpret_cast<char*>(&doc_term.frequency), sizeof(doc_term.frequency));
-            
+            in.read(reinterpret_cast<char*>(&raw.frequency), sizeof(raw.frequency));
+
             // 读取位置信息
             size_t pos_count;
             in.read(reinterpret_cast<char*>(&pos_count), sizeof(pos_count));
-            
+
             for (size_t k = 0; k < pos_count; ++k) {
                 PositionInfo pos_info(0);
                 in.read(reinterpret_cast<char*>(&pos_info.position), sizeof(pos_info.position));
                 in.read(reinterpret_cast<char*>(&pos_info.sentence_id), sizeof(pos_info.sentence_id));
                 in.read(reinterpret_cast<char*>(&pos_info.paragraph_id), sizeof(pos_info.paragraph_id));
-                doc_term.positions.push_back(pos_info);
+                raw.positions.push_back(pos_info.position);
             }
-            
-            posting_list->documents.push_back(std::move(doc_term));
+
+            postings.push_back(std::move(raw));
         }
-        
-        index_[term] = std::move(posting_list);
+
+        raw_index.emplace_back(std::move(term), std::move(postings));
     }
-    
-    // 读取文档长度信息
+
+    // 读取文档长度信息并分配整数 ID
+    index_.clear();
+    doc_ids_.clear();
     document_lengths_.clear();
+    total_document_length_ = 0;
+
     size_t doc_len_count;
     in.read(reinterpret_cast<char*>(&doc_len_count), sizeof(doc_len_count));
-    
+
     for (size_t i = 0; i < doc_len_count; ++i) {
         size_t doc_id_len;
         in.read(reinterpret_cast<char*>(&doc_id_len), sizeof(doc_id_len));
         std::string doc_id(doc_id_len, '\0');
         in.read(&doc_id[0], doc_id_len);
-        
+
         uint32_t length;
         in.read(reinterpret_cast<char*>(&length), sizeof(length));
-        document_lengths_[doc_id] = length;
+
+        uint32_t id = doc_ids_.assign(doc_id);
+        document_lengths_.resize(id + 1, 0);
+        document_lengths_[id] = length;
+        total_document_length_ += length;
+    }
+
+    // 按整数 ID 排序后追加到压缩列表
+    for (auto& pair : raw_index) {
+        std::vector<std::pair<uint32_t, RawPosting*>> ordered;
+        for (RawPosting& raw : pair.second) {
+            uint32_t id = doc_ids_.find(raw.document_id);
+            if (id != DocIdMap::INVALID_ID) {
+                ordered.emplace_back(id, &raw);
+            }
+        }
+        if (ordered.empty()) {
+            continue;
+        }
+        std::sort(ordered.begin(), ordered.end(),
+                  [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        auto posting_list = std::make_unique<PostingList>(pair.first);
+        for (const auto& entry : ordered) {
+            const RawPosting& raw = *entry.second;
+            posting_list->append(entry.first, raw.frequency, raw.positions.data(), raw.positions.size(),
+                                 document_lengths_[entry.first]);
+        }
+        index_[pair.first] = std::move(posting_list);
     }
-    
+
+    stats_dirty_ = true;
     update_stats();
-}
\ No newline at end of file
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "index_types.h"
 #include "tokenizer.h"
+#include "posting_list.h"
 #include <map>
 #include <vector>
 #include <string>
@@ -19,23 +20,8 @@ public:
             : position(pos), sentence_id(sent), paragraph_id(para) {}
     };
     
-    // 文档中的词条信息
-    struct DocumentTerm {
-        std::string document_id;
-        uint32_t frequency;                    // 词频
-        std::vector<PositionInfo> positions;   // 位置列表
-        
-        DocumentTerm(const std::string& doc_id) : document_id(doc_id), frequency(0) {}
-    };
-    
-    // 倒排列表
-    struct PostingList {
-        std::string term;
-        uint32_t document_frequency;           // 文档频率
-        std::vector<DocumentTerm> documents;   // 文档列表
-        
-        PostingList(const std::string& t) : term(t), document_frequency(0) {}
-    };
+    // 倒排列表：整数文档 ID + 差分 varint 压缩块 + 跳表，位置单独成流
+    using PostingList = CompressedPostingList;
     
     explicit InvertedIndex(const std::string& name, const std::string& field);
     ~InvertedIndex();
@@ -104,8 +90,10 @@ private:
     // 倒排索引: term -> PostingList
     std::map<std::string, std::unique_ptr<PostingList>> index_;
     
-    // 文档长度信息: document_id -> term_count
-    std::map<std::string, uint32_t> document_lengths_;
+    // 文档 ID 映射与文档长度（按整数 ID 下标，已删除文档为 0）
+    DocIdMap doc_ids_;
+    std::vector<uint32_t> document_lengths_;
+    uint64_t total_document_length_;
     
     // 分词器
     Tokenizer tokenizer_;
@@ -113,6 +101,10 @@ private:
     // 读写锁
     mutable std::shared_mutex mutex_;
     
+    // 已删除文档超过该比例时重排文档 ID 并重建倒排列表
+    static constexpr double COMPACT_DELETED_RATIO = 0.5;
+    static constexpr size_t COMPACT_MIN_DELETED = 1024;
+    
     // 统计信息
     mutable size_t total_documents_;
     mutable size_t total_postings_;
@@ -120,22 +112,22 @@ private:
     
     // 辅助方法
     void update_stats() const;
-    std::vector<std::string> tokenize_with_positions(const std::string& text, 
-                                                    std::vector<uint32_t>& positions);
+    // 流式分词并按词条收集位置，返回词条总数；词条只在首次出现时分配一次字符串
+    using TermPositions = std::map<std::string, std::vector<uint32_t>, std::less<>>;
+    uint32_t collect_term_positions(const std::string& text, TermPositions& term_positions) const;
     
     // 内部方法（不加锁）
     void remove_document_internal(const std::string& document_id);
+    void maybe_compact();
     
     // 搜索辅助方法
-    std::vector<std::string> intersect_document_lists(const std::vector<std::vector<std::string>>& lists);
-    std::vector<std::string> union_document_lists(const std::vector<std::vector<std::string>>& lists);
-    bool check_phrase_match(const std::vector<std::string>& terms, 
-                           const std::string& document_id, 
-                           uint32_t max_distance);
+    std::vector<PostingIterator> open_postings(const std::vector<std::string>& terms, bool require_all) const;
+    std::vector<std::string> to_document_ids(const std::vector<uint32_t>& ids, bool sort_by_name) const;
+    std::vector<uint32_t> intersect_terms(const std::vector<std::string>& terms) const;
+    bool check_phrase_match(std::vector<PostingIterator>& term_iters, uint32_t doc, uint32_t max_distance) const;
     
     // 评分方法
-    double calculate_bm25_score(const std::string& term, const std::string& document_id) const;
-    double calculate_document_score(const std::vector<std::string>& terms, const std::string& document_id) const;
+    double calculate_bm25_score(uint32_t tf, uint32_t doc_length, size_t docs_with_term) const;
     
     // BM25 参数
     static constexpr double K1 = 1.2;
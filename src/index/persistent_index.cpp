@@ -0,0 +1,330 @@
+#include "persistent_index.h"
+#include "db/kv_db.h"
+#include "db/write_batch.h"
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+const char* ENTRY_VALUE = "1";
+constexpr size_t BACKFILL_BATCH_SIZE = 1000;
+
+bool needs_escape(unsigned char c) {
+    return c <= ' ' || c == '%' || c == '/' || c == 0x7F;
+}
+
+// 被转义的字节都 <= '/'；截掉第一个这类字节及其后的部分，
+// 得到的前缀转义后仍然保持原始字节序，可以安全地作为扫描边界
+std::string order_safe_prefix(const std::string& s) {
+    size_t i = 0;
+    while (i < s.size() && static_cast<unsigned char>(s[i]) > '/') {
+        ++i;
+    }
+    return s.substr(0, i);
+}
+
+// 字典序上大于所有以 prefix 开头的字符串的最小串
+std::string prefix_successor(std::string prefix) {
+    while (!prefix.empty()) {
+        unsigned char last = static_cast<unsigned char>(prefix.back());
+        if (last != 0xFF) {
+            prefix.back() = static_cast<char>(last + 1);
+            return prefix;
+        }
+        prefix.pop_back();
+    }
+    return prefix;  // 空串表示无上界
+}
+
+std::string extract_field(const std::string& field, const std::string& pk, const std::string& row) {
+    if (field == "key") {
+        return pk;
+    } else if (field == "value") {
+        return row;
+    }
+    // 对于其他字段，可以扩展解析逻辑
+    return "";
+}
+
+}  // namespace
+
+PersistentIndex::PersistentIndex(KVDB& db, const IndexMetadata& metadata)
+    : db_(db), metadata_(metadata) {
+}
+
+bool PersistentIndex::is_internal_key(const std::string& key) {
+    return key.compare(0, 4, ENTRY_PREFIX) == 0 || key.compare(0, 9, META_PREFIX) == 0;
+}
+
+std::string PersistentIndex::escape(const std::string& s) {
+    static const char* hex = "0123456789ABCDEF";
+    std::string out;
+    out.reserve(s.size());
+    for (char ch : s) {
+        unsigned char c = static_cast<unsigned char>(ch);
+        if (needs_escape(c)) {
+            out.push_back('%');
+            out.push_back(hex[c >> 4]);
+            out.push_back(hex[c & 0x0F]);
+        } else {
+            out.push_back(ch);
+        }
+    }
+    return out;
+}
+
+std::string PersistentIndex::unescape(const std::string& s) {
+    auto hex_value = [](char c) -> int {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        return -1;
+    };
+
+    std::string out;
+    out.reserve(s.size());
+    for (size_t i = 0; i < s.size(); ++i) {
+        if (s[i] == '%' && i + 2 < s.size() && hex_value(s[i + 1]) >= 0 && hex_value(s[i + 2]) >= 0) {
+            out.push_back(static_cast<char>(hex_value(s[i + 1]) * 16 + hex_value(s[i + 2])));
+            i += 2;
+        } else {
+            out.push_back(s[i]);
+        }
+    }
+    return out;
+}
+
+std::string PersistentIndex::entry_prefix(const std::string& name) {
+    return std::string(ENTRY_PREFIX) + escape(name) + "/";
+}
+
+std::string PersistentIndex::encode_entry_key(const std::string& name, const std::string& value,
+                                              const std::string& pk) {
+    return entry_prefix(name) + escape(value) + "/" + escape(pk);
+}
+
+bool PersistentIndex::decode_entry_key(const std::string& key, std::string& name,
+                                       std::string& value, std::string& pk) {
+    const size_t prefix_len = std::char_traits<char>::length(ENTRY_PREFIX);
+    if (key.compare(0, prefix_len, ENTRY_PREFIX) != 0) {
+        return false;
+    }
+
+    size_t name_end = key.find('/', prefix_len);
+    if (name_end == std::string::npos) {
+        return false;
+    }
+    size_t value_end = key.find('/', name_end + 1);
+    if (value_end == std::string::npos) {
+        return false;
+    }
+
+    name = unescape(key.substr(prefix_len, name_end - prefix_len));
+    value = unescape(key.substr(name_end + 1, value_end - name_end - 1));
+    pk = unescape(key.substr(value_end + 1));
+    return true;
+}
+
+std::string PersistentIndex::meta_key(const std::string& name) {
+    return std::string(META_PREFIX) + escape(name);
+}
+
+std::string PersistentIndex::serialize_metadata(const IndexMetadata& metadata) {
+    // 格式: <type>/<unique>/<field1>/<field2>...，字段名已转义，不含空白
+    std::ostringstream oss;
+    oss << static_cast<int>(metadata.type) << "/" << (metadata.is_unique ? 1 : 0);
+    for (const std::string& field : metadata.fields) {
+        oss << "/" << escape(field);
+    }
+    return oss.str();
+}
+
+bool PersistentIndex::deserialize_metadata(const std::string& name, const std::string& data,
+                                           IndexMetadata& metadata) {
+    std::vector<std::string> parts;
+    size_t start = 0;
+    while (true) {
+        size_t pos = data.find('/', start);
+        parts.push_back(data.substr(start, pos == std::string::npos ? std::string::npos : pos - start));
+        if (pos == std::string::npos) break;
+        start = pos + 1;
+    }
+
+    if (parts.size() < 3) {
+        return false;
+    }
+
+    try {
+        int type = std::stoi(parts[0]);
+        if (type < static_cast<int>(IndexType::SECONDARY) || type > static_cast<int>(IndexType::INVERTED)) {
+            return false;
+        }
+        std::vector<std::string> fields;
+        for (size_t i = 2; i < parts.size(); ++i) {
+            fields.push_back(unescape(parts[i]));
+        }
+        metadata = IndexMetadata(name, static_cast<IndexType>(type), fields, parts[1] == "1");
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+std::string PersistentIndex::indexed_value(const std::string& pk, const std::string& row) const {
+    std::string result;
+    for (size_t i = 0; i < metadata_.fields.size(); ++i) {
+        if (i > 0) {
+            result.push_back(FIELD_SEPARATOR);
+        }
+        result += extract_field(metadata_.fields[i], pk, row);
+    }
+    return result;
+}
+
+bool PersistentIndex::append_entry(const std::string& pk, const std::string& row, WriteBatch& batch) {
+    std::string value = indexed_value(pk, row);
+
+    if (metadata_.is_unique) {
+        for (const std::string& owner : exact_lookup(value)) {
+            if (owner != pk) {
+                return false;
+            }
+        }
+    }
+
+    batch.put(encode_entry_key(metadata_.name, value, pk), ENTRY_VALUE);
+    return true;
+}
+
+bool PersistentIndex::entry_matches_row(const std::string& value, const std::string& pk,
+                                        const Snapshot& snapshot) {
+    std::string row;
+    if (!db_.get(pk, snapshot, row)) {
+        return false;
+    }
+    return indexed_value(pk, row) == value;
+}
+
+bool PersistentIndex::is_stale(const std::string& value, const std::string& pk) {
+    std::string row;
+    if (!db_.get(pk, row)) {
+        return true;
+    }
+    return indexed_value(pk, row) != value;
+}
+
+template <typename Accept>
+std::vector<std::string> PersistentIndex::scan_entries(const std::string& lower, const std::string& upper,
+                                                       Accept accept) {
+    std::vector<std::string> result;
+
+    Snapshot snapshot = db_.get_snapshot();
+    ReadOptions options;
+    options.iterate_lower_bound = lower;
+    options.iterate_upper_bound = upper;
+
+    auto iter = db_.new_iterator(snapshot, options);
+    std::string name, value, pk;
+    for (iter->seek(lower); iter->valid(); iter->next()) {
+        if (!decode_entry_key(iter->key(), name, value, pk) || name != metadata_.name) {
+            continue;
+        }
+        if (accept(value) && entry_matches_row(value, pk, snapshot)) {
+            result.push_back(pk);
+        }
+    }
+
+    db_.release_snapshot(snapshot);
+    return result;
+}
+
+std::vector<std::string> PersistentIndex::exact_lookup(const std::string& value) {
+    std::string lower = entry_prefix(metadata_.name) + escape(value) + "/";
+    return scan_entries(lower, prefix_successor(lower),
+                        [&](const std::string& v) { return v == value; });
+}
+
+std::vector<std::string> PersistentIndex::prefix_lookup(const std::string& prefix) {
+    std::string lower = entry_prefix(metadata_.name) + escape(prefix);
+    return scan_entries(lower, prefix_successor(lower),
+                        [&](const std::string& v) { return v.compare(0, prefix.size(), prefix) == 0; });
+}
+
+std::vector<std::string> PersistentIndex::range_lookup(const std::string& start, const std::string& end) {
+    // 转义会打乱少数字节的相对顺序，边界只取保序的前缀，再按原始值精确过滤
+    const std::string prefix = entry_prefix(metadata_.name);
+    std::string lower = prefix + escape(order_safe_prefix(start));
+    std::string upper = prefix_successor(prefix + escape(order_safe_prefix(end)));
+    return scan_entries(lower, upper,
+                        [&](const std::string& v) { return v >= start && v <= end; });
+}
+
+size_t PersistentIndex::backfill() {
+    Snapshot snapshot = db_.get_snapshot();
+    auto iter = db_.new_iterator(snapshot);
+
+    WriteBatch batch;
+    std::set<std::string> seen_values;  // 仅唯一索引使用
+    size_t indexed = 0;
+
+    for (iter->seek_to_first(); iter->valid(); iter->next()) {
+        std::string key = iter->key();
+        if (is_internal_key(key)) {
+            continue;
+        }
+
+        std::string value = indexed_value(key, iter->value());
+        if (metadata_.is_unique && !seen_values.insert(value).second) {
+            db_.release_snapshot(snapshot);
+            throw std::runtime_error("Unique constraint violation for value: " + value);
+        }
+
+        batch.put(encode_entry_key(metadata_.name, value, key), ENTRY_VALUE);
+        indexed++;
+
+        if (batch.count() >= BACKFILL_BATCH_SIZE) {
+            db_.write(batch);
+            batch.clear();
+        }
+    }
+
+    if (!batch.empty()) {
+        db_.write(batch);
+    }
+
+    db_.release_snapshot(snapshot);
+    return indexed;
+}
+
+IndexStats PersistentIndex::stats() {
+    IndexStats stats;
+
+    const std::string prefix = entry_prefix(metadata_.name);
+    ReadOptions options;
+    options.iterate_lower_bound = prefix;
+    options.iterate_upper_bound = prefix_successor(prefix);
+
+    Snapshot snapshot = db_.get_snapshot();
+    auto iter = db_.new_iterator(snapshot, options);
+
+    // 条目按 value 有序，相邻比较即可统计不同值的个数（未回表，含尚未清理的过期条目）
+    std::string name, value, pk, last_value;
+    for (iter->seek(prefix); iter->valid(); iter->next()) {
+        Slice key = iter->key_slice();
+        if (!decode_entry_key(key.to_string(), name, value, pk)) {
+            continue;
+        }
+        if (stats.total_entries == 0 || value != last_value) {
+            stats.unique_values++;
+            last_value = value;
+        }
+        stats.total_entries++;
+        stats.disk_bytes += key.size() + iter->value_slice().size();
+    }
+    db_.release_snapshot(snapshot);
+
+    stats.selectivity = stats.total_entries > 0 ?
+        static_cast<double>(stats.unique_values) / stats.total_entries : 0.0;
+    return stats;
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include "index_types.h"
+#include <string>
+#include <vector>
+
+class KVDB;
+class WriteBatch;
+struct Snapshot;
+
+// 持久化二级索引：索引条目作为普通 key 存放在 LSM 中
+//   索引条目:  idx/<name>/<value>/<pk>  ->  "1"
+//   索引元数据: idx_meta/<name>         ->  序列化的 IndexMetadata
+// 条目与主记录在同一个 WriteBatch 中写入（同一条 WAL 记录、连续序列号），
+// 因此索引随 WAL/MANIFEST 一起恢复，不需要整体加载到内存。
+//
+// 写路径不做 read-before-write：更新/删除主记录时旧条目原样保留，
+// 查询时回表校验（主记录当前值必须仍然匹配），过期条目由 compaction 惰性清除。
+//
+// name/value/pk 中的 '%' '/' 以及空白和控制字符按 %XX 转义，保证分隔符唯一，
+// 也保证条目 key 不含 SSTable/WAL 文本格式使用的分隔符。
+class PersistentIndex {
+public:
+    static constexpr const char* ENTRY_PREFIX = "idx/";
+    static constexpr const char* META_PREFIX = "idx_meta/";
+    static constexpr char FIELD_SEPARATOR = '|';  // 与 CompositeIndex 的组合键格式一致
+
+    PersistentIndex(KVDB& db, const IndexMetadata& metadata);
+
+    const std::string& get_name() const { return metadata_.name; }
+    const IndexMetadata& get_metadata() const { return metadata_; }
+    bool is_unique() const { return metadata_.is_unique; }
+
+    // 写路径：把 (pk, row) 对应的索引条目追加到 batch
+    // 唯一索引且该值已被其他主键占用时返回 false，batch 保持不变
+    bool append_entry(const std::string& pk, const std::string& row, WriteBatch& batch);
+
+    // 查询：前缀扫描索引条目，回表过滤过期条目
+    std::vector<std::string> exact_lookup(const std::string& value);
+    std::vector<std::string> prefix_lookup(const std::string& prefix);
+    std::vector<std::string> range_lookup(const std::string& start, const std::string& end);
+
+    // 扫描现有数据补建索引条目（创建索引时调用）
+    size_t backfill();
+
+    // 判断条目在当前数据上是否已过期（主记录被删除或字段值已变化）
+    bool is_stale(const std::string& value, const std::string& pk);
+
+    IndexStats stats();
+
+    // 组合键：按 fields 抽取字段值，以 '|' 连接
+    std::string indexed_value(const std::string& pk, const std::string& row) const;
+
+    // 编解码
+    static bool is_internal_key(const std::string& key);
+    static std::string escape(const std::string& s);
+    static std::string unescape(const std::string& s);
+    static std::string entry_prefix(const std::string& name);
+    static std::string encode_entry_key(const std::string& name, const std::string& value,
+                                        const std::string& pk);
+    static bool decode_entry_key(const std::string& key, std::string& name,
+                                 std::string& value, std::string& pk);
+    static std::string meta_key(const std::string& name);
+    static std::string serialize_metadata(const IndexMetadata& metadata);
+    static bool deserialize_metadata(const std::string& name, const std::string& data,
+                                     IndexMetadata& metadata);
+
+private:
+    // 扫描 [lower, upper) 内的条目，value 满足 accept 且回表仍然匹配的 pk 收集到结果中
+    template <typename Accept>
+    std::vector<std::string> scan_entries(const std::string& lower, const std::string& upper,
+                                          Accept accept);
+    bool entry_matches_row(const std::string& value, const std::string& pk,
+                           const Snapshot& snapshot);
+
+    KVDB& db_;
+    IndexMetadata metadata_;
+};
@@ -0,0 +1,524 @@
+#include "posting_list.h"
+#include <algorithm>
+#include <queue>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace posting {
+
+void put_varint(std::vector<uint8_t>& out, uint32_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+uint32_t get_varint(const uint8_t*& p) {
+    uint32_t result = 0;
+    int shift = 0;
+    while (*p & 0x80) {
+        result |= static_cast<uint32_t>(*p++ & 0x7F) << shift;
+        shift += 7;
+    }
+    result |= static_cast<uint32_t>(*p++) << shift;
+    return result;
+}
+
+}  // namespace posting
+
+namespace {
+
+// 有序块内查找第一个 >= target 的下标
+// SSE2：一次比较 4 个 ID，小于 target 的通道必然是前缀，计数即可
+size_t block_lower_bound(const uint32_t* docs, size_t begin, size_t n, uint32_t target) {
+    size_t i = begin;
+#if defined(__SSE2__)
+    // SSE2 只有有符号比较，先翻转符号位得到无符号序
+    const __m128i sign = _mm_set1_epi32(static_cast<int>(0x80000000u));
+    const __m128i t = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(target)), sign);
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(docs + i));
+        __m128i lt = _mm_cmplt_epi32(_mm_xor_si128(v, sign), t);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(lt));
+        if (mask != 0xF) {
+            return i + __builtin_popcount(static_cast<unsigned>(mask));
+        }
+    }
+#endif
+    while (i < n && docs[i] < target) {
+        ++i;
+    }
+    return i;
+}
+
+void append_positions(std::vector<uint8_t>& out, const uint32_t* positions, size_t count) {
+    posting::put_varint(out, static_cast<uint32_t>(count));
+    uint32_t prev = 0;
+    for (size_t i = 0; i < count; ++i) {
+        posting::put_varint(out, positions[i] - prev);
+        prev = positions[i];
+    }
+}
+
+}  // namespace
+
+// ==================== DocIdMap ====================
+
+uint32_t DocIdMap::assign(const std::string& document_id) {
+    remove(document_id);
+
+    uint32_t id = static_cast<uint32_t>(names_.size());
+    names_.push_back(document_id);
+    live_.push_back(true);
+    ids_[document_id] = id;
+    live_count_++;
+    return id;
+}
+
+uint32_t DocIdMap::find(const std::string& document_id) const {
+    auto it = ids_.find(document_id);
+    return it == ids_.end() ? INVALID_ID : it->second;
+}
+
+bool DocIdMap::remove(const std::string& document_id) {
+    auto it = ids_.find(document_id);
+    if (it == ids_.end()) {
+        return false;
+    }
+    live_[it->second] = false;
+    names_[it->second].clear();
+    names_[it->second].shrink_to_fit();
+    ids_.erase(it);
+    live_count_--;
+    return true;
+}
+
+std::vector<uint32_t> DocIdMap::compact() {
+    std::vector<uint32_t> remap(names_.size(), INVALID_ID);
+    std::vector<std::string> names;
+    std::vector<bool> live;
+    names.reserve(live_count_);
+    live.reserve(live_count_);
+
+    for (uint32_t old_id = 0; old_id < names_.size(); ++old_id) {
+        if (!live_[old_id]) {
+            continue;
+        }
+        uint32_t new_id = static_cast<uint32_t>(names.size());
+        remap[old_id] = new_id;
+        ids_[names_[old_id]] = new_id;
+        names.push_back(std::move(names_[old_id]));
+        live.push_back(true);
+    }
+
+    names_ = std::move(names);
+    live_ = std::move(live);
+    return remap;
+}
+
+void DocIdMap::clear() {
+    ids_.clear();
+    names_.clear();
+    live_.clear();
+    live_count_ = 0;
+}
+
+size_t DocIdMap::memory_usage() const {
+    size_t usage = sizeof(*this) + live_.size() / 8;
+    for (const std::string& name : names_) {
+        // 名字在 names_ 与 ids_ 中各存一份
+        usage += 2 * name.size() + sizeof(std::string) + sizeof(uint32_t);
+    }
+    return usage;
+}
+
+// ==================== CompressedPostingList ====================
+
+CompressedPostingList::CompressedPostingList(const std::string& term) : term_(term) {
+}
+
+void CompressedPostingList::append(uint32_t doc, uint32_t freq,
+                                   const uint32_t* positions, size_t position_count,
+                                   uint32_t doc_length) {
+    tail_docs_.push_back(doc);
+    tail_freqs_.push_back(freq);
+    append_positions(tail_pos_bytes_, positions, position_count);
+    tail_max_freq_ = std::max(tail_max_freq_, freq);
+    tail_min_length_ = std::min(tail_min_length_, doc_length);
+
+    last_doc_ = doc;
+    max_freq_ = std::max(max_freq_, freq);
+    min_length_ = std::min(min_length_, doc_length);
+    count_++;
+
+    if (tail_docs_.size() == BLOCK_SIZE) {
+        seal_tail();
+    }
+}
+
+void CompressedPostingList::seal_tail() {
+    SkipEntry entry;
+    entry.last_doc = tail_docs_.back();
+    entry.doc_offset = static_cast<uint32_t>(doc_bytes_.size());
+    entry.freq_offset = static_cast<uint32_t>(freq_bytes_.size());
+    entry.pos_offset = static_cast<uint32_t>(pos_bytes_.size());
+    entry.count = static_cast<uint32_t>(tail_docs_.size());
+    entry.max_freq = tail_max_freq_;
+    entry.min_length = tail_min_length_;
+
+    // 块首相对上一块的最大 ID 做差分
+    uint32_t prev = skips_.empty() ? 0 : skips_.back().last_doc;
+    for (size_t i = 0; i < tail_docs_.size(); ++i) {
+        posting::put_varint(doc_bytes_, tail_docs_[i] - prev);
+        posting::put_varint(freq_bytes_, tail_freqs_[i]);
+        prev = tail_docs_[i];
+    }
+    pos_bytes_.insert(pos_bytes_.end(), tail_pos_bytes_.begin(), tail_pos_bytes_.end());
+    skips_.push_back(entry);
+
+    tail_docs_.clear();
+    tail_freqs_.clear();
+    tail_pos_bytes_.clear();
+    tail_max_freq_ = 0;
+    tail_min_length_ = UINT32_MAX;
+}
+
+CompressedPostingList CompressedPostingList::remap(const std::vector<uint32_t>& id_map,
+                                                  const std::vector<uint32_t>& doc_lengths) const {
+    CompressedPostingList result(term_);
+
+    // 旧 ID 递增、重新编号保持相对顺序，因此结果仍然有序
+    for (PostingIterator it(this); it.valid(); it.next()) {
+        uint32_t new_id = it.doc() < id_map.size() ? id_map[it.doc()] : DocIdMap::INVALID_ID;
+        if (new_id == DocIdMap::INVALID_ID) {
+            continue;
+        }
+        std::vector<uint32_t> positions = it.positions();
+        uint32_t length = new_id < doc_lengths.size() ? doc_lengths[new_id] : 0;
+        result.append(new_id, it.freq(), positions.data(), positions.size(), length);
+    }
+
+    return result;
+}
+
+size_t CompressedPostingList::memory_usage() const {
+    return sizeof(*this) + term_.size() +
+           skips_.size() * sizeof(SkipEntry) +
+           doc_bytes_.size() + freq_bytes_.size() + pos_bytes_.size() +
+           (tail_docs_.size() + tail_freqs_.size()) * sizeof(uint32_t) + tail_pos_bytes_.size();
+}
+
+// ==================== PostingIterator ====================
+
+PostingIterator::PostingIterator(const CompressedPostingList* list)
+    : list_(list), block_total_(list ? list->block_count() : 0),
+      block_(0), index_(0), block_size_(0) {
+    if (valid()) {
+        load_block(0);
+    }
+}
+
+uint32_t PostingIterator::last_doc_of(size_t block) const {
+    if (block < list_->skips_.size()) {
+        return list_->skips_[block].last_doc;
+    }
+    return list_->tail_docs_.back();
+}
+
+uint32_t PostingIterator::block_max_freq(size_t block) const {
+    if (block < list_->skips_.size()) {
+        return list_->skips_[block].max_freq;
+    }
+    return list_->tail_max_freq_;
+}
+
+uint32_t PostingIterator::block_min_length(size_t block) const {
+    if (block < list_->skips_.size()) {
+        return list_->skips_[block].min_length;
+    }
+    return list_->tail_min_length_;
+}
+
+size_t PostingIterator::find_block(uint32_t target) const {
+    if (!valid() || last_doc_of(block_) >= target) {
+        return block_;
+    }
+
+    // 在跳表上 galloping：步长倍增找到上界，再二分
+    size_t lo = block_ + 1;
+    size_t step = 1;
+    size_t hi = lo;
+    while (hi < block_total_ && last_doc_of(hi) < target) {
+        lo = hi + 1;
+        hi += step;
+        step <<= 1;
+    }
+    hi = std::min(hi, block_total_);
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (last_doc_of(mid) < target) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+void PostingIterator::load_block(size_t block) {
+    block_ = block;
+    index_ = 0;
+    if (block_ >= block_total_) {
+        return;
+    }
+
+    if (block_ < list_->skips_.size()) {
+        const auto& entry = list_->skips_[block_];
+        const uint8_t* dp = list_->doc_bytes_.data() + entry.doc_offset;
+        const uint8_t* fp = list_->freq_bytes_.data() + entry.freq_offset;
+        uint32_t prev = block_ == 0 ? 0 : list_->skips_[block_ - 1].last_doc;
+        block_size_ = entry.count;
+        for (size_t i = 0; i < block_size_; ++i) {
+            prev += posting::get_varint(dp);
+            docs_[i] = prev;
+            freqs_[i] = posting::get_varint(fp);
+        }
+    } else {
+        block_size_ = list_->tail_docs_.size();
+        std::copy(list_->tail_docs_.begin(), list_->tail_docs_.end(), docs_);
+        std::copy(list_->tail_freqs_.begin(), list_->tail_freqs_.end(), freqs_);
+    }
+}
+
+void PostingIterator::next() {
+    if (++index_ >= block_size_) {
+        load_block(block_ + 1);
+    }
+}
+
+void PostingIterator::advance(uint32_t target) {
+    if (!valid() || docs_[index_] >= target) {
+        return;
+    }
+
+    if (last_doc_of(block_) < target) {
+        load_block(find_block(target));
+        if (!valid()) {
+            return;
+        }
+    }
+
+    index_ = block_lower_bound(docs_, index_, block_size_, target);
+}
+
+std::vector<uint32_t> PostingIterator::positions() const {
+    const uint8_t* p;
+    if (block_ < list_->skips_.size()) {
+        p = list_->pos_bytes_.data() + list_->skips_[block_].pos_offset;
+    } else {
+        p = list_->tail_pos_bytes_.data();
+    }
+
+    // 跳过块内前面 posting 的位置
+    for (size_t i = 0; i < index_; ++i) {
+        uint32_t count = posting::get_varint(p);
+        for (uint32_t j = 0; j < count; ++j) {
+            posting::get_varint(p);
+        }
+    }
+
+    uint32_t count = posting::get_varint(p);
+    std::vector<uint32_t> result(count);
+    uint32_t prev = 0;
+    for (uint32_t j = 0; j < count; ++j) {
+        prev += posting::get_varint(p);
+        result[j] = prev;
+    }
+    return result;
+}
+
+// ==================== 集合运算 ====================
+
+namespace posting {
+
+void intersect(std::vector<PostingIterator>& iters,
+               const std::function<bool(uint32_t)>& accept,
+               const std::function<void(uint32_t)>& on_match) {
+    if (iters.empty()) {
+        return;
+    }
+    for (const auto& it : iters) {
+        if (!it.valid()) {
+            return;
+        }
+    }
+
+    // 最短的列表驱动，其余列表只做 advance
+    std::sort(iters.begin(), iters.end(),
+              [](const PostingIterator& a, const PostingIterator& b) { return a.cost() < b.cost(); });
+
+    PostingIterator& lead = iters[0];
+    while (lead.valid()) {
+        uint32_t candidate = lead.doc();
+        bool matched = true;
+
+        for (size_t i = 1; i < iters.size(); ++i) {
+            iters[i].advance(candidate);
+            if (!iters[i].valid()) {
+                return;
+            }
+            if (iters[i].doc() != candidate) {
+                // 其他列表跳得更远，带动 lead 一起跳
+                lead.advance(iters[i].doc());
+                matched = false;
+                break;
+            }
+        }
+
+        if (matched) {
+            if (accept(candidate)) {
+                on_match(candidate);
+            }
+            lead.next();
+        }
+    }
+}
+
+void unite(std::vector<PostingIterator>& iters,
+           const std::function<bool(uint32_t)>& accept,
+           const std::function<void(uint32_t)>& on_match) {
+    while (true) {
+        uint32_t min_doc = DocIdMap::INVALID_ID;
+        for (const auto& it : iters) {
+            if (it.valid() && it.doc() < min_doc) {
+                min_doc = it.doc();
+            }
+        }
+        if (min_doc == DocIdMap::INVALID_ID) {
+            return;
+        }
+
+        if (accept(min_doc)) {
+            on_match(min_doc);
+        }
+        for (auto& it : iters) {
+            if (it.valid() && it.doc() == min_doc) {
+                it.next();
+            }
+        }
+    }
+}
+
+std::vector<std::pair<uint32_t, double>> top_k(std::vector<ScoredCursor>& cursors, size_t k,
+                                               const std::function<bool(uint32_t)>& accept) {
+    if (k == 0) {
+        k = SIZE_MAX;
+    }
+
+    // 上界截到 0 以上：负分词条（如 BM25 高频词）只会拉低总分，不影响剪枝的正确性
+    auto clamp_bound = [](const ScoredCursor& c, uint32_t max_freq, uint32_t min_length) {
+        return std::max(0.0, c.bound(max_freq, min_length));
+    };
+
+    std::vector<ScoredCursor*> active;
+    for (auto& c : cursors) {
+        if (c.iter.valid()) {
+            c.max_score = clamp_bound(c, c.iter.list()->max_freq(), c.iter.list()->min_length());
+            active.push_back(&c);
+        }
+    }
+
+    // 小顶堆保存当前前 k 个 (得分, 文档)，堆顶即进入前 k 的门槛
+    using Entry = std::pair<double, uint32_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    auto threshold = [&]() { return heap.size() < k ? 0.0 : heap.top().first; };
+
+    while (true) {
+        active.erase(std::remove_if(active.begin(), active.end(),
+                                    [](const ScoredCursor* c) { return !c->iter.valid(); }),
+                     active.end());
+        if (active.empty()) {
+            break;
+        }
+        std::sort(active.begin(), active.end(), [](const ScoredCursor* a, const ScoredCursor* b) {
+            return a->iter.doc() < b->iter.doc();
+        });
+
+        // 找 pivot：按文档 ID 累加列表级上界，第一次超过门槛的位置
+        const double theta = threshold();
+        double upper = 0.0;
+        size_t pivot = active.size();
+        for (size_t i = 0; i < active.size(); ++i) {
+            upper += active[i]->max_score;
+            if (upper > theta) {
+                pivot = i;
+                break;
+            }
+        }
+        if (pivot == active.size()) {
+            break;  // 剩余文档都不可能进入前 k
+        }
+
+        const uint32_t pivot_doc = active[pivot]->iter.doc();
+        while (pivot + 1 < active.size() && active[pivot + 1]->iter.doc() == pivot_doc) {
+            ++pivot;
+        }
+
+        // 块级上界：只看跳表，不解码
+        double block_upper = 0.0;
+        uint32_t next_doc = pivot + 1 < active.size() ? active[pivot + 1]->iter.doc() : UINT32_MAX;
+        for (size_t i = 0; i <= pivot; ++i) {
+            const PostingIterator& it = active[i]->iter;
+            size_t block = it.find_block(pivot_doc);
+            if (block < it.block_count()) {
+                block_upper += clamp_bound(*active[i], it.block_max_freq(block), it.block_min_length(block));
+                next_doc = std::min(next_doc, it.block_last_doc(block) + 1);
+            }
+        }
+
+        if (block_upper <= theta) {
+            // [pivot_doc, next_doc) 内的文档都落在这些块里，整体跳过
+            for (size_t i = 0; i <= pivot; ++i) {
+                active[i]->iter.advance(next_doc);
+            }
+            continue;
+        }
+
+        if (active[0]->iter.doc() != pivot_doc) {
+            // pivot 之前的游标对更小的文档贡献不够，直接对齐到 pivot
+            for (size_t i = 0; i < pivot && active[i]->iter.doc() < pivot_doc; ++i) {
+                active[i]->iter.advance(pivot_doc);
+            }
+            continue;
+        }
+
+        // 所有 pivot 之前的游标都停在 pivot_doc 上，完整打分
+        if (accept(pivot_doc)) {
+            double score = 0.0;
+            for (size_t i = 0; i <= pivot; ++i) {
+                score += active[i]->score(pivot_doc, active[i]->iter.freq());
+            }
+            if (score > theta) {
+                heap.emplace(score, pivot_doc);
+                if (heap.size() > k) {
+                    heap.pop();
+                }
+            }
+        }
+        for (size_t i = 0; i <= pivot; ++i) {
+            active[i]->iter.next();
+        }
+    }
+
+    std::vector<std::pair<uint32_t, double>> results(heap.size());
+    for (size_t i = heap.size(); i > 0; --i) {
+        results[i - 1] = {heap.top().second, heap.top().first};
+        heap.pop();
+    }
+    return results;
+}
+
+}  // namespace posting
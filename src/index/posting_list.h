@@ -0,0 +1,186 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <functional>
+
+// 文档 ID 映射：字符串文档 ID <-> 稠密整数 ID
+// 倒排列表只存整数 ID；文档删除时只打删除标记，重新索引的文档分配新的 ID，
+// 因此倒排列表始终是追加写、按 ID 递增有序。删除比例过高时由索引整体重排（compact）。
+class DocIdMap {
+public:
+    static constexpr uint32_t INVALID_ID = UINT32_MAX;
+
+    // 为文档分配新 ID；若文档已存在，旧 ID 先被标记删除
+    uint32_t assign(const std::string& document_id);
+    uint32_t find(const std::string& document_id) const;
+    bool remove(const std::string& document_id);
+
+    bool is_live(uint32_t id) const { return id < live_.size() && live_[id]; }
+    const std::string& name(uint32_t id) const { return names_[id]; }
+
+    size_t live_count() const { return live_count_; }
+    size_t deleted_count() const { return names_.size() - live_count_; }
+    uint32_t next_id() const { return static_cast<uint32_t>(names_.size()); }
+
+    // 丢弃已删除的 ID 并重新编号，返回 旧ID -> 新ID（已删除的映射为 INVALID_ID）
+    std::vector<uint32_t> compact();
+
+    void clear();
+    size_t memory_usage() const;
+
+private:
+    std::unordered_map<std::string, uint32_t> ids_;
+    std::vector<std::string> names_;
+    std::vector<bool> live_;
+    size_t live_count_ = 0;
+};
+
+// 压缩倒排列表
+// - 文档 ID 按 128 个一块做差分 + 变长字节（varint）编码，词频单独一条 varint 流
+// - 每块一个跳表项（块内最大 ID 与各条流的偏移），advance 时先在跳表上做 galloping，
+//   再只解码命中的那一块
+// - 跳表项同时记录块内最大词频与最短文档长度，打分函数据此给出块级得分上界（Block-Max WAND）
+// - 位置信息存放在独立的压缩流中，只有短语/邻近查询才会解码
+// - 不足一块的尾部保持未压缩，追加满 128 条后封块
+class CompressedPostingList {
+public:
+    static constexpr size_t BLOCK_SIZE = 128;
+
+    struct SkipEntry {
+        uint32_t last_doc;      // 块内最大文档 ID
+        uint32_t doc_offset;    // doc 流中的起始字节
+        uint32_t freq_offset;   // freq 流中的起始字节
+        uint32_t pos_offset;    // 位置流中的起始字节
+        uint32_t count;         // 块内 posting 数
+        uint32_t max_freq;      // 块内最大词频
+        uint32_t min_length;    // 块内最短文档长度
+    };
+
+    explicit CompressedPostingList(const std::string& term = "");
+
+    // 追加一个 posting，doc 必须大于已有的最大 ID
+    // doc_length 只用于得分上界，未知时传 0（上界退化为不考虑文档长度）
+    void append(uint32_t doc, uint32_t freq, const uint32_t* positions, size_t position_count,
+                uint32_t doc_length = 0);
+
+    // 按 remap 重新编号并丢弃映射为 INVALID_ID 的 posting；doc_lengths 按新 ID 下标
+    CompressedPostingList remap(const std::vector<uint32_t>& id_map,
+                                const std::vector<uint32_t>& doc_lengths) const;
+
+    const std::string& term() const { return term_; }
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+    uint32_t last_doc() const { return last_doc_; }
+    uint32_t max_freq() const { return max_freq_; }
+    uint32_t min_length() const { return min_length_; }
+    size_t memory_usage() const;
+
+    size_t block_count() const { return skips_.size() + (tail_docs_.empty() ? 0 : 1); }
+
+private:
+    friend class PostingIterator;
+
+    void seal_tail();
+
+    std::string term_;
+    std::vector<SkipEntry> skips_;
+    std::vector<uint8_t> doc_bytes_;
+    std::vector<uint8_t> freq_bytes_;
+    std::vector<uint8_t> pos_bytes_;
+
+    // 未封块的尾部
+    std::vector<uint32_t> tail_docs_;
+    std::vector<uint32_t> tail_freqs_;
+    std::vector<uint8_t> tail_pos_bytes_;
+    uint32_t tail_max_freq_ = 0;
+    uint32_t tail_min_length_ = UINT32_MAX;
+
+    uint32_t last_doc_ = 0;
+    uint32_t max_freq_ = 0;
+    uint32_t min_length_ = UINT32_MAX;
+    size_t count_ = 0;
+};
+
+// 倒排列表游标：按块解码，支持 next / advance(target) / 按需解码位置
+class PostingIterator {
+public:
+    explicit PostingIterator(const CompressedPostingList* list);
+
+    bool valid() const { return list_ != nullptr && block_ < block_total_; }
+    uint32_t doc() const { return docs_[index_]; }
+    uint32_t freq() const { return freqs_[index_]; }
+    size_t cost() const { return list_ ? list_->size() : 0; }
+
+    void next();
+    // 移动到第一个 >= target 的 posting
+    void advance(uint32_t target);
+
+    // 当前 posting 的位置列表（短语查询才调用）
+    std::vector<uint32_t> positions() const;
+
+    size_t block() const { return block_; }
+    uint32_t block_last_doc() const { return last_doc_of(block_); }
+
+    // 只查跳表、不解码：从当前块起第一个最大 ID >= target 的块（不存在时返回 block_count）
+    size_t find_block(uint32_t target) const;
+    size_t block_count() const { return block_total_; }
+    uint32_t block_last_doc(size_t block) const { return last_doc_of(block); }
+    uint32_t block_max_freq(size_t block) const;
+    uint32_t block_min_length(size_t block) const;
+
+    const CompressedPostingList* list() const { return list_; }
+
+private:
+    void load_block(size_t block);
+    uint32_t last_doc_of(size_t block) const;
+
+    const CompressedPostingList* list_;
+    size_t block_total_;
+    size_t block_;
+    size_t index_;
+    size_t block_size_;
+    uint32_t docs_[CompressedPostingList::BLOCK_SIZE];
+    uint32_t freqs_[CompressedPostingList::BLOCK_SIZE];
+};
+
+namespace posting {
+
+// 多路求交：按列表长度从短到长做 leapfrog，advance 内部在跳表上 galloping
+// 每个同时出现在所有列表中、且 accept 通过的文档调用一次 on_match
+void intersect(std::vector<PostingIterator>& iters,
+               const std::function<bool(uint32_t)>& accept,
+               const std::function<void(uint32_t)>& on_match);
+
+// 多路求并：按文档 ID 递增对每个出现过的文档调用一次 on_match
+void unite(std::vector<PostingIterator>& iters,
+           const std::function<bool(uint32_t)>& accept,
+           const std::function<void(uint32_t)>& on_match);
+
+// 带打分函数的游标，供 top_k 使用
+// bound(max_freq, min_length) 必须是 score 的上界：词频越大、文档越短得分越高
+struct ScoredCursor {
+    PostingIterator iter;
+    std::function<double(uint32_t doc, uint32_t freq)> score;
+    std::function<double(uint32_t max_freq, uint32_t min_length)> bound;
+    double max_score = 0.0;   // 整条列表的上界，由 top_k 计算
+
+    ScoredCursor(const CompressedPostingList* list,
+                 std::function<double(uint32_t, uint32_t)> score_fn,
+                 std::function<double(uint32_t, uint32_t)> bound_fn)
+        : iter(list), score(std::move(score_fn)), bound(std::move(bound_fn)) {}
+};
+
+// Block-Max WAND：返回得分 > 0 的前 k 个文档（按得分降序，k 为 0 表示不限）
+// 用列表级上界选 pivot，再用 pivot 所在块的块级上界判断能否跳过整块，
+// 只有可能进入前 k 的文档才会被完整打分
+std::vector<std::pair<uint32_t, double>> top_k(std::vector<ScoredCursor>& cursors, size_t k,
+                                               const std::function<bool(uint32_t)>& accept);
+
+// 变长字节编码
+void put_varint(std::vector<uint8_t>& out, uint32_t value);
+uint32_t get_varint(const uint8_t*& p);
+
+}  // namespace posting
@@ -1,9 +1,128 @@
 #include "tokenizer.h"
-#include <sstream>
 #include <cctype>
 #include <algorithm>
 
-Tokenizer::Tokenizer() 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+// 字符分类表，与 "C" locale 下的 isspace / ispunct / isupper 一致；
+// >= 0x80 的字节（UTF-8 多字节序列）不属于任何一类，原样保留在词条中
+enum : uint8_t {
+    CHAR_SPACE = 1,
+    CHAR_PUNCT = 2,
+    CHAR_UPPER = 4,
+};
+
+struct CharClassTable {
+    uint8_t flags[256];
+
+    constexpr CharClassTable() : flags() {
+        for (int c = 0; c < 256; ++c) {
+            uint8_t f = 0;
+            if (c == ' ' || (c >= '\t' && c <= '\r')) f |= CHAR_SPACE;
+            if ((c >= '!' && c <= '/') || (c >= ':' && c <= '@') ||
+                (c >= '[' && c <= '`') || (c >= '{' && c <= '~')) f |= CHAR_PUNCT;
+            if (c >= 'A' && c <= 'Z') f |= CHAR_UPPER;
+            flags[c] = f;
+        }
+    }
+};
+
+constexpr CharClassTable kCharClass;
+
+inline uint8_t char_class(char c) {
+    return kCharClass.flags[static_cast<unsigned char>(c)];
+}
+
+#if defined(__SSE2__)
+// 16 字节中空白字符的位掩码
+inline int space_mask(__m128i v) {
+    // 有符号比较：>= 0x80 的字节为负数，不会落入 [9, 13]
+    __m128i ctrl = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('\t' - 1)),
+                                 _mm_cmplt_epi8(v, _mm_set1_epi8('\r' + 1)));
+    __m128i space = _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+    return _mm_movemask_epi8(_mm_or_si128(ctrl, space));
+}
+
+inline __m128i in_range(__m128i v, char lo, char hi) {
+    return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(static_cast<char>(lo - 1))),
+                         _mm_cmplt_epi8(v, _mm_set1_epi8(static_cast<char>(hi + 1))));
+}
+
+inline int punct_mask(__m128i v) {
+    __m128i m = _mm_or_si128(_mm_or_si128(in_range(v, '!', '/'), in_range(v, ':', '@')),
+                             _mm_or_si128(in_range(v, '[', '`'), in_range(v, '{', '~')));
+    return _mm_movemask_epi8(m);
+}
+#endif
+
+size_t skip_spaces(const char* data, size_t pos, size_t n) {
+#if defined(__SSE2__)
+    for (; pos + 16 <= n; pos += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        int mask = space_mask(v) ^ 0xFFFF;
+        if (mask != 0) {
+            return pos + __builtin_ctz(static_cast<unsigned>(mask));
+        }
+    }
+#endif
+    while (pos < n && (char_class(data[pos]) & CHAR_SPACE)) {
+        ++pos;
+    }
+    return pos;
+}
+
+size_t find_space(const char* data, size_t pos, size_t n) {
+#if defined(__SSE2__)
+    for (; pos + 16 <= n; pos += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        int mask = space_mask(v);
+        if (mask != 0) {
+            return pos + __builtin_ctz(static_cast<unsigned>(mask));
+        }
+    }
+#endif
+    while (pos < n && !(char_class(data[pos]) & CHAR_SPACE)) {
+        ++pos;
+    }
+    return pos;
+}
+
+// 去标点并转小写，写入 dst，返回写入长度
+size_t clean_token(const char* src, size_t n, bool remove_punct, bool lower, char* dst) {
+    size_t out = 0;
+    size_t i = 0;
+#if defined(__SSE2__)
+    // 16 字节中没有标点时整块转小写直接写出
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        if (remove_punct && punct_mask(v) != 0) {
+            break;
+        }
+        if (lower) {
+            __m128i upper = in_range(v, 'A', 'Z');
+            v = _mm_add_epi8(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + out), v);
+        out += 16;
+    }
+#endif
+    for (; i < n; ++i) {
+        uint8_t f = char_class(src[i]);
+        if (remove_punct && (f & CHAR_PUNCT)) {
+            continue;
+        }
+        dst[out++] = (lower && (f & CHAR_UPPER)) ? static_cast<char>(src[i] + ('a' - 'A')) : src[i];
+    }
+    return out;
+}
+
+}  // namespace
+
+Tokenizer::Tokenizer()
     : min_term_length_(2), max_term_length_(50), case_sensitive_(false),
       remove_punctuation_(true), remove_numbers_(false) {
     load_default_stop_words();
@@ -11,50 +130,70 @@ Tokenizer::Tokenizer()
 
 Tokenizer::~Tokenizer() = default;
 
-std::vector<std::string> Tokenizer::tokenize(const std::string& text) {
+std::vector<std::string> Tokenizer::tokenize(const std::string& text) const {
     std::vector<std::string> tokens;
-    
-    // 分割文本
-    std::vector<std::string> raw_tokens = split_text(text);
-    
-    for (const std::string& token : raw_tokens) {
-        // 清理和标准化
-        std::string cleaned = clean_term(token);
-        std::string normalized = normalize(cleaned);
-        
-        // 过滤条件
-        if (normalized.empty()) continue;
-        if (normalized.length() < min_term_length_) continue;
-        if (normalized.length() > max_term_length_) continue;
-        if (is_stop_word(normalized)) continue;
-        if (remove_numbers_ && is_number(normalized)) continue;
-        
-        tokens.push_back(normalized);
-    }
-    
+    for_each_token(text, [&tokens](std::string_view token) {
+        tokens.emplace_back(token);
+    });
     return tokens;
 }
 
+bool Tokenizer::next_token(std::string_view text, size_t& pos, std::string& buffer,
+                           std::string_view& token) const {
+    const char* data = text.data();
+    const size_t n = text.size();
+
+    while (true) {
+        // 按空白切分
+        pos = skip_spaces(data, pos, n);
+        if (pos >= n) {
+            return false;
+        }
+        size_t end = find_space(data, pos, n);
+
+        // 清理和标准化，写入复用缓冲区
+        size_t raw_length = end - pos;
+        if (buffer.size() < raw_length) {
+            buffer.resize(raw_length);
+        }
+        size_t length = clean_token(data + pos, raw_length, remove_punctuation_, !case_sensitive_, &buffer[0]);
+        pos = end;
+
+        // 过滤条件
+        if (length == 0) continue;
+        if (length < min_term_length_) continue;
+        if (length > max_term_length_) continue;
+
+        token = std::string_view(buffer.data(), length);
+        if (stop_table_.contains(token)) continue;
+        if (remove_numbers_ && is_number(token)) continue;
+
+        return true;
+    }
+}
+
 std::string Tokenizer::normalize(const std::string& term) const {
     std::string result = term;
-    
+
     if (!case_sensitive_) {
         result = to_lower(result);
     }
-    
+
     return result;
 }
 
 void Tokenizer::add_stop_word(const std::string& word) {
     stop_words_.insert(normalize(word));
+    rebuild_stop_table();
 }
 
 void Tokenizer::remove_stop_word(const std::string& word) {
     stop_words_.erase(normalize(word));
+    rebuild_stop_table();
 }
 
 bool Tokenizer::is_stop_word(const std::string& word) const {
-    return stop_words_.count(normalize(word)) > 0;
+    return stop_table_.contains(normalize(word));
 }
 
 void Tokenizer::load_default_stop_words() {
@@ -70,10 +209,15 @@ void Tokenizer::load_default_stop_words() {
         "who", "oil", "sit", "now", "find", "down", "day", "did", "get",
         "come", "made", "may", "part"
     };
-    
+
     for (const std::string& word : default_stops) {
         stop_words_.insert(word);
     }
+    rebuild_stop_table();
+}
+
+void Tokenizer::rebuild_stop_table() {
+    stop_table_.build(std::vector<std::string>(stop_words_.begin(), stop_words_.end()));
 }
 
 std::string Tokenizer::to_lower(const std::string& str) const {
@@ -82,47 +226,110 @@ std::string Tokenizer::to_lower(const std::string& str) const {
     return result;
 }
 
-bool Tokenizer::is_punctuation(char c) {
-    return std::ispunct(c);
-}
-
-bool Tokenizer::is_number(const std::string& str) {
+bool Tokenizer::is_number(std::string_view str) {
     if (str.empty()) return false;
-    
+
     for (char c : str) {
-        if (!std::isdigit(c) && c != '.' && c != '-' && c != '+') {
+        if (!std::isdigit(static_cast<unsigned char>(c)) && c != '.' && c != '-' && c != '+') {
             return false;
         }
     }
     return true;
 }
 
-std::vector<std::string> Tokenizer::split_text(const std::string& text) {
-    std::vector<std::string> tokens;
-    std::istringstream iss(text);
-    std::string token;
-    
-    // 使用空白字符分割
-    while (iss >> token) {
-        tokens.push_back(token);
-    }
-    
-    return tokens;
+// ==================== StopWordTable ====================
+
+uint32_t Tokenizer::StopWordTable::hash(std::string_view word, uint32_t seed) {
+    // FNV-1a，种子混入初始值
+    uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (char c : word) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 16777619u;
+    }
+    h ^= h >> 15;
+    h *= 0x2C1B3C6Du;
+    h ^= h >> 12;
+    return h;
 }
 
-std::string Tokenizer::clean_term(const std::string& term) {
-    if (!remove_punctuation_) {
-        return term;
+void Tokenizer::StopWordTable::build(const std::vector<std::string>& words) {
+    words_ = words;
+    seeds_.clear();
+    slots_.clear();
+    slot_mask_ = 0;
+    if (words_.empty()) {
+        return;
     }
-    
-    std::string result;
-    result.reserve(term.size());
-    
-    for (char c : term) {
-        if (!is_punctuation(c)) {
-            result += c;
+
+    const size_t bucket_count = std::max<size_t>(1, words_.size() / 2);
+    std::vector<std::vector<uint32_t>> buckets(bucket_count);
+    for (uint32_t i = 0; i < words_.size(); ++i) {
+        buckets[hash(words_[i], 0) % bucket_count].push_back(i);
+    }
+
+    // 大桶先放，空位多时更容易找到种子
+    std::vector<size_t> order(bucket_count);
+    for (size_t b = 0; b < bucket_count; ++b) {
+        order[b] = b;
+    }
+    std::sort(order.begin(), order.end(),
+              [&buckets](size_t a, size_t b) { return buckets[a].size() > buckets[b].size(); });
+
+    // 装载因子不超过 0.5；极少数情况下种子搜索失败则扩大槽位重来
+    size_t slot_count = 1;
+    while (slot_count < words_.size() * 2) {
+        slot_count <<= 1;
+    }
+
+    while (true) {
+        slots_.assign(slot_count, 0);
+        seeds_.assign(bucket_count, 0);
+        slot_mask_ = static_cast<uint32_t>(slot_count - 1);
+
+        bool success = true;
+        std::vector<uint32_t> placed;
+        for (size_t b : order) {
+            const auto& bucket = buckets[b];
+            if (bucket.empty()) {
+                break;
+            }
+
+            bool found = false;
+            for (uint32_t seed = 1; seed < 4096 && !found; ++seed) {
+                placed.clear();
+                for (uint32_t index : bucket) {
+                    uint32_t slot = hash(words_[index], seed) & slot_mask_;
+                    if (slots_[slot] != 0 || std::find(placed.begin(), placed.end(), slot) != placed.end()) {
+                        break;
+                    }
+                    placed.push_back(slot);
+                }
+                if (placed.size() == bucket.size()) {
+                    for (size_t i = 0; i < bucket.size(); ++i) {
+                        slots_[placed[i]] = bucket[i] + 1;
+                    }
+                    seeds_[b] = seed;
+                    found = true;
+                }
+            }
+            if (!found) {
+                success = false;
+                break;
+            }
         }
+
+        if (success) {
+            return;
+        }
+        slot_count <<= 1;
     }
-    
-    return result;
-}
\ No newline at end of file
+}
+
+bool Tokenizer::StopWordTable::contains(std::string_view word) const {
+    if (slots_.empty()) {
+        return false;
+    }
+    uint32_t seed = seeds_[hash(word, 0) % seeds_.size()];
+    uint32_t index = slots_[hash(word, seed) & slot_mask_];
+    return index != 0 && words_[index - 1] == word;
+}
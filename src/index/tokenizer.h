@@ -1,56 +1,88 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 #include <set>
 #include <unordered_set>
 #include <locale>
 #include <algorithm>
+#include <cstdint>
 
 class Tokenizer {
 public:
     Tokenizer();
     ~Tokenizer();
-    
+
     // 分词
-    std::vector<std::string> tokenize(const std::string& text);
-    
+    std::vector<std::string> tokenize(const std::string& text) const;
+
+    // 流式分词：不构造中间字符串，每个词条以 string_view 回调
+    // 回调拿到的 view 指向本次调用内复用的缓冲区，只在回调期间有效
+    template <typename Callback>
+    void for_each_token(std::string_view text, Callback&& on_token) const {
+        std::string buffer;
+        buffer.reserve(max_term_length_ + 1);
+        size_t pos = 0;
+        std::string_view token;
+        while (next_token(text, pos, buffer, token)) {
+            on_token(token);
+        }
+    }
+
     // 标准化
     std::string normalize(const std::string& term) const;
-    
+
     // 停用词管理
     void add_stop_word(const std::string& word);
     void remove_stop_word(const std::string& word);
     bool is_stop_word(const std::string& word) const;
     void load_default_stop_words();
-    
+
     // 配置选项
     void set_min_term_length(size_t length) { min_term_length_ = length; }
     void set_max_term_length(size_t length) { max_term_length_ = length; }
     void set_case_sensitive(bool sensitive) { case_sensitive_ = sensitive; }
     void set_remove_punctuation(bool remove) { remove_punctuation_ = remove; }
     void set_remove_numbers(bool remove) { remove_numbers_ = remove; }
-    
+
     size_t get_min_term_length() const { return min_term_length_; }
     size_t get_max_term_length() const { return max_term_length_; }
     bool is_case_sensitive() const { return case_sensitive_; }
     bool should_remove_punctuation() const { return remove_punctuation_; }
     bool should_remove_numbers() const { return remove_numbers_; }
-    
+
 private:
+    // 停用词完美哈希表（hash-and-displace）：
+    // 第一级把词分到桶里，每个桶找一个种子使桶内词在第二级槽位中互不冲突，
+    // 查询固定两次哈希加一次比较
+    class StopWordTable {
+    public:
+        void build(const std::vector<std::string>& words);
+        bool contains(std::string_view word) const;
+
+    private:
+        static uint32_t hash(std::string_view word, uint32_t seed);
+
+        std::vector<std::string> words_;
+        std::vector<uint32_t> seeds_;     // 每个桶的种子
+        std::vector<uint32_t> slots_;     // 槽位 -> words_ 下标 + 1（0 表示空）
+        uint32_t slot_mask_ = 0;
+    };
+
     // 停用词集合
     std::unordered_set<std::string> stop_words_;
-    
+    StopWordTable stop_table_;
+
     // 配置选项
     size_t min_term_length_;
     size_t max_term_length_;
     bool case_sensitive_;
     bool remove_punctuation_;
     bool remove_numbers_;
-    
+
     // 辅助方法
+    bool next_token(std::string_view text, size_t& pos, std::string& buffer, std::string_view& token) const;
+    void rebuild_stop_table();
     std::string to_lower(const std::string& str) const;
-    bool is_punctuation(char c);
-    bool is_number(const std::string& str);
-    std::vector<std::string> split_text(const std::string& text);
-    std::string clean_term(const std::string& term);
-};
\ No newline at end of file
+    static bool is_number(std::string_view str);
+};
@@ -13,6 +13,13 @@ void ConcurrentIterator::seek(const std::string& target) {
     }
 }
 
+void ConcurrentIterator::seek_for_prev(const std::string& target) {
+    std::unique_lock<std::shared_mutex> lock(rw_mutex_);
+    if (!invalidated_.load()) {
+        inner_->seek_for_prev(target);
+    }
+}
+
 void ConcurrentIterator::seek_to_first() {
     std::unique_lock<std::shared_mutex> lock(rw_mutex_);
     if (!invalidated_.load()) {
@@ -20,6 +27,13 @@ void ConcurrentIterator::seek_to_first() {
     }
 }
 
+void ConcurrentIterator::seek_to_last() {
+    std::unique_lock<std::shared_mutex> lock(rw_mutex_);
+    if (!invalidated_.load()) {
+        inner_->seek_to_last();
+    }
+}
+
 void ConcurrentIterator::seek_with_prefix(const std::string& prefix) {
     std::unique_lock<std::shared_mutex> lock(rw_mutex_);
     if (!invalidated_.load()) {
@@ -34,6 +48,13 @@ void ConcurrentIterator::next() {
     }
 }
 
+void ConcurrentIterator::prev() {
+    std::unique_lock<std::shared_mutex> lock(rw_mutex_);
+    if (!invalidated_.load()) {
+        inner_->prev();
+    }
+}
+
 bool ConcurrentIterator::valid() const {
     std::shared_lock<std::shared_mutex> lock(rw_mutex_);
     if (invalidated_.load()) {
@@ -42,20 +63,28 @@ bool ConcurrentIterator::valid() const {
     return inner_->valid();
 }
 
-std::string ConcurrentIterator::key() const {
+Slice ConcurrentIterator::key_slice() const {
+    std::shared_lock<std::shared_mutex> lock(rw_mutex_);
+    if (invalidated_.load()) {
+        return Slice();
+    }
+    return inner_->key_slice();
+}
+
+Slice ConcurrentIterator::value_slice() const {
     std::shared_lock<std::shared_mutex> lock(rw_mutex_);
     if (invalidated_.load()) {
-        return "";
+        return Slice();
     }
-    return inner_->key();
+    return inner_->value_slice();
 }
 
-std::string ConcurrentIterator::value() const {
+uint64_t ConcurrentIterator::seq() const {
     std::shared_lock<std::shared_mutex> lock(rw_mutex_);
     if (invalidated_.load()) {
-        return "";
+        return 0;
     }
-    return inner_->value();
+    return inner_->seq();
 }
 
 void ConcurrentIterator::acquire_read_lock() {
@@ -15,12 +15,16 @@ public:
 
     // Iterator 接口
     void seek(const std::string& target) override;
+    void seek_for_prev(const std::string& target) override;
     void seek_to_first() override;
+    void seek_to_last() override;
     void seek_with_prefix(const std::string& prefix) override;
     void next() override;
+    void prev() override;
     bool valid() const override;
-    std::string key() const override;
-    std::string value() const override;
+    Slice key_slice() const override;
+    Slice value_slice() const override;
+    uint64_t seq() const override;
 
     // 并发控制
     void acquire_read_lock();
@@ -1,5 +1,8 @@
 #pragma once
 #include <string>
+#include <cstdint>
+#include "storage/slice.h"
+#include "iterator/read_options.h"
 
 class Iterator {
 public:
@@ -7,17 +10,31 @@ public:
 
     virtual bool valid() const = 0;
     virtual void next() = 0;
+    virtual void prev() = 0;
 
-    virtual std::string key() const = 0;
-    virtual std::string value() const = 0;
+    // 零拷贝访问：返回的 Slice 在迭代器下一次移动之前有效
+    virtual Slice key_slice() const = 0;
+    virtual Slice value_slice() const = 0;
 
+    // 当前条目可见版本的序列号，MergeIterator 按 (key ASC, seq DESC) 归并
+    virtual uint64_t seq() const { return 0; }
+
+    // 兼容接口：拷贝出 std::string
+    std::string key() const { return key_slice().to_string(); }
+    std::string value() const { return value_slice().to_string(); }
+
+    // 定位到第一个 >= target 的 key
     virtual void seek(const std::string& target) = 0;
+    // 定位到最后一个 <= target 的 key（反向迭代的起点）
+    virtual void seek_for_prev(const std::string& target) = 0;
     
     // Prefix 优化接口
     virtual void seek_to_first() {
         seek("");
     }
     
+    virtual void seek_to_last() = 0;
+    
     virtual void seek_with_prefix(const std::string& prefix) {
         seek(prefix);
     }
@@ -0,0 +1,57 @@
+#pragma once
+#include <vector>
+#include <utility>
+
+// 败者树（锦标赛树）：在 k 路归并中选出当前胜者
+// 叶子 i 位于逻辑节点 k+i，内部节点 1..k-1 保存该场比赛的败者，winner_ 保存总冠军。
+// 某一路推进后只需沿叶子到根重赛一次：每层一次比较，共 O(log k) 次，且无需堆的上下调整。
+class LoserTree {
+public:
+    LoserTree() : k_(0), winner_(-1) {}
+
+    int size() const { return k_; }
+    int winner() const { return winner_; }
+
+    // better(a, b) 返回 true 表示叶子 a 胜过叶子 b
+    template <typename Better>
+    void build(int k, Better better) {
+        k_ = k;
+        losers_.assign(k_ > 0 ? k_ : 1, -1);
+        if (k_ == 0) {
+            winner_ = -1;
+            return;
+        }
+        winners_.assign(2 * k_, -1);
+        for (int i = 0; i < k_; i++) {
+            winners_[k_ + i] = i;
+        }
+        for (int node = k_ - 1; node >= 1; node--) {
+            int a = winners_[2 * node];
+            int b = winners_[2 * node + 1];
+            if (better(b, a)) {
+                std::swap(a, b);
+            }
+            winners_[node] = a;
+            losers_[node] = b;
+        }
+        winner_ = (k_ == 1) ? 0 : winners_[1];
+    }
+
+    // 叶子 leaf 的值发生变化（通常是当前胜者被推进）后重赛
+    template <typename Better>
+    void replay(int leaf, Better better) {
+        int w = leaf;
+        for (int node = (leaf + k_) / 2; node >= 1; node /= 2) {
+            if (better(losers_[node], w)) {
+                std::swap(losers_[node], w);
+            }
+        }
+        winner_ = w;
+    }
+
+private:
+    int k_;
+    int winner_;
+    std::vector<int> losers_;
+    std::vector<int> winners_; // 构建时的临时数组，复用避免重复分配
+};
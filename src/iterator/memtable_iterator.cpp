@@ -4,69 +4,133 @@
 
 static const std::string TOMBSTONE = "__TOMBSTONE__";
 
-MemTableIterator::MemTableIterator(const MemTable& mem, uint64_t snapshot_seq)
-    : mem_(mem), snapshot_seq_(snapshot_seq), it_(mem.get_table().end()), use_prefix_filter_(false) {
+MemTableIterator::MemTableIterator(const MemTable& mem, uint64_t snapshot_seq,
+                                   const ReadOptions& options)
+    : mem_(mem), snapshot_seq_(snapshot_seq), options_(options),
+      it_(mem.get_table().end()), current_(nullptr), use_prefix_filter_(false) {
 }
 
 void MemTableIterator::seek(const std::string& target) {
     use_prefix_filter_ = false;
-    it_ = mem_.get_table().lower_bound(target);
+    const std::string& start = std::max(target, options_.iterate_lower_bound);
+    it_ = mem_.get_table().lower_bound(start);
+    forward_to_visible();
+}
+
+void MemTableIterator::seek_for_prev(const std::string& target) {
+    use_prefix_filter_ = false;
+    const auto& table = mem_.get_table();
+    if (options_.has_upper_bound() && target >= options_.iterate_upper_bound) {
+        backward_from(table.lower_bound(options_.iterate_upper_bound));
+    } else {
+        backward_from(table.upper_bound(target));
+    }
 }
 
 void MemTableIterator::seek_to_first() {
+    seek(options_.iterate_lower_bound);
+}
+
+void MemTableIterator::seek_to_last() {
     use_prefix_filter_ = false;
-    it_ = mem_.get_table().begin();
+    const auto& table = mem_.get_table();
+    backward_from(options_.has_upper_bound()
+                      ? table.lower_bound(options_.iterate_upper_bound)
+                      : table.end());
 }
 
 void MemTableIterator::seek_with_prefix(const std::string& prefix) {
     use_prefix_filter_ = true;
     prefix_filter_ = prefix;
-    it_ = mem_.get_table().lower_bound(prefix);
-    
-    // 检查当前 key 是否匹配前缀
-    if (valid() && !key_matches_prefix()) {
-        it_ = mem_.get_table().end(); // 没有匹配的 key
-    }
+    const std::string& start = std::max(prefix, options_.iterate_lower_bound);
+    it_ = mem_.get_table().lower_bound(start);
+    forward_to_visible();
 }
 
 bool MemTableIterator::key_matches_prefix() const {
     if (!use_prefix_filter_) return true;
-    if (!valid()) return false;
-    const std::string& key = it_->first;
-    return key.size() >= prefix_filter_.size() && 
-           key.substr(0, prefix_filter_.size()) == prefix_filter_;
+    return Slice(it_->first).starts_with(prefix_filter_);
+}
+
+const VersionedValue* MemTableIterator::visible_version() const {
+    const auto& versions = it_->second;
+    // 从后往前遍历，找到 <= snapshot_seq 的第一个版本
+    for (auto rit = versions.rbegin(); rit != versions.rend(); ++rit) {
+        if (rit->seq <= snapshot_seq_) {
+            return &(*rit);
+        }
+    }
+    return nullptr;
+}
+
+void MemTableIterator::forward_to_visible() {
+    const auto end = mem_.get_table().end();
+    for (; it_ != end; ++it_) {
+        // 越过上界或前缀范围：后面的 key 只会更大，直接结束
+        if (!options_.below_upper_bound(it_->first) || !key_matches_prefix()) {
+            it_ = end;
+            break;
+        }
+        current_ = visible_version();
+        if (current_) return;
+    }
+    current_ = nullptr;
+}
+
+void MemTableIterator::backward_from(TableIter pos) {
+    const auto& table = mem_.get_table();
+    while (pos != table.begin()) {
+        --pos;
+        it_ = pos;
+        if (!options_.above_lower_bound(it_->first) || !key_matches_prefix()) {
+            break;
+        }
+        current_ = visible_version();
+        if (current_) return;
+    }
+    it_ = table.end();
+    current_ = nullptr;
 }
 
 void MemTableIterator::next() {
     if (valid()) {
         ++it_;
-        
-        // Prefix 过滤优化
-        if (use_prefix_filter_ && valid() && !key_matches_prefix()) {
-            it_ = mem_.get_table().end(); // 超出前缀范围
-        }
+        forward_to_visible();
+    }
+}
+
+void MemTableIterator::prev() {
+    if (valid()) {
+        backward_from(it_);
     }
 }
 
 bool MemTableIterator::valid() const {
-    return it_ != mem_.get_table().end();
+    return it_ != mem_.get_table().end() && current_ != nullptr;
 }
 
-std::string MemTableIterator::key() const {
-    if (!valid()) return "";
-    return it_->first;
+Slice MemTableIterator::key_slice() const {
+    if (!valid()) return Slice();
+    return Slice(it_->first);
 }
 
-std::string MemTableIterator::value() const {
-    if (!valid()) return "";
-    
-    const auto& versions = it_->second;
-    // 从后往前遍历，找到 <= snapshot_seq 的第一个版本
-    for (auto rit = versions.rbegin(); rit != versions.rend(); ++rit) {
-        if (rit->seq <= snapshot_seq_) {
-            if (rit->value == TOMBSTONE) return ""; // Tombstone 会被 MergeIterator 过滤
-            return rit->value;
+Slice MemTableIterator::value_slice() const {
+    if (!valid()) return Slice();
+    if (current_->value == TOMBSTONE) return Slice(); // Tombstone 会被 MergeIterator 过滤
+    // 合并条目：MergeIterator 只看每个数据源的最新版本，这里先把 MemTable 内的操作数链折叠好
+    if (MergeEntry::matches(current_->value)) {
+        if (merge_for_ != current_) {
+            MergeEntry entry;
+            mem_.get_merge_entry(it_->first, snapshot_seq_, entry);
+            merge_value_ = entry.encode();
+            merge_for_ = current_;
         }
+        return Slice(merge_value_);
     }
-    return "";
+    return Slice(current_->value);
+}
+
+uint64_t MemTableIterator::seq() const {
+    if (!valid()) return 0;
+    return current_->seq;
 }
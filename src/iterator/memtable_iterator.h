@@ -7,23 +7,40 @@
 
 class MemTableIterator : public Iterator {
 public:
-    MemTableIterator(const MemTable& mem, uint64_t snapshot_seq);
+    MemTableIterator(const MemTable& mem, uint64_t snapshot_seq,
+                     const ReadOptions& options = ReadOptions());
 
     void seek(const std::string& target) override;
+    void seek_for_prev(const std::string& target) override;
     void seek_to_first() override;
+    void seek_to_last() override;
     void seek_with_prefix(const std::string& prefix) override;
     void next() override;
+    void prev() override;
     bool valid() const override;
 
-    std::string key() const override;
-    std::string value() const override;
+    Slice key_slice() const override;
+    Slice value_slice() const override;
+    uint64_t seq() const override;
 
 private:
+    using TableIter = std::map<std::string, std::vector<VersionedValue>>::const_iterator;
+
     bool key_matches_prefix() const;
+    // 找到当前 key 在 snapshot 下的可见版本，没有则返回 nullptr
+    const VersionedValue* visible_version() const;
+    // 从 it_ 开始向前/向后找到第一个可见且在范围内的 key
+    void forward_to_visible();
+    void backward_from(TableIter pos);
     
     const MemTable& mem_;
     uint64_t snapshot_seq_;
-    std::map<std::string, std::vector<VersionedValue>>::const_iterator it_;
+    ReadOptions options_;
+    TableIter it_;
+    const VersionedValue* current_;
+    // 当前版本为合并条目时，折叠了 MemTable 中更旧版本的条目（第一次读取 value 时生成）
+    mutable const VersionedValue* merge_for_ = nullptr;
+    mutable std::string merge_value_;
     
     // Prefix 优化
     std::string prefix_filter_;
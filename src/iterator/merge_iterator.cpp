@@ -1,212 +1,411 @@
 #include "iterator/merge_iterator.h"
 #include <algorithm>
 
-MergeIterator::MergeIterator(std::vector<std::unique_ptr<Iterator>> children)
-    : children_(std::move(children)), is_valid_(false), use_prefix_filter_(false) {
-    init_heap();
+MergeIterator::MergeIterator(std::vector<std::unique_ptr<Iterator>> children,
+                             const ReadOptions& options,
+                             MergeRangeTombstones range_tombstones,
+                             MergeFolder merge_folder,
+                             bool emit_tombstones)
+    : children_(std::move(children)), states_(children_.size()),
+      direction_(Direction::FORWARD), options_(options),
+      is_valid_(false), current_child_(-1),
+      merge_folder_(std::move(merge_folder)), merged_(false), merged_seq_(0),
+      range_tombstones_(std::move(range_tombstones)),
+      has_range_tombstones_(!range_tombstones_.empty()),
+      emit_tombstones_(emit_tombstones),
+      use_prefix_filter_(false) {
+    range_tombstones_.per_child.resize(children_.size());
+    init_tree();
+    find_visible_entry();
 }
 
-void MergeIterator::init_heap() {
-    // 清空堆
-    while (!min_heap_.empty()) {
-        min_heap_.pop();
+bool MergeIterator::better(int a, int b) const {
+    const MergeChildState& sa = states_[a];
+    const MergeChildState& sb = states_[b];
+    if (!sa.valid || !sb.valid) {
+        return sa.valid && !sb.valid;
     }
-    
-    // 将所有有效的迭代器加入堆
+    int cmp = sa.key.compare(sb.key);
+    if (cmp != 0) {
+        return direction_ == Direction::FORWARD ? cmp < 0 : cmp > 0;
+    }
+    if (sa.seq != sb.seq) {
+        return sa.seq > sb.seq;
+    }
+    return a < b;
+}
+
+void MergeIterator::refresh_child(int id) {
+    MergeChildState& state = states_[id];
+    state.valid = children_[id]->valid();
+    if (state.valid) {
+        state.key = children_[id]->key_slice();
+        state.seq = children_[id]->seq();
+    }
+}
+
+void MergeIterator::init_tree() {
     for (int i = 0; i < (int)children_.size(); i++) {
-        if (children_[i]->valid()) {
-            min_heap_.emplace(i, children_[i]->key());
-        }
+        refresh_child(i);
     }
-    
-    // 设置当前状态
-    if (!min_heap_.empty()) {
-        const HeapNode& top = min_heap_.top();
-        current_key_ = top.key;
-        
-        // 找到相同 key 中最新的非墓碑版本
-        std::string best_value;
-        bool found_valid = false;
-        
-        // 收集所有相同 key 的值
-        std::vector<int> same_key_iterators;
-        while (!min_heap_.empty() && min_heap_.top().key == current_key_) {
-            same_key_iterators.push_back(min_heap_.top().iterator_id);
-            min_heap_.pop();
-        }
-        
-        // 按迭代器优先级顺序查找最新的非墓碑版本
-        for (int id : same_key_iterators) {
-            std::string value = children_[id]->value();
-            if (!value.empty()) {
-                current_value_ = value;
-                found_valid = true;
-                break; // 找到第一个非空值就停止（最高优先级的）
-            }
-        }
-        
-        is_valid_ = found_valid;
-        
-        // 将这些迭代器推进到下一个位置并重新加入堆
-        for (int id : same_key_iterators) {
-            advance_iterator(id);
-        }
+    tree_.build(static_cast<int>(children_.size()),
+                [this](int a, int b) { return better(a, b); });
+}
+
+void MergeIterator::advance_winner() {
+    int id = tree_.winner();
+    if (direction_ == Direction::FORWARD) {
+        children_[id]->next();
     } else {
-        is_valid_ = false;
+        children_[id]->prev();
     }
-    
-    // 如果当前记录是墓碑，跳过
-    if (is_valid_ && current_value_.empty()) {
-        skip_tombstones();
+    refresh_child(id);
+    tree_.replay(id, [this](int a, int b) { return better(a, b); });
+}
+
+void MergeIterator::skip_current_key() {
+    // 胜者推进后其 key 缓冲区可能失效，先把 key 拷到复用缓冲里再比较
+    skip_key_.assign(states_[tree_.winner()].key.data(), states_[tree_.winner()].key.size());
+    const Slice skip(skip_key_);
+    while (tree_.winner() >= 0 && states_[tree_.winner()].valid &&
+           states_[tree_.winner()].key == skip) {
+        advance_winner();
     }
 }
 
-void MergeIterator::advance_iterator(int id) {
-    children_[id]->next();
-    if (children_[id]->valid()) {
-        std::string next_key = children_[id]->key();
-        
-        // Prefix 过滤优化
-        if (use_prefix_filter_ && !(next_key.size() >= prefix_filter_.size() && 
-                                   next_key.substr(0, prefix_filter_.size()) == prefix_filter_)) {
-            return; // 不加入堆，因为超出了前缀范围
-        }
-        
-        min_heap_.emplace(id, next_key);
+bool MergeIterator::in_range(const Slice& key) const {
+    if (use_prefix_filter_ && !key.starts_with(prefix_filter_)) {
+        return false;
     }
+    return direction_ == Direction::FORWARD ? options_.below_upper_bound(key)
+                                            : options_.above_lower_bound(key);
 }
 
-void MergeIterator::skip_tombstones() {
-    while (!min_heap_.empty()) {
-        const HeapNode& top = min_heap_.top();
-        current_key_ = top.key;
+void MergeIterator::find_visible_entry() {
+    merged_ = false;
+    while (tree_.winner() >= 0 && states_[tree_.winner()].valid) {
+        int w = tree_.winner();
         
-        // 收集所有相同 key 的值
-        std::vector<int> same_key_iterators;
-        while (!min_heap_.empty() && min_heap_.top().key == current_key_) {
-            same_key_iterators.push_back(min_heap_.top().iterator_id);
-            min_heap_.pop();
+        // 超出范围：后续 key 只会更远，直接结束
+        if (!in_range(states_[w].key)) {
+            break;
         }
         
-        // 查找最新的非墓碑版本
-        bool found_valid = false;
-        for (int id : same_key_iterators) {
-            std::string value = children_[id]->value();
-            if (!value.empty()) {
-                current_value_ = value;
-                found_valid = true;
-                break;
+        // 被范围删除覆盖：更旧的数据源整段跳过，覆盖范围内剩下的 key 再逐个跳过
+        int source;
+        const FragmentedRangeTombstoneList::Fragment* fragment;
+        if (has_range_tombstones_ && covered_by_range_tombstone(w, source, fragment)) {
+            std::string covered_key = states_[w].key.to_string();
+            skip_fragment(source, *fragment);
+            int winner = tree_.winner();
+            if (winner >= 0 && states_[winner].valid && states_[winner].key == Slice(covered_key)) {
+                skip_current_key();
             }
+            continue;
         }
         
-        // 推进这些迭代器
-        for (int id : same_key_iterators) {
-            advance_iterator(id);
+        // 最新版本是合并条目：折叠该 key 的所有版本
+        Slice value = children_[w]->value_slice();
+        if (merge_folder_ && MergeEntry::matches(value.data(), value.size())) {
+            if (fold_merge_entry(w)) {
+                current_child_ = w;
+                is_valid_ = true;
+                return;
+            }
+            continue;
         }
         
-        if (found_valid) {
+        // 胜者即该 key 的最新版本；非墓碑则可见
+        if (!value.empty() || emit_tombstones_) {
+            current_child_ = w;
             is_valid_ = true;
             return;
         }
+        
+        // 最新版本是墓碑：整个 key 被删除，跳过所有旧版本
+        skip_current_key();
     }
     
     is_valid_ = false;
+    current_child_ = -1;
+}
+
+bool MergeIterator::fold_merge_entry(int w) {
+    merged_key_ = states_[w].key.to_string();
+    merged_seq_ = states_[w].seq;
+    MergeEntry entry;
+    MergeEntry::decode(children_[w]->value_slice().to_string(), entry);
+    advance_winner();
+    
+    // 同一 key 的更旧版本按数据源从新到旧依次胜出；每个数据源的最新版本已包含该源中更旧的操作数
+    const Slice key(merged_key_);
+    int source;
+    const FragmentedRangeTombstoneList::Fragment* fragment;
+    while (!entry.terminated() && tree_.winner() >= 0 && states_[tree_.winner()].valid &&
+           states_[tree_.winner()].key == key) {
+        int c = tree_.winner();
+        Slice value = children_[c]->value_slice();
+        if ((has_range_tombstones_ && covered_by_range_tombstone(c, source, fragment)) || value.empty()) {
+            entry.terminate_deleted();
+        } else if (MergeEntry::matches(value.data(), value.size())) {
+            MergeEntry older;
+            MergeEntry::decode(value.to_string(), older);
+            entry.absorb_older(std::move(older));
+        } else {
+            entry.terminate_with(value.to_string());
+        }
+        advance_winner();
+    }
+    if (tree_.winner() >= 0 && states_[tree_.winner()].valid && states_[tree_.winner()].key == key) {
+        skip_current_key();
+    }
+    
+    merged_ = merge_folder_(merged_key_, entry, merged_value_);
+    return merged_;
+}
+
+bool MergeIterator::covered_by_range_tombstone(int w, int& source,
+                                               const FragmentedRangeTombstoneList::Fragment*& fragment) {
+    const std::string key = states_[w].key.to_string();
+    const uint64_t seq = states_[w].seq;
+    // 只有不比胜者更旧的数据源才可能有更新的范围删除；从最新的数据源开始找
+    for (int i = 0; i <= w; i++) {
+        const auto& list = range_tombstones_.per_child[i];
+        if (!list) {
+            continue;
+        }
+        const FragmentedRangeTombstoneList::Fragment* found = list->find(key);
+        uint64_t tombstone_seq;
+        if (found && list->max_covering_seq(key, range_tombstones_.snapshot_seq, tombstone_seq) &&
+            tombstone_seq > seq) {
+            source = i;
+            fragment = found;
+            return true;
+        }
+    }
+    return false;
+}
+
+void MergeIterator::skip_fragment(int source, const FragmentedRangeTombstoneList::Fragment& fragment) {
+    const Slice start(fragment.start);
+    const Slice end(fragment.end);
+    for (int i = source + 1; i < (int)children_.size(); i++) {
+        Iterator& child = *children_[i];
+        if (!child.valid()) {
+            continue;
+        }
+        if (direction_ == Direction::FORWARD) {
+            if (child.key_slice().compare(end) < 0) {
+                child.seek(fragment.end);
+            }
+        } else if (child.key_slice().compare(start) >= 0) {
+            child.seek_for_prev(fragment.start);
+            if (child.valid() && child.key_slice() == start) {
+                child.prev();
+            }
+        }
+    }
+    init_tree();
+}
+
+void MergeIterator::switch_direction(Direction direction) {
+    std::string saved_key = key_slice().to_string();
+    direction_ = direction;
+    
+    for (auto& child : children_) {
+        if (direction == Direction::FORWARD) {
+            // 定位到第一个 > saved_key 的位置
+            child->seek(saved_key);
+            if (child->valid() && child->key_slice() == Slice(saved_key)) {
+                child->next();
+            }
+        } else {
+            // 定位到最后一个 < saved_key 的位置
+            child->seek_for_prev(saved_key);
+            if (child->valid() && child->key_slice() == Slice(saved_key)) {
+                child->prev();
+            }
+        }
+    }
+    init_tree();
 }
 
 void MergeIterator::seek(const std::string& target) {
     use_prefix_filter_ = false;
+    direction_ = Direction::FORWARD;
     
     // 所有子迭代器都 seek 到 target
     for (auto& it : children_) {
         it->seek(target);
     }
     
-    init_heap();
+    init_tree();
+    find_visible_entry();
+}
+
+void MergeIterator::seek_for_prev(const std::string& target) {
+    use_prefix_filter_ = false;
+    direction_ = Direction::REVERSE;
+    
+    for (auto& it : children_) {
+        it->seek_for_prev(target);
+    }
+    
+    init_tree();
+    find_visible_entry();
 }
 
 void MergeIterator::seek_to_first() {
     use_prefix_filter_ = false;
+    direction_ = Direction::FORWARD;
     
     // 所有子迭代器都 seek 到开始
     for (auto& it : children_) {
-        it->seek("");
+        it->seek_to_first();
+    }
+    
+    init_tree();
+    find_visible_entry();
+}
+
+void MergeIterator::seek_to_last() {
+    use_prefix_filter_ = false;
+    direction_ = Direction::REVERSE;
+    
+    for (auto& it : children_) {
+        it->seek_to_last();
     }
     
-    init_heap();
+    init_tree();
+    find_visible_entry();
 }
 
 void MergeIterator::seek_with_prefix(const std::string& prefix) {
     use_prefix_filter_ = true;
     prefix_filter_ = prefix;
+    direction_ = Direction::FORWARD;
     
-    // 所有子迭代器都 seek 到 prefix
+    // 子迭代器同样带前缀定位，越过前缀后立即停止
     for (auto& it : children_) {
-        it->seek(prefix);
+        it->seek_with_prefix(prefix);
     }
     
-    init_heap();
+    init_tree();
+    find_visible_entry();
 }
 
 void MergeIterator::next() {
     if (!is_valid_) return;
     
-    // 如果堆为空，说明没有更多数据
-    if (min_heap_.empty()) {
-        is_valid_ = false;
-        return;
-    }
-    
-    // 获取下一个最小的 key
-    const HeapNode& top = min_heap_.top();
-    current_key_ = top.key;
-    
-    // Prefix 过滤优化
-    if (use_prefix_filter_ && !(current_key_.size() >= prefix_filter_.size() && 
-                               current_key_.substr(0, prefix_filter_.size()) == prefix_filter_)) {
-        is_valid_ = false;
-        return;
-    }
-    
-    // 收集所有相同 key 的值
-    std::vector<int> same_key_iterators;
-    while (!min_heap_.empty() && min_heap_.top().key == current_key_) {
-        same_key_iterators.push_back(min_heap_.top().iterator_id);
-        min_heap_.pop();
-    }
-    
-    // 查找最新的非墓碑版本
-    bool found_valid = false;
-    for (int id : same_key_iterators) {
-        std::string value = children_[id]->value();
-        if (!value.empty()) {
-            current_value_ = value;
-            found_valid = true;
-            break;
-        }
-    }
-    
-    // 推进这些迭代器
-    for (int id : same_key_iterators) {
-        advance_iterator(id);
+    if (direction_ != Direction::FORWARD) {
+        switch_direction(Direction::FORWARD);
+    } else if (!merged_) {
+        skip_current_key();  // 折叠过的 key 已经越过
     }
+    find_visible_entry();
+}
+
+void MergeIterator::prev() {
+    if (!is_valid_) return;
     
-    if (!found_valid) {
-        skip_tombstones();
-    } else {
-        is_valid_ = true;
+    if (direction_ != Direction::REVERSE) {
+        switch_direction(Direction::REVERSE);
+    } else if (!merged_) {
+        skip_current_key();
     }
+    find_visible_entry();
 }
 
 bool MergeIterator::valid() const {
     return is_valid_;
 }
 
-std::string MergeIterator::key() const {
-    if (!is_valid_) return "";
-    return current_key_;
+Slice MergeIterator::key_slice() const {
+    if (!is_valid_) return Slice();
+    if (merged_) return Slice(merged_key_);
+    return states_[current_child_].key;
+}
+
+Slice MergeIterator::value_slice() const {
+    if (!is_valid_) return Slice();
+    if (merged_) return Slice(merged_value_);
+    return children_[current_child_]->value_slice();
+}
+
+uint64_t MergeIterator::seq() const {
+    if (!is_valid_) return 0;
+    if (merged_) return merged_seq_;
+    return states_[current_child_].seq;
 }
 
-std::string MergeIterator::value() const {
-    if (!is_valid_) return "";
-    return current_value_;
+MergeKeyWindow::MergeKeyWindow(std::vector<std::shared_ptr<const FragmentedRangeTombstoneList>> range_tombstones,
+                               MergeFolder merge_folder)
+    : range_tombstones_(std::move(range_tombstones)), merge_folder_(std::move(merge_folder)),
+      versions_(range_tombstones_.size()) {}
+
+void MergeKeyWindow::reset(const std::string& key) {
+    key_ = key;
+    for (auto& versions : versions_) {
+        versions.clear();
+    }
+}
+
+bool MergeKeyWindow::covered(const Candidate& candidate, uint64_t snapshot_seq) const {
+    for (size_t i = 0; i <= candidate.source; i++) {
+        const auto& list = range_tombstones_[i];
+        uint64_t tombstone_seq;
+        if (list && list->find(key_) && list->max_covering_seq(key_, snapshot_seq, tombstone_seq) &&
+            tombstone_seq > candidate.version->seq) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool MergeKeyWindow::resolve(uint64_t snapshot_seq, uint64_t& seq, std::string& value) {
+    // 每个数据源在该视图下的最新版本，按 MergeIterator 的胜出顺序排列：seq 大者优先，相同则更新的数据源优先
+    candidates_.clear();
+    for (size_t i = 0; i < versions_.size(); i++) {
+        for (const auto& version : versions_[i]) {
+            if (version.seq <= snapshot_seq) {
+                candidates_.push_back({i, &version});
+                break;
+            }
+        }
+    }
+    if (candidates_.empty()) {
+        return false;
+    }
+    std::sort(candidates_.begin(), candidates_.end(), [](const Candidate& a, const Candidate& b) {
+        if (a.version->seq != b.version->seq) {
+            return a.version->seq > b.version->seq;
+        }
+        return a.source < b.source;
+    });
+
+    const Candidate& newest = candidates_.front();
+    if (covered(newest, snapshot_seq)) {
+        return false;
+    }
+    seq = newest.version->seq;
+    if (!merge_folder_ || !MergeEntry::matches(newest.version->value)) {
+        value = newest.version->value;
+        return true;
+    }
+
+    MergeEntry entry;
+    MergeEntry::decode(newest.version->value, entry);
+    for (size_t i = 1; i < candidates_.size() && !entry.terminated(); i++) {
+        const std::string& older_value = candidates_[i].version->value;
+        if (covered(candidates_[i], snapshot_seq) || older_value.empty()) {
+            entry.terminate_deleted();
+        } else if (MergeEntry::matches(older_value)) {
+            MergeEntry older;
+            MergeEntry::decode(older_value, older);
+            entry.absorb_older(std::move(older));
+        } else {
+            entry.terminate_with(older_value);
+        }
+    }
+    return merge_folder_(key_, entry, value);
 }
@@ -1,49 +1,150 @@
 #pragma once
 #include "iterator/iterator.h"
+#include "iterator/loser_tree.h"
+#include "storage/range_tombstone.h"
+#include "storage/merge_operator.h"
+#include "storage/versioned_value.h"
 #include <vector>
 #include <memory>
-#include <queue>
+#include <functional>
+#include <cstdint>
+#include <string>
 
-// 堆节点，用于优先队列
-struct HeapNode {
-    int iterator_id;
-    std::string key;
+// 子迭代器当前位置的缓存，败者树比较时不再调用虚函数
+struct MergeChildState {
+    Slice key;        // 指向子迭代器内部缓冲区，不拷贝
+    uint64_t seq;
+    bool valid;
     
-    HeapNode(int id, const std::string& k) : iterator_id(id), key(k) {}
-    
-    // 最小堆比较器（key 小的优先级高）
-    bool operator>(const HeapNode& other) const {
-        return key > other.key;
+    MergeChildState() : seq(0), valid(false) {}
+};
+
+// 归并时生效的范围删除：per_child[i] 属于第 i 个子迭代器（可为空）。子迭代器按数据源从新到旧排列，
+// 某个数据源的范围删除覆盖所有更旧数据源在该范围内的数据，同一数据源内按序列号比较
+struct MergeRangeTombstones {
+    std::vector<std::shared_ptr<const FragmentedRangeTombstoneList>> per_child;
+    uint64_t snapshot_seq = UINT64_MAX;
+
+    bool empty() const {
+        for (const auto& list : per_child) {
+            if (list && !list->empty()) {
+                return false;
+            }
+        }
+        return true;
     }
 };
 
+// 最新版本为合并条目时，MergeIterator 把同一 key 各数据源中更旧的条目依次接上，直到遇到完整值、墓碑或
+// 范围删除（链终止）或者所有子迭代器都没有更旧的版本（链未终止），再交给折叠函数生成对外的 value。
+// 返回 false 表示跳过该 key
+using MergeFolder = std::function<bool(const std::string& key, MergeEntry& entry, std::string& value)>;
+
+// 多路归并迭代器
+// 按内部 key 顺序 (user key ASC, seq DESC) 归并：同一 user key 的最新版本总是先胜出，
+// 被遮蔽的旧版本只推进子迭代器，不读取 value。
+// emit_tombstones 供压缩使用：最新版本为墓碑的 key 也作为条目返回（value 为空），由调用方决定能否丢弃
 class MergeIterator : public Iterator {
 public:
-    MergeIterator(std::vector<std::unique_ptr<Iterator>> children);
+    MergeIterator(std::vector<std::unique_ptr<Iterator>> children,
+                  const ReadOptions& options = ReadOptions(),
+                  MergeRangeTombstones range_tombstones = MergeRangeTombstones(),
+                  MergeFolder merge_folder = MergeFolder(),
+                  bool emit_tombstones = false);
 
     void seek(const std::string& target) override;
-    void seek_to_first();
-    void seek_with_prefix(const std::string& prefix);
+    void seek_for_prev(const std::string& target) override;
+    void seek_to_first() override;
+    void seek_to_last() override;
+    void seek_with_prefix(const std::string& prefix) override;
     void next() override;
+    void prev() override;
     bool valid() const override;
 
-    std::string key() const override;
-    std::string value() const override;
+    Slice key_slice() const override;
+    Slice value_slice() const override;
+    uint64_t seq() const override;
 
 private:
-    void init_heap(); // 初始化堆
-    void advance_iterator(int id); // 推进指定迭代器并更新堆
-    void skip_tombstones(); // 跳过墓碑记录
+    enum class Direction { FORWARD, REVERSE };
+
+    // 叶子 a 是否胜过叶子 b：有效者优先；正向 key 小者优先，反向 key 大者优先；
+    // key 相同时 seq 大者（更新）优先，seq 也相同则迭代器 id 小者（更新的数据源）优先
+    bool better(int a, int b) const;
+    void refresh_child(int id);
+    void init_tree(); // 用所有子迭代器的当前位置重建败者树
+    // 推进当前胜者并重赛
+    void advance_winner();
+    // 跳过所有与 skip_key_ 相同的条目（被遮蔽的旧版本）
+    void skip_current_key();
+    // 从胜者开始找到第一个非墓碑、未被范围删除覆盖的 key
+    void find_visible_entry();
+    // 胜者为合并条目：收集该 key 的所有更旧版本并折叠，子迭代器随之越过该 key
+    bool fold_merge_entry(int w);
+    // 胜者是否被某个数据源的范围删除覆盖（该范围删除的序列号大于胜者），返回最新的那个数据源
+    bool covered_by_range_tombstone(int w, int& source,
+                                    const FragmentedRangeTombstoneList::Fragment*& fragment);
+    // 比 source 更旧的子迭代器直接定位到片段之外，不逐个访问片段内的 key
+    void skip_fragment(int source, const FragmentedRangeTombstoneList::Fragment& fragment);
+    bool in_range(const Slice& key) const;
+    // 切换迭代方向：以当前 key 为基准重新定位所有子迭代器
+    void switch_direction(Direction direction);
 
     std::vector<std::unique_ptr<Iterator>> children_;
-    std::priority_queue<HeapNode, std::vector<HeapNode>, std::greater<HeapNode>> min_heap_;
+    std::vector<MergeChildState> states_;
+    LoserTree tree_;
+    Direction direction_;
+    ReadOptions options_;
     
     // 当前状态
     bool is_valid_;
-    std::string current_key_;
-    std::string current_value_;
+    int current_child_;
+    std::string skip_key_; // 复用的 key 缓冲，跳过重复 key 时使用
+    
+    // 合并：当前 key 由折叠得到时，key/value/seq 取自这里（子迭代器已越过该 key）
+    MergeFolder merge_folder_;
+    bool merged_;
+    std::string merged_key_;
+    std::string merged_value_;
+    uint64_t merged_seq_;
+    
+    MergeRangeTombstones range_tombstones_;
+    bool has_range_tombstones_;
+    bool emit_tombstones_;
     
     // Prefix 优化相关
     std::string prefix_filter_;
     bool use_prefix_filter_;
 };
+
+// 同一 key 在各数据源中的全部版本（数据源按从新到旧排列，与 range_tombstones 一一对应；每个数据源内 seq DESC，
+// 墓碑为空值）。resolve 按 MergeIterator 的规则（范围删除覆盖、合并条目折叠、墓碑）解析出 snapshot_seq 时刻
+// 看到的版本：压缩读一遍输入即可得到最新视图与各个快照的视图，不必为每个快照重新归并
+class MergeKeyWindow {
+public:
+    MergeKeyWindow(std::vector<std::shared_ptr<const FragmentedRangeTombstoneList>> range_tombstones,
+                   MergeFolder merge_folder);
+
+    // 换到新的 key，清空各数据源的版本
+    void reset(const std::string& key);
+    const std::string& key() const { return key_; }
+    std::vector<VersionedValue>& versions(size_t source) { return versions_[source]; }
+
+    // 返回 false 表示该视图下 key 不可见（没有版本、被范围删除覆盖或折叠函数跳过）；墓碑以空 value 返回
+    bool resolve(uint64_t snapshot_seq, uint64_t& seq, std::string& value);
+
+private:
+    struct Candidate {
+        size_t source;
+        const VersionedValue* version;
+    };
+
+    // 与 MergeIterator::covered_by_range_tombstone 相同：不比该版本更旧的数据源中有更新的范围删除
+    bool covered(const Candidate& candidate, uint64_t snapshot_seq) const;
+
+    std::vector<std::shared_ptr<const FragmentedRangeTombstoneList>> range_tombstones_;
+    MergeFolder merge_folder_;
+    std::string key_;
+    std::vector<std::vector<VersionedValue>> versions_;
+    std::vector<Candidate> candidates_;  // 复用的缓冲
+};
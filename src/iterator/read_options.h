@@ -0,0 +1,28 @@
+#pragma once
+#include "storage/slice.h"
+#include <string>
+#include <cstddef>
+
+// 迭代器读取选项
+struct ReadOptions {
+    // 迭代范围 [iterate_lower_bound, iterate_upper_bound)
+    // 空字符串表示不设边界；子迭代器越过边界后立即失效，不再继续读盘
+    std::string iterate_lower_bound;
+    std::string iterate_upper_bound;
+
+    // SSTable 预读大小（字节），0 表示自适应：顺序访问时窗口逐步翻倍
+    size_t readahead_size = 0;
+
+    bool has_lower_bound() const { return !iterate_lower_bound.empty(); }
+    bool has_upper_bound() const { return !iterate_upper_bound.empty(); }
+
+    // key 是否小于上界（上界为开区间）
+    bool below_upper_bound(const Slice& key) const {
+        return !has_upper_bound() || key < Slice(iterate_upper_bound);
+    }
+
+    // key 是否不小于下界（下界为闭区间）
+    bool above_lower_bound(const Slice& key) const {
+        return !has_lower_bound() || key >= Slice(iterate_lower_bound);
+    }
+};
@@ -1,54 +1,28 @@
 #include "iterator/sstable_iterator.h"
 #include "sstable/sstable_reader.h"
+#include "sstable/data_block.h"
 #include "bloom/bloom_filter.h"
 #include <sstream>
 #include <algorithm>
+#include <cstring>
+#include <stdexcept>
 
-static const std::string TOMBSTONE = "__TOMBSTONE__";
+static const Slice TOMBSTONE("__TOMBSTONE__");
 
-static SSTableFooter read_footer(std::ifstream& in) {
-    in.seekg(0, std::ios::end);
-    std::streampos file_size = in.tellg();
-
-    std::string last_line;
-    long pos = (long)file_size - 1;
-
-    in.seekg(pos);
-    char c;
-    while (pos > 0 && in.get(c) && c == '\n') {
-        pos--;
-        in.seekg(pos);
+SSTableIterator::SSTableIterator(const SSTableMeta& meta, uint64_t snapshot_seq,
+                                 const ReadOptions& options)
+    : meta_(meta), snapshot_seq_(snapshot_seq), options_(options),
+      data_end_(0), current_index_pos_(-1), block_format_(false), loaded_block_(-1),
+      is_valid_(false), current_seq_(0),
+      readahead_offset_(0), readahead_size_(kInitialReadahead), bytes_read_(0),
+      use_prefix_filter_(false) {
+    if (options_.readahead_size > 0) {
+        readahead_size_ = options_.readahead_size;
     }
-
-    while (pos > 0) {
-        in.seekg(pos);
-        in.get(c);
-        if (c == '\n') {
-            pos++;
-            break;
-        }
-        pos--;
-    }
-    
-    in.clear();
-    in.seekg(pos);
-    std::getline(in, last_line);
-
-    SSTableFooter footer = {0, 0};
-    std::istringstream iss(last_line);
-    iss >> footer.index_offset >> footer.bloom_offset;
-
-    return footer;
-}
-
-SSTableIterator::SSTableIterator(const SSTableMeta& meta, uint64_t snapshot_seq)
-    : meta_(meta), snapshot_seq_(snapshot_seq),
-      current_index_pos_(-1), current_version_pos_(-1),
-      is_valid_(false), use_prefix_filter_(false) {
-    file_.open(meta_.filename);
+    file_.open(meta_.filename, std::ios::binary);
     if (file_.is_open()) {
         load_index();
-        if (!index_.empty()) {
+        if (num_entries() > 0) {
             seek_to_first(); // 定位到第一个 key
         }
     }
@@ -61,11 +35,26 @@ SSTableIterator::~SSTableIterator() {
 }
 
 void SSTableIterator::load_index() {
-    SSTableFooter footer = read_footer(file_);
+    SSTableFooter footer = SSTableReader::read_footer(file_);
+    data_end_ = footer.index_offset;
     
     file_.clear();
     file_.seekg(footer.index_offset);
     
+    if (footer.block_format == 2) {
+        try {
+            block_index_.deserialize(file_);
+        } catch (const std::exception&) {
+            return;  // 块索引损坏：按空文件处理
+        }
+        block_format_ = true;
+        block_start_.assign(1, 0);
+        for (uint32_t i = 0; i < block_index_.get_block_count(); i++) {
+            block_start_.push_back(block_start_.back() + static_cast<int>(block_index_.get_block(i)->num_entries));
+        }
+        return;
+    }
+    
     std::string line;
     while (std::getline(file_, line)) {
         // 检查是否是 footer 行（包含 bloom filter 的二进制数据）
@@ -84,161 +73,312 @@ void SSTableIterator::load_index() {
     }
 }
 
-void SSTableIterator::load_data_block() {
-    if (current_index_pos_ < 0 || current_index_pos_ >= (int)index_.size()) {
-        return;
+int SSTableIterator::num_entries() const {
+    return block_format_ ? block_start_.back() : static_cast<int>(index_.size());
+}
+
+void SSTableIterator::load_block(int block, bool forward) {
+    if (block == loaded_block_) return;
+    loaded_block_ = block;
+    block_keys_.clear();
+    block_payloads_.clear();
+    
+    const BlockIndexEntry* entry = block_index_.get_block(block);
+    const char* p = read_range(entry->offset, entry->offset + entry->size, forward);
+    if (p) {
+        DataBlockReader(p, entry->size).decode_entries(block_keys_, block_payloads_);
+    }
+    // 块损坏时补齐到块索引记录的条目数：空 payload 没有可见版本，会被跳过
+    size_t expected = static_cast<size_t>(block_start_[block + 1] - block_start_[block]);
+    block_keys_.resize(expected);
+    block_payloads_.resize(expected);
+}
+
+const std::string& SSTableIterator::key_at(int pos, bool forward) {
+    if (!block_format_) {
+        return index_[pos].first;
+    }
+    int block = static_cast<int>(std::upper_bound(block_start_.begin(), block_start_.end(), pos) -
+                                 block_start_.begin()) - 1;
+    load_block(block, forward);
+    return block_keys_[pos - block_start_[block]];
+}
+
+const std::string& SSTableIterator::current_key() const {
+    // 定位成功时当前条目所在的块总是已读入
+    return block_format_ ? block_keys_[current_index_pos_ - block_start_[loaded_block_]]
+                         : index_[current_index_pos_].first;
+}
+
+const char* SSTableIterator::read_range(uint64_t begin, uint64_t end, bool forward) {
+    // 命中预读缓冲区
+    if (!readahead_buf_.empty() && begin >= readahead_offset_ &&
+        end <= readahead_offset_ + readahead_buf_.size()) {
+        return readahead_buf_.data() + (begin - readahead_offset_);
     }
     
-    current_versions_.clear();
-    current_version_pos_ = -1;
+    // 顺序访问：请求从上一次读取区域的内部或末尾继续（反向时为开头），预读窗口翻倍
+    uint64_t buf_end = readahead_offset_ + readahead_buf_.size();
+    bool sequential = !readahead_buf_.empty() &&
+        (forward ? (begin >= readahead_offset_ && begin <= buf_end)
+                 : (end >= readahead_offset_ && end <= buf_end));
+    if (options_.readahead_size == 0) {
+        readahead_size_ = sequential ? std::min(readahead_size_ * 2, kMaxReadahead)
+                                     : kInitialReadahead;
+    }
     
-    uint64_t offset = index_[current_index_pos_].second;
+    uint64_t read_begin = begin;
+    uint64_t read_end = end;
+    if (forward) {
+        read_end = std::max(end, std::min<uint64_t>(data_end_, begin + readahead_size_));
+    } else if (end > readahead_size_) {
+        read_begin = std::min<uint64_t>(begin, end - readahead_size_);
+    } else {
+        read_begin = 0;
+    }
+    
+    readahead_buf_.resize(read_end - read_begin);
     file_.clear();
-    file_.seekg(offset);
+    file_.seekg(read_begin);
+    file_.read(&readahead_buf_[0], readahead_buf_.size());
+    readahead_buf_.resize(file_.gcount());
+    readahead_offset_ = read_begin;
+    bytes_read_ += readahead_buf_.size();
     
-    std::string line;
-    std::string first_key;
+    if (end > readahead_offset_ + readahead_buf_.size()) {
+        return nullptr; // 文件被截断
+    }
+    return readahead_buf_.data() + (begin - readahead_offset_);
+}
+
+bool SSTableIterator::load_visible_version(int pos, bool forward) {
+    if (block_format_) {
+        // key_at 已读入 pos 所在的块；同一 key 的版本按 seq DESC 排列
+        Slice payload = block_payloads_[pos - block_start_[loaded_block_]];
+        uint64_t seq = 0;
+        Slice value;
+        if (!DataBlockReader::visible_version(payload, meta_.global_seq != 0 ? UINT64_MAX : snapshot_seq_, seq,
+                                              value)) {
+            return false;
+        }
+        if (meta_.global_seq != 0) {
+            seq = meta_.global_seq;  // 外部导入文件
+            if (seq > snapshot_seq_) return false;
+        }
+        current_value_ = (value == TOMBSTONE) ? Slice() : value;
+        current_seq_ = seq;
+        return true;
+    }
     
-    // 读取该 key 的所有版本
-    while (std::getline(file_, line)) {
-        std::istringstream iss(line);
-        std::string key;
-        uint64_t seq;
-        std::string value;
+    uint64_t begin = index_[pos].second;
+    uint64_t end = (pos + 1 < (int)index_.size()) ? index_[pos + 1].second : data_end_;
+    if (end <= begin) return false;
+    
+    const char* p = read_range(begin, end, forward);
+    if (!p) return false;
+    const char* limit = p + (end - begin);
+    
+    // 数据格式：每行 "key seq value"，同一 key 的版本按 seq DESC 排列
+    while (p < limit) {
+        const char* eol = static_cast<const char*>(std::memchr(p, '\n', limit - p));
+        if (!eol) eol = limit;
         
-        if (!(iss >> key >> seq >> value)) {
-            break; // 读到下一个 key 或文件结束
-        }
+        const char* sp1 = static_cast<const char*>(std::memchr(p, ' ', eol - p));
+        if (!sp1) break;
+        const char* seq_begin = sp1 + 1;
+        const char* sp2 = static_cast<const char*>(std::memchr(seq_begin, ' ', eol - seq_begin));
+        const char* seq_end = sp2 ? sp2 : eol;
         
-        if (first_key.empty()) {
-            first_key = key;
+        uint64_t seq = 0;
+        for (const char* q = seq_begin; q < seq_end; ++q) {
+            seq = seq * 10 + static_cast<uint64_t>(*q - '0');
         }
-        
-        if (key != first_key) {
-            break; // 读到下一个 key
+        if (meta_.global_seq != 0) {
+            seq = meta_.global_seq;  // 外部导入文件
         }
         
-        current_versions_.emplace_back(seq, value);
+        // 第一个 <= snapshot_seq 的版本即为可见版本（即使是 Tombstone）
+        if (seq <= snapshot_seq_) {
+            Slice value = sp2 ? Slice(sp2 + 1, eol - sp2 - 1) : Slice();
+            // Tombstone 以空值返回，由 MergeIterator 遮蔽旧版本
+            current_value_ = (value == TOMBSTONE) ? Slice() : value;
+            current_seq_ = seq;
+            return true;
+        }
+        p = eol + 1;
     }
-    
-    // 按 seq DESC 排序（最新版本在前）
-    std::sort(current_versions_.begin(), current_versions_.end(),
-              [](const auto& a, const auto& b) {
-                  return a.first > b.first; // DESC
-              });
-    
-    find_next_valid_version();
+    return false;
 }
 
-void SSTableIterator::find_next_valid_version() {
-    current_value_ = "";
-    is_valid_ = false;
-    
-    // 找到 <= snapshot_seq 的第一个版本
-    for (size_t i = 0; i < current_versions_.size(); i++) {
-        if (current_versions_[i].first <= snapshot_seq_) {
-            if (current_versions_[i].second != TOMBSTONE) {
-                current_value_ = current_versions_[i].second;
-                current_version_pos_ = i;
-                is_valid_ = true;
+void SSTableIterator::current_versions(std::vector<VersionedValue>& versions) {
+    versions.clear();
+    if (!is_valid_) return;
+    if (block_format_) {
+        DataBlockReader::decode_versions(block_payloads_[current_index_pos_ - block_start_[loaded_block_]], versions);
+    } else {
+        uint64_t begin = index_[current_index_pos_].second;
+        uint64_t end = (current_index_pos_ + 1 < (int)index_.size()) ? index_[current_index_pos_ + 1].second
+                                                                     : data_end_;
+        const char* p = end > begin ? read_range(begin, end, true) : nullptr;
+        const char* limit = p ? p + (end - begin) : nullptr;
+        while (p && p < limit) {
+            const char* eol = static_cast<const char*>(std::memchr(p, '\n', limit - p));
+            if (!eol) eol = limit;
+            const char* sp1 = static_cast<const char*>(std::memchr(p, ' ', eol - p));
+            if (!sp1) break;
+            const char* seq_begin = sp1 + 1;
+            const char* sp2 = static_cast<const char*>(std::memchr(seq_begin, ' ', eol - seq_begin));
+            const char* seq_end = sp2 ? sp2 : eol;
+            uint64_t seq = 0;
+            for (const char* q = seq_begin; q < seq_end; ++q) {
+                seq = seq * 10 + static_cast<uint64_t>(*q - '0');
             }
-            break; // 找到可见版本（即使是 Tombstone 也停止）
+            versions.emplace_back(seq, sp2 ? std::string(sp2 + 1, eol - sp2 - 1) : std::string());
+            p = eol + 1;
+        }
+    }
+    for (auto& version : versions) {
+        if (version.value == TOMBSTONE) {
+            version.value.clear();
         }
     }
+    // 外部导入文件：与 load_visible_version 一致，只有第一个版本可见
+    if (meta_.global_seq != 0 && !versions.empty()) {
+        versions.resize(1);
+        versions[0].seq = meta_.global_seq;
+    }
+}
+
+bool SSTableIterator::key_matches_prefix(const std::string& key) const {
+    if (!use_prefix_filter_) return true;
+    return Slice(key).starts_with(prefix_filter_);
+}
+
+void SSTableIterator::invalidate() {
+    is_valid_ = false;
+    current_value_.clear();
+    current_index_pos_ = num_entries();
+}
+
+void SSTableIterator::forward_from(int pos) {
+    for (; pos < num_entries(); ++pos) {
+        const std::string& key = key_at(pos, true);
+        // 越过上界或前缀范围：后面的 key 只会更大，不再读盘
+        if (!options_.below_upper_bound(key) || !key_matches_prefix(key)) {
+            break;
+        }
+        if (load_visible_version(pos, true)) {
+            current_index_pos_ = pos;
+            is_valid_ = true;
+            return;
+        }
+    }
+    invalidate();
+}
+
+void SSTableIterator::backward_from(int pos) {
+    for (; pos >= 0; --pos) {
+        const std::string& key = key_at(pos, false);
+        if (!options_.above_lower_bound(key) || !key_matches_prefix(key)) {
+            break;
+        }
+        if (load_visible_version(pos, false)) {
+            current_index_pos_ = pos;
+            is_valid_ = true;
+            return;
+        }
+    }
+    invalidate();
 }
 
 void SSTableIterator::seek(const std::string& target) {
     use_prefix_filter_ = false;
-    
-    // 在 index 中二分查找
-    int l = 0, r = (int)index_.size() - 1;
-    int pos = -1;
-    
-    while (l <= r) {
-        int mid = (l + r) / 2;
-        if (index_[mid].first >= target) {
-            pos = mid;
-            r = mid - 1;
+    forward_from(lower_bound_pos(std::max(target, options_.iterate_lower_bound)));
+}
+
+int SSTableIterator::find_pos(const std::string& target, bool inclusive) {
+    auto before = [&](const std::string& key) { return inclusive ? key < target : key <= target; };
+    if (!block_format_) {
+        // 在 index 中二分查找第一个 >= target（或 > target）的 key
+        auto it = std::partition_point(index_.begin(), index_.end(),
+            [&](const std::pair<std::string, uint64_t>& e) { return before(e.first); });
+        return static_cast<int>(it - index_.begin());
+    }
+    // 先按块的 last_key 找到第一个可能含有目标的块，再在块内二分
+    int left = 0;
+    int right = static_cast<int>(block_index_.get_block_count());
+    while (left < right) {
+        int mid = left + (right - left) / 2;
+        if (before(block_index_.get_block(mid)->last_key)) {
+            left = mid + 1;
         } else {
-            l = mid + 1;
+            right = mid;
         }
     }
-    
-    if (pos == -1) {
-        current_index_pos_ = index_.size(); // 超出范围
-        is_valid_ = false;
-        return;
+    if (left == static_cast<int>(block_index_.get_block_count())) {
+        return num_entries();
     }
-    
-    current_index_pos_ = pos;
-    current_key_ = index_[pos].first;
-    load_data_block();
+    load_block(left, true);
+    auto it = std::partition_point(block_keys_.begin(), block_keys_.end(), before);
+    return block_start_[left] + static_cast<int>(it - block_keys_.begin());
 }
 
-void SSTableIterator::seek_to_first() {
+void SSTableIterator::seek_for_prev(const std::string& target) {
     use_prefix_filter_ = false;
     
-    if (index_.empty()) {
-        is_valid_ = false;
+    if (options_.has_upper_bound() && target >= options_.iterate_upper_bound) {
+        // 上界是开区间：定位到最后一个 < upper_bound 的 key
+        backward_from(lower_bound_pos(options_.iterate_upper_bound) - 1);
         return;
     }
-    
-    current_index_pos_ = 0;
-    current_key_ = index_[0].first;
-    load_data_block();
+    backward_from(find_pos(target, false) - 1);
+}
+
+void SSTableIterator::seek_to_first() {
+    seek(options_.iterate_lower_bound);
+}
+
+void SSTableIterator::seek_to_last() {
+    if (options_.has_upper_bound()) {
+        seek_for_prev(options_.iterate_upper_bound);
+    } else {
+        use_prefix_filter_ = false;
+        backward_from(num_entries() - 1);
+    }
 }
 
 void SSTableIterator::seek_with_prefix(const std::string& prefix) {
     use_prefix_filter_ = true;
     prefix_filter_ = prefix;
-    
-    // 使用二分查找找到第一个 >= prefix 的 key
-    seek(prefix);
-    
-    // 检查当前 key 是否匹配前缀
-    if (valid() && !key_matches_prefix()) {
-        is_valid_ = false;
-    }
+    forward_from(lower_bound_pos(std::max(prefix, options_.iterate_lower_bound)));
 }
 
-bool SSTableIterator::key_matches_prefix() const {
-    if (!use_prefix_filter_) return true;
-    return current_key_.size() >= prefix_filter_.size() && 
-           current_key_.substr(0, prefix_filter_.size()) == prefix_filter_;
+void SSTableIterator::next() {
+    if (!valid()) return;
+    forward_from(current_index_pos_ + 1);
 }
 
-void SSTableIterator::next() {
+void SSTableIterator::prev() {
     if (!valid()) return;
-    
-    // 移动到下一个 key
-    current_index_pos_++;
-    if (current_index_pos_ >= (int)index_.size()) {
-        is_valid_ = false;
-        return;
-    }
-    
-    current_key_ = index_[current_index_pos_].first;
-    
-    // Prefix 过滤优化
-    if (use_prefix_filter_ && !key_matches_prefix()) {
-        is_valid_ = false;
-        return;
-    }
-    
-    load_data_block();
+    backward_from(current_index_pos_ - 1);
 }
 
 bool SSTableIterator::valid() const {
     return is_valid_ && current_index_pos_ >= 0 && 
-           current_index_pos_ < (int)index_.size();
+           current_index_pos_ < num_entries();
 }
 
-std::string SSTableIterator::key() const {
-    if (!valid()) return "";
-    return current_key_;
+Slice SSTableIterator::key_slice() const {
+    if (!valid()) return Slice();
+    return Slice(current_key());
 }
 
-std::string SSTableIterator::value() const {
-    if (!valid()) return "";
+Slice SSTableIterator::value_slice() const {
+    if (!valid()) return Slice();
     return current_value_;
 }
+
+uint64_t SSTableIterator::seq() const {
+    if (!valid()) return 0;
+    return current_seq_;
+}
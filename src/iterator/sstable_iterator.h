@@ -1,50 +1,91 @@
 #pragma once
 #include "iterator/iterator.h"
 #include "sstable/sstable_meta.h"
+#include "sstable/sstable_reader.h"
+#include "sstable/block_index.h"
+#include "storage/versioned_value.h"
 #include <fstream>
 #include <vector>
 #include <cstdint>
 
-struct SSTableFooter {
-    uint64_t index_offset;
-    uint64_t bloom_offset;
-};
-
 class SSTableIterator : public Iterator {
 public:
-    SSTableIterator(const SSTableMeta& meta, uint64_t snapshot_seq);
+    SSTableIterator(const SSTableMeta& meta, uint64_t snapshot_seq,
+                    const ReadOptions& options = ReadOptions());
     ~SSTableIterator();
 
     void seek(const std::string& target) override;
+    void seek_for_prev(const std::string& target) override;
     void seek_to_first() override;
+    void seek_to_last() override;
     void seek_with_prefix(const std::string& prefix) override;
     void next() override;
+    void prev() override;
     bool valid() const override;
 
-    std::string key() const override;
-    std::string value() const override;
+    Slice key_slice() const override;
+    Slice value_slice() const override;
+    uint64_t seq() const override;
+
+    // 当前 key 在本文件中的全部版本（seq DESC，墓碑为空值），不受 snapshot_seq 限制；
+    // 供压缩单遍归并时按各个快照自行挑选版本
+    void current_versions(std::vector<VersionedValue>& versions);
+
+    // 预读统计
+    size_t current_readahead_size() const { return readahead_size_; }
+    uint64_t bytes_read() const { return bytes_read_; }
+
+    static constexpr size_t kInitialReadahead = 8 * 1024;    // 8KB
+    static constexpr size_t kMaxReadahead = 256 * 1024;      // 256KB
 
 private:
     void load_index();
-    void load_data_block();
-    void find_next_valid_version();
-    bool key_matches_prefix() const;
+    // 第一个 key >= target（inclusive）或 > target 的位置；块格式下会读入该位置所在的块
+    int find_pos(const std::string& target, bool inclusive);
+    int lower_bound_pos(const std::string& target) { return find_pos(target, true); }
+    int num_entries() const;
+    // pos 处的 key；块格式下先读入 pos 所在的块
+    const std::string& key_at(int pos, bool forward);
+    const std::string& current_key() const;
+    // 读入第 block 块并解码出全部 key
+    void load_block(int block, bool forward);
+    // 从 pos 开始向前/向后找到第一个有可见版本且在范围内的 key
+    void forward_from(int pos);
+    void backward_from(int pos);
+    // 解析 pos 处 key 的所有版本，找到 snapshot 下可见的版本
+    bool load_visible_version(int pos, bool forward);
+    // 读取文件区间 [begin, end)，返回指向预读缓冲区的指针
+    const char* read_range(uint64_t begin, uint64_t end, bool forward);
+    bool key_matches_prefix(const std::string& key) const;
+    void invalidate();
     
     SSTableMeta meta_;
     uint64_t snapshot_seq_;
+    ReadOptions options_;
     std::ifstream file_;
     
-    // Index: key -> offset
+    // 文本格式的 Index: key -> offset
     std::vector<std::pair<std::string, uint64_t>> index_;
-    int current_index_pos_;
+    uint64_t data_end_;   // 数据区结束位置（即 index_offset）
+    int current_index_pos_;  // 块格式下为全文件的条目序号
     
-    // Current data block for current key
-    std::vector<std::pair<uint64_t, std::string>> current_versions_; // (seq, value)
-    int current_version_pos_;
+    // 块格式（ENHANCED_SSTABLE_V2）：块索引常驻，数据块按需读入
+    bool block_format_;
+    BlockIndex block_index_;
+    std::vector<int> block_start_;  // 每块第一个条目的序号，末尾为条目总数
+    int loaded_block_;
+    std::vector<std::string> block_keys_;
+    std::vector<Slice> block_payloads_;  // 指向预读缓冲区
     
     bool is_valid_;
-    std::string current_key_;
-    std::string current_value_;
+    Slice current_value_; // 指向预读缓冲区
+    uint64_t current_seq_;
+    
+    // 预读缓冲区：顺序访问时窗口从 kInitialReadahead 翻倍增长到 kMaxReadahead
+    std::string readahead_buf_;
+    uint64_t readahead_offset_;
+    size_t readahead_size_;
+    uint64_t bytes_read_;
     
     // Prefix 优化
     std::string prefix_filter_;
@@ -0,0 +1,23 @@
+#include "iterator/ttl_iterator.h"
+
+TtlIterator::TtlIterator(std::unique_ptr<Iterator> inner, uint64_t ttl_seconds)
+    : inner_(std::move(inner)), ttl_(ttl_seconds), now_(TtlCompactionFilter::now()) {
+    if (inner_->valid()) {
+        skip_expired(true);
+    }
+}
+
+void TtlIterator::skip_expired(bool forward) {
+    while (inner_->valid()) {
+        uint64_t timestamp = 0;
+        if (!TtlCompactionFilter::decode(inner_->value(), value_, timestamp) || !ttl_.is_expired(timestamp, now_)) {
+            return;
+        }
+        if (forward) {
+            inner_->next();
+        } else {
+            inner_->prev();
+        }
+    }
+    value_.clear();
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "iterator/iterator.h"
+#include "compaction/compaction_filter.h"
+#include <memory>
+#include <string>
+
+// 包装开启 TTL 的列族上的迭代器：跳过已过期的条目，值去掉写入时间戳后返回。
+// 同一 key 只有最新版本会出现在这里，它过期时更旧的版本也必然过期，因此整个 key 都被跳过
+class TtlIterator : public Iterator {
+public:
+    TtlIterator(std::unique_ptr<Iterator> inner, uint64_t ttl_seconds);
+
+    bool valid() const override { return inner_->valid(); }
+    void next() override { inner_->next(); skip_expired(true); }
+    void prev() override { inner_->prev(); skip_expired(false); }
+
+    Slice key_slice() const override { return inner_->key_slice(); }
+    Slice value_slice() const override { return Slice(value_); }
+    uint64_t seq() const override { return inner_->seq(); }
+
+    void seek(const std::string& target) override { inner_->seek(target); skip_expired(true); }
+    void seek_for_prev(const std::string& target) override { inner_->seek_for_prev(target); skip_expired(false); }
+    void seek_to_first() override { inner_->seek_to_first(); skip_expired(true); }
+    void seek_to_last() override { inner_->seek_to_last(); skip_expired(false); }
+    void seek_with_prefix(const std::string& prefix) override {
+        inner_->seek_with_prefix(prefix);
+        skip_expired(true);
+    }
+
+private:
+    // 沿迭代方向跳过过期条目，并解码停下位置的值
+    void skip_expired(bool forward);
+
+    std::unique_ptr<Iterator> inner_;
+    TtlCompactionFilter ttl_;
+    uint64_t now_;  // 迭代器创建时刻，整个迭代过程使用同一个过期判断
+    std::string value_;
+};
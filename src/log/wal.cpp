@@ -1,10 +1,66 @@
 #include "log/wal.h"
+#include "storage/merge_operator.h"
 #include <fstream>
 #include <sstream>
 #include <functional>
 #include <filesystem>
 #include <sys/stat.h>
 #include <iostream>
+#include <map>
+#include <vector>
+
+namespace {
+
+// 记录按空白分隔字段，key 与 value 中的空白、换行和反斜杠需要转义，空字段写成 \e。
+// 未定义的转义原样保留，旧 WAL 中带反斜杠的值（如 JSON 里的 \"）照常读回
+std::string encode_field(const std::string& field) {
+    if (field.empty()) {
+        return "\\e";
+    }
+    std::string out;
+    out.reserve(field.size());
+    for (char c : field) {
+        switch (c) {
+            case '\\': out += "\\\\"; break;
+            case ' ':  out += "\\s"; break;
+            case '\t': out += "\\t"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\v': out += "\\v"; break;
+            case '\f': out += "\\f"; break;
+            default:   out += c;
+        }
+    }
+    return out;
+}
+
+std::string decode_field(const std::string& field) {
+    if (field == "\\e") {
+        return std::string();
+    }
+    std::string out;
+    out.reserve(field.size());
+    for (size_t i = 0; i < field.size(); i++) {
+        if (field[i] != '\\' || i + 1 == field.size()) {
+            out += field[i];
+            continue;
+        }
+        switch (field[i + 1]) {
+            case '\\': out += '\\'; break;
+            case 's':  out += ' '; break;
+            case 't':  out += '\t'; break;
+            case 'n':  out += '\n'; break;
+            case 'r':  out += '\r'; break;
+            case 'v':  out += '\v'; break;
+            case 'f':  out += '\f'; break;
+            default:   out += field[i]; continue;
+        }
+        i++;
+    }
+    return out;
+}
+
+} // namespace
 
 WAL::WAL(const std::string& filename)
     : filename_(filename) {
@@ -28,18 +84,87 @@ WAL::WAL(const std::string& filename)
 }
 
 void WAL::log_put(const std::string& key, const std::string& value) {
-    file_ << "PUT " << key << " " << value << "\n";
-    file_.flush();
+    log_put(0, key, value);
 }
 
 void WAL::log_del(const std::string& key) {
-    file_ << "DEL " << key << "\n";
+    log_del(0, key);
+}
+
+void WAL::log_put(uint32_t cf_id, const std::string& key, const std::string& value) {
+    write_op(cf_id, WriteBatch::OpType::PUT, key, value);
+    file_.flush();
+}
+
+void WAL::log_del(uint32_t cf_id, const std::string& key) {
+    write_op(cf_id, WriteBatch::OpType::DEL, key, "");
+    file_.flush();
+}
+
+void WAL::log_delete_range(uint32_t cf_id, const std::string& begin, const std::string& end) {
+    write_op(cf_id, WriteBatch::OpType::DELETE_RANGE, begin, end);
     file_.flush();
 }
 
+void WAL::log_batch(const WriteBatch& batch) {
+    file_ << "BATCH " << batch.count() << "\n";
+    for (const auto& op : batch.ops()) {
+        write_op(op.cf_id, op.type, op.key, op.value);
+    }
+    file_.flush();
+}
+
+void WAL::log_flushed(uint32_t cf_id) {
+    file_ << "FLUSHED " << cf_id << "\n";
+    file_.flush();
+}
+
+void WAL::write_op(uint32_t cf_id, WriteBatch::OpType type, const std::string& key, const std::string& value) {
+    if (type == WriteBatch::OpType::MERGE) {
+        // 合并操作数写成值为合并条目的 PUT，重放得到的 MemTable 与写入时一致
+        write_op(cf_id, WriteBatch::OpType::PUT, key, MergeEntry::encode_operand(value));
+        return;
+    }
+    if (cf_id == 0) {
+        if (type == WriteBatch::OpType::PUT) {
+            file_ << "PUT " << encode_field(key) << " " << encode_field(value) << "\n";
+        } else if (type == WriteBatch::OpType::DEL) {
+            file_ << "DEL " << encode_field(key) << "\n";
+        } else {
+            file_ << "DELRANGE " << encode_field(key) << " " << encode_field(value) << "\n";
+        }
+    } else {
+        if (type == WriteBatch::OpType::PUT) {
+            file_ << "CFPUT " << cf_id << " " << encode_field(key) << " " << encode_field(value) << "\n";
+        } else if (type == WriteBatch::OpType::DEL) {
+            file_ << "CFDEL " << cf_id << " " << encode_field(key) << "\n";
+        } else {
+            file_ << "CFDELRANGE " << cf_id << " " << encode_field(key) << " " << encode_field(value) << "\n";
+        }
+    }
+}
+
 void WAL::replay(
     const std::function<void(const std::string&, const std::string&)>& on_put,
     const std::function<void(const std::string&)>& on_del
+) {
+    replay_column_families(
+        [&](uint32_t cf_id, const std::string& key, const std::string& value) {
+            if (cf_id == 0) {
+                on_put(key, value);
+            }
+        },
+        [&](uint32_t cf_id, const std::string& key) {
+            if (cf_id == 0) {
+                on_del(key);
+            }
+        });
+}
+
+void WAL::replay_column_families(
+    const std::function<void(uint32_t, const std::string&, const std::string&)>& on_put,
+    const std::function<void(uint32_t, const std::string&)>& on_del,
+    const std::function<void(uint32_t, const std::string&, const std::string&)>& on_delete_range
 ) {
     std::cout << "[WAL重放] 开始重放WAL文件: " << filename_ << std::endl;
     
@@ -49,31 +174,113 @@ void WAL::replay(
         return;
     }
     
+    // 第一遍：找到每个列族最后一个刷盘标记所在的行，之前的记录已经在 SSTable 中
+    std::map<uint32_t, int> flushed_line;
     std::string line;
     int line_count = 0;
+    while (std::getline(in, line)) {
+        line_count++;
+        if (line.compare(0, 8, "FLUSHED ") == 0) {
+            std::istringstream iss(line.substr(8));
+            uint32_t cf_id;
+            if (iss >> cf_id) {
+                flushed_line[cf_id] = line_count;
+            }
+        }
+    }
+    in.clear();
+    in.seekg(0);
+    auto already_flushed = [&](uint32_t cf_id, int at_line) {
+        auto it = flushed_line.find(cf_id);
+        return it != flushed_line.end() && at_line < it->second;
+    };
+    
+    line_count = 0;
+    
+    // 正在收集的批：batch_remaining > 0 时记录先缓存，收齐后再统一应用
+    std::vector<WriteBatch::Op> pending_batch;
+    size_t batch_remaining = 0;
     
     while (std::getline(in, line)) {
         line_count++;
-        std::cout << "[WAL重放] 第" << line_count << "行: " << line << std::endl;
-        
         std::istringstream iss(line);
         std::string cmd;
         iss >> cmd;
         
-        if (cmd == "PUT") {
+        uint32_t cf_id = 0;
+        if (cmd == "CFPUT" || cmd == "CFDEL" || cmd == "CFDELRANGE") {
+            iss >> cf_id;
+            cmd = cmd.substr(2);
+        }
+        bool skip = already_flushed(cf_id, line_count);
+        
+        if (cmd == "BATCH") {
+            if (batch_remaining > 0) {
+                std::cerr << "[WAL重放] 警告: 丢弃不完整的批" << std::endl;
+            }
+            pending_batch.clear();
+            iss >> batch_remaining;
+        } else if (cmd == "FLUSHED") {
+            continue;
+        } else if (cmd == "PUT") {
             std::string key, value;
             iss >> key >> value;
-            std::cout << "[WAL重放] 执行PUT: key=" << key << ", value=" << value << std::endl;
-            on_put(key, value);
+            key = decode_field(key);
+            value = decode_field(value);
+            if (batch_remaining > 0) {
+                if (!skip) {
+                    pending_batch.push_back({WriteBatch::OpType::PUT, key, value, cf_id});
+                }
+            } else if (!skip) {
+                on_put(cf_id, key, value);
+            }
         } else if (cmd == "DEL") {
             std::string key;
             iss >> key;
-            std::cout << "[WAL重放] 执行DEL: key=" << key << std::endl;
-            on_del(key);
+            key = decode_field(key);
+            if (batch_remaining > 0) {
+                if (!skip) {
+                    pending_batch.push_back({WriteBatch::OpType::DEL, key, std::string(), cf_id});
+                }
+            } else if (!skip) {
+                on_del(cf_id, key);
+            }
+        } else if (cmd == "DELRANGE") {
+            std::string begin, end;
+            iss >> begin >> end;
+            begin = decode_field(begin);
+            end = decode_field(end);
+            if (batch_remaining > 0) {
+                if (!skip) {
+                    pending_batch.push_back({WriteBatch::OpType::DELETE_RANGE, begin, end, cf_id});
+                }
+            } else if (!skip && on_delete_range) {
+                on_delete_range(cf_id, begin, end);
+            }
         } else {
             std::cerr << "[WAL重放] 警告: 未知命令: " << cmd << std::endl;
+            continue;
+        }
+        
+        if (cmd != "BATCH" && batch_remaining > 0 && --batch_remaining == 0) {
+            std::cout << "[WAL重放] 应用批: " << pending_batch.size() << " 条记录" << std::endl;
+            for (const auto& op : pending_batch) {
+                if (op.type == WriteBatch::OpType::PUT) {
+                    on_put(op.cf_id, op.key, op.value);
+                } else if (op.type == WriteBatch::OpType::DEL) {
+                    on_del(op.cf_id, op.key);
+                } else if (on_delete_range) {
+                    on_delete_range(op.cf_id, op.key, op.value);
+                }
+            }
+            pending_batch.clear();
         }
     }
     
+    if (batch_remaining > 0) {
+        std::cerr << "[WAL重放] 警告: WAL 尾部批不完整（缺少 " << batch_remaining
+                  << " 条记录），已整体丢弃" << std::endl;
+    }
+    
     std::cout << "[WAL重放] 完成，共处理 " << line_count << " 行" << std::endl;
 }
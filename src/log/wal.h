@@ -4,6 +4,8 @@
 #include <functional>
 #include <iostream>
 #include <sstream>
+#include <cstdint>
+#include "db/write_batch.h"
 #ifdef __has_include
 #    if __has_include(<filesystem>)
 #        include <filesystem>
@@ -21,14 +23,32 @@ public:
     explicit WAL(const std::string& filename);
     void log_put(const std::string& key, const std::string& value);
     void log_del(const std::string& key);
+    // 非默认列族的记录为 CFPUT/CFDEL <列族编号> ...；默认列族（0）仍写 PUT/DEL，与旧 WAL 兼容
+    void log_put(uint32_t cf_id, const std::string& key, const std::string& value);
+    void log_del(uint32_t cf_id, const std::string& key);
+    // 范围删除：DELRANGE <begin> <end>，非默认列族为 CFDELRANGE <列族编号> <begin> <end>
+    void log_delete_range(uint32_t cf_id, const std::string& begin, const std::string& end);
+    // 批量写：BATCH <n> 头 + n 条 PUT/DEL 记录，一次 flush；重放时记录不足 n 条的批整体丢弃。
+    // MERGE 记为值为合并条目的 PUT
+    void log_batch(const WriteBatch& batch);
+    // 列族刷盘标记：该列族在此之前的记录已落入 SSTable，重放时跳过
+    void log_flushed(uint32_t cf_id);
 
+    // 只重放默认列族的记录
     void replay(
         const std::function<void(const std::string&, const std::string&)>& on_put,
         const std::function<void(const std::string&)>& on_del
     );
+    void replay_column_families(
+        const std::function<void(uint32_t, const std::string&, const std::string&)>& on_put,
+        const std::function<void(uint32_t, const std::string&)>& on_del,
+        const std::function<void(uint32_t, const std::string&, const std::string&)>& on_delete_range = nullptr
+    );
     const std::string& get_filename() const { return filename_; }
 
 private:
+    void write_op(uint32_t cf_id, WriteBatch::OpType type, const std::string& key, const std::string& value);
+
     std::ofstream file_;
     std::string filename_;
 };
@@ -167,8 +167,12 @@ void AlertManager::check_rules() {
             value = perf_metrics.qps;
         } else if (rule.metric_name == "avg_latency") {
             value = perf_metrics.avg_latency;
+        } else if (rule.metric_name == "p50_latency") {
+            value = perf_metrics.p50_latency;
         } else if (rule.metric_name == "p99_latency") {
             value = perf_metrics.p99_latency;
+        } else if (rule.metric_name == "p999_latency") {
+            value = perf_metrics.p999_latency;
         } else if (rule.metric_name == "cpu_usage") {
             value = resource_metrics.cpu_usage;
         } else if (rule.metric_name == "memory_usage") {
@@ -1,4 +1,5 @@
 #include "metrics_collector.h"
+#include "../storage/memory_budget.h"
 #include <algorithm>
 #include <fstream>
 #include <sstream>
@@ -18,55 +19,17 @@ namespace monitoring {
 // 全局指标收集器实例
 std::unique_ptr<MetricsCollector> g_metrics_collector;
 
-// LatencyStats 实现
-LatencyStats::LatencyStats(size_t max_samples) : max_samples_(max_samples) {
-    samples_.reserve(max_samples_);
-}
-
-void LatencyStats::record(double latency_ms) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    
-    if (samples_.size() >= max_samples_) {
-        // 移除最旧的样本
-        samples_.erase(samples_.begin());
-    }
-    
-    samples_.push_back(latency_ms);
-}
-
-double LatencyStats::get_average() const {
-    std::lock_guard<std::mutex> lock(const_cast<std::mutex&>(mutex_));
-    
-    if (samples_.empty()) return 0.0;
-    
-    double sum = 0.0;
-    for (double sample : samples_) {
-        sum += sample;
-    }
-    
-    return sum / samples_.size();
-}
-
-double LatencyStats::get_percentile(double p) const {
-    std::lock_guard<std::mutex> lock(const_cast<std::mutex&>(mutex_));
-    
-    if (samples_.empty()) return 0.0;
-    
-    std::vector<double> sorted_samples = samples_;
-    std::sort(sorted_samples.begin(), sorted_samples.end());
-    
-    size_t index = static_cast<size_t>((p / 100.0) * (sorted_samples.size() - 1));
-    return sorted_samples[index];
-}
-
-void LatencyStats::clear() {
-    std::lock_guard<std::mutex> lock(mutex_);
-    samples_.clear();
-}
-
 // MetricsCollector 实现
-MetricsCollector::MetricsCollector() 
-    : latency_stats_(std::make_unique<LatencyStats>()) {
+MetricsCollector::MetricsCollector()
+    : total_requests_(registry_.counter("kvdb_requests_total", "Total number of requests")),
+      throughput_bytes_(registry_.counter("kvdb_throughput_bytes_total", "Total bytes processed")),
+      latency_(registry_.histogram("kvdb_request_latency_seconds", "Request latency in seconds", 1e-9)) {
+    for (size_t i = 0; i < OP_TYPE_COUNT; ++i) {
+        std::string labels = std::string("op=\"") + op_type_name(static_cast<OpType>(i)) + "\"";
+        op_counts_[i] = &registry_.counter("kvdb_operations_total", "Total number of operations by type", labels);
+        op_latency_[i] = &registry_.histogram("kvdb_operation_latency_seconds",
+                                              "Operation latency in seconds by type", 1e-9, labels);
+    }
 }
 
 MetricsCollector::~MetricsCollector() {
@@ -95,6 +58,7 @@ void MetricsCollector::monitor_loop() {
     auto last_time = std::chrono::steady_clock::now();
     uint64_t last_requests = 0;
     uint64_t last_throughput = 0;
+    HistogramSnapshot last_latency;  // 第一个周期包含启动前记录的样本
     
     while (running_.load()) {
         std::unique_lock<std::mutex> lock(cv_mutex_);
@@ -108,19 +72,26 @@ void MetricsCollector::monitor_loop() {
         
         if (duration >= 1000) { // 每秒更新一次
             // 计算QPS
-            uint64_t current_requests = total_requests_.load();
-            uint64_t requests_diff = current_requests - last_requests;
-            qps_.store(requests_diff);
+            uint64_t current_requests = total_requests_.value();
+            qps_.store((current_requests - last_requests) * 1000 / duration);
             last_requests = current_requests;
             
             // 计算吞吐量
-            uint64_t current_throughput = throughput_.load();
-            throughput_.store(current_throughput - last_throughput);
+            uint64_t current_throughput = throughput_bytes_.value();
+            throughput_.store((current_throughput - last_throughput) * 1000 / duration);
             last_throughput = current_throughput;
             
-            // 更新延迟统计
-            avg_latency_.store(latency_stats_->get_average());
-            p99_latency_.store(latency_stats_->get_percentile(99.0));
+            // 更新延迟统计：只看本周期内的分布（直方图差值），不复制、不排序样本；
+            // 本周期没有请求时保留上一周期的值
+            HistogramSnapshot current_latency = latency_.snapshot();
+            HistogramSnapshot window = current_latency.delta_since(last_latency);
+            last_latency = std::move(current_latency);
+            if (window.count > 0) {
+                avg_latency_.store(window.mean() / 1e6);
+                p50_latency_.store(window.percentile(50.0) / 1e6);
+                p99_latency_.store(window.percentile(99.0) / 1e6);
+                p999_latency_.store(window.percentile(99.9) / 1e6);
+            }
             
             // 更新资源指标
             cpu_usage_.store(get_cpu_usage());
@@ -175,6 +146,16 @@ void MetricsCollector::check_thresholds() {
         add_alert(AlertLevel::WARNING, "qps", 
                  "QPS is high", thresholds_.qps_warning, qps);
     }
+
+    // 统一内存预算检查：超出预算说明刷盘和缓存收缩跟不上写入
+    if (const MemoryBudget* budget = memory_budget_.load()) {
+        if (budget->over_budget()) {
+            add_alert(AlertLevel::WARNING, "memory_budget",
+                     "Charged memory exceeds the budget",
+                     static_cast<double>(budget->total_budget()),
+                     static_cast<double>(budget->total_usage()));
+        }
+    }
 }
 
 void MetricsCollector::add_alert(AlertLevel level, const std::string& metric, 
@@ -248,27 +229,22 @@ uint64_t MetricsCollector::get_disk_usage() {
 }
 
 void MetricsCollector::record_request() {
-    total_requests_.fetch_add(1);
+    total_requests_.add();
 }
 
 void MetricsCollector::record_latency(double latency_ms) {
-    latency_stats_->record(latency_ms);
+    latency_.record(latency_ms > 0 ? static_cast<uint64_t>(latency_ms * 1e6) : 0);
 }
 
 void MetricsCollector::record_operation(const std::string& op_type) {
-    if (op_type == "get") {
-        get_count_.fetch_add(1);
-    } else if (op_type == "put") {
-        put_count_.fetch_add(1);
-    } else if (op_type == "delete") {
-        delete_count_.fetch_add(1);
-    } else if (op_type == "scan") {
-        scan_count_.fetch_add(1);
+    OpType op;
+    if (parse_op_type(op_type, op)) {
+        record_operation(op);
     }
 }
 
 void MetricsCollector::record_throughput(uint64_t bytes) {
-    throughput_.fetch_add(bytes);
+    throughput_bytes_.add(bytes);
 }
 
 void MetricsCollector::update_key_count(uint64_t count) {
@@ -299,14 +275,16 @@ void MetricsCollector::record_transaction(bool committed) {
 PerformanceMetrics MetricsCollector::get_performance_metrics() const {
     PerformanceMetrics metrics;
     metrics.qps = qps_.load();
-    metrics.total_requests = total_requests_.load();
+    metrics.total_requests = total_requests_.value();
     metrics.avg_latency = avg_latency_.load();
+    metrics.p50_latency = p50_latency_.load();
     metrics.p99_latency = p99_latency_.load();
+    metrics.p999_latency = p999_latency_.load();
     metrics.throughput = throughput_.load();
-    metrics.get_count = get_count_.load();
-    metrics.put_count = put_count_.load();
-    metrics.delete_count = delete_count_.load();
-    metrics.scan_count = scan_count_.load();
+    metrics.get_count = op_counts_[static_cast<size_t>(OpType::GET)]->value();
+    metrics.put_count = op_counts_[static_cast<size_t>(OpType::PUT)]->value();
+    metrics.delete_count = op_counts_[static_cast<size_t>(OpType::DELETE)]->value();
+    metrics.scan_count = op_counts_[static_cast<size_t>(OpType::SCAN)]->value();
     return metrics;
 }
 
@@ -320,6 +298,13 @@ ResourceMetrics MetricsCollector::get_resource_metrics() const {
     metrics.memtable_size = memtable_size_.load();
     metrics.sstable_count = sstable_count_.load();
     metrics.wal_size = wal_size_.load();
+    if (const MemoryBudget* budget = memory_budget_.load()) {
+        for (size_t i = 0; i < MemoryBudget::COMPONENT_COUNT; i++) {
+            auto component = static_cast<MemoryBudget::Component>(i);
+            metrics.component_memory[MemoryBudget::component_name(component)] = budget->usage(component);
+        }
+        metrics.memory_budget = budget->total_budget();
+    }
     return metrics;
 }
 
@@ -365,6 +350,9 @@ std::string MetricsCollector::export_prometheus() const {
     oss << "# TYPE kvdb_latency_p99 gauge\n";
     oss << "kvdb_latency_p99 " << p99_latency_.load() << "\n";
     
+    // 计数器与延迟直方图（_bucket / _sum / _count）
+    oss << registry_.export_prometheus();
+    
     // 资源指标
     oss << "# HELP kvdb_cpu_usage CPU usage percentage\n";
     oss << "# TYPE kvdb_cpu_usage gauge\n";
@@ -374,6 +362,22 @@ std::string MetricsCollector::export_prometheus() const {
     oss << "# TYPE kvdb_memory_usage gauge\n";
     oss << "kvdb_memory_usage " << memory_usage_.load() << "\n";
     
+    if (const MemoryBudget* budget = memory_budget_.load()) {
+        oss << "# HELP kvdb_component_memory_bytes Memory charged to the budget by component\n";
+        oss << "# TYPE kvdb_component_memory_bytes gauge\n";
+        for (size_t i = 0; i < MemoryBudget::COMPONENT_COUNT; i++) {
+            auto component = static_cast<MemoryBudget::Component>(i);
+            oss << "kvdb_component_memory_bytes{component=\"" << MemoryBudget::component_name(component)
+                << "\"} " << budget->usage(component) << "\n";
+        }
+        oss << "# HELP kvdb_memory_budget_bytes Total memory budget in bytes\n";
+        oss << "# TYPE kvdb_memory_budget_bytes gauge\n";
+        oss << "kvdb_memory_budget_bytes " << budget->total_budget() << "\n";
+        oss << "# HELP kvdb_write_buffer_budget_bytes Memtable memory that triggers a flush\n";
+        oss << "# TYPE kvdb_write_buffer_budget_bytes gauge\n";
+        oss << "kvdb_write_buffer_budget_bytes " << budget->write_buffer_size() << "\n";
+    }
+    
     // 业务指标
     oss << "# HELP kvdb_total_keys Total number of keys\n";
     oss << "# TYPE kvdb_total_keys gauge\n";
@@ -390,13 +394,25 @@ std::string MetricsCollector::export_json() const {
     oss << "    \"qps\": " << qps_.load() << ",\n";
     oss << "    \"avg_latency\": " << avg_latency_.load() << ",\n";
     oss << "    \"p99_latency\": " << p99_latency_.load() << ",\n";
-    oss << "    \"total_requests\": " << total_requests_.load() << "\n";
+    oss << "    \"p50_latency\": " << p50_latency_.load() << ",\n";
+    oss << "    \"p999_latency\": " << p999_latency_.load() << ",\n";
+    oss << "    \"total_requests\": " << total_requests_.value() << "\n";
     oss << "  },\n";
     oss << "  \"resources\": {\n";
     oss << "    \"cpu_usage\": " << cpu_usage_.load() << ",\n";
     oss << "    \"memory_usage\": " << memory_usage_.load() << ",\n";
-    oss << "    \"disk_usage\": " << disk_usage_.load() << "\n";
-    oss << "  },\n";
+    oss << "    \"disk_usage\": " << disk_usage_.load();
+    if (const MemoryBudget* budget = memory_budget_.load()) {
+        oss << ",\n    \"memory_budget\": " << budget->total_budget() << ",\n";
+        oss << "    \"component_memory\": {";
+        for (size_t i = 0; i < MemoryBudget::COMPONENT_COUNT; i++) {
+            auto component = static_cast<MemoryBudget::Component>(i);
+            oss << (i == 0 ? "" : ", ") << "\"" << MemoryBudget::component_name(component) << "\": "
+                << budget->usage(component);
+        }
+        oss << "}";
+    }
+    oss << "\n  },\n";
     oss << "  \"business\": {\n";
     oss << "    \"total_keys\": " << total_keys_.load() << ",\n";
     oss << "    \"total_data_size\": " << total_data_size_.load() << ",\n";
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "metrics_registry.h"
 #include <atomic>
 #include <chrono>
 #include <map>
@@ -10,6 +11,8 @@
 #include <thread>
 #include <condition_variable>
 
+class MemoryBudget;
+
 namespace kvdb {
 namespace monitoring {
 
@@ -18,7 +21,9 @@ struct PerformanceMetrics {
     uint64_t qps = 0;           // 每秒查询数
     uint64_t total_requests = 0; // 总请求数
     double avg_latency = 0.0;    // 平均延迟(ms)
+    double p50_latency = 0.0;    // P50延迟(ms)
     double p99_latency = 0.0;    // P99延迟(ms)
+    double p999_latency = 0.0;   // P99.9延迟(ms)
     uint64_t throughput = 0;     // 吞吐量(bytes/s)
     
     // 操作计数器
@@ -40,6 +45,10 @@ struct ResourceMetrics {
     uint64_t memtable_size = 0;
     uint64_t sstable_count = 0;
     uint64_t wal_size = 0;
+    
+    // 统一内存预算下各组件的记账用量（未挂接预算时为空）
+    std::map<std::string, uint64_t> component_memory;
+    uint64_t memory_budget = 0;
 };
 
 // 业务指标快照
@@ -73,35 +82,24 @@ struct Alert {
     std::chrono::system_clock::time_point timestamp;
 };
 
-// 延迟统计
-class LatencyStats {
-private:
-    std::vector<double> samples_;
-    std::mutex mutex_;
-    size_t max_samples_;
-    
-public:
-    explicit LatencyStats(size_t max_samples = 10000);
-    
-    void record(double latency_ms);
-    double get_average() const;
-    double get_percentile(double p) const;
-    void clear();
-};
-
 // 指标收集器
 class MetricsCollector {
 private:
-    // 内部使用atomic类型存储
+    // 热路径计数与延迟都在注册表中：分片计数器 + HDR 直方图，记录无锁
+    MetricsRegistry registry_;
+    ShardedCounter& total_requests_;
+    ShardedCounter& throughput_bytes_;
+    HdrHistogram& latency_;                                  // 纳秒
+    std::array<ShardedCounter*, OP_TYPE_COUNT> op_counts_;
+    std::array<HdrHistogram*, OP_TYPE_COUNT> op_latency_;    // 纳秒
+    
+    // 监控线程每秒根据区间差值刷新的派生指标
     std::atomic<uint64_t> qps_{0};
-    std::atomic<uint64_t> total_requests_{0};
     std::atomic<double> avg_latency_{0.0};
+    std::atomic<double> p50_latency_{0.0};
     std::atomic<double> p99_latency_{0.0};
-    std::atomic<uint64_t> throughput_{0};
-    std::atomic<uint64_t> get_count_{0};
-    std::atomic<uint64_t> put_count_{0};
-    std::atomic<uint64_t> delete_count_{0};
-    std::atomic<uint64_t> scan_count_{0};
+    std::atomic<double> p999_latency_{0.0};
+    std::atomic<uint64_t> throughput_{0};                    // bytes/s
     
     std::atomic<double> cpu_usage_{0.0};
     std::atomic<uint64_t> memory_usage_{0};
@@ -120,7 +118,7 @@ private:
     std::atomic<uint64_t> commit_count_{0};
     std::atomic<uint64_t> abort_count_{0};
     
-    std::unique_ptr<LatencyStats> latency_stats_;
+    std::atomic<const MemoryBudget*> memory_budget_{nullptr};
     
     // 告警相关
     std::vector<Alert> alerts_;
@@ -165,6 +163,16 @@ public:
     // 性能指标记录
     void record_request();
     void record_latency(double latency_ms);
+    void record_latency_ns(uint64_t latency_ns) { latency_.record(latency_ns); }
+    void record_operation(OpType op) { op_counts_[static_cast<size_t>(op)]->add(); }
+    // 一次完整的操作：请求数、操作计数、总延迟与分操作延迟
+    void record_operation(OpType op, uint64_t latency_ns) {
+        total_requests_.add();
+        op_counts_[static_cast<size_t>(op)]->add();
+        latency_.record(latency_ns);
+        op_latency_[static_cast<size_t>(op)]->record(latency_ns);
+    }
+    // 兼容旧接口：按名称查找操作类型
     void record_operation(const std::string& op_type);
     void record_throughput(uint64_t bytes);
     
@@ -174,10 +182,20 @@ public:
     void update_connections(int delta);
     void record_transaction(bool committed);
     
+    // 挂接统一内存预算，资源指标与导出中附带各组件的内存用量；预算需比收集器活得更久
+    void set_memory_budget(const MemoryBudget* budget) { memory_budget_.store(budget); }
+    
     // 获取指标 - 返回快照而不是引用
     PerformanceMetrics get_performance_metrics() const;
     ResourceMetrics get_resource_metrics() const;
     BusinessMetrics get_business_metrics() const;
+    HistogramSnapshot get_latency_snapshot() const { return latency_.snapshot(); }
+    HistogramSnapshot get_operation_latency_snapshot(OpType op) const {
+        return op_latency_[static_cast<size_t>(op)]->snapshot();
+    }
+    
+    // 自定义指标注册到同一个注册表，随 export_prometheus 一起导出
+    MetricsRegistry& registry() { return registry_; }
     
     // 获取告警
     std::vector<Alert> get_alerts() const;
@@ -207,5 +225,26 @@ extern std::unique_ptr<MetricsCollector> g_metrics_collector;
 #define UPDATE_KEY_COUNT(count) \
     if (g_metrics_collector) g_metrics_collector->update_key_count(count)
 
+// 作用域计时：析构时记录一次完整操作（请求、计数、延迟）
+class ScopedOperationTimer {
+public:
+    explicit ScopedOperationTimer(OpType op)
+        : op_(op), start_(std::chrono::steady_clock::now()) {}
+    ~ScopedOperationTimer() {
+        if (g_metrics_collector) {
+            auto elapsed = std::chrono::steady_clock::now() - start_;
+            g_metrics_collector->record_operation(op_, static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        }
+    }
+
+private:
+    OpType op_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+#define RECORD_TIMED_OPERATION(op) \
+    ::kvdb::monitoring::ScopedOperationTimer kvdb_operation_timer_(op)
+
 } // namespace monitoring
 } // namespace kvdb
\ No newline at end of file
@@ -0,0 +1,220 @@
+#include "metrics_registry.h"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+namespace kvdb {
+namespace monitoring {
+
+static const char* const OP_TYPE_NAMES[OP_TYPE_COUNT] = {"get", "put", "delete", "scan"};
+
+const char* op_type_name(OpType op) {
+    size_t index = static_cast<size_t>(op);
+    return index < OP_TYPE_COUNT ? OP_TYPE_NAMES[index] : "unknown";
+}
+
+bool parse_op_type(const std::string& name, OpType& op) {
+    for (size_t i = 0; i < OP_TYPE_COUNT; ++i) {
+        if (name == OP_TYPE_NAMES[i]) {
+            op = static_cast<OpType>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// ShardedCounter 实现
+uint64_t ShardedCounter::value() const {
+    uint64_t total = 0;
+    for (const auto& cell : cells_) {
+        total += cell.value.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void ShardedCounter::reset() {
+    for (auto& cell : cells_) {
+        cell.value.store(0, std::memory_order_relaxed);
+    }
+}
+
+// HistogramSnapshot 实现
+uint64_t HistogramSnapshot::percentile(double p) const {
+    if (count == 0 || buckets.empty()) {
+        return 0;
+    }
+    p = std::min(std::max(p, 0.0), 100.0);
+    uint64_t rank = static_cast<uint64_t>(std::ceil(p / 100.0 * count));
+    rank = std::max<uint64_t>(rank, 1);
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            return HdrHistogram::bucket_upper_bound(i);
+        }
+    }
+    return HdrHistogram::bucket_upper_bound(buckets.size() - 1);
+}
+
+uint64_t HistogramSnapshot::count_at_or_below(uint64_t value) const {
+    uint64_t total = 0;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        if (HdrHistogram::bucket_upper_bound(i) > value) {
+            break;
+        }
+        total += buckets[i];
+    }
+    return total;
+}
+
+HistogramSnapshot HistogramSnapshot::delta_since(const HistogramSnapshot& earlier) const {
+    HistogramSnapshot delta;
+    delta.buckets = buckets;
+    for (size_t i = 0; i < delta.buckets.size() && i < earlier.buckets.size(); ++i) {
+        delta.buckets[i] -= std::min(delta.buckets[i], earlier.buckets[i]);
+    }
+    delta.count = count - std::min(count, earlier.count);
+    delta.sum = sum - std::min(sum, earlier.sum);
+    return delta;
+}
+
+// HdrHistogram 实现
+uint64_t HdrHistogram::bucket_lower_bound(size_t index) {
+    if (index < SUB_BUCKETS) {
+        return index;
+    }
+    uint32_t shift = static_cast<uint32_t>(index / SUB_BUCKETS) - 1;
+    uint64_t sub = index % SUB_BUCKETS;
+    return (SUB_BUCKETS + sub) << shift;
+}
+
+uint64_t HdrHistogram::bucket_upper_bound(size_t index) {
+    if (index < SUB_BUCKETS) {
+        return index;
+    }
+    uint32_t shift = static_cast<uint32_t>(index / SUB_BUCKETS) - 1;
+    return bucket_lower_bound(index) + (uint64_t(1) << shift) - 1;
+}
+
+HistogramSnapshot HdrHistogram::snapshot() const {
+    HistogramSnapshot snapshot;
+    snapshot.buckets.resize(BUCKET_COUNT);
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        uint64_t n = buckets_[i].load(std::memory_order_relaxed);
+        snapshot.buckets[i] = n;
+        snapshot.count += n;
+    }
+    snapshot.sum = sum_.value();
+    return snapshot;
+}
+
+uint64_t HdrHistogram::count() const {
+    uint64_t total = 0;
+    for (const auto& bucket : buckets_) {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void HdrHistogram::reset() {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    sum_.reset();
+}
+
+// MetricsRegistry 实现
+const std::vector<double>& MetricsRegistry::default_latency_bounds() {
+    // 秒：1us ~ 10s
+    static const std::vector<double> bounds = {
+        0.000001, 0.0000025, 0.000005, 0.00001, 0.000025, 0.00005,
+        0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005,
+        0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0
+    };
+    return bounds;
+}
+
+MetricsRegistry::Family& MetricsRegistry::family_locked(const std::string& name,
+                                                         const std::string& help,
+                                                         const std::string& type) {
+    auto it = families_.find(name);
+    if (it == families_.end()) {
+        it = families_.emplace(name, Family()).first;
+        it->second.help = help;
+        it->second.type = type;
+    }
+    return it->second;
+}
+
+ShardedCounter& MetricsRegistry::counter(const std::string& name, const std::string& help,
+                                         const std::string& labels) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Family& family = family_locked(name, help, "counter");
+    auto& slot = family.counters[labels];
+    if (!slot) {
+        slot = std::make_unique<ShardedCounter>();
+    }
+    return *slot;
+}
+
+HdrHistogram& MetricsRegistry::histogram(const std::string& name, const std::string& help,
+                                         double unit_scale, const std::string& labels,
+                                         const std::vector<double>& bounds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Family& family = family_locked(name, help, "histogram");
+    if (family.histograms.empty()) {
+        family.unit_scale = unit_scale;
+        family.bounds = bounds.empty() ? default_latency_bounds() : bounds;
+    }
+    auto& slot = family.histograms[labels];
+    if (!slot) {
+        slot = std::make_unique<HdrHistogram>();
+    }
+    return *slot;
+}
+
+static std::string series_name(const std::string& name, const std::string& suffix,
+                               const std::string& labels, const std::string& extra = "") {
+    std::string result = name + suffix;
+    if (!labels.empty() || !extra.empty()) {
+        result += "{" + labels;
+        if (!labels.empty() && !extra.empty()) {
+            result += ",";
+        }
+        result += extra + "}";
+    }
+    return result;
+}
+
+std::string MetricsRegistry::export_prometheus() const {
+    std::ostringstream oss;
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (const auto& [name, family] : families_) {
+        oss << "# HELP " << name << " " << family.help << "\n";
+        oss << "# TYPE " << name << " " << family.type << "\n";
+
+        for (const auto& [labels, counter] : family.counters) {
+            oss << series_name(name, "", labels) << " " << counter->value() << "\n";
+        }
+
+        for (const auto& [labels, histogram] : family.histograms) {
+            HistogramSnapshot snapshot = histogram->snapshot();
+            for (double bound : family.bounds) {
+                std::ostringstream le;
+                le << "le=\"" << bound << "\"";
+                uint64_t raw_bound = static_cast<uint64_t>(std::llround(bound / family.unit_scale));
+                oss << series_name(name, "_bucket", labels, le.str()) << " "
+                    << snapshot.count_at_or_below(raw_bound) << "\n";
+            }
+            oss << series_name(name, "_bucket", labels, "le=\"+Inf\"") << " " << snapshot.count << "\n";
+            oss << series_name(name, "_sum", labels) << " " << snapshot.sum * family.unit_scale << "\n";
+            oss << series_name(name, "_count", labels) << " " << snapshot.count << "\n";
+        }
+    }
+    return oss.str();
+}
+
+} // namespace monitoring
+} // namespace kvdb
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace kvdb {
+namespace monitoring {
+
+// 操作类型：热路径按枚举下标计数，不做字符串比较
+enum class OpType : uint8_t {
+    GET = 0,
+    PUT,
+    DELETE,
+    SCAN,
+    COUNT
+};
+
+constexpr size_t OP_TYPE_COUNT = static_cast<size_t>(OpType::COUNT);
+
+const char* op_type_name(OpType op);
+bool parse_op_type(const std::string& name, OpType& op);
+
+// 分片计数器：每个线程固定落在一个缓存行对齐的分片上，写入无竞争，读时求和
+class ShardedCounter {
+public:
+    static constexpr size_t SHARDS = 16;
+
+    void add(uint64_t delta = 1) {
+        cells_[shard_index()].value.fetch_add(delta, std::memory_order_relaxed);
+    }
+    uint64_t value() const;
+    void reset();
+
+    // 线程首次使用时轮流分配分片
+    static size_t shard_index() {
+        static std::atomic<size_t> next_shard{0};
+        thread_local size_t index = next_shard.fetch_add(1, std::memory_order_relaxed) % SHARDS;
+        return index;
+    }
+
+private:
+    struct alignas(64) Cell {
+        std::atomic<uint64_t> value{0};
+    };
+    std::array<Cell, SHARDS> cells_;
+};
+
+// 直方图在某一时刻的计数，用于计算分位数、区间差值和导出
+struct HistogramSnapshot {
+    std::vector<uint64_t> buckets;
+    uint64_t count = 0;
+    uint64_t sum = 0;
+
+    double mean() const { return count ? static_cast<double>(sum) / count : 0.0; }
+    // p 取 [0, 100]，返回所在桶的上界（相对误差不超过桶宽）
+    uint64_t percentile(double p) const;
+    // 上界不超过 value 的桶的累计计数（Prometheus 的 le 语义）
+    uint64_t count_at_or_below(uint64_t value) const;
+    // 本快照减去更早的快照，得到这段时间内的分布
+    HistogramSnapshot delta_since(const HistogramSnapshot& earlier) const;
+};
+
+// 对数线性（HDR）直方图：每个 2 的幂区间再等分为 SUB_BUCKETS 个桶，相对误差约 1/SUB_BUCKETS。
+// 记录只是一次定位加两次 relaxed 原子加，不加锁、不保存样本；分位数只遍历固定数量的桶
+class HdrHistogram {
+public:
+    static constexpr uint32_t SUB_BUCKET_BITS = 5;
+    static constexpr uint32_t SUB_BUCKETS = 1u << SUB_BUCKET_BITS;
+    // 可区分的最大值约 2^40（以纳秒计约 18 分钟），更大的值计入最后一个桶
+    static constexpr uint32_t MAX_EXPONENT = 40;
+    static constexpr size_t BUCKET_COUNT = (MAX_EXPONENT - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    void record(uint64_t value) {
+        buckets_[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+        sum_.add(value);
+    }
+
+    HistogramSnapshot snapshot() const;
+    uint64_t count() const;
+    void reset();
+
+    static size_t bucket_index(uint64_t value) {
+        if (value < SUB_BUCKETS) {
+            return static_cast<size_t>(value);
+        }
+        uint32_t exponent = 63 - static_cast<uint32_t>(__builtin_clzll(value));
+        if (exponent >= MAX_EXPONENT) {
+            return BUCKET_COUNT - 1;
+        }
+        uint32_t shift = exponent - SUB_BUCKET_BITS;
+        return static_cast<size_t>(shift + 1) * SUB_BUCKETS + ((value >> shift) - SUB_BUCKETS);
+    }
+    static uint64_t bucket_lower_bound(size_t index);
+    static uint64_t bucket_upper_bound(size_t index);
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets_{};
+    ShardedCounter sum_;
+};
+
+// 指标注册表：按名称 + 标签注册计数器和直方图，返回的引用在注册表生命周期内有效。
+// 注册走互斥锁（低频），记录直接操作返回的对象（高频、无锁）
+class MetricsRegistry {
+public:
+    ShardedCounter& counter(const std::string& name, const std::string& help,
+                            const std::string& labels = "");
+    // unit_scale：记录值换算成导出单位的系数，例如纳秒记录、秒导出时为 1e-9；
+    // bounds：导出时的 le 边界（导出单位），为空时使用默认的延迟边界
+    HdrHistogram& histogram(const std::string& name, const std::string& help,
+                            double unit_scale, const std::string& labels = "",
+                            const std::vector<double>& bounds = {});
+
+    // Prometheus 文本格式：计数器按注册名导出（名称应以 _total 结尾），直方图导出为 _bucket / _sum / _count
+    std::string export_prometheus() const;
+
+    static const std::vector<double>& default_latency_bounds();
+
+private:
+    struct Family {
+        std::string help;
+        std::string type;
+        double unit_scale = 1.0;
+        std::vector<double> bounds;
+        std::map<std::string, std::unique_ptr<ShardedCounter>> counters;
+        std::map<std::string, std::unique_ptr<HdrHistogram>> histograms;
+    };
+
+    Family& family_locked(const std::string& name, const std::string& help, const std::string& type);
+
+    mutable std::mutex mutex_;
+    std::map<std::string, Family> families_;
+};
+
+} // namespace monitoring
+} // namespace kvdb
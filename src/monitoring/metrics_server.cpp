@@ -1,12 +1,8 @@
 #include "metrics_server.h"
 #include <sstream>
+#include <iomanip>
 #include <fstream>
 #include <iostream>
-#include <cstring>
-#include <sys/socket.h>
-#include <netinet/in.h>
-#include <unistd.h>
-#include <arpa/inet.h>
 
 namespace kvdb {
 namespace monitoring {
@@ -15,8 +11,12 @@ namespace monitoring {
 std::unique_ptr<MonitoringDashboard> g_monitoring_dashboard;
 
 // MetricsServer 实现
-MetricsServer::MetricsServer(const std::string& host, int port) 
-    : host_(host), port_(port) {
+MetricsServer::MetricsServer(const std::string& host, int port, const network::HttpEngineOptions& options) 
+    : host_(host), port_(port),
+      engine_([this](const network::HttpRequest& request, network::HttpResponse& response) {
+                  handle_request(request, response);
+              },
+              options) {
 }
 
 MetricsServer::~MetricsServer() {
@@ -24,115 +24,57 @@ MetricsServer::~MetricsServer() {
 }
 
 void MetricsServer::start() {
-    if (running_.load()) return;
+    if (engine_.is_running()) return;
     
-    running_.store(true);
-    server_thread_ = std::thread(&MetricsServer::server_loop, this);
+    try {
+        engine_.start(host_, static_cast<uint16_t>(port_));
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to start metrics server on port " << port_ << ": " << e.what() << "\n";
+        return;
+    }
+    
+    std::cout << "Metrics server started on " << host_ << ":" << engine_.port() << "\n";
 }
 
 void MetricsServer::stop() {
-    if (!running_.load()) return;
-    
-    running_.store(false);
-    
-    if (server_thread_.joinable()) {
-        server_thread_.join();
-    }
+    engine_.stop();
 }
 
-void MetricsServer::server_loop() {
-    int server_fd = socket(AF_INET, SOCK_STREAM, 0);
-    if (server_fd < 0) {
-        std::cerr << "Failed to create socket\n";
+void MetricsServer::handle_request(const network::HttpRequest& request, network::HttpResponse& response) {
+    if (request.method != "GET" && request.method != "HEAD") {
+        response.status = 405;
         return;
     }
     
-    int opt = 1;
-    setsockopt(server_fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
-    
-    struct sockaddr_in address;
-    address.sin_family = AF_INET;
-    address.sin_addr.s_addr = INADDR_ANY;
-    address.sin_port = htons(port_);
-    
-    if (bind(server_fd, (struct sockaddr*)&address, sizeof(address)) < 0) {
-        std::cerr << "Failed to bind socket to port " << port_ << "\n";
-        close(server_fd);
-        return;
+    if (request.path == "/metrics") {
+        handle_metrics_request(response);
+    } else if (request.path == "/alerts") {
+        handle_alerts_request(response);
+    } else if (request.path == "/health") {
+        handle_health_request(response);
+    } else if (g_monitoring_dashboard) {
+        // 默认返回仪表板
+        response.content_type = "text/html";
+        response.body = g_monitoring_dashboard->generate_dashboard_html();
+    } else {
+        response.status = 404;
     }
-    
-    if (listen(server_fd, 10) < 0) {
-        std::cerr << "Failed to listen on socket\n";
-        close(server_fd);
-        return;
-    }
-    
-    std::cout << "Metrics server started on " << host_ << ":" << port_ << "\n";
-    
-    while (running_.load()) {
-        struct sockaddr_in client_addr;
-        socklen_t client_len = sizeof(client_addr);
-        
-        int client_fd = accept(server_fd, (struct sockaddr*)&client_addr, &client_len);
-        if (client_fd < 0) {
-            if (running_.load()) {
-                std::cerr << "Failed to accept connection\n";
-            }
-            continue;
-        }
-        
-        // 读取HTTP请求
-        char buffer[4096] = {0};
-        ssize_t bytes_read = read(client_fd, buffer, sizeof(buffer) - 1);
-        
-        if (bytes_read > 0) {
-            std::string request(buffer);
-            std::string response;
-            
-            if (request.find("GET /metrics") != std::string::npos) {
-                response = handle_metrics_request();
-            } else if (request.find("GET /alerts") != std::string::npos) {
-                response = handle_alerts_request();
-            } else if (request.find("GET /health") != std::string::npos) {
-                response = handle_health_request();
-            } else {
-                // 默认返回仪表板
-                if (g_monitoring_dashboard) {
-                    std::string dashboard_html = g_monitoring_dashboard->generate_dashboard_html();
-                    response = "HTTP/1.1 200 OK\r\n"
-                              "Content-Type: text/html\r\n"
-                              "Content-Length: " + std::to_string(dashboard_html.length()) + "\r\n"
-                              "\r\n" + dashboard_html;
-                } else {
-                    response = "HTTP/1.1 404 Not Found\r\n\r\n";
-                }
-            }
-            
-        (void)write(client_fd, response.c_str(), response.length());
-        }
-        
-        close(client_fd);
-    }
-    
-    close(server_fd);
 }
 
-std::string MetricsServer::handle_metrics_request() {
+void MetricsServer::handle_metrics_request(network::HttpResponse& response) {
     if (!g_metrics_collector) {
-        return "HTTP/1.1 503 Service Unavailable\r\n\r\n";
+        response.status = 503;
+        return;
     }
     
-    std::string metrics = g_metrics_collector->export_prometheus();
-    
-    return "HTTP/1.1 200 OK\r\n"
-           "Content-Type: text/plain\r\n"
-           "Content-Length: " + std::to_string(metrics.length()) + "\r\n"
-           "\r\n" + metrics;
+    response.content_type = "text/plain; version=0.0.4";
+    response.body = g_metrics_collector->export_prometheus();
 }
 
-std::string MetricsServer::handle_alerts_request() {
+void MetricsServer::handle_alerts_request(network::HttpResponse& response) {
     if (!g_alert_manager) {
-        return "HTTP/1.1 503 Service Unavailable\r\n\r\n";
+        response.status = 503;
+        return;
     }
     
     auto alerts = g_alert_manager->get_alert_history(50);
@@ -168,23 +110,15 @@ std::string MetricsServer::handle_alerts_request() {
     
     json << "  ]\n}\n";
     
-    std::string response_body = json.str();
-    
-    return "HTTP/1.1 200 OK\r\n"
-           "Content-Type: application/json\r\n"
-           "Content-Length: " + std::to_string(response_body.length()) + "\r\n"
-           "\r\n" + response_body;
+    response.content_type = "application/json";
+    response.body = json.str();
 }
 
-std::string MetricsServer::handle_health_request() {
-    std::string health = "{\"status\": \"healthy\", \"timestamp\": " + 
-                        std::to_string(std::chrono::duration_cast<std::chrono::seconds>(
-                            std::chrono::system_clock::now().time_since_epoch()).count()) + "}";
-    
-    return "HTTP/1.1 200 OK\r\n"
-           "Content-Type: application/json\r\n"
-           "Content-Length: " + std::to_string(health.length()) + "\r\n"
-           "\r\n" + health;
+void MetricsServer::handle_health_request(network::HttpResponse& response) {
+    response.content_type = "application/json";
+    response.body = "{\"status\": \"healthy\", \"timestamp\": " + 
+                    std::to_string(std::chrono::duration_cast<std::chrono::seconds>(
+                        std::chrono::system_clock::now().time_since_epoch()).count()) + "}";
 }
 
 std::string MetricsServer::get_endpoint() const {
@@ -336,7 +270,7 @@ std::string MonitoringDashboard::get_dashboard_url() const {
 std::string MonitoringDashboard::generate_dashboard_html() const {
     std::ostringstream html;
     
-    html << R"(<!DOCTYPE html>
+    html << R"HTML(<!DOCTYPE html>
 <html>
 <head>
     <title>KVDB Monitoring Dashboard</title>
@@ -378,7 +312,7 @@ std::string MonitoringDashboard::generate_dashboard_html() const {
             <button class="refresh-btn" onclick="refreshMetrics()">Refresh</button>
         </div>
         
-        <div class="metrics-grid">)";
+        <div class="metrics-grid">)HTML";
     
     if (g_metrics_collector) {
         auto perf = g_metrics_collector->get_performance_metrics();
@@ -389,42 +323,42 @@ std::string MonitoringDashboard::generate_dashboard_html() const {
         html << R"(
             <div class="metric-card">
                 <div class="metric-title">QPS (Queries Per Second)</div>
-                <div class="metric-value">)" << perf.qps.load() << R"(<span class="metric-unit"> req/s</span></div>
+                <div class="metric-value">)" << perf.qps << R"(<span class="metric-unit"> req/s</span></div>
             </div>
             
             <div class="metric-card">
                 <div class="metric-title">Average Latency</div>
-                <div class="metric-value">)" << std::fixed << std::setprecision(2) << perf.avg_latency.load() << R"(<span class="metric-unit"> ms</span></div>
+                <div class="metric-value">)" << std::fixed << std::setprecision(2) << perf.avg_latency << R"(<span class="metric-unit"> ms</span></div>
             </div>
             
             <div class="metric-card">
                 <div class="metric-title">P99 Latency</div>
-                <div class="metric-value">)" << std::fixed << std::setprecision(2) << perf.p99_latency.load() << R"(<span class="metric-unit"> ms</span></div>
+                <div class="metric-value">)" << std::fixed << std::setprecision(2) << perf.p99_latency << R"(<span class="metric-unit"> ms</span></div>
             </div>
             
             <div class="metric-card">
                 <div class="metric-title">Total Requests</div>
-                <div class="metric-value">)" << perf.total_requests.load() << R"(</div>
+                <div class="metric-value">)" << perf.total_requests << R"(</div>
             </div>
             
             <div class="metric-card">
                 <div class="metric-title">CPU Usage</div>
-                <div class="metric-value">)" << std::fixed << std::setprecision(1) << resource.cpu_usage.load() << R"(<span class="metric-unit"> %</span></div>
+                <div class="metric-value">)" << std::fixed << std::setprecision(1) << resource.cpu_usage << R"(<span class="metric-unit"> %</span></div>
             </div>
             
             <div class="metric-card">
                 <div class="metric-title">Memory Usage</div>
-                <div class="metric-value">)" << (resource.memory_usage.load() / 1024 / 1024) << R"(<span class="metric-unit"> MB</span></div>
+                <div class="metric-value">)" << (resource.memory_usage / 1024 / 1024) << R"(<span class="metric-unit"> MB</span></div>
             </div>
             
             <div class="metric-card">
                 <div class="metric-title">Total Keys</div>
-                <div class="metric-value">)" << business.total_keys.load() << R"(</div>
+                <div class="metric-value">)" << business.total_keys << R"(</div>
             </div>
             
             <div class="metric-card">
                 <div class="metric-title">Active Connections</div>
-                <div class="metric-value">)" << business.active_connections.load() << R"(</div>
+                <div class="metric-value">)" << business.active_connections << R"(</div>
             </div>)";
     }
     
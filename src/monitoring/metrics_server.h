@@ -2,6 +2,7 @@
 
 #include "metrics_collector.h"
 #include "alert_manager.h"
+#include "../network/http_engine.h"
 #include <string>
 #include <thread>
 #include <atomic>
@@ -10,27 +11,29 @@
 namespace kvdb {
 namespace monitoring {
 
-// HTTP指标服务器
+// HTTP指标服务器：建立在 HttpEngine 之上，抓取方可以复用连接，慢客户端不会阻塞其他抓取
 class MetricsServer {
 private:
     std::string host_;
     int port_;
-    std::thread server_thread_;
-    std::atomic<bool> running_{false};
+    network::HttpEngine engine_;
     
-    void server_loop();
-    std::string handle_metrics_request();
-    std::string handle_alerts_request();
-    std::string handle_health_request();
+    void handle_request(const network::HttpRequest& request, network::HttpResponse& response);
+    void handle_metrics_request(network::HttpResponse& response);
+    void handle_alerts_request(network::HttpResponse& response);
+    void handle_health_request(network::HttpResponse& response);
     
 public:
-    MetricsServer(const std::string& host = "0.0.0.0", int port = 8080);
+    MetricsServer(const std::string& host = "0.0.0.0", int port = 8080,
+                  const network::HttpEngineOptions& options = network::HttpEngineOptions());
     ~MetricsServer();
     
     void start();
     void stop();
     
-    bool is_running() const { return running_.load(); }
+    bool is_running() const { return engine_.is_running(); }
+    // 实际监听端口（构造时传 0 由系统分配）
+    int port() const { return engine_.is_running() ? engine_.port() : port_; }
     std::string get_endpoint() const;
 };
 
@@ -1,17 +1,36 @@
 #include "mvcc_manager.h"
+#include "../storage/memory_budget.h"
 #include <iostream>
 #include <algorithm>
 #include <shared_mutex>
 
 // VersionChain 实现
-VersionChain::VersionChain(const std::string& key) : key_(key) {}
+VersionChain::VersionChain(const std::string& key, MemoryBudget* budget) : key_(key), budget_(budget) {
+    if (budget_) {
+        charged_bytes_ = sizeof(VersionChain) + key_.size();
+        budget_->charge(MemoryBudget::Component::MVCC, charged_bytes_);
+    }
+}
+
+VersionChain::~VersionChain() {
+    if (budget_) {
+        budget_->release(MemoryBudget::Component::MVCC, charged_bytes_);
+    }
+}
 
-VersionChain::~VersionChain() {}
+size_t VersionChain::version_bytes(const MVCCVersionedValue& version) {
+    return sizeof(MVCCVersionedValue) + version.value.size();
+}
 
-bool VersionChain::add_version(const VersionedValue& version) {
+bool VersionChain::add_version(const MVCCVersionedValue& version) {
     std::unique_lock<std::shared_mutex> lock(versions_mutex_);
     
-    auto new_version = std::make_unique<VersionedValue>(version);
+    auto new_version = std::make_unique<MVCCVersionedValue>(version);
+    if (budget_) {
+        size_t bytes = version_bytes(*new_version);
+        charged_bytes_ += bytes;
+        budget_->charge(MemoryBudget::Component::MVCC, bytes);
+    }
     versions_.push_back(std::move(new_version));
     
     // 保持版本按时间戳排序
@@ -20,12 +39,12 @@ bool VersionChain::add_version(const VersionedValue& version) {
     return true;
 }
 
-VersionedValue* VersionChain::get_version(uint64_t read_timestamp) {
+MVCCVersionedValue* VersionChain::get_version(uint64_t read_timestamp) {
     std::shared_lock<std::shared_mutex> lock(versions_mutex_);
     return find_version_for_timestamp(read_timestamp);
 }
 
-VersionedValue* VersionChain::get_latest_version() {
+MVCCVersionedValue* VersionChain::get_latest_version() {
     std::shared_lock<std::shared_mutex> lock(versions_mutex_);
     
     if (versions_.empty()) {
@@ -42,10 +61,10 @@ VersionedValue* VersionChain::get_latest_version() {
     return nullptr;
 }
 
-std::vector<VersionedValue*> VersionChain::get_all_versions() {
+std::vector<MVCCVersionedValue*> VersionChain::get_all_versions() {
     std::shared_lock<std::shared_mutex> lock(versions_mutex_);
     
-    std::vector<VersionedValue*> result;
+    std::vector<MVCCVersionedValue*> result;
     for (const auto& version : versions_) {
         result.push_back(version.get());
     }
@@ -78,6 +97,11 @@ size_t VersionChain::cleanup_old_versions(uint64_t min_active_timestamp) {
             (*it)->create_timestamp < min_active_timestamp &&
             ((*it)->delete_timestamp == 0 || (*it)->delete_timestamp < min_active_timestamp)) {
             
+            if (budget_) {
+                size_t bytes = version_bytes(**it);
+                charged_bytes_ -= bytes;
+                budget_->release(MemoryBudget::Component::MVCC, bytes);
+            }
             it = versions_.erase(it);
             cleaned++;
         } else {
@@ -113,9 +137,9 @@ uint64_t VersionChain::get_latest_version_number() const {
     return versions_.back()->version;
 }
 
-VersionedValue* VersionChain::find_version_for_timestamp(uint64_t timestamp) {
+MVCCVersionedValue* VersionChain::find_version_for_timestamp(uint64_t timestamp) {
     // 找到对指定时间戳可见的最新版本
-    VersionedValue* result = nullptr;
+    MVCCVersionedValue* result = nullptr;
     
     for (auto it = versions_.rbegin(); it != versions_.rend(); ++it) {
         if ((*it)->is_visible_to(timestamp)) {
@@ -129,8 +153,8 @@ VersionedValue* VersionChain::find_version_for_timestamp(uint64_t timestamp) {
 
 void VersionChain::sort_versions_by_timestamp() {
     std::sort(versions_.begin(), versions_.end(),
-              [](const std::unique_ptr<VersionedValue>& a, 
-                 const std::unique_ptr<VersionedValue>& b) {
+              [](const std::unique_ptr<MVCCVersionedValue>& a, 
+                 const std::unique_ptr<MVCCVersionedValue>& b) {
                   return a->create_timestamp < b->create_timestamp;
               });
 }
@@ -164,7 +188,7 @@ bool MVCCManager::read(const std::string& key, uint64_t read_timestamp, std::str
         return false; // 键不存在
     }
     
-    VersionedValue* version = it->second->get_version(read_timestamp);
+    MVCCVersionedValue* version = it->second->get_version(read_timestamp);
     if (version && !version->is_deleted_at(read_timestamp)) {
         value = version->value;
         return true;
@@ -177,7 +201,7 @@ bool MVCCManager::write(const std::string& key, const std::string& value,
                        uint64_t transaction_id, uint64_t write_timestamp) {
     VersionChain* chain = get_or_create_version_chain(key);
     
-    VersionedValue new_version(value, generate_timestamp(), write_timestamp, transaction_id);
+    MVCCVersionedValue new_version(value, generate_timestamp(), write_timestamp, transaction_id);
     
     // 注册活跃事务
     register_active_transaction(transaction_id, write_timestamp);
@@ -195,7 +219,7 @@ bool MVCCManager::remove(const std::string& key, uint64_t transaction_id,
     }
     
     // 获取最新版本并标记删除
-    VersionedValue* latest = it->second->get_latest_version();
+    MVCCVersionedValue* latest = it->second->get_latest_version();
     if (latest) {
         return it->second->mark_deleted(latest->version, delete_timestamp);
     }
@@ -378,6 +402,10 @@ void MVCCManager::set_version_retention_time(std::chrono::milliseconds retention
     version_retention_time_ = retention_time;
 }
 
+void MVCCManager::set_memory_budget(MemoryBudget* budget) {
+    budget_.store(budget);
+}
+
 // 私有方法实现
 VersionChain* MVCCManager::get_or_create_version_chain(const std::string& key) {
     std::unique_lock<std::shared_mutex> lock(data_mutex_);
@@ -387,7 +415,7 @@ VersionChain* MVCCManager::get_or_create_version_chain(const std::string& key) {
         return it->second.get();
     }
     
-    auto chain = std::make_unique<VersionChain>(key);
+    auto chain = std::make_unique<VersionChain>(key, budget_.load());
     VersionChain* chain_ptr = chain.get();
     version_chains_[key] = std::move(chain);
     
@@ -10,8 +10,10 @@
 #include <chrono>
 #include <thread>
 
+class MemoryBudget;
+
 // 版本化值
-struct VersionedValue {
+struct MVCCVersionedValue {
     std::string value;
     uint64_t version;           // 版本号
     uint64_t create_timestamp;  // 创建时间戳
@@ -19,10 +21,10 @@ struct VersionedValue {
     uint64_t transaction_id;    // 创建该版本的事务ID
     bool is_committed;          // 是否已提交
     
-    VersionedValue() : version(0), create_timestamp(0), delete_timestamp(0),
+    MVCCVersionedValue() : version(0), create_timestamp(0), delete_timestamp(0),
                       transaction_id(0), is_committed(false) {}
     
-    VersionedValue(const std::string& val, uint64_t ver, uint64_t create_ts, uint64_t txn_id)
+    MVCCVersionedValue(const std::string& val, uint64_t ver, uint64_t create_ts, uint64_t txn_id)
         : value(val), version(ver), create_timestamp(create_ts), 
           delete_timestamp(0), transaction_id(txn_id), is_committed(false) {}
     
@@ -40,14 +42,15 @@ struct VersionedValue {
 // 版本链
 class VersionChain {
 public:
-    VersionChain(const std::string& key);
+    // budget 非空时，链本身与每个版本都向统一内存预算记账
+    explicit VersionChain(const std::string& key, MemoryBudget* budget = nullptr);
     ~VersionChain();
     
     // 版本操作
-    bool add_version(const VersionedValue& version);
-    VersionedValue* get_version(uint64_t read_timestamp);
-    VersionedValue* get_latest_version();
-    std::vector<VersionedValue*> get_all_versions();
+    bool add_version(const MVCCVersionedValue& version);
+    MVCCVersionedValue* get_version(uint64_t read_timestamp);
+    MVCCVersionedValue* get_latest_version();
+    std::vector<MVCCVersionedValue*> get_all_versions();
     
     // 删除操作
     bool mark_deleted(uint64_t version, uint64_t delete_timestamp);
@@ -64,11 +67,15 @@ public:
 
 private:
     std::string key_;
-    std::vector<std::unique_ptr<VersionedValue>> versions_;
+    std::vector<std::unique_ptr<MVCCVersionedValue>> versions_;
     mutable std::shared_mutex versions_mutex_;
+    MemoryBudget* budget_;
+    size_t charged_bytes_ = 0;
+    
+    static size_t version_bytes(const MVCCVersionedValue& version);
     
     // 辅助方法
-    VersionedValue* find_version_for_timestamp(uint64_t timestamp);
+    MVCCVersionedValue* find_version_for_timestamp(uint64_t timestamp);
     void sort_versions_by_timestamp();
 };
 
@@ -126,6 +133,8 @@ public:
     // 配置
     void set_max_versions_per_key(size_t max_versions);
     void set_version_retention_time(std::chrono::milliseconds retention_time);
+    // 版本链向统一内存预算记账；只对之后创建的版本链生效，预算需比 MVCCManager 活得更久
+    void set_memory_budget(MemoryBudget* budget);
 
 private:
     // 版本链存储
@@ -148,6 +157,7 @@ private:
     // 配置参数
     size_t max_versions_per_key_;
     std::chrono::milliseconds version_retention_time_;
+    std::atomic<MemoryBudget*> budget_{nullptr};
     
     // 统计信息
     mutable std::atomic<size_t> gc_runs_;
@@ -0,0 +1,378 @@
+#include "network/change_notifier.h"
+#include <algorithm>
+#include <chrono>
+
+// KeyPattern 实现
+KeyPattern::KeyPattern(const std::string& pattern) {
+    size_t start = 0;
+    while (true) {
+        size_t star = pattern.find('*', start);
+        if (star == std::string::npos) {
+            segments_.push_back(pattern.substr(start));
+            break;
+        }
+        segments_.push_back(pattern.substr(start, star - start));
+        start = star + 1;
+    }
+}
+
+bool KeyPattern::matches(const std::string& key) const {
+    const std::string& first = segments_.front();
+    if (segments_.size() == 1) {
+        return key == first;
+    }
+    if (key.compare(0, first.size(), first) != 0) {
+        return false;
+    }
+
+    const std::string& last = segments_.back();
+    if (key.size() < first.size() + last.size() ||
+        key.compare(key.size() - last.size(), last.size(), last) != 0) {
+        return false;
+    }
+
+    // 中间片段在首尾之间依次贪心查找最早出现的位置
+    size_t pos = first.size();
+    size_t end = key.size() - last.size();
+    for (size_t i = 1; i + 1 < segments_.size(); i++) {
+        const std::string& segment = segments_[i];
+        if (segment.empty()) {
+            continue;
+        }
+        size_t found = key.find(segment, pos);
+        if (found == std::string::npos || found + segment.size() > end) {
+            return false;
+        }
+        pos = found + segment.size();
+    }
+    return true;
+}
+
+// OutboundQueue 实现
+OutboundQueue::OutboundQueue(size_t capacity) : capacity_(std::max<size_t>(capacity, 1)) {
+}
+
+bool OutboundQueue::push(const ChangeEventPtr& event) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = positions_.find(event->key);
+    if (it != positions_.end()) {
+        events_[it->second] = event;  // 合并：同一 key 只发最新的
+    } else if (events_.size() >= capacity_) {
+        dropped_++;
+    } else {
+        positions_.emplace(event->key, events_.size());
+        events_.push_back(event);
+    }
+    return schedule_locked();
+}
+
+bool OutboundQueue::mark_dropped(uint64_t count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    dropped_ += count;
+    return schedule_locked();
+}
+
+bool OutboundQueue::schedule_locked() {
+    if (scheduled_) {
+        return false;
+    }
+    scheduled_ = true;
+    return true;
+}
+
+bool OutboundQueue::drain(std::vector<ChangeEventPtr>& events, uint64_t& dropped) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    events.clear();
+    dropped = dropped_;
+    if (events_.empty() && dropped_ == 0) {
+        scheduled_ = false;
+        return false;
+    }
+    events.swap(events_);
+    positions_.clear();
+    dropped_ = 0;
+    return true;
+}
+
+size_t OutboundQueue::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return events_.size();
+}
+
+// SubscriptionIndex 实现
+std::vector<const SubscriptionIndex::Entry*>& SubscriptionIndex::slot_for(Node& node, const Entry& entry) {
+    if (entry.pattern.is_exact()) {
+        return node.exact;
+    }
+    if (entry.pattern.is_prefix()) {
+        return node.prefixes;
+    }
+    return node.globs;
+}
+
+void SubscriptionIndex::add(const std::shared_ptr<Entry>& entry) {
+    Node* node = &root_;
+    for (char c : entry->pattern.literal_prefix()) {
+        auto& child = node->children[c];
+        if (!child) {
+            child = std::make_unique<Node>();
+        }
+        node = child.get();
+    }
+    slot_for(*node, *entry).push_back(entry.get());
+    entries_[entry->id] = entry;
+}
+
+bool SubscriptionIndex::remove(uint64_t id) {
+    auto it = entries_.find(id);
+    if (it == entries_.end()) {
+        return false;
+    }
+    const Entry* entry = it->second.get();
+
+    // 记录路径，删除后自底向上回收空节点
+    const std::string& prefix = entry->pattern.literal_prefix();
+    std::vector<Node*> path;
+    path.reserve(prefix.size() + 1);
+    Node* node = &root_;
+    path.push_back(node);
+    for (char c : prefix) {
+        node = node->children.at(c).get();
+        path.push_back(node);
+    }
+
+    auto& slot = slot_for(*node, *entry);
+    slot.erase(std::remove(slot.begin(), slot.end(), entry), slot.end());
+    for (size_t depth = prefix.size(); depth > 0 && path[depth]->empty(); depth--) {
+        path[depth - 1]->children.erase(prefix[depth - 1]);
+    }
+
+    entries_.erase(it);
+    return true;
+}
+
+void SubscriptionIndex::match(const std::string& key, bool is_delete, std::vector<const Entry*>& out) const {
+    auto accept = [&](const Entry* entry) {
+        if (!is_delete || entry->include_deletes) {
+            out.push_back(entry);
+        }
+    };
+
+    const Node* node = &root_;
+    size_t depth = 0;
+    while (node) {
+        for (const Entry* entry : node->prefixes) {
+            accept(entry);
+        }
+        for (const Entry* entry : node->globs) {
+            if (entry->pattern.matches(key)) {
+                accept(entry);
+            }
+        }
+        if (depth == key.size()) {
+            for (const Entry* entry : node->exact) {
+                accept(entry);
+            }
+            break;
+        }
+        auto it = node->children.find(key[depth]);
+        node = it == node->children.end() ? nullptr : it->second.get();
+        depth++;
+    }
+}
+
+// ChangeNotifier 实现
+ChangeNotifier::ChangeNotifier(size_t workers, size_t queue_capacity)
+    : queue_capacity_(std::max<size_t>(queue_capacity, 1)) {
+    workers = std::max<size_t>(workers, 1);
+    for (size_t i = 0; i < workers; i++) {
+        shards_.push_back(std::make_unique<Shard>());
+    }
+    for (auto& shard : shards_) {
+        workers_.emplace_back(&ChangeNotifier::worker_loop, this, std::ref(*shard));
+    }
+}
+
+ChangeNotifier::~ChangeNotifier() {
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        stopping_ = true;
+        shard->cv.notify_all();
+    }
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+uint64_t ChangeNotifier::subscribe(const std::string& pattern, bool include_deletes,
+                                   std::shared_ptr<OutboundQueue> queue, std::function<void()> wakeup) {
+    std::unique_lock<std::shared_mutex> lock(index_mutex_);
+    uint64_t id = next_id_++;
+    index_.add(std::make_shared<SubscriptionIndex::Entry>(
+        SubscriptionIndex::Entry{id, KeyPattern(pattern), include_deletes, std::move(queue), std::move(wakeup)}));
+    return id;
+}
+
+bool ChangeNotifier::unsubscribe(uint64_t id) {
+    std::unique_lock<std::shared_mutex> lock(index_mutex_);
+    return index_.remove(id);
+}
+
+size_t ChangeNotifier::subscription_count() const {
+    std::shared_lock<std::shared_mutex> lock(index_mutex_);
+    return index_.size();
+}
+
+void ChangeNotifier::publish(const std::string& key, const std::string& value, const std::string& operation) {
+    auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    auto event = std::make_shared<const ChangeEvent>(
+        ChangeEvent{key, value, operation, static_cast<uint64_t>(now)});
+
+    Shard& shard = *shards_[std::hash<std::string>()(key) % shards_.size()];
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (shard.events.size() >= queue_capacity_) {
+            shard.dropped++;
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            shard.events.push_back(std::move(event));
+        }
+    }
+    published_.fetch_add(1, std::memory_order_relaxed);
+    shard.cv.notify_one();
+}
+
+void ChangeNotifier::wait_idle() {
+    for (auto& shard : shards_) {
+        std::unique_lock<std::mutex> lock(shard->mutex);
+        shard->idle_cv.wait(lock, [&shard] {
+            return shard->events.empty() && shard->dropped == 0 && !shard->busy;
+        });
+    }
+}
+
+void ChangeNotifier::worker_loop(Shard& shard) {
+    std::deque<ChangeEventPtr> batch;
+    while (true) {
+        uint64_t dropped = 0;
+        {
+            std::unique_lock<std::mutex> lock(shard.mutex);
+            shard.busy = false;
+            shard.idle_cv.notify_all();
+            shard.cv.wait(lock, [&] { return stopping_ || !shard.events.empty() || shard.dropped > 0; });
+            if (stopping_) {
+                return;
+            }
+            batch.swap(shard.events);
+            dropped = shard.dropped;
+            shard.dropped = 0;
+            shard.busy = true;
+        }
+
+        // 分片队列溢出时无法知道丢掉的事件匹配谁，所有订阅都视为落后
+        if (dropped > 0) {
+            mark_all_dropped(dropped);
+        }
+        for (const auto& event : batch) {
+            dispatch(event);
+        }
+        batch.clear();
+    }
+}
+
+void ChangeNotifier::dispatch(const ChangeEventPtr& event) {
+    thread_local std::vector<const SubscriptionIndex::Entry*> matched;
+    matched.clear();
+
+    std::shared_lock<std::shared_mutex> lock(index_mutex_);
+    index_.match(event->key, event->operation == "DELETE", matched);
+    for (const auto* entry : matched) {
+        if (entry->queue->push(event) && entry->wakeup) {
+            entry->wakeup();
+        }
+    }
+}
+
+void ChangeNotifier::mark_all_dropped(uint64_t count) {
+    std::shared_lock<std::shared_mutex> lock(index_mutex_);
+    index_.for_each([count](const SubscriptionIndex::Entry& entry) {
+        if (entry.queue->mark_dropped(count) && entry.wakeup) {
+            entry.wakeup();
+        }
+    });
+}
+
+// ConnectionSubscriptions 实现
+ConnectionSubscriptions::ConnectionSubscriptions(std::shared_ptr<ChangeNotifier> notifier)
+    : notifier_(std::move(notifier)) {}
+
+ConnectionSubscriptions::~ConnectionSubscriptions() {
+    close_all();
+}
+
+void ConnectionSubscriptions::open(const Handle& hdl) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    connections_[hdl].queue = std::make_shared<OutboundQueue>();
+}
+
+void ConnectionSubscriptions::close(const Handle& hdl) {
+    std::vector<uint64_t> subscription_ids;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = connections_.find(hdl);
+        if (it == connections_.end()) {
+            return;
+        }
+        subscription_ids.swap(it->second.subscription_ids);
+        connections_.erase(it);
+    }
+    for (uint64_t id : subscription_ids) {
+        notifier_->unsubscribe(id);
+    }
+}
+
+void ConnectionSubscriptions::close_all() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& [hdl, connection] : connections_) {
+        for (uint64_t id : connection.subscription_ids) {
+            notifier_->unsubscribe(id);
+        }
+    }
+    connections_.clear();
+}
+
+uint64_t ConnectionSubscriptions::subscribe(const Handle& hdl, const std::string& pattern, bool include_deletes,
+                                            std::function<void()> wakeup) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = connections_.find(hdl);
+    if (it == connections_.end()) {
+        return 0;
+    }
+    uint64_t id = notifier_->subscribe(pattern, include_deletes, it->second.queue, std::move(wakeup));
+    it->second.subscription_ids.push_back(id);
+    return id;
+}
+
+bool ConnectionSubscriptions::unsubscribe(const Handle& hdl, uint64_t id) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = connections_.find(hdl);
+        if (it == connections_.end()) {
+            return false;
+        }
+        auto& ids = it->second.subscription_ids;
+        auto pos = std::find(ids.begin(), ids.end(), id);
+        if (pos == ids.end()) {
+            return false;
+        }
+        ids.erase(pos);
+    }
+    return notifier_->unsubscribe(id);
+}
+
+std::shared_ptr<OutboundQueue> ConnectionSubscriptions::queue(const Handle& hdl) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = connections_.find(hdl);
+    return it != connections_.end() ? it->second.queue : nullptr;
+}
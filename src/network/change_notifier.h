@@ -0,0 +1,203 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <unordered_map>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+
+// 变更事件：写路径发布一次，所有匹配的连接共享同一份
+struct ChangeEvent {
+    std::string key;
+    std::string value;
+    std::string operation;  // PUT / DELETE
+    uint64_t timestamp;     // 毫秒
+};
+
+using ChangeEventPtr = std::shared_ptr<const ChangeEvent>;
+
+// 订阅模式：'*' 匹配任意长度（含空）的字符序列，其余字符按字面匹配
+class KeyPattern {
+public:
+    explicit KeyPattern(const std::string& pattern);
+
+    bool matches(const std::string& key) const;
+
+    // 第一个 '*' 之前的字面前缀，用于挂到前缀树上
+    const std::string& literal_prefix() const { return segments_.front(); }
+    bool is_exact() const { return segments_.size() == 1; }
+    // 形如 "abc*"：只有结尾一个通配符
+    bool is_prefix() const { return segments_.size() == 2 && segments_.back().empty(); }
+
+private:
+    std::vector<std::string> segments_;  // 按 '*' 切分的字面片段
+};
+
+// 每个连接一个发送队列：通知线程写入，连接自己的发送路径取走。
+// 同一个 key 尚未发出的事件只保留最新一条（位置不变）；积压超过容量时丢弃新 key 的事件并计数，
+// 发送方取走时拿到丢弃数，据此告知客户端已落后
+class OutboundQueue {
+public:
+    explicit OutboundQueue(size_t capacity = 4096);
+
+    // 返回 true 表示队列从空闲变为待发送，调用方需要唤醒发送方
+    bool push(const ChangeEventPtr& event);
+    bool mark_dropped(uint64_t count);
+
+    // 取走全部待发事件（按首次入队顺序）和自上次取走以来的丢弃数；
+    // 没有任何待发内容时清除待发送标记并返回 false，之后的 push 会再次唤醒发送方
+    bool drain(std::vector<ChangeEventPtr>& events, uint64_t& dropped);
+
+    size_t size() const;
+
+private:
+    bool schedule_locked();
+
+    const size_t capacity_;
+    mutable std::mutex mutex_;
+    std::vector<ChangeEventPtr> events_;
+    std::unordered_map<std::string, size_t> positions_;  // key -> events_ 下标
+    uint64_t dropped_ = 0;
+    bool scheduled_ = false;
+};
+
+// 订阅匹配索引：不含通配符的模式和 "前缀*" 挂在前缀树节点上，一次沿 key 下行即可找出全部匹配；
+// 其余通配模式挂在其字面前缀对应的节点上，只有 key 经过该节点时才逐个匹配（以 '*' 开头的落在根节点）
+class SubscriptionIndex {
+public:
+    struct Entry {
+        uint64_t id;
+        KeyPattern pattern;
+        bool include_deletes;
+        std::shared_ptr<OutboundQueue> queue;
+        std::function<void()> wakeup;
+    };
+
+    void add(const std::shared_ptr<Entry>& entry);
+    bool remove(uint64_t id);
+
+    void match(const std::string& key, bool is_delete, std::vector<const Entry*>& out) const;
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        for (const auto& [id, entry] : entries_) {
+            fn(*entry);
+        }
+    }
+
+    size_t size() const { return entries_.size(); }
+
+private:
+    struct Node {
+        std::map<char, std::unique_ptr<Node>> children;
+        std::vector<const Entry*> exact;     // 模式等于到此为止的路径
+        std::vector<const Entry*> prefixes;  // "路径*"
+        std::vector<const Entry*> globs;     // 字面前缀为此路径的其它通配模式
+        bool empty() const { return children.empty() && exact.empty() && prefixes.empty() && globs.empty(); }
+    };
+
+    std::vector<const Entry*>& slot_for(Node& node, const Entry& entry);
+
+    Node root_;
+    std::unordered_map<uint64_t, std::shared_ptr<Entry>> entries_;
+};
+
+// 变更通知器：写路径只把事件放进按 key 哈希选定的分片队列（同一 key 的事件保持顺序），
+// 由通知线程池在写路径之外匹配订阅并投递到各连接的发送队列。
+// gRPC 和 WebSocket 服务可以共用一个通知器，任一协议的写入都会通知两边的订阅者
+class ChangeNotifier {
+public:
+    explicit ChangeNotifier(size_t workers = 2, size_t queue_capacity = 65536);
+    ~ChangeNotifier();
+
+    ChangeNotifier(const ChangeNotifier&) = delete;
+    ChangeNotifier& operator=(const ChangeNotifier&) = delete;
+
+    // wakeup 在队列从空闲变为待发送时由通知线程调用，应当只调度发送、不阻塞
+    uint64_t subscribe(const std::string& pattern, bool include_deletes,
+                       std::shared_ptr<OutboundQueue> queue, std::function<void()> wakeup);
+    // 返回后该订阅不会再收到事件，也不会再调用其 wakeup
+    bool unsubscribe(uint64_t id);
+
+    // 写路径调用：只入队不匹配；分片队列满时丢弃事件，并把所有订阅标记为落后
+    void publish(const std::string& key, const std::string& value, const std::string& operation);
+
+    // 等待已发布的事件全部分发完
+    void wait_idle();
+
+    size_t subscription_count() const;
+    uint64_t published_events() const { return published_.load(std::memory_order_relaxed); }
+    uint64_t dropped_events() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    struct Shard {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::condition_variable idle_cv;
+        std::deque<ChangeEventPtr> events;
+        uint64_t dropped = 0;
+        bool busy = false;
+    };
+
+    void worker_loop(Shard& shard);
+    void dispatch(const ChangeEventPtr& event);
+    void mark_all_dropped(uint64_t count);
+
+    const size_t queue_capacity_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::vector<std::thread> workers_;
+    std::atomic<bool> stopping_{false};
+
+    // 分发持读锁，订阅变更持写锁：unsubscribe 拿到写锁即保证没有进行中的投递
+    mutable std::shared_mutex index_mutex_;
+    SubscriptionIndex index_;
+    uint64_t next_id_ = 1;
+
+    std::atomic<uint64_t> published_{0};
+    std::atomic<uint64_t> dropped_{0};
+};
+
+// 按连接登记订阅：每个连接一个发送队列，该连接的所有订阅共用，连接关闭时一并退订。
+// 连接句柄是 std::weak_ptr<void>（即 websocketpp::connection_hdl），不依赖具体的网络库；
+// 匹配在通知器线程完成，连接自己的发送线程用 queue() 取出事件发送，写路径只调用 notifier().publish
+class ConnectionSubscriptions {
+public:
+    using Handle = std::weak_ptr<void>;
+
+    explicit ConnectionSubscriptions(std::shared_ptr<ChangeNotifier> notifier);
+    ~ConnectionSubscriptions();
+
+    ConnectionSubscriptions(const ConnectionSubscriptions&) = delete;
+    ConnectionSubscriptions& operator=(const ConnectionSubscriptions&) = delete;
+
+    void open(const Handle& hdl);
+    void close(const Handle& hdl);
+    // 退订所有连接：返回后不会再调用任何 wakeup
+    void close_all();
+
+    // 连接未打开或已关闭时返回 0
+    uint64_t subscribe(const Handle& hdl, const std::string& pattern, bool include_deletes,
+                       std::function<void()> wakeup);
+    // 只能退订本连接的订阅
+    bool unsubscribe(const Handle& hdl, uint64_t id);
+
+    // 连接已关闭时返回空
+    std::shared_ptr<OutboundQueue> queue(const Handle& hdl) const;
+    ChangeNotifier& notifier() { return *notifier_; }
+
+private:
+    struct Connection {
+        std::shared_ptr<OutboundQueue> queue;
+        std::vector<uint64_t> subscription_ids;
+    };
+
+    std::shared_ptr<ChangeNotifier> notifier_;
+    mutable std::mutex mutex_;
+    std::map<Handle, Connection, std::owner_less<Handle>> connections_;
+};
@@ -1,19 +1,80 @@
 #include "network/grpc_server.h"
 #include <iostream>
 #include <chrono>
-#include <regex>
+#include <climits>
+#include <algorithm>
 
-KVDBServiceImpl::KVDBServiceImpl(KVDB& db) : db_(db) {
+// ScanCursor 实现
+ScanCursor::ScanCursor(KVDB& db, int limit, uint32_t batch_bytes, size_t default_batch_bytes)
+    : db_(db),
+      snapshot_(db.get_snapshot()),
+      remaining_(limit > 0 ? limit : INT_MAX),
+      batch_bytes_(std::min<size_t>(batch_bytes > 0 ? batch_bytes : default_batch_bytes, MAX_BATCH_BYTES)) {
 }
 
-KVDBServiceImpl::~KVDBServiceImpl() {
-    // 停止所有订阅
-    std::lock_guard<std::mutex> lock(subscriptions_mutex_);
-    for (auto& sub : subscriptions_) {
-        sub->active = false;
+ScanCursor::ScanCursor(KVDB& db, const kvdb::ScanRequest& request, size_t default_batch_bytes)
+    : ScanCursor(db, request.limit(), request.batch_bytes(), default_batch_bytes) {
+    ReadOptions options;
+    options.iterate_lower_bound = request.start_key();
+    if (!request.end_key().empty()) {
+        // end_key 是闭区间，上界取紧随其后的 key，越界后子迭代器不再读盘
+        options.iterate_upper_bound = request.end_key() + '\0';
+    }
+    iter_ = db_.new_iterator(snapshot_, options);
+    iter_->seek(request.start_key());
+}
+
+ScanCursor::ScanCursor(KVDB& db, const kvdb::PrefixScanRequest& request, size_t default_batch_bytes)
+    : ScanCursor(db, request.limit(), request.batch_bytes(), default_batch_bytes) {
+    prefix_ = request.prefix();
+    iter_ = db_.new_prefix_iterator(snapshot_, prefix_);
+}
+
+ScanCursor::~ScanCursor() {
+    iter_.reset();
+    db_.release_snapshot(snapshot_);
+}
+
+size_t ScanCursor::next_batch(google::protobuf::RepeatedPtrField<kvdb::KeyValue>* pairs) {
+    size_t added = 0;
+    size_t bytes = 0;
+
+    while (iter_->valid() && remaining_ > 0) {
+        Slice key = iter_->key_slice();
+        if (!prefix_.empty() && !key.starts_with(prefix_)) {
+            remaining_ = 0;
+            break;
+        }
+
+        Slice value = iter_->value_slice();
+        if (!value.empty()) {
+            // 每个 KV 另计约 8 字节的 protobuf 字段头
+            size_t entry_bytes = key.size() + value.size() + 8;
+            if (added > 0 && bytes + entry_bytes > batch_bytes_) {
+                break;  // 留给下一批，迭代器停在当前条目
+            }
+            kvdb::KeyValue* pair = pairs->Add();
+            pair->set_key(key.data(), key.size());
+            pair->set_value(value.data(), value.size());
+            bytes += entry_bytes;
+            added++;
+            remaining_--;
+        }
+        iter_->next();
+    }
+    return added;
+}
+
+KVDBServiceImpl::KVDBServiceImpl(KVDB& db, size_t scan_batch_bytes, std::shared_ptr<ChangeNotifier> notifier)
+    : db_(db), scan_batch_bytes_(scan_batch_bytes), notifier_(std::move(notifier)) {
+    if (!notifier_) {
+        notifier_ = std::make_shared<ChangeNotifier>();
     }
 }
 
+KVDBServiceImpl::~KVDBServiceImpl() {
+}
+
 grpc::Status KVDBServiceImpl::Put(grpc::ServerContext* context,
                                   const kvdb::PutRequest* request,
                                   kvdb::PutResponse* response) {
@@ -22,7 +83,7 @@ grpc::Status KVDBServiceImpl::Put(grpc::ServerContext* context,
         response->set_success(success);
         
         // 通知订阅者
-        notify_subscribers(request->key(), request->value(), "PUT");
+        notifier_->publish(request->key(), request->value(), "PUT");
         
         return grpc::Status::OK;
     } catch (const std::exception& e) {
@@ -58,7 +119,7 @@ grpc::Status KVDBServiceImpl::Delete(grpc::ServerContext* context,
         response->set_success(success);
         
         // 通知订阅者
-        notify_subscribers(request->key(), "", "DELETE");
+        notifier_->publish(request->key(), "", "DELETE");
         
         return grpc::Status::OK;
     } catch (const std::exception& e) {
@@ -76,7 +137,7 @@ grpc::Status KVDBServiceImpl::BatchPut(grpc::ServerContext* context,
         for (const auto& pair : request->pairs()) {
             if (db_.put(pair.key(), pair.value())) {
                 processed++;
-                notify_subscribers(pair.key(), pair.value(), "PUT");
+                notifier_->publish(pair.key(), pair.value(), "PUT");
             }
         }
         response->set_success(processed == request->pairs_size());
@@ -112,30 +173,17 @@ grpc::Status KVDBServiceImpl::Scan(grpc::ServerContext* context,
                                    const kvdb::ScanRequest* request,
                                    grpc::ServerWriter<kvdb::ScanResponse>* writer) {
     try {
-        Snapshot snap = db_.get_snapshot();
-        auto iter = db_.new_iterator(snap);
-        
-        int count = 0;
-        int limit = request->limit() > 0 ? request->limit() : INT_MAX;
-        
-        for (iter->seek(request->start_key()); 
-             iter->valid() && iter->key() <= request->end_key() && count < limit; 
-             iter->next()) {
-            
+        ScanCursor cursor(db_, *request, scan_batch_bytes_);
+        kvdb::ScanResponse response;
+        while (cursor.next_batch(response.mutable_pairs()) > 0) {
             if (context->IsCancelled()) {
                 return grpc::Status::CANCELLED;
             }
-            
-            std::string value = iter->value();
-            if (!value.empty()) {
-                kvdb::ScanResponse response;
-                response.set_key(iter->key());
-                response.set_value(value);
-                writer->Write(response);
-                count++;
+            if (!writer->Write(response)) {
+                break;
             }
+            response.Clear();
         }
-        
         return grpc::Status::OK;
     } catch (const std::exception& e) {
         return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
@@ -146,36 +194,17 @@ grpc::Status KVDBServiceImpl::PrefixScan(grpc::ServerContext* context,
                                           const kvdb::PrefixScanRequest* request,
                                           grpc::ServerWriter<kvdb::PrefixScanResponse>* writer) {
     try {
-        Snapshot snap = db_.get_snapshot();
-        auto iter = db_.new_prefix_iterator(snap, request->prefix());
-        
-        int count = 0;
-        int limit = request->limit() > 0 ? request->limit() : INT_MAX;
-        
-        while (iter->valid() && count < limit) {
+        ScanCursor cursor(db_, *request, scan_batch_bytes_);
+        kvdb::PrefixScanResponse response;
+        while (cursor.next_batch(response.mutable_pairs()) > 0) {
             if (context->IsCancelled()) {
                 return grpc::Status::CANCELLED;
             }
-            
-            std::string key = iter->key();
-            std::string value = iter->value();
-            
-            // 检查前缀匹配
-            if (key.size() < request->prefix().size() || 
-                key.substr(0, request->prefix().size()) != request->prefix()) {
+            if (!writer->Write(response)) {
                 break;
             }
-            
-            if (!value.empty()) {
-                kvdb::PrefixScanResponse response;
-                response.set_key(key);
-                response.set_value(value);
-                writer->Write(response);
-                count++;
-            }
-            iter->next();
+            response.Clear();
         }
-        
         return grpc::Status::OK;
     } catch (const std::exception& e) {
         return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
@@ -297,86 +326,62 @@ grpc::Status KVDBServiceImpl::SetCompactionStrategy(grpc::ServerContext* context
 grpc::Status KVDBServiceImpl::Subscribe(grpc::ServerContext* context,
                                         const kvdb::SubscribeRequest* request,
                                         grpc::ServerWriter<kvdb::SubscribeResponse>* writer) {
-    auto subscription = std::make_shared<Subscription>();
-    subscription->pattern = request->key_pattern();
-    subscription->include_deletes = request->include_deletes();
-    subscription->writer = writer;
-    
-    {
-        std::lock_guard<std::mutex> lock(subscriptions_mutex_);
-        subscriptions_.push_back(subscription);
-    }
-    
-    // 保持连接活跃，直到客户端断开
-    while (!context->IsCancelled() && subscription->active) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    }
-    
-    // 清理订阅
-    {
-        std::lock_guard<std::mutex> lock(subscriptions_mutex_);
-        subscriptions_.erase(
-            std::remove_if(subscriptions_.begin(), subscriptions_.end(),
-                [subscription](const std::shared_ptr<Subscription>& shared_sub) {
-                    return !shared_sub || shared_sub.get() == subscription.get();
-                }),
-            subscriptions_.end());
-    }
-    
-    return grpc::Status::OK;
-}
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool signaled = false;
 
-void KVDBServiceImpl::notify_subscribers(const std::string& key, const std::string& value, const std::string& operation) {
-    std::lock_guard<std::mutex> lock(subscriptions_mutex_);
-    
-    auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
-        std::chrono::system_clock::now().time_since_epoch()).count();
-    
-    for (auto it = subscriptions_.begin(); it != subscriptions_.end();) {
-        auto& sub = *it;
-        
-        if (!sub->active) {
-            it = subscriptions_.erase(it);
-            continue;
-        }
-        
-        if (matches_pattern(key, sub->pattern) && 
-            (sub->include_deletes || operation != "DELETE")) {
-            
-            kvdb::SubscribeResponse response;
-            response.set_key(key);
-            response.set_value(value);
-            response.set_operation(operation);
-            response.set_timestamp(now);
-            
-            try {
-                sub->writer->Write(response);
-            } catch (...) {
-                sub->active = false;
-                it = subscriptions_.erase(it);
+    auto queue = std::make_shared<OutboundQueue>();
+    uint64_t id = notifier_->subscribe(request->key_pattern(), request->include_deletes(), queue, [&] {
+        std::lock_guard<std::mutex> lock(mutex);
+        signaled = true;
+        cv.notify_one();
+    });
+
+    // 事件在本线程写出，不占用写请求和通知线程；同步 API 没有取消通知，只能定期检查
+    std::vector<ChangeEventPtr> events;
+    uint64_t dropped = 0;
+    kvdb::SubscribeResponse response;
+    bool ok = true;
+    while (ok && !context->IsCancelled()) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!cv.wait_for(lock, std::chrono::milliseconds(100), [&signaled] { return signaled; })) {
                 continue;
             }
+            signaled = false;
+        }
+        // 一直取到队列为空，之后的事件会再次唤醒
+        while (ok && queue->drain(events, dropped)) {
+            if (dropped > 0) {
+                fill_lagged(dropped, &response);
+                ok = writer->Write(response);
+            }
+            for (size_t i = 0; ok && i < events.size(); i++) {
+                fill_event(*events[i], &response);
+                ok = writer->Write(response);
+            }
         }
-        
-        ++it;
     }
+
+    // 返回后不会再调用 wakeup，局部的 mutex / cv 可以安全销毁
+    notifier_->unsubscribe(id);
+    return grpc::Status::OK;
 }
 
-bool KVDBServiceImpl::matches_pattern(const std::string& key, const std::string& pattern) {
-    if (pattern == "*") return true;
-    if (pattern.empty()) return key.empty();
-    
-    // 简单的通配符匹配
-    try {
-        std::string regex_pattern = pattern;
-        std::replace(regex_pattern.begin(), regex_pattern.end(), '*', '.');
-        regex_pattern = "^" + regex_pattern + "$";
-        std::regex re(regex_pattern);
-        return std::regex_match(key, re);
-    } catch (...) {
-        // 如果正则表达式无效，使用前缀匹配
-        return key.find(pattern) == 0;
-    }
+void KVDBServiceImpl::fill_event(const ChangeEvent& event, kvdb::SubscribeResponse* response) {
+    response->Clear();
+    response->set_key(event.key);
+    response->set_value(event.value);
+    response->set_operation(event.operation);
+    response->set_timestamp(event.timestamp);
+}
+
+void KVDBServiceImpl::fill_lagged(uint64_t dropped, kvdb::SubscribeResponse* response) {
+    response->Clear();
+    response->set_operation("LAGGED");
+    response->set_timestamp(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+    response->set_dropped_events(dropped);
 }
 
 CompactionStrategyType KVDBServiceImpl::convert_strategy_type(kvdb::CompactionStrategyType proto_type) {
@@ -399,10 +404,325 @@ kvdb::CompactionStrategyType KVDBServiceImpl::convert_strategy_type(CompactionSt
     }
 }
 
+// 异步服务：每个完成队列一个轮询线程，RPC 由调用对象的状态机驱动。
+// 一元调用在轮询线程上直接执行；扫描每次写一批，等写完成事件再装下一批；
+// 订阅流只在有事件时发起写，空闲时不占用任何线程
+namespace {
+
+using AsyncService = kvdb::KVDBService::AsyncService;
+
+enum CallEvent {
+    EVENT_REQUEST = 0,  // 新调用到达
+    EVENT_WRITE,        // 流式写完成
+    EVENT_FINISH,       // 响应/状态已发出
+    EVENT_DONE,         // 调用结束（含客户端取消），AsyncNotifyWhenDone
+    EVENT_COUNT
+};
+
+class AsyncCall;
+
+// 完成队列的 tag：指向调用对象和事件类型
+struct CallTag {
+    AsyncCall* call;
+    CallEvent event;
+};
+
+struct CallEnv {
+    GRPCServer* server;
+    AsyncService* service;
+    KVDBServiceImpl* handlers;
+    grpc::ServerCompletionQueue* cq;
+};
+
+class AsyncCall {
+public:
+    explicit AsyncCall(const CallEnv& env) : env_(env) {
+        for (int i = 0; i < EVENT_COUNT; i++) {
+            tags_[i] = CallTag{this, static_cast<CallEvent>(i)};
+        }
+        env_.server->call_started();
+    }
+    virtual ~AsyncCall() {
+        env_.server->call_finished();
+    }
+
+    // 同一个调用的事件只在它所属完成队列的轮询线程上处理，彼此串行
+    virtual void on_event(CallEvent event, bool ok) = 0;
+
+protected:
+    void* tag(CallEvent event) { return &tags_[event]; }
+
+    CallEnv env_;
+    grpc::ServerContext context_;
+
+private:
+    CallTag tags_[EVENT_COUNT];
+};
+
+template <typename Request, typename Response>
+class UnaryCall : public AsyncCall {
+public:
+    using RequestMethod = void (AsyncService::*)(grpc::ServerContext*, Request*,
+                                                 grpc::ServerAsyncResponseWriter<Response>*,
+                                                 grpc::CompletionQueue*, grpc::ServerCompletionQueue*, void*);
+    using Handler = grpc::Status (KVDBServiceImpl::*)(grpc::ServerContext*, const Request*, Response*);
+
+    // 在完成队列上挂一个等待新调用的对象，处理完成后自行释放
+    static void listen(const CallEnv& env, RequestMethod request_method, Handler handler) {
+        new UnaryCall(env, request_method, handler);
+    }
+
+    void on_event(CallEvent event, bool ok) override {
+        if (event == EVENT_REQUEST && ok) {
+            if (!env_.server->shutting_down()) {
+                listen(env_, request_method_, handler_);
+            }
+            grpc::Status status = (env_.handlers->*handler_)(&context_, &request_, &response_);
+            responder_.Finish(response_, status, tag(EVENT_FINISH));
+            return;
+        }
+        // 服务关闭时未到达的请求，或响应已发出
+        delete this;
+    }
+
+private:
+    UnaryCall(const CallEnv& env, RequestMethod request_method, Handler handler)
+        : AsyncCall(env), request_method_(request_method), handler_(handler), responder_(&context_) {
+        (env_.service->*request_method_)(&context_, &request_, &responder_, env_.cq, env_.cq, tag(EVENT_REQUEST));
+    }
+
+    RequestMethod request_method_;
+    Handler handler_;
+    Request request_;
+    Response response_;
+    grpc::ServerAsyncResponseWriter<Response> responder_;
+};
+
+// Scan / PrefixScan：同一时刻最多一个写在途，写完成后再从游标装下一批
+template <typename Request, typename Response>
+class ScanCall : public AsyncCall {
+public:
+    using RequestMethod = void (AsyncService::*)(grpc::ServerContext*, Request*,
+                                                 grpc::ServerAsyncWriter<Response>*,
+                                                 grpc::CompletionQueue*, grpc::ServerCompletionQueue*, void*);
+
+    static void listen(const CallEnv& env, RequestMethod request_method) {
+        new ScanCall(env, request_method);
+    }
+
+    void on_event(CallEvent event, bool ok) override {
+        if (event == EVENT_REQUEST && ok) {
+            if (!env_.server->shutting_down()) {
+                listen(env_, request_method_);
+            }
+            try {
+                cursor_ = std::make_unique<ScanCursor>(env_.handlers->db(), request_,
+                                                       env_.handlers->scan_batch_bytes());
+            } catch (const std::exception& e) {
+                writer_.Finish(grpc::Status(grpc::StatusCode::INTERNAL, e.what()), tag(EVENT_FINISH));
+                return;
+            }
+            write_next_batch();
+            return;
+        }
+        if (event == EVENT_WRITE && ok) {
+            write_next_batch();
+            return;
+        }
+        // 请求未到达、写失败（客户端断开或服务关闭）或状态已发出
+        delete this;
+    }
+
+private:
+    ScanCall(const CallEnv& env, RequestMethod request_method)
+        : AsyncCall(env), request_method_(request_method), writer_(&context_) {
+        (env_.service->*request_method_)(&context_, &request_, &writer_, env_.cq, env_.cq, tag(EVENT_REQUEST));
+    }
+
+    void write_next_batch() {
+        response_.Clear();
+        size_t count = 0;
+        try {
+            count = cursor_->next_batch(response_.mutable_pairs());
+        } catch (const std::exception& e) {
+            writer_.Finish(grpc::Status(grpc::StatusCode::INTERNAL, e.what()), tag(EVENT_FINISH));
+            return;
+        }
+        if (count == 0) {
+            cursor_.reset();  // 尽早释放快照
+            writer_.Finish(grpc::Status::OK, tag(EVENT_FINISH));
+        } else {
+            writer_.Write(response_, tag(EVENT_WRITE));
+        }
+    }
+
+    RequestMethod request_method_;
+    Request request_;
+    Response response_;
+    grpc::ServerAsyncWriter<Response> writer_;
+    std::unique_ptr<ScanCursor> cursor_;
+};
+
+// Subscribe：通知线程把事件放进本调用的发送队列，队列从空闲变为待发送时经 wakeup 发起写；
+// 每次取走一批逐条写出，写完再取，同一时刻最多一个写在途。
+// 调用结束（客户端取消或服务关闭）由 AsyncNotifyWhenDone 通知，退订后等在途的写完成再释放
+class SubscribeCall : public AsyncCall {
+public:
+    static void listen(const CallEnv& env) {
+        new SubscribeCall(env);
+    }
+
+    void on_event(CallEvent event, bool ok) override {
+        switch (event) {
+            case EVENT_REQUEST:
+                if (!ok) {
+                    delete this;  // 调用没有开始，DONE 事件不会到来
+                    return;
+                }
+                if (!env_.server->shutting_down()) {
+                    listen(env_);
+                }
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    started_ = true;
+                    if (done_) {
+                        break;
+                    }
+                }
+                subscription_id_ = env_.handlers->notifier().subscribe(
+                    request_.key_pattern(), request_.include_deletes(), queue_, [this] { on_wakeup(); });
+                break;
+            case EVENT_WRITE: {
+                std::lock_guard<std::mutex> lock(mutex_);
+                write_in_flight_ = false;
+                if (!ok) {
+                    broken_ = true;
+                } else if (!done_) {
+                    write_next_locked();
+                }
+                break;
+            }
+            case EVENT_DONE: {
+                // 退订返回后不会再有 on_wakeup，此后只剩在途写的完成事件
+                if (subscription_id_ != 0) {
+                    env_.handlers->notifier().unsubscribe(subscription_id_);
+                }
+                std::lock_guard<std::mutex> lock(mutex_);
+                done_ = true;
+                break;
+            }
+            default:
+                break;
+        }
+        maybe_release();
+    }
+
+private:
+    explicit SubscribeCall(const CallEnv& env)
+        : AsyncCall(env), stream_(&context_), queue_(std::make_shared<OutboundQueue>()) {
+        // 必须在调用开始之前注册
+        context_.AsyncNotifyWhenDone(tag(EVENT_DONE));
+        env_.service->RequestSubscribe(&context_, &request_, &stream_, env_.cq, env_.cq, tag(EVENT_REQUEST));
+    }
+
+    // 通知线程调用
+    void on_wakeup() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!write_in_flight_ && !done_) {
+            write_next_locked();
+        }
+    }
+
+    // 当前批写完后再从发送队列取下一批；队列取空后清除待发送标记，等下一次 wakeup
+    void write_next_locked() {
+        if (broken_) {
+            uint64_t dropped = 0;
+            while (queue_->drain(batch_, dropped)) {
+            }
+            batch_.clear();
+            return;
+        }
+        if (next_ >= batch_.size()) {
+            uint64_t dropped = 0;
+            next_ = 0;
+            if (!queue_->drain(batch_, dropped)) {
+                return;
+            }
+            if (dropped > 0) {
+                KVDBServiceImpl::fill_lagged(dropped, &current_);
+                start_write_locked();
+                return;
+            }
+            if (batch_.empty()) {
+                return;
+            }
+        }
+        KVDBServiceImpl::fill_event(*batch_[next_++], &current_);
+        start_write_locked();
+    }
+
+    void start_write_locked() {
+        write_in_flight_ = true;
+        stream_.Write(current_, tag(EVENT_WRITE));
+    }
+
+    void maybe_release() {
+        bool release;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            release = started_ && done_ && !write_in_flight_;
+        }
+        if (release) {
+            delete this;
+        }
+    }
+
+    kvdb::SubscribeRequest request_;
+    grpc::ServerAsyncWriter<kvdb::SubscribeResponse> stream_;
+    std::shared_ptr<OutboundQueue> queue_;
+    uint64_t subscription_id_ = 0;
+
+    std::mutex mutex_;
+    std::vector<ChangeEventPtr> batch_;
+    size_t next_ = 0;
+    kvdb::SubscribeResponse current_;
+    bool started_ = false;
+    bool write_in_flight_ = false;
+    bool broken_ = false;
+    bool done_ = false;
+};
+
+// 为每个 RPC 在完成队列上挂一个等待对象
+void listen_all(const CallEnv& env) {
+    using namespace kvdb;
+    UnaryCall<PutRequest, PutResponse>::listen(env, &AsyncService::RequestPut, &KVDBServiceImpl::Put);
+    UnaryCall<GetRequest, GetResponse>::listen(env, &AsyncService::RequestGet, &KVDBServiceImpl::Get);
+    UnaryCall<DeleteRequest, DeleteResponse>::listen(env, &AsyncService::RequestDelete, &KVDBServiceImpl::Delete);
+    UnaryCall<BatchPutRequest, BatchPutResponse>::listen(env, &AsyncService::RequestBatchPut, &KVDBServiceImpl::BatchPut);
+    UnaryCall<BatchGetRequest, BatchGetResponse>::listen(env, &AsyncService::RequestBatchGet, &KVDBServiceImpl::BatchGet);
+    UnaryCall<CreateSnapshotRequest, CreateSnapshotResponse>::listen(
+        env, &AsyncService::RequestCreateSnapshot, &KVDBServiceImpl::CreateSnapshot);
+    UnaryCall<ReleaseSnapshotRequest, ReleaseSnapshotResponse>::listen(
+        env, &AsyncService::RequestReleaseSnapshot, &KVDBServiceImpl::ReleaseSnapshot);
+    UnaryCall<GetAtSnapshotRequest, GetAtSnapshotResponse>::listen(
+        env, &AsyncService::RequestGetAtSnapshot, &KVDBServiceImpl::GetAtSnapshot);
+    UnaryCall<FlushRequest, FlushResponse>::listen(env, &AsyncService::RequestFlush, &KVDBServiceImpl::Flush);
+    UnaryCall<CompactRequest, CompactResponse>::listen(env, &AsyncService::RequestCompact, &KVDBServiceImpl::Compact);
+    UnaryCall<GetStatsRequest, GetStatsResponse>::listen(env, &AsyncService::RequestGetStats, &KVDBServiceImpl::GetStats);
+    UnaryCall<SetCompactionStrategyRequest, SetCompactionStrategyResponse>::listen(
+        env, &AsyncService::RequestSetCompactionStrategy, &KVDBServiceImpl::SetCompactionStrategy);
+
+    ScanCall<ScanRequest, ScanResponse>::listen(env, &AsyncService::RequestScan);
+    ScanCall<PrefixScanRequest, PrefixScanResponse>::listen(env, &AsyncService::RequestPrefixScan);
+    SubscribeCall::listen(env);
+}
+
+} // namespace
+
 // GRPCServer 实现
-GRPCServer::GRPCServer(KVDB& db, const std::string& server_address)
-    : db_(db), server_address_(server_address) {
-    service_ = std::make_unique<KVDBServiceImpl>(db_);
+GRPCServer::GRPCServer(KVDB& db, const std::string& server_address, const GRPCServerOptions& options)
+    : db_(db), server_address_(server_address), options_(options) {
+    service_ = std::make_unique<KVDBServiceImpl>(db_, options_.scan_batch_bytes, options_.notifier);
 }
 
 GRPCServer::~GRPCServer() {
@@ -411,18 +731,63 @@ GRPCServer::~GRPCServer() {
 
 void GRPCServer::start() {
     grpc::ServerBuilder builder;
-    builder.AddListeningPort(server_address_, grpc::InsecureServerCredentials());
-    builder.RegisterService(service_.get());
+    builder.AddListeningPort(server_address_, grpc::InsecureServerCredentials(), &selected_port_);
+
+    if (options_.async) {
+        async_service_ = std::make_unique<kvdb::KVDBService::AsyncService>();
+        builder.RegisterService(async_service_.get());
+        size_t queues = options_.completion_queues;
+        if (queues == 0) {
+            queues = std::max(1u, std::thread::hardware_concurrency());
+        }
+        for (size_t i = 0; i < queues; i++) {
+            completion_queues_.push_back(builder.AddCompletionQueue());
+        }
+    } else {
+        builder.RegisterService(service_.get());
+    }
     
     server_ = builder.BuildAndStart();
+    if (!server_) {
+        completion_queues_.clear();
+        throw std::runtime_error("Failed to start gRPC server on " + server_address_);
+    }
+    shutting_down_ = false;
     running_ = true;
+
+    for (auto& cq : completion_queues_) {
+        listen_all(CallEnv{this, async_service_.get(), service_.get(), cq.get()});
+        cq_threads_.emplace_back(&GRPCServer::poll_completion_queue, this, cq.get());
+    }
     
-    std::cout << "[gRPC] Server listening on " << server_address_ << std::endl;
+    std::cout << "[gRPC] Server listening on " << server_address_
+              << (options_.async ? " (async, " + std::to_string(completion_queues_.size()) + " completion queues)"
+                                 : " (sync)")
+              << std::endl;
 }
 
 void GRPCServer::stop() {
     if (server_ && running_) {
-        server_->Shutdown();
+        shutting_down_ = true;
+        // 订阅流不会自行结束，立即取消所有进行中的调用
+        server_->Shutdown(std::chrono::system_clock::now());
+
+        if (options_.async) {
+            // 所有调用对象释放后不会再有操作投递，此时才能关闭完成队列
+            {
+                std::unique_lock<std::mutex> lock(calls_mutex_);
+                calls_cv_.wait(lock, [this] { return live_calls_ == 0; });
+            }
+            for (auto& cq : completion_queues_) {
+                cq->Shutdown();
+            }
+            for (auto& thread : cq_threads_) {
+                thread.join();
+            }
+            cq_threads_.clear();
+            completion_queues_.clear();
+        }
+
         running_ = false;
         std::cout << "[gRPC] Server stopped" << std::endl;
     }
@@ -432,4 +797,25 @@ void GRPCServer::wait_for_shutdown() {
     if (server_) {
         server_->Wait();
     }
-}
\ No newline at end of file
+}
+
+void GRPCServer::call_started() {
+    std::lock_guard<std::mutex> lock(calls_mutex_);
+    live_calls_++;
+}
+
+void GRPCServer::call_finished() {
+    std::lock_guard<std::mutex> lock(calls_mutex_);
+    if (--live_calls_ == 0) {
+        calls_cv_.notify_all();
+    }
+}
+
+void GRPCServer::poll_completion_queue(grpc::ServerCompletionQueue* cq) {
+    void* tag = nullptr;
+    bool ok = false;
+    while (cq->Next(&tag, &ok)) {
+        CallTag* call_tag = static_cast<CallTag*>(tag);
+        call_tag->call->on_event(call_tag->event, ok);
+    }
+}
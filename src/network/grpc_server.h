@@ -1,5 +1,6 @@
 #pragma once
 #include "db/kv_db.h"
+#include "network/change_notifier.h"
 #include "kvdb.grpc.pb.h"
 #include <grpcpp/grpcpp.h>
 #include <memory>
@@ -7,11 +8,40 @@
 #include <atomic>
 #include <mutex>
 #include <condition_variable>
-#include <unordered_set>
+
+// 扫描游标：持有快照和迭代器，每次按字节预算把后续 KV 装进一条响应。
+// 同步和异步服务共用，异步服务在两次写之间不占用线程
+class ScanCursor {
+public:
+    static constexpr size_t DEFAULT_BATCH_BYTES = 64 * 1024;
+    static constexpr size_t MAX_BATCH_BYTES = 1024 * 1024;  // 远低于 gRPC 默认 4MB 消息上限
+
+    ScanCursor(KVDB& db, const kvdb::ScanRequest& request, size_t default_batch_bytes);
+    ScanCursor(KVDB& db, const kvdb::PrefixScanRequest& request, size_t default_batch_bytes);
+    ~ScanCursor();
+
+    ScanCursor(const ScanCursor&) = delete;
+    ScanCursor& operator=(const ScanCursor&) = delete;
+
+    // 追加下一批 KV，至少一条（单条超过预算时独占一批）；返回追加的条数，0 表示扫描结束
+    size_t next_batch(google::protobuf::RepeatedPtrField<kvdb::KeyValue>* pairs);
+
+private:
+    ScanCursor(KVDB& db, int limit, uint32_t batch_bytes, size_t default_batch_bytes);
+
+    KVDB& db_;
+    Snapshot snapshot_;
+    std::unique_ptr<Iterator> iter_;
+    std::string prefix_;
+    int remaining_;
+    size_t batch_bytes_;
+};
 
 class KVDBServiceImpl final : public kvdb::KVDBService::Service {
 public:
-    explicit KVDBServiceImpl(KVDB& db);
+    // notifier 为空时自建一个；与 WebSocket 服务共用时传入同一个
+    explicit KVDBServiceImpl(KVDB& db, size_t scan_batch_bytes = ScanCursor::DEFAULT_BATCH_BYTES,
+                             std::shared_ptr<ChangeNotifier> notifier = nullptr);
     ~KVDBServiceImpl();
 
     // 基本操作
@@ -80,42 +110,74 @@ public:
                            const kvdb::SubscribeRequest* request,
                            grpc::ServerWriter<kvdb::SubscribeResponse>* writer) override;
 
+    // 订阅流（同步和异步）都登记在通知器上，写操作只发布事件，匹配和投递在通知线程完成
+    ChangeNotifier& notifier() { return *notifier_; }
+
+    KVDB& db() { return db_; }
+    size_t scan_batch_bytes() const { return scan_batch_bytes_; }
+
+    // 通知器事件转成订阅响应；dropped > 0 时生成 LAGGED 响应
+    static void fill_event(const ChangeEvent& event, kvdb::SubscribeResponse* response);
+    static void fill_lagged(uint64_t dropped, kvdb::SubscribeResponse* response);
+
 private:
     KVDB& db_;
-    
-    // 订阅管理
-    struct Subscription {
-        std::string pattern;
-        bool include_deletes;
-        grpc::ServerWriter<kvdb::SubscribeResponse>* writer;
-        std::atomic<bool> active{true};
-    };
-    
-    std::mutex subscriptions_mutex_;
-    std::vector<std::shared_ptr<Subscription>> subscriptions_;
-    
-    // 通知订阅者
-    void notify_subscribers(const std::string& key, const std::string& value, const std::string& operation);
-    bool matches_pattern(const std::string& key, const std::string& pattern);
-    
+    size_t scan_batch_bytes_;
+    std::shared_ptr<ChangeNotifier> notifier_;
+
     // 辅助方法
     CompactionStrategyType convert_strategy_type(kvdb::CompactionStrategyType proto_type);
     kvdb::CompactionStrategyType convert_strategy_type(CompactionStrategyType internal_type);
 };
 
+struct GRPCServerOptions {
+    // true：异步完成队列服务，空闲的流式调用不占线程；false：旧的同步线程池服务
+    bool async = true;
+    // 完成队列数，每个队列一个轮询线程；0 表示每个 CPU 核一个
+    size_t completion_queues = 0;
+    // 扫描响应的默认字节预算（请求未指定 batch_bytes 时）
+    size_t scan_batch_bytes = ScanCursor::DEFAULT_BATCH_BYTES;
+    // 变更通知器，为空时服务自建；NetworkServer 传入与 WebSocket 共用的实例
+    std::shared_ptr<ChangeNotifier> notifier;
+};
+
 class GRPCServer {
 public:
-    explicit GRPCServer(KVDB& db, const std::string& server_address = "0.0.0.0:50051");
+    explicit GRPCServer(KVDB& db, const std::string& server_address = "0.0.0.0:50051",
+                        const GRPCServerOptions& options = GRPCServerOptions());
     ~GRPCServer();
 
     void start();
+    // 仍在进行的调用（包括永不自行结束的订阅流）会被取消
     void stop();
     void wait_for_shutdown();
 
+    // 实际监听端口（地址中端口为 0 时由系统分配）
+    int port() const { return selected_port_; }
+
+    // 异步调用对象的存活计数：stop 时等所有调用对象释放后才关闭完成队列，
+    // 保证关闭之后不会再有操作投递到队列上
+    void call_started();
+    void call_finished();
+    bool shutting_down() const { return shutting_down_; }
+
 private:
+    void poll_completion_queue(grpc::ServerCompletionQueue* cq);
+
     KVDB& db_;
     std::string server_address_;
+    GRPCServerOptions options_;
+    int selected_port_ = 0;
     std::unique_ptr<grpc::Server> server_;
     std::unique_ptr<KVDBServiceImpl> service_;
     std::atomic<bool> running_{false};
-};
\ No newline at end of file
+
+    // 异步模式
+    std::unique_ptr<kvdb::KVDBService::AsyncService> async_service_;
+    std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> completion_queues_;
+    std::vector<std::thread> cq_threads_;
+    std::atomic<bool> shutting_down_{false};
+    std::mutex calls_mutex_;
+    std::condition_variable calls_cv_;
+    size_t live_calls_ = 0;
+};
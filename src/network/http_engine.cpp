@@ -0,0 +1,874 @@
+#include "http_engine.h"
+#include <iostream>
+#include <sstream>
+#include <cstring>
+#include <cerrno>
+#include <chrono>
+#include <algorithm>
+#include <cctype>
+#include <system_error>
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace kvdb {
+namespace network {
+
+namespace {
+
+std::string to_lower(std::string s) {
+    std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return std::tolower(c); });
+    return s;
+}
+
+std::string trim(const std::string& s) {
+    size_t begin = s.find_first_not_of(" \t");
+    if (begin == std::string::npos) {
+        return "";
+    }
+    size_t end = s.find_last_not_of(" \t");
+    return s.substr(begin, end - begin + 1);
+}
+
+// 逗号分隔的头部值中是否包含某个 token（不区分大小写）
+bool has_token(const std::string& value, const std::string& token) {
+    std::istringstream iss(to_lower(value));
+    std::string item;
+    while (std::getline(iss, item, ',')) {
+        if (trim(item) == token) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool parse_size(const std::string& s, int base, size_t& out) {
+    if (s.empty() || s.size() > 16) {
+        return false;
+    }
+    size_t value = 0;
+    for (char c : s) {
+        int digit;
+        if (c >= '0' && c <= '9') {
+            digit = c - '0';
+        } else if (base == 16 && c >= 'a' && c <= 'f') {
+            digit = c - 'a' + 10;
+        } else if (base == 16 && c >= 'A' && c <= 'F') {
+            digit = c - 'A' + 10;
+        } else {
+            return false;
+        }
+        value = value * base + digit;
+    }
+    out = value;
+    return true;
+}
+
+constexpr int kEpollTimeoutMs = 1000;  // 顺带检查空闲超时的周期
+constexpr size_t kReadBufferSize = 64 * 1024;
+constexpr size_t kMaxChunkSizeLine = 1024;
+
+} // namespace
+
+// HttpRequest 实现
+std::string HttpRequest::header(const std::string& name) const {
+    auto it = headers.find(to_lower(name));
+    return it == headers.end() ? "" : it->second;
+}
+
+std::string HttpRequest::query_param(const std::string& name, const std::string& default_value) const {
+    size_t start = 0;
+    while (start <= query.size()) {
+        size_t end = query.find('&', start);
+        if (end == std::string::npos) {
+            end = query.size();
+        }
+        std::string pair = query.substr(start, end - start);
+        size_t eq = pair.find('=');
+        if (url_decode(pair.substr(0, eq)) == name) {
+            return eq == std::string::npos ? "" : url_decode(pair.substr(eq + 1));
+        }
+        start = end + 1;
+    }
+    return default_value;
+}
+
+// HttpRequestParser 实现
+HttpRequestParser::HttpRequestParser(size_t max_header_bytes, size_t max_body_bytes)
+    : max_header_bytes_(max_header_bytes), max_body_bytes_(max_body_bytes) {
+}
+
+bool HttpRequestParser::fail(int status) {
+    error_status_ = status;
+    return false;
+}
+
+void HttpRequestParser::finish_request(std::deque<HttpRequest>& out) {
+    out.push_back(std::move(current_));
+    current_ = HttpRequest();
+    state_ = State::HEAD;
+}
+
+bool HttpRequestParser::feed(const char* data, size_t len, std::deque<HttpRequest>& out) {
+    if (error_status_ != 0) {
+        return false;
+    }
+    buffer_.append(data, len);
+
+    bool need_more = false;
+    while (!need_more && error_status_ == 0) {
+        size_t avail = buffer_.size() - pos_;
+        switch (state_) {
+            case State::HEAD: {
+                // 请求之间允许出现多余的空行
+                while (buffer_.compare(pos_, 2, "\r\n") == 0) {
+                    pos_ += 2;
+                }
+                size_t from = std::max(scan_pos_, pos_);
+                size_t head_end = buffer_.find("\r\n\r\n", from);
+                if (head_end == std::string::npos) {
+                    if (buffer_.size() - pos_ > max_header_bytes_) {
+                        return fail(431);
+                    }
+                    scan_pos_ = buffer_.size() >= 3 ? std::max(pos_, buffer_.size() - 3) : pos_;
+                    need_more = true;
+                    break;
+                }
+                if (head_end - pos_ > max_header_bytes_) {
+                    return fail(431);
+                }
+                if (!parse_head(head_end)) {
+                    return false;
+                }
+                pos_ = head_end + 4;
+                scan_pos_ = pos_;
+
+                std::string transfer_encoding = current_.header("transfer-encoding");
+                if (!transfer_encoding.empty()) {
+                    if (to_lower(trim(transfer_encoding)) != "chunked") {
+                        return fail(501);
+                    }
+                    state_ = State::CHUNK_SIZE;
+                    break;
+                }
+                std::string content_length = current_.header("content-length");
+                size_t length = 0;
+                if (!content_length.empty() && !parse_size(trim(content_length), 10, length)) {
+                    return fail(400);
+                }
+                if (length > max_body_bytes_) {
+                    return fail(413);
+                }
+                if (length == 0) {
+                    finish_request(out);
+                } else {
+                    current_.body.reserve(length);
+                    remaining_ = length;
+                    state_ = State::BODY;
+                }
+                break;
+            }
+            case State::BODY:
+            case State::CHUNK_DATA: {
+                size_t take = std::min(avail, remaining_);
+                current_.body.append(buffer_, pos_, take);
+                pos_ += take;
+                remaining_ -= take;
+                if (remaining_ > 0) {
+                    need_more = true;
+                } else if (state_ == State::BODY) {
+                    finish_request(out);
+                } else {
+                    state_ = State::CHUNK_DATA_END;
+                }
+                break;
+            }
+            case State::CHUNK_SIZE: {
+                size_t eol = buffer_.find("\r\n", std::max(scan_pos_, pos_));
+                if (eol == std::string::npos) {
+                    if (avail > kMaxChunkSizeLine) {
+                        return fail(400);
+                    }
+                    scan_pos_ = buffer_.size() >= 1 ? std::max(pos_, buffer_.size() - 1) : pos_;
+                    need_more = true;
+                    break;
+                }
+                std::string line = buffer_.substr(pos_, eol - pos_);
+                line = trim(line.substr(0, line.find(';')));  // 忽略分块扩展
+                size_t size = 0;
+                if (!parse_size(line, 16, size)) {
+                    return fail(400);
+                }
+                pos_ = eol + 2;
+                scan_pos_ = pos_;
+                if (size == 0) {
+                    state_ = State::TRAILER;
+                } else if (current_.body.size() + size > max_body_bytes_) {
+                    return fail(413);
+                } else {
+                    remaining_ = size;
+                    state_ = State::CHUNK_DATA;
+                }
+                break;
+            }
+            case State::CHUNK_DATA_END:
+                if (avail < 2) {
+                    need_more = true;
+                } else if (buffer_.compare(pos_, 2, "\r\n") != 0) {
+                    return fail(400);
+                } else {
+                    pos_ += 2;
+                    scan_pos_ = pos_;
+                    state_ = State::CHUNK_SIZE;
+                }
+                break;
+            case State::TRAILER: {
+                // 尾部头字段不使用，读到空行为止
+                size_t eol = buffer_.find("\r\n", std::max(scan_pos_, pos_));
+                if (eol == std::string::npos) {
+                    if (avail > max_header_bytes_) {
+                        return fail(431);
+                    }
+                    scan_pos_ = buffer_.size() >= 1 ? std::max(pos_, buffer_.size() - 1) : pos_;
+                    need_more = true;
+                    break;
+                }
+                bool last = eol == pos_;
+                pos_ = eol + 2;
+                scan_pos_ = pos_;
+                if (last) {
+                    finish_request(out);
+                }
+                break;
+            }
+        }
+    }
+
+    // 丢弃已消费的数据，未完成的部分留待下次
+    if (pos_ > 0) {
+        buffer_.erase(0, pos_);
+        scan_pos_ = scan_pos_ > pos_ ? scan_pos_ - pos_ : 0;
+        pos_ = 0;
+    }
+    return error_status_ == 0;
+}
+
+bool HttpRequestParser::parse_head(size_t head_end) {
+    size_t line_end = buffer_.find("\r\n", pos_);
+    std::string request_line = buffer_.substr(pos_, line_end - pos_);
+
+    // 请求行：METHOD SP target SP HTTP/1.x
+    size_t sp1 = request_line.find(' ');
+    size_t sp2 = sp1 == std::string::npos ? std::string::npos : request_line.find(' ', sp1 + 1);
+    if (sp1 == std::string::npos || sp2 == std::string::npos || sp1 == 0 || sp2 == sp1 + 1) {
+        return fail(400);
+    }
+    current_.method = request_line.substr(0, sp1);
+    current_.target = request_line.substr(sp1 + 1, sp2 - sp1 - 1);
+    current_.version = request_line.substr(sp2 + 1);
+    if (current_.version != "HTTP/1.1" && current_.version != "HTTP/1.0") {
+        return fail(505);
+    }
+    size_t question = current_.target.find('?');
+    current_.path = current_.target.substr(0, question);
+    current_.query = question == std::string::npos ? "" : current_.target.substr(question + 1);
+
+    size_t line_start = line_end + 2;
+    while (line_start < head_end + 2) {
+        line_end = buffer_.find("\r\n", line_start);
+        std::string line = buffer_.substr(line_start, line_end - line_start);
+        line_start = line_end + 2;
+
+        size_t colon = line.find(':');
+        if (colon == std::string::npos || colon == 0) {
+            return fail(400);
+        }
+        std::string name = to_lower(line.substr(0, colon));
+        std::string value = trim(line.substr(colon + 1));
+        auto it = current_.headers.find(name);
+        if (it == current_.headers.end()) {
+            current_.headers.emplace(std::move(name), std::move(value));
+        } else if (name == "content-length") {
+            if (it->second != value) {
+                return fail(400);
+            }
+        } else {
+            it->second += ", " + value;
+        }
+    }
+
+    std::string connection = current_.header("connection");
+    if (has_token(connection, "close")) {
+        current_.keep_alive = false;
+    } else if (has_token(connection, "keep-alive")) {
+        current_.keep_alive = true;
+    } else {
+        current_.keep_alive = current_.version == "HTTP/1.1";
+    }
+    return true;
+}
+
+// HttpEngine::Connection：fd、解析器和排队请求只由事件循环线程访问；
+// 发送缓冲和处理状态由 mutex 保护，事件循环和工作线程共用
+struct HttpEngine::Connection {
+    enum class Task { IDLE, RUNNING, STREAM_PAUSED };
+
+    Connection(int fd, const HttpEngineOptions& options)
+        : fd(fd), parser(options.max_header_bytes, options.max_body_bytes),
+          last_active(std::chrono::steady_clock::now()) {
+    }
+
+    // 事件循环线程
+    int fd;
+    HttpRequestParser parser;
+    std::deque<HttpRequest> pending;
+    int parse_error = 0;
+    bool read_closed = false;
+    bool closed = false;
+    uint32_t interest = 0;
+    std::chrono::steady_clock::time_point last_active;
+
+    // 共享
+    std::mutex mutex;
+    Task task = Task::IDLE;
+    HttpRequest request;
+    HttpResponse response;  // 正在分块发送的响应
+    bool chunked = false;
+    bool keep_alive = true;
+    std::string out;
+    size_t out_offset = 0;
+    bool close_after_write = false;
+
+    size_t out_pending() const { return out.size() - out_offset; }
+};
+
+// HttpEngine 实现
+HttpEngine::HttpEngine(HttpHandler handler, const HttpEngineOptions& options)
+    : handler_(std::move(handler)), options_(options) {
+    options_.worker_threads = std::max<size_t>(options_.worker_threads, 1);
+    options_.max_pipelined_requests = std::max<size_t>(options_.max_pipelined_requests, 1);
+}
+
+HttpEngine::~HttpEngine() {
+    stop();
+}
+
+const char* HttpEngine::status_text(int status) {
+    switch (status) {
+        case 200: return "OK";
+        case 201: return "Created";
+        case 204: return "No Content";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 408: return "Request Timeout";
+        case 413: return "Payload Too Large";
+        case 431: return "Request Header Fields Too Large";
+        case 500: return "Internal Server Error";
+        case 501: return "Not Implemented";
+        case 503: return "Service Unavailable";
+        case 505: return "HTTP Version Not Supported";
+        default: return "Unknown";
+    }
+}
+
+void HttpEngine::start(const std::string& host, uint16_t port) {
+    if (running_) return;
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (host.empty() || host == "0.0.0.0") {
+        addr.sin_addr.s_addr = INADDR_ANY;
+    } else if (host == "localhost") {
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    } else if (inet_pton(AF_INET, host.c_str(), &addr.sin_addr) != 1) {
+        throw std::system_error(EINVAL, std::system_category(), "invalid listen address " + host);
+    }
+
+    listen_fd_ = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listen_fd_ < 0) {
+        throw std::system_error(errno, std::system_category(), "socket creation failed");
+    }
+    int opt = 1;
+    setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+
+    auto fail = [this](const char* what) {
+        int err = errno;
+        close(listen_fd_);
+        listen_fd_ = -1;
+        if (epoll_fd_ >= 0) close(epoll_fd_);
+        if (wakeup_fd_ >= 0) close(wakeup_fd_);
+        epoll_fd_ = wakeup_fd_ = -1;
+        throw std::system_error(err, std::system_category(), what);
+    };
+
+    if (bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+        fail("bind failed");
+    }
+    if (listen(listen_fd_, options_.backlog) < 0) {
+        fail("listen failed");
+    }
+    socklen_t len = sizeof(addr);
+    getsockname(listen_fd_, reinterpret_cast<sockaddr*>(&addr), &len);
+    port_ = ntohs(addr.sin_port);
+
+    epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    wakeup_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epoll_fd_ < 0 || wakeup_fd_ < 0) {
+        fail("epoll setup failed");
+    }
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.fd = listen_fd_;
+    epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, listen_fd_, &ev);
+    ev.data.fd = wakeup_fd_;
+    epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wakeup_fd_, &ev);
+
+    running_ = true;
+    workers_ = std::make_unique<WorkStealingPool>(options_.worker_threads);
+    loop_thread_ = std::thread(&HttpEngine::event_loop, this);
+}
+
+void HttpEngine::stop() {
+    if (!running_) return;
+
+    running_ = false;
+    uint64_t one = 1;
+    (void)write(wakeup_fd_, &one, sizeof(one));
+    if (loop_thread_.joinable()) {
+        loop_thread_.join();
+    }
+
+    // running_ 已清除，池析构时剩余任务直接跳过
+    workers_.reset();
+    {
+        std::lock_guard<std::mutex> lock(ready_mutex_);
+        ready_.clear();
+    }
+
+    close(listen_fd_);
+    close(epoll_fd_);
+    close(wakeup_fd_);
+    listen_fd_ = epoll_fd_ = wakeup_fd_ = -1;
+}
+
+void HttpEngine::event_loop() {
+    std::vector<epoll_event> events(256);
+    while (running_) {
+        int n = epoll_wait(epoll_fd_, events.data(), static_cast<int>(events.size()), kEpollTimeoutMs);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            std::cerr << "epoll_wait failed: " << strerror(errno) << std::endl;
+            break;
+        }
+        for (int i = 0; i < n && running_; i++) {
+            int fd = events[i].data.fd;
+            if (fd == listen_fd_) {
+                accept_connections();
+                continue;
+            }
+            if (fd == wakeup_fd_) {
+                uint64_t value;
+                while (read(wakeup_fd_, &value, sizeof(value)) > 0) {
+                }
+                drain_ready_queue();
+                continue;
+            }
+            auto it = connections_.find(fd);
+            if (it == connections_.end()) {
+                continue;
+            }
+            ConnectionPtr conn = it->second;
+            uint32_t mask = events[i].events;
+            if (mask & (EPOLLHUP | EPOLLERR)) {
+                // 连接已彻底断开，响应也无法送达
+                close_connection(conn);
+                continue;
+            }
+            if (mask & EPOLLIN) {
+                on_readable(conn);
+            }
+            if (!conn->closed && (mask & EPOLLOUT)) {
+                on_writable(conn);
+            }
+            if (!conn->closed) {
+                progress(conn);
+            }
+        }
+        close_idle_connections();
+    }
+
+    // 退出时关闭所有连接；仍在工作线程上的请求完成后其结果被丢弃
+    std::vector<ConnectionPtr> remaining;
+    for (auto& [fd, conn] : connections_) {
+        remaining.push_back(conn);
+    }
+    for (auto& conn : remaining) {
+        close_connection(conn);
+    }
+}
+
+void HttpEngine::accept_connections() {
+    while (true) {
+        int fd = accept4(listen_fd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                std::cerr << "accept failed: " << strerror(errno) << std::endl;
+            }
+            return;
+        }
+        // 小响应为主，关闭 Nagle 避免 keep-alive 下的延迟确认等待
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+        auto conn = std::make_shared<Connection>(fd, options_);
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.fd = fd;
+        if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &ev) < 0) {
+            close(fd);
+            continue;
+        }
+        conn->interest = EPOLLIN;
+        connections_[fd] = conn;
+        connection_count_++;
+    }
+}
+
+void HttpEngine::on_readable(const ConnectionPtr& conn) {
+    if (conn->read_closed) {
+        return;
+    }
+    char buffer[kReadBufferSize];
+    while (conn->pending.size() < options_.max_pipelined_requests) {
+        ssize_t n = recv(conn->fd, buffer, sizeof(buffer), 0);
+        if (n > 0) {
+            conn->last_active = std::chrono::steady_clock::now();
+            if (!conn->parser.feed(buffer, static_cast<size_t>(n), conn->pending)) {
+                // 之前已解析的请求照常应答，之后回错误并关闭
+                conn->parse_error = conn->parser.error_status();
+                conn->read_closed = true;
+                return;
+            }
+            continue;
+        }
+        if (n == 0) {
+            conn->read_closed = true;  // 对端半关闭：已收到的请求仍然应答
+            return;
+        }
+        if (errno == EINTR) continue;
+        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            close_connection(conn);
+        }
+        return;
+    }
+}
+
+void HttpEngine::on_writable(const ConnectionPtr& conn) {
+    std::unique_lock<std::mutex> lock(conn->mutex);
+    while (conn->out_pending() > 0) {
+        ssize_t n = send(conn->fd, conn->out.data() + conn->out_offset, conn->out_pending(), MSG_NOSIGNAL);
+        if (n > 0) {
+            conn->out_offset += static_cast<size_t>(n);
+            conn->last_active = std::chrono::steady_clock::now();
+            continue;
+        }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+        lock.unlock();
+        close_connection(conn);
+        return;
+    }
+    if (conn->out_offset == conn->out.size()) {
+        conn->out.clear();
+        conn->out_offset = 0;
+    } else if (conn->out_offset > conn->out.size() / 2) {
+        conn->out.erase(0, conn->out_offset);
+        conn->out_offset = 0;
+    }
+}
+
+// 推进连接状态：继续暂停的分块响应、派发下一个排队请求、或在需要时关闭
+void HttpEngine::progress(const ConnectionPtr& conn) {
+    // 先尽量写出，再按写后的积压量决定是否继续；否则积压一次写空后没有 EPOLLOUT 再来推进
+    on_writable(conn);
+    if (conn->closed) return;
+
+    bool should_close = false;
+    {
+        std::lock_guard<std::mutex> lock(conn->mutex);
+        size_t out_pending = conn->out_pending();
+        switch (conn->task) {
+            case Connection::Task::RUNNING:
+                break;
+            case Connection::Task::STREAM_PAUSED:
+                if (out_pending < options_.output_high_watermark / 2) {
+                    conn->task = Connection::Task::RUNNING;
+                    submit(conn);
+                }
+                break;
+            case Connection::Task::IDLE:
+                if (conn->close_after_write) {
+                    should_close = out_pending == 0;
+                } else if (!conn->pending.empty()) {
+                    if (out_pending < options_.output_high_watermark) {
+                        conn->request = std::move(conn->pending.front());
+                        conn->pending.pop_front();
+                        conn->task = Connection::Task::RUNNING;
+                        submit(conn);
+                    }
+                } else if (conn->parse_error != 0) {
+                    std::string body = std::string("{\"error\":\"") + status_text(conn->parse_error) + "\"}";
+                    conn->out += "HTTP/1.1 " + std::to_string(conn->parse_error) + " " +
+                                 status_text(conn->parse_error) + "\r\n"
+                                 "Content-Type: application/json\r\n"
+                                 "Content-Length: " + std::to_string(body.size()) + "\r\n"
+                                 "Connection: close\r\n\r\n" + body;
+                    conn->close_after_write = true;
+                } else if (conn->read_closed) {
+                    should_close = out_pending == 0;
+                }
+                break;
+        }
+    }
+    if (should_close) {
+        close_connection(conn);
+        return;
+    }
+    on_writable(conn);
+    if (!conn->closed) {
+        update_interest(conn);
+    }
+}
+
+void HttpEngine::update_interest(const ConnectionPtr& conn) {
+    uint32_t interest = 0;
+    if (!conn->read_closed && conn->pending.size() < options_.max_pipelined_requests) {
+        interest |= EPOLLIN;
+    }
+    {
+        std::lock_guard<std::mutex> lock(conn->mutex);
+        if (conn->out_pending() > 0) {
+            interest |= EPOLLOUT;
+        }
+    }
+    if (interest != conn->interest) {
+        epoll_event ev{};
+        ev.events = interest;
+        ev.data.fd = conn->fd;
+        epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, conn->fd, &ev);
+        conn->interest = interest;
+    }
+}
+
+void HttpEngine::close_connection(const ConnectionPtr& conn) {
+    if (conn->closed) return;
+    conn->closed = true;
+    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, conn->fd, nullptr);
+    close(conn->fd);
+    connections_.erase(conn->fd);
+    connection_count_--;
+}
+
+void HttpEngine::close_idle_connections() {
+    if (options_.idle_timeout_ms <= 0) return;
+    auto deadline = std::chrono::steady_clock::now() - std::chrono::milliseconds(options_.idle_timeout_ms);
+    std::vector<ConnectionPtr> idle;
+    for (auto& [fd, conn] : connections_) {
+        if (conn->last_active >= deadline || !conn->pending.empty()) continue;
+        std::lock_guard<std::mutex> lock(conn->mutex);
+        if (conn->task == Connection::Task::IDLE && conn->out_pending() == 0) {
+            idle.push_back(conn);
+        }
+    }
+    for (auto& conn : idle) {
+        close_connection(conn);
+    }
+}
+
+void HttpEngine::drain_ready_queue() {
+    std::vector<ConnectionPtr> ready;
+    {
+        std::lock_guard<std::mutex> lock(ready_mutex_);
+        ready.swap(ready_);
+    }
+    for (auto& conn : ready) {
+        if (!conn->closed) {
+            progress(conn);
+        }
+    }
+}
+
+void HttpEngine::notify_ready(const ConnectionPtr& conn) {
+    {
+        std::lock_guard<std::mutex> lock(ready_mutex_);
+        ready_.push_back(conn);
+    }
+    uint64_t one = 1;
+    (void)write(wakeup_fd_, &one, sizeof(one));
+}
+
+// 调用方持有 conn->mutex
+void HttpEngine::submit(const ConnectionPtr& conn) {
+    workers_->submit([this, conn] {
+        if (!running_) {
+            return;
+        }
+        bool streaming;
+        {
+            std::lock_guard<std::mutex> lock(conn->mutex);
+            streaming = static_cast<bool>(conn->response.stream);
+        }
+        if (streaming) {
+            continue_stream(conn);
+        } else {
+            run_request(conn);
+        }
+        notify_ready(conn);
+    });
+}
+
+void HttpEngine::run_request(const ConnectionPtr& conn) {
+    HttpRequest request;
+    {
+        std::lock_guard<std::mutex> lock(conn->mutex);
+        request = std::move(conn->request);
+    }
+
+    HttpResponse response;
+    try {
+        handler_(request, response);
+    } catch (const std::exception& e) {
+        response = HttpResponse();
+        response.status = 500;
+        response.content_type = "application/json";
+        response.body = "{\"error\":\"Internal Server Error\"}";
+        std::cerr << "HTTP handler failed: " << e.what() << std::endl;
+    }
+
+    bool head_only = request.method == "HEAD";
+    bool keep_alive = request.keep_alive && !response.close;
+    // HTTP/1.0 不支持 chunked：直接写原始数据，以关闭连接表示结束
+    bool chunked = response.stream && request.version == "HTTP/1.1";
+    if (response.stream && !chunked) {
+        keep_alive = false;
+    }
+
+    std::string head = "HTTP/1.1 " + std::to_string(response.status) + " " + status_text(response.status) + "\r\n"
+                       "Content-Type: " + response.content_type + "\r\n";
+    for (const auto& [name, value] : response.headers) {
+        head += name + ": " + value + "\r\n";
+    }
+    if (chunked) {
+        head += "Transfer-Encoding: chunked\r\n";
+    } else if (!response.stream) {
+        head += "Content-Length: " + std::to_string(response.body.size()) + "\r\n";
+    }
+    head += keep_alive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n";
+
+    {
+        std::lock_guard<std::mutex> lock(conn->mutex);
+        conn->out += head;
+        conn->keep_alive = keep_alive;
+        if (!response.stream || head_only) {
+            if (!head_only) {
+                conn->out += response.body;
+            }
+            conn->close_after_write = !keep_alive;
+            conn->task = Connection::Task::IDLE;
+            return;
+        }
+        conn->chunked = chunked;
+        conn->response = std::move(response);
+    }
+    // 首批数据直接在本线程生成
+    continue_stream(conn);
+}
+
+void HttpEngine::continue_stream(const ConnectionPtr& conn) {
+    std::string chunk;
+    while (true) {
+        std::function<bool(std::string&)>* stream;
+        {
+            std::lock_guard<std::mutex> lock(conn->mutex);
+            if (conn->out_pending() >= options_.output_high_watermark) {
+                conn->task = Connection::Task::STREAM_PAUSED;
+                return;
+            }
+            stream = &conn->response.stream;
+        }
+
+        chunk.clear();
+        bool more;
+        bool failed = false;
+        try {
+            more = (*stream)(chunk);
+        } catch (const std::exception& e) {
+            std::cerr << "HTTP stream failed: " << e.what() << std::endl;
+            more = false;
+            failed = true;
+        }
+
+        std::lock_guard<std::mutex> lock(conn->mutex);
+        if (failed) {
+            // 状态行已经发出，只能不写结束块直接断开，让客户端知道响应不完整
+            conn->response = HttpResponse();
+            conn->close_after_write = true;
+            conn->task = Connection::Task::IDLE;
+            return;
+        }
+        if (!chunk.empty()) {
+            if (conn->chunked) {
+                char size_line[32];
+                std::snprintf(size_line, sizeof(size_line), "%zx\r\n", chunk.size());
+                conn->out += size_line;
+                conn->out += chunk;
+                conn->out += "\r\n";
+            } else {
+                conn->out += chunk;
+            }
+        }
+        if (!more) {
+            if (conn->chunked) {
+                conn->out += "0\r\n\r\n";
+            }
+            conn->response = HttpResponse();
+            conn->close_after_write = !conn->keep_alive;
+            conn->task = Connection::Task::IDLE;
+            return;
+        }
+    }
+}
+
+std::string url_decode(const std::string& str) {
+    std::string result;
+    result.reserve(str.size());
+
+    for (size_t i = 0; i < str.size(); ++i) {
+        if (str[i] == '%' && i + 2 < str.size()) {
+            size_t value;
+            if (parse_size(str.substr(i + 1, 2), 16, value)) {
+                result += static_cast<char>(value);
+                i += 2;
+            } else {
+                result += str[i];
+            }
+        } else if (str[i] == '+') {
+            result += ' ';
+        } else {
+            result += str[i];
+        }
+    }
+
+    return result;
+}
+
+} // namespace network
+} // namespace kvdb
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <unordered_map>
+#include <cstdint>
+#include "../concurrent/work_stealing_pool.h"
+
+namespace kvdb {
+namespace network {
+
+// 一个完整的 HTTP 请求（请求体已按 Content-Length 或 chunked 编码收齐）
+struct HttpRequest {
+    std::string method;
+    std::string target;   // 原始请求目标，如 /scan?start=a
+    std::string path;     // ? 之前的部分，未解码
+    std::string query;    // ? 之后的部分，未解码
+    std::string version;  // HTTP/1.1
+    std::map<std::string, std::string> headers;  // 名称统一小写
+    std::string body;
+    bool keep_alive = true;
+
+    std::string header(const std::string& name) const;
+    // 查询参数（已解码），不存在时返回 default_value
+    std::string query_param(const std::string& name, const std::string& default_value = "") const;
+};
+
+// 处理函数填写的响应。stream 非空时按 chunked 编码分块发送：
+// 每次调用向 chunk 追加下一块数据，返回 false 表示没有后续数据。
+// 客户端读得慢时引擎暂停调用 stream，等发送缓冲降下来再继续
+struct HttpResponse {
+    int status = 200;
+    std::string content_type = "text/plain";
+    std::vector<std::pair<std::string, std::string>> headers;
+    std::string body;
+    std::function<bool(std::string& chunk)> stream;
+    bool close = false;  // 响应发完后关闭连接
+};
+
+using HttpHandler = std::function<void(const HttpRequest&, HttpResponse&)>;
+
+// 增量请求解析器：数据可以按任意边界分多次喂入，一次喂入也可以包含多个流水线请求
+class HttpRequestParser {
+public:
+    HttpRequestParser(size_t max_header_bytes, size_t max_body_bytes);
+
+    // 解析出的完整请求依次追加到 out；格式错误或超限返回 false，error_status() 给出应答状态码
+    bool feed(const char* data, size_t len, std::deque<HttpRequest>& out);
+    int error_status() const { return error_status_; }
+
+private:
+    enum class State { HEAD, BODY, CHUNK_SIZE, CHUNK_DATA, CHUNK_DATA_END, TRAILER };
+
+    bool parse_head(size_t head_end);
+    bool fail(int status);
+    void finish_request(std::deque<HttpRequest>& out);
+
+    const size_t max_header_bytes_;
+    const size_t max_body_bytes_;
+    std::string buffer_;
+    size_t pos_ = 0;       // buffer_ 中已消费的位置
+    size_t scan_pos_ = 0;  // 查找行结束符时已扫描过的位置，避免重复扫描
+    State state_ = State::HEAD;
+    HttpRequest current_;
+    size_t remaining_ = 0;
+    int error_status_ = 0;
+};
+
+struct HttpEngineOptions {
+    size_t worker_threads = 4;                   // 执行处理函数的线程数
+    size_t max_header_bytes = 64 * 1024;
+    size_t max_body_bytes = 16 * 1024 * 1024;
+    size_t max_pipelined_requests = 32;          // 单连接排队的请求数，超出后暂停读
+    size_t output_high_watermark = 256 * 1024;   // 发送缓冲超过此值时暂停生成后续响应
+    int idle_timeout_ms = 30000;                 // 空闲连接超时
+    int backlog = 128;
+};
+
+// 轻量 HTTP/1.1 引擎：一个 epoll 线程负责 accept、非阻塞读写和请求解析，
+// 完整请求交给工作线程执行处理函数。支持 keep-alive 和流水线（同一连接的请求按序处理、按序应答），
+// 以及 chunked 分块响应。HTTPServer 和 MetricsServer 都建立在它之上
+class HttpEngine {
+public:
+    explicit HttpEngine(HttpHandler handler, const HttpEngineOptions& options = HttpEngineOptions());
+    ~HttpEngine();
+
+    HttpEngine(const HttpEngine&) = delete;
+    HttpEngine& operator=(const HttpEngine&) = delete;
+
+    // 绑定失败抛出 std::system_error；port 为 0 时由系统分配，用 port() 取实际端口
+    void start(const std::string& host, uint16_t port);
+    void stop();
+
+    bool is_running() const { return running_; }
+    uint16_t port() const { return port_; }
+    size_t connection_count() const { return connection_count_; }
+
+    static const char* status_text(int status);
+
+private:
+    struct Connection;
+    using ConnectionPtr = std::shared_ptr<Connection>;
+
+    void event_loop();
+    void accept_connections();
+    void on_readable(const ConnectionPtr& conn);
+    void on_writable(const ConnectionPtr& conn);
+    void progress(const ConnectionPtr& conn);
+    void update_interest(const ConnectionPtr& conn);
+    void close_connection(const ConnectionPtr& conn);
+    void close_idle_connections();
+    void drain_ready_queue();
+
+    // 工作线程
+    void submit(const ConnectionPtr& conn);
+    void run_request(const ConnectionPtr& conn);
+    void continue_stream(const ConnectionPtr& conn);
+    void notify_ready(const ConnectionPtr& conn);
+
+    HttpHandler handler_;
+    HttpEngineOptions options_;
+    std::atomic<bool> running_{false};
+    uint16_t port_ = 0;
+    int listen_fd_ = -1;
+    int epoll_fd_ = -1;
+    int wakeup_fd_ = -1;  // eventfd：工作线程产出响应后唤醒事件循环
+    std::thread loop_thread_;
+    std::unordered_map<int, ConnectionPtr> connections_;  // 仅事件循环线程访问
+    std::atomic<size_t> connection_count_{0};
+
+    std::mutex ready_mutex_;
+    std::vector<ConnectionPtr> ready_;
+
+    std::unique_ptr<WorkStealingPool> workers_;  // 执行处理函数与流式分块
+};
+
+std::string url_decode(const std::string& str);
+
+} // namespace network
+} // namespace kvdb
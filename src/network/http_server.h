@@ -1,44 +1,41 @@
 #pragma once
 
 #include "db/kv_db.h"
-#include <thread>
-#include <atomic>
-#include <sys/socket.h>
-#include <netinet/in.h>
-#include <arpa/inet.h>
-#include <unistd.h>
+#include "network/http_engine.h"
 #include <string>
-#include <map>
 
 namespace kvdb {
 namespace network {
 
+// REST 接口，建立在 HttpEngine 之上：
+//   GET/PUT/POST/DELETE /key/<key>
+//   GET /scan?start=&end=&limit=   或  GET /scan?prefix=&limit=
+// 扫描结果以 chunked 编码分块返回，每行一个 JSON 对象
 class HTTPServer {
 public:
-    HTTPServer(KVDB& db, uint16_t port = 8080);
+    HTTPServer(KVDB& db, uint16_t port = 8080, const HttpEngineOptions& options = HttpEngineOptions());
     ~HTTPServer();
     
     void start();
     void stop();
     
-    bool is_running() const { return running_; }
-    uint16_t port() const { return port_; }
+    bool is_running() const { return engine_.is_running(); }
+    // 启动后返回实际监听端口（构造时传 0 由系统分配）
+    uint16_t port() const { return engine_.is_running() ? engine_.port() : port_; }
+
+    static constexpr size_t SCAN_CHUNK_BYTES = 16 * 1024;
 
 private:
-    void run();
-    void handle_client(int client_fd);
-    void process_http_request(int client_fd, const std::string& request);
+    void handle_request(const HttpRequest& request, HttpResponse& response);
+    void handle_key(const HttpRequest& request, HttpResponse& response);
+    void handle_scan(const HttpRequest& request, HttpResponse& response);
     
-    std::string build_response(int status_code, const std::string& content_type, 
-                             const std::string& body);
-    std::string url_decode(const std::string& str);
+    static void json_response(HttpResponse& response, int status, const std::string& body);
     
     KVDB& db_;
     uint16_t port_;
-    std::atomic<bool> running_{false};
-    int server_fd_{-1};
-    std::thread server_thread_;
+    HttpEngine engine_;
 };
 
 } // namespace network
-} // namespace kvdb
\ No newline at end of file
+} // namespace kvdb
@@ -1,19 +1,19 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: proto/kvdb.proto
+// source: kvdb.proto
 
-#ifndef GOOGLE_PROTOBUF_INCLUDED_proto_2fkvdb_2eproto
-#define GOOGLE_PROTOBUF_INCLUDED_proto_2fkvdb_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_kvdb_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_kvdb_2eproto
 
 #include <limits>
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3012000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3012004 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,9 +23,8 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_bases.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
@@ -35,7 +34,7 @@
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-#define PROTOBUF_INTERNAL_EXPORT_proto_2fkvdb_2eproto
+#define PROTOBUF_INTERNAL_EXPORT_kvdb_2eproto
 PROTOBUF_NAMESPACE_OPEN
 namespace internal {
 class AnyMetadata;
@@ -43,114 +42,106 @@ class AnyMetadata;
 PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
-struct TableStruct_proto_2fkvdb_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[32]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+struct TableStruct_kvdb_2eproto {
+  static const uint32_t offsets[];
 };
-extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_proto_2fkvdb_2eproto;
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_kvdb_2eproto;
 namespace kvdb {
 class BatchGetRequest;
-class BatchGetRequestDefaultTypeInternal;
+struct BatchGetRequestDefaultTypeInternal;
 extern BatchGetRequestDefaultTypeInternal _BatchGetRequest_default_instance_;
 class BatchGetResponse;
-class BatchGetResponseDefaultTypeInternal;
+struct BatchGetResponseDefaultTypeInternal;
 extern BatchGetResponseDefaultTypeInternal _BatchGetResponse_default_instance_;
 class BatchPutRequest;
-class BatchPutRequestDefaultTypeInternal;
+struct BatchPutRequestDefaultTypeInternal;
 extern BatchPutRequestDefaultTypeInternal _BatchPutRequest_default_instance_;
 class BatchPutResponse;
-class BatchPutResponseDefaultTypeInternal;
+struct BatchPutResponseDefaultTypeInternal;
 extern BatchPutResponseDefaultTypeInternal _BatchPutResponse_default_instance_;
 class CompactRequest;
-class CompactRequestDefaultTypeInternal;
+struct CompactRequestDefaultTypeInternal;
 extern CompactRequestDefaultTypeInternal _CompactRequest_default_instance_;
 class CompactResponse;
-class CompactResponseDefaultTypeInternal;
+struct CompactResponseDefaultTypeInternal;
 extern CompactResponseDefaultTypeInternal _CompactResponse_default_instance_;
 class CompactionStats;
-class CompactionStatsDefaultTypeInternal;
+struct CompactionStatsDefaultTypeInternal;
 extern CompactionStatsDefaultTypeInternal _CompactionStats_default_instance_;
 class CreateSnapshotRequest;
-class CreateSnapshotRequestDefaultTypeInternal;
+struct CreateSnapshotRequestDefaultTypeInternal;
 extern CreateSnapshotRequestDefaultTypeInternal _CreateSnapshotRequest_default_instance_;
 class CreateSnapshotResponse;
-class CreateSnapshotResponseDefaultTypeInternal;
+struct CreateSnapshotResponseDefaultTypeInternal;
 extern CreateSnapshotResponseDefaultTypeInternal _CreateSnapshotResponse_default_instance_;
 class DeleteRequest;
-class DeleteRequestDefaultTypeInternal;
+struct DeleteRequestDefaultTypeInternal;
 extern DeleteRequestDefaultTypeInternal _DeleteRequest_default_instance_;
 class DeleteResponse;
-class DeleteResponseDefaultTypeInternal;
+struct DeleteResponseDefaultTypeInternal;
 extern DeleteResponseDefaultTypeInternal _DeleteResponse_default_instance_;
 class FlushRequest;
-class FlushRequestDefaultTypeInternal;
+struct FlushRequestDefaultTypeInternal;
 extern FlushRequestDefaultTypeInternal _FlushRequest_default_instance_;
 class FlushResponse;
-class FlushResponseDefaultTypeInternal;
+struct FlushResponseDefaultTypeInternal;
 extern FlushResponseDefaultTypeInternal _FlushResponse_default_instance_;
 class GetAtSnapshotRequest;
-class GetAtSnapshotRequestDefaultTypeInternal;
+struct GetAtSnapshotRequestDefaultTypeInternal;
 extern GetAtSnapshotRequestDefaultTypeInternal _GetAtSnapshotRequest_default_instance_;
 class GetAtSnapshotResponse;
-class GetAtSnapshotResponseDefaultTypeInternal;
+struct GetAtSnapshotResponseDefaultTypeInternal;
 extern GetAtSnapshotResponseDefaultTypeInternal _GetAtSnapshotResponse_default_instance_;
 class GetRequest;
-class GetRequestDefaultTypeInternal;
+struct GetRequestDefaultTypeInternal;
 extern GetRequestDefaultTypeInternal _GetRequest_default_instance_;
 class GetResponse;
-class GetResponseDefaultTypeInternal;
+struct GetResponseDefaultTypeInternal;
 extern GetResponseDefaultTypeInternal _GetResponse_default_instance_;
 class GetStatsRequest;
-class GetStatsRequestDefaultTypeInternal;
+struct GetStatsRequestDefaultTypeInternal;
 extern GetStatsRequestDefaultTypeInternal _GetStatsRequest_default_instance_;
 class GetStatsResponse;
-class GetStatsResponseDefaultTypeInternal;
+struct GetStatsResponseDefaultTypeInternal;
 extern GetStatsResponseDefaultTypeInternal _GetStatsResponse_default_instance_;
 class KeyValue;
-class KeyValueDefaultTypeInternal;
+struct KeyValueDefaultTypeInternal;
 extern KeyValueDefaultTypeInternal _KeyValue_default_instance_;
 class PrefixScanRequest;
-class PrefixScanRequestDefaultTypeInternal;
+struct PrefixScanRequestDefaultTypeInternal;
 extern PrefixScanRequestDefaultTypeInternal _PrefixScanRequest_default_instance_;
 class PrefixScanResponse;
-class PrefixScanResponseDefaultTypeInternal;
+struct PrefixScanResponseDefaultTypeInternal;
 extern PrefixScanResponseDefaultTypeInternal _PrefixScanResponse_default_instance_;
 class PutRequest;
-class PutRequestDefaultTypeInternal;
+struct PutRequestDefaultTypeInternal;
 extern PutRequestDefaultTypeInternal _PutRequest_default_instance_;
 class PutResponse;
-class PutResponseDefaultTypeInternal;
+struct PutResponseDefaultTypeInternal;
 extern PutResponseDefaultTypeInternal _PutResponse_default_instance_;
 class ReleaseSnapshotRequest;
-class ReleaseSnapshotRequestDefaultTypeInternal;
+struct ReleaseSnapshotRequestDefaultTypeInternal;
 extern ReleaseSnapshotRequestDefaultTypeInternal _ReleaseSnapshotRequest_default_instance_;
 class ReleaseSnapshotResponse;
-class ReleaseSnapshotResponseDefaultTypeInternal;
+struct ReleaseSnapshotResponseDefaultTypeInternal;
 extern ReleaseSnapshotResponseDefaultTypeInternal _ReleaseSnapshotResponse_default_instance_;
 class ScanRequest;
-class ScanRequestDefaultTypeInternal;
+struct ScanRequestDefaultTypeInternal;
 extern ScanRequestDefaultTypeInternal _ScanRequest_default_instance_;
 class ScanResponse;
-class ScanResponseDefaultTypeInternal;
+struct ScanResponseDefaultTypeInternal;
 extern ScanResponseDefaultTypeInternal _ScanResponse_default_instance_;
 class SetCompactionStrategyRequest;
-class SetCompactionStrategyRequestDefaultTypeInternal;
+struct SetCompactionStrategyRequestDefaultTypeInternal;
 extern SetCompactionStrategyRequestDefaultTypeInternal _SetCompactionStrategyRequest_default_instance_;
 class SetCompactionStrategyResponse;
-class SetCompactionStrategyResponseDefaultTypeInternal;
+struct SetCompactionStrategyResponseDefaultTypeInternal;
 extern SetCompactionStrategyResponseDefaultTypeInternal _SetCompactionStrategyResponse_default_instance_;
 class SubscribeRequest;
-class SubscribeRequestDefaultTypeInternal;
+struct SubscribeRequestDefaultTypeInternal;
 extern SubscribeRequestDefaultTypeInternal _SubscribeRequest_default_instance_;
 class SubscribeResponse;
-class SubscribeResponseDefaultTypeInternal;
+struct SubscribeResponseDefaultTypeInternal;
 extern SubscribeResponseDefaultTypeInternal _SubscribeResponse_default_instance_;
 }  // namespace kvdb
 PROTOBUF_NAMESPACE_OPEN
@@ -194,8 +185,8 @@ enum CompactionStrategyType : int {
   TIERED = 1,
   SIZE_TIERED = 2,
   TIME_WINDOW = 3,
-  CompactionStrategyType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  CompactionStrategyType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  CompactionStrategyType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  CompactionStrategyType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool CompactionStrategyType_IsValid(int value);
 constexpr CompactionStrategyType CompactionStrategyType_MIN = LEVELED;
@@ -212,17 +203,18 @@ inline const std::string& CompactionStrategyType_Name(T enum_t_value) {
     CompactionStrategyType_descriptor(), enum_t_value);
 }
 inline bool CompactionStrategyType_Parse(
-    const std::string& name, CompactionStrategyType* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, CompactionStrategyType* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<CompactionStrategyType>(
     CompactionStrategyType_descriptor(), name, value);
 }
 // ===================================================================
 
-class PutRequest PROTOBUF_FINAL :
+class PutRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.PutRequest) */ {
  public:
-  inline PutRequest() : PutRequest(nullptr) {};
-  virtual ~PutRequest();
+  inline PutRequest() : PutRequest(nullptr) {}
+  ~PutRequest() override;
+  explicit PROTOBUF_CONSTEXPR PutRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PutRequest(const PutRequest& from);
   PutRequest(PutRequest&& from) noexcept
@@ -235,8 +227,13 @@ class PutRequest PROTOBUF_FINAL :
     return *this;
   }
   inline PutRequest& operator=(PutRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -247,14 +244,14 @@ class PutRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const PutRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PutRequest* internal_default_instance() {
     return reinterpret_cast<const PutRequest*>(
                &_PutRequest_default_instance_);
@@ -267,7 +264,12 @@ class PutRequest PROTOBUF_FINAL :
   }
   inline void Swap(PutRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -275,56 +277,53 @@ class PutRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(PutRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PutRequest* New() const final {
-    return CreateMaybeMessage<PutRequest>(nullptr);
-  }
-
-  PutRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PutRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PutRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PutRequest& from);
-  void MergeFrom(const PutRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PutRequest& from) {
+    PutRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PutRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.PutRequest";
   }
   protected:
-  explicit PutRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit PutRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -337,50 +336,28 @@ class PutRequest PROTOBUF_FINAL :
   // string key = 1;
   void clear_key();
   const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key();
-  std::string* release_key();
+  PROTOBUF_NODISCARD std::string* release_key();
   void set_allocated_key(std::string* key);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_key();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_key(
-      std::string* key);
   private:
   const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
   std::string* _internal_mutable_key();
   public:
 
   // string value = 2;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_value();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_value(
-      std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
@@ -391,18 +368,22 @@ class PutRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PutResponse PROTOBUF_FINAL :
+class PutResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.PutResponse) */ {
  public:
-  inline PutResponse() : PutResponse(nullptr) {};
-  virtual ~PutResponse();
+  inline PutResponse() : PutResponse(nullptr) {}
+  ~PutResponse() override;
+  explicit PROTOBUF_CONSTEXPR PutResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PutResponse(const PutResponse& from);
   PutResponse(PutResponse&& from) noexcept
@@ -415,8 +396,13 @@ class PutResponse PROTOBUF_FINAL :
     return *this;
   }
   inline PutResponse& operator=(PutResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -427,14 +413,14 @@ class PutResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const PutResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PutResponse* internal_default_instance() {
     return reinterpret_cast<const PutResponse*>(
                &_PutResponse_default_instance_);
@@ -447,7 +433,12 @@ class PutResponse PROTOBUF_FINAL :
   }
   inline void Swap(PutResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -455,56 +446,53 @@ class PutResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(PutResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PutResponse* New() const final {
-    return CreateMaybeMessage<PutResponse>(nullptr);
-  }
-
-  PutResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PutResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PutResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PutResponse& from);
-  void MergeFrom(const PutResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PutResponse& from) {
+    PutResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PutResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.PutResponse";
   }
   protected:
-  explicit PutResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit PutResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -517,25 +505,14 @@ class PutResponse PROTOBUF_FINAL :
   // string error_message = 2;
   void clear_error_message();
   const std::string& error_message() const;
-  void set_error_message(const std::string& value);
-  void set_error_message(std::string&& value);
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_error_message();
-  std::string* release_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
   void set_allocated_error_message(std::string* error_message);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_error_message();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_error_message(
-      std::string* error_message);
   private:
   const std::string& _internal_error_message() const;
-  void _internal_set_error_message(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
   std::string* _internal_mutable_error_message();
   public:
 
@@ -555,18 +532,22 @@ class PutResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
-  bool success_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetRequest PROTOBUF_FINAL :
+class GetRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.GetRequest) */ {
  public:
-  inline GetRequest() : GetRequest(nullptr) {};
-  virtual ~GetRequest();
+  inline GetRequest() : GetRequest(nullptr) {}
+  ~GetRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetRequest(const GetRequest& from);
   GetRequest(GetRequest&& from) noexcept
@@ -579,8 +560,13 @@ class GetRequest PROTOBUF_FINAL :
     return *this;
   }
   inline GetRequest& operator=(GetRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -591,14 +577,14 @@ class GetRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GetRequest* internal_default_instance() {
     return reinterpret_cast<const GetRequest*>(
                &_GetRequest_default_instance_);
@@ -611,7 +597,12 @@ class GetRequest PROTOBUF_FINAL :
   }
   inline void Swap(GetRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -619,56 +610,53 @@ class GetRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetRequest* New() const final {
-    return CreateMaybeMessage<GetRequest>(nullptr);
-  }
-
-  GetRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetRequest& from);
-  void MergeFrom(const GetRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetRequest& from) {
+    GetRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.GetRequest";
   }
   protected:
-  explicit GetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -680,25 +668,14 @@ class GetRequest PROTOBUF_FINAL :
   // string key = 1;
   void clear_key();
   const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key();
-  std::string* release_key();
+  PROTOBUF_NODISCARD std::string* release_key();
   void set_allocated_key(std::string* key);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_key();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_key(
-      std::string* key);
   private:
   const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
   std::string* _internal_mutable_key();
   public:
 
@@ -709,17 +686,21 @@ class GetRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetResponse PROTOBUF_FINAL :
+class GetResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.GetResponse) */ {
  public:
-  inline GetResponse() : GetResponse(nullptr) {};
-  virtual ~GetResponse();
+  inline GetResponse() : GetResponse(nullptr) {}
+  ~GetResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetResponse(const GetResponse& from);
   GetResponse(GetResponse&& from) noexcept
@@ -732,8 +713,13 @@ class GetResponse PROTOBUF_FINAL :
     return *this;
   }
   inline GetResponse& operator=(GetResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -744,14 +730,14 @@ class GetResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GetResponse* internal_default_instance() {
     return reinterpret_cast<const GetResponse*>(
                &_GetResponse_default_instance_);
@@ -764,7 +750,12 @@ class GetResponse PROTOBUF_FINAL :
   }
   inline void Swap(GetResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -772,56 +763,53 @@ class GetResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetResponse* New() const final {
-    return CreateMaybeMessage<GetResponse>(nullptr);
-  }
-
-  GetResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetResponse& from);
-  void MergeFrom(const GetResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetResponse& from) {
+    GetResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.GetResponse";
   }
   protected:
-  explicit GetResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -835,50 +823,28 @@ class GetResponse PROTOBUF_FINAL :
   // string value = 2;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_value();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_value(
-      std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
   // string error_message = 3;
   void clear_error_message();
   const std::string& error_message() const;
-  void set_error_message(const std::string& value);
-  void set_error_message(std::string&& value);
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_error_message();
-  std::string* release_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
   void set_allocated_error_message(std::string* error_message);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_error_message();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_error_message(
-      std::string* error_message);
   private:
   const std::string& _internal_error_message() const;
-  void _internal_set_error_message(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
   std::string* _internal_mutable_error_message();
   public:
 
@@ -898,19 +864,23 @@ class GetResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
-  bool found_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    bool found_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DeleteRequest PROTOBUF_FINAL :
+class DeleteRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.DeleteRequest) */ {
  public:
-  inline DeleteRequest() : DeleteRequest(nullptr) {};
-  virtual ~DeleteRequest();
+  inline DeleteRequest() : DeleteRequest(nullptr) {}
+  ~DeleteRequest() override;
+  explicit PROTOBUF_CONSTEXPR DeleteRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DeleteRequest(const DeleteRequest& from);
   DeleteRequest(DeleteRequest&& from) noexcept
@@ -923,8 +893,13 @@ class DeleteRequest PROTOBUF_FINAL :
     return *this;
   }
   inline DeleteRequest& operator=(DeleteRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -935,14 +910,14 @@ class DeleteRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeleteRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const DeleteRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const DeleteRequest* internal_default_instance() {
     return reinterpret_cast<const DeleteRequest*>(
                &_DeleteRequest_default_instance_);
@@ -955,7 +930,12 @@ class DeleteRequest PROTOBUF_FINAL :
   }
   inline void Swap(DeleteRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -963,56 +943,53 @@ class DeleteRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(DeleteRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DeleteRequest* New() const final {
-    return CreateMaybeMessage<DeleteRequest>(nullptr);
-  }
-
-  DeleteRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  DeleteRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DeleteRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DeleteRequest& from);
-  void MergeFrom(const DeleteRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeleteRequest& from) {
+    DeleteRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(DeleteRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.DeleteRequest";
   }
   protected:
-  explicit DeleteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit DeleteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1024,25 +1001,14 @@ class DeleteRequest PROTOBUF_FINAL :
   // string key = 1;
   void clear_key();
   const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key();
-  std::string* release_key();
+  PROTOBUF_NODISCARD std::string* release_key();
   void set_allocated_key(std::string* key);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_key();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_key(
-      std::string* key);
   private:
   const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
   std::string* _internal_mutable_key();
   public:
 
@@ -1053,17 +1019,21 @@ class DeleteRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DeleteResponse PROTOBUF_FINAL :
+class DeleteResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.DeleteResponse) */ {
  public:
-  inline DeleteResponse() : DeleteResponse(nullptr) {};
-  virtual ~DeleteResponse();
+  inline DeleteResponse() : DeleteResponse(nullptr) {}
+  ~DeleteResponse() override;
+  explicit PROTOBUF_CONSTEXPR DeleteResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DeleteResponse(const DeleteResponse& from);
   DeleteResponse(DeleteResponse&& from) noexcept
@@ -1076,8 +1046,13 @@ class DeleteResponse PROTOBUF_FINAL :
     return *this;
   }
   inline DeleteResponse& operator=(DeleteResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1088,14 +1063,14 @@ class DeleteResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeleteResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const DeleteResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const DeleteResponse* internal_default_instance() {
     return reinterpret_cast<const DeleteResponse*>(
                &_DeleteResponse_default_instance_);
@@ -1108,7 +1083,12 @@ class DeleteResponse PROTOBUF_FINAL :
   }
   inline void Swap(DeleteResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1116,56 +1096,53 @@ class DeleteResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(DeleteResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DeleteResponse* New() const final {
-    return CreateMaybeMessage<DeleteResponse>(nullptr);
-  }
-
-  DeleteResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  DeleteResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DeleteResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DeleteResponse& from);
-  void MergeFrom(const DeleteResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeleteResponse& from) {
+    DeleteResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(DeleteResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.DeleteResponse";
   }
   protected:
-  explicit DeleteResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit DeleteResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1178,25 +1155,14 @@ class DeleteResponse PROTOBUF_FINAL :
   // string error_message = 2;
   void clear_error_message();
   const std::string& error_message() const;
-  void set_error_message(const std::string& value);
-  void set_error_message(std::string&& value);
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_error_message();
-  std::string* release_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
   void set_allocated_error_message(std::string* error_message);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_error_message();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_error_message(
-      std::string* error_message);
   private:
   const std::string& _internal_error_message() const;
-  void _internal_set_error_message(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
   std::string* _internal_mutable_error_message();
   public:
 
@@ -1216,18 +1182,22 @@ class DeleteResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
-  bool success_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class KeyValue PROTOBUF_FINAL :
+class KeyValue final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.KeyValue) */ {
  public:
-  inline KeyValue() : KeyValue(nullptr) {};
-  virtual ~KeyValue();
+  inline KeyValue() : KeyValue(nullptr) {}
+  ~KeyValue() override;
+  explicit PROTOBUF_CONSTEXPR KeyValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   KeyValue(const KeyValue& from);
   KeyValue(KeyValue&& from) noexcept
@@ -1240,8 +1210,13 @@ class KeyValue PROTOBUF_FINAL :
     return *this;
   }
   inline KeyValue& operator=(KeyValue&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1252,14 +1227,14 @@ class KeyValue PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeyValue& default_instance() {
+    return *internal_default_instance();
   }
-  static const KeyValue& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const KeyValue* internal_default_instance() {
     return reinterpret_cast<const KeyValue*>(
                &_KeyValue_default_instance_);
@@ -1272,7 +1247,12 @@ class KeyValue PROTOBUF_FINAL :
   }
   inline void Swap(KeyValue* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1280,56 +1260,53 @@ class KeyValue PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(KeyValue* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline KeyValue* New() const final {
-    return CreateMaybeMessage<KeyValue>(nullptr);
-  }
-
-  KeyValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  KeyValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<KeyValue>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const KeyValue& from);
-  void MergeFrom(const KeyValue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeyValue& from) {
+    KeyValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(KeyValue* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.KeyValue";
   }
   protected:
-  explicit KeyValue(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit KeyValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1342,50 +1319,28 @@ class KeyValue PROTOBUF_FINAL :
   // string key = 1;
   void clear_key();
   const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key();
-  std::string* release_key();
+  PROTOBUF_NODISCARD std::string* release_key();
   void set_allocated_key(std::string* key);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_key();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_key(
-      std::string* key);
   private:
   const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
   std::string* _internal_mutable_key();
   public:
 
   // string value = 2;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_value();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_value(
-      std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
@@ -1396,18 +1351,22 @@ class KeyValue PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BatchPutRequest PROTOBUF_FINAL :
+class BatchPutRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.BatchPutRequest) */ {
  public:
-  inline BatchPutRequest() : BatchPutRequest(nullptr) {};
-  virtual ~BatchPutRequest();
+  inline BatchPutRequest() : BatchPutRequest(nullptr) {}
+  ~BatchPutRequest() override;
+  explicit PROTOBUF_CONSTEXPR BatchPutRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   BatchPutRequest(const BatchPutRequest& from);
   BatchPutRequest(BatchPutRequest&& from) noexcept
@@ -1420,8 +1379,13 @@ class BatchPutRequest PROTOBUF_FINAL :
     return *this;
   }
   inline BatchPutRequest& operator=(BatchPutRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1432,14 +1396,14 @@ class BatchPutRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchPutRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const BatchPutRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const BatchPutRequest* internal_default_instance() {
     return reinterpret_cast<const BatchPutRequest*>(
                &_BatchPutRequest_default_instance_);
@@ -1452,7 +1416,12 @@ class BatchPutRequest PROTOBUF_FINAL :
   }
   inline void Swap(BatchPutRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1460,56 +1429,53 @@ class BatchPutRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(BatchPutRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline BatchPutRequest* New() const final {
-    return CreateMaybeMessage<BatchPutRequest>(nullptr);
-  }
-
-  BatchPutRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  BatchPutRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<BatchPutRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const BatchPutRequest& from);
-  void MergeFrom(const BatchPutRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchPutRequest& from) {
+    BatchPutRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(BatchPutRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.BatchPutRequest";
   }
   protected:
-  explicit BatchPutRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit BatchPutRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1543,17 +1509,21 @@ class BatchPutRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvdb::KeyValue > pairs_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvdb::KeyValue > pairs_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BatchPutResponse PROTOBUF_FINAL :
+class BatchPutResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.BatchPutResponse) */ {
  public:
-  inline BatchPutResponse() : BatchPutResponse(nullptr) {};
-  virtual ~BatchPutResponse();
+  inline BatchPutResponse() : BatchPutResponse(nullptr) {}
+  ~BatchPutResponse() override;
+  explicit PROTOBUF_CONSTEXPR BatchPutResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   BatchPutResponse(const BatchPutResponse& from);
   BatchPutResponse(BatchPutResponse&& from) noexcept
@@ -1566,8 +1536,13 @@ class BatchPutResponse PROTOBUF_FINAL :
     return *this;
   }
   inline BatchPutResponse& operator=(BatchPutResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1578,14 +1553,14 @@ class BatchPutResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchPutResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const BatchPutResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const BatchPutResponse* internal_default_instance() {
     return reinterpret_cast<const BatchPutResponse*>(
                &_BatchPutResponse_default_instance_);
@@ -1598,7 +1573,12 @@ class BatchPutResponse PROTOBUF_FINAL :
   }
   inline void Swap(BatchPutResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1606,56 +1586,53 @@ class BatchPutResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(BatchPutResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline BatchPutResponse* New() const final {
-    return CreateMaybeMessage<BatchPutResponse>(nullptr);
-  }
-
-  BatchPutResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  BatchPutResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<BatchPutResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const BatchPutResponse& from);
-  void MergeFrom(const BatchPutResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchPutResponse& from) {
+    BatchPutResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(BatchPutResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.BatchPutResponse";
   }
   protected:
-  explicit BatchPutResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit BatchPutResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1669,25 +1646,14 @@ class BatchPutResponse PROTOBUF_FINAL :
   // string error_message = 3;
   void clear_error_message();
   const std::string& error_message() const;
-  void set_error_message(const std::string& value);
-  void set_error_message(std::string&& value);
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_error_message();
-  std::string* release_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
   void set_allocated_error_message(std::string* error_message);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_error_message();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_error_message(
-      std::string* error_message);
   private:
   const std::string& _internal_error_message() const;
-  void _internal_set_error_message(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
   std::string* _internal_mutable_error_message();
   public:
 
@@ -1702,11 +1668,11 @@ class BatchPutResponse PROTOBUF_FINAL :
 
   // int32 processed_count = 2;
   void clear_processed_count();
-  ::PROTOBUF_NAMESPACE_ID::int32 processed_count() const;
-  void set_processed_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t processed_count() const;
+  void set_processed_count(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_processed_count() const;
-  void _internal_set_processed_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_processed_count() const;
+  void _internal_set_processed_count(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:kvdb.BatchPutResponse)
@@ -1716,19 +1682,23 @@ class BatchPutResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
-  bool success_;
-  ::PROTOBUF_NAMESPACE_ID::int32 processed_count_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    bool success_;
+    int32_t processed_count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BatchGetRequest PROTOBUF_FINAL :
+class BatchGetRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.BatchGetRequest) */ {
  public:
-  inline BatchGetRequest() : BatchGetRequest(nullptr) {};
-  virtual ~BatchGetRequest();
+  inline BatchGetRequest() : BatchGetRequest(nullptr) {}
+  ~BatchGetRequest() override;
+  explicit PROTOBUF_CONSTEXPR BatchGetRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   BatchGetRequest(const BatchGetRequest& from);
   BatchGetRequest(BatchGetRequest&& from) noexcept
@@ -1741,8 +1711,13 @@ class BatchGetRequest PROTOBUF_FINAL :
     return *this;
   }
   inline BatchGetRequest& operator=(BatchGetRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1753,14 +1728,14 @@ class BatchGetRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchGetRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const BatchGetRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const BatchGetRequest* internal_default_instance() {
     return reinterpret_cast<const BatchGetRequest*>(
                &_BatchGetRequest_default_instance_);
@@ -1773,7 +1748,12 @@ class BatchGetRequest PROTOBUF_FINAL :
   }
   inline void Swap(BatchGetRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1781,56 +1761,53 @@ class BatchGetRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(BatchGetRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline BatchGetRequest* New() const final {
-    return CreateMaybeMessage<BatchGetRequest>(nullptr);
-  }
-
-  BatchGetRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  BatchGetRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<BatchGetRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const BatchGetRequest& from);
-  void MergeFrom(const BatchGetRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchGetRequest& from) {
+    BatchGetRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(BatchGetRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.BatchGetRequest";
   }
   protected:
-  explicit BatchGetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit BatchGetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1870,17 +1847,21 @@ class BatchGetRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BatchGetResponse PROTOBUF_FINAL :
+class BatchGetResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.BatchGetResponse) */ {
  public:
-  inline BatchGetResponse() : BatchGetResponse(nullptr) {};
-  virtual ~BatchGetResponse();
+  inline BatchGetResponse() : BatchGetResponse(nullptr) {}
+  ~BatchGetResponse() override;
+  explicit PROTOBUF_CONSTEXPR BatchGetResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   BatchGetResponse(const BatchGetResponse& from);
   BatchGetResponse(BatchGetResponse&& from) noexcept
@@ -1893,8 +1874,13 @@ class BatchGetResponse PROTOBUF_FINAL :
     return *this;
   }
   inline BatchGetResponse& operator=(BatchGetResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1905,14 +1891,14 @@ class BatchGetResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchGetResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const BatchGetResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const BatchGetResponse* internal_default_instance() {
     return reinterpret_cast<const BatchGetResponse*>(
                &_BatchGetResponse_default_instance_);
@@ -1925,7 +1911,12 @@ class BatchGetResponse PROTOBUF_FINAL :
   }
   inline void Swap(BatchGetResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1933,56 +1924,53 @@ class BatchGetResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(BatchGetResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline BatchGetResponse* New() const final {
-    return CreateMaybeMessage<BatchGetResponse>(nullptr);
-  }
-
-  BatchGetResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  BatchGetResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<BatchGetResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const BatchGetResponse& from);
-  void MergeFrom(const BatchGetResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchGetResponse& from) {
+    BatchGetResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(BatchGetResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.BatchGetResponse";
   }
   protected:
-  explicit BatchGetResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit BatchGetResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2013,25 +2001,14 @@ class BatchGetResponse PROTOBUF_FINAL :
   // string error_message = 2;
   void clear_error_message();
   const std::string& error_message() const;
-  void set_error_message(const std::string& value);
-  void set_error_message(std::string&& value);
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_error_message();
-  std::string* release_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
   void set_allocated_error_message(std::string* error_message);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_error_message();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_error_message(
-      std::string* error_message);
   private:
   const std::string& _internal_error_message() const;
-  void _internal_set_error_message(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
   std::string* _internal_mutable_error_message();
   public:
 
@@ -2042,18 +2019,22 @@ class BatchGetResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvdb::KeyValue > pairs_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvdb::KeyValue > pairs_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ScanRequest PROTOBUF_FINAL :
+class ScanRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.ScanRequest) */ {
  public:
-  inline ScanRequest() : ScanRequest(nullptr) {};
-  virtual ~ScanRequest();
+  inline ScanRequest() : ScanRequest(nullptr) {}
+  ~ScanRequest() override;
+  explicit PROTOBUF_CONSTEXPR ScanRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ScanRequest(const ScanRequest& from);
   ScanRequest(ScanRequest&& from) noexcept
@@ -2066,8 +2047,13 @@ class ScanRequest PROTOBUF_FINAL :
     return *this;
   }
   inline ScanRequest& operator=(ScanRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2078,14 +2064,14 @@ class ScanRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScanRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const ScanRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ScanRequest* internal_default_instance() {
     return reinterpret_cast<const ScanRequest*>(
                &_ScanRequest_default_instance_);
@@ -2098,7 +2084,12 @@ class ScanRequest PROTOBUF_FINAL :
   }
   inline void Swap(ScanRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -2106,56 +2097,53 @@ class ScanRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(ScanRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ScanRequest* New() const final {
-    return CreateMaybeMessage<ScanRequest>(nullptr);
-  }
-
-  ScanRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ScanRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ScanRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ScanRequest& from);
-  void MergeFrom(const ScanRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScanRequest& from) {
+    ScanRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ScanRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.ScanRequest";
   }
   protected:
-  explicit ScanRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ScanRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2165,64 +2153,52 @@ class ScanRequest PROTOBUF_FINAL :
     kStartKeyFieldNumber = 1,
     kEndKeyFieldNumber = 2,
     kLimitFieldNumber = 3,
+    kBatchBytesFieldNumber = 4,
   };
   // string start_key = 1;
   void clear_start_key();
   const std::string& start_key() const;
-  void set_start_key(const std::string& value);
-  void set_start_key(std::string&& value);
-  void set_start_key(const char* value);
-  void set_start_key(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_start_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_start_key();
-  std::string* release_start_key();
+  PROTOBUF_NODISCARD std::string* release_start_key();
   void set_allocated_start_key(std::string* start_key);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_start_key();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_start_key(
-      std::string* start_key);
   private:
   const std::string& _internal_start_key() const;
-  void _internal_set_start_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_start_key(const std::string& value);
   std::string* _internal_mutable_start_key();
   public:
 
   // string end_key = 2;
   void clear_end_key();
   const std::string& end_key() const;
-  void set_end_key(const std::string& value);
-  void set_end_key(std::string&& value);
-  void set_end_key(const char* value);
-  void set_end_key(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_end_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_end_key();
-  std::string* release_end_key();
+  PROTOBUF_NODISCARD std::string* release_end_key();
   void set_allocated_end_key(std::string* end_key);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_end_key();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_end_key(
-      std::string* end_key);
   private:
   const std::string& _internal_end_key() const;
-  void _internal_set_end_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_end_key(const std::string& value);
   std::string* _internal_mutable_end_key();
   public:
 
   // int32 limit = 3;
   void clear_limit();
-  ::PROTOBUF_NAMESPACE_ID::int32 limit() const;
-  void set_limit(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t limit() const;
+  void set_limit(int32_t value);
+  private:
+  int32_t _internal_limit() const;
+  void _internal_set_limit(int32_t value);
+  public:
+
+  // uint32 batch_bytes = 4;
+  void clear_batch_bytes();
+  uint32_t batch_bytes() const;
+  void set_batch_bytes(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_limit() const;
-  void _internal_set_limit(::PROTOBUF_NAMESPACE_ID::int32 value);
+  uint32_t _internal_batch_bytes() const;
+  void _internal_set_batch_bytes(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:kvdb.ScanRequest)
@@ -2232,19 +2208,24 @@ class ScanRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr start_key_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr end_key_;
-  ::PROTOBUF_NAMESPACE_ID::int32 limit_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr start_key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr end_key_;
+    int32_t limit_;
+    uint32_t batch_bytes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ScanResponse PROTOBUF_FINAL :
+class ScanResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.ScanResponse) */ {
  public:
-  inline ScanResponse() : ScanResponse(nullptr) {};
-  virtual ~ScanResponse();
+  inline ScanResponse() : ScanResponse(nullptr) {}
+  ~ScanResponse() override;
+  explicit PROTOBUF_CONSTEXPR ScanResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ScanResponse(const ScanResponse& from);
   ScanResponse(ScanResponse&& from) noexcept
@@ -2257,8 +2238,13 @@ class ScanResponse PROTOBUF_FINAL :
     return *this;
   }
   inline ScanResponse& operator=(ScanResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2269,14 +2255,14 @@ class ScanResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScanResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const ScanResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ScanResponse* internal_default_instance() {
     return reinterpret_cast<const ScanResponse*>(
                &_ScanResponse_default_instance_);
@@ -2289,7 +2275,12 @@ class ScanResponse PROTOBUF_FINAL :
   }
   inline void Swap(ScanResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -2297,112 +2288,106 @@ class ScanResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(ScanResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ScanResponse* New() const final {
-    return CreateMaybeMessage<ScanResponse>(nullptr);
-  }
-
-  ScanResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ScanResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ScanResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ScanResponse& from);
-  void MergeFrom(const ScanResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScanResponse& from) {
+    ScanResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ScanResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.ScanResponse";
   }
   protected:
-  explicit ScanResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ScanResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
+    kPairsFieldNumber = 3,
     kKeyFieldNumber = 1,
     kValueFieldNumber = 2,
   };
+  // repeated .kvdb.KeyValue pairs = 3;
+  int pairs_size() const;
+  private:
+  int _internal_pairs_size() const;
+  public:
+  void clear_pairs();
+  ::kvdb::KeyValue* mutable_pairs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvdb::KeyValue >*
+      mutable_pairs();
+  private:
+  const ::kvdb::KeyValue& _internal_pairs(int index) const;
+  ::kvdb::KeyValue* _internal_add_pairs();
+  public:
+  const ::kvdb::KeyValue& pairs(int index) const;
+  ::kvdb::KeyValue* add_pairs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvdb::KeyValue >&
+      pairs() const;
+
   // string key = 1;
   void clear_key();
   const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key();
-  std::string* release_key();
+  PROTOBUF_NODISCARD std::string* release_key();
   void set_allocated_key(std::string* key);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_key();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_key(
-      std::string* key);
   private:
   const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
   std::string* _internal_mutable_key();
   public:
 
   // string value = 2;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_value();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_value(
-      std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
@@ -2413,18 +2398,23 @@ class ScanResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvdb::KeyValue > pairs_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PrefixScanRequest PROTOBUF_FINAL :
+class PrefixScanRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.PrefixScanRequest) */ {
  public:
-  inline PrefixScanRequest() : PrefixScanRequest(nullptr) {};
-  virtual ~PrefixScanRequest();
+  inline PrefixScanRequest() : PrefixScanRequest(nullptr) {}
+  ~PrefixScanRequest() override;
+  explicit PROTOBUF_CONSTEXPR PrefixScanRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PrefixScanRequest(const PrefixScanRequest& from);
   PrefixScanRequest(PrefixScanRequest&& from) noexcept
@@ -2437,8 +2427,13 @@ class PrefixScanRequest PROTOBUF_FINAL :
     return *this;
   }
   inline PrefixScanRequest& operator=(PrefixScanRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2449,14 +2444,14 @@ class PrefixScanRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrefixScanRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const PrefixScanRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PrefixScanRequest* internal_default_instance() {
     return reinterpret_cast<const PrefixScanRequest*>(
                &_PrefixScanRequest_default_instance_);
@@ -2469,7 +2464,12 @@ class PrefixScanRequest PROTOBUF_FINAL :
   }
   inline void Swap(PrefixScanRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -2477,56 +2477,53 @@ class PrefixScanRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(PrefixScanRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PrefixScanRequest* New() const final {
-    return CreateMaybeMessage<PrefixScanRequest>(nullptr);
-  }
-
-  PrefixScanRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PrefixScanRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PrefixScanRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PrefixScanRequest& from);
-  void MergeFrom(const PrefixScanRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrefixScanRequest& from) {
+    PrefixScanRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PrefixScanRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.PrefixScanRequest";
   }
   protected:
-  explicit PrefixScanRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit PrefixScanRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2535,39 +2532,38 @@ class PrefixScanRequest PROTOBUF_FINAL :
   enum : int {
     kPrefixFieldNumber = 1,
     kLimitFieldNumber = 2,
+    kBatchBytesFieldNumber = 3,
   };
   // string prefix = 1;
   void clear_prefix();
   const std::string& prefix() const;
-  void set_prefix(const std::string& value);
-  void set_prefix(std::string&& value);
-  void set_prefix(const char* value);
-  void set_prefix(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_prefix(ArgT0&& arg0, ArgT... args);
   std::string* mutable_prefix();
-  std::string* release_prefix();
+  PROTOBUF_NODISCARD std::string* release_prefix();
   void set_allocated_prefix(std::string* prefix);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_prefix();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_prefix(
-      std::string* prefix);
   private:
   const std::string& _internal_prefix() const;
-  void _internal_set_prefix(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_prefix(const std::string& value);
   std::string* _internal_mutable_prefix();
   public:
 
   // int32 limit = 2;
   void clear_limit();
-  ::PROTOBUF_NAMESPACE_ID::int32 limit() const;
-  void set_limit(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t limit() const;
+  void set_limit(int32_t value);
+  private:
+  int32_t _internal_limit() const;
+  void _internal_set_limit(int32_t value);
+  public:
+
+  // uint32 batch_bytes = 3;
+  void clear_batch_bytes();
+  uint32_t batch_bytes() const;
+  void set_batch_bytes(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_limit() const;
-  void _internal_set_limit(::PROTOBUF_NAMESPACE_ID::int32 value);
+  uint32_t _internal_batch_bytes() const;
+  void _internal_set_batch_bytes(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:kvdb.PrefixScanRequest)
@@ -2577,18 +2573,23 @@ class PrefixScanRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prefix_;
-  ::PROTOBUF_NAMESPACE_ID::int32 limit_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prefix_;
+    int32_t limit_;
+    uint32_t batch_bytes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PrefixScanResponse PROTOBUF_FINAL :
+class PrefixScanResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.PrefixScanResponse) */ {
  public:
-  inline PrefixScanResponse() : PrefixScanResponse(nullptr) {};
-  virtual ~PrefixScanResponse();
+  inline PrefixScanResponse() : PrefixScanResponse(nullptr) {}
+  ~PrefixScanResponse() override;
+  explicit PROTOBUF_CONSTEXPR PrefixScanResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PrefixScanResponse(const PrefixScanResponse& from);
   PrefixScanResponse(PrefixScanResponse&& from) noexcept
@@ -2601,8 +2602,13 @@ class PrefixScanResponse PROTOBUF_FINAL :
     return *this;
   }
   inline PrefixScanResponse& operator=(PrefixScanResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2613,14 +2619,14 @@ class PrefixScanResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrefixScanResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const PrefixScanResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PrefixScanResponse* internal_default_instance() {
     return reinterpret_cast<const PrefixScanResponse*>(
                &_PrefixScanResponse_default_instance_);
@@ -2633,7 +2639,12 @@ class PrefixScanResponse PROTOBUF_FINAL :
   }
   inline void Swap(PrefixScanResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -2641,112 +2652,106 @@ class PrefixScanResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(PrefixScanResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PrefixScanResponse* New() const final {
-    return CreateMaybeMessage<PrefixScanResponse>(nullptr);
-  }
-
-  PrefixScanResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PrefixScanResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PrefixScanResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PrefixScanResponse& from);
-  void MergeFrom(const PrefixScanResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrefixScanResponse& from) {
+    PrefixScanResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PrefixScanResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.PrefixScanResponse";
   }
   protected:
-  explicit PrefixScanResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit PrefixScanResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
+    kPairsFieldNumber = 3,
     kKeyFieldNumber = 1,
     kValueFieldNumber = 2,
   };
+  // repeated .kvdb.KeyValue pairs = 3;
+  int pairs_size() const;
+  private:
+  int _internal_pairs_size() const;
+  public:
+  void clear_pairs();
+  ::kvdb::KeyValue* mutable_pairs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvdb::KeyValue >*
+      mutable_pairs();
+  private:
+  const ::kvdb::KeyValue& _internal_pairs(int index) const;
+  ::kvdb::KeyValue* _internal_add_pairs();
+  public:
+  const ::kvdb::KeyValue& pairs(int index) const;
+  ::kvdb::KeyValue* add_pairs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvdb::KeyValue >&
+      pairs() const;
+
   // string key = 1;
   void clear_key();
   const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key();
-  std::string* release_key();
+  PROTOBUF_NODISCARD std::string* release_key();
   void set_allocated_key(std::string* key);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_key();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_key(
-      std::string* key);
   private:
   const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
   std::string* _internal_mutable_key();
   public:
 
   // string value = 2;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_value();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_value(
-      std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
@@ -2757,18 +2762,22 @@ class PrefixScanResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvdb::KeyValue > pairs_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CreateSnapshotRequest PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.CreateSnapshotRequest) */ {
+class CreateSnapshotRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:kvdb.CreateSnapshotRequest) */ {
  public:
-  inline CreateSnapshotRequest() : CreateSnapshotRequest(nullptr) {};
-  virtual ~CreateSnapshotRequest();
+  inline CreateSnapshotRequest() : CreateSnapshotRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR CreateSnapshotRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CreateSnapshotRequest(const CreateSnapshotRequest& from);
   CreateSnapshotRequest(CreateSnapshotRequest&& from) noexcept
@@ -2781,8 +2790,13 @@ class CreateSnapshotRequest PROTOBUF_FINAL :
     return *this;
   }
   inline CreateSnapshotRequest& operator=(CreateSnapshotRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2793,14 +2807,14 @@ class CreateSnapshotRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CreateSnapshotRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const CreateSnapshotRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const CreateSnapshotRequest* internal_default_instance() {
     return reinterpret_cast<const CreateSnapshotRequest*>(
                &_CreateSnapshotRequest_default_instance_);
@@ -2813,7 +2827,12 @@ class CreateSnapshotRequest PROTOBUF_FINAL :
   }
   inline void Swap(CreateSnapshotRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -2821,56 +2840,39 @@ class CreateSnapshotRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(CreateSnapshotRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline CreateSnapshotRequest* New() const final {
-    return CreateMaybeMessage<CreateSnapshotRequest>(nullptr);
-  }
-
-  CreateSnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  CreateSnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<CreateSnapshotRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const CreateSnapshotRequest& from);
-  void MergeFrom(const CreateSnapshotRequest& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const CreateSnapshotRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const CreateSnapshotRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(CreateSnapshotRequest* other);
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.CreateSnapshotRequest";
   }
   protected:
-  explicit CreateSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit CreateSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2883,16 +2885,18 @@ class CreateSnapshotRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CreateSnapshotResponse PROTOBUF_FINAL :
+class CreateSnapshotResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.CreateSnapshotResponse) */ {
  public:
-  inline CreateSnapshotResponse() : CreateSnapshotResponse(nullptr) {};
-  virtual ~CreateSnapshotResponse();
+  inline CreateSnapshotResponse() : CreateSnapshotResponse(nullptr) {}
+  ~CreateSnapshotResponse() override;
+  explicit PROTOBUF_CONSTEXPR CreateSnapshotResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CreateSnapshotResponse(const CreateSnapshotResponse& from);
   CreateSnapshotResponse(CreateSnapshotResponse&& from) noexcept
@@ -2905,8 +2909,13 @@ class CreateSnapshotResponse PROTOBUF_FINAL :
     return *this;
   }
   inline CreateSnapshotResponse& operator=(CreateSnapshotResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2917,14 +2926,14 @@ class CreateSnapshotResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CreateSnapshotResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const CreateSnapshotResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const CreateSnapshotResponse* internal_default_instance() {
     return reinterpret_cast<const CreateSnapshotResponse*>(
                &_CreateSnapshotResponse_default_instance_);
@@ -2937,7 +2946,12 @@ class CreateSnapshotResponse PROTOBUF_FINAL :
   }
   inline void Swap(CreateSnapshotResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -2945,56 +2959,53 @@ class CreateSnapshotResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(CreateSnapshotResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline CreateSnapshotResponse* New() const final {
-    return CreateMaybeMessage<CreateSnapshotResponse>(nullptr);
-  }
-
-  CreateSnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  CreateSnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<CreateSnapshotResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const CreateSnapshotResponse& from);
-  void MergeFrom(const CreateSnapshotResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CreateSnapshotResponse& from) {
+    CreateSnapshotResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(CreateSnapshotResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.CreateSnapshotResponse";
   }
   protected:
-  explicit CreateSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit CreateSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3007,35 +3018,24 @@ class CreateSnapshotResponse PROTOBUF_FINAL :
   // string error_message = 2;
   void clear_error_message();
   const std::string& error_message() const;
-  void set_error_message(const std::string& value);
-  void set_error_message(std::string&& value);
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_error_message();
-  std::string* release_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
   void set_allocated_error_message(std::string* error_message);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_error_message();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_error_message(
-      std::string* error_message);
   private:
   const std::string& _internal_error_message() const;
-  void _internal_set_error_message(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
   std::string* _internal_mutable_error_message();
   public:
 
   // uint64 snapshot_id = 1;
   void clear_snapshot_id();
-  ::PROTOBUF_NAMESPACE_ID::uint64 snapshot_id() const;
-  void set_snapshot_id(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t snapshot_id() const;
+  void set_snapshot_id(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_snapshot_id() const;
-  void _internal_set_snapshot_id(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_snapshot_id() const;
+  void _internal_set_snapshot_id(uint64_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:kvdb.CreateSnapshotResponse)
@@ -3045,18 +3045,22 @@ class CreateSnapshotResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 snapshot_id_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    uint64_t snapshot_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ReleaseSnapshotRequest PROTOBUF_FINAL :
+class ReleaseSnapshotRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.ReleaseSnapshotRequest) */ {
  public:
-  inline ReleaseSnapshotRequest() : ReleaseSnapshotRequest(nullptr) {};
-  virtual ~ReleaseSnapshotRequest();
+  inline ReleaseSnapshotRequest() : ReleaseSnapshotRequest(nullptr) {}
+  ~ReleaseSnapshotRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReleaseSnapshotRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ReleaseSnapshotRequest(const ReleaseSnapshotRequest& from);
   ReleaseSnapshotRequest(ReleaseSnapshotRequest&& from) noexcept
@@ -3069,8 +3073,13 @@ class ReleaseSnapshotRequest PROTOBUF_FINAL :
     return *this;
   }
   inline ReleaseSnapshotRequest& operator=(ReleaseSnapshotRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3081,14 +3090,14 @@ class ReleaseSnapshotRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReleaseSnapshotRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const ReleaseSnapshotRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ReleaseSnapshotRequest* internal_default_instance() {
     return reinterpret_cast<const ReleaseSnapshotRequest*>(
                &_ReleaseSnapshotRequest_default_instance_);
@@ -3101,7 +3110,12 @@ class ReleaseSnapshotRequest PROTOBUF_FINAL :
   }
   inline void Swap(ReleaseSnapshotRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -3109,56 +3123,53 @@ class ReleaseSnapshotRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(ReleaseSnapshotRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ReleaseSnapshotRequest* New() const final {
-    return CreateMaybeMessage<ReleaseSnapshotRequest>(nullptr);
-  }
-
-  ReleaseSnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ReleaseSnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ReleaseSnapshotRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ReleaseSnapshotRequest& from);
-  void MergeFrom(const ReleaseSnapshotRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReleaseSnapshotRequest& from) {
+    ReleaseSnapshotRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ReleaseSnapshotRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.ReleaseSnapshotRequest";
   }
   protected:
-  explicit ReleaseSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ReleaseSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3169,11 +3180,11 @@ class ReleaseSnapshotRequest PROTOBUF_FINAL :
   };
   // uint64 snapshot_id = 1;
   void clear_snapshot_id();
-  ::PROTOBUF_NAMESPACE_ID::uint64 snapshot_id() const;
-  void set_snapshot_id(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t snapshot_id() const;
+  void set_snapshot_id(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_snapshot_id() const;
-  void _internal_set_snapshot_id(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_snapshot_id() const;
+  void _internal_set_snapshot_id(uint64_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:kvdb.ReleaseSnapshotRequest)
@@ -3183,17 +3194,21 @@ class ReleaseSnapshotRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 snapshot_id_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    uint64_t snapshot_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ReleaseSnapshotResponse PROTOBUF_FINAL :
+class ReleaseSnapshotResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.ReleaseSnapshotResponse) */ {
  public:
-  inline ReleaseSnapshotResponse() : ReleaseSnapshotResponse(nullptr) {};
-  virtual ~ReleaseSnapshotResponse();
+  inline ReleaseSnapshotResponse() : ReleaseSnapshotResponse(nullptr) {}
+  ~ReleaseSnapshotResponse() override;
+  explicit PROTOBUF_CONSTEXPR ReleaseSnapshotResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ReleaseSnapshotResponse(const ReleaseSnapshotResponse& from);
   ReleaseSnapshotResponse(ReleaseSnapshotResponse&& from) noexcept
@@ -3206,8 +3221,13 @@ class ReleaseSnapshotResponse PROTOBUF_FINAL :
     return *this;
   }
   inline ReleaseSnapshotResponse& operator=(ReleaseSnapshotResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3218,14 +3238,14 @@ class ReleaseSnapshotResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReleaseSnapshotResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const ReleaseSnapshotResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ReleaseSnapshotResponse* internal_default_instance() {
     return reinterpret_cast<const ReleaseSnapshotResponse*>(
                &_ReleaseSnapshotResponse_default_instance_);
@@ -3238,7 +3258,12 @@ class ReleaseSnapshotResponse PROTOBUF_FINAL :
   }
   inline void Swap(ReleaseSnapshotResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -3246,56 +3271,53 @@ class ReleaseSnapshotResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(ReleaseSnapshotResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ReleaseSnapshotResponse* New() const final {
-    return CreateMaybeMessage<ReleaseSnapshotResponse>(nullptr);
-  }
-
-  ReleaseSnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ReleaseSnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ReleaseSnapshotResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ReleaseSnapshotResponse& from);
-  void MergeFrom(const ReleaseSnapshotResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReleaseSnapshotResponse& from) {
+    ReleaseSnapshotResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ReleaseSnapshotResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.ReleaseSnapshotResponse";
   }
   protected:
-  explicit ReleaseSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ReleaseSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3308,25 +3330,14 @@ class ReleaseSnapshotResponse PROTOBUF_FINAL :
   // string error_message = 2;
   void clear_error_message();
   const std::string& error_message() const;
-  void set_error_message(const std::string& value);
-  void set_error_message(std::string&& value);
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_error_message();
-  std::string* release_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
   void set_allocated_error_message(std::string* error_message);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_error_message();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_error_message(
-      std::string* error_message);
   private:
   const std::string& _internal_error_message() const;
-  void _internal_set_error_message(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
   std::string* _internal_mutable_error_message();
   public:
 
@@ -3346,18 +3357,22 @@ class ReleaseSnapshotResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
-  bool success_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetAtSnapshotRequest PROTOBUF_FINAL :
+class GetAtSnapshotRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.GetAtSnapshotRequest) */ {
  public:
-  inline GetAtSnapshotRequest() : GetAtSnapshotRequest(nullptr) {};
-  virtual ~GetAtSnapshotRequest();
+  inline GetAtSnapshotRequest() : GetAtSnapshotRequest(nullptr) {}
+  ~GetAtSnapshotRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetAtSnapshotRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetAtSnapshotRequest(const GetAtSnapshotRequest& from);
   GetAtSnapshotRequest(GetAtSnapshotRequest&& from) noexcept
@@ -3370,8 +3385,13 @@ class GetAtSnapshotRequest PROTOBUF_FINAL :
     return *this;
   }
   inline GetAtSnapshotRequest& operator=(GetAtSnapshotRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3382,14 +3402,14 @@ class GetAtSnapshotRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetAtSnapshotRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetAtSnapshotRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GetAtSnapshotRequest* internal_default_instance() {
     return reinterpret_cast<const GetAtSnapshotRequest*>(
                &_GetAtSnapshotRequest_default_instance_);
@@ -3402,7 +3422,12 @@ class GetAtSnapshotRequest PROTOBUF_FINAL :
   }
   inline void Swap(GetAtSnapshotRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -3410,56 +3435,53 @@ class GetAtSnapshotRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetAtSnapshotRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetAtSnapshotRequest* New() const final {
-    return CreateMaybeMessage<GetAtSnapshotRequest>(nullptr);
-  }
-
-  GetAtSnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetAtSnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetAtSnapshotRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetAtSnapshotRequest& from);
-  void MergeFrom(const GetAtSnapshotRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetAtSnapshotRequest& from) {
+    GetAtSnapshotRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetAtSnapshotRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.GetAtSnapshotRequest";
   }
   protected:
-  explicit GetAtSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetAtSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3472,35 +3494,24 @@ class GetAtSnapshotRequest PROTOBUF_FINAL :
   // string key = 1;
   void clear_key();
   const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key();
-  std::string* release_key();
+  PROTOBUF_NODISCARD std::string* release_key();
   void set_allocated_key(std::string* key);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_key();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_key(
-      std::string* key);
   private:
   const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
   std::string* _internal_mutable_key();
   public:
 
   // uint64 snapshot_id = 2;
   void clear_snapshot_id();
-  ::PROTOBUF_NAMESPACE_ID::uint64 snapshot_id() const;
-  void set_snapshot_id(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t snapshot_id() const;
+  void set_snapshot_id(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_snapshot_id() const;
-  void _internal_set_snapshot_id(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_snapshot_id() const;
+  void _internal_set_snapshot_id(uint64_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:kvdb.GetAtSnapshotRequest)
@@ -3510,18 +3521,22 @@ class GetAtSnapshotRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 snapshot_id_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    uint64_t snapshot_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetAtSnapshotResponse PROTOBUF_FINAL :
+class GetAtSnapshotResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.GetAtSnapshotResponse) */ {
  public:
-  inline GetAtSnapshotResponse() : GetAtSnapshotResponse(nullptr) {};
-  virtual ~GetAtSnapshotResponse();
+  inline GetAtSnapshotResponse() : GetAtSnapshotResponse(nullptr) {}
+  ~GetAtSnapshotResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetAtSnapshotResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetAtSnapshotResponse(const GetAtSnapshotResponse& from);
   GetAtSnapshotResponse(GetAtSnapshotResponse&& from) noexcept
@@ -3534,8 +3549,13 @@ class GetAtSnapshotResponse PROTOBUF_FINAL :
     return *this;
   }
   inline GetAtSnapshotResponse& operator=(GetAtSnapshotResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3546,14 +3566,14 @@ class GetAtSnapshotResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetAtSnapshotResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetAtSnapshotResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GetAtSnapshotResponse* internal_default_instance() {
     return reinterpret_cast<const GetAtSnapshotResponse*>(
                &_GetAtSnapshotResponse_default_instance_);
@@ -3566,7 +3586,12 @@ class GetAtSnapshotResponse PROTOBUF_FINAL :
   }
   inline void Swap(GetAtSnapshotResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -3574,56 +3599,53 @@ class GetAtSnapshotResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetAtSnapshotResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetAtSnapshotResponse* New() const final {
-    return CreateMaybeMessage<GetAtSnapshotResponse>(nullptr);
-  }
-
-  GetAtSnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetAtSnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetAtSnapshotResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetAtSnapshotResponse& from);
-  void MergeFrom(const GetAtSnapshotResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetAtSnapshotResponse& from) {
+    GetAtSnapshotResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetAtSnapshotResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.GetAtSnapshotResponse";
   }
   protected:
-  explicit GetAtSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetAtSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3637,50 +3659,28 @@ class GetAtSnapshotResponse PROTOBUF_FINAL :
   // string value = 2;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_value();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_value(
-      std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
   // string error_message = 3;
   void clear_error_message();
   const std::string& error_message() const;
-  void set_error_message(const std::string& value);
-  void set_error_message(std::string&& value);
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_error_message();
-  std::string* release_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
   void set_allocated_error_message(std::string* error_message);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_error_message();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_error_message(
-      std::string* error_message);
   private:
   const std::string& _internal_error_message() const;
-  void _internal_set_error_message(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
   std::string* _internal_mutable_error_message();
   public:
 
@@ -3700,19 +3700,22 @@ class GetAtSnapshotResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
-  bool found_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    bool found_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class FlushRequest PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.FlushRequest) */ {
+class FlushRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:kvdb.FlushRequest) */ {
  public:
-  inline FlushRequest() : FlushRequest(nullptr) {};
-  virtual ~FlushRequest();
+  inline FlushRequest() : FlushRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR FlushRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   FlushRequest(const FlushRequest& from);
   FlushRequest(FlushRequest&& from) noexcept
@@ -3725,8 +3728,13 @@ class FlushRequest PROTOBUF_FINAL :
     return *this;
   }
   inline FlushRequest& operator=(FlushRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3737,14 +3745,14 @@ class FlushRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FlushRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const FlushRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const FlushRequest* internal_default_instance() {
     return reinterpret_cast<const FlushRequest*>(
                &_FlushRequest_default_instance_);
@@ -3757,7 +3765,12 @@ class FlushRequest PROTOBUF_FINAL :
   }
   inline void Swap(FlushRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -3765,56 +3778,39 @@ class FlushRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(FlushRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline FlushRequest* New() const final {
-    return CreateMaybeMessage<FlushRequest>(nullptr);
-  }
-
-  FlushRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  FlushRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<FlushRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const FlushRequest& from);
-  void MergeFrom(const FlushRequest& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const FlushRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const FlushRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(FlushRequest* other);
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.FlushRequest";
   }
   protected:
-  explicit FlushRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit FlushRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3827,16 +3823,18 @@ class FlushRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class FlushResponse PROTOBUF_FINAL :
+class FlushResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.FlushResponse) */ {
  public:
-  inline FlushResponse() : FlushResponse(nullptr) {};
-  virtual ~FlushResponse();
+  inline FlushResponse() : FlushResponse(nullptr) {}
+  ~FlushResponse() override;
+  explicit PROTOBUF_CONSTEXPR FlushResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   FlushResponse(const FlushResponse& from);
   FlushResponse(FlushResponse&& from) noexcept
@@ -3849,8 +3847,13 @@ class FlushResponse PROTOBUF_FINAL :
     return *this;
   }
   inline FlushResponse& operator=(FlushResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3861,14 +3864,14 @@ class FlushResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FlushResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const FlushResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const FlushResponse* internal_default_instance() {
     return reinterpret_cast<const FlushResponse*>(
                &_FlushResponse_default_instance_);
@@ -3881,7 +3884,12 @@ class FlushResponse PROTOBUF_FINAL :
   }
   inline void Swap(FlushResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -3889,56 +3897,53 @@ class FlushResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(FlushResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline FlushResponse* New() const final {
-    return CreateMaybeMessage<FlushResponse>(nullptr);
-  }
-
-  FlushResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  FlushResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<FlushResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const FlushResponse& from);
-  void MergeFrom(const FlushResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FlushResponse& from) {
+    FlushResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(FlushResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.FlushResponse";
   }
   protected:
-  explicit FlushResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit FlushResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3951,25 +3956,14 @@ class FlushResponse PROTOBUF_FINAL :
   // string error_message = 2;
   void clear_error_message();
   const std::string& error_message() const;
-  void set_error_message(const std::string& value);
-  void set_error_message(std::string&& value);
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_error_message();
-  std::string* release_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
   void set_allocated_error_message(std::string* error_message);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_error_message();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_error_message(
-      std::string* error_message);
   private:
   const std::string& _internal_error_message() const;
-  void _internal_set_error_message(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
   std::string* _internal_mutable_error_message();
   public:
 
@@ -3989,18 +3983,21 @@ class FlushResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
-  bool success_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CompactRequest PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.CompactRequest) */ {
+class CompactRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:kvdb.CompactRequest) */ {
  public:
-  inline CompactRequest() : CompactRequest(nullptr) {};
-  virtual ~CompactRequest();
+  inline CompactRequest() : CompactRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR CompactRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CompactRequest(const CompactRequest& from);
   CompactRequest(CompactRequest&& from) noexcept
@@ -4013,8 +4010,13 @@ class CompactRequest PROTOBUF_FINAL :
     return *this;
   }
   inline CompactRequest& operator=(CompactRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -4025,14 +4027,14 @@ class CompactRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CompactRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const CompactRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const CompactRequest* internal_default_instance() {
     return reinterpret_cast<const CompactRequest*>(
                &_CompactRequest_default_instance_);
@@ -4045,7 +4047,12 @@ class CompactRequest PROTOBUF_FINAL :
   }
   inline void Swap(CompactRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -4053,56 +4060,39 @@ class CompactRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(CompactRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline CompactRequest* New() const final {
-    return CreateMaybeMessage<CompactRequest>(nullptr);
-  }
-
-  CompactRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  CompactRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<CompactRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const CompactRequest& from);
-  void MergeFrom(const CompactRequest& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const CompactRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const CompactRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(CompactRequest* other);
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.CompactRequest";
   }
   protected:
-  explicit CompactRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit CompactRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -4115,16 +4105,18 @@ class CompactRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CompactResponse PROTOBUF_FINAL :
+class CompactResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.CompactResponse) */ {
  public:
-  inline CompactResponse() : CompactResponse(nullptr) {};
-  virtual ~CompactResponse();
+  inline CompactResponse() : CompactResponse(nullptr) {}
+  ~CompactResponse() override;
+  explicit PROTOBUF_CONSTEXPR CompactResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CompactResponse(const CompactResponse& from);
   CompactResponse(CompactResponse&& from) noexcept
@@ -4137,8 +4129,13 @@ class CompactResponse PROTOBUF_FINAL :
     return *this;
   }
   inline CompactResponse& operator=(CompactResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -4149,14 +4146,14 @@ class CompactResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CompactResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const CompactResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const CompactResponse* internal_default_instance() {
     return reinterpret_cast<const CompactResponse*>(
                &_CompactResponse_default_instance_);
@@ -4169,7 +4166,12 @@ class CompactResponse PROTOBUF_FINAL :
   }
   inline void Swap(CompactResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -4177,56 +4179,53 @@ class CompactResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(CompactResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline CompactResponse* New() const final {
-    return CreateMaybeMessage<CompactResponse>(nullptr);
-  }
-
-  CompactResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  CompactResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<CompactResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const CompactResponse& from);
-  void MergeFrom(const CompactResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CompactResponse& from) {
+    CompactResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(CompactResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.CompactResponse";
   }
   protected:
-  explicit CompactResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit CompactResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -4239,25 +4238,14 @@ class CompactResponse PROTOBUF_FINAL :
   // string error_message = 2;
   void clear_error_message();
   const std::string& error_message() const;
-  void set_error_message(const std::string& value);
-  void set_error_message(std::string&& value);
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_error_message();
-  std::string* release_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
   void set_allocated_error_message(std::string* error_message);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_error_message();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_error_message(
-      std::string* error_message);
   private:
   const std::string& _internal_error_message() const;
-  void _internal_set_error_message(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
   std::string* _internal_mutable_error_message();
   public:
 
@@ -4277,18 +4265,21 @@ class CompactResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
-  bool success_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetStatsRequest PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.GetStatsRequest) */ {
+class GetStatsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:kvdb.GetStatsRequest) */ {
  public:
-  inline GetStatsRequest() : GetStatsRequest(nullptr) {};
-  virtual ~GetStatsRequest();
+  inline GetStatsRequest() : GetStatsRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR GetStatsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetStatsRequest(const GetStatsRequest& from);
   GetStatsRequest(GetStatsRequest&& from) noexcept
@@ -4301,8 +4292,13 @@ class GetStatsRequest PROTOBUF_FINAL :
     return *this;
   }
   inline GetStatsRequest& operator=(GetStatsRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -4313,14 +4309,14 @@ class GetStatsRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetStatsRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetStatsRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GetStatsRequest* internal_default_instance() {
     return reinterpret_cast<const GetStatsRequest*>(
                &_GetStatsRequest_default_instance_);
@@ -4333,7 +4329,12 @@ class GetStatsRequest PROTOBUF_FINAL :
   }
   inline void Swap(GetStatsRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -4341,56 +4342,39 @@ class GetStatsRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetStatsRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetStatsRequest* New() const final {
-    return CreateMaybeMessage<GetStatsRequest>(nullptr);
-  }
-
-  GetStatsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetStatsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetStatsRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const GetStatsRequest& from);
-  void MergeFrom(const GetStatsRequest& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const GetStatsRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const GetStatsRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(GetStatsRequest* other);
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.GetStatsRequest";
   }
   protected:
-  explicit GetStatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetStatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -4403,16 +4387,18 @@ class GetStatsRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetStatsResponse PROTOBUF_FINAL :
+class GetStatsResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.GetStatsResponse) */ {
  public:
-  inline GetStatsResponse() : GetStatsResponse(nullptr) {};
-  virtual ~GetStatsResponse();
+  inline GetStatsResponse() : GetStatsResponse(nullptr) {}
+  ~GetStatsResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetStatsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetStatsResponse(const GetStatsResponse& from);
   GetStatsResponse(GetStatsResponse&& from) noexcept
@@ -4425,8 +4411,13 @@ class GetStatsResponse PROTOBUF_FINAL :
     return *this;
   }
   inline GetStatsResponse& operator=(GetStatsResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -4437,14 +4428,14 @@ class GetStatsResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetStatsResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetStatsResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GetStatsResponse* internal_default_instance() {
     return reinterpret_cast<const GetStatsResponse*>(
                &_GetStatsResponse_default_instance_);
@@ -4457,7 +4448,12 @@ class GetStatsResponse PROTOBUF_FINAL :
   }
   inline void Swap(GetStatsResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -4465,56 +4461,53 @@ class GetStatsResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetStatsResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetStatsResponse* New() const final {
-    return CreateMaybeMessage<GetStatsResponse>(nullptr);
-  }
-
-  GetStatsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetStatsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetStatsResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetStatsResponse& from);
-  void MergeFrom(const GetStatsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetStatsResponse& from) {
+    GetStatsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetStatsResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.GetStatsResponse";
   }
   protected:
-  explicit GetStatsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetStatsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -4534,7 +4527,7 @@ class GetStatsResponse PROTOBUF_FINAL :
   public:
   void clear_compaction_stats();
   const ::kvdb::CompactionStats& compaction_stats() const;
-  ::kvdb::CompactionStats* release_compaction_stats();
+  PROTOBUF_NODISCARD ::kvdb::CompactionStats* release_compaction_stats();
   ::kvdb::CompactionStats* mutable_compaction_stats();
   void set_allocated_compaction_stats(::kvdb::CompactionStats* compaction_stats);
   private:
@@ -4547,20 +4540,20 @@ class GetStatsResponse PROTOBUF_FINAL :
 
   // uint64 memtable_size = 1;
   void clear_memtable_size();
-  ::PROTOBUF_NAMESPACE_ID::uint64 memtable_size() const;
-  void set_memtable_size(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t memtable_size() const;
+  void set_memtable_size(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_memtable_size() const;
-  void _internal_set_memtable_size(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_memtable_size() const;
+  void _internal_set_memtable_size(uint64_t value);
   public:
 
   // uint64 wal_size = 2;
   void clear_wal_size();
-  ::PROTOBUF_NAMESPACE_ID::uint64 wal_size() const;
-  void set_wal_size(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t wal_size() const;
+  void set_wal_size(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_wal_size() const;
-  void _internal_set_wal_size(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_wal_size() const;
+  void _internal_set_wal_size(uint64_t value);
   public:
 
   // double cache_hit_rate = 3;
@@ -4574,11 +4567,11 @@ class GetStatsResponse PROTOBUF_FINAL :
 
   // int32 active_snapshots = 4;
   void clear_active_snapshots();
-  ::PROTOBUF_NAMESPACE_ID::int32 active_snapshots() const;
-  void set_active_snapshots(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t active_snapshots() const;
+  void set_active_snapshots(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_active_snapshots() const;
-  void _internal_set_active_snapshots(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_active_snapshots() const;
+  void _internal_set_active_snapshots(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:kvdb.GetStatsResponse)
@@ -4588,21 +4581,25 @@ class GetStatsResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::kvdb::CompactionStats* compaction_stats_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 memtable_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 wal_size_;
-  double cache_hit_rate_;
-  ::PROTOBUF_NAMESPACE_ID::int32 active_snapshots_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::kvdb::CompactionStats* compaction_stats_;
+    uint64_t memtable_size_;
+    uint64_t wal_size_;
+    double cache_hit_rate_;
+    int32_t active_snapshots_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CompactionStats PROTOBUF_FINAL :
+class CompactionStats final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.CompactionStats) */ {
  public:
-  inline CompactionStats() : CompactionStats(nullptr) {};
-  virtual ~CompactionStats();
+  inline CompactionStats() : CompactionStats(nullptr) {}
+  ~CompactionStats() override;
+  explicit PROTOBUF_CONSTEXPR CompactionStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CompactionStats(const CompactionStats& from);
   CompactionStats(CompactionStats&& from) noexcept
@@ -4615,8 +4612,13 @@ class CompactionStats PROTOBUF_FINAL :
     return *this;
   }
   inline CompactionStats& operator=(CompactionStats&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -4627,14 +4629,14 @@ class CompactionStats PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CompactionStats& default_instance() {
+    return *internal_default_instance();
   }
-  static const CompactionStats& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const CompactionStats* internal_default_instance() {
     return reinterpret_cast<const CompactionStats*>(
                &_CompactionStats_default_instance_);
@@ -4647,7 +4649,12 @@ class CompactionStats PROTOBUF_FINAL :
   }
   inline void Swap(CompactionStats* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -4655,56 +4662,53 @@ class CompactionStats PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(CompactionStats* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline CompactionStats* New() const final {
-    return CreateMaybeMessage<CompactionStats>(nullptr);
-  }
-
-  CompactionStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  CompactionStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<CompactionStats>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const CompactionStats& from);
-  void MergeFrom(const CompactionStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CompactionStats& from) {
+    CompactionStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(CompactionStats* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.CompactionStats";
   }
   protected:
-  explicit CompactionStats(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit CompactionStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -4719,29 +4723,29 @@ class CompactionStats PROTOBUF_FINAL :
   };
   // uint64 total_compactions = 1;
   void clear_total_compactions();
-  ::PROTOBUF_NAMESPACE_ID::uint64 total_compactions() const;
-  void set_total_compactions(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t total_compactions() const;
+  void set_total_compactions(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_total_compactions() const;
-  void _internal_set_total_compactions(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_total_compactions() const;
+  void _internal_set_total_compactions(uint64_t value);
   public:
 
   // uint64 bytes_read = 2;
   void clear_bytes_read();
-  ::PROTOBUF_NAMESPACE_ID::uint64 bytes_read() const;
-  void set_bytes_read(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t bytes_read() const;
+  void set_bytes_read(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_bytes_read() const;
-  void _internal_set_bytes_read(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_bytes_read() const;
+  void _internal_set_bytes_read(uint64_t value);
   public:
 
   // uint64 bytes_written = 3;
   void clear_bytes_written();
-  ::PROTOBUF_NAMESPACE_ID::uint64 bytes_written() const;
-  void set_bytes_written(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t bytes_written() const;
+  void set_bytes_written(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_bytes_written() const;
-  void _internal_set_bytes_written(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_bytes_written() const;
+  void _internal_set_bytes_written(uint64_t value);
   public:
 
   // double write_amplification = 4;
@@ -4755,11 +4759,11 @@ class CompactionStats PROTOBUF_FINAL :
 
   // uint64 total_time_ms = 5;
   void clear_total_time_ms();
-  ::PROTOBUF_NAMESPACE_ID::uint64 total_time_ms() const;
-  void set_total_time_ms(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t total_time_ms() const;
+  void set_total_time_ms(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_total_time_ms() const;
-  void _internal_set_total_time_ms(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_total_time_ms() const;
+  void _internal_set_total_time_ms(uint64_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:kvdb.CompactionStats)
@@ -4769,21 +4773,25 @@ class CompactionStats PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 total_compactions_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 bytes_read_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 bytes_written_;
-  double write_amplification_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 total_time_ms_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    uint64_t total_compactions_;
+    uint64_t bytes_read_;
+    uint64_t bytes_written_;
+    double write_amplification_;
+    uint64_t total_time_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SetCompactionStrategyRequest PROTOBUF_FINAL :
+class SetCompactionStrategyRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.SetCompactionStrategyRequest) */ {
  public:
-  inline SetCompactionStrategyRequest() : SetCompactionStrategyRequest(nullptr) {};
-  virtual ~SetCompactionStrategyRequest();
+  inline SetCompactionStrategyRequest() : SetCompactionStrategyRequest(nullptr) {}
+  ~SetCompactionStrategyRequest() override;
+  explicit PROTOBUF_CONSTEXPR SetCompactionStrategyRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SetCompactionStrategyRequest(const SetCompactionStrategyRequest& from);
   SetCompactionStrategyRequest(SetCompactionStrategyRequest&& from) noexcept
@@ -4796,8 +4804,13 @@ class SetCompactionStrategyRequest PROTOBUF_FINAL :
     return *this;
   }
   inline SetCompactionStrategyRequest& operator=(SetCompactionStrategyRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -4808,14 +4821,14 @@ class SetCompactionStrategyRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetCompactionStrategyRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const SetCompactionStrategyRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const SetCompactionStrategyRequest* internal_default_instance() {
     return reinterpret_cast<const SetCompactionStrategyRequest*>(
                &_SetCompactionStrategyRequest_default_instance_);
@@ -4828,7 +4841,12 @@ class SetCompactionStrategyRequest PROTOBUF_FINAL :
   }
   inline void Swap(SetCompactionStrategyRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -4836,56 +4854,53 @@ class SetCompactionStrategyRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(SetCompactionStrategyRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline SetCompactionStrategyRequest* New() const final {
-    return CreateMaybeMessage<SetCompactionStrategyRequest>(nullptr);
-  }
-
-  SetCompactionStrategyRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  SetCompactionStrategyRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SetCompactionStrategyRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SetCompactionStrategyRequest& from);
-  void MergeFrom(const SetCompactionStrategyRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetCompactionStrategyRequest& from) {
+    SetCompactionStrategyRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SetCompactionStrategyRequest* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.SetCompactionStrategyRequest";
   }
   protected:
-  explicit SetCompactionStrategyRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit SetCompactionStrategyRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -4910,17 +4925,21 @@ class SetCompactionStrategyRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  int strategy_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    int strategy_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SetCompactionStrategyResponse PROTOBUF_FINAL :
+class SetCompactionStrategyResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.SetCompactionStrategyResponse) */ {
  public:
-  inline SetCompactionStrategyResponse() : SetCompactionStrategyResponse(nullptr) {};
-  virtual ~SetCompactionStrategyResponse();
+  inline SetCompactionStrategyResponse() : SetCompactionStrategyResponse(nullptr) {}
+  ~SetCompactionStrategyResponse() override;
+  explicit PROTOBUF_CONSTEXPR SetCompactionStrategyResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SetCompactionStrategyResponse(const SetCompactionStrategyResponse& from);
   SetCompactionStrategyResponse(SetCompactionStrategyResponse&& from) noexcept
@@ -4933,8 +4952,13 @@ class SetCompactionStrategyResponse PROTOBUF_FINAL :
     return *this;
   }
   inline SetCompactionStrategyResponse& operator=(SetCompactionStrategyResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -4945,14 +4969,14 @@ class SetCompactionStrategyResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetCompactionStrategyResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const SetCompactionStrategyResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const SetCompactionStrategyResponse* internal_default_instance() {
     return reinterpret_cast<const SetCompactionStrategyResponse*>(
                &_SetCompactionStrategyResponse_default_instance_);
@@ -4965,7 +4989,12 @@ class SetCompactionStrategyResponse PROTOBUF_FINAL :
   }
   inline void Swap(SetCompactionStrategyResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -4973,56 +5002,53 @@ class SetCompactionStrategyResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(SetCompactionStrategyResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline SetCompactionStrategyResponse* New() const final {
-    return CreateMaybeMessage<SetCompactionStrategyResponse>(nullptr);
-  }
-
-  SetCompactionStrategyResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  SetCompactionStrategyResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SetCompactionStrategyResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SetCompactionStrategyResponse& from);
-  void MergeFrom(const SetCompactionStrategyResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetCompactionStrategyResponse& from) {
+    SetCompactionStrategyResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SetCompactionStrategyResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.SetCompactionStrategyResponse";
   }
   protected:
-  explicit SetCompactionStrategyResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit SetCompactionStrategyResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -5035,25 +5061,14 @@ class SetCompactionStrategyResponse PROTOBUF_FINAL :
   // string error_message = 2;
   void clear_error_message();
   const std::string& error_message() const;
-  void set_error_message(const std::string& value);
-  void set_error_message(std::string&& value);
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_error_message();
-  std::string* release_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
   void set_allocated_error_message(std::string* error_message);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_error_message();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_error_message(
-      std::string* error_message);
   private:
   const std::string& _internal_error_message() const;
-  void _internal_set_error_message(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
   std::string* _internal_mutable_error_message();
   public:
 
@@ -5073,18 +5088,22 @@ class SetCompactionStrategyResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
-  bool success_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SubscribeRequest PROTOBUF_FINAL :
+class SubscribeRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.SubscribeRequest) */ {
  public:
-  inline SubscribeRequest() : SubscribeRequest(nullptr) {};
-  virtual ~SubscribeRequest();
+  inline SubscribeRequest() : SubscribeRequest(nullptr) {}
+  ~SubscribeRequest() override;
+  explicit PROTOBUF_CONSTEXPR SubscribeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SubscribeRequest(const SubscribeRequest& from);
   SubscribeRequest(SubscribeRequest&& from) noexcept
@@ -5097,8 +5116,13 @@ class SubscribeRequest PROTOBUF_FINAL :
     return *this;
   }
   inline SubscribeRequest& operator=(SubscribeRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -5109,14 +5133,14 @@ class SubscribeRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SubscribeRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const SubscribeRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const SubscribeRequest* internal_default_instance() {
     return reinterpret_cast<const SubscribeRequest*>(
                &_SubscribeRequest_default_instance_);
@@ -5129,7 +5153,12 @@ class SubscribeRequest PROTOBUF_FINAL :
   }
   inline void Swap(SubscribeRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -5137,56 +5166,53 @@ class SubscribeRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(SubscribeRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline SubscribeRequest* New() const final {
-    return CreateMaybeMessage<SubscribeRequest>(nullptr);
-  }
-
-  SubscribeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  SubscribeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SubscribeRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SubscribeRequest& from);
-  void MergeFrom(const SubscribeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SubscribeRequest& from) {
+    SubscribeRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SubscribeRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.SubscribeRequest";
   }
   protected:
-  explicit SubscribeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit SubscribeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -5199,25 +5225,14 @@ class SubscribeRequest PROTOBUF_FINAL :
   // string key_pattern = 1;
   void clear_key_pattern();
   const std::string& key_pattern() const;
-  void set_key_pattern(const std::string& value);
-  void set_key_pattern(std::string&& value);
-  void set_key_pattern(const char* value);
-  void set_key_pattern(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key_pattern(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key_pattern();
-  std::string* release_key_pattern();
+  PROTOBUF_NODISCARD std::string* release_key_pattern();
   void set_allocated_key_pattern(std::string* key_pattern);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_key_pattern();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_key_pattern(
-      std::string* key_pattern);
   private:
   const std::string& _internal_key_pattern() const;
-  void _internal_set_key_pattern(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key_pattern(const std::string& value);
   std::string* _internal_mutable_key_pattern();
   public:
 
@@ -5237,18 +5252,22 @@ class SubscribeRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_pattern_;
-  bool include_deletes_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_pattern_;
+    bool include_deletes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SubscribeResponse PROTOBUF_FINAL :
+class SubscribeResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvdb.SubscribeResponse) */ {
  public:
-  inline SubscribeResponse() : SubscribeResponse(nullptr) {};
-  virtual ~SubscribeResponse();
+  inline SubscribeResponse() : SubscribeResponse(nullptr) {}
+  ~SubscribeResponse() override;
+  explicit PROTOBUF_CONSTEXPR SubscribeResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SubscribeResponse(const SubscribeResponse& from);
   SubscribeResponse(SubscribeResponse&& from) noexcept
@@ -5261,8 +5280,13 @@ class SubscribeResponse PROTOBUF_FINAL :
     return *this;
   }
   inline SubscribeResponse& operator=(SubscribeResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -5273,14 +5297,14 @@ class SubscribeResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SubscribeResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const SubscribeResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const SubscribeResponse* internal_default_instance() {
     return reinterpret_cast<const SubscribeResponse*>(
                &_SubscribeResponse_default_instance_);
@@ -5293,7 +5317,12 @@ class SubscribeResponse PROTOBUF_FINAL :
   }
   inline void Swap(SubscribeResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -5301,56 +5330,53 @@ class SubscribeResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(SubscribeResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline SubscribeResponse* New() const final {
-    return CreateMaybeMessage<SubscribeResponse>(nullptr);
-  }
-
-  SubscribeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  SubscribeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SubscribeResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SubscribeResponse& from);
-  void MergeFrom(const SubscribeResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SubscribeResponse& from) {
+    SubscribeResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SubscribeResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kvdb.SubscribeResponse";
   }
   protected:
-  explicit SubscribeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit SubscribeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_proto_2fkvdb_2eproto);
-    return ::descriptor_table_proto_2fkvdb_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -5361,89 +5387,66 @@ class SubscribeResponse PROTOBUF_FINAL :
     kValueFieldNumber = 2,
     kOperationFieldNumber = 3,
     kTimestampFieldNumber = 4,
+    kDroppedEventsFieldNumber = 5,
   };
   // string key = 1;
   void clear_key();
   const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key();
-  std::string* release_key();
+  PROTOBUF_NODISCARD std::string* release_key();
   void set_allocated_key(std::string* key);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_key();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_key(
-      std::string* key);
   private:
   const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
   std::string* _internal_mutable_key();
   public:
 
   // string value = 2;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_value();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_value(
-      std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
   // string operation = 3;
   void clear_operation();
   const std::string& operation() const;
-  void set_operation(const std::string& value);
-  void set_operation(std::string&& value);
-  void set_operation(const char* value);
-  void set_operation(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_operation(ArgT0&& arg0, ArgT... args);
   std::string* mutable_operation();
-  std::string* release_operation();
+  PROTOBUF_NODISCARD std::string* release_operation();
   void set_allocated_operation(std::string* operation);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_operation();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_operation(
-      std::string* operation);
   private:
   const std::string& _internal_operation() const;
-  void _internal_set_operation(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_operation(const std::string& value);
   std::string* _internal_mutable_operation();
   public:
 
   // uint64 timestamp = 4;
   void clear_timestamp();
-  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp() const;
-  void set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
+
+  // uint64 dropped_events = 5;
+  void clear_dropped_events();
+  uint64_t dropped_events() const;
+  void set_dropped_events(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_timestamp() const;
-  void _internal_set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_dropped_events() const;
+  void _internal_set_dropped_events(uint64_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:kvdb.SubscribeResponse)
@@ -5453,12 +5456,16 @@ class SubscribeResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr operation_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_proto_2fkvdb_2eproto;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr operation_;
+    uint64_t timestamp_;
+    uint64_t dropped_events_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
 };
 // ===================================================================
 
@@ -5473,54 +5480,38 @@ class SubscribeResponse PROTOBUF_FINAL :
 
 // string key = 1;
 inline void PutRequest::clear_key() {
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.key_.ClearToEmpty();
 }
 inline const std::string& PutRequest::key() const {
   // @@protoc_insertion_point(field_get:kvdb.PutRequest.key)
   return _internal_key();
 }
-inline void PutRequest::set_key(const std::string& value) {
-  _internal_set_key(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.PutRequest.key)
 }
 inline std::string* PutRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
   // @@protoc_insertion_point(field_mutable:kvdb.PutRequest.key)
-  return _internal_mutable_key();
+  return _s;
 }
 inline const std::string& PutRequest::_internal_key() const {
-  return key_.Get();
+  return _impl_.key_.Get();
 }
 inline void PutRequest::_internal_set_key(const std::string& value) {
   
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void PutRequest::set_key(std::string&& value) {
-  
-  key_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.PutRequest.key)
-}
-inline void PutRequest::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.PutRequest.key)
-}
-inline void PutRequest::set_key(const char* value,
-    size_t size) {
-  
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.PutRequest.key)
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
 inline std::string* PutRequest::_internal_mutable_key() {
   
-  return key_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PutRequest::release_key() {
   // @@protoc_insertion_point(field_release:kvdb.PutRequest.key)
-  return key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Release();
 }
 inline void PutRequest::set_allocated_key(std::string* key) {
   if (key != nullptr) {
@@ -5528,80 +5519,49 @@ inline void PutRequest::set_allocated_key(std::string* key) {
   } else {
     
   }
-  key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.PutRequest.key)
-}
-inline std::string* PutRequest::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.PutRequest.key)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return key_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void PutRequest::unsafe_arena_set_allocated_key(
-    std::string* key) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (key != nullptr) {
-    
-  } else {
-    
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
   }
-  key_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      key, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.PutRequest.key)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.PutRequest.key)
 }
 
 // string value = 2;
 inline void PutRequest::clear_value() {
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.value_.ClearToEmpty();
 }
 inline const std::string& PutRequest::value() const {
   // @@protoc_insertion_point(field_get:kvdb.PutRequest.value)
   return _internal_value();
 }
-inline void PutRequest::set_value(const std::string& value) {
-  _internal_set_value(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutRequest::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.PutRequest.value)
 }
 inline std::string* PutRequest::mutable_value() {
+  std::string* _s = _internal_mutable_value();
   // @@protoc_insertion_point(field_mutable:kvdb.PutRequest.value)
-  return _internal_mutable_value();
+  return _s;
 }
 inline const std::string& PutRequest::_internal_value() const {
-  return value_.Get();
+  return _impl_.value_.Get();
 }
 inline void PutRequest::_internal_set_value(const std::string& value) {
   
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void PutRequest::set_value(std::string&& value) {
-  
-  value_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.PutRequest.value)
-}
-inline void PutRequest::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.PutRequest.value)
-}
-inline void PutRequest::set_value(const char* value,
-    size_t size) {
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.PutRequest.value)
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
 inline std::string* PutRequest::_internal_mutable_value() {
   
-  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PutRequest::release_value() {
   // @@protoc_insertion_point(field_release:kvdb.PutRequest.value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Release();
 }
 inline void PutRequest::set_allocated_value(std::string* value) {
   if (value != nullptr) {
@@ -5609,28 +5569,13 @@ inline void PutRequest::set_allocated_value(std::string* value) {
   } else {
     
   }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.PutRequest.value)
-}
-inline std::string* PutRequest::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.PutRequest.value)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void PutRequest::unsafe_arena_set_allocated_value(
-    std::string* value) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (value != nullptr) {
-    
-  } else {
-    
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
   }
-  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.PutRequest.value)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.PutRequest.value)
 }
 
 // -------------------------------------------------------------------
@@ -5639,10 +5584,10 @@ inline void PutRequest::unsafe_arena_set_allocated_value(
 
 // bool success = 1;
 inline void PutResponse::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
 }
 inline bool PutResponse::_internal_success() const {
-  return success_;
+  return _impl_.success_;
 }
 inline bool PutResponse::success() const {
   // @@protoc_insertion_point(field_get:kvdb.PutResponse.success)
@@ -5650,7 +5595,7 @@ inline bool PutResponse::success() const {
 }
 inline void PutResponse::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
 }
 inline void PutResponse::set_success(bool value) {
   _internal_set_success(value);
@@ -5659,54 +5604,38 @@ inline void PutResponse::set_success(bool value) {
 
 // string error_message = 2;
 inline void PutResponse::clear_error_message() {
-  error_message_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.error_message_.ClearToEmpty();
 }
 inline const std::string& PutResponse::error_message() const {
   // @@protoc_insertion_point(field_get:kvdb.PutResponse.error_message)
   return _internal_error_message();
 }
-inline void PutResponse::set_error_message(const std::string& value) {
-  _internal_set_error_message(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutResponse::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.PutResponse.error_message)
 }
 inline std::string* PutResponse::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
   // @@protoc_insertion_point(field_mutable:kvdb.PutResponse.error_message)
-  return _internal_mutable_error_message();
+  return _s;
 }
 inline const std::string& PutResponse::_internal_error_message() const {
-  return error_message_.Get();
+  return _impl_.error_message_.Get();
 }
 inline void PutResponse::_internal_set_error_message(const std::string& value) {
   
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void PutResponse::set_error_message(std::string&& value) {
-  
-  error_message_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.PutResponse.error_message)
-}
-inline void PutResponse::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.PutResponse.error_message)
-}
-inline void PutResponse::set_error_message(const char* value,
-    size_t size) {
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.PutResponse.error_message)
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
 inline std::string* PutResponse::_internal_mutable_error_message() {
   
-  return error_message_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PutResponse::release_error_message() {
   // @@protoc_insertion_point(field_release:kvdb.PutResponse.error_message)
-  return error_message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Release();
 }
 inline void PutResponse::set_allocated_error_message(std::string* error_message) {
   if (error_message != nullptr) {
@@ -5714,28 +5643,13 @@ inline void PutResponse::set_allocated_error_message(std::string* error_message)
   } else {
     
   }
-  error_message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), error_message,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.PutResponse.error_message)
-}
-inline std::string* PutResponse::unsafe_arena_release_error_message() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.PutResponse.error_message)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return error_message_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void PutResponse::unsafe_arena_set_allocated_error_message(
-    std::string* error_message) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (error_message != nullptr) {
-    
-  } else {
-    
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
   }
-  error_message_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      error_message, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.PutResponse.error_message)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.PutResponse.error_message)
 }
 
 // -------------------------------------------------------------------
@@ -5744,54 +5658,38 @@ inline void PutResponse::unsafe_arena_set_allocated_error_message(
 
 // string key = 1;
 inline void GetRequest::clear_key() {
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.key_.ClearToEmpty();
 }
 inline const std::string& GetRequest::key() const {
   // @@protoc_insertion_point(field_get:kvdb.GetRequest.key)
   return _internal_key();
 }
-inline void GetRequest::set_key(const std::string& value) {
-  _internal_set_key(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.GetRequest.key)
 }
 inline std::string* GetRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
   // @@protoc_insertion_point(field_mutable:kvdb.GetRequest.key)
-  return _internal_mutable_key();
+  return _s;
 }
 inline const std::string& GetRequest::_internal_key() const {
-  return key_.Get();
+  return _impl_.key_.Get();
 }
 inline void GetRequest::_internal_set_key(const std::string& value) {
   
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void GetRequest::set_key(std::string&& value) {
-  
-  key_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.GetRequest.key)
-}
-inline void GetRequest::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.GetRequest.key)
-}
-inline void GetRequest::set_key(const char* value,
-    size_t size) {
-  
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.GetRequest.key)
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GetRequest::_internal_mutable_key() {
   
-  return key_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GetRequest::release_key() {
   // @@protoc_insertion_point(field_release:kvdb.GetRequest.key)
-  return key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Release();
 }
 inline void GetRequest::set_allocated_key(std::string* key) {
   if (key != nullptr) {
@@ -5799,28 +5697,13 @@ inline void GetRequest::set_allocated_key(std::string* key) {
   } else {
     
   }
-  key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.GetRequest.key)
-}
-inline std::string* GetRequest::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.GetRequest.key)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return key_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void GetRequest::unsafe_arena_set_allocated_key(
-    std::string* key) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (key != nullptr) {
-    
-  } else {
-    
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
   }
-  key_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      key, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.GetRequest.key)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.GetRequest.key)
 }
 
 // -------------------------------------------------------------------
@@ -5829,10 +5712,10 @@ inline void GetRequest::unsafe_arena_set_allocated_key(
 
 // bool found = 1;
 inline void GetResponse::clear_found() {
-  found_ = false;
+  _impl_.found_ = false;
 }
 inline bool GetResponse::_internal_found() const {
-  return found_;
+  return _impl_.found_;
 }
 inline bool GetResponse::found() const {
   // @@protoc_insertion_point(field_get:kvdb.GetResponse.found)
@@ -5840,7 +5723,7 @@ inline bool GetResponse::found() const {
 }
 inline void GetResponse::_internal_set_found(bool value) {
   
-  found_ = value;
+  _impl_.found_ = value;
 }
 inline void GetResponse::set_found(bool value) {
   _internal_set_found(value);
@@ -5849,54 +5732,38 @@ inline void GetResponse::set_found(bool value) {
 
 // string value = 2;
 inline void GetResponse::clear_value() {
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.value_.ClearToEmpty();
 }
 inline const std::string& GetResponse::value() const {
   // @@protoc_insertion_point(field_get:kvdb.GetResponse.value)
   return _internal_value();
 }
-inline void GetResponse::set_value(const std::string& value) {
-  _internal_set_value(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetResponse::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.GetResponse.value)
 }
 inline std::string* GetResponse::mutable_value() {
+  std::string* _s = _internal_mutable_value();
   // @@protoc_insertion_point(field_mutable:kvdb.GetResponse.value)
-  return _internal_mutable_value();
+  return _s;
 }
 inline const std::string& GetResponse::_internal_value() const {
-  return value_.Get();
+  return _impl_.value_.Get();
 }
 inline void GetResponse::_internal_set_value(const std::string& value) {
   
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void GetResponse::set_value(std::string&& value) {
-  
-  value_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.GetResponse.value)
-}
-inline void GetResponse::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.GetResponse.value)
-}
-inline void GetResponse::set_value(const char* value,
-    size_t size) {
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.GetResponse.value)
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GetResponse::_internal_mutable_value() {
   
-  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GetResponse::release_value() {
   // @@protoc_insertion_point(field_release:kvdb.GetResponse.value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Release();
 }
 inline void GetResponse::set_allocated_value(std::string* value) {
   if (value != nullptr) {
@@ -5904,80 +5771,49 @@ inline void GetResponse::set_allocated_value(std::string* value) {
   } else {
     
   }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.GetResponse.value)
-}
-inline std::string* GetResponse::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.GetResponse.value)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void GetResponse::unsafe_arena_set_allocated_value(
-    std::string* value) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (value != nullptr) {
-    
-  } else {
-    
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
   }
-  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.GetResponse.value)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.GetResponse.value)
 }
 
 // string error_message = 3;
 inline void GetResponse::clear_error_message() {
-  error_message_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.error_message_.ClearToEmpty();
 }
 inline const std::string& GetResponse::error_message() const {
   // @@protoc_insertion_point(field_get:kvdb.GetResponse.error_message)
   return _internal_error_message();
 }
-inline void GetResponse::set_error_message(const std::string& value) {
-  _internal_set_error_message(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetResponse::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.GetResponse.error_message)
 }
 inline std::string* GetResponse::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
   // @@protoc_insertion_point(field_mutable:kvdb.GetResponse.error_message)
-  return _internal_mutable_error_message();
+  return _s;
 }
 inline const std::string& GetResponse::_internal_error_message() const {
-  return error_message_.Get();
+  return _impl_.error_message_.Get();
 }
 inline void GetResponse::_internal_set_error_message(const std::string& value) {
   
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void GetResponse::set_error_message(std::string&& value) {
-  
-  error_message_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.GetResponse.error_message)
-}
-inline void GetResponse::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.GetResponse.error_message)
-}
-inline void GetResponse::set_error_message(const char* value,
-    size_t size) {
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.GetResponse.error_message)
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GetResponse::_internal_mutable_error_message() {
   
-  return error_message_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GetResponse::release_error_message() {
   // @@protoc_insertion_point(field_release:kvdb.GetResponse.error_message)
-  return error_message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Release();
 }
 inline void GetResponse::set_allocated_error_message(std::string* error_message) {
   if (error_message != nullptr) {
@@ -5985,28 +5821,13 @@ inline void GetResponse::set_allocated_error_message(std::string* error_message)
   } else {
     
   }
-  error_message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), error_message,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.GetResponse.error_message)
-}
-inline std::string* GetResponse::unsafe_arena_release_error_message() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.GetResponse.error_message)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return error_message_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void GetResponse::unsafe_arena_set_allocated_error_message(
-    std::string* error_message) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (error_message != nullptr) {
-    
-  } else {
-    
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
   }
-  error_message_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      error_message, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.GetResponse.error_message)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.GetResponse.error_message)
 }
 
 // -------------------------------------------------------------------
@@ -6015,54 +5836,38 @@ inline void GetResponse::unsafe_arena_set_allocated_error_message(
 
 // string key = 1;
 inline void DeleteRequest::clear_key() {
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.key_.ClearToEmpty();
 }
 inline const std::string& DeleteRequest::key() const {
   // @@protoc_insertion_point(field_get:kvdb.DeleteRequest.key)
   return _internal_key();
 }
-inline void DeleteRequest::set_key(const std::string& value) {
-  _internal_set_key(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeleteRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.DeleteRequest.key)
 }
 inline std::string* DeleteRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
   // @@protoc_insertion_point(field_mutable:kvdb.DeleteRequest.key)
-  return _internal_mutable_key();
+  return _s;
 }
 inline const std::string& DeleteRequest::_internal_key() const {
-  return key_.Get();
+  return _impl_.key_.Get();
 }
 inline void DeleteRequest::_internal_set_key(const std::string& value) {
   
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void DeleteRequest::set_key(std::string&& value) {
-  
-  key_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.DeleteRequest.key)
-}
-inline void DeleteRequest::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.DeleteRequest.key)
-}
-inline void DeleteRequest::set_key(const char* value,
-    size_t size) {
-  
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.DeleteRequest.key)
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
 inline std::string* DeleteRequest::_internal_mutable_key() {
   
-  return key_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
 inline std::string* DeleteRequest::release_key() {
   // @@protoc_insertion_point(field_release:kvdb.DeleteRequest.key)
-  return key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Release();
 }
 inline void DeleteRequest::set_allocated_key(std::string* key) {
   if (key != nullptr) {
@@ -6070,28 +5875,13 @@ inline void DeleteRequest::set_allocated_key(std::string* key) {
   } else {
     
   }
-  key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.DeleteRequest.key)
-}
-inline std::string* DeleteRequest::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.DeleteRequest.key)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return key_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void DeleteRequest::unsafe_arena_set_allocated_key(
-    std::string* key) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (key != nullptr) {
-    
-  } else {
-    
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
   }
-  key_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      key, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.DeleteRequest.key)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.DeleteRequest.key)
 }
 
 // -------------------------------------------------------------------
@@ -6100,10 +5890,10 @@ inline void DeleteRequest::unsafe_arena_set_allocated_key(
 
 // bool success = 1;
 inline void DeleteResponse::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
 }
 inline bool DeleteResponse::_internal_success() const {
-  return success_;
+  return _impl_.success_;
 }
 inline bool DeleteResponse::success() const {
   // @@protoc_insertion_point(field_get:kvdb.DeleteResponse.success)
@@ -6111,7 +5901,7 @@ inline bool DeleteResponse::success() const {
 }
 inline void DeleteResponse::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
 }
 inline void DeleteResponse::set_success(bool value) {
   _internal_set_success(value);
@@ -6120,54 +5910,38 @@ inline void DeleteResponse::set_success(bool value) {
 
 // string error_message = 2;
 inline void DeleteResponse::clear_error_message() {
-  error_message_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.error_message_.ClearToEmpty();
 }
 inline const std::string& DeleteResponse::error_message() const {
   // @@protoc_insertion_point(field_get:kvdb.DeleteResponse.error_message)
   return _internal_error_message();
 }
-inline void DeleteResponse::set_error_message(const std::string& value) {
-  _internal_set_error_message(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeleteResponse::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.DeleteResponse.error_message)
 }
 inline std::string* DeleteResponse::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
   // @@protoc_insertion_point(field_mutable:kvdb.DeleteResponse.error_message)
-  return _internal_mutable_error_message();
+  return _s;
 }
 inline const std::string& DeleteResponse::_internal_error_message() const {
-  return error_message_.Get();
+  return _impl_.error_message_.Get();
 }
 inline void DeleteResponse::_internal_set_error_message(const std::string& value) {
   
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void DeleteResponse::set_error_message(std::string&& value) {
-  
-  error_message_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.DeleteResponse.error_message)
-}
-inline void DeleteResponse::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.DeleteResponse.error_message)
-}
-inline void DeleteResponse::set_error_message(const char* value,
-    size_t size) {
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.DeleteResponse.error_message)
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
 inline std::string* DeleteResponse::_internal_mutable_error_message() {
   
-  return error_message_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* DeleteResponse::release_error_message() {
   // @@protoc_insertion_point(field_release:kvdb.DeleteResponse.error_message)
-  return error_message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Release();
 }
 inline void DeleteResponse::set_allocated_error_message(std::string* error_message) {
   if (error_message != nullptr) {
@@ -6175,28 +5949,13 @@ inline void DeleteResponse::set_allocated_error_message(std::string* error_messa
   } else {
     
   }
-  error_message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), error_message,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.DeleteResponse.error_message)
-}
-inline std::string* DeleteResponse::unsafe_arena_release_error_message() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.DeleteResponse.error_message)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return error_message_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void DeleteResponse::unsafe_arena_set_allocated_error_message(
-    std::string* error_message) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (error_message != nullptr) {
-    
-  } else {
-    
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
   }
-  error_message_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      error_message, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.DeleteResponse.error_message)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.DeleteResponse.error_message)
 }
 
 // -------------------------------------------------------------------
@@ -6205,54 +5964,38 @@ inline void DeleteResponse::unsafe_arena_set_allocated_error_message(
 
 // string key = 1;
 inline void KeyValue::clear_key() {
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.key_.ClearToEmpty();
 }
 inline const std::string& KeyValue::key() const {
   // @@protoc_insertion_point(field_get:kvdb.KeyValue.key)
   return _internal_key();
 }
-inline void KeyValue::set_key(const std::string& value) {
-  _internal_set_key(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyValue::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.KeyValue.key)
 }
 inline std::string* KeyValue::mutable_key() {
+  std::string* _s = _internal_mutable_key();
   // @@protoc_insertion_point(field_mutable:kvdb.KeyValue.key)
-  return _internal_mutable_key();
+  return _s;
 }
 inline const std::string& KeyValue::_internal_key() const {
-  return key_.Get();
+  return _impl_.key_.Get();
 }
 inline void KeyValue::_internal_set_key(const std::string& value) {
   
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void KeyValue::set_key(std::string&& value) {
-  
-  key_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.KeyValue.key)
-}
-inline void KeyValue::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.KeyValue.key)
-}
-inline void KeyValue::set_key(const char* value,
-    size_t size) {
-  
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.KeyValue.key)
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
 inline std::string* KeyValue::_internal_mutable_key() {
   
-  return key_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
 inline std::string* KeyValue::release_key() {
   // @@protoc_insertion_point(field_release:kvdb.KeyValue.key)
-  return key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Release();
 }
 inline void KeyValue::set_allocated_key(std::string* key) {
   if (key != nullptr) {
@@ -6260,80 +6003,49 @@ inline void KeyValue::set_allocated_key(std::string* key) {
   } else {
     
   }
-  key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.KeyValue.key)
-}
-inline std::string* KeyValue::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.KeyValue.key)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return key_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void KeyValue::unsafe_arena_set_allocated_key(
-    std::string* key) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (key != nullptr) {
-    
-  } else {
-    
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
   }
-  key_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      key, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.KeyValue.key)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.KeyValue.key)
 }
 
 // string value = 2;
 inline void KeyValue::clear_value() {
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.value_.ClearToEmpty();
 }
 inline const std::string& KeyValue::value() const {
   // @@protoc_insertion_point(field_get:kvdb.KeyValue.value)
   return _internal_value();
 }
-inline void KeyValue::set_value(const std::string& value) {
-  _internal_set_value(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeyValue::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.KeyValue.value)
 }
 inline std::string* KeyValue::mutable_value() {
+  std::string* _s = _internal_mutable_value();
   // @@protoc_insertion_point(field_mutable:kvdb.KeyValue.value)
-  return _internal_mutable_value();
+  return _s;
 }
 inline const std::string& KeyValue::_internal_value() const {
-  return value_.Get();
+  return _impl_.value_.Get();
 }
 inline void KeyValue::_internal_set_value(const std::string& value) {
   
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void KeyValue::set_value(std::string&& value) {
-  
-  value_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.KeyValue.value)
-}
-inline void KeyValue::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.KeyValue.value)
-}
-inline void KeyValue::set_value(const char* value,
-    size_t size) {
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.KeyValue.value)
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
 inline std::string* KeyValue::_internal_mutable_value() {
   
-  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
 inline std::string* KeyValue::release_value() {
   // @@protoc_insertion_point(field_release:kvdb.KeyValue.value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Release();
 }
 inline void KeyValue::set_allocated_value(std::string* value) {
   if (value != nullptr) {
@@ -6341,28 +6053,13 @@ inline void KeyValue::set_allocated_value(std::string* value) {
   } else {
     
   }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.KeyValue.value)
-}
-inline std::string* KeyValue::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.KeyValue.value)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void KeyValue::unsafe_arena_set_allocated_value(
-    std::string* value) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (value != nullptr) {
-    
-  } else {
-    
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
   }
-  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.KeyValue.value)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.KeyValue.value)
 }
 
 // -------------------------------------------------------------------
@@ -6371,41 +6068,42 @@ inline void KeyValue::unsafe_arena_set_allocated_value(
 
 // repeated .kvdb.KeyValue pairs = 1;
 inline int BatchPutRequest::_internal_pairs_size() const {
-  return pairs_.size();
+  return _impl_.pairs_.size();
 }
 inline int BatchPutRequest::pairs_size() const {
   return _internal_pairs_size();
 }
 inline void BatchPutRequest::clear_pairs() {
-  pairs_.Clear();
+  _impl_.pairs_.Clear();
 }
 inline ::kvdb::KeyValue* BatchPutRequest::mutable_pairs(int index) {
   // @@protoc_insertion_point(field_mutable:kvdb.BatchPutRequest.pairs)
-  return pairs_.Mutable(index);
+  return _impl_.pairs_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvdb::KeyValue >*
 BatchPutRequest::mutable_pairs() {
   // @@protoc_insertion_point(field_mutable_list:kvdb.BatchPutRequest.pairs)
-  return &pairs_;
+  return &_impl_.pairs_;
 }
 inline const ::kvdb::KeyValue& BatchPutRequest::_internal_pairs(int index) const {
-  return pairs_.Get(index);
+  return _impl_.pairs_.Get(index);
 }
 inline const ::kvdb::KeyValue& BatchPutRequest::pairs(int index) const {
   // @@protoc_insertion_point(field_get:kvdb.BatchPutRequest.pairs)
   return _internal_pairs(index);
 }
 inline ::kvdb::KeyValue* BatchPutRequest::_internal_add_pairs() {
-  return pairs_.Add();
+  return _impl_.pairs_.Add();
 }
 inline ::kvdb::KeyValue* BatchPutRequest::add_pairs() {
+  ::kvdb::KeyValue* _add = _internal_add_pairs();
   // @@protoc_insertion_point(field_add:kvdb.BatchPutRequest.pairs)
-  return _internal_add_pairs();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvdb::KeyValue >&
 BatchPutRequest::pairs() const {
   // @@protoc_insertion_point(field_list:kvdb.BatchPutRequest.pairs)
-  return pairs_;
+  return _impl_.pairs_;
 }
 
 // -------------------------------------------------------------------
@@ -6414,10 +6112,10 @@ BatchPutRequest::pairs() const {
 
 // bool success = 1;
 inline void BatchPutResponse::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
 }
 inline bool BatchPutResponse::_internal_success() const {
-  return success_;
+  return _impl_.success_;
 }
 inline bool BatchPutResponse::success() const {
   // @@protoc_insertion_point(field_get:kvdb.BatchPutResponse.success)
@@ -6425,7 +6123,7 @@ inline bool BatchPutResponse::success() const {
 }
 inline void BatchPutResponse::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
 }
 inline void BatchPutResponse::set_success(bool value) {
   _internal_set_success(value);
@@ -6434,74 +6132,58 @@ inline void BatchPutResponse::set_success(bool value) {
 
 // int32 processed_count = 2;
 inline void BatchPutResponse::clear_processed_count() {
-  processed_count_ = 0;
+  _impl_.processed_count_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 BatchPutResponse::_internal_processed_count() const {
-  return processed_count_;
+inline int32_t BatchPutResponse::_internal_processed_count() const {
+  return _impl_.processed_count_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 BatchPutResponse::processed_count() const {
+inline int32_t BatchPutResponse::processed_count() const {
   // @@protoc_insertion_point(field_get:kvdb.BatchPutResponse.processed_count)
   return _internal_processed_count();
 }
-inline void BatchPutResponse::_internal_set_processed_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void BatchPutResponse::_internal_set_processed_count(int32_t value) {
   
-  processed_count_ = value;
+  _impl_.processed_count_ = value;
 }
-inline void BatchPutResponse::set_processed_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void BatchPutResponse::set_processed_count(int32_t value) {
   _internal_set_processed_count(value);
   // @@protoc_insertion_point(field_set:kvdb.BatchPutResponse.processed_count)
 }
 
 // string error_message = 3;
 inline void BatchPutResponse::clear_error_message() {
-  error_message_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.error_message_.ClearToEmpty();
 }
 inline const std::string& BatchPutResponse::error_message() const {
   // @@protoc_insertion_point(field_get:kvdb.BatchPutResponse.error_message)
   return _internal_error_message();
 }
-inline void BatchPutResponse::set_error_message(const std::string& value) {
-  _internal_set_error_message(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchPutResponse::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.BatchPutResponse.error_message)
 }
 inline std::string* BatchPutResponse::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
   // @@protoc_insertion_point(field_mutable:kvdb.BatchPutResponse.error_message)
-  return _internal_mutable_error_message();
+  return _s;
 }
 inline const std::string& BatchPutResponse::_internal_error_message() const {
-  return error_message_.Get();
+  return _impl_.error_message_.Get();
 }
 inline void BatchPutResponse::_internal_set_error_message(const std::string& value) {
   
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void BatchPutResponse::set_error_message(std::string&& value) {
-  
-  error_message_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.BatchPutResponse.error_message)
-}
-inline void BatchPutResponse::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.BatchPutResponse.error_message)
-}
-inline void BatchPutResponse::set_error_message(const char* value,
-    size_t size) {
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.BatchPutResponse.error_message)
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
 inline std::string* BatchPutResponse::_internal_mutable_error_message() {
   
-  return error_message_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* BatchPutResponse::release_error_message() {
   // @@protoc_insertion_point(field_release:kvdb.BatchPutResponse.error_message)
-  return error_message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Release();
 }
 inline void BatchPutResponse::set_allocated_error_message(std::string* error_message) {
   if (error_message != nullptr) {
@@ -6509,28 +6191,13 @@ inline void BatchPutResponse::set_allocated_error_message(std::string* error_mes
   } else {
     
   }
-  error_message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), error_message,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.BatchPutResponse.error_message)
-}
-inline std::string* BatchPutResponse::unsafe_arena_release_error_message() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.BatchPutResponse.error_message)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return error_message_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void BatchPutResponse::unsafe_arena_set_allocated_error_message(
-    std::string* error_message) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (error_message != nullptr) {
-    
-  } else {
-    
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
   }
-  error_message_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      error_message, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.BatchPutResponse.error_message)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.BatchPutResponse.error_message)
 }
 
 // -------------------------------------------------------------------
@@ -6539,20 +6206,21 @@ inline void BatchPutResponse::unsafe_arena_set_allocated_error_message(
 
 // repeated string keys = 1;
 inline int BatchGetRequest::_internal_keys_size() const {
-  return keys_.size();
+  return _impl_.keys_.size();
 }
 inline int BatchGetRequest::keys_size() const {
   return _internal_keys_size();
 }
 inline void BatchGetRequest::clear_keys() {
-  keys_.Clear();
+  _impl_.keys_.Clear();
 }
 inline std::string* BatchGetRequest::add_keys() {
+  std::string* _s = _internal_add_keys();
   // @@protoc_insertion_point(field_add_mutable:kvdb.BatchGetRequest.keys)
-  return _internal_add_keys();
+  return _s;
 }
 inline const std::string& BatchGetRequest::_internal_keys(int index) const {
-  return keys_.Get(index);
+  return _impl_.keys_.Get(index);
 }
 inline const std::string& BatchGetRequest::keys(int index) const {
   // @@protoc_insertion_point(field_get:kvdb.BatchGetRequest.keys)
@@ -6560,55 +6228,55 @@ inline const std::string& BatchGetRequest::keys(int index) const {
 }
 inline std::string* BatchGetRequest::mutable_keys(int index) {
   // @@protoc_insertion_point(field_mutable:kvdb.BatchGetRequest.keys)
-  return keys_.Mutable(index);
+  return _impl_.keys_.Mutable(index);
 }
 inline void BatchGetRequest::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:kvdb.BatchGetRequest.keys)
-  keys_.Mutable(index)->assign(value);
 }
 inline void BatchGetRequest::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:kvdb.BatchGetRequest.keys)
-  keys_.Mutable(index)->assign(std::move(value));
 }
 inline void BatchGetRequest::set_keys(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  keys_.Mutable(index)->assign(value);
+  _impl_.keys_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:kvdb.BatchGetRequest.keys)
 }
 inline void BatchGetRequest::set_keys(int index, const char* value, size_t size) {
-  keys_.Mutable(index)->assign(
+  _impl_.keys_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:kvdb.BatchGetRequest.keys)
 }
 inline std::string* BatchGetRequest::_internal_add_keys() {
-  return keys_.Add();
+  return _impl_.keys_.Add();
 }
 inline void BatchGetRequest::add_keys(const std::string& value) {
-  keys_.Add()->assign(value);
+  _impl_.keys_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:kvdb.BatchGetRequest.keys)
 }
 inline void BatchGetRequest::add_keys(std::string&& value) {
-  keys_.Add(std::move(value));
+  _impl_.keys_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:kvdb.BatchGetRequest.keys)
 }
 inline void BatchGetRequest::add_keys(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  keys_.Add()->assign(value);
+  _impl_.keys_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:kvdb.BatchGetRequest.keys)
 }
 inline void BatchGetRequest::add_keys(const char* value, size_t size) {
-  keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:kvdb.BatchGetRequest.keys)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 BatchGetRequest::keys() const {
   // @@protoc_insertion_point(field_list:kvdb.BatchGetRequest.keys)
-  return keys_;
+  return _impl_.keys_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 BatchGetRequest::mutable_keys() {
   // @@protoc_insertion_point(field_mutable_list:kvdb.BatchGetRequest.keys)
-  return &keys_;
+  return &_impl_.keys_;
 }
 
 // -------------------------------------------------------------------
@@ -6617,93 +6285,78 @@ BatchGetRequest::mutable_keys() {
 
 // repeated .kvdb.KeyValue pairs = 1;
 inline int BatchGetResponse::_internal_pairs_size() const {
-  return pairs_.size();
+  return _impl_.pairs_.size();
 }
 inline int BatchGetResponse::pairs_size() const {
   return _internal_pairs_size();
 }
 inline void BatchGetResponse::clear_pairs() {
-  pairs_.Clear();
+  _impl_.pairs_.Clear();
 }
 inline ::kvdb::KeyValue* BatchGetResponse::mutable_pairs(int index) {
   // @@protoc_insertion_point(field_mutable:kvdb.BatchGetResponse.pairs)
-  return pairs_.Mutable(index);
+  return _impl_.pairs_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvdb::KeyValue >*
 BatchGetResponse::mutable_pairs() {
   // @@protoc_insertion_point(field_mutable_list:kvdb.BatchGetResponse.pairs)
-  return &pairs_;
+  return &_impl_.pairs_;
 }
 inline const ::kvdb::KeyValue& BatchGetResponse::_internal_pairs(int index) const {
-  return pairs_.Get(index);
+  return _impl_.pairs_.Get(index);
 }
 inline const ::kvdb::KeyValue& BatchGetResponse::pairs(int index) const {
   // @@protoc_insertion_point(field_get:kvdb.BatchGetResponse.pairs)
   return _internal_pairs(index);
 }
 inline ::kvdb::KeyValue* BatchGetResponse::_internal_add_pairs() {
-  return pairs_.Add();
+  return _impl_.pairs_.Add();
 }
 inline ::kvdb::KeyValue* BatchGetResponse::add_pairs() {
+  ::kvdb::KeyValue* _add = _internal_add_pairs();
   // @@protoc_insertion_point(field_add:kvdb.BatchGetResponse.pairs)
-  return _internal_add_pairs();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvdb::KeyValue >&
 BatchGetResponse::pairs() const {
   // @@protoc_insertion_point(field_list:kvdb.BatchGetResponse.pairs)
-  return pairs_;
+  return _impl_.pairs_;
 }
 
 // string error_message = 2;
 inline void BatchGetResponse::clear_error_message() {
-  error_message_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.error_message_.ClearToEmpty();
 }
 inline const std::string& BatchGetResponse::error_message() const {
   // @@protoc_insertion_point(field_get:kvdb.BatchGetResponse.error_message)
   return _internal_error_message();
 }
-inline void BatchGetResponse::set_error_message(const std::string& value) {
-  _internal_set_error_message(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchGetResponse::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.BatchGetResponse.error_message)
 }
 inline std::string* BatchGetResponse::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
   // @@protoc_insertion_point(field_mutable:kvdb.BatchGetResponse.error_message)
-  return _internal_mutable_error_message();
+  return _s;
 }
 inline const std::string& BatchGetResponse::_internal_error_message() const {
-  return error_message_.Get();
+  return _impl_.error_message_.Get();
 }
 inline void BatchGetResponse::_internal_set_error_message(const std::string& value) {
   
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void BatchGetResponse::set_error_message(std::string&& value) {
-  
-  error_message_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.BatchGetResponse.error_message)
-}
-inline void BatchGetResponse::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.BatchGetResponse.error_message)
-}
-inline void BatchGetResponse::set_error_message(const char* value,
-    size_t size) {
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.BatchGetResponse.error_message)
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
 inline std::string* BatchGetResponse::_internal_mutable_error_message() {
   
-  return error_message_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* BatchGetResponse::release_error_message() {
   // @@protoc_insertion_point(field_release:kvdb.BatchGetResponse.error_message)
-  return error_message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Release();
 }
 inline void BatchGetResponse::set_allocated_error_message(std::string* error_message) {
   if (error_message != nullptr) {
@@ -6711,28 +6364,13 @@ inline void BatchGetResponse::set_allocated_error_message(std::string* error_mes
   } else {
     
   }
-  error_message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), error_message,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.BatchGetResponse.error_message)
-}
-inline std::string* BatchGetResponse::unsafe_arena_release_error_message() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.BatchGetResponse.error_message)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return error_message_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void BatchGetResponse::unsafe_arena_set_allocated_error_message(
-    std::string* error_message) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (error_message != nullptr) {
-    
-  } else {
-    
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
   }
-  error_message_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      error_message, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.BatchGetResponse.error_message)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.BatchGetResponse.error_message)
 }
 
 // -------------------------------------------------------------------
@@ -6741,54 +6379,38 @@ inline void BatchGetResponse::unsafe_arena_set_allocated_error_message(
 
 // string start_key = 1;
 inline void ScanRequest::clear_start_key() {
-  start_key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.start_key_.ClearToEmpty();
 }
 inline const std::string& ScanRequest::start_key() const {
   // @@protoc_insertion_point(field_get:kvdb.ScanRequest.start_key)
   return _internal_start_key();
 }
-inline void ScanRequest::set_start_key(const std::string& value) {
-  _internal_set_start_key(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanRequest::set_start_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.start_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.ScanRequest.start_key)
 }
 inline std::string* ScanRequest::mutable_start_key() {
+  std::string* _s = _internal_mutable_start_key();
   // @@protoc_insertion_point(field_mutable:kvdb.ScanRequest.start_key)
-  return _internal_mutable_start_key();
+  return _s;
 }
 inline const std::string& ScanRequest::_internal_start_key() const {
-  return start_key_.Get();
+  return _impl_.start_key_.Get();
 }
 inline void ScanRequest::_internal_set_start_key(const std::string& value) {
   
-  start_key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+  _impl_.start_key_.Set(value, GetArenaForAllocation());
 }
-inline void ScanRequest::set_start_key(std::string&& value) {
+inline std::string* ScanRequest::_internal_mutable_start_key() {
   
-  start_key_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.ScanRequest.start_key)
-}
-inline void ScanRequest::set_start_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  start_key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.ScanRequest.start_key)
-}
-inline void ScanRequest::set_start_key(const char* value,
-    size_t size) {
-  
-  start_key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.ScanRequest.start_key)
-}
-inline std::string* ScanRequest::_internal_mutable_start_key() {
-  
-  return start_key_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.start_key_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ScanRequest::release_start_key() {
   // @@protoc_insertion_point(field_release:kvdb.ScanRequest.start_key)
-  return start_key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.start_key_.Release();
 }
 inline void ScanRequest::set_allocated_start_key(std::string* start_key) {
   if (start_key != nullptr) {
@@ -6796,80 +6418,49 @@ inline void ScanRequest::set_allocated_start_key(std::string* start_key) {
   } else {
     
   }
-  start_key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), start_key,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.ScanRequest.start_key)
-}
-inline std::string* ScanRequest::unsafe_arena_release_start_key() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.ScanRequest.start_key)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return start_key_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void ScanRequest::unsafe_arena_set_allocated_start_key(
-    std::string* start_key) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (start_key != nullptr) {
-    
-  } else {
-    
+  _impl_.start_key_.SetAllocated(start_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.start_key_.IsDefault()) {
+    _impl_.start_key_.Set("", GetArenaForAllocation());
   }
-  start_key_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      start_key, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.ScanRequest.start_key)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.ScanRequest.start_key)
 }
 
 // string end_key = 2;
 inline void ScanRequest::clear_end_key() {
-  end_key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.end_key_.ClearToEmpty();
 }
 inline const std::string& ScanRequest::end_key() const {
   // @@protoc_insertion_point(field_get:kvdb.ScanRequest.end_key)
   return _internal_end_key();
 }
-inline void ScanRequest::set_end_key(const std::string& value) {
-  _internal_set_end_key(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanRequest::set_end_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.end_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.ScanRequest.end_key)
 }
 inline std::string* ScanRequest::mutable_end_key() {
+  std::string* _s = _internal_mutable_end_key();
   // @@protoc_insertion_point(field_mutable:kvdb.ScanRequest.end_key)
-  return _internal_mutable_end_key();
+  return _s;
 }
 inline const std::string& ScanRequest::_internal_end_key() const {
-  return end_key_.Get();
+  return _impl_.end_key_.Get();
 }
 inline void ScanRequest::_internal_set_end_key(const std::string& value) {
   
-  end_key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void ScanRequest::set_end_key(std::string&& value) {
-  
-  end_key_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.ScanRequest.end_key)
-}
-inline void ScanRequest::set_end_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  end_key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.ScanRequest.end_key)
-}
-inline void ScanRequest::set_end_key(const char* value,
-    size_t size) {
-  
-  end_key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.ScanRequest.end_key)
+  _impl_.end_key_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ScanRequest::_internal_mutable_end_key() {
   
-  return end_key_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.end_key_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ScanRequest::release_end_key() {
   // @@protoc_insertion_point(field_release:kvdb.ScanRequest.end_key)
-  return end_key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.end_key_.Release();
 }
 inline void ScanRequest::set_allocated_end_key(std::string* end_key) {
   if (end_key != nullptr) {
@@ -6877,104 +6468,93 @@ inline void ScanRequest::set_allocated_end_key(std::string* end_key) {
   } else {
     
   }
-  end_key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), end_key,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.ScanRequest.end_key)
-}
-inline std::string* ScanRequest::unsafe_arena_release_end_key() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.ScanRequest.end_key)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return end_key_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void ScanRequest::unsafe_arena_set_allocated_end_key(
-    std::string* end_key) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (end_key != nullptr) {
-    
-  } else {
-    
+  _impl_.end_key_.SetAllocated(end_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.end_key_.IsDefault()) {
+    _impl_.end_key_.Set("", GetArenaForAllocation());
   }
-  end_key_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      end_key, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.ScanRequest.end_key)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.ScanRequest.end_key)
 }
 
 // int32 limit = 3;
 inline void ScanRequest::clear_limit() {
-  limit_ = 0;
+  _impl_.limit_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 ScanRequest::_internal_limit() const {
-  return limit_;
+inline int32_t ScanRequest::_internal_limit() const {
+  return _impl_.limit_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 ScanRequest::limit() const {
+inline int32_t ScanRequest::limit() const {
   // @@protoc_insertion_point(field_get:kvdb.ScanRequest.limit)
   return _internal_limit();
 }
-inline void ScanRequest::_internal_set_limit(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void ScanRequest::_internal_set_limit(int32_t value) {
   
-  limit_ = value;
+  _impl_.limit_ = value;
 }
-inline void ScanRequest::set_limit(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void ScanRequest::set_limit(int32_t value) {
   _internal_set_limit(value);
   // @@protoc_insertion_point(field_set:kvdb.ScanRequest.limit)
 }
 
+// uint32 batch_bytes = 4;
+inline void ScanRequest::clear_batch_bytes() {
+  _impl_.batch_bytes_ = 0u;
+}
+inline uint32_t ScanRequest::_internal_batch_bytes() const {
+  return _impl_.batch_bytes_;
+}
+inline uint32_t ScanRequest::batch_bytes() const {
+  // @@protoc_insertion_point(field_get:kvdb.ScanRequest.batch_bytes)
+  return _internal_batch_bytes();
+}
+inline void ScanRequest::_internal_set_batch_bytes(uint32_t value) {
+  
+  _impl_.batch_bytes_ = value;
+}
+inline void ScanRequest::set_batch_bytes(uint32_t value) {
+  _internal_set_batch_bytes(value);
+  // @@protoc_insertion_point(field_set:kvdb.ScanRequest.batch_bytes)
+}
+
 // -------------------------------------------------------------------
 
 // ScanResponse
 
 // string key = 1;
 inline void ScanResponse::clear_key() {
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.key_.ClearToEmpty();
 }
 inline const std::string& ScanResponse::key() const {
   // @@protoc_insertion_point(field_get:kvdb.ScanResponse.key)
   return _internal_key();
 }
-inline void ScanResponse::set_key(const std::string& value) {
-  _internal_set_key(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanResponse::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.ScanResponse.key)
 }
 inline std::string* ScanResponse::mutable_key() {
+  std::string* _s = _internal_mutable_key();
   // @@protoc_insertion_point(field_mutable:kvdb.ScanResponse.key)
-  return _internal_mutable_key();
+  return _s;
 }
 inline const std::string& ScanResponse::_internal_key() const {
-  return key_.Get();
+  return _impl_.key_.Get();
 }
 inline void ScanResponse::_internal_set_key(const std::string& value) {
   
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void ScanResponse::set_key(std::string&& value) {
-  
-  key_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.ScanResponse.key)
-}
-inline void ScanResponse::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.ScanResponse.key)
-}
-inline void ScanResponse::set_key(const char* value,
-    size_t size) {
-  
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.ScanResponse.key)
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ScanResponse::_internal_mutable_key() {
   
-  return key_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ScanResponse::release_key() {
   // @@protoc_insertion_point(field_release:kvdb.ScanResponse.key)
-  return key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Release();
 }
 inline void ScanResponse::set_allocated_key(std::string* key) {
   if (key != nullptr) {
@@ -6982,80 +6562,49 @@ inline void ScanResponse::set_allocated_key(std::string* key) {
   } else {
     
   }
-  key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.ScanResponse.key)
-}
-inline std::string* ScanResponse::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.ScanResponse.key)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return key_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void ScanResponse::unsafe_arena_set_allocated_key(
-    std::string* key) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (key != nullptr) {
-    
-  } else {
-    
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
   }
-  key_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      key, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.ScanResponse.key)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.ScanResponse.key)
 }
 
 // string value = 2;
 inline void ScanResponse::clear_value() {
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.value_.ClearToEmpty();
 }
 inline const std::string& ScanResponse::value() const {
   // @@protoc_insertion_point(field_get:kvdb.ScanResponse.value)
   return _internal_value();
 }
-inline void ScanResponse::set_value(const std::string& value) {
-  _internal_set_value(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanResponse::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.ScanResponse.value)
 }
 inline std::string* ScanResponse::mutable_value() {
+  std::string* _s = _internal_mutable_value();
   // @@protoc_insertion_point(field_mutable:kvdb.ScanResponse.value)
-  return _internal_mutable_value();
+  return _s;
 }
 inline const std::string& ScanResponse::_internal_value() const {
-  return value_.Get();
+  return _impl_.value_.Get();
 }
 inline void ScanResponse::_internal_set_value(const std::string& value) {
   
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void ScanResponse::set_value(std::string&& value) {
-  
-  value_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.ScanResponse.value)
-}
-inline void ScanResponse::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.ScanResponse.value)
-}
-inline void ScanResponse::set_value(const char* value,
-    size_t size) {
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.ScanResponse.value)
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ScanResponse::_internal_mutable_value() {
   
-  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ScanResponse::release_value() {
   // @@protoc_insertion_point(field_release:kvdb.ScanResponse.value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Release();
 }
 inline void ScanResponse::set_allocated_value(std::string* value) {
   if (value != nullptr) {
@@ -7063,28 +6612,53 @@ inline void ScanResponse::set_allocated_value(std::string* value) {
   } else {
     
   }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:kvdb.ScanResponse.value)
 }
-inline std::string* ScanResponse::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.ScanResponse.value)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+
+// repeated .kvdb.KeyValue pairs = 3;
+inline int ScanResponse::_internal_pairs_size() const {
+  return _impl_.pairs_.size();
 }
-inline void ScanResponse::unsafe_arena_set_allocated_value(
-    std::string* value) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (value != nullptr) {
-    
-  } else {
-    
-  }
-  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.ScanResponse.value)
+inline int ScanResponse::pairs_size() const {
+  return _internal_pairs_size();
+}
+inline void ScanResponse::clear_pairs() {
+  _impl_.pairs_.Clear();
+}
+inline ::kvdb::KeyValue* ScanResponse::mutable_pairs(int index) {
+  // @@protoc_insertion_point(field_mutable:kvdb.ScanResponse.pairs)
+  return _impl_.pairs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvdb::KeyValue >*
+ScanResponse::mutable_pairs() {
+  // @@protoc_insertion_point(field_mutable_list:kvdb.ScanResponse.pairs)
+  return &_impl_.pairs_;
+}
+inline const ::kvdb::KeyValue& ScanResponse::_internal_pairs(int index) const {
+  return _impl_.pairs_.Get(index);
+}
+inline const ::kvdb::KeyValue& ScanResponse::pairs(int index) const {
+  // @@protoc_insertion_point(field_get:kvdb.ScanResponse.pairs)
+  return _internal_pairs(index);
+}
+inline ::kvdb::KeyValue* ScanResponse::_internal_add_pairs() {
+  return _impl_.pairs_.Add();
+}
+inline ::kvdb::KeyValue* ScanResponse::add_pairs() {
+  ::kvdb::KeyValue* _add = _internal_add_pairs();
+  // @@protoc_insertion_point(field_add:kvdb.ScanResponse.pairs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvdb::KeyValue >&
+ScanResponse::pairs() const {
+  // @@protoc_insertion_point(field_list:kvdb.ScanResponse.pairs)
+  return _impl_.pairs_;
 }
 
 // -------------------------------------------------------------------
@@ -7093,54 +6667,38 @@ inline void ScanResponse::unsafe_arena_set_allocated_value(
 
 // string prefix = 1;
 inline void PrefixScanRequest::clear_prefix() {
-  prefix_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.prefix_.ClearToEmpty();
 }
 inline const std::string& PrefixScanRequest::prefix() const {
   // @@protoc_insertion_point(field_get:kvdb.PrefixScanRequest.prefix)
   return _internal_prefix();
 }
-inline void PrefixScanRequest::set_prefix(const std::string& value) {
-  _internal_set_prefix(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PrefixScanRequest::set_prefix(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.prefix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.PrefixScanRequest.prefix)
 }
 inline std::string* PrefixScanRequest::mutable_prefix() {
+  std::string* _s = _internal_mutable_prefix();
   // @@protoc_insertion_point(field_mutable:kvdb.PrefixScanRequest.prefix)
-  return _internal_mutable_prefix();
+  return _s;
 }
 inline const std::string& PrefixScanRequest::_internal_prefix() const {
-  return prefix_.Get();
+  return _impl_.prefix_.Get();
 }
 inline void PrefixScanRequest::_internal_set_prefix(const std::string& value) {
   
-  prefix_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void PrefixScanRequest::set_prefix(std::string&& value) {
-  
-  prefix_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.PrefixScanRequest.prefix)
-}
-inline void PrefixScanRequest::set_prefix(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  prefix_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.PrefixScanRequest.prefix)
-}
-inline void PrefixScanRequest::set_prefix(const char* value,
-    size_t size) {
-  
-  prefix_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.PrefixScanRequest.prefix)
+  _impl_.prefix_.Set(value, GetArenaForAllocation());
 }
 inline std::string* PrefixScanRequest::_internal_mutable_prefix() {
   
-  return prefix_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.prefix_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PrefixScanRequest::release_prefix() {
   // @@protoc_insertion_point(field_release:kvdb.PrefixScanRequest.prefix)
-  return prefix_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.prefix_.Release();
 }
 inline void PrefixScanRequest::set_allocated_prefix(std::string* prefix) {
   if (prefix != nullptr) {
@@ -7148,104 +6706,93 @@ inline void PrefixScanRequest::set_allocated_prefix(std::string* prefix) {
   } else {
     
   }
-  prefix_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), prefix,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.PrefixScanRequest.prefix)
-}
-inline std::string* PrefixScanRequest::unsafe_arena_release_prefix() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.PrefixScanRequest.prefix)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return prefix_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void PrefixScanRequest::unsafe_arena_set_allocated_prefix(
-    std::string* prefix) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (prefix != nullptr) {
-    
-  } else {
-    
+  _impl_.prefix_.SetAllocated(prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prefix_.IsDefault()) {
+    _impl_.prefix_.Set("", GetArenaForAllocation());
   }
-  prefix_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      prefix, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.PrefixScanRequest.prefix)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.PrefixScanRequest.prefix)
 }
 
 // int32 limit = 2;
 inline void PrefixScanRequest::clear_limit() {
-  limit_ = 0;
+  _impl_.limit_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 PrefixScanRequest::_internal_limit() const {
-  return limit_;
+inline int32_t PrefixScanRequest::_internal_limit() const {
+  return _impl_.limit_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 PrefixScanRequest::limit() const {
+inline int32_t PrefixScanRequest::limit() const {
   // @@protoc_insertion_point(field_get:kvdb.PrefixScanRequest.limit)
   return _internal_limit();
 }
-inline void PrefixScanRequest::_internal_set_limit(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void PrefixScanRequest::_internal_set_limit(int32_t value) {
   
-  limit_ = value;
+  _impl_.limit_ = value;
 }
-inline void PrefixScanRequest::set_limit(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void PrefixScanRequest::set_limit(int32_t value) {
   _internal_set_limit(value);
   // @@protoc_insertion_point(field_set:kvdb.PrefixScanRequest.limit)
 }
 
+// uint32 batch_bytes = 3;
+inline void PrefixScanRequest::clear_batch_bytes() {
+  _impl_.batch_bytes_ = 0u;
+}
+inline uint32_t PrefixScanRequest::_internal_batch_bytes() const {
+  return _impl_.batch_bytes_;
+}
+inline uint32_t PrefixScanRequest::batch_bytes() const {
+  // @@protoc_insertion_point(field_get:kvdb.PrefixScanRequest.batch_bytes)
+  return _internal_batch_bytes();
+}
+inline void PrefixScanRequest::_internal_set_batch_bytes(uint32_t value) {
+  
+  _impl_.batch_bytes_ = value;
+}
+inline void PrefixScanRequest::set_batch_bytes(uint32_t value) {
+  _internal_set_batch_bytes(value);
+  // @@protoc_insertion_point(field_set:kvdb.PrefixScanRequest.batch_bytes)
+}
+
 // -------------------------------------------------------------------
 
 // PrefixScanResponse
 
 // string key = 1;
 inline void PrefixScanResponse::clear_key() {
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.key_.ClearToEmpty();
 }
 inline const std::string& PrefixScanResponse::key() const {
   // @@protoc_insertion_point(field_get:kvdb.PrefixScanResponse.key)
   return _internal_key();
 }
-inline void PrefixScanResponse::set_key(const std::string& value) {
-  _internal_set_key(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PrefixScanResponse::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.PrefixScanResponse.key)
 }
 inline std::string* PrefixScanResponse::mutable_key() {
+  std::string* _s = _internal_mutable_key();
   // @@protoc_insertion_point(field_mutable:kvdb.PrefixScanResponse.key)
-  return _internal_mutable_key();
+  return _s;
 }
 inline const std::string& PrefixScanResponse::_internal_key() const {
-  return key_.Get();
+  return _impl_.key_.Get();
 }
 inline void PrefixScanResponse::_internal_set_key(const std::string& value) {
   
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void PrefixScanResponse::set_key(std::string&& value) {
-  
-  key_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.PrefixScanResponse.key)
-}
-inline void PrefixScanResponse::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.PrefixScanResponse.key)
-}
-inline void PrefixScanResponse::set_key(const char* value,
-    size_t size) {
-  
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.PrefixScanResponse.key)
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
 inline std::string* PrefixScanResponse::_internal_mutable_key() {
   
-  return key_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PrefixScanResponse::release_key() {
   // @@protoc_insertion_point(field_release:kvdb.PrefixScanResponse.key)
-  return key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Release();
 }
 inline void PrefixScanResponse::set_allocated_key(std::string* key) {
   if (key != nullptr) {
@@ -7253,80 +6800,49 @@ inline void PrefixScanResponse::set_allocated_key(std::string* key) {
   } else {
     
   }
-  key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.PrefixScanResponse.key)
-}
-inline std::string* PrefixScanResponse::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.PrefixScanResponse.key)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return key_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void PrefixScanResponse::unsafe_arena_set_allocated_key(
-    std::string* key) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (key != nullptr) {
-    
-  } else {
-    
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
   }
-  key_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      key, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.PrefixScanResponse.key)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.PrefixScanResponse.key)
 }
 
 // string value = 2;
 inline void PrefixScanResponse::clear_value() {
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.value_.ClearToEmpty();
 }
 inline const std::string& PrefixScanResponse::value() const {
   // @@protoc_insertion_point(field_get:kvdb.PrefixScanResponse.value)
   return _internal_value();
 }
-inline void PrefixScanResponse::set_value(const std::string& value) {
-  _internal_set_value(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PrefixScanResponse::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.PrefixScanResponse.value)
 }
 inline std::string* PrefixScanResponse::mutable_value() {
+  std::string* _s = _internal_mutable_value();
   // @@protoc_insertion_point(field_mutable:kvdb.PrefixScanResponse.value)
-  return _internal_mutable_value();
+  return _s;
 }
 inline const std::string& PrefixScanResponse::_internal_value() const {
-  return value_.Get();
+  return _impl_.value_.Get();
 }
 inline void PrefixScanResponse::_internal_set_value(const std::string& value) {
   
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void PrefixScanResponse::set_value(std::string&& value) {
-  
-  value_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.PrefixScanResponse.value)
-}
-inline void PrefixScanResponse::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.PrefixScanResponse.value)
-}
-inline void PrefixScanResponse::set_value(const char* value,
-    size_t size) {
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.PrefixScanResponse.value)
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
 inline std::string* PrefixScanResponse::_internal_mutable_value() {
   
-  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PrefixScanResponse::release_value() {
   // @@protoc_insertion_point(field_release:kvdb.PrefixScanResponse.value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Release();
 }
 inline void PrefixScanResponse::set_allocated_value(std::string* value) {
   if (value != nullptr) {
@@ -7334,28 +6850,53 @@ inline void PrefixScanResponse::set_allocated_value(std::string* value) {
   } else {
     
   }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:kvdb.PrefixScanResponse.value)
 }
-inline std::string* PrefixScanResponse::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.PrefixScanResponse.value)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+
+// repeated .kvdb.KeyValue pairs = 3;
+inline int PrefixScanResponse::_internal_pairs_size() const {
+  return _impl_.pairs_.size();
 }
-inline void PrefixScanResponse::unsafe_arena_set_allocated_value(
-    std::string* value) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (value != nullptr) {
-    
-  } else {
-    
-  }
-  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.PrefixScanResponse.value)
+inline int PrefixScanResponse::pairs_size() const {
+  return _internal_pairs_size();
+}
+inline void PrefixScanResponse::clear_pairs() {
+  _impl_.pairs_.Clear();
+}
+inline ::kvdb::KeyValue* PrefixScanResponse::mutable_pairs(int index) {
+  // @@protoc_insertion_point(field_mutable:kvdb.PrefixScanResponse.pairs)
+  return _impl_.pairs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvdb::KeyValue >*
+PrefixScanResponse::mutable_pairs() {
+  // @@protoc_insertion_point(field_mutable_list:kvdb.PrefixScanResponse.pairs)
+  return &_impl_.pairs_;
+}
+inline const ::kvdb::KeyValue& PrefixScanResponse::_internal_pairs(int index) const {
+  return _impl_.pairs_.Get(index);
+}
+inline const ::kvdb::KeyValue& PrefixScanResponse::pairs(int index) const {
+  // @@protoc_insertion_point(field_get:kvdb.PrefixScanResponse.pairs)
+  return _internal_pairs(index);
+}
+inline ::kvdb::KeyValue* PrefixScanResponse::_internal_add_pairs() {
+  return _impl_.pairs_.Add();
+}
+inline ::kvdb::KeyValue* PrefixScanResponse::add_pairs() {
+  ::kvdb::KeyValue* _add = _internal_add_pairs();
+  // @@protoc_insertion_point(field_add:kvdb.PrefixScanResponse.pairs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvdb::KeyValue >&
+PrefixScanResponse::pairs() const {
+  // @@protoc_insertion_point(field_list:kvdb.PrefixScanResponse.pairs)
+  return _impl_.pairs_;
 }
 
 // -------------------------------------------------------------------
@@ -7368,74 +6909,58 @@ inline void PrefixScanResponse::unsafe_arena_set_allocated_value(
 
 // uint64 snapshot_id = 1;
 inline void CreateSnapshotResponse::clear_snapshot_id() {
-  snapshot_id_ = PROTOBUF_ULONGLONG(0);
+  _impl_.snapshot_id_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 CreateSnapshotResponse::_internal_snapshot_id() const {
-  return snapshot_id_;
+inline uint64_t CreateSnapshotResponse::_internal_snapshot_id() const {
+  return _impl_.snapshot_id_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 CreateSnapshotResponse::snapshot_id() const {
+inline uint64_t CreateSnapshotResponse::snapshot_id() const {
   // @@protoc_insertion_point(field_get:kvdb.CreateSnapshotResponse.snapshot_id)
   return _internal_snapshot_id();
 }
-inline void CreateSnapshotResponse::_internal_set_snapshot_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void CreateSnapshotResponse::_internal_set_snapshot_id(uint64_t value) {
   
-  snapshot_id_ = value;
+  _impl_.snapshot_id_ = value;
 }
-inline void CreateSnapshotResponse::set_snapshot_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void CreateSnapshotResponse::set_snapshot_id(uint64_t value) {
   _internal_set_snapshot_id(value);
   // @@protoc_insertion_point(field_set:kvdb.CreateSnapshotResponse.snapshot_id)
 }
 
 // string error_message = 2;
 inline void CreateSnapshotResponse::clear_error_message() {
-  error_message_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.error_message_.ClearToEmpty();
 }
 inline const std::string& CreateSnapshotResponse::error_message() const {
   // @@protoc_insertion_point(field_get:kvdb.CreateSnapshotResponse.error_message)
   return _internal_error_message();
 }
-inline void CreateSnapshotResponse::set_error_message(const std::string& value) {
-  _internal_set_error_message(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CreateSnapshotResponse::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.CreateSnapshotResponse.error_message)
 }
 inline std::string* CreateSnapshotResponse::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
   // @@protoc_insertion_point(field_mutable:kvdb.CreateSnapshotResponse.error_message)
-  return _internal_mutable_error_message();
+  return _s;
 }
 inline const std::string& CreateSnapshotResponse::_internal_error_message() const {
-  return error_message_.Get();
+  return _impl_.error_message_.Get();
 }
 inline void CreateSnapshotResponse::_internal_set_error_message(const std::string& value) {
   
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void CreateSnapshotResponse::set_error_message(std::string&& value) {
-  
-  error_message_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.CreateSnapshotResponse.error_message)
-}
-inline void CreateSnapshotResponse::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.CreateSnapshotResponse.error_message)
-}
-inline void CreateSnapshotResponse::set_error_message(const char* value,
-    size_t size) {
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.CreateSnapshotResponse.error_message)
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
 inline std::string* CreateSnapshotResponse::_internal_mutable_error_message() {
   
-  return error_message_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* CreateSnapshotResponse::release_error_message() {
   // @@protoc_insertion_point(field_release:kvdb.CreateSnapshotResponse.error_message)
-  return error_message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Release();
 }
 inline void CreateSnapshotResponse::set_allocated_error_message(std::string* error_message) {
   if (error_message != nullptr) {
@@ -7443,28 +6968,13 @@ inline void CreateSnapshotResponse::set_allocated_error_message(std::string* err
   } else {
     
   }
-  error_message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), error_message,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.CreateSnapshotResponse.error_message)
-}
-inline std::string* CreateSnapshotResponse::unsafe_arena_release_error_message() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.CreateSnapshotResponse.error_message)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return error_message_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void CreateSnapshotResponse::unsafe_arena_set_allocated_error_message(
-    std::string* error_message) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (error_message != nullptr) {
-    
-  } else {
-    
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
   }
-  error_message_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      error_message, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.CreateSnapshotResponse.error_message)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.CreateSnapshotResponse.error_message)
 }
 
 // -------------------------------------------------------------------
@@ -7473,20 +6983,20 @@ inline void CreateSnapshotResponse::unsafe_arena_set_allocated_error_message(
 
 // uint64 snapshot_id = 1;
 inline void ReleaseSnapshotRequest::clear_snapshot_id() {
-  snapshot_id_ = PROTOBUF_ULONGLONG(0);
+  _impl_.snapshot_id_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 ReleaseSnapshotRequest::_internal_snapshot_id() const {
-  return snapshot_id_;
+inline uint64_t ReleaseSnapshotRequest::_internal_snapshot_id() const {
+  return _impl_.snapshot_id_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 ReleaseSnapshotRequest::snapshot_id() const {
+inline uint64_t ReleaseSnapshotRequest::snapshot_id() const {
   // @@protoc_insertion_point(field_get:kvdb.ReleaseSnapshotRequest.snapshot_id)
   return _internal_snapshot_id();
 }
-inline void ReleaseSnapshotRequest::_internal_set_snapshot_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void ReleaseSnapshotRequest::_internal_set_snapshot_id(uint64_t value) {
   
-  snapshot_id_ = value;
+  _impl_.snapshot_id_ = value;
 }
-inline void ReleaseSnapshotRequest::set_snapshot_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void ReleaseSnapshotRequest::set_snapshot_id(uint64_t value) {
   _internal_set_snapshot_id(value);
   // @@protoc_insertion_point(field_set:kvdb.ReleaseSnapshotRequest.snapshot_id)
 }
@@ -7497,10 +7007,10 @@ inline void ReleaseSnapshotRequest::set_snapshot_id(::PROTOBUF_NAMESPACE_ID::uin
 
 // bool success = 1;
 inline void ReleaseSnapshotResponse::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
 }
 inline bool ReleaseSnapshotResponse::_internal_success() const {
-  return success_;
+  return _impl_.success_;
 }
 inline bool ReleaseSnapshotResponse::success() const {
   // @@protoc_insertion_point(field_get:kvdb.ReleaseSnapshotResponse.success)
@@ -7508,7 +7018,7 @@ inline bool ReleaseSnapshotResponse::success() const {
 }
 inline void ReleaseSnapshotResponse::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
 }
 inline void ReleaseSnapshotResponse::set_success(bool value) {
   _internal_set_success(value);
@@ -7517,54 +7027,38 @@ inline void ReleaseSnapshotResponse::set_success(bool value) {
 
 // string error_message = 2;
 inline void ReleaseSnapshotResponse::clear_error_message() {
-  error_message_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.error_message_.ClearToEmpty();
 }
 inline const std::string& ReleaseSnapshotResponse::error_message() const {
   // @@protoc_insertion_point(field_get:kvdb.ReleaseSnapshotResponse.error_message)
   return _internal_error_message();
 }
-inline void ReleaseSnapshotResponse::set_error_message(const std::string& value) {
-  _internal_set_error_message(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReleaseSnapshotResponse::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.ReleaseSnapshotResponse.error_message)
 }
 inline std::string* ReleaseSnapshotResponse::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
   // @@protoc_insertion_point(field_mutable:kvdb.ReleaseSnapshotResponse.error_message)
-  return _internal_mutable_error_message();
+  return _s;
 }
 inline const std::string& ReleaseSnapshotResponse::_internal_error_message() const {
-  return error_message_.Get();
+  return _impl_.error_message_.Get();
 }
 inline void ReleaseSnapshotResponse::_internal_set_error_message(const std::string& value) {
   
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void ReleaseSnapshotResponse::set_error_message(std::string&& value) {
-  
-  error_message_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.ReleaseSnapshotResponse.error_message)
-}
-inline void ReleaseSnapshotResponse::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.ReleaseSnapshotResponse.error_message)
-}
-inline void ReleaseSnapshotResponse::set_error_message(const char* value,
-    size_t size) {
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.ReleaseSnapshotResponse.error_message)
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ReleaseSnapshotResponse::_internal_mutable_error_message() {
   
-  return error_message_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ReleaseSnapshotResponse::release_error_message() {
   // @@protoc_insertion_point(field_release:kvdb.ReleaseSnapshotResponse.error_message)
-  return error_message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Release();
 }
 inline void ReleaseSnapshotResponse::set_allocated_error_message(std::string* error_message) {
   if (error_message != nullptr) {
@@ -7572,28 +7066,13 @@ inline void ReleaseSnapshotResponse::set_allocated_error_message(std::string* er
   } else {
     
   }
-  error_message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), error_message,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.ReleaseSnapshotResponse.error_message)
-}
-inline std::string* ReleaseSnapshotResponse::unsafe_arena_release_error_message() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.ReleaseSnapshotResponse.error_message)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return error_message_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void ReleaseSnapshotResponse::unsafe_arena_set_allocated_error_message(
-    std::string* error_message) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (error_message != nullptr) {
-    
-  } else {
-    
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
   }
-  error_message_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      error_message, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.ReleaseSnapshotResponse.error_message)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.ReleaseSnapshotResponse.error_message)
 }
 
 // -------------------------------------------------------------------
@@ -7602,54 +7081,38 @@ inline void ReleaseSnapshotResponse::unsafe_arena_set_allocated_error_message(
 
 // string key = 1;
 inline void GetAtSnapshotRequest::clear_key() {
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.key_.ClearToEmpty();
 }
 inline const std::string& GetAtSnapshotRequest::key() const {
   // @@protoc_insertion_point(field_get:kvdb.GetAtSnapshotRequest.key)
   return _internal_key();
 }
-inline void GetAtSnapshotRequest::set_key(const std::string& value) {
-  _internal_set_key(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetAtSnapshotRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.GetAtSnapshotRequest.key)
 }
 inline std::string* GetAtSnapshotRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
   // @@protoc_insertion_point(field_mutable:kvdb.GetAtSnapshotRequest.key)
-  return _internal_mutable_key();
+  return _s;
 }
 inline const std::string& GetAtSnapshotRequest::_internal_key() const {
-  return key_.Get();
+  return _impl_.key_.Get();
 }
 inline void GetAtSnapshotRequest::_internal_set_key(const std::string& value) {
   
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void GetAtSnapshotRequest::set_key(std::string&& value) {
-  
-  key_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.GetAtSnapshotRequest.key)
-}
-inline void GetAtSnapshotRequest::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.GetAtSnapshotRequest.key)
-}
-inline void GetAtSnapshotRequest::set_key(const char* value,
-    size_t size) {
-  
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.GetAtSnapshotRequest.key)
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GetAtSnapshotRequest::_internal_mutable_key() {
   
-  return key_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GetAtSnapshotRequest::release_key() {
   // @@protoc_insertion_point(field_release:kvdb.GetAtSnapshotRequest.key)
-  return key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Release();
 }
 inline void GetAtSnapshotRequest::set_allocated_key(std::string* key) {
   if (key != nullptr) {
@@ -7657,46 +7120,31 @@ inline void GetAtSnapshotRequest::set_allocated_key(std::string* key) {
   } else {
     
   }
-  key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.GetAtSnapshotRequest.key)
-}
-inline std::string* GetAtSnapshotRequest::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.GetAtSnapshotRequest.key)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return key_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void GetAtSnapshotRequest::unsafe_arena_set_allocated_key(
-    std::string* key) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (key != nullptr) {
-    
-  } else {
-    
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
   }
-  key_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      key, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.GetAtSnapshotRequest.key)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.GetAtSnapshotRequest.key)
 }
 
 // uint64 snapshot_id = 2;
 inline void GetAtSnapshotRequest::clear_snapshot_id() {
-  snapshot_id_ = PROTOBUF_ULONGLONG(0);
+  _impl_.snapshot_id_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetAtSnapshotRequest::_internal_snapshot_id() const {
-  return snapshot_id_;
+inline uint64_t GetAtSnapshotRequest::_internal_snapshot_id() const {
+  return _impl_.snapshot_id_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetAtSnapshotRequest::snapshot_id() const {
+inline uint64_t GetAtSnapshotRequest::snapshot_id() const {
   // @@protoc_insertion_point(field_get:kvdb.GetAtSnapshotRequest.snapshot_id)
   return _internal_snapshot_id();
 }
-inline void GetAtSnapshotRequest::_internal_set_snapshot_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void GetAtSnapshotRequest::_internal_set_snapshot_id(uint64_t value) {
   
-  snapshot_id_ = value;
+  _impl_.snapshot_id_ = value;
 }
-inline void GetAtSnapshotRequest::set_snapshot_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void GetAtSnapshotRequest::set_snapshot_id(uint64_t value) {
   _internal_set_snapshot_id(value);
   // @@protoc_insertion_point(field_set:kvdb.GetAtSnapshotRequest.snapshot_id)
 }
@@ -7707,10 +7155,10 @@ inline void GetAtSnapshotRequest::set_snapshot_id(::PROTOBUF_NAMESPACE_ID::uint6
 
 // bool found = 1;
 inline void GetAtSnapshotResponse::clear_found() {
-  found_ = false;
+  _impl_.found_ = false;
 }
 inline bool GetAtSnapshotResponse::_internal_found() const {
-  return found_;
+  return _impl_.found_;
 }
 inline bool GetAtSnapshotResponse::found() const {
   // @@protoc_insertion_point(field_get:kvdb.GetAtSnapshotResponse.found)
@@ -7718,7 +7166,7 @@ inline bool GetAtSnapshotResponse::found() const {
 }
 inline void GetAtSnapshotResponse::_internal_set_found(bool value) {
   
-  found_ = value;
+  _impl_.found_ = value;
 }
 inline void GetAtSnapshotResponse::set_found(bool value) {
   _internal_set_found(value);
@@ -7727,54 +7175,38 @@ inline void GetAtSnapshotResponse::set_found(bool value) {
 
 // string value = 2;
 inline void GetAtSnapshotResponse::clear_value() {
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.value_.ClearToEmpty();
 }
 inline const std::string& GetAtSnapshotResponse::value() const {
   // @@protoc_insertion_point(field_get:kvdb.GetAtSnapshotResponse.value)
   return _internal_value();
 }
-inline void GetAtSnapshotResponse::set_value(const std::string& value) {
-  _internal_set_value(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetAtSnapshotResponse::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.GetAtSnapshotResponse.value)
 }
 inline std::string* GetAtSnapshotResponse::mutable_value() {
+  std::string* _s = _internal_mutable_value();
   // @@protoc_insertion_point(field_mutable:kvdb.GetAtSnapshotResponse.value)
-  return _internal_mutable_value();
+  return _s;
 }
 inline const std::string& GetAtSnapshotResponse::_internal_value() const {
-  return value_.Get();
+  return _impl_.value_.Get();
 }
 inline void GetAtSnapshotResponse::_internal_set_value(const std::string& value) {
   
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void GetAtSnapshotResponse::set_value(std::string&& value) {
-  
-  value_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.GetAtSnapshotResponse.value)
-}
-inline void GetAtSnapshotResponse::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.GetAtSnapshotResponse.value)
-}
-inline void GetAtSnapshotResponse::set_value(const char* value,
-    size_t size) {
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.GetAtSnapshotResponse.value)
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GetAtSnapshotResponse::_internal_mutable_value() {
   
-  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GetAtSnapshotResponse::release_value() {
   // @@protoc_insertion_point(field_release:kvdb.GetAtSnapshotResponse.value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Release();
 }
 inline void GetAtSnapshotResponse::set_allocated_value(std::string* value) {
   if (value != nullptr) {
@@ -7782,80 +7214,49 @@ inline void GetAtSnapshotResponse::set_allocated_value(std::string* value) {
   } else {
     
   }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.GetAtSnapshotResponse.value)
-}
-inline std::string* GetAtSnapshotResponse::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.GetAtSnapshotResponse.value)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void GetAtSnapshotResponse::unsafe_arena_set_allocated_value(
-    std::string* value) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (value != nullptr) {
-    
-  } else {
-    
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
   }
-  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.GetAtSnapshotResponse.value)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.GetAtSnapshotResponse.value)
 }
 
 // string error_message = 3;
 inline void GetAtSnapshotResponse::clear_error_message() {
-  error_message_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.error_message_.ClearToEmpty();
 }
 inline const std::string& GetAtSnapshotResponse::error_message() const {
   // @@protoc_insertion_point(field_get:kvdb.GetAtSnapshotResponse.error_message)
   return _internal_error_message();
 }
-inline void GetAtSnapshotResponse::set_error_message(const std::string& value) {
-  _internal_set_error_message(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetAtSnapshotResponse::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.GetAtSnapshotResponse.error_message)
 }
 inline std::string* GetAtSnapshotResponse::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
   // @@protoc_insertion_point(field_mutable:kvdb.GetAtSnapshotResponse.error_message)
-  return _internal_mutable_error_message();
+  return _s;
 }
 inline const std::string& GetAtSnapshotResponse::_internal_error_message() const {
-  return error_message_.Get();
+  return _impl_.error_message_.Get();
 }
 inline void GetAtSnapshotResponse::_internal_set_error_message(const std::string& value) {
   
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void GetAtSnapshotResponse::set_error_message(std::string&& value) {
-  
-  error_message_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.GetAtSnapshotResponse.error_message)
-}
-inline void GetAtSnapshotResponse::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.GetAtSnapshotResponse.error_message)
-}
-inline void GetAtSnapshotResponse::set_error_message(const char* value,
-    size_t size) {
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.GetAtSnapshotResponse.error_message)
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GetAtSnapshotResponse::_internal_mutable_error_message() {
   
-  return error_message_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GetAtSnapshotResponse::release_error_message() {
   // @@protoc_insertion_point(field_release:kvdb.GetAtSnapshotResponse.error_message)
-  return error_message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Release();
 }
 inline void GetAtSnapshotResponse::set_allocated_error_message(std::string* error_message) {
   if (error_message != nullptr) {
@@ -7863,28 +7264,13 @@ inline void GetAtSnapshotResponse::set_allocated_error_message(std::string* erro
   } else {
     
   }
-  error_message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), error_message,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.GetAtSnapshotResponse.error_message)
-}
-inline std::string* GetAtSnapshotResponse::unsafe_arena_release_error_message() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.GetAtSnapshotResponse.error_message)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return error_message_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void GetAtSnapshotResponse::unsafe_arena_set_allocated_error_message(
-    std::string* error_message) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (error_message != nullptr) {
-    
-  } else {
-    
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
   }
-  error_message_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      error_message, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.GetAtSnapshotResponse.error_message)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.GetAtSnapshotResponse.error_message)
 }
 
 // -------------------------------------------------------------------
@@ -7897,10 +7283,10 @@ inline void GetAtSnapshotResponse::unsafe_arena_set_allocated_error_message(
 
 // bool success = 1;
 inline void FlushResponse::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
 }
 inline bool FlushResponse::_internal_success() const {
-  return success_;
+  return _impl_.success_;
 }
 inline bool FlushResponse::success() const {
   // @@protoc_insertion_point(field_get:kvdb.FlushResponse.success)
@@ -7908,7 +7294,7 @@ inline bool FlushResponse::success() const {
 }
 inline void FlushResponse::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
 }
 inline void FlushResponse::set_success(bool value) {
   _internal_set_success(value);
@@ -7917,54 +7303,38 @@ inline void FlushResponse::set_success(bool value) {
 
 // string error_message = 2;
 inline void FlushResponse::clear_error_message() {
-  error_message_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.error_message_.ClearToEmpty();
 }
 inline const std::string& FlushResponse::error_message() const {
   // @@protoc_insertion_point(field_get:kvdb.FlushResponse.error_message)
   return _internal_error_message();
 }
-inline void FlushResponse::set_error_message(const std::string& value) {
-  _internal_set_error_message(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FlushResponse::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.FlushResponse.error_message)
 }
 inline std::string* FlushResponse::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
   // @@protoc_insertion_point(field_mutable:kvdb.FlushResponse.error_message)
-  return _internal_mutable_error_message();
+  return _s;
 }
 inline const std::string& FlushResponse::_internal_error_message() const {
-  return error_message_.Get();
+  return _impl_.error_message_.Get();
 }
 inline void FlushResponse::_internal_set_error_message(const std::string& value) {
   
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void FlushResponse::set_error_message(std::string&& value) {
-  
-  error_message_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.FlushResponse.error_message)
-}
-inline void FlushResponse::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.FlushResponse.error_message)
-}
-inline void FlushResponse::set_error_message(const char* value,
-    size_t size) {
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.FlushResponse.error_message)
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
 inline std::string* FlushResponse::_internal_mutable_error_message() {
   
-  return error_message_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* FlushResponse::release_error_message() {
   // @@protoc_insertion_point(field_release:kvdb.FlushResponse.error_message)
-  return error_message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Release();
 }
 inline void FlushResponse::set_allocated_error_message(std::string* error_message) {
   if (error_message != nullptr) {
@@ -7972,28 +7342,13 @@ inline void FlushResponse::set_allocated_error_message(std::string* error_messag
   } else {
     
   }
-  error_message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), error_message,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.FlushResponse.error_message)
-}
-inline std::string* FlushResponse::unsafe_arena_release_error_message() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.FlushResponse.error_message)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return error_message_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void FlushResponse::unsafe_arena_set_allocated_error_message(
-    std::string* error_message) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (error_message != nullptr) {
-    
-  } else {
-    
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
   }
-  error_message_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      error_message, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.FlushResponse.error_message)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.FlushResponse.error_message)
 }
 
 // -------------------------------------------------------------------
@@ -8006,10 +7361,10 @@ inline void FlushResponse::unsafe_arena_set_allocated_error_message(
 
 // bool success = 1;
 inline void CompactResponse::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
 }
 inline bool CompactResponse::_internal_success() const {
-  return success_;
+  return _impl_.success_;
 }
 inline bool CompactResponse::success() const {
   // @@protoc_insertion_point(field_get:kvdb.CompactResponse.success)
@@ -8017,7 +7372,7 @@ inline bool CompactResponse::success() const {
 }
 inline void CompactResponse::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
 }
 inline void CompactResponse::set_success(bool value) {
   _internal_set_success(value);
@@ -8026,54 +7381,38 @@ inline void CompactResponse::set_success(bool value) {
 
 // string error_message = 2;
 inline void CompactResponse::clear_error_message() {
-  error_message_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.error_message_.ClearToEmpty();
 }
 inline const std::string& CompactResponse::error_message() const {
   // @@protoc_insertion_point(field_get:kvdb.CompactResponse.error_message)
   return _internal_error_message();
 }
-inline void CompactResponse::set_error_message(const std::string& value) {
-  _internal_set_error_message(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CompactResponse::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.CompactResponse.error_message)
 }
 inline std::string* CompactResponse::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
   // @@protoc_insertion_point(field_mutable:kvdb.CompactResponse.error_message)
-  return _internal_mutable_error_message();
+  return _s;
 }
 inline const std::string& CompactResponse::_internal_error_message() const {
-  return error_message_.Get();
+  return _impl_.error_message_.Get();
 }
 inline void CompactResponse::_internal_set_error_message(const std::string& value) {
   
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void CompactResponse::set_error_message(std::string&& value) {
-  
-  error_message_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.CompactResponse.error_message)
-}
-inline void CompactResponse::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.CompactResponse.error_message)
-}
-inline void CompactResponse::set_error_message(const char* value,
-    size_t size) {
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.CompactResponse.error_message)
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
 inline std::string* CompactResponse::_internal_mutable_error_message() {
   
-  return error_message_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* CompactResponse::release_error_message() {
   // @@protoc_insertion_point(field_release:kvdb.CompactResponse.error_message)
-  return error_message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Release();
 }
 inline void CompactResponse::set_allocated_error_message(std::string* error_message) {
   if (error_message != nullptr) {
@@ -8081,28 +7420,13 @@ inline void CompactResponse::set_allocated_error_message(std::string* error_mess
   } else {
     
   }
-  error_message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), error_message,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.CompactResponse.error_message)
-}
-inline std::string* CompactResponse::unsafe_arena_release_error_message() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.CompactResponse.error_message)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return error_message_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void CompactResponse::unsafe_arena_set_allocated_error_message(
-    std::string* error_message) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (error_message != nullptr) {
-    
-  } else {
-    
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
   }
-  error_message_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      error_message, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.CompactResponse.error_message)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.CompactResponse.error_message)
 }
 
 // -------------------------------------------------------------------
@@ -8115,50 +7439,50 @@ inline void CompactResponse::unsafe_arena_set_allocated_error_message(
 
 // uint64 memtable_size = 1;
 inline void GetStatsResponse::clear_memtable_size() {
-  memtable_size_ = PROTOBUF_ULONGLONG(0);
+  _impl_.memtable_size_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetStatsResponse::_internal_memtable_size() const {
-  return memtable_size_;
+inline uint64_t GetStatsResponse::_internal_memtable_size() const {
+  return _impl_.memtable_size_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetStatsResponse::memtable_size() const {
+inline uint64_t GetStatsResponse::memtable_size() const {
   // @@protoc_insertion_point(field_get:kvdb.GetStatsResponse.memtable_size)
   return _internal_memtable_size();
 }
-inline void GetStatsResponse::_internal_set_memtable_size(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void GetStatsResponse::_internal_set_memtable_size(uint64_t value) {
   
-  memtable_size_ = value;
+  _impl_.memtable_size_ = value;
 }
-inline void GetStatsResponse::set_memtable_size(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void GetStatsResponse::set_memtable_size(uint64_t value) {
   _internal_set_memtable_size(value);
   // @@protoc_insertion_point(field_set:kvdb.GetStatsResponse.memtable_size)
 }
 
 // uint64 wal_size = 2;
 inline void GetStatsResponse::clear_wal_size() {
-  wal_size_ = PROTOBUF_ULONGLONG(0);
+  _impl_.wal_size_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetStatsResponse::_internal_wal_size() const {
-  return wal_size_;
+inline uint64_t GetStatsResponse::_internal_wal_size() const {
+  return _impl_.wal_size_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetStatsResponse::wal_size() const {
+inline uint64_t GetStatsResponse::wal_size() const {
   // @@protoc_insertion_point(field_get:kvdb.GetStatsResponse.wal_size)
   return _internal_wal_size();
 }
-inline void GetStatsResponse::_internal_set_wal_size(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void GetStatsResponse::_internal_set_wal_size(uint64_t value) {
   
-  wal_size_ = value;
+  _impl_.wal_size_ = value;
 }
-inline void GetStatsResponse::set_wal_size(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void GetStatsResponse::set_wal_size(uint64_t value) {
   _internal_set_wal_size(value);
   // @@protoc_insertion_point(field_set:kvdb.GetStatsResponse.wal_size)
 }
 
 // double cache_hit_rate = 3;
 inline void GetStatsResponse::clear_cache_hit_rate() {
-  cache_hit_rate_ = 0;
+  _impl_.cache_hit_rate_ = 0;
 }
 inline double GetStatsResponse::_internal_cache_hit_rate() const {
-  return cache_hit_rate_;
+  return _impl_.cache_hit_rate_;
 }
 inline double GetStatsResponse::cache_hit_rate() const {
   // @@protoc_insertion_point(field_get:kvdb.GetStatsResponse.cache_hit_rate)
@@ -8166,7 +7490,7 @@ inline double GetStatsResponse::cache_hit_rate() const {
 }
 inline void GetStatsResponse::_internal_set_cache_hit_rate(double value) {
   
-  cache_hit_rate_ = value;
+  _impl_.cache_hit_rate_ = value;
 }
 inline void GetStatsResponse::set_cache_hit_rate(double value) {
   _internal_set_cache_hit_rate(value);
@@ -8175,41 +7499,41 @@ inline void GetStatsResponse::set_cache_hit_rate(double value) {
 
 // int32 active_snapshots = 4;
 inline void GetStatsResponse::clear_active_snapshots() {
-  active_snapshots_ = 0;
+  _impl_.active_snapshots_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GetStatsResponse::_internal_active_snapshots() const {
-  return active_snapshots_;
+inline int32_t GetStatsResponse::_internal_active_snapshots() const {
+  return _impl_.active_snapshots_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GetStatsResponse::active_snapshots() const {
+inline int32_t GetStatsResponse::active_snapshots() const {
   // @@protoc_insertion_point(field_get:kvdb.GetStatsResponse.active_snapshots)
   return _internal_active_snapshots();
 }
-inline void GetStatsResponse::_internal_set_active_snapshots(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GetStatsResponse::_internal_set_active_snapshots(int32_t value) {
   
-  active_snapshots_ = value;
+  _impl_.active_snapshots_ = value;
 }
-inline void GetStatsResponse::set_active_snapshots(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GetStatsResponse::set_active_snapshots(int32_t value) {
   _internal_set_active_snapshots(value);
   // @@protoc_insertion_point(field_set:kvdb.GetStatsResponse.active_snapshots)
 }
 
 // .kvdb.CompactionStats compaction_stats = 5;
 inline bool GetStatsResponse::_internal_has_compaction_stats() const {
-  return this != internal_default_instance() && compaction_stats_ != nullptr;
+  return this != internal_default_instance() && _impl_.compaction_stats_ != nullptr;
 }
 inline bool GetStatsResponse::has_compaction_stats() const {
   return _internal_has_compaction_stats();
 }
 inline void GetStatsResponse::clear_compaction_stats() {
-  if (GetArena() == nullptr && compaction_stats_ != nullptr) {
-    delete compaction_stats_;
+  if (GetArenaForAllocation() == nullptr && _impl_.compaction_stats_ != nullptr) {
+    delete _impl_.compaction_stats_;
   }
-  compaction_stats_ = nullptr;
+  _impl_.compaction_stats_ = nullptr;
 }
 inline const ::kvdb::CompactionStats& GetStatsResponse::_internal_compaction_stats() const {
-  const ::kvdb::CompactionStats* p = compaction_stats_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::kvdb::CompactionStats*>(
-      &::kvdb::_CompactionStats_default_instance_);
+  const ::kvdb::CompactionStats* p = _impl_.compaction_stats_;
+  return p != nullptr ? *p : reinterpret_cast<const ::kvdb::CompactionStats&>(
+      ::kvdb::_CompactionStats_default_instance_);
 }
 inline const ::kvdb::CompactionStats& GetStatsResponse::compaction_stats() const {
   // @@protoc_insertion_point(field_get:kvdb.GetStatsResponse.compaction_stats)
@@ -8217,10 +7541,10 @@ inline const ::kvdb::CompactionStats& GetStatsResponse::compaction_stats() const
 }
 inline void GetStatsResponse::unsafe_arena_set_allocated_compaction_stats(
     ::kvdb::CompactionStats* compaction_stats) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(compaction_stats_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.compaction_stats_);
   }
-  compaction_stats_ = compaction_stats;
+  _impl_.compaction_stats_ = compaction_stats;
   if (compaction_stats) {
     
   } else {
@@ -8229,39 +7553,48 @@ inline void GetStatsResponse::unsafe_arena_set_allocated_compaction_stats(
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.GetStatsResponse.compaction_stats)
 }
 inline ::kvdb::CompactionStats* GetStatsResponse::release_compaction_stats() {
-  auto temp = unsafe_arena_release_compaction_stats();
-  if (GetArena() != nullptr) {
+  
+  ::kvdb::CompactionStats* temp = _impl_.compaction_stats_;
+  _impl_.compaction_stats_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::kvdb::CompactionStats* GetStatsResponse::unsafe_arena_release_compaction_stats() {
   // @@protoc_insertion_point(field_release:kvdb.GetStatsResponse.compaction_stats)
   
-  ::kvdb::CompactionStats* temp = compaction_stats_;
-  compaction_stats_ = nullptr;
+  ::kvdb::CompactionStats* temp = _impl_.compaction_stats_;
+  _impl_.compaction_stats_ = nullptr;
   return temp;
 }
 inline ::kvdb::CompactionStats* GetStatsResponse::_internal_mutable_compaction_stats() {
   
-  if (compaction_stats_ == nullptr) {
-    auto* p = CreateMaybeMessage<::kvdb::CompactionStats>(GetArena());
-    compaction_stats_ = p;
+  if (_impl_.compaction_stats_ == nullptr) {
+    auto* p = CreateMaybeMessage<::kvdb::CompactionStats>(GetArenaForAllocation());
+    _impl_.compaction_stats_ = p;
   }
-  return compaction_stats_;
+  return _impl_.compaction_stats_;
 }
 inline ::kvdb::CompactionStats* GetStatsResponse::mutable_compaction_stats() {
+  ::kvdb::CompactionStats* _msg = _internal_mutable_compaction_stats();
   // @@protoc_insertion_point(field_mutable:kvdb.GetStatsResponse.compaction_stats)
-  return _internal_mutable_compaction_stats();
+  return _msg;
 }
 inline void GetStatsResponse::set_allocated_compaction_stats(::kvdb::CompactionStats* compaction_stats) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete compaction_stats_;
+    delete _impl_.compaction_stats_;
   }
   if (compaction_stats) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(compaction_stats);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(compaction_stats);
     if (message_arena != submessage_arena) {
       compaction_stats = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, compaction_stats, submessage_arena);
@@ -8270,7 +7603,7 @@ inline void GetStatsResponse::set_allocated_compaction_stats(::kvdb::CompactionS
   } else {
     
   }
-  compaction_stats_ = compaction_stats;
+  _impl_.compaction_stats_ = compaction_stats;
   // @@protoc_insertion_point(field_set_allocated:kvdb.GetStatsResponse.compaction_stats)
 }
 
@@ -8280,70 +7613,70 @@ inline void GetStatsResponse::set_allocated_compaction_stats(::kvdb::CompactionS
 
 // uint64 total_compactions = 1;
 inline void CompactionStats::clear_total_compactions() {
-  total_compactions_ = PROTOBUF_ULONGLONG(0);
+  _impl_.total_compactions_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 CompactionStats::_internal_total_compactions() const {
-  return total_compactions_;
+inline uint64_t CompactionStats::_internal_total_compactions() const {
+  return _impl_.total_compactions_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 CompactionStats::total_compactions() const {
+inline uint64_t CompactionStats::total_compactions() const {
   // @@protoc_insertion_point(field_get:kvdb.CompactionStats.total_compactions)
   return _internal_total_compactions();
 }
-inline void CompactionStats::_internal_set_total_compactions(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void CompactionStats::_internal_set_total_compactions(uint64_t value) {
   
-  total_compactions_ = value;
+  _impl_.total_compactions_ = value;
 }
-inline void CompactionStats::set_total_compactions(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void CompactionStats::set_total_compactions(uint64_t value) {
   _internal_set_total_compactions(value);
   // @@protoc_insertion_point(field_set:kvdb.CompactionStats.total_compactions)
 }
 
 // uint64 bytes_read = 2;
 inline void CompactionStats::clear_bytes_read() {
-  bytes_read_ = PROTOBUF_ULONGLONG(0);
+  _impl_.bytes_read_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 CompactionStats::_internal_bytes_read() const {
-  return bytes_read_;
+inline uint64_t CompactionStats::_internal_bytes_read() const {
+  return _impl_.bytes_read_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 CompactionStats::bytes_read() const {
+inline uint64_t CompactionStats::bytes_read() const {
   // @@protoc_insertion_point(field_get:kvdb.CompactionStats.bytes_read)
   return _internal_bytes_read();
 }
-inline void CompactionStats::_internal_set_bytes_read(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void CompactionStats::_internal_set_bytes_read(uint64_t value) {
   
-  bytes_read_ = value;
+  _impl_.bytes_read_ = value;
 }
-inline void CompactionStats::set_bytes_read(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void CompactionStats::set_bytes_read(uint64_t value) {
   _internal_set_bytes_read(value);
   // @@protoc_insertion_point(field_set:kvdb.CompactionStats.bytes_read)
 }
 
 // uint64 bytes_written = 3;
 inline void CompactionStats::clear_bytes_written() {
-  bytes_written_ = PROTOBUF_ULONGLONG(0);
+  _impl_.bytes_written_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 CompactionStats::_internal_bytes_written() const {
-  return bytes_written_;
+inline uint64_t CompactionStats::_internal_bytes_written() const {
+  return _impl_.bytes_written_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 CompactionStats::bytes_written() const {
+inline uint64_t CompactionStats::bytes_written() const {
   // @@protoc_insertion_point(field_get:kvdb.CompactionStats.bytes_written)
   return _internal_bytes_written();
 }
-inline void CompactionStats::_internal_set_bytes_written(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void CompactionStats::_internal_set_bytes_written(uint64_t value) {
   
-  bytes_written_ = value;
+  _impl_.bytes_written_ = value;
 }
-inline void CompactionStats::set_bytes_written(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void CompactionStats::set_bytes_written(uint64_t value) {
   _internal_set_bytes_written(value);
   // @@protoc_insertion_point(field_set:kvdb.CompactionStats.bytes_written)
 }
 
 // double write_amplification = 4;
 inline void CompactionStats::clear_write_amplification() {
-  write_amplification_ = 0;
+  _impl_.write_amplification_ = 0;
 }
 inline double CompactionStats::_internal_write_amplification() const {
-  return write_amplification_;
+  return _impl_.write_amplification_;
 }
 inline double CompactionStats::write_amplification() const {
   // @@protoc_insertion_point(field_get:kvdb.CompactionStats.write_amplification)
@@ -8351,7 +7684,7 @@ inline double CompactionStats::write_amplification() const {
 }
 inline void CompactionStats::_internal_set_write_amplification(double value) {
   
-  write_amplification_ = value;
+  _impl_.write_amplification_ = value;
 }
 inline void CompactionStats::set_write_amplification(double value) {
   _internal_set_write_amplification(value);
@@ -8360,20 +7693,20 @@ inline void CompactionStats::set_write_amplification(double value) {
 
 // uint64 total_time_ms = 5;
 inline void CompactionStats::clear_total_time_ms() {
-  total_time_ms_ = PROTOBUF_ULONGLONG(0);
+  _impl_.total_time_ms_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 CompactionStats::_internal_total_time_ms() const {
-  return total_time_ms_;
+inline uint64_t CompactionStats::_internal_total_time_ms() const {
+  return _impl_.total_time_ms_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 CompactionStats::total_time_ms() const {
+inline uint64_t CompactionStats::total_time_ms() const {
   // @@protoc_insertion_point(field_get:kvdb.CompactionStats.total_time_ms)
   return _internal_total_time_ms();
 }
-inline void CompactionStats::_internal_set_total_time_ms(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void CompactionStats::_internal_set_total_time_ms(uint64_t value) {
   
-  total_time_ms_ = value;
+  _impl_.total_time_ms_ = value;
 }
-inline void CompactionStats::set_total_time_ms(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void CompactionStats::set_total_time_ms(uint64_t value) {
   _internal_set_total_time_ms(value);
   // @@protoc_insertion_point(field_set:kvdb.CompactionStats.total_time_ms)
 }
@@ -8384,10 +7717,10 @@ inline void CompactionStats::set_total_time_ms(::PROTOBUF_NAMESPACE_ID::uint64 v
 
 // .kvdb.CompactionStrategyType strategy = 1;
 inline void SetCompactionStrategyRequest::clear_strategy() {
-  strategy_ = 0;
+  _impl_.strategy_ = 0;
 }
 inline ::kvdb::CompactionStrategyType SetCompactionStrategyRequest::_internal_strategy() const {
-  return static_cast< ::kvdb::CompactionStrategyType >(strategy_);
+  return static_cast< ::kvdb::CompactionStrategyType >(_impl_.strategy_);
 }
 inline ::kvdb::CompactionStrategyType SetCompactionStrategyRequest::strategy() const {
   // @@protoc_insertion_point(field_get:kvdb.SetCompactionStrategyRequest.strategy)
@@ -8395,7 +7728,7 @@ inline ::kvdb::CompactionStrategyType SetCompactionStrategyRequest::strategy() c
 }
 inline void SetCompactionStrategyRequest::_internal_set_strategy(::kvdb::CompactionStrategyType value) {
   
-  strategy_ = value;
+  _impl_.strategy_ = value;
 }
 inline void SetCompactionStrategyRequest::set_strategy(::kvdb::CompactionStrategyType value) {
   _internal_set_strategy(value);
@@ -8408,10 +7741,10 @@ inline void SetCompactionStrategyRequest::set_strategy(::kvdb::CompactionStrateg
 
 // bool success = 1;
 inline void SetCompactionStrategyResponse::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
 }
 inline bool SetCompactionStrategyResponse::_internal_success() const {
-  return success_;
+  return _impl_.success_;
 }
 inline bool SetCompactionStrategyResponse::success() const {
   // @@protoc_insertion_point(field_get:kvdb.SetCompactionStrategyResponse.success)
@@ -8419,7 +7752,7 @@ inline bool SetCompactionStrategyResponse::success() const {
 }
 inline void SetCompactionStrategyResponse::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
 }
 inline void SetCompactionStrategyResponse::set_success(bool value) {
   _internal_set_success(value);
@@ -8428,54 +7761,38 @@ inline void SetCompactionStrategyResponse::set_success(bool value) {
 
 // string error_message = 2;
 inline void SetCompactionStrategyResponse::clear_error_message() {
-  error_message_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.error_message_.ClearToEmpty();
 }
 inline const std::string& SetCompactionStrategyResponse::error_message() const {
   // @@protoc_insertion_point(field_get:kvdb.SetCompactionStrategyResponse.error_message)
   return _internal_error_message();
 }
-inline void SetCompactionStrategyResponse::set_error_message(const std::string& value) {
-  _internal_set_error_message(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SetCompactionStrategyResponse::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.SetCompactionStrategyResponse.error_message)
 }
 inline std::string* SetCompactionStrategyResponse::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
   // @@protoc_insertion_point(field_mutable:kvdb.SetCompactionStrategyResponse.error_message)
-  return _internal_mutable_error_message();
+  return _s;
 }
 inline const std::string& SetCompactionStrategyResponse::_internal_error_message() const {
-  return error_message_.Get();
+  return _impl_.error_message_.Get();
 }
 inline void SetCompactionStrategyResponse::_internal_set_error_message(const std::string& value) {
   
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void SetCompactionStrategyResponse::set_error_message(std::string&& value) {
-  
-  error_message_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.SetCompactionStrategyResponse.error_message)
-}
-inline void SetCompactionStrategyResponse::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.SetCompactionStrategyResponse.error_message)
-}
-inline void SetCompactionStrategyResponse::set_error_message(const char* value,
-    size_t size) {
-  
-  error_message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.SetCompactionStrategyResponse.error_message)
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
 inline std::string* SetCompactionStrategyResponse::_internal_mutable_error_message() {
   
-  return error_message_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* SetCompactionStrategyResponse::release_error_message() {
   // @@protoc_insertion_point(field_release:kvdb.SetCompactionStrategyResponse.error_message)
-  return error_message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.error_message_.Release();
 }
 inline void SetCompactionStrategyResponse::set_allocated_error_message(std::string* error_message) {
   if (error_message != nullptr) {
@@ -8483,28 +7800,13 @@ inline void SetCompactionStrategyResponse::set_allocated_error_message(std::stri
   } else {
     
   }
-  error_message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), error_message,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.SetCompactionStrategyResponse.error_message)
-}
-inline std::string* SetCompactionStrategyResponse::unsafe_arena_release_error_message() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.SetCompactionStrategyResponse.error_message)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return error_message_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void SetCompactionStrategyResponse::unsafe_arena_set_allocated_error_message(
-    std::string* error_message) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (error_message != nullptr) {
-    
-  } else {
-    
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
   }
-  error_message_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      error_message, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.SetCompactionStrategyResponse.error_message)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.SetCompactionStrategyResponse.error_message)
 }
 
 // -------------------------------------------------------------------
@@ -8513,54 +7815,38 @@ inline void SetCompactionStrategyResponse::unsafe_arena_set_allocated_error_mess
 
 // string key_pattern = 1;
 inline void SubscribeRequest::clear_key_pattern() {
-  key_pattern_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.key_pattern_.ClearToEmpty();
 }
 inline const std::string& SubscribeRequest::key_pattern() const {
   // @@protoc_insertion_point(field_get:kvdb.SubscribeRequest.key_pattern)
   return _internal_key_pattern();
 }
-inline void SubscribeRequest::set_key_pattern(const std::string& value) {
-  _internal_set_key_pattern(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubscribeRequest::set_key_pattern(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_pattern_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.SubscribeRequest.key_pattern)
 }
 inline std::string* SubscribeRequest::mutable_key_pattern() {
+  std::string* _s = _internal_mutable_key_pattern();
   // @@protoc_insertion_point(field_mutable:kvdb.SubscribeRequest.key_pattern)
-  return _internal_mutable_key_pattern();
+  return _s;
 }
 inline const std::string& SubscribeRequest::_internal_key_pattern() const {
-  return key_pattern_.Get();
+  return _impl_.key_pattern_.Get();
 }
 inline void SubscribeRequest::_internal_set_key_pattern(const std::string& value) {
   
-  key_pattern_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void SubscribeRequest::set_key_pattern(std::string&& value) {
-  
-  key_pattern_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.SubscribeRequest.key_pattern)
-}
-inline void SubscribeRequest::set_key_pattern(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  key_pattern_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.SubscribeRequest.key_pattern)
-}
-inline void SubscribeRequest::set_key_pattern(const char* value,
-    size_t size) {
-  
-  key_pattern_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.SubscribeRequest.key_pattern)
+  _impl_.key_pattern_.Set(value, GetArenaForAllocation());
 }
 inline std::string* SubscribeRequest::_internal_mutable_key_pattern() {
   
-  return key_pattern_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_pattern_.Mutable(GetArenaForAllocation());
 }
 inline std::string* SubscribeRequest::release_key_pattern() {
   // @@protoc_insertion_point(field_release:kvdb.SubscribeRequest.key_pattern)
-  return key_pattern_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_pattern_.Release();
 }
 inline void SubscribeRequest::set_allocated_key_pattern(std::string* key_pattern) {
   if (key_pattern != nullptr) {
@@ -8568,36 +7854,21 @@ inline void SubscribeRequest::set_allocated_key_pattern(std::string* key_pattern
   } else {
     
   }
-  key_pattern_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key_pattern,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.SubscribeRequest.key_pattern)
-}
-inline std::string* SubscribeRequest::unsafe_arena_release_key_pattern() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.SubscribeRequest.key_pattern)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return key_pattern_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void SubscribeRequest::unsafe_arena_set_allocated_key_pattern(
-    std::string* key_pattern) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (key_pattern != nullptr) {
-    
-  } else {
-    
+  _impl_.key_pattern_.SetAllocated(key_pattern, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_pattern_.IsDefault()) {
+    _impl_.key_pattern_.Set("", GetArenaForAllocation());
   }
-  key_pattern_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      key_pattern, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.SubscribeRequest.key_pattern)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.SubscribeRequest.key_pattern)
 }
 
 // bool include_deletes = 2;
 inline void SubscribeRequest::clear_include_deletes() {
-  include_deletes_ = false;
+  _impl_.include_deletes_ = false;
 }
 inline bool SubscribeRequest::_internal_include_deletes() const {
-  return include_deletes_;
+  return _impl_.include_deletes_;
 }
 inline bool SubscribeRequest::include_deletes() const {
   // @@protoc_insertion_point(field_get:kvdb.SubscribeRequest.include_deletes)
@@ -8605,7 +7876,7 @@ inline bool SubscribeRequest::include_deletes() const {
 }
 inline void SubscribeRequest::_internal_set_include_deletes(bool value) {
   
-  include_deletes_ = value;
+  _impl_.include_deletes_ = value;
 }
 inline void SubscribeRequest::set_include_deletes(bool value) {
   _internal_set_include_deletes(value);
@@ -8618,54 +7889,38 @@ inline void SubscribeRequest::set_include_deletes(bool value) {
 
 // string key = 1;
 inline void SubscribeResponse::clear_key() {
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.key_.ClearToEmpty();
 }
 inline const std::string& SubscribeResponse::key() const {
   // @@protoc_insertion_point(field_get:kvdb.SubscribeResponse.key)
   return _internal_key();
 }
-inline void SubscribeResponse::set_key(const std::string& value) {
-  _internal_set_key(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubscribeResponse::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.SubscribeResponse.key)
 }
 inline std::string* SubscribeResponse::mutable_key() {
+  std::string* _s = _internal_mutable_key();
   // @@protoc_insertion_point(field_mutable:kvdb.SubscribeResponse.key)
-  return _internal_mutable_key();
+  return _s;
 }
 inline const std::string& SubscribeResponse::_internal_key() const {
-  return key_.Get();
+  return _impl_.key_.Get();
 }
 inline void SubscribeResponse::_internal_set_key(const std::string& value) {
   
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void SubscribeResponse::set_key(std::string&& value) {
-  
-  key_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.SubscribeResponse.key)
-}
-inline void SubscribeResponse::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.SubscribeResponse.key)
-}
-inline void SubscribeResponse::set_key(const char* value,
-    size_t size) {
-  
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.SubscribeResponse.key)
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
 inline std::string* SubscribeResponse::_internal_mutable_key() {
   
-  return key_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
 inline std::string* SubscribeResponse::release_key() {
   // @@protoc_insertion_point(field_release:kvdb.SubscribeResponse.key)
-  return key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Release();
 }
 inline void SubscribeResponse::set_allocated_key(std::string* key) {
   if (key != nullptr) {
@@ -8673,80 +7928,49 @@ inline void SubscribeResponse::set_allocated_key(std::string* key) {
   } else {
     
   }
-  key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.SubscribeResponse.key)
-}
-inline std::string* SubscribeResponse::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.SubscribeResponse.key)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return key_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void SubscribeResponse::unsafe_arena_set_allocated_key(
-    std::string* key) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (key != nullptr) {
-    
-  } else {
-    
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
   }
-  key_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      key, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.SubscribeResponse.key)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.SubscribeResponse.key)
 }
 
 // string value = 2;
 inline void SubscribeResponse::clear_value() {
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.value_.ClearToEmpty();
 }
 inline const std::string& SubscribeResponse::value() const {
   // @@protoc_insertion_point(field_get:kvdb.SubscribeResponse.value)
   return _internal_value();
 }
-inline void SubscribeResponse::set_value(const std::string& value) {
-  _internal_set_value(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubscribeResponse::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.SubscribeResponse.value)
 }
 inline std::string* SubscribeResponse::mutable_value() {
+  std::string* _s = _internal_mutable_value();
   // @@protoc_insertion_point(field_mutable:kvdb.SubscribeResponse.value)
-  return _internal_mutable_value();
+  return _s;
 }
 inline const std::string& SubscribeResponse::_internal_value() const {
-  return value_.Get();
+  return _impl_.value_.Get();
 }
 inline void SubscribeResponse::_internal_set_value(const std::string& value) {
   
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void SubscribeResponse::set_value(std::string&& value) {
-  
-  value_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.SubscribeResponse.value)
-}
-inline void SubscribeResponse::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.SubscribeResponse.value)
-}
-inline void SubscribeResponse::set_value(const char* value,
-    size_t size) {
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.SubscribeResponse.value)
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
 inline std::string* SubscribeResponse::_internal_mutable_value() {
   
-  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
 inline std::string* SubscribeResponse::release_value() {
   // @@protoc_insertion_point(field_release:kvdb.SubscribeResponse.value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Release();
 }
 inline void SubscribeResponse::set_allocated_value(std::string* value) {
   if (value != nullptr) {
@@ -8754,80 +7978,49 @@ inline void SubscribeResponse::set_allocated_value(std::string* value) {
   } else {
     
   }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.SubscribeResponse.value)
-}
-inline std::string* SubscribeResponse::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.SubscribeResponse.value)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void SubscribeResponse::unsafe_arena_set_allocated_value(
-    std::string* value) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (value != nullptr) {
-    
-  } else {
-    
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
   }
-  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.SubscribeResponse.value)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.SubscribeResponse.value)
 }
 
 // string operation = 3;
 inline void SubscribeResponse::clear_operation() {
-  operation_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.operation_.ClearToEmpty();
 }
 inline const std::string& SubscribeResponse::operation() const {
   // @@protoc_insertion_point(field_get:kvdb.SubscribeResponse.operation)
   return _internal_operation();
 }
-inline void SubscribeResponse::set_operation(const std::string& value) {
-  _internal_set_operation(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubscribeResponse::set_operation(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.operation_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kvdb.SubscribeResponse.operation)
 }
 inline std::string* SubscribeResponse::mutable_operation() {
+  std::string* _s = _internal_mutable_operation();
   // @@protoc_insertion_point(field_mutable:kvdb.SubscribeResponse.operation)
-  return _internal_mutable_operation();
+  return _s;
 }
 inline const std::string& SubscribeResponse::_internal_operation() const {
-  return operation_.Get();
+  return _impl_.operation_.Get();
 }
 inline void SubscribeResponse::_internal_set_operation(const std::string& value) {
   
-  operation_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void SubscribeResponse::set_operation(std::string&& value) {
-  
-  operation_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:kvdb.SubscribeResponse.operation)
-}
-inline void SubscribeResponse::set_operation(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  operation_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:kvdb.SubscribeResponse.operation)
-}
-inline void SubscribeResponse::set_operation(const char* value,
-    size_t size) {
-  
-  operation_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:kvdb.SubscribeResponse.operation)
+  _impl_.operation_.Set(value, GetArenaForAllocation());
 }
 inline std::string* SubscribeResponse::_internal_mutable_operation() {
   
-  return operation_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.operation_.Mutable(GetArenaForAllocation());
 }
 inline std::string* SubscribeResponse::release_operation() {
   // @@protoc_insertion_point(field_release:kvdb.SubscribeResponse.operation)
-  return operation_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.operation_.Release();
 }
 inline void SubscribeResponse::set_allocated_operation(std::string* operation) {
   if (operation != nullptr) {
@@ -8835,50 +8028,55 @@ inline void SubscribeResponse::set_allocated_operation(std::string* operation) {
   } else {
     
   }
-  operation_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), operation,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:kvdb.SubscribeResponse.operation)
-}
-inline std::string* SubscribeResponse::unsafe_arena_release_operation() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:kvdb.SubscribeResponse.operation)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return operation_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void SubscribeResponse::unsafe_arena_set_allocated_operation(
-    std::string* operation) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (operation != nullptr) {
-    
-  } else {
-    
+  _impl_.operation_.SetAllocated(operation, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.operation_.IsDefault()) {
+    _impl_.operation_.Set("", GetArenaForAllocation());
   }
-  operation_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      operation, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvdb.SubscribeResponse.operation)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvdb.SubscribeResponse.operation)
 }
 
 // uint64 timestamp = 4;
 inline void SubscribeResponse::clear_timestamp() {
-  timestamp_ = PROTOBUF_ULONGLONG(0);
+  _impl_.timestamp_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 SubscribeResponse::_internal_timestamp() const {
-  return timestamp_;
+inline uint64_t SubscribeResponse::_internal_timestamp() const {
+  return _impl_.timestamp_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 SubscribeResponse::timestamp() const {
+inline uint64_t SubscribeResponse::timestamp() const {
   // @@protoc_insertion_point(field_get:kvdb.SubscribeResponse.timestamp)
   return _internal_timestamp();
 }
-inline void SubscribeResponse::_internal_set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void SubscribeResponse::_internal_set_timestamp(uint64_t value) {
   
-  timestamp_ = value;
+  _impl_.timestamp_ = value;
 }
-inline void SubscribeResponse::set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void SubscribeResponse::set_timestamp(uint64_t value) {
   _internal_set_timestamp(value);
   // @@protoc_insertion_point(field_set:kvdb.SubscribeResponse.timestamp)
 }
 
+// uint64 dropped_events = 5;
+inline void SubscribeResponse::clear_dropped_events() {
+  _impl_.dropped_events_ = uint64_t{0u};
+}
+inline uint64_t SubscribeResponse::_internal_dropped_events() const {
+  return _impl_.dropped_events_;
+}
+inline uint64_t SubscribeResponse::dropped_events() const {
+  // @@protoc_insertion_point(field_get:kvdb.SubscribeResponse.dropped_events)
+  return _internal_dropped_events();
+}
+inline void SubscribeResponse::_internal_set_dropped_events(uint64_t value) {
+  
+  _impl_.dropped_events_ = value;
+}
+inline void SubscribeResponse::set_dropped_events(uint64_t value) {
+  _internal_set_dropped_events(value);
+  // @@protoc_insertion_point(field_set:kvdb.SubscribeResponse.dropped_events)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -8962,4 +8160,4 @@ PROTOBUF_NAMESPACE_CLOSE
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
-#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_proto_2fkvdb_2eproto
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_kvdb_2eproto
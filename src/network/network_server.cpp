@@ -1,7 +1,8 @@
 #include "network/network_server.h"
 #include <iostream>
 
-NetworkServer::NetworkServer(KVDB& db) : db_(db) {
+NetworkServer::NetworkServer(KVDB& db)
+    : db_(db), notifier_(std::make_shared<ChangeNotifier>()) {
 }
 
 NetworkServer::~NetworkServer() {
@@ -11,7 +12,9 @@ NetworkServer::~NetworkServer() {
 void NetworkServer::start_grpc(const std::string& address) {
     if (!grpc_running_) {
         try {
-            grpc_server_ = std::make_unique<GRPCServer>(db_, address);
+            GRPCServerOptions options;
+            options.notifier = notifier_;
+            grpc_server_ = std::make_unique<GRPCServer>(db_, address, options);
             grpc_server_->start();
             grpc_running_ = true;
             std::cout << "[NetworkServer] gRPC service started on " << address << std::endl;
@@ -24,7 +27,7 @@ void NetworkServer::start_grpc(const std::string& address) {
 void NetworkServer::start_websocket(uint16_t port) {
     if (!websocket_running_) {
         try {
-            websocket_server_ = std::make_unique<WebSocketHandler>(db_);
+            websocket_server_ = std::make_unique<WebSocketHandler>(db_, notifier_);
             websocket_server_->start(port);
             websocket_running_ = true;
             std::cout << "[NetworkServer] WebSocket service started on port " << port << std::endl;
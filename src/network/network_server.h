@@ -30,6 +30,9 @@ public:
 
 private:
     KVDB& db_;
+
+    // 两个服务共用的变更通知器：任一协议的写入都会通知两边的订阅者
+    std::shared_ptr<ChangeNotifier> notifier_;
     
     // gRPC 服务
     std::unique_ptr<GRPCServer> grpc_server_;
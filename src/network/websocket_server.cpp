@@ -1,9 +1,9 @@
 #include "network/websocket_server.h"
 #include <iostream>
 #include <chrono>
-#include <regex>
 
-WebSocketHandler::WebSocketHandler(KVDB& db) : db_(db) {
+WebSocketHandler::WebSocketHandler(KVDB& db, std::shared_ptr<ChangeNotifier> notifier)
+    : db_(db), subscriptions_(notifier ? std::move(notifier) : std::make_shared<ChangeNotifier>()) {
     // 设置日志级别
     server_.set_access_channels(websocketpp::log::alevel::all);
     server_.clear_access_channels(websocketpp::log::alevel::frame_payload);
@@ -51,6 +51,9 @@ void WebSocketHandler::stop() {
         if (server_thread_.joinable()) {
             server_thread_.join();
         }
+
+        // 通知器可能与 gRPC 共用，退订后不会再有投递回调引用本对象
+        subscriptions_.close_all();
         
         std::cout << "[WebSocket] Server stopped" << std::endl;
     }
@@ -65,22 +68,12 @@ void WebSocketHandler::run_server() {
 }
 
 void WebSocketHandler::on_open(connection_hdl hdl) {
-    std::lock_guard<std::mutex> lock(connections_mutex_);
-    connections_.insert(hdl);
+    subscriptions_.open(hdl);
     std::cout << "[WebSocket] Client connected" << std::endl;
 }
 
 void WebSocketHandler::on_close(connection_hdl hdl) {
-    {
-        std::lock_guard<std::mutex> lock(connections_mutex_);
-        connections_.erase(hdl);
-    }
-    
-    {
-        std::lock_guard<std::mutex> lock(subscriptions_mutex_);
-        subscriptions_.erase(hdl);
-    }
-    
+    subscriptions_.close(hdl);
     std::cout << "[WebSocket] Client disconnected" << std::endl;
 }
 
@@ -94,7 +87,7 @@ void WebSocketHandler::on_message(connection_hdl hdl, message_ptr msg) {
             return;
         }
         
-        Json::Value response = handle_request(request);
+        Json::Value response = handle_request(hdl, request);
         send_message(hdl, response);
         
     } catch (const std::exception& e) {
@@ -102,7 +95,7 @@ void WebSocketHandler::on_message(connection_hdl hdl, message_ptr msg) {
     }
 }
 
-Json::Value WebSocketHandler::handle_request(const Json::Value& request) {
+Json::Value WebSocketHandler::handle_request(connection_hdl hdl, const Json::Value& request) {
     if (!request.isMember("method") || !request["method"].isString()) {
         return create_error_response("Missing or invalid method");
     }
@@ -138,6 +131,10 @@ Json::Value WebSocketHandler::handle_request(const Json::Value& request) {
         return handle_get_stats(params);
     } else if (method == "set_compaction_strategy") {
         return handle_set_compaction_strategy(params);
+    } else if (method == "subscribe") {
+        return handle_subscribe(hdl, params);
+    } else if (method == "unsubscribe") {
+        return handle_unsubscribe(hdl, params);
     } else {
         return create_error_response("Unknown method: " + method);
     }
@@ -153,7 +150,7 @@ Json::Value WebSocketHandler::handle_put(const Json::Value& params) {
     
     bool success = db_.put(key, value);
     if (success) {
-        notify_subscribers(key, value, "PUT");
+        publish(key, value, "PUT");
     }
     
     Json::Value result;
@@ -187,7 +184,7 @@ Json::Value WebSocketHandler::handle_delete(const Json::Value& params) {
     bool success = db_.del(key);
     
     if (success) {
-        notify_subscribers(key, "", "DELETE");
+        publish(key, "", "DELETE");
     }
     
     Json::Value result;
@@ -208,7 +205,7 @@ Json::Value WebSocketHandler::handle_batch_put(const Json::Value& params) {
             
             if (db_.put(key, value)) {
                 processed++;
-                notify_subscribers(key, value, "PUT");
+                publish(key, value, "PUT");
             }
         }
     }
@@ -420,48 +417,89 @@ Json::Value WebSocketHandler::handle_set_compaction_strategy(const Json::Value&
     return create_success_response(result);
 }
 
-void WebSocketHandler::notify_subscribers(const std::string& key, const std::string& value, const std::string& operation) {
-    std::lock_guard<std::mutex> lock(subscriptions_mutex_);
-    
-    auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
-        std::chrono::system_clock::now().time_since_epoch()).count();
-    
-    for (auto& [hdl, subs] : subscriptions_) {
-        for (const auto& sub : subs) {
-            if (matches_pattern(key, sub.pattern) && 
-                (sub.include_deletes || operation != "DELETE")) {
-                
-                Json::Value notification;
-                notification["type"] = "notification";
-                notification["key"] = key;
-                notification["value"] = value;
-                notification["operation"] = operation;
-                notification["timestamp"] = static_cast<Json::UInt64>(now);
-                
-                try {
-                    send_message(hdl, notification);
-                } catch (...) {
-                    // 连接已断开，将在下次清理时移除
-                }
-            }
-        }
+Json::Value WebSocketHandler::handle_subscribe(connection_hdl hdl, const Json::Value& params) {
+    if (!params.isMember("pattern")) {
+        return create_error_response("Missing pattern");
+    }
+
+    std::string pattern = params["pattern"].asString();
+    bool include_deletes = params.get("include_deletes", false).asBool();
+
+    // 通知线程只负责把发送调度到 ASIO 线程，不在通知线程上发送
+    uint64_t id = subscriptions_.subscribe(hdl, pattern, include_deletes, [this, hdl] {
+        server_.get_io_service().post([this, hdl] { flush_notifications(hdl); });
+    });
+    if (id == 0) {
+        return create_error_response("Connection closed");
     }
+
+    Json::Value result;
+    result["subscription_id"] = static_cast<Json::UInt64>(id);
+    return create_success_response(result);
 }
 
-bool WebSocketHandler::matches_pattern(const std::string& key, const std::string& pattern) {
-    if (pattern == "*") return true;
-    if (pattern.empty()) return key.empty();
-    
-    // 简单的通配符匹配
-    try {
-        std::string regex_pattern = pattern;
-        std::replace(regex_pattern.begin(), regex_pattern.end(), '*', '.');
-        regex_pattern = "^" + regex_pattern + "$";
-        std::regex re(regex_pattern);
-        return std::regex_match(key, re);
-    } catch (...) {
-        // 如果正则表达式无效，使用前缀匹配
-        return key.find(pattern) == 0;
+Json::Value WebSocketHandler::handle_unsubscribe(connection_hdl hdl, const Json::Value& params) {
+    if (!params.isMember("subscription_id")) {
+        return create_error_response("Missing subscription_id");
+    }
+
+    uint64_t id = params["subscription_id"].asUInt64();
+    if (!subscriptions_.unsubscribe(hdl, id)) {
+        return create_error_response("Unknown subscription_id");
+    }
+
+    Json::Value result;
+    result["success"] = true;
+    return create_success_response(result);
+}
+
+void WebSocketHandler::publish(const std::string& key, const std::string& value, const std::string& operation) {
+    subscriptions_.notifier().publish(key, value, operation);
+}
+
+void WebSocketHandler::flush_notifications(connection_hdl hdl) {
+    std::shared_ptr<OutboundQueue> queue = subscriptions_.queue(hdl);
+    if (!queue) {
+        return;
+    }
+
+    websocketpp::lib::error_code ec;
+    auto connection = server_.get_con_from_hdl(hdl, ec);
+    if (ec) {
+        return;
+    }
+
+    std::vector<ChangeEventPtr> events;
+    uint64_t dropped = 0;
+    while (true) {
+        // 客户端读得慢：暂不取队列，稍后重试；期间同一 key 的事件在队列里合并，超出容量的计入丢弃
+        if (connection->get_buffered_amount() > MAX_BUFFERED_BYTES) {
+            server_.set_timer(FLUSH_RETRY_MS, [this, hdl](const websocketpp::lib::error_code& timer_ec) {
+                if (!timer_ec) {
+                    flush_notifications(hdl);
+                }
+            });
+            return;
+        }
+        if (!queue->drain(events, dropped)) {
+            return;
+        }
+
+        if (dropped > 0) {
+            Json::Value lagged;
+            lagged["type"] = "lagged";
+            lagged["dropped_events"] = static_cast<Json::UInt64>(dropped);
+            send_message(hdl, lagged);
+        }
+        for (const auto& event : events) {
+            Json::Value notification;
+            notification["type"] = "notification";
+            notification["key"] = event->key;
+            notification["value"] = event->value;
+            notification["operation"] = event->operation;
+            notification["timestamp"] = static_cast<Json::UInt64>(event->timestamp);
+            send_message(hdl, notification);
+        }
     }
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "db/kv_db.h"
+#include "network/change_notifier.h"
 #include <websocketpp/config/asio_no_tls.hpp>
 #include <websocketpp/server.hpp>
 #include <jsoncpp/json/json.h>
@@ -7,8 +8,7 @@
 #include <thread>
 #include <atomic>
 #include <mutex>
-#include <unordered_map>
-#include <unordered_set>
+#include <vector>
 
 typedef websocketpp::server<websocketpp::config::asio> WebSocketServer;
 typedef WebSocketServer::message_ptr message_ptr;
@@ -16,7 +16,8 @@ typedef websocketpp::connection_hdl connection_hdl;
 
 class WebSocketHandler {
 public:
-    explicit WebSocketHandler(KVDB& db);
+    // notifier 为空时自建一个；与 gRPC 服务共用时传入同一个
+    explicit WebSocketHandler(KVDB& db, std::shared_ptr<ChangeNotifier> notifier = nullptr);
     ~WebSocketHandler();
 
     void start(uint16_t port = 8080);
@@ -28,20 +29,11 @@ private:
     std::thread server_thread_;
     std::atomic<bool> running_{false};
     
-    // 连接管理
-    std::mutex connections_mutex_;
-    std::unordered_set<connection_hdl, std::owner_less<connection_hdl>> connections_;
-    
-    // 订阅管理
-    struct Subscription {
-        std::string pattern;
-        bool include_deletes;
-        connection_hdl connection;
-    };
-    
-    std::mutex subscriptions_mutex_;
-    std::unordered_map<connection_hdl, std::vector<Subscription>, 
-                       std::owner_less<connection_hdl>> subscriptions_;
+    // 连接与订阅登记：订阅匹配在通知器线程完成，通知在 ASIO 线程上从连接的发送队列取出发送
+    ConnectionSubscriptions subscriptions_;
+    // 连接已缓冲未发出的字节超过此值时暂停取队列，积压的事件在队列中合并或计入丢弃
+    static constexpr size_t MAX_BUFFERED_BYTES = 1024 * 1024;
+    static constexpr long FLUSH_RETRY_MS = 10;
 
     // WebSocket 事件处理
     void on_open(connection_hdl hdl);
@@ -49,7 +41,7 @@ private:
     void on_message(connection_hdl hdl, message_ptr msg);
 
     // 消息处理
-    Json::Value handle_request(const Json::Value& request);
+    Json::Value handle_request(connection_hdl hdl, const Json::Value& request);
     Json::Value handle_put(const Json::Value& params);
     Json::Value handle_get(const Json::Value& params);
     Json::Value handle_delete(const Json::Value& params);
@@ -68,8 +60,8 @@ private:
     Json::Value handle_unsubscribe(connection_hdl hdl, const Json::Value& params);
 
     // 订阅通知
-    void notify_subscribers(const std::string& key, const std::string& value, const std::string& operation);
-    bool matches_pattern(const std::string& key, const std::string& pattern);
+    void publish(const std::string& key, const std::string& value, const std::string& operation);
+    void flush_notifications(connection_hdl hdl);
 
     // 辅助方法
     Json::Value create_error_response(const std::string& error_message);
@@ -1,7 +1,9 @@
 #include "data_migration_manager.h"
 #include "../db/kv_db.h"
 #include "../storage/json_serializer.h"
+#include "../sstable/sst_file_writer.h"
 #include <fstream>
+#include <iostream>
 #include <sstream>
 #include <random>
 #include <iomanip>
@@ -11,6 +13,18 @@
 namespace kvdb {
 namespace ops {
 
+// 二进制导出文件：魔数 + 记录流 + [END_MARKER][u64 记录数][u64 记录流 FNV-1a 校验和]
+static const char BINARY_MAGIC[] = "KVDBBIN1";
+static constexpr uint64_t FNV_OFFSET = 14695981039346656037ULL;
+
+static uint64_t fnv1a(uint64_t hash, const char* data, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
 DataMigrationManager::DataMigrationManager() : shutdown_(false) {
     // 启动工作线程池
     size_t num_threads = std::thread::hardware_concurrency();
@@ -51,13 +65,14 @@ std::string DataMigrationManager::export_data(const std::string& db_path,
     
     // 异步执行导出任务
     std::thread([this, task_id, db_path, output_path, format, config, callback]() {
-        std::unique_ptr<MigrationTask> task;
+        // 任务对象留在 tasks_ 中，运行期间仍可查询状态、暂停和取消
+        MigrationTask* task;
         {
             std::lock_guard<std::mutex> lock(tasks_mutex_);
-            task = std::move(tasks_[task_id]);
+            task = tasks_[task_id].get();
         }
         
-        run_export_task(std::move(task), db_path, format, config, callback);
+        run_export_task(task, db_path, format, config, callback);
     }).detach();
     
     return task_id;
@@ -92,13 +107,14 @@ std::string DataMigrationManager::import_data(const std::string& input_path,
     
     // 异步执行导入任务
     std::thread([this, task_id, input_path, db_path, format, config, callback]() {
-        std::unique_ptr<MigrationTask> task;
+        // 任务对象留在 tasks_ 中，运行期间仍可查询状态、暂停和取消
+        MigrationTask* task;
         {
             std::lock_guard<std::mutex> lock(tasks_mutex_);
-            task = std::move(tasks_[task_id]);
+            task = tasks_[task_id].get();
         }
         
-        run_import_task(std::move(task), db_path, format, config, callback);
+        run_import_task(task, db_path, format, config, callback);
     }).detach();
     
     return task_id;
@@ -124,13 +140,14 @@ std::string DataMigrationManager::migrate_database(const std::string& source_db,
     
     // 异步执行迁移任务
     std::thread([this, task_id, source_db, target_db, config, callback]() {
-        std::unique_ptr<MigrationTask> task;
+        // 任务对象留在 tasks_ 中，运行期间仍可查询状态、暂停和取消
+        MigrationTask* task;
         {
             std::lock_guard<std::mutex> lock(tasks_mutex_);
-            task = std::move(tasks_[task_id]);
+            task = tasks_[task_id].get();
         }
         
-        run_migration_task(std::move(task), source_db, target_db, config, callback);
+        run_migration_task(task, source_db, target_db, config, callback);
     }).detach();
     
     return task_id;
@@ -199,7 +216,7 @@ std::string DataMigrationManager::generate_task_id() {
     return ss.str();
 }
 
-void DataMigrationManager::run_export_task(std::unique_ptr<MigrationTask> task,
+void DataMigrationManager::run_export_task(MigrationTask* task,
                                           const std::string& db_path,
                                           ExportFormat format,
                                           const MigrationConfig& config,
@@ -210,10 +227,13 @@ void DataMigrationManager::run_export_task(std::unique_ptr<MigrationTask> task,
     try {
         switch (format) {
             case ExportFormat::JSON:
-                success = export_to_json(db_path, task->target_path, config, task.get());
+                success = export_to_json(db_path, task->target_path, config, task);
                 break;
             case ExportFormat::CSV:
-                success = export_to_csv(db_path, task->target_path, config, task.get());
+                success = export_to_csv(db_path, task->target_path, config, task);
+                break;
+            case ExportFormat::BINARY:
+                success = export_to_binary(db_path, task->target_path, config, task);
                 break;
             default:
                 task->error_message = "Unsupported export format";
@@ -230,20 +250,188 @@ void DataMigrationManager::run_export_task(std::unique_ptr<MigrationTask> task,
     if (callback) {
         callback(*task);
     }
+}
+
+void DataMigrationManager::run_import_task(MigrationTask* task,
+                                          const std::string& db_path,
+                                          ImportFormat format,
+                                          const MigrationConfig& config,
+                                          ProgressCallback callback) {
+    task->status = MigrationStatus::RUNNING;
     
-    // 将任务放回管理器
-    {
-        std::lock_guard<std::mutex> lock(tasks_mutex_);
-        tasks_[task->task_id] = std::move(task);
+    bool success = false;
+    try {
+        switch (format) {
+            case ImportFormat::JSON:
+                success = import_from_json(task->source_path, db_path, config, task);
+                break;
+            case ImportFormat::CSV:
+                success = import_from_csv(task->source_path, db_path, config, task);
+                break;
+            case ImportFormat::BINARY:
+                success = import_from_binary(task->source_path, db_path, config, task);
+                break;
+            default:
+                task->error_message = "Unsupported import format";
+                break;
+        }
+    } catch (const std::exception& e) {
+        task->error_message = e.what();
+        success = false;
+    }
+    
+    task->status = success ? MigrationStatus::COMPLETED : MigrationStatus::FAILED;
+    task->end_time = std::chrono::system_clock::now();
+    
+    if (callback) {
+        callback(*task);
     }
 }
 
+void DataMigrationManager::run_migration_task(MigrationTask* task,
+                                             const std::string& source_db,
+                                             const std::string& target_db,
+                                             const MigrationConfig& config,
+                                             ProgressCallback callback) {
+    task->status = MigrationStatus::RUNNING;
+    
+    // 库间迁移 = 并行二进制导出 + SSTable 导入，中间文件放在临时目录
+    std::filesystem::create_directories(config.temp_dir);
+    std::string temp_file = (std::filesystem::path(config.temp_dir) / (task->task_id + ".bin")).string();
+    
+    bool success = false;
+    try {
+        success = export_to_binary(source_db, temp_file, config, task) &&
+                  import_from_binary(temp_file, target_db, config, task);
+    } catch (const std::exception& e) {
+        task->error_message = e.what();
+        success = false;
+    }
+    std::filesystem::remove(temp_file);
+    
+    task->status = success ? MigrationStatus::COMPLETED : MigrationStatus::FAILED;
+    task->end_time = std::chrono::system_clock::now();
+    
+    if (callback) {
+        callback(*task);
+    }
+}
+
+bool DataMigrationManager::wait_if_paused(MigrationTask* task) {
+    while (task->status == MigrationStatus::PAUSED) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    return task->status != MigrationStatus::CANCELLED;
+}
+
+bool DataMigrationManager::export_to_binary(const std::string& db_path,
+                                           const std::string& output_path,
+                                           const MigrationConfig& config,
+                                           MigrationTask* task) {
+    KVDB db(db_path);
+    
+    // 所有分片读同一个快照，导出结果是某一时刻的一致视图
+    Snapshot snapshot = db.get_snapshot();
+    
+    // 按 SSTable 边界切分键区间：[ "", s0 ), [s0, s1), ..., [s_last, +inf)
+    size_t num_ranges = std::max<size_t>(1, config.max_concurrent_tasks);
+    std::vector<std::string> split_keys = db.get_approximate_split_keys(num_ranges);
+    num_ranges = split_keys.size() + 1;
+    
+    std::vector<std::string> part_paths;
+    for (size_t i = 0; i < num_ranges; ++i) {
+        part_paths.push_back(output_path + ".part" + std::to_string(i));
+    }
+    
+    std::atomic<size_t> processed{0};
+    std::atomic<bool> failed{false};
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < num_ranges; ++i) {
+        workers.emplace_back([&, i]() {
+            ReadOptions options;
+            options.iterate_lower_bound = (i == 0) ? "" : split_keys[i - 1];
+            options.iterate_upper_bound = (i + 1 == num_ranges) ? "" : split_keys[i];
+            
+            std::ofstream out(part_paths[i], std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) {
+                failed = true;
+                return;
+            }
+            
+            auto iterator = db.new_iterator(snapshot, options);
+            size_t count = 0;
+            for (iterator->seek_to_first(); iterator->valid() && !failed; iterator->next()) {
+                if (++count % config.batch_size == 0 && !wait_if_paused(task)) {
+                    failed = true;
+                    return;
+                }
+                
+                Slice key = iterator->key_slice();
+                Slice value = iterator->value_slice();
+                if (!config.key_pattern.empty() &&
+                    key.to_string().find(config.key_pattern) == std::string::npos) {
+                    continue;
+                }
+                
+                binary_record::write(out, key.data(), static_cast<uint32_t>(key.size()),
+                                     value.data(), static_cast<uint32_t>(value.size()));
+                processed++;
+            }
+            if (!out) {
+                failed = true;
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    db.release_snapshot(snapshot);
+    
+    // 各分片按键区间有序，顺序拼接即全局有序；拼接时计算校验和
+    bool success = !failed;
+    if (success) {
+        std::ofstream output(output_path, std::ios::binary | std::ios::trunc);
+        if (!output.is_open()) {
+            task->error_message = "Cannot open output file: " + output_path;
+            success = false;
+        } else {
+            output.write(BINARY_MAGIC, sizeof(BINARY_MAGIC) - 1);
+            uint64_t checksum = FNV_OFFSET;
+            std::vector<char> chunk(1 << 16);
+            for (const auto& part : part_paths) {
+                std::ifstream in(part, std::ios::binary);
+                while (in.read(chunk.data(), chunk.size()) || in.gcount() > 0) {
+                    checksum = fnv1a(checksum, chunk.data(), static_cast<size_t>(in.gcount()));
+                    output.write(chunk.data(), in.gcount());
+                }
+            }
+            uint64_t count = processed.load();
+            uint32_t end_marker = binary_record::END_MARKER;
+            output.write(reinterpret_cast<const char*>(&end_marker), sizeof(end_marker));
+            output.write(reinterpret_cast<const char*>(&count), sizeof(count));
+            output.write(reinterpret_cast<const char*>(&checksum), sizeof(checksum));
+            success = static_cast<bool>(output);
+        }
+    } else if (task->error_message.empty()) {
+        task->error_message = task->status == MigrationStatus::CANCELLED
+            ? "Export cancelled" : "Failed to write export part files";
+    }
+    
+    for (const auto& part : part_paths) {
+        std::filesystem::remove(part);
+    }
+    
+    task->processed_records = processed.load();
+    task->total_records = processed.load();
+    return success;
+}
+
 bool DataMigrationManager::export_to_json(const std::string& db_path,
                                          const std::string& output_path,
                                          const MigrationConfig& config,
                                          MigrationTask* task) {
     try {
-        KvDB db(db_path);
+        KVDB db(db_path);
         std::ofstream output(output_path);
         if (!output.is_open()) {
             task->error_message = "Cannot open output file: " + output_path;
@@ -255,19 +443,15 @@ bool DataMigrationManager::export_to_json(const std::string& db_path,
         size_t count = 0;
         
         // 遍历数据库中的所有键值对
-        auto iterator = db.create_iterator();
+        Snapshot snapshot = db.get_snapshot();
+        auto iterator = db.new_iterator(snapshot);
         iterator->seek_to_first();
         
         while (iterator->valid()) {
-            if (task->status == MigrationStatus::CANCELLED) {
+            if (!wait_if_paused(task)) {
                 return false;
             }
             
-            // 暂停处理
-            while (task->status == MigrationStatus::PAUSED) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            }
-            
             std::string key = iterator->key();
             std::string value = iterator->value();
             
@@ -295,6 +479,7 @@ bool DataMigrationManager::export_to_json(const std::string& db_path,
             
             iterator->next();
         }
+        db.release_snapshot(snapshot);
         
         output << "\n]";
         output.close();
@@ -313,7 +498,7 @@ bool DataMigrationManager::export_to_csv(const std::string& db_path,
                                         const MigrationConfig& config,
                                         MigrationTask* task) {
     try {
-        KvDB db(db_path);
+        KVDB db(db_path);
         std::ofstream output(output_path);
         if (!output.is_open()) {
             task->error_message = "Cannot open output file: " + output_path;
@@ -324,18 +509,15 @@ bool DataMigrationManager::export_to_csv(const std::string& db_path,
         output << "key,value\n";
         
         size_t count = 0;
-        auto iterator = db.create_iterator();
+        Snapshot snapshot = db.get_snapshot();
+        auto iterator = db.new_iterator(snapshot);
         iterator->seek_to_first();
         
         while (iterator->valid()) {
-            if (task->status == MigrationStatus::CANCELLED) {
+            if (!wait_if_paused(task)) {
                 return false;
             }
             
-            while (task->status == MigrationStatus::PAUSED) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            }
-            
             std::string key = iterator->key();
             std::string value = iterator->value();
             
@@ -367,6 +549,7 @@ bool DataMigrationManager::export_to_csv(const std::string& db_path,
             
             iterator->next();
         }
+        db.release_snapshot(snapshot);
         
         output.close();
         task->total_records = count;
@@ -378,6 +561,242 @@ bool DataMigrationManager::export_to_csv(const std::string& db_path,
     }
 }
 
+bool DataMigrationManager::import_from_binary(const std::string& input_path,
+                                             const std::string& db_path,
+                                             const MigrationConfig& config,
+                                             MigrationTask* task) {
+    std::ifstream input(input_path, std::ios::binary);
+    if (!input.is_open()) {
+        task->error_message = "Cannot open input file: " + input_path;
+        return false;
+    }
+    
+    char magic[sizeof(BINARY_MAGIC) - 1];
+    if (!input.read(magic, sizeof(magic)) ||
+        std::string(magic, sizeof(magic)) != std::string(BINARY_MAGIC, sizeof(magic))) {
+        task->error_message = "Not a kvdb binary export: " + input_path;
+        return false;
+    }
+    
+    std::filesystem::create_directories(config.temp_dir);
+    ExternalSorter sorter((std::filesystem::path(config.temp_dir) / task->task_id).string(),
+                          config.sort_memory_limit);
+    
+    // 边读边排序，同时按导出时的方式重算校验和
+    uint64_t checksum = FNV_OFFSET;
+    size_t count = 0;
+    std::string key;
+    std::string value;
+    while (binary_record::read(input, key, value)) {
+        uint32_t key_len = static_cast<uint32_t>(key.size());
+        uint32_t value_len = static_cast<uint32_t>(value.size());
+        checksum = fnv1a(checksum, reinterpret_cast<const char*>(&key_len), sizeof(key_len));
+        checksum = fnv1a(checksum, key.data(), key.size());
+        checksum = fnv1a(checksum, reinterpret_cast<const char*>(&value_len), sizeof(value_len));
+        checksum = fnv1a(checksum, value.data(), value.size());
+        
+        if (!sorter.add(key, value)) {
+            task->error_message = "Failed to spill sort run";
+            return false;
+        }
+        if (++count % config.batch_size == 0 && !wait_if_paused(task)) {
+            return false;
+        }
+        task->processed_records = count;
+    }
+    
+    uint64_t expected_count = 0;
+    uint64_t expected_checksum = 0;
+    input.read(reinterpret_cast<char*>(&expected_count), sizeof(expected_count));
+    input.read(reinterpret_cast<char*>(&expected_checksum), sizeof(expected_checksum));
+    if (!input || expected_count != count ||
+        (config.enable_checksum && expected_checksum != checksum)) {
+        task->error_message = "Binary export is truncated or corrupted: " + input_path;
+        return false;
+    }
+    
+    task->total_records = count;
+    return ingest_sorted(sorter, db_path, config, task);
+}
+
+bool DataMigrationManager::import_from_json(const std::string& input_path,
+                                           const std::string& db_path,
+                                           const MigrationConfig& config,
+                                           MigrationTask* task) {
+    std::ifstream input(input_path);
+    if (!input.is_open()) {
+        task->error_message = "Cannot open input file: " + input_path;
+        return false;
+    }
+    
+    std::filesystem::create_directories(config.temp_dir);
+    ExternalSorter sorter((std::filesystem::path(config.temp_dir) / task->task_id).string(),
+                          config.sort_memory_limit);
+    
+    // 读取 export_to_json 写出的格式：每行一个 {"key": "...", "value": "..."}
+    auto extract = [](const std::string& line, const std::string& field, std::string& out) {
+        size_t pos = line.find("\"" + field + "\"");
+        if (pos == std::string::npos) return false;
+        pos = line.find('"', line.find(':', pos) + 1);
+        if (pos == std::string::npos) return false;
+        out.clear();
+        for (size_t i = pos + 1; i < line.size(); ++i) {
+            if (line[i] == '\\' && i + 1 < line.size()) {
+                out += line[++i];
+            } else if (line[i] == '"') {
+                return true;
+            } else {
+                out += line[i];
+            }
+        }
+        return false;
+    };
+    
+    size_t count = 0;
+    std::string line;
+    std::string key;
+    std::string value;
+    while (std::getline(input, line)) {
+        if (!extract(line, "key", key) || !extract(line, "value", value)) {
+            continue;
+        }
+        if (!sorter.add(key, value)) {
+            task->error_message = "Failed to spill sort run";
+            return false;
+        }
+        if (++count % config.batch_size == 0 && !wait_if_paused(task)) {
+            return false;
+        }
+        task->processed_records = count;
+    }
+    
+    task->total_records = count;
+    return ingest_sorted(sorter, db_path, config, task);
+}
+
+bool DataMigrationManager::import_from_csv(const std::string& input_path,
+                                          const std::string& db_path,
+                                          const MigrationConfig& config,
+                                          MigrationTask* task) {
+    std::ifstream input(input_path);
+    if (!input.is_open()) {
+        task->error_message = "Cannot open input file: " + input_path;
+        return false;
+    }
+    
+    std::filesystem::create_directories(config.temp_dir);
+    ExternalSorter sorter((std::filesystem::path(config.temp_dir) / task->task_id).string(),
+                          config.sort_memory_limit);
+    
+    // 解析一条 CSV 记录（支持双引号包裹的字段跨行）
+    auto read_record = [&input](std::vector<std::string>& fields) {
+        fields.clear();
+        std::string field;
+        bool in_quotes = false;
+        bool any = false;
+        char c;
+        while (input.get(c)) {
+            any = true;
+            if (in_quotes) {
+                if (c == '"') {
+                    if (input.peek() == '"') {
+                        field += '"';
+                        input.get();
+                    } else {
+                        in_quotes = false;
+                    }
+                } else {
+                    field += c;
+                }
+            } else if (c == '"') {
+                in_quotes = true;
+            } else if (c == ',') {
+                fields.push_back(std::move(field));
+                field.clear();
+            } else if (c == '\n') {
+                break;
+            } else if (c != '\r') {
+                field += c;
+            }
+        }
+        if (any) {
+            fields.push_back(std::move(field));
+        }
+        return any;
+    };
+    
+    std::vector<std::string> fields;
+    read_record(fields);  // 跳过头部
+    
+    size_t count = 0;
+    while (read_record(fields)) {
+        if (fields.size() < 2) {
+            continue;
+        }
+        if (!sorter.add(fields[0], fields[1])) {
+            task->error_message = "Failed to spill sort run";
+            return false;
+        }
+        if (++count % config.batch_size == 0 && !wait_if_paused(task)) {
+            return false;
+        }
+        task->processed_records = count;
+    }
+    
+    task->total_records = count;
+    return ingest_sorted(sorter, db_path, config, task);
+}
+
+bool DataMigrationManager::ingest_sorted(ExternalSorter& sorter,
+                                        const std::string& db_path,
+                                        const MigrationConfig& config,
+                                        MigrationTask* task) {
+    // 归并输出按 target_file_size 切成若干个互不重叠的 SSTable
+    std::string sst_prefix = (std::filesystem::path(config.temp_dir) / task->task_id).string();
+    std::vector<std::string> sst_files;
+    SstFileWriter writer;
+    
+    auto remove_files = [&sst_files]() {
+        for (const auto& file : sst_files) {
+            std::filesystem::remove(file);
+        }
+    };
+    
+    bool sorted = sorter.finish([&](const std::string& key, const std::string& value) {
+        if (writer.num_entries() == 0) {
+            std::string filename = sst_prefix + ".sst" + std::to_string(sst_files.size());
+            if (!writer.open(filename)) {
+                return false;
+            }
+            sst_files.push_back(filename);
+        }
+        if (!writer.put(key, value)) {
+            return false;
+        }
+        if (writer.file_size() >= config.target_file_size) {
+            return writer.finish();
+        }
+        return true;
+    });
+    if (sorted && writer.num_entries() > 0) {
+        sorted = writer.finish();
+    }
+    if (!sorted) {
+        task->error_message = writer.last_error().empty() ? "External sort failed" : writer.last_error();
+        remove_files();
+        return false;
+    }
+    
+    // 与目标库现有数据重叠时由数据库分配全局序列号，导入的数据覆盖旧值
+    KVDB db(db_path);
+    if (!db.ingest_external_files(sst_files)) {
+        task->error_message = "Failed to ingest SSTables into " + db_path;
+        remove_files();
+        return false;
+    }
+    return true;
+}
+
 ImportFormat DataMigrationManager::detect_format(const std::string& file_path) {
     std::string extension = std::filesystem::path(file_path).extension().string();
     std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
@@ -420,6 +839,16 @@ size_t DataMigrationManager::count_records(const std::string& file_path, ImportF
             if (count > 0) count--; // 减去头部行
             break;
             
+        case ImportFormat::BINARY: {
+            // 文件尾记录了记录数
+            std::ifstream bin(file_path, std::ios::binary);
+            uint64_t stored = 0;
+            if (bin.seekg(-16, std::ios::end) && bin.read(reinterpret_cast<char*>(&stored), sizeof(stored))) {
+                count = stored;
+            }
+            break;
+        }
+            
         default:
             count = 1000; // 默认估计值
             break;
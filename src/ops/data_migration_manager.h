@@ -9,6 +9,7 @@
 #include <atomic>
 #include <thread>
 #include <mutex>
+#include "external_sorter.h"
 
 namespace kvdb {
 namespace ops {
@@ -70,6 +71,11 @@ struct MigrationConfig {
     bool enable_incremental = false;
     std::string compression_algorithm = "snappy";
     
+    // 导入：外部排序内存上限与生成的 SSTable 目标大小，临时文件放在 temp_dir
+    size_t sort_memory_limit = 64 * 1024 * 1024;
+    size_t target_file_size = 64 * 1024 * 1024;
+    std::string temp_dir = "temp";
+    
     // 过滤条件
     std::string key_pattern;
     std::chrono::system_clock::time_point start_time;
@@ -132,23 +138,27 @@ private:
 
     // 内部方法
     std::string generate_task_id();
-    void run_export_task(std::unique_ptr<MigrationTask> task,
+    void run_export_task(MigrationTask* task,
                         const std::string& db_path,
                         ExportFormat format,
                         const MigrationConfig& config,
                         ProgressCallback callback);
-    void run_import_task(std::unique_ptr<MigrationTask> task,
+    void run_import_task(MigrationTask* task,
                         const std::string& db_path,
                         ImportFormat format,
                         const MigrationConfig& config,
                         ProgressCallback callback);
-    void run_migration_task(std::unique_ptr<MigrationTask> task,
+    void run_migration_task(MigrationTask* task,
                            const std::string& source_db,
                            const std::string& target_db,
                            const MigrationConfig& config,
                            ProgressCallback callback);
 
     // 格式处理
+    bool export_to_binary(const std::string& db_path,
+                         const std::string& output_path,
+                         const MigrationConfig& config,
+                         MigrationTask* task);
     bool export_to_json(const std::string& db_path,
                        const std::string& output_path,
                        const MigrationConfig& config,
@@ -165,6 +175,17 @@ private:
                         const std::string& db_path,
                         const MigrationConfig& config,
                         MigrationTask* task);
+    bool import_from_binary(const std::string& input_path,
+                           const std::string& db_path,
+                           const MigrationConfig& config,
+                           MigrationTask* task);
+    
+    // 导入公共路径：外部排序 -> 离线构建 SSTable -> ingest_external_files
+    bool ingest_sorted(ExternalSorter& sorter,
+                      const std::string& db_path,
+                      const MigrationConfig& config,
+                      MigrationTask* task);
+    bool wait_if_paused(MigrationTask* task);
 
     // 工具方法
     ImportFormat detect_format(const std::string& file_path);
@@ -0,0 +1,158 @@
+#include "external_sorter.h"
+#include <fstream>
+#include <queue>
+#include <memory>
+#include <filesystem>
+
+namespace kvdb {
+namespace ops {
+
+namespace binary_record {
+
+void write(std::ostream& out, const char* key, uint32_t key_len,
+           const char* value, uint32_t value_len) {
+    out.write(reinterpret_cast<const char*>(&key_len), sizeof(key_len));
+    out.write(key, key_len);
+    out.write(reinterpret_cast<const char*>(&value_len), sizeof(value_len));
+    out.write(value, value_len);
+}
+
+bool read(std::istream& in, std::string& key, std::string& value) {
+    uint32_t key_len = 0;
+    if (!in.read(reinterpret_cast<char*>(&key_len), sizeof(key_len)) || key_len == END_MARKER) {
+        return false;
+    }
+    key.resize(key_len);
+    if (key_len > 0 && !in.read(&key[0], key_len)) {
+        return false;
+    }
+    uint32_t value_len = 0;
+    if (!in.read(reinterpret_cast<char*>(&value_len), sizeof(value_len))) {
+        return false;
+    }
+    value.resize(value_len);
+    if (value_len > 0 && !in.read(&value[0], value_len)) {
+        return false;
+    }
+    return true;
+}
+
+} // namespace binary_record
+
+// std::map 节点的大致额外开销
+static constexpr size_t ENTRY_OVERHEAD = 64;
+
+ExternalSorter::ExternalSorter(const std::string& temp_prefix, size_t memory_limit_bytes)
+    : temp_prefix_(temp_prefix), memory_limit_(memory_limit_bytes), buffered_bytes_(0) {}
+
+ExternalSorter::~ExternalSorter() {
+    for (const auto& run : run_files_) {
+        std::filesystem::remove(run);
+    }
+}
+
+bool ExternalSorter::add(const std::string& key, const std::string& value) {
+    auto result = buffer_.insert_or_assign(key, value);
+    if (result.second) {
+        buffered_bytes_ += key.size() + value.size() + ENTRY_OVERHEAD;
+    }
+    if (buffered_bytes_ >= memory_limit_) {
+        return spill();
+    }
+    return true;
+}
+
+bool ExternalSorter::spill() {
+    if (buffer_.empty()) {
+        return true;
+    }
+
+    std::string run_file = temp_prefix_ + ".run" + std::to_string(run_files_.size());
+    std::ofstream out(run_file, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        return false;
+    }
+    for (const auto& pair : buffer_) {
+        binary_record::write(out, pair.first, pair.second);
+    }
+    out.close();
+    if (!out) {
+        return false;
+    }
+
+    run_files_.push_back(run_file);
+    buffer_.clear();
+    buffered_bytes_ = 0;
+    return true;
+}
+
+bool ExternalSorter::finish(const Emit& emit) {
+    // 没有落盘段时直接输出内存中的数据
+    if (run_files_.empty()) {
+        for (const auto& pair : buffer_) {
+            if (!emit(pair.first, pair.second)) {
+                return false;
+            }
+        }
+        buffer_.clear();
+        buffered_bytes_ = 0;
+        return true;
+    }
+
+    if (!spill()) {
+        return false;
+    }
+
+    struct Cursor {
+        std::ifstream in;
+        std::string key;
+        std::string value;
+        size_t run;
+    };
+    std::vector<std::unique_ptr<Cursor>> cursors;
+    for (size_t i = 0; i < run_files_.size(); i++) {
+        auto cursor = std::make_unique<Cursor>();
+        cursor->in.open(run_files_[i], std::ios::binary);
+        cursor->run = i;
+        if (!cursor->in.is_open()) {
+            return false;
+        }
+        cursors.push_back(std::move(cursor));
+    }
+
+    // 小顶堆：键小者优先，键相同时后落盘（更新）的段优先
+    auto greater = [](const Cursor* a, const Cursor* b) {
+        int cmp = a->key.compare(b->key);
+        return cmp != 0 ? cmp > 0 : a->run < b->run;
+    };
+    std::priority_queue<Cursor*, std::vector<Cursor*>, decltype(greater)> heap(greater);
+    for (auto& cursor : cursors) {
+        if (binary_record::read(cursor->in, cursor->key, cursor->value)) {
+            heap.push(cursor.get());
+        }
+    }
+
+    std::string last_key;
+    bool has_last = false;
+    while (!heap.empty()) {
+        Cursor* top = heap.top();
+        heap.pop();
+
+        // 同一个键只输出最新段里的值，其余段中的旧值跳过
+        if (!has_last || top->key != last_key) {
+            if (!emit(top->key, top->value)) {
+                return false;
+            }
+            last_key = top->key;
+            has_last = true;
+        }
+
+        if (binary_record::read(top->in, top->key, top->value)) {
+            heap.push(top);
+        }
+    }
+    return true;
+}
+
+} // namespace ops
+} // namespace kvdb
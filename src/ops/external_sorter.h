@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <cstdint>
+
+namespace kvdb {
+namespace ops {
+
+// 二进制记录格式：[u32 key_len][key][u32 value_len][value]，整数按本机字节序
+namespace binary_record {
+    constexpr uint32_t END_MARKER = 0xFFFFFFFFu;  // 记录流结束（其后为文件尾）
+
+    void write(std::ostream& out, const char* key, uint32_t key_len,
+               const char* value, uint32_t value_len);
+    inline void write(std::ostream& out, const std::string& key, const std::string& value) {
+        write(out, key.data(), static_cast<uint32_t>(key.size()),
+              value.data(), static_cast<uint32_t>(value.size()));
+    }
+    // 读到结束标记或流尾返回 false
+    bool read(std::istream& in, std::string& key, std::string& value);
+}
+
+// 内存受限的外部排序：缓冲区满时把有序段落盘，finish 时多路归并。
+// 同一个键多次 add 时以最后一次为准
+class ExternalSorter {
+public:
+    using Emit = std::function<bool(const std::string& key, const std::string& value)>;
+
+    ExternalSorter(const std::string& temp_prefix, size_t memory_limit_bytes);
+    ~ExternalSorter();
+
+    bool add(const std::string& key, const std::string& value);
+    // 按键升序回调每个键的最终值，emit 返回 false 时中止
+    bool finish(const Emit& emit);
+
+    size_t run_count() const { return run_files_.size(); }
+
+private:
+    bool spill();
+
+    std::string temp_prefix_;
+    size_t memory_limit_;
+    size_t buffered_bytes_;
+    std::map<std::string, std::string> buffer_;
+    std::vector<std::string> run_files_;
+};
+
+} // namespace ops
+} // namespace kvdb
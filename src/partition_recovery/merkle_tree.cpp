@@ -0,0 +1,269 @@
+#include "merkle_tree.h"
+#include <algorithm>
+#include <unordered_set>
+
+namespace {
+
+inline uint64_t mix64(uint64_t x) {
+    // splitmix64 终结函数
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return x;
+}
+
+}  // namespace
+
+MerkleTree::MerkleTree(uint32_t depth)
+    : depth_(std::min<uint32_t>(std::max<uint32_t>(depth, 1), 20)) {
+    buckets_.resize(bucket_count());
+    nodes_.assign(static_cast<size_t>(bucket_count()) * 2, 0);
+    leaf_dirty_.assign(bucket_count(), false);
+    rebuild_internal_locked();
+}
+
+uint64_t MerkleTree::hash_bytes(const std::string& data, uint64_t seed) {
+    // FNV-1a 64 位，末尾再混一次让高位分布均匀（分桶取高位）
+    uint64_t h = 14695981039346656037ULL ^ mix64(seed);
+    for (char c : data) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 1099511628211ULL;
+    }
+    return mix64(h);
+}
+
+uint64_t MerkleTree::entry_hash(const std::string& key, uint64_t digest) {
+    return mix64(hash_bytes(key, 1) ^ (digest * 0x9E3779B97F4A7C15ULL));
+}
+
+uint64_t MerkleTree::combine(uint64_t left, uint64_t right) {
+    return mix64(left * 0x9E3779B97F4A7C15ULL + (right ^ 0xC2B2AE3D27D4EB4FULL));
+}
+
+uint32_t MerkleTree::bucket_of(const std::string& key) const {
+    return static_cast<uint32_t>(hash_bytes(key) >> (64 - depth_));
+}
+
+void MerkleTree::mark_dirty(uint32_t bucket) {
+    if (!leaf_dirty_[bucket]) {
+        leaf_dirty_[bucket] = true;
+        dirty_leaves_.push_back(bucket);
+    }
+}
+
+void MerkleTree::update(const std::string& key, const std::string& value, uint64_t timestamp) {
+    uint64_t digest = hash_bytes(value, 2);
+    uint32_t bucket = bucket_of(key);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t& leaf = nodes_[bucket_count() + bucket];
+    auto& entries = buckets_[bucket];
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+        if (it->second.digest == digest) {
+            it->second.timestamp = std::max(it->second.timestamp, timestamp);
+            return;
+        }
+        leaf ^= entry_hash(key, it->second.digest);
+        it->second = Entry{digest, timestamp};
+    } else {
+        entries.emplace(key, Entry{digest, timestamp});
+    }
+    leaf ^= entry_hash(key, digest);
+    mark_dirty(bucket);
+}
+
+void MerkleTree::remove(const std::string& key) {
+    uint32_t bucket = bucket_of(key);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& entries = buckets_[bucket];
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        return;
+    }
+    nodes_[bucket_count() + bucket] ^= entry_hash(key, it->second.digest);
+    entries.erase(it);
+    mark_dirty(bucket);
+}
+
+void MerkleTree::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& entries : buckets_) {
+        entries.clear();
+    }
+    std::fill(nodes_.begin(), nodes_.end(), 0);
+    std::fill(leaf_dirty_.begin(), leaf_dirty_.end(), false);
+    dirty_leaves_.clear();
+    rebuild_internal_locked();
+}
+
+size_t MerkleTree::key_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t count = 0;
+    for (const auto& entries : buckets_) {
+        count += entries.size();
+    }
+    return count;
+}
+
+void MerkleTree::rebuild_internal_locked() {
+    // 空子树的内部节点同样按 combine 计算，保证任意两棵同深度的树结构哈希一致
+    for (uint32_t node = bucket_count() - 1; node >= 1; --node) {
+        nodes_[node] = combine(nodes_[2 * node], nodes_[2 * node + 1]);
+    }
+}
+
+void MerkleTree::refresh_locked() const {
+    if (dirty_leaves_.empty()) {
+        return;
+    }
+
+    // 逐层向上：每层只重算脏节点的父节点
+    std::vector<uint32_t> level_nodes;
+    level_nodes.reserve(dirty_leaves_.size());
+    for (uint32_t bucket : dirty_leaves_) {
+        level_nodes.push_back(bucket_count() + bucket);
+        leaf_dirty_[bucket] = false;
+    }
+    dirty_leaves_.clear();
+
+    while (level_nodes.front() > 1) {
+        for (uint32_t& node : level_nodes) {
+            node >>= 1;
+        }
+        std::sort(level_nodes.begin(), level_nodes.end());
+        level_nodes.erase(std::unique(level_nodes.begin(), level_nodes.end()), level_nodes.end());
+        for (uint32_t node : level_nodes) {
+            nodes_[node] = combine(nodes_[2 * node], nodes_[2 * node + 1]);
+        }
+    }
+}
+
+uint64_t MerkleTree::root_hash() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    refresh_locked();
+    return nodes_[1];
+}
+
+std::vector<uint64_t> MerkleTree::node_hashes(uint32_t level, const std::vector<uint32_t>& nodes) const {
+    std::vector<uint64_t> hashes;
+    hashes.reserve(nodes.size());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    refresh_locked();
+    if (level > depth_) {
+        hashes.assign(nodes.size(), 0);
+        return hashes;
+    }
+    const uint32_t base = 1u << level;
+    for (uint32_t node : nodes) {
+        hashes.push_back(node < base ? nodes_[base + node] : 0);
+    }
+    return hashes;
+}
+
+std::vector<MerkleKeyDigest> MerkleTree::bucket_digests(const std::vector<uint32_t>& buckets) const {
+    std::vector<MerkleKeyDigest> digests;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (uint32_t bucket : buckets) {
+        if (bucket >= buckets_.size()) {
+            continue;
+        }
+        for (const auto& pair : buckets_[bucket]) {
+            digests.push_back(MerkleKeyDigest{pair.first, pair.second.digest, pair.second.timestamp});
+        }
+    }
+    return digests;
+}
+
+bool MerkleTree::get_digest(const std::string& key, MerkleKeyDigest& digest) const {
+    uint32_t bucket = bucket_of(key);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = buckets_[bucket].find(key);
+    if (it == buckets_[bucket].end()) {
+        return false;
+    }
+    digest = MerkleKeyDigest{key, it->second.digest, it->second.timestamp};
+    return true;
+}
+
+MerkleDiff MerkleTree::diff(MerkleTreePeer& remote) const {
+    MerkleDiff result;
+
+    result.rounds++;
+    if (remote.depth() == depth_) {
+        // 自顶向下：每轮一次往返，只携带上一层不一致节点的子节点
+        std::vector<uint32_t> candidates{0};
+        for (uint32_t level = 0; level <= depth_ && !candidates.empty(); ++level) {
+            std::vector<uint64_t> remote_hashes = remote.node_hashes(level, candidates);
+            std::vector<uint64_t> local_hashes = node_hashes(level, candidates);
+            result.rounds++;
+            result.hashes_exchanged += candidates.size();
+
+            std::vector<uint32_t> next;
+            for (size_t i = 0; i < candidates.size(); ++i) {
+                if (i < remote_hashes.size() && remote_hashes[i] == local_hashes[i]) {
+                    continue;
+                }
+                if (level == depth_) {
+                    result.divergent_buckets.push_back(candidates[i]);
+                } else {
+                    next.push_back(candidates[i] * 2);
+                    next.push_back(candidates[i] * 2 + 1);
+                }
+            }
+            candidates.swap(next);
+        }
+    } else {
+        // 分桶方式不同，无法逐层比较，退化为全量比较键摘要
+        for (uint32_t b = 0; b < bucket_count(); ++b) {
+            result.divergent_buckets.push_back(b);
+        }
+    }
+
+    if (result.divergent_buckets.empty()) {
+        return result;
+    }
+
+    std::vector<MerkleKeyDigest> remote_digests;
+    if (remote.depth() == depth_) {
+        remote_digests = remote.bucket_digests(result.divergent_buckets);
+    } else {
+        std::vector<uint32_t> all_remote(1u << remote.depth());
+        for (uint32_t b = 0; b < all_remote.size(); ++b) {
+            all_remote[b] = b;
+        }
+        remote_digests = remote.bucket_digests(all_remote);
+    }
+    result.rounds++;
+    result.digests_exchanged += remote_digests.size();
+
+    std::unordered_set<std::string> remote_keys;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& remote_digest : remote_digests) {
+            remote_keys.insert(remote_digest.key);
+            const auto& entries = buckets_[bucket_of(remote_digest.key)];
+            auto it = entries.find(remote_digest.key);
+            if (it == entries.end()) {
+                result.missing_local.push_back(remote_digest.key);
+            } else if (it->second.digest != remote_digest.digest) {
+                result.mismatched.push_back(remote_digest);
+            }
+        }
+        for (uint32_t bucket : result.divergent_buckets) {
+            for (const auto& pair : buckets_[bucket]) {
+                if (remote_keys.find(pair.first) == remote_keys.end()) {
+                    result.missing_remote.push_back(pair.first);
+                }
+            }
+        }
+    }
+
+    return result;
+}
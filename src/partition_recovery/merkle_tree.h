@@ -0,0 +1,125 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+
+// 单个键的摘要：值哈希 + 写入时间戳（时间戳用于 last-writer-wins 判定，不参与树哈希）
+struct MerkleKeyDigest {
+    std::string key;
+    uint64_t digest = 0;
+    uint64_t timestamp = 0;
+};
+
+// 对端副本的树视图。反熵只通过这几个调用交换数据，
+// 每次调用对应一次网络往返，参数/返回值大小即带宽代价
+class MerkleTreePeer {
+public:
+    virtual ~MerkleTreePeer() = default;
+    virtual uint32_t depth() = 0;
+    // 第 level 层指定节点的哈希（第 level 层共 2^level 个节点）
+    virtual std::vector<uint64_t> node_hashes(uint32_t level, const std::vector<uint32_t>& nodes) = 0;
+    // 指定叶子桶内所有键的摘要
+    virtual std::vector<MerkleKeyDigest> bucket_digests(const std::vector<uint32_t>& buckets) = 0;
+};
+
+// 反熵对端：在树视图之外按键拉取数据
+struct ReplicaEntry {
+    std::string key;
+    std::string value;
+    uint64_t timestamp = 0;
+};
+
+class AntiEntropyPeer : public MerkleTreePeer {
+public:
+    // 对端不存在的键不返回
+    virtual std::vector<ReplicaEntry> fetch_entries(const std::vector<std::string>& keys) = 0;
+};
+
+// 树比较结果
+struct MerkleDiff {
+    std::vector<std::string> missing_local;     // 对端有、本地没有
+    std::vector<std::string> missing_remote;    // 本地有、对端没有
+    std::vector<MerkleKeyDigest> mismatched;    // 两边都有但值不同（记录对端摘要）
+    std::vector<uint32_t> divergent_buckets;    // 不一致的叶子桶
+
+    size_t rounds = 0;              // 往返次数
+    size_t hashes_exchanged = 0;    // 交换的节点哈希数
+    size_t digests_exchanged = 0;   // 交换的键摘要数
+
+    bool empty() const {
+        return missing_local.empty() && missing_remote.empty() && mismatched.empty();
+    }
+};
+
+// 按键哈希区间分桶的 Merkle 树：
+// - 叶子桶 = 键哈希高 depth 位相同的键（哈希区间，而非原始键区间，避免热点前缀挤在同一桶）
+// - 叶子哈希为桶内各键 (键, 值摘要) 哈希的异或，写路径上 O(1) 增量更新
+// - 内部节点延迟重算，只沿脏叶子到根的路径重算
+class MerkleTree {
+public:
+    static constexpr uint32_t DEFAULT_DEPTH = 10;  // 1024 个叶子桶
+
+    explicit MerkleTree(uint32_t depth = DEFAULT_DEPTH);
+
+    // 写路径增量维护
+    void update(const std::string& key, const std::string& value, uint64_t timestamp = 0);
+    void remove(const std::string& key);
+    void clear();
+
+    // 树结构查询
+    uint32_t depth() const { return depth_; }
+    uint32_t bucket_count() const { return 1u << depth_; }
+    uint32_t bucket_of(const std::string& key) const;
+    size_t key_count() const;
+    uint64_t root_hash() const;
+    std::vector<uint64_t> node_hashes(uint32_t level, const std::vector<uint32_t>& nodes) const;
+    std::vector<MerkleKeyDigest> bucket_digests(const std::vector<uint32_t>& buckets) const;
+    bool get_digest(const std::string& key, MerkleKeyDigest& digest) const;
+
+    // 与对端自顶向下逐层比较：只下探哈希不一致的子树，最后只交换不一致叶子桶的键摘要
+    MerkleDiff diff(MerkleTreePeer& remote) const;
+
+    static uint64_t hash_bytes(const std::string& data, uint64_t seed = 0);
+
+private:
+    struct Entry {
+        uint64_t digest;
+        uint64_t timestamp;
+    };
+
+    uint32_t depth_;
+    mutable std::mutex mutex_;
+    std::vector<std::unordered_map<std::string, Entry>> buckets_;
+
+    // 堆式布局：第 level 层第 i 个节点位于 (1 << level) + i，叶子层即 level == depth_
+    mutable std::vector<uint64_t> nodes_;
+    mutable std::vector<uint32_t> dirty_leaves_;
+    mutable std::vector<bool> leaf_dirty_;
+
+    static uint64_t entry_hash(const std::string& key, uint64_t digest);
+    static uint64_t combine(uint64_t left, uint64_t right);
+    void mark_dirty(uint32_t bucket);
+    void rebuild_internal_locked();
+    void refresh_locked() const;
+};
+
+// 同进程内的树直接作为对端（测试、同机多副本）
+class LocalMerkleTreePeer : public MerkleTreePeer {
+public:
+    explicit LocalMerkleTreePeer(const MerkleTree& tree) : tree_(tree) {}
+
+    uint32_t depth() override { return tree_.depth(); }
+    std::vector<uint64_t> node_hashes(uint32_t level, const std::vector<uint32_t>& nodes) override {
+        return tree_.node_hashes(level, nodes);
+    }
+    std::vector<MerkleKeyDigest> bucket_digests(const std::vector<uint32_t>& buckets) override {
+        return tree_.bucket_digests(buckets);
+    }
+
+private:
+    const MerkleTree& tree_;
+};
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <algorithm>
 #include <sstream>
+#include <limits>
 
 PartitionRecoveryManager::PartitionRecoveryManager(
     const std::string& node_id,
@@ -14,7 +15,7 @@ PartitionRecoveryManager::PartitionRecoveryManager(
     : node_id_(node_id), config_(config), network_(network),
       raft_node_(raft_node), txn_coordinator_(txn_coordinator), mvcc_manager_(mvcc_manager),
       current_partition_state_(PartitionState::NORMAL), is_read_only_mode_(false),
-      running_(false), next_recovery_id_(1) {
+      running_(false), next_recovery_id_(1), next_sync_txn_id_(1ULL << 62) {
     
     // 创建故障检测器
     failure_detector_ = std::make_unique<FailureDetector>(node_id_, config_, network_);
@@ -357,6 +358,9 @@ void PartitionRecoveryManager::print_statistics() const {
     std::cout << "Nodes Recovered: " << stats.nodes_recovered << std::endl;
     std::cout << "Recovery Rate: " << (stats.partition_recovery_rate * 100) << "%" << std::endl;
     std::cout << "Detection Accuracy: " << (stats.detection_accuracy * 100) << "%" << std::endl;
+    std::cout << "Anti-Entropy Rounds: " << stats.anti_entropy_rounds
+              << " (hashes exchanged: " << stats.anti_entropy_hashes_exchanged
+              << ", keys synced: " << stats.anti_entropy_keys_synced << ")" << std::endl;
     std::cout << "======================================" << std::endl;
 }
 
@@ -537,10 +541,116 @@ bool PartitionRecoveryManager::sync_raft_log_with_node(const std::string& node_i
 
 bool PartitionRecoveryManager::sync_mvcc_data_with_node(const std::string& node_id) {
     std::cout << "Syncing MVCC data with node " << node_id << std::endl;
-    // 简化实现：假设同步成功
+    
+    auto peer = get_anti_entropy_peer(node_id);
+    if (!peer || !mvcc_manager_) {
+        // 没有对端的树视图，无从比较
+        return true;
+    }
+    
+    // 自顶向下比较 Merkle 树，只得到不一致叶子桶里的键
+    MerkleDiff diff = merkle_tree_.diff(*peer);
+    
+    // 拉取本地缺失的键和对端较新的冲突键；本地较新的键在 LWW 下保留本地值，无需拉取。
+    // 对端缺失的键由对端在自己的同步轮次中拉取（反熵是双向各自拉取的）
+    std::vector<std::string> to_fetch = diff.missing_local;
+    for (const auto& remote_digest : diff.mismatched) {
+        MerkleKeyDigest local_digest;
+        if (merkle_tree_.get_digest(remote_digest.key, local_digest) &&
+            remote_digest.timestamp < local_digest.timestamp) {
+            continue;
+        }
+        to_fetch.push_back(remote_digest.key);
+    }
+    
+    size_t keys_synced = 0;
+    if (!to_fetch.empty()) {
+        for (const auto& entry : peer->fetch_entries(to_fetch)) {
+            MerkleKeyDigest local_digest;
+            if (!merkle_tree_.get_digest(entry.key, local_digest)) {
+                apply_synced_entry(entry);
+                keys_synced++;
+                continue;
+            }
+            
+            // 两边都有且值不同：按冲突策略解决
+            ConsistencyConflict conflict;
+            conflict.key = entry.key;
+            std::string local_value;
+            mvcc_manager_->read(entry.key, std::numeric_limits<uint64_t>::max(), local_value);
+            conflict.conflicting_values = {local_value, entry.value};
+            conflict.nodes = {node_id_, node_id};
+            conflict.timestamps = {local_digest.timestamp, entry.timestamp};
+            
+            std::string resolved_value;
+            if (!resolve_conflict_by_strategy(conflict, conflict.resolution_strategy, resolved_value)) {
+                continue;
+            }
+            if (resolved_value != local_value) {
+                apply_synced_entry(ReplicaEntry{entry.key, resolved_value,
+                                                std::max(local_digest.timestamp, entry.timestamp)});
+                keys_synced++;
+            }
+        }
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        stats_.anti_entropy_rounds++;
+        stats_.anti_entropy_hashes_exchanged += diff.hashes_exchanged + diff.digests_exchanged;
+        stats_.anti_entropy_keys_synced += keys_synced;
+    }
+    
+    std::cout << "Anti-entropy with " << node_id << ": " << diff.divergent_buckets.size()
+              << " divergent buckets, " << (diff.hashes_exchanged + diff.digests_exchanged)
+              << " hashes exchanged, " << keys_synced << " keys synced" << std::endl;
     return true;
 }
 
+void PartitionRecoveryManager::record_local_write(const std::string& key, const std::string& value,
+                                                  uint64_t timestamp) {
+    merkle_tree_.update(key, value, timestamp);
+}
+
+void PartitionRecoveryManager::record_local_delete(const std::string& key) {
+    merkle_tree_.remove(key);
+}
+
+void PartitionRecoveryManager::rebuild_merkle_tree() {
+    // 从 MVCC 最新快照全量重建（启动或树丢失时使用，常规路径靠写路径增量维护）
+    merkle_tree_.clear();
+    if (!mvcc_manager_) {
+        return;
+    }
+    for (const auto& pair : mvcc_manager_->create_snapshot(std::numeric_limits<uint64_t>::max())) {
+        merkle_tree_.update(pair.first, pair.second);
+    }
+}
+
+void PartitionRecoveryManager::register_anti_entropy_peer(const std::string& node_id,
+                                                          std::shared_ptr<AntiEntropyPeer> peer) {
+    std::lock_guard<std::mutex> lock(anti_entropy_mutex_);
+    anti_entropy_peers_[node_id] = peer;
+}
+
+void PartitionRecoveryManager::unregister_anti_entropy_peer(const std::string& node_id) {
+    std::lock_guard<std::mutex> lock(anti_entropy_mutex_);
+    anti_entropy_peers_.erase(node_id);
+}
+
+std::shared_ptr<AntiEntropyPeer> PartitionRecoveryManager::get_anti_entropy_peer(const std::string& node_id) const {
+    std::lock_guard<std::mutex> lock(anti_entropy_mutex_);
+    auto it = anti_entropy_peers_.find(node_id);
+    return it != anti_entropy_peers_.end() ? it->second : nullptr;
+}
+
+void PartitionRecoveryManager::apply_synced_entry(const ReplicaEntry& entry) {
+    uint64_t txn_id = next_sync_txn_id_.fetch_add(1);
+    mvcc_manager_->write(entry.key, entry.value, txn_id, entry.timestamp);
+    mvcc_manager_->commit_transaction(txn_id, entry.timestamp);
+    merkle_tree_.update(entry.key, entry.value, entry.timestamp);
+}
+
 bool PartitionRecoveryManager::sync_transaction_state_with_node(const std::string& node_id) {
     std::cout << "Syncing transaction state with node " << node_id << std::endl;
     // 简化实现：假设同步成功
@@ -556,7 +666,41 @@ std::vector<ConsistencyConflict> PartitionRecoveryManager::detect_raft_log_confl
 
 std::vector<ConsistencyConflict> PartitionRecoveryManager::detect_mvcc_data_conflicts(const std::vector<std::string>& nodes) {
     std::vector<ConsistencyConflict> conflicts;
-    // 简化实现：假设没有冲突
+    if (!mvcc_manager_) {
+        return conflicts;
+    }
+    
+    // 通过 Merkle 树比较定位两边都有但值不同的键，只拉取这些键的值
+    for (const auto& node_id : nodes) {
+        auto peer = get_anti_entropy_peer(node_id);
+        if (!peer) {
+            continue;
+        }
+        
+        MerkleDiff diff = merkle_tree_.diff(*peer);
+        if (diff.mismatched.empty()) {
+            continue;
+        }
+        
+        std::vector<std::string> keys;
+        for (const auto& remote_digest : diff.mismatched) {
+            keys.push_back(remote_digest.key);
+        }
+        for (const auto& entry : peer->fetch_entries(keys)) {
+            MerkleKeyDigest local_digest;
+            std::string local_value;
+            if (!merkle_tree_.get_digest(entry.key, local_digest) ||
+                !mvcc_manager_->read(entry.key, std::numeric_limits<uint64_t>::max(), local_value)) {
+                continue;
+            }
+            ConsistencyConflict conflict;
+            conflict.key = entry.key;
+            conflict.conflicting_values = {local_value, entry.value};
+            conflict.nodes = {node_id_, node_id};
+            conflict.timestamps = {local_digest.timestamp, entry.timestamp};
+            conflicts.push_back(conflict);
+        }
+    }
     return conflicts;
 }
 
@@ -5,6 +5,7 @@
 #include "../raft/raft_node.h"
 #include "../distributed_transaction/distributed_transaction_coordinator.h"
 #include "../mvcc/mvcc_manager.h"
+#include "merkle_tree.h"
 #include <unordered_map>
 #include <thread>
 #include <condition_variable>
@@ -50,6 +51,14 @@ public:
                                      PartitionRecoveryStrategy strategy);
     bool synchronize_data_with_node(const std::string& node_id);
     
+    // 反熵：写路径增量维护本地 Merkle 树，分区恢复后只同步不一致的键
+    void record_local_write(const std::string& key, const std::string& value, uint64_t timestamp);
+    void record_local_delete(const std::string& key);
+    void rebuild_merkle_tree();
+    void register_anti_entropy_peer(const std::string& node_id, std::shared_ptr<AntiEntropyPeer> peer);
+    void unregister_anti_entropy_peer(const std::string& node_id);
+    const MerkleTree& get_merkle_tree() const { return merkle_tree_; }
+    
     // 脑裂预防
     bool is_in_majority_partition() const;
     bool should_accept_writes() const;
@@ -104,6 +113,12 @@ private:
     // 恢复ID生成
     std::atomic<uint64_t> next_recovery_id_;
     
+    // 反熵
+    MerkleTree merkle_tree_;
+    mutable std::mutex anti_entropy_mutex_;
+    std::unordered_map<std::string, std::shared_ptr<AntiEntropyPeer>> anti_entropy_peers_;
+    std::atomic<uint64_t> next_sync_txn_id_;
+    
     // 私有方法
     std::string generate_recovery_id();
     void recovery_main_loop();
@@ -120,6 +135,8 @@ private:
     bool sync_raft_log_with_node(const std::string& node_id);
     bool sync_mvcc_data_with_node(const std::string& node_id);
     bool sync_transaction_state_with_node(const std::string& node_id);
+    std::shared_ptr<AntiEntropyPeer> get_anti_entropy_peer(const std::string& node_id) const;
+    void apply_synced_entry(const ReplicaEntry& entry);
     
     // 冲突解决
     std::vector<ConsistencyConflict> detect_raft_log_conflicts(const std::vector<std::string>& nodes);
@@ -172,6 +172,10 @@ struct PartitionRecoveryStats {
     size_t false_negatives;                // 漏报数
     double detection_accuracy;             // 检测准确率
     
+    size_t anti_entropy_rounds;            // 反熵同步次数
+    size_t anti_entropy_hashes_exchanged;  // 反熵交换的哈希/摘要数
+    size_t anti_entropy_keys_synced;       // 反熵拉取并应用的键数
+    
     std::chrono::system_clock::time_point last_partition_time; // 最后一次分区时间
     std::chrono::system_clock::time_point last_recovery_time;  // 最后一次恢复时间
     
@@ -179,7 +183,9 @@ struct PartitionRecoveryStats {
                               node_failures_detected(0), nodes_recovered(0),
                               average_detection_time_ms(0.0), average_recovery_time_ms(0.0),
                               partition_recovery_rate(0.0), false_positives(0),
-                              false_negatives(0), detection_accuracy(1.0) {}
+                              false_negatives(0), detection_accuracy(1.0),
+                              anti_entropy_rounds(0), anti_entropy_hashes_exchanged(0),
+                              anti_entropy_keys_synced(0) {}
 };
 
 // 数据一致性冲突
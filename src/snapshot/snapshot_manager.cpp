@@ -18,3 +18,8 @@ uint64_t SnapshotManager::min_seq() const {
     }
     return *active_.begin(); // 返回最小的 seq
 }
+
+std::vector<uint64_t> SnapshotManager::active_seqs() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::vector<uint64_t>(active_.begin(), active_.end());
+}
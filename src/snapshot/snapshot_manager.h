@@ -2,12 +2,14 @@
 #include "snapshot/snapshot.h"
 #include <set>
 #include <mutex>
+#include <vector>
 
 class SnapshotManager {
 public:
     Snapshot create(uint64_t seq);
     void release(const Snapshot& s);
     uint64_t min_seq() const; // 返回最小活跃 snapshot seq，如果没有则返回 0
+    std::vector<uint64_t> active_seqs() const; // 所有活跃 snapshot 的 seq，升序
 
 private:
     mutable std::mutex mutex_;
@@ -2,6 +2,7 @@
 #include <algorithm>
 #include <sstream>
 #include <iostream>
+#include <stdexcept>
 
 void BlockIndex::add_block(const std::string& first_key, const std::string& last_key,
                           uint64_t offset, uint32_t size, uint32_t num_entries) {
@@ -54,21 +55,43 @@ const BlockIndexEntry* BlockIndex::get_block(uint32_t block_id) const {
     return nullptr;
 }
 
+namespace {
+
+// 长度前缀的字符串：key 可以包含任意字节（包括 '|' 与换行）
+void write_string(std::ostream& out, const std::string& s) {
+    out << s.size() << ' ';
+    out.write(s.data(), static_cast<std::streamsize>(s.size()));
+}
+
+bool read_string(std::istream& in, std::string& s) {
+    size_t len = 0;
+    if (!(in >> len) || in.get() != ' ') {
+        return false;
+    }
+    s.resize(len);
+    return len == 0 || in.read(&s[0], static_cast<std::streamsize>(len));
+}
+
+} // namespace
+
 void BlockIndex::serialize(std::ostream& out) const {
     // Write header
-    out << "BLOCK_INDEX_V1\n";
-    out << common_prefix_.length() << " " << common_prefix_ << "\n";
-    out << block_entries_.size() << " " << sparse_entries_.size() << "\n";
+    out << "BLOCK_INDEX_V2\n";
+    write_string(out, common_prefix_);
+    out << "\n" << block_entries_.size() << " " << sparse_entries_.size() << "\n";
     
-    // Write block entries
+    // Write block entries: first_key last_key offset size num_entries
     for (const auto& entry : block_entries_) {
-        out << entry.first_key << "|" << entry.last_key << "|"
-            << entry.offset << "|" << entry.size << "|" << entry.num_entries << "\n";
+        write_string(out, entry.first_key);
+        out << " ";
+        write_string(out, entry.last_key);
+        out << " " << entry.offset << " " << entry.size << " " << entry.num_entries << "\n";
     }
     
-    // Write sparse entries
+    // Write sparse entries: key_suffix block_id prefix_len
     for (const auto& entry : sparse_entries_) {
-        out << entry.key_suffix << "|" << entry.block_id << "|" << entry.prefix_len << "\n";
+        write_string(out, entry.key_suffix);
+        out << " " << entry.block_id << " " << entry.prefix_len << "\n";
     }
 }
 
@@ -77,62 +100,43 @@ void BlockIndex::deserialize(std::istream& in) {
     
     // Read header
     std::getline(in, line);
-    if (line != "BLOCK_INDEX_V1") {
+    if (line != "BLOCK_INDEX_V2") {
         throw std::runtime_error("Invalid block index format");
     }
     
-    // Read common prefix
-    std::getline(in, line);
-    std::istringstream prefix_stream(line);
-    size_t prefix_len;
-    prefix_stream >> prefix_len;
-    if (prefix_len > 0) {
-        prefix_stream.ignore(1); // Skip space
-        std::getline(prefix_stream, common_prefix_);
+    // Read common prefix and counts
+    size_t block_count = 0, sparse_count = 0;
+    if (!read_string(in, common_prefix_) || !(in >> block_count >> sparse_count)) {
+        throw std::runtime_error("Corrupted block index header");
     }
     
-    // Read counts
-    std::getline(in, line);
-    std::istringstream count_stream(line);
-    size_t block_count, sparse_count;
-    count_stream >> block_count >> sparse_count;
-    
     // Read block entries
+    block_entries_.clear();
     block_entries_.reserve(block_count);
     for (size_t i = 0; i < block_count; ++i) {
-        std::getline(in, line);
-        std::istringstream entry_stream(line);
         std::string first_key, last_key;
         uint64_t offset;
         uint32_t size, num_entries;
-        
-        std::getline(entry_stream, first_key, '|');
-        std::getline(entry_stream, last_key, '|');
-        entry_stream >> offset;
-        entry_stream.ignore(1); // Skip '|'
-        entry_stream >> size;
-        entry_stream.ignore(1); // Skip '|'
-        entry_stream >> num_entries;
-        
+        if (!read_string(in, first_key) || !read_string(in, last_key) ||
+            !(in >> offset >> size >> num_entries)) {
+            throw std::runtime_error("Corrupted block index entry");
+        }
         block_entries_.emplace_back(first_key, last_key, offset, size, num_entries);
     }
     
     // Read sparse entries
+    sparse_entries_.clear();
     sparse_entries_.reserve(sparse_count);
     for (size_t i = 0; i < sparse_count; ++i) {
-        std::getline(in, line);
-        std::istringstream entry_stream(line);
         std::string key_suffix;
         uint32_t block_id;
         uint16_t prefix_len;
-        
-        std::getline(entry_stream, key_suffix, '|');
-        entry_stream >> block_id;
-        entry_stream.ignore(1); // Skip '|'
-        entry_stream >> prefix_len;
-        
+        if (!read_string(in, key_suffix) || !(in >> block_id >> prefix_len)) {
+            throw std::runtime_error("Corrupted block index entry");
+        }
         sparse_entries_.emplace_back(key_suffix, block_id, prefix_len);
     }
+    in.ignore(1);  // 最后一条的换行
 }
 
 size_t BlockIndex::get_size() const {
@@ -0,0 +1,288 @@
+#include "sstable/data_block.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+void put_varint64(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+void put_fixed32(std::string& out, uint32_t value) {
+    char buf[4];
+    for (int i = 0; i < 4; i++) {
+        buf[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+    out.append(buf, 4);
+}
+
+uint32_t get_fixed32(const char* p) {
+    const auto* u = reinterpret_cast<const unsigned char*>(p);
+    return static_cast<uint32_t>(u[0]) | (static_cast<uint32_t>(u[1]) << 8) |
+           (static_cast<uint32_t>(u[2]) << 16) | (static_cast<uint32_t>(u[3]) << 24);
+}
+
+// 越界或超过 10 字节返回 nullptr
+const char* get_varint64(const char* p, const char* limit, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift <= 63 && p < limit; shift += 7) {
+        uint64_t byte = static_cast<unsigned char>(*p++);
+        value |= (byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return p;
+        }
+    }
+    return nullptr;
+}
+
+const char* get_varint32(const char* p, const char* limit, uint32_t& value) {
+    uint64_t v = 0;
+    p = get_varint64(p, limit, v);
+    if (!p || v > UINT32_MAX) {
+        return nullptr;
+    }
+    value = static_cast<uint32_t>(v);
+    return p;
+}
+
+size_t common_prefix(const char* a, size_t a_len, const char* b, size_t b_len) {
+    size_t n = std::min(a_len, b_len);
+    size_t i = 0;
+    while (i < n && a[i] == b[i]) {
+        i++;
+    }
+    return i;
+}
+
+} // namespace
+
+// DataBlockBuilder 实现
+DataBlockBuilder::DataBlockBuilder(uint32_t restart_interval)
+    : restart_interval_(std::max<uint32_t>(restart_interval, 1)) {
+    restarts_.push_back(0);
+}
+
+void DataBlockBuilder::add(const std::string& key, const std::vector<VersionedValue>& versions) {
+    size_t shared = 0;
+    if (counter_ < restart_interval_) {
+        shared = common_prefix(last_key_.data(), last_key_.size(), key.data(), key.size());
+    } else {
+        restarts_.push_back(static_cast<uint32_t>(buffer_.size()));
+        counter_ = 0;
+    }
+    size_t non_shared = key.size() - shared;
+
+    payload_.clear();
+    put_varint64(payload_, versions.size());
+    uint64_t prev_seq = 0;
+    for (size_t i = 0; i < versions.size(); i++) {
+        put_varint64(payload_, i == 0 ? versions[i].seq : prev_seq - versions[i].seq);
+        put_varint64(payload_, versions[i].value.size());
+        payload_.append(versions[i].value);
+        prev_seq = versions[i].seq;
+    }
+
+    put_varint64(buffer_, shared);
+    put_varint64(buffer_, non_shared);
+    put_varint64(buffer_, payload_.size());
+    buffer_.append(key, shared, non_shared);
+    buffer_.append(payload_);
+
+    last_key_.assign(key);
+    counter_++;
+    num_entries_++;
+}
+
+const std::string& DataBlockBuilder::finish() {
+    if (!finished_) {
+        for (uint32_t offset : restarts_) {
+            put_fixed32(buffer_, offset);
+        }
+        put_fixed32(buffer_, static_cast<uint32_t>(restarts_.size()));
+        finished_ = true;
+    }
+    return buffer_;
+}
+
+void DataBlockBuilder::reset() {
+    buffer_.clear();
+    restarts_.assign(1, 0);
+    last_key_.clear();
+    counter_ = 0;
+    num_entries_ = 0;
+    finished_ = false;
+}
+
+// DataBlockReader 实现
+DataBlockReader::DataBlockReader(const char* data, size_t size) : data_(data) {
+    if (size < sizeof(uint32_t)) {
+        return;
+    }
+    num_restarts_ = get_fixed32(data + size - sizeof(uint32_t));
+    size_t max_restarts = (size - sizeof(uint32_t)) / sizeof(uint32_t);
+    if (num_restarts_ == 0 || num_restarts_ > max_restarts) {
+        return;
+    }
+    restarts_offset_ = size - (num_restarts_ + 1) * sizeof(uint32_t);
+    for (uint32_t i = 0; i < num_restarts_; i++) {
+        if (restart_offset(i) > restarts_offset_) {
+            return;
+        }
+    }
+    valid_ = true;
+}
+
+uint32_t DataBlockReader::restart_offset(uint32_t index) const {
+    return get_fixed32(data_ + restarts_offset_ + index * sizeof(uint32_t));
+}
+
+bool DataBlockReader::decode_header(const char* p, const char* limit, EntryHeader& header) const {
+    if (!(p = get_varint32(p, limit, header.shared)) ||
+        !(p = get_varint32(p, limit, header.non_shared)) ||
+        !(p = get_varint32(p, limit, header.payload_len))) {
+        return false;
+    }
+    if (static_cast<size_t>(limit - p) < static_cast<size_t>(header.non_shared) + header.payload_len) {
+        return false;
+    }
+    header.key_delta = p;
+    return true;
+}
+
+bool DataBlockReader::find_version(const char* p, const char* limit, uint64_t snapshot_seq,
+                                   uint64_t& seq, Slice& value) {
+    uint64_t count = 0;
+    if (!(p = get_varint64(p, limit, count))) {
+        return false;
+    }
+    uint64_t current = 0;
+    for (uint64_t i = 0; i < count; i++) {
+        uint64_t delta = 0;
+        uint32_t value_len = 0;
+        if (!(p = get_varint64(p, limit, delta)) || !(p = get_varint32(p, limit, value_len)) ||
+            static_cast<size_t>(limit - p) < value_len) {
+            return false;
+        }
+        current = i == 0 ? delta : current - delta;
+        if (current <= snapshot_seq) {
+            seq = current;
+            value = Slice(p, value_len);
+            return true;
+        }
+        p += value_len;
+    }
+    return false;
+}
+
+bool DataBlockReader::visible_version(const Slice& payload, uint64_t snapshot_seq, uint64_t& seq, Slice& value) {
+    return find_version(payload.data(), payload.data() + payload.size(), snapshot_seq, seq, value);
+}
+
+bool DataBlockReader::decode_versions(const Slice& payload, std::vector<VersionedValue>& versions) {
+    const char* p = payload.data();
+    const char* limit = p + payload.size();
+    uint64_t count = 0;
+    if (!(p = get_varint64(p, limit, count))) {
+        return false;
+    }
+    uint64_t current = 0;
+    for (uint64_t i = 0; i < count; i++) {
+        uint64_t delta = 0;
+        uint32_t value_len = 0;
+        if (!(p = get_varint64(p, limit, delta)) || !(p = get_varint32(p, limit, value_len)) ||
+            static_cast<size_t>(limit - p) < value_len) {
+            return false;
+        }
+        current = i == 0 ? delta : current - delta;
+        versions.emplace_back(current, std::string(p, value_len));
+        p += value_len;
+    }
+    return true;
+}
+
+bool DataBlockReader::decode_entries(std::vector<std::string>& keys, std::vector<Slice>& payloads) const {
+    if (!valid_) {
+        return false;
+    }
+    const char* p = data_;
+    const char* limit = data_ + restarts_offset_;
+    std::string key;
+    while (p < limit) {
+        EntryHeader header;
+        if (!decode_header(p, limit, header) || header.shared > key.size()) {
+            return false;
+        }
+        key.resize(header.shared);
+        key.append(header.key_delta, header.non_shared);
+        keys.push_back(key);
+        payloads.emplace_back(header.key_delta + header.non_shared, header.payload_len);
+        p = header.key_delta + header.non_shared + header.payload_len;
+    }
+    return true;
+}
+
+bool DataBlockReader::find(const Slice& key, uint64_t snapshot_seq, uint64_t& seq, Slice& value) const {
+    if (!valid_) {
+        return false;
+    }
+    const char* limit = data_ + restarts_offset_;
+
+    // 1. 找最后一个 key <= 目标的重启点
+    uint32_t left = 0;
+    uint32_t right = num_restarts_;
+    while (left < right) {
+        uint32_t mid = left + (right - left) / 2;
+        EntryHeader header;
+        if (!decode_header(data_ + restart_offset(mid), limit, header) || header.shared != 0) {
+            return false;
+        }
+        if (Slice(header.key_delta, header.non_shared).compare(key) <= 0) {
+            left = mid + 1;
+        } else {
+            right = mid;
+        }
+    }
+    if (left == 0) {
+        return false;  // 比块内第一个 key 还小
+    }
+
+    // 2. 从该重启点顺序扫描（重启点 shared 为 0，与初始 matched 相同）。
+    //    matched 为当前 key 与目标的公共前缀长度，当前 key 总是小于目标：
+    //    下一个 key 的 shared > matched 时它在同一位置与目标不同，仍小于目标；
+    //    shared < matched 时它在 shared 处大于当前 key，即大于目标，目标不存在；
+    //    shared == matched 时只需比较差异部分与目标剩余部分
+    const char* p = data_ + restart_offset(left - 1);
+    size_t matched = 0;
+    while (p < limit) {
+        EntryHeader header;
+        if (!decode_header(p, limit, header)) {
+            return false;
+        }
+        const char* payload = header.key_delta + header.non_shared;
+        const char* next = payload + header.payload_len;
+
+        if (header.shared == matched) {
+            const char* rest = key.data() + matched;
+            size_t rest_len = key.size() - matched;
+            size_t lcp = common_prefix(header.key_delta, header.non_shared, rest, rest_len);
+            if (lcp == header.non_shared && lcp == rest_len) {
+                return find_version(payload, next, snapshot_seq, seq, value);
+            }
+            bool less = lcp == header.non_shared ||
+                        (lcp < rest_len && static_cast<unsigned char>(header.key_delta[lcp]) <
+                                               static_cast<unsigned char>(rest[lcp]));
+            if (!less) {
+                return false;
+            }
+            matched += lcp;
+        } else if (header.shared < matched) {
+            return false;
+        }
+        p = next;
+    }
+    return false;
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "storage/slice.h"
+#include "storage/versioned_value.h"
+
+// 前缀压缩数据块（ENHANCED_SSTABLE_V2 的数据块格式）
+//
+// 条目：shared(varint32) | non_shared(varint32) | payload_len(varint32) | key 差异部分 | payload
+//   shared 为与前一个 key 的公共前缀长度，每 restart_interval 个条目设一个重启点，重启点 shared 恒为 0；
+//   payload 为该 key 的全部版本（seq DESC）：count(varint32)，随后每个版本
+//   seq 差分(varint64，首个版本为 seq 本身，其余为与上一版本之差) | value_len(varint32) | value
+// 块尾：各重启点在块内的偏移(fixed32 小端) × n | n(fixed32)
+class DataBlockBuilder {
+public:
+    explicit DataBlockBuilder(uint32_t restart_interval = 16);
+
+    // key 须严格递增，versions 须按 seq DESC 排列
+    void add(const std::string& key, const std::vector<VersionedValue>& versions);
+
+    // 写入块尾并返回完整的块，调用 reset() 前保持有效
+    const std::string& finish();
+    void reset();
+
+    bool empty() const { return num_entries_ == 0; }
+    uint32_t num_entries() const { return num_entries_; }
+    // 当前块 finish() 之后的大小
+    size_t size_estimate() const { return buffer_.size() + (restarts_.size() + 1) * sizeof(uint32_t); }
+
+private:
+    uint32_t restart_interval_;
+    std::string buffer_;
+    std::vector<uint32_t> restarts_;
+    std::string last_key_;
+    std::string payload_;  // 复用的版本编码缓冲
+    uint32_t counter_ = 0;  // 距上一个重启点的条目数
+    uint32_t num_entries_ = 0;
+    bool finished_ = false;
+};
+
+// 数据块的只读视图，不拷贝块内容。查找先在重启点上二分（重启点 key 完整存储，可直接比较），
+// 再从该重启点顺序解码至多 restart_interval 个条目；比较只跟踪与目标 key 的公共前缀长度，不拼接 key，全程不分配内存
+class DataBlockReader {
+public:
+    DataBlockReader(const char* data, size_t size);
+
+    // 块尾是否完整、重启点是否都在数据区内
+    bool valid() const { return valid_; }
+    uint32_t num_restarts() const { return num_restarts_; }
+
+    // 查找 key 在 snapshot_seq 时刻的可见版本（包括墓碑）；value 指向块内数据
+    bool find(const Slice& key, uint64_t snapshot_seq, uint64_t& seq, Slice& value) const;
+
+    // 按顺序解码块内全部条目：keys 为完整 key，payloads 指向块内各条目的版本编码；格式错误时返回 false
+    bool decode_entries(std::vector<std::string>& keys, std::vector<Slice>& payloads) const;
+
+    // 在一个条目的版本编码中找 snapshot_seq 可见的版本；value 指向 payload 内数据
+    static bool visible_version(const Slice& payload, uint64_t snapshot_seq, uint64_t& seq, Slice& value);
+    // 解码一个条目的全部版本（seq DESC）
+    static bool decode_versions(const Slice& payload, std::vector<VersionedValue>& versions);
+
+private:
+    struct EntryHeader {
+        uint32_t shared;
+        uint32_t non_shared;
+        uint32_t payload_len;
+        const char* key_delta;  // 紧跟其后为 payload
+    };
+
+    // 解码 p 处的条目头，越界或格式错误返回 false
+    bool decode_header(const char* p, const char* limit, EntryHeader& header) const;
+    uint32_t restart_offset(uint32_t index) const;
+    // 在条目 payload 中找 snapshot_seq 可见的版本
+    static bool find_version(const char* p, const char* limit, uint64_t snapshot_seq, uint64_t& seq, Slice& value);
+
+    const char* data_;
+    size_t restarts_offset_ = 0;  // 重启点数组在块内的起始位置，也是数据区的结尾
+    uint32_t num_restarts_ = 0;
+    bool valid_ = false;
+};
@@ -0,0 +1,101 @@
+#include "sstable/sst_file_writer.h"
+#include <filesystem>
+
+static const std::string TOMBSTONE = "__TOMBSTONE__";
+
+SstFileWriter::~SstFileWriter() {
+    abandon();
+}
+
+bool SstFileWriter::open(const std::string& filename) {
+    abandon();
+
+    out_.open(filename, std::ios::binary | std::ios::trunc);
+    if (!out_.is_open()) {
+        return fail("无法创建文件: " + filename);
+    }
+    filename_ = filename;
+    index_.clear();
+    bloom_ = BloomFilter(8192, 3);
+    file_size_ = 0;
+    error_.clear();
+    return true;
+}
+
+bool SstFileWriter::put(const std::string& key, const std::string& value) {
+    if (value == TOMBSTONE || value.find('\n') != std::string::npos) {
+        return fail("非法的值: " + key);
+    }
+    return add(key, value);
+}
+
+bool SstFileWriter::del(const std::string& key) {
+    return add(key, TOMBSTONE);
+}
+
+bool SstFileWriter::add(const std::string& key, const std::string& value) {
+    if (!out_.is_open()) {
+        return fail("文件未打开");
+    }
+    if (key.empty() || key.find_first_of(" \t\r\n") != std::string::npos) {
+        return fail("非法的键: " + key);
+    }
+    if (!index_.empty() && key <= index_.back().first) {
+        return fail("键未严格递增: " + index_.back().first + " >= " + key);
+    }
+
+    // 文本格式数据：key seq value
+    index_.emplace_back(key, file_size_);
+    bloom_.add(key);
+    out_ << key << " 0 " << value << '\n';
+    file_size_ += key.size() + value.size() + 4;
+    return true;
+}
+
+bool SstFileWriter::finish(SSTableMeta* meta) {
+    if (!out_.is_open()) {
+        return fail("文件未打开");
+    }
+    if (index_.empty()) {
+        abandon();
+        return fail("没有写入任何键");
+    }
+
+    uint64_t index_offset = out_.tellp();
+    for (const auto& [key, offset] : index_) {
+        out_ << key << " " << offset << '\n';
+    }
+    uint64_t bloom_offset = out_.tellp();
+    bloom_.serialize(out_);
+    out_ << index_offset << " " << bloom_offset << '\n';
+    file_size_ = out_.tellp();
+    out_.close();
+    if (!out_) {
+        std::string filename = filename_;
+        abandon();
+        return fail("写入失败: " + filename);
+    }
+
+    if (meta) {
+        *meta = SSTableMeta(filename_, index_.front().first, index_.back().first, file_size_);
+    }
+    filename_.clear();
+    index_.clear();
+    return true;
+}
+
+bool SstFileWriter::fail(const std::string& error) {
+    error_ = error;
+    return false;
+}
+
+void SstFileWriter::abandon() {
+    if (out_.is_open()) {
+        out_.close();
+    }
+    if (!filename_.empty()) {
+        std::error_code ec;
+        std::filesystem::remove(filename_, ec);
+        filename_.clear();
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+#include "sstable/sstable_meta.h"
+#include "bloom/bloom_filter.h"
+
+// 从有序输入流式构建 SSTable（文本格式，读取端与 SSTableWriter::write 的块格式都支持），
+// 供批量导入离线生成文件后交给 KVDB::ingest_external_files。
+// 文件内版本序列号统一为 0，导入时由数据库分配全局序列号。
+class SstFileWriter {
+public:
+    SstFileWriter() = default;
+    ~SstFileWriter();  // 未 finish 的半成品文件会被删除
+
+    SstFileWriter(const SstFileWriter&) = delete;
+    SstFileWriter& operator=(const SstFileWriter&) = delete;
+
+    bool open(const std::string& filename);
+    // 键必须严格递增；键不能为空或包含空白，值不能包含换行（文本格式的限制）
+    bool put(const std::string& key, const std::string& value);
+    bool del(const std::string& key);
+    // 写入索引、Bloom Filter 和 footer；meta 非空时返回文件元数据
+    bool finish(SSTableMeta* meta = nullptr);
+
+    size_t num_entries() const { return index_.size(); }  // 当前打开文件已写入的键数
+    uint64_t file_size() const { return file_size_; }
+    const std::string& last_error() const { return error_; }
+
+private:
+    bool add(const std::string& key, const std::string& value);
+    bool fail(const std::string& error);
+    void abandon();
+
+    std::ofstream out_;
+    std::string filename_;
+    std::vector<std::pair<std::string, uint64_t>> index_;
+    BloomFilter bloom_{8192, 3};
+    uint64_t file_size_ = 0;
+    std::string error_;
+};
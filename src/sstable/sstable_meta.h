@@ -1,23 +1,64 @@
 #pragma once
 #include <string>
 #include <utility>
+#include <memory>
+#include <cstdint>
+#include "storage/range_tombstone.h"
+#include "storage/prefix_extractor.h"
+#include "bloom/bloom_filter.h"
+
+// 文件属性：数据的写入时间范围（Unix 秒），写在 SSTable 的属性块中；0 表示未知（旧文件或外部导入）
+struct SSTableProperties {
+    uint64_t min_timestamp = 0;
+    uint64_t max_timestamp = 0;
+
+    bool has_timestamps() const { return max_timestamp > 0; }
+};
+
+// 前缀 Bloom Filter：文件中所有 key 的前缀（按 extractor 提取）
+struct PrefixBloom {
+    std::string extractor;  // 写入时提取器的名称
+    BloomFilter filter;
+};
 
 struct SSTableMeta {
     std::string filename;
     std::string min_key;
     std::string max_key;
     size_t file_size;
+    // 外部导入文件的全局序列号：文件内版本序列号为 0，读取时一律视为该序列号；0 表示普通文件
+    uint64_t global_seq;
+    // 文件中的范围删除（打开文件时加载一次，拷贝之间共享）；没有则为空。
+    // 有范围删除时 [min_key, max_key] 也覆盖这些范围，max_key 取范围的开区间上界
+    std::shared_ptr<const FragmentedRangeTombstoneList> range_tombstones;
+    SSTableProperties properties;
+    // 前缀 Bloom Filter（打开文件时加载一次，拷贝之间共享）；列族没有前缀提取器时为空
+    std::shared_ptr<const PrefixBloom> prefix_bloom;
     
     SSTableMeta(const std::string& filename, 
                 const std::string& min_key, 
                 const std::string& max_key, 
-                size_t file_size)
-        : filename(filename), min_key(min_key), max_key(max_key), file_size(file_size) {}
+                size_t file_size,
+                uint64_t global_seq = 0)
+        : filename(filename), min_key(min_key), max_key(max_key), file_size(file_size),
+          global_seq(global_seq) {}
     
     bool contains_key(const std::string& key) const {
         return key >= min_key && key <= max_key;
     }
     
+    // 文件中可能有以 prefix 开头的 key：先看键范围，再在提取器名称一致时查前缀 Bloom Filter
+    bool may_contain_prefix(const std::string& prefix, const PrefixExtractor* extractor) const {
+        if (max_key < prefix || (min_key > prefix && min_key.compare(0, prefix.size(), prefix) != 0)) {
+            return false;
+        }
+        if (!prefix_bloom || !extractor || !extractor->in_domain(prefix) ||
+            prefix_bloom->extractor != extractor->name()) {
+            return true;
+        }
+        return prefix_bloom->filter.possiblyContains(extractor->transform(prefix));
+    }
+    
     bool overlaps_with(const SSTableMeta& other) const {
         return !(max_key < other.min_key || min_key > other.max_key);
     }
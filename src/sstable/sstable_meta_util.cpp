@@ -1,48 +1,32 @@
 #include "sstable/sstable_meta_util.h"
 #include "sstable/sstable_reader.h"
+#include "sstable/block_index.h"
+#include "sstable/data_block.h"
 #include <fstream>
 #include <sstream>
 #include <filesystem>
 
 std::pair<std::string, std::string> 
 SSTableMetaUtil::get_key_range_from_file(const std::string& filename) {
-    std::ifstream in(filename);
+    std::ifstream in(filename, std::ios::binary);
     if (!in.is_open()) {
         return {"", ""};
     }
     
     // 先读取footer获取index_offset
-    in.seekg(0, std::ios::end);
-    std::streampos file_size = in.tellg();
-    
-    std::string last_line;
-    long pos = (long)file_size - 1;
+    SSTableFooter footer = SSTableReader::read_footer(in);
+    uint64_t index_offset = footer.index_offset;
     
-    in.seekg(pos);
-    char c;
-    while (pos > 0 && in.get(c) && c == '\n') {
-        pos--;
-        in.seekg(pos);
-    }
-    
-    while (pos > 0) {
-        in.seekg(pos);
-        in.get(c);
-        if (c == '\n') {
-            pos++;
-            break;
+    // 块格式：块索引里记着每块的首尾 key，不必扫描数据区
+    if (footer.block_format != 0) {
+        BlockIndex block_index;
+        if (!read_block_index(in, footer, block_index) || block_index.get_block_count() == 0) {
+            return {"", ""};
         }
-        pos--;
+        return {block_index.get_block(0)->first_key,
+                block_index.get_block(static_cast<uint32_t>(block_index.get_block_count() - 1))->last_key};
     }
     
-    in.clear();
-    in.seekg(pos);
-    std::getline(in, last_line);
-    
-    uint64_t index_offset = 0;
-    std::istringstream footer_iss(last_line);
-    footer_iss >> index_offset; // 读取index_offset，忽略bloom_offset
-    
     // 只读取数据部分（从文件开始到index_offset）
     in.clear();
     in.seekg(0);
@@ -67,12 +51,9 @@ SSTableMetaUtil::get_key_range_from_file(const std::string& filename) {
         }
     }
     
-    // 继续读取数据部分，直到index_offset
-    while (std::getline(in, line)) {
+    // 继续读取数据部分，直到index_offset（先判断行首位置，数据区最后一行也要计入）
+    while (current_pos < index_offset && std::getline(in, line)) {
         current_pos = in.tellg();
-        if (current_pos >= index_offset) {
-            break;
-        }
         
         std::istringstream iss(line);
         std::string key;
@@ -90,5 +71,175 @@ SSTableMeta SSTableMetaUtil::get_meta_from_file(const std::string& filename) {
     auto [min_key, max_key] = get_key_range_from_file(filename);
     size_t file_size = std::filesystem::file_size(filename);
     
-    return SSTableMeta(filename, min_key, max_key, file_size);
-}
\ No newline at end of file
+    // 键范围包含范围删除，压缩挑选重叠文件与读取判断 contains_key 时才不会漏掉它们
+    auto range_tombstones = read_range_tombstones(filename);
+    if (range_tombstones) {
+        std::string smallest = range_tombstones->smallest_key();
+        std::string largest = range_tombstones->largest_key();
+        if (min_key.empty() || smallest < min_key) {
+            min_key = smallest;
+        }
+        if (max_key.empty() || largest > max_key) {
+            max_key = largest;
+        }
+    }
+    
+    SSTableMeta meta(filename, min_key, max_key, file_size);
+    meta.range_tombstones = range_tombstones;
+    meta.properties = read_properties(filename);
+    meta.prefix_bloom = read_prefix_bloom(filename);
+    return meta;
+}
+
+bool SSTableMetaUtil::read_block_index(std::ifstream& in, const SSTableFooter& footer, BlockIndex& block_index) {
+    in.clear();
+    in.seekg(footer.index_offset);
+    try {
+        block_index.deserialize(in);
+    } catch (const std::exception&) {
+        return false;
+    }
+    return true;
+}
+
+uint64_t SSTableMetaUtil::read_range_del_offset(std::ifstream& in) {
+    return SSTableReader::read_footer(in).range_del_offset;
+}
+
+SSTableProperties SSTableMetaUtil::read_properties(const std::string& filename) {
+    SSTableProperties properties;
+    std::ifstream in(filename);
+    if (!in.is_open()) {
+        return properties;
+    }
+
+    uint64_t properties_offset = SSTableReader::read_footer(in).properties_offset;
+    if (properties_offset == 0) {
+        return properties;
+    }
+
+    in.clear();
+    in.seekg(properties_offset);
+    std::string header;
+    if (!(in >> header >> properties.min_timestamp >> properties.max_timestamp) || header != "PROPS") {
+        return SSTableProperties();
+    }
+    return properties;
+}
+
+std::shared_ptr<const PrefixBloom> SSTableMetaUtil::read_prefix_bloom(const std::string& filename) {
+    std::ifstream in(filename);
+    if (!in.is_open()) {
+        return nullptr;
+    }
+
+    uint64_t prefix_bloom_offset = SSTableReader::read_footer(in).prefix_bloom_offset;
+    if (prefix_bloom_offset == 0) {
+        return nullptr;
+    }
+
+    in.clear();
+    in.seekg(prefix_bloom_offset);
+    static const std::string header = "PREFIX_BLOOM ";
+    std::string line;
+    if (!std::getline(in, line) || line.compare(0, header.size(), header) != 0) {
+        return nullptr;
+    }
+    auto bloom = std::make_shared<PrefixBloom>();
+    bloom->extractor = line.substr(header.size());
+    bloom->filter.deserialize(in);
+    return bloom;
+}
+
+std::shared_ptr<const FragmentedRangeTombstoneList>
+SSTableMetaUtil::read_range_tombstones(const std::string& filename) {
+    std::ifstream in(filename);
+    if (!in.is_open()) {
+        return nullptr;
+    }
+
+    // 没有范围删除的文件 footer 里不写这一项
+    uint64_t range_del_offset = read_range_del_offset(in);
+    if (range_del_offset == 0) {
+        return nullptr;
+    }
+
+    in.clear();
+    in.seekg(range_del_offset);
+    std::string header;
+    size_t count = 0;
+    if (!(in >> header >> count) || header != "RANGE_DEL") {
+        return nullptr;
+    }
+
+    std::vector<RangeTombstone> tombstones;
+    for (size_t i = 0; i < count; i++) {
+        RangeTombstone tombstone;
+        if (!(in >> tombstone.start >> tombstone.end >> tombstone.seq)) {
+            break;
+        }
+        tombstones.push_back(std::move(tombstone));
+    }
+    if (tombstones.empty()) {
+        return nullptr;
+    }
+    return std::make_shared<const FragmentedRangeTombstoneList>(tombstones);
+}
+
+void SSTableMetaUtil::for_each_record(const std::string& filename,
+    const std::function<void(const std::string& key, uint64_t seq, const std::string& value)>& fn) {
+    std::ifstream in(filename, std::ios::binary);
+    if (!in.is_open()) {
+        return;
+    }
+    SSTableFooter footer = SSTableReader::read_footer(in);
+    
+    // 块格式：逐块读入并解码全部条目
+    if (footer.block_format == 2) {
+        BlockIndex block_index;
+        if (!read_block_index(in, footer, block_index)) {
+            return;
+        }
+        std::string block;
+        std::vector<std::string> keys;
+        std::vector<Slice> payloads;
+        std::vector<VersionedValue> versions;
+        for (uint32_t i = 0; i < block_index.get_block_count(); i++) {
+            const BlockIndexEntry* entry = block_index.get_block(i);
+            block.resize(entry->size);
+            in.clear();
+            in.seekg(entry->offset);
+            if (!in.read(&block[0], static_cast<std::streamsize>(block.size()))) {
+                return;
+            }
+            keys.clear();
+            payloads.clear();
+            DataBlockReader(block.data(), block.size()).decode_entries(keys, payloads);
+            for (size_t j = 0; j < keys.size(); j++) {
+                versions.clear();
+                DataBlockReader::decode_versions(payloads[j], versions);
+                for (const auto& v : versions) {
+                    fn(keys[j], v.seq, v.value);
+                }
+            }
+        }
+        return;
+    }
+    
+    uint64_t index_offset = footer.index_offset;
+    in.clear();
+    in.seekg(0);
+    
+    std::string line;
+    uint64_t current_pos = 0;
+    while (current_pos < index_offset && std::getline(in, line)) {
+        current_pos += line.size() + 1;
+        std::istringstream iss(line);
+        std::string key;
+        uint64_t seq;
+        std::string value;
+        if (iss >> key >> seq >> value) {
+            fn(key, seq, value);
+        }
+    }
+}
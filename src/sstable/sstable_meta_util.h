@@ -1,12 +1,37 @@
 #pragma once
 #include "sstable/sstable_meta.h"
+#include "sstable/sstable_reader.h"
+#include "sstable/block_index.h"
 #include <string>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <memory>
 
 class SSTableMetaUtil {
 public:
     static SSTableMeta get_meta_from_file(const std::string& filename);
     
+    // 按文件顺序遍历数据区的每条记录（文本格式与块格式均可），同一 key 的所有版本都会访问到
+    static void for_each_record(const std::string& filename,
+        const std::function<void(const std::string& key, uint64_t seq, const std::string& value)>& fn);
+    
+    // 读取文件的范围删除块（RANGE_DEL n 之后 n 行 start end seq）；没有范围删除时返回 nullptr
+    static std::shared_ptr<const FragmentedRangeTombstoneList>
+    read_range_tombstones(const std::string& filename);
+    
+    // 读取文件的属性块（PROPS min_timestamp max_timestamp）；没有属性块时各项为 0
+    static SSTableProperties read_properties(const std::string& filename);
+    
+    // 读取文件的前缀 Bloom Filter 块（PREFIX_BLOOM <提取器名称> 之后一行过滤器）；没有时返回 nullptr
+    static std::shared_ptr<const PrefixBloom> read_prefix_bloom(const std::string& filename);
+    
 private:
     static std::pair<std::string, std::string> 
     get_key_range_from_file(const std::string& filename);
+    
+    // 读 footer 中的 range_del_offset，没有范围删除块时为 0
+    static uint64_t read_range_del_offset(std::ifstream& in);
+    // 读块格式文件的块索引，损坏时返回 false
+    static bool read_block_index(std::ifstream& in, const SSTableFooter& footer, BlockIndex& block_index);
 };
\ No newline at end of file
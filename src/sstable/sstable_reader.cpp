@@ -1,59 +1,17 @@
 #include "sstable/sstable_reader.h"
 #include "sstable/block_index.h"
+#include "sstable/data_block.h"
 #include "bloom/bloom_filter.h"
 #include <fstream>
 #include <sstream>
 #include <vector>
 #include <climits>
 #include <cstdint>
+#include <stdexcept>
 
-struct SSTableFooter {
-    uint64_t index_offset;
-    uint64_t bloom_offset;
-};
 
-struct EnhancedSSTableFooter {
-    uint64_t data_start_offset;
-    uint64_t block_index_offset;
-    uint64_t bloom_offset;
-};
-
-static SSTableFooter read_footer(std::ifstream& in) {
-    in.seekg(0, std::ios::end);
-    std::streampos file_size = in.tellg();
-
-    std::string last_line;
-    long pos = (long)file_size - 1;
-
-    in.seekg(pos);
-    char c;
-    while (pos > 0 && in.get(c) && c == '\n') {
-        pos--;
-        in.seekg(pos);
-    }
-
-    while (pos > 0) {
-        in.seekg(pos);
-        in.get(c);
-        if (c == '\n') {
-            pos++;
-            break;
-        }
-        pos--;
-    }
-    
+SSTableFooter SSTableReader::read_footer(std::ifstream& in) {
     in.clear();
-    in.seekg(pos);
-    std::getline(in, last_line);
-
-    SSTableFooter footer = {0, 0};
-    std::istringstream iss(last_line);
-    iss >> footer.index_offset >> footer.bloom_offset;
-
-    return footer;
-}
-
-static EnhancedSSTableFooter read_enhanced_footer(std::ifstream& in) {
     in.seekg(0, std::ios::end);
     std::streampos file_size = in.tellg();
 
@@ -88,66 +46,26 @@ static EnhancedSSTableFooter read_enhanced_footer(std::ifstream& in) {
         std::getline(in, line);
         lines.insert(lines.begin(), line);
         
-        pos -= line.length() + 1;
+        pos -= 1;  // 上一行末尾的换行
     }
     
-    EnhancedSSTableFooter footer = {0, 0, 0};
-    if (lines.size() >= 2) {
+    SSTableFooter footer = {0, 0, 0, 0, 0};
+    if (lines.empty()) {
+        return footer;
+    }
+    if (lines.size() >= 2 && (lines[0] == "ENHANCED_SSTABLE_V1" || lines[0] == "ENHANCED_SSTABLE_V2")) {
+        footer.block_format = lines[0] == "ENHANCED_SSTABLE_V2" ? 2 : 1;
         std::istringstream iss(lines[1]);
-        iss >> footer.data_start_offset >> footer.block_index_offset >> footer.bloom_offset;
+        iss >> footer.data_start_offset >> footer.index_offset >> footer.bloom_offset >> footer.range_del_offset >>
+            footer.properties_offset >> footer.prefix_bloom_offset;
+    } else {
+        std::istringstream iss(lines.back());
+        iss >> footer.index_offset >> footer.bloom_offset >> footer.range_del_offset >> footer.properties_offset >>
+            footer.prefix_bloom_offset;
     }
-    
     return footer;
 }
 
-bool SSTableReader::is_enhanced_format(const std::string& filename) {
-    std::ifstream in(filename);
-    if (!in.is_open()) {
-        return false;
-    }
-    
-    // Check for enhanced format marker in footer
-    in.seekg(0, std::ios::end);
-    std::streampos file_size = in.tellg();
-    
-    // Read last few lines
-    std::vector<std::string> lines;
-    long pos = (long)file_size - 1;
-    
-    for (int line_count = 0; line_count < 2 && pos > 0; ++line_count) {
-        // Skip trailing newlines
-        in.seekg(pos);
-        char c;
-        while (pos > 0 && in.get(c) && c == '\n') {
-            pos--;
-            in.seekg(pos);
-        }
-        
-        // Find start of line
-        while (pos > 0) {
-            in.seekg(pos);
-            in.get(c);
-            if (c == '\n') {
-                pos++;
-                break;
-            }
-            pos--;
-        }
-        
-        // Read the line
-        in.clear();
-        in.seekg(pos);
-        std::string line;
-        std::getline(in, line);
-        lines.insert(lines.begin(), line);
-        
-        pos -= line.length() + 1;
-    }
-    
-    // Check if second-to-last line is the enhanced marker
-    return lines.size() >= 2 && lines[1] == "ENHANCED_SSTABLE_V1";
-}
-
 std::optional<std::string>
 SSTableReader::get(const std::string& filename, const std::string& key, BlockCache& cache) {
     // 使用最大 uint64_t 作为 snapshot_seq（读取最新版本）
@@ -155,13 +73,18 @@ SSTableReader::get(const std::string& filename, const std::string& key, BlockCac
 }
 
 std::optional<std::string>
-SSTableReader::get(const std::string& filename, const std::string& key, uint64_t snapshot_seq, BlockCache& cache) {
-    // Check if this is an enhanced format file
-    if (is_enhanced_format(filename)) {
-        return get_with_block_index(filename, key, snapshot_seq, cache);
+SSTableReader::get(const std::string& filename, const std::string& key, uint64_t snapshot_seq, BlockCache& cache,
+                   BlockCache::Priority priority) {
+    auto stored = get_including_tombstone(filename, key, snapshot_seq, cache, priority);
+    if (!stored.has_value() || stored.value() == "__TOMBSTONE__") {
+        return std::nullopt; // 不存在或被删除
     }
-    
-    // Fall back to original implementation
+    return stored;
+}
+
+std::optional<std::string>
+SSTableReader::get_including_tombstone(const std::string& filename, const std::string& key, uint64_t snapshot_seq,
+                                       BlockCache& cache, BlockCache::Priority priority) {
     std::string cache_key = filename + ":" + key + ":" + std::to_string(snapshot_seq);
 
     // 1. 查 Block Cache
@@ -170,14 +93,31 @@ SSTableReader::get(const std::string& filename, const std::string& key, uint64_t
         return cached;
     }
 
-    std::ifstream in(filename);
-    if (!in.is_open()) {
+    auto version = get_version(filename, key, snapshot_seq);
+    if (!version.has_value()) {
         return std::nullopt;
     }
+    
+    // 2. 写入 Cache（墓碑也缓存，重复查找被删除的 key 不必再读文件）
+    cache.put(cache_key, version->value, priority);
+    return version->value;
+}
 
-    // 2. 读取 footer
+std::optional<VersionedValue>
+SSTableReader::get_version(const std::string& filename, const std::string& key, uint64_t snapshot_seq) {
+    std::ifstream in(filename, std::ios::binary);
+    if (!in.is_open()) {
+        return std::nullopt;
+    }
+    // footer 标记决定走块索引还是文本索引
     SSTableFooter footer = read_footer(in);
+    return footer.block_format != 0 ? find_version_with_block_index(in, footer, key, snapshot_seq)
+                                    : find_version(in, footer, key, snapshot_seq);
+}
 
+std::optional<VersionedValue>
+SSTableReader::find_version(std::ifstream& in, const SSTableFooter& footer, const std::string& key,
+                            uint64_t snapshot_seq) {
     // 3. 读取 Bloom Filter
     in.clear();
     in.seekg(footer.bloom_offset);
@@ -234,14 +174,10 @@ SSTableReader::get(const std::string& filename, const std::string& key, uint64_t
         return std::nullopt;
     }
 
-    // 6. 读取该 key 的所有版本，找到 <= snapshot_seq 的最新版本
+    // 6. 读取该 key 的所有版本（按 seq DESC 排序），第一个 <= snapshot_seq 的即为可见版本
     in.clear();
     in.seekg(index[key_pos].second);
     
-    std::string result_value;
-    bool found = false;
-    
-    // 读取该 key 的所有版本（按 seq DESC 排序）
     while (std::getline(in, line)) {
         std::istringstream data(line);
         std::string k;
@@ -256,45 +192,17 @@ SSTableReader::get(const std::string& filename, const std::string& key, uint64_t
             break; // 读到下一个 key
         }
         
-        // 找到 <= snapshot_seq 的第一个版本（因为按 DESC 排序）
         if (seq <= snapshot_seq) {
-            if (v == "__TOMBSTONE__") {
-                return std::nullopt; // 被删除
-            }
-            result_value = v;
-            found = true;
-            break;
+            return VersionedValue(seq, v);
         }
     }
 
-    if (!found) {
-        return std::nullopt;
-    }
-    
-    // 7. 写入 Cache
-    cache.put(cache_key, result_value);
-    return result_value;
+    return std::nullopt;
 }
 
-std::optional<std::string>
-SSTableReader::get_with_block_index(const std::string& filename, const std::string& key, 
-                                   uint64_t snapshot_seq, BlockCache& cache) {
-    std::string cache_key = filename + ":" + key + ":" + std::to_string(snapshot_seq);
-
-    // 1. 查 Block Cache
-    auto cached = cache.get(cache_key);
-    if (cached.has_value()) {
-        return cached;
-    }
-
-    std::ifstream in(filename);
-    if (!in.is_open()) {
-        return std::nullopt;
-    }
-
-    // 2. 读取 enhanced footer
-    EnhancedSSTableFooter footer = read_enhanced_footer(in);
-
+std::optional<VersionedValue>
+SSTableReader::find_version_with_block_index(std::ifstream& in, const SSTableFooter& footer, const std::string& key,
+                                             uint64_t snapshot_seq) {
     // 3. 读取 Bloom Filter
     in.clear();
     in.seekg(footer.bloom_offset);
@@ -307,9 +215,13 @@ SSTableReader::get_with_block_index(const std::string& filename, const std::stri
 
     // 4. 读取 block index
     in.clear();
-    in.seekg(footer.block_index_offset);
+    in.seekg(footer.index_offset);
     BlockIndex block_index;
-    block_index.deserialize(in);
+    try {
+        block_index.deserialize(in);
+    } catch (const std::exception&) {
+        return std::nullopt;  // 块索引损坏按不存在处理，与文本索引解析失败一致
+    }
 
     // 5. 找到包含 key 的 block
     int block_id = block_index.find_block(key);
@@ -323,17 +235,11 @@ SSTableReader::get_with_block_index(const std::string& filename, const std::stri
     }
 
     // 6. 从 block 中读取数据
-    auto result = read_from_block(in, *block_entry, key, snapshot_seq);
-    
-    if (result.has_value()) {
-        // 7. 写入 Cache
-        cache.put(cache_key, result.value());
-    }
-    
-    return result;
+    return footer.block_format == 2 ? read_from_prefix_block(in, *block_entry, key, snapshot_seq)
+                                    : read_from_block(in, *block_entry, key, snapshot_seq);
 }
 
-std::optional<std::string>
+std::optional<VersionedValue>
 SSTableReader::read_from_block(std::ifstream& in, const BlockIndexEntry& block_entry,
                               const std::string& key, uint64_t snapshot_seq) {
     // Seek to block start
@@ -360,10 +266,7 @@ SSTableReader::read_from_block(std::ifstream& in, const BlockIndexEntry& block_e
                 // Find the appropriate version for snapshot_seq
                 for (const auto& [seq, value] : versions) {
                     if (seq <= snapshot_seq) {
-                        if (value == "__TOMBSTONE__") {
-                            return std::nullopt;
-                        }
-                        return value;
+                        return VersionedValue(seq, value);
                     }
                 }
                 return std::nullopt; // No visible version found
@@ -374,6 +277,25 @@ SSTableReader::read_from_block(std::ifstream& in, const BlockIndexEntry& block_e
     return std::nullopt;
 }
 
+std::optional<VersionedValue>
+SSTableReader::read_from_prefix_block(std::ifstream& in, const BlockIndexEntry& block_entry,
+                                     const std::string& key, uint64_t snapshot_seq) {
+    std::string block(block_entry.size, '\0');
+    in.clear();
+    in.seekg(block_entry.offset);
+    if (!in.read(&block[0], static_cast<std::streamsize>(block.size()))) {
+        return std::nullopt;
+    }
+
+    DataBlockReader reader(block.data(), block.size());
+    uint64_t seq = 0;
+    Slice value;
+    if (!reader.find(Slice(key), snapshot_seq, seq, value)) {
+        return std::nullopt;
+    }
+    return VersionedValue(seq, value.to_string());
+}
+
 std::vector<std::pair<uint64_t, std::string>>
 SSTableReader::parse_delta_encoded_versions(const std::string& line) {
     std::vector<std::pair<uint64_t, std::string>> versions;
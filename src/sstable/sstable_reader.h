@@ -1,34 +1,70 @@
 #pragma once
 #include <optional>
 #include <string>
+#include <fstream>
 #include <cstdint>
 #include "cache/block_cache.h"
 #include "sstable/block_index.h"
+#include "storage/versioned_value.h"
+
+// 文本格式 footer：index_offset bloom_offset [range_del_offset [properties_offset [prefix_bloom_offset]]]；
+// 块格式 footer：ENHANCED_SSTABLE_V2 一行，随后 data_start_offset block_index_offset bloom_offset [...]，其余同文本格式。
+// 没有的块不写（后面还有别的块时其偏移记 0）
+struct SSTableFooter {
+    uint64_t index_offset;  // 文本格式为 key 索引，块格式为块索引；都是数据区的结束位置
+    uint64_t bloom_offset;
+    uint64_t range_del_offset;
+    uint64_t properties_offset;
+    uint64_t prefix_bloom_offset;
+    int block_format = 0;  // 0 = 文本格式，1 = ENHANCED_SSTABLE_V1 文本数据块，2 = ENHANCED_SSTABLE_V2 前缀压缩数据块
+    uint64_t data_start_offset = 0;
+};
 
 class SSTableReader {
 public:
-    // 带 snapshot_seq 的 get：查找 key 在 snapshot_seq 时刻的可见版本
+    // 带 snapshot_seq 的 get：查找 key 在 snapshot_seq 时刻的可见版本；
+    // 读到的结果按 priority 放入 Block Cache（由所属列族决定）
     static std::optional<std::string>
-    get(const std::string& filename, const std::string& key, uint64_t snapshot_seq, BlockCache& cache);
+    get(const std::string& filename, const std::string& key, uint64_t snapshot_seq, BlockCache& cache,
+        BlockCache::Priority priority = BlockCache::Priority::LOW);
     
     // 兼容旧接口（使用最大序列号）
     static std::optional<std::string>
     get(const std::string& filename, const std::string& key, BlockCache& cache);
     
-    // Enhanced get with block index optimization
+    // 与 get 相同，但可见版本是墓碑时也返回（值为 "__TOMBSTONE__"）并进入缓存；
+    // 一次查找即可区分“不在此文件”与“在此文件中被删除”
     static std::optional<std::string>
-    get_with_block_index(const std::string& filename, const std::string& key, 
-                        uint64_t snapshot_seq, BlockCache& cache);
+    get_including_tombstone(const std::string& filename, const std::string& key, uint64_t snapshot_seq,
+                            BlockCache& cache, BlockCache::Priority priority = BlockCache::Priority::LOW);
+    
+    // 查找 key 在 snapshot_seq 时刻的可见版本（包括墓碑）及其序列号，不经过缓存；
+    // 用于与同一文件中的范围删除比较先后
+    static std::optional<VersionedValue>
+    get_version(const std::string& filename, const std::string& key, uint64_t snapshot_seq);
+    
+    // 读取文件末尾的 footer，按是否带 ENHANCED_SSTABLE_V1/V2 标记区分两种格式
+    static SSTableFooter read_footer(std::ifstream& in);
     
 private:
-    // Check if file uses enhanced format
-    static bool is_enhanced_format(const std::string& filename);
+    static std::optional<VersionedValue>
+    find_version(std::ifstream& in, const SSTableFooter& footer, const std::string& key, uint64_t snapshot_seq);
     
-    // Read data from specific block
-    static std::optional<std::string>
+    // Enhanced format lookup: footer -> bloom -> block index -> single block
+    static std::optional<VersionedValue>
+    find_version_with_block_index(std::ifstream& in, const SSTableFooter& footer, const std::string& key,
+                                  uint64_t snapshot_seq);
+    
+    // Read data from specific V1 text block
+    static std::optional<VersionedValue>
     read_from_block(std::ifstream& in, const BlockIndexEntry& block_entry,
                    const std::string& key, uint64_t snapshot_seq);
     
+    // Read data from specific V2 block: 整块读入后在重启点上二分查找
+    static std::optional<VersionedValue>
+    read_from_prefix_block(std::ifstream& in, const BlockIndexEntry& block_entry,
+                          const std::string& key, uint64_t snapshot_seq);
+    
     // Parse delta-encoded sequence numbers
     static std::vector<std::pair<uint64_t, std::string>>
     parse_delta_encoded_versions(const std::string& line);
@@ -1,5 +1,6 @@
 #include "sstable/sstable_writer.h"
 #include "sstable/block_index.h"
+#include "sstable/data_block.h"
 #include "bloom/bloom_filter.h"
 #include <fstream>
 #include <vector>
@@ -8,87 +9,88 @@
 
 void SSTableWriter::write(
     const std::string& filename,
-    const std::map<std::string, std::vector<VersionedValue>>& data
+    const std::map<std::string, std::vector<VersionedValue>>& data,
+    size_t bloom_bits,
+    const std::vector<RangeTombstone>& range_tombstones,
+    const SSTableProperties& properties,
+    const PrefixExtractor* prefix_extractor
 ) {
-    std::ofstream out(filename, std::ios::binary);
-    std::vector<std::pair<std::string, uint64_t>> index;
-    BloomFilter bloom(8192, 3);
-
-    // 写入数据：key | seq | value
-    // 按 key 排序，key 相同按 seq DESC 排序
-    for (const auto& [key, versions] : data) {
-        uint64_t offset = out.tellp();
-        
-        // 对每个 key 的所有版本，按 seq DESC 排序
-        std::vector<VersionedValue> sorted_versions = versions;
-        std::sort(sorted_versions.begin(), sorted_versions.end(),
-                  [](const VersionedValue& a, const VersionedValue& b) {
-                      return a.seq > b.seq; // DESC
-                  });
-        
-        // 写入所有版本
-        for (const auto& v : sorted_versions) {
-            out << key << " " << v.seq << " " << v.value << '\n';
-        }
-        
-        index.push_back({key, offset});
-        bloom.add(key);
-    }
-
-    uint64_t index_offset = out.tellp();
-
-    for(const auto& [key, offset] : index) {
-        out<<key<<" "<<offset<<'\n';
-    }
-
-    uint64_t bloom_offset = out.tellp();
-    bloom.serialize(out);
-    out<<index_offset<<" "<<bloom_offset<<'\n';
-    out.flush();
+    write_blocks(filename, data, Config(), bloom_bits, range_tombstones, properties, prefix_extractor);
 }
 
 void SSTableWriter::write_with_block_index(
     const std::string& filename,
     const std::map<std::string, std::vector<VersionedValue>>& data,
     const Config& config
+) {
+    write_blocks(filename, data, config, DEFAULT_BLOOM_BITS, {}, SSTableProperties(), nullptr);
+}
+
+void SSTableWriter::write_blocks(
+    const std::string& filename,
+    const std::map<std::string, std::vector<VersionedValue>>& data,
+    const Config& config,
+    size_t bloom_bits,
+    const std::vector<RangeTombstone>& range_tombstones,
+    const SSTableProperties& properties,
+    const PrefixExtractor* prefix_extractor
 ) {
     std::ofstream out(filename, std::ios::binary);
     BlockIndex block_index;
-    BloomFilter bloom(8192, 3);
-    
-    // Partition data into blocks
-    auto blocks = partition_into_blocks(data, config);
+    bool bloom_enabled = bloom_bits > 0;
+    BloomFilter bloom(bloom_enabled ? bloom_bits : 1, bloom_enabled ? 3 : 1);
+    if (!bloom_enabled) {
+        bloom.add("");  // 唯一的一位置 1，任何 key 都判定为可能存在
+    }
+    DataBlockBuilder builder(config.enable_prefix_compression ? config.restart_interval : 1);
     
     uint64_t data_start_offset = out.tellp();
-    std::vector<std::string> all_keys;
+    std::string first_key;
+    std::string last_key;
+    std::vector<std::string> sparse_keys;
+    std::vector<VersionedValue> sorted_versions;
     
-    // Write data blocks
-    for (size_t block_id = 0; block_id < blocks.size(); ++block_id) {
-        const auto& block_data = blocks[block_id];
-        if (block_data.empty()) continue;
-        
+    auto flush_block = [&]() {
+        if (builder.empty()) return;
         uint64_t block_offset = out.tellp();
-        std::string first_key = block_data.front().first;
-        std::string last_key = block_data.back().first;
+        const std::string& block = builder.finish();
+        out.write(block.data(), static_cast<std::streamsize>(block.size()));
         
-        // Collect keys for prefix compression
-        for (const auto& [key, versions] : block_data) {
-            all_keys.push_back(key);
-            bloom.add(key);
+        uint32_t block_id = static_cast<uint32_t>(block_index.get_block_count());
+        block_index.add_block(first_key, last_key, block_offset,
+                             static_cast<uint32_t>(block.size()), builder.num_entries());
+        for (const auto& key : sparse_keys) {
+            block_index.add_sparse_entry(key, block_id);
+        }
+        sparse_keys.clear();
+        builder.reset();
+    };
+    
+    for (const auto& [key, versions] : data) {
+        if (builder.empty()) {
+            first_key = key;
+        }
+        if (builder.num_entries() % std::max<uint32_t>(config.sparse_index_interval, 1) == 0) {
+            sparse_keys.push_back(key);
         }
         
-        // Write block data with delta encoding
-        uint32_t block_size = write_data_block(out, block_data, config);
-        
-        // Add block to index
-        block_index.add_block(first_key, last_key, block_offset, 
-                             block_size, static_cast<uint32_t>(block_data.size()));
+        // Sort versions by sequence number DESC
+        sorted_versions = versions;
+        std::sort(sorted_versions.begin(), sorted_versions.end(),
+                  [](const VersionedValue& a, const VersionedValue& b) {
+                      return a.seq > b.seq; // DESC
+                  });
+        builder.add(key, sorted_versions);
+        if (bloom_enabled) {
+            bloom.add(key);
+        }
+        last_key = key;
         
-        // Add sparse index entries
-        for (size_t i = 0; i < block_data.size(); i += config.sparse_index_interval) {
-            block_index.add_sparse_entry(block_data[i].first, static_cast<uint32_t>(block_id));
+        if (builder.size_estimate() >= config.block_size) {
+            flush_block();
         }
     }
+    flush_block();
     
     // Write block index
     uint64_t block_index_offset = out.tellp();
@@ -97,88 +99,48 @@ void SSTableWriter::write_with_block_index(
     // Write bloom filter
     uint64_t bloom_offset = out.tellp();
     bloom.serialize(out);
-    
-    // Write footer with enhanced format
-    out << "ENHANCED_SSTABLE_V1\n";
-    out << data_start_offset << " " << block_index_offset << " " << bloom_offset << "\n";
-    out.flush();
-}
 
-uint32_t SSTableWriter::write_data_block(
-    std::ostream& out,
-    const std::vector<std::pair<std::string, std::vector<VersionedValue>>>& block_data,
-    const Config& config
-) {
-    uint64_t start_pos = out.tellp();
-    
-    for (const auto& [key, versions] : block_data) {
-        // Sort versions by sequence number DESC
-        std::vector<VersionedValue> sorted_versions = versions;
-        std::sort(sorted_versions.begin(), sorted_versions.end(),
-                  [](const VersionedValue& a, const VersionedValue& b) {
-                      return a.seq > b.seq; // DESC
-                  });
-        
-        if (config.enable_delta_encoding && sorted_versions.size() > 1) {
-            // Use delta encoding for sequence numbers
-            DeltaEncodedSeq delta_seq(sorted_versions[0].seq);
-            for (size_t i = 1; i < sorted_versions.size(); ++i) {
-                delta_seq.add_seq(sorted_versions[i].seq);
-            }
-            
-            // Write key and base sequence
-            out << key << " " << delta_seq.base_seq << " " << sorted_versions[0].value;
-            
-            // Write delta-encoded versions
-            for (size_t i = 1; i < sorted_versions.size(); ++i) {
-                out << " " << (sorted_versions[i].seq - delta_seq.base_seq) 
-                    << " " << sorted_versions[i].value;
-            }
-            out << '\n';
-        } else {
-            // Write all versions normally
-            for (const auto& v : sorted_versions) {
-                out << key << " " << v.seq << " " << v.value << '\n';
-            }
+    // 范围删除块：RANGE_DEL <n>，随后 n 行 start end seq
+    uint64_t range_del_offset = 0;
+    if (!range_tombstones.empty()) {
+        range_del_offset = out.tellp();
+        out << "RANGE_DEL " << range_tombstones.size() << '\n';
+        for (const auto& tombstone : range_tombstones) {
+            out << tombstone.start << " " << tombstone.end << " " << tombstone.seq << '\n';
         }
     }
-    
-    uint64_t end_pos = out.tellp();
-    return static_cast<uint32_t>(end_pos - start_pos);
-}
 
-std::vector<std::vector<std::pair<std::string, std::vector<VersionedValue>>>>
-SSTableWriter::partition_into_blocks(
-    const std::map<std::string, std::vector<VersionedValue>>& data,
-    const Config& config
-) {
-    std::vector<std::vector<std::pair<std::string, std::vector<VersionedValue>>>> blocks;
-    std::vector<std::pair<std::string, std::vector<VersionedValue>>> current_block;
-    uint32_t current_block_size = 0;
-    
-    for (const auto& [key, versions] : data) {
-        // Estimate size of this entry
-        uint32_t entry_size = key.length() + 20; // Approximate
-        for (const auto& v : versions) {
-            entry_size += v.value.length() + 12; // Approximate
-        }
-        
-        // Check if we need to start a new block
-        if (!current_block.empty() && 
-            current_block_size + entry_size > config.block_size) {
-            blocks.push_back(std::move(current_block));
-            current_block.clear();
-            current_block_size = 0;
+    // 属性块：PROPS <min_timestamp> <max_timestamp>
+    uint64_t properties_offset = 0;
+    if (properties.has_timestamps()) {
+        properties_offset = out.tellp();
+        out << "PROPS " << properties.min_timestamp << " " << properties.max_timestamp << '\n';
+    }
+
+    // 前缀 Bloom Filter 块：PREFIX_BLOOM <提取器名称>，随后一行过滤器；与 key 的过滤器同样大小
+    uint64_t prefix_bloom_offset = 0;
+    if (prefix_extractor && bloom_enabled) {
+        BloomFilter prefix_bloom(bloom_bits, 3);
+        for (const auto& [key, versions] : data) {
+            if (prefix_extractor->in_domain(key)) {
+                prefix_bloom.add(prefix_extractor->transform(key));
+            }
         }
-        
-        current_block.emplace_back(key, versions);
-        current_block_size += entry_size;
+        prefix_bloom_offset = out.tellp();
+        out << "PREFIX_BLOOM " << prefix_extractor->name() << '\n';
+        prefix_bloom.serialize(out);
     }
     
-    // Add the last block
-    if (!current_block.empty()) {
-        blocks.push_back(std::move(current_block));
+    // Write footer with enhanced format；末尾为 0 的偏移不写
+    std::vector<uint64_t> footer = {data_start_offset, block_index_offset, bloom_offset, range_del_offset,
+                                    properties_offset, prefix_bloom_offset};
+    while (footer.size() > 3 && footer.back() == 0) {
+        footer.pop_back();
     }
-    
-    return blocks;
-}
\ No newline at end of file
+    out << "ENHANCED_SSTABLE_V2\n";
+    for (size_t i = 0; i < footer.size(); i++) {
+        out << (i > 0 ? " " : "") << footer[i];
+    }
+    out << '\n';
+    out.flush();
+}
@@ -4,6 +4,8 @@
 #include <vector>
 #include <cstdint>
 #include "storage/versioned_value.h"
+#include "storage/range_tombstone.h"
+#include "sstable/sstable_meta.h"
 #include "sstable/block_index.h"
 
 class SSTableWriter {
@@ -12,39 +14,48 @@ public:
     struct Config {
         uint32_t block_size;        // Target block size in bytes
         uint32_t sparse_index_interval; // Sparse index every N keys
-        bool enable_prefix_compression;
-        bool enable_delta_encoding;
+        uint32_t restart_interval;  // 数据块内每 N 个 key 设一个重启点
+        bool enable_prefix_compression; // 关闭时每个 key 都是重启点，不共享前缀
         
-        Config() : block_size(4096), sparse_index_interval(16), 
-                  enable_prefix_compression(true), enable_delta_encoding(true) {}
+        Config() : block_size(4096), sparse_index_interval(16), restart_interval(16),
+                  enable_prefix_compression(true) {}
     };
     
     // 写入多版本数据：map<key, vector<VersionedValue>>
-    // 数据按 key 排序，key 相同按 seq DESC 排序
+    // 数据按 key 排序，key 相同按 seq DESC 排序；数据区为前缀压缩块（见 write_with_block_index）
+    // bloom_bits 为 Bloom Filter 位数，0 表示不过滤（写入一个恒为命中的 1 位过滤器）
+    // range_tombstones 写入 Bloom Filter 之后的范围删除块，footer 追加其偏移
+    // properties 带写入时间范围时写入属性块，footer 再追加其偏移（没有范围删除时该偏移记 0）
+    // prefix_extractor 非空且 bloom_bits > 0 时把所有 key 的前缀写入最后的前缀 Bloom Filter 块，footer 追加其偏移
     static void write(
         const std::string& filename,
-        const std::map<std::string, std::vector<VersionedValue>>& data
+        const std::map<std::string, std::vector<VersionedValue>>& data,
+        size_t bloom_bits = DEFAULT_BLOOM_BITS,
+        const std::vector<RangeTombstone>& range_tombstones = {},
+        const SSTableProperties& properties = SSTableProperties(),
+        const PrefixExtractor* prefix_extractor = nullptr
     );
+
+    static constexpr size_t DEFAULT_BLOOM_BITS = 8192;
     
     // Enhanced write with block index optimization
+    // 数据块为前缀压缩格式（见 data_block.h），块写满 block_size 后切换下一块；
+    // footer 为 ENHANCED_SSTABLE_V2 一行，随后一行
+    // data_start_offset block_index_offset bloom_offset [range_del_offset [properties_offset [prefix_bloom_offset]]]
     static void write_with_block_index(
         const std::string& filename,
         const std::map<std::string, std::vector<VersionedValue>>& data,
         const Config& config = Config()
     );
-    
+
 private:
-    // Write a single data block
-    static uint32_t write_data_block(
-        std::ostream& out,
-        const std::vector<std::pair<std::string, std::vector<VersionedValue>>>& block_data,
-        const Config& config
-    );
-    
-    // Calculate optimal block boundaries
-    static std::vector<std::vector<std::pair<std::string, std::vector<VersionedValue>>>>
-    partition_into_blocks(
+    static void write_blocks(
+        const std::string& filename,
         const std::map<std::string, std::vector<VersionedValue>>& data,
-        const Config& config
+        const Config& config,
+        size_t bloom_bits,
+        const std::vector<RangeTombstone>& range_tombstones,
+        const SSTableProperties& properties,
+        const PrefixExtractor* prefix_extractor
     );
-};
\ No newline at end of file
+};
@@ -26,6 +26,15 @@ void ConcurrentMemTable::put(const std::string& key, const std::string& value, u
 }
 
 bool ConcurrentMemTable::get(const std::string& key, uint64_t snapshot_seq, std::string& value) const {
+    VersionedValue version;
+    if (!get_version(key, snapshot_seq, version) || version.value == TOMBSTONE) {
+        return false;
+    }
+    value = std::move(version.value);
+    return true;
+}
+
+bool ConcurrentMemTable::get_version(const std::string& key, uint64_t snapshot_seq, VersionedValue& version) const {
     stats_.total_gets.fetch_add(1);
     
     ConcurrentMap::const_accessor accessor;
@@ -33,20 +42,18 @@ bool ConcurrentMemTable::get(const std::string& key, uint64_t snapshot_seq, std:
         return false;
     }
     
-    const auto& versions = accessor->second;
-    
-    // 从最新版本开始查找
-    for (auto it = versions.rbegin(); it != versions.rend(); ++it) {
-        if (it->seq <= snapshot_seq) {
-            if (it->value == TOMBSTONE) {
-                return false;
-            }
-            value = it->value;
-            return true;
+    // 版本按到达顺序追加，取快照可见的最大序列号
+    const VersionedValue* latest = nullptr;
+    for (const auto& candidate : accessor->second) {
+        if (candidate.seq <= snapshot_seq && (!latest || candidate.seq > latest->seq)) {
+            latest = &candidate;
         }
     }
-    
-    return false;
+    if (!latest) {
+        return false;
+    }
+    version = *latest;
+    return true;
 }
 
 void ConcurrentMemTable::del(const std::string& key, uint64_t seq) {
@@ -78,10 +85,9 @@ std::map<std::string, std::vector<VersionedValue>> ConcurrentMemTable::get_all_v
         const std::string& key = it->first;
         const auto& versions = it->second;
         
-        std::vector<VersionedValue> version_list;
-        for (const auto& version : versions) {
-            version_list.push_back(version);
-        }
+        std::vector<VersionedValue> version_list(versions.begin(), versions.end());
+        std::sort(version_list.begin(), version_list.end(),
+                  [](const VersionedValue& a, const VersionedValue& b) { return a.seq < b.seq; });
         
         result[key] = std::move(version_list);
     }
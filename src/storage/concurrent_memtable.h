@@ -3,16 +3,23 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include <map>
+#include <tuple>
 #include <mutex>
 #include <shared_mutex>
+#include <condition_variable>
 #include <thread>
 #include <tbb/concurrent_hash_map.h>
 #include <tbb/concurrent_vector.h>
 #include "storage/versioned_value.h"
 
 // 无锁MemTable实现
+// 不同 key 的写入互不阻塞，同一 key 的写入只锁住哈希表中的该项。
+// 并发写入者先拿序列号再插入，同一 key 的版本可能乱序到达，读取按序列号而不是插入顺序取版本
 class ConcurrentMemTable {
 public:
+    static const std::string TOMBSTONE;
+
     ConcurrentMemTable();
     ~ConcurrentMemTable();
     
@@ -20,6 +27,8 @@ public:
     void put(const std::string& key, const std::string& value, uint64_t seq);
     bool get(const std::string& key, uint64_t snapshot_seq, std::string& value) const;
     void del(const std::string& key, uint64_t seq);
+    // 快照可见的最新版本（墓碑也返回），调用方据此决定是否继续查更旧的数据
+    bool get_version(const std::string& key, uint64_t snapshot_seq, VersionedValue& version) const;
     
     // 批量操作
     void batch_put(const std::vector<std::tuple<std::string, std::string, uint64_t>>& operations);
@@ -27,7 +36,7 @@ public:
     size_t size() const;
     void clear();
     
-    // 获取所有数据用于flush
+    // 获取所有数据用于flush，每个 key 的版本按序列号升序
     std::map<std::string, std::vector<VersionedValue>> get_all_versions() const;
     
     // 并发统计
@@ -49,14 +58,13 @@ private:
     
     mutable std::atomic<size_t> size_bytes_{0};
     mutable ConcurrentStats stats_;
-    
-    static const std::string TOMBSTONE;
 };
 
 // 读写分离的MemTable包装器
 class ReadWriteSeparatedMemTable {
 public:
     ReadWriteSeparatedMemTable();
+    ~ReadWriteSeparatedMemTable();
     
     // 读操作 - 无锁或细粒度锁
     bool get(const std::string& key, uint64_t snapshot_seq, std::string& value) const;
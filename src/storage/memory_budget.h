@@ -0,0 +1,90 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+// 统一内存预算：MemTable、Block Cache、内存索引与 MVCC 版本链都向同一个预算记账。
+// 所有 MemTable 之和超过写缓冲上限时由 KVDB 触发刷盘；总用量超过预算时收缩 Block Cache。
+// 记账只做原子加减，热路径上不持锁；预算本身不拒绝分配，由各使用方根据用量做出反应
+class MemoryBudget {
+public:
+    enum class Component { MEMTABLE, BLOCK_CACHE, INDEX, MVCC };
+    static constexpr size_t COMPONENT_COUNT = 4;
+
+    static constexpr size_t DEFAULT_TOTAL_BUDGET = 256ULL * 1024 * 1024;  // 256MB
+    static constexpr size_t DEFAULT_WRITE_BUFFER_SIZE = 64ULL * 1024 * 1024;  // 64MB
+    static constexpr size_t MIN_CACHE_BYTES = 1024 * 1024;  // 压力再大也给 Block Cache 留 1MB
+
+    explicit MemoryBudget(size_t total_budget = DEFAULT_TOTAL_BUDGET,
+                          size_t write_buffer_size = DEFAULT_WRITE_BUFFER_SIZE)
+        : total_budget_(total_budget), write_buffer_size_(write_buffer_size) {
+        for (auto& usage : usage_) {
+            usage.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    MemoryBudget(const MemoryBudget&) = delete;
+    MemoryBudget& operator=(const MemoryBudget&) = delete;
+
+    void charge(Component component, size_t bytes) {
+        if (bytes > 0) {
+            usage_[index(component)].fetch_add(bytes, std::memory_order_relaxed);
+        }
+    }
+
+    void release(Component component, size_t bytes) {
+        if (bytes > 0) {
+            usage_[index(component)].fetch_sub(bytes, std::memory_order_relaxed);
+        }
+    }
+
+    size_t usage(Component component) const {
+        return usage_[index(component)].load(std::memory_order_relaxed);
+    }
+
+    size_t total_usage() const {
+        size_t total = 0;
+        for (const auto& usage : usage_) {
+            total += usage.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    size_t total_budget() const { return total_budget_.load(std::memory_order_relaxed); }
+    size_t write_buffer_size() const { return write_buffer_size_.load(std::memory_order_relaxed); }
+
+    void set_limits(size_t total_budget, size_t write_buffer_size) {
+        total_budget_.store(total_budget, std::memory_order_relaxed);
+        write_buffer_size_.store(write_buffer_size, std::memory_order_relaxed);
+    }
+
+    // 全部 MemTable 的用量达到写缓冲上限，需要挑一个 MemTable 刷盘
+    bool should_flush() const { return usage(Component::MEMTABLE) >= write_buffer_size(); }
+
+    bool over_budget() const { return total_usage() > total_budget(); }
+
+    // Block Cache 可用的字节数：总预算减去其他组件的用量，至少保留 MIN_CACHE_BYTES
+    size_t cache_budget() const {
+        size_t others = total_usage() - usage(Component::BLOCK_CACHE);
+        size_t budget = total_budget();
+        return budget > others + MIN_CACHE_BYTES ? budget - others : MIN_CACHE_BYTES;
+    }
+
+    static const char* component_name(Component component) {
+        switch (component) {
+            case Component::MEMTABLE: return "memtable";
+            case Component::BLOCK_CACHE: return "block_cache";
+            case Component::INDEX: return "index";
+            case Component::MVCC: return "mvcc";
+        }
+        return "unknown";
+    }
+
+private:
+    static size_t index(Component component) { return static_cast<size_t>(component); }
+
+    std::array<std::atomic<size_t>, COMPONENT_COUNT> usage_;
+    std::atomic<size_t> total_budget_;
+    std::atomic<size_t> write_buffer_size_;
+};
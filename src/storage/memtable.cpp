@@ -1,12 +1,35 @@
 #include "storage/memtable.h"
+#include <algorithm>
+#include <chrono>
 
 static const std::string TOMBSTONE = "__TOMBSTONE__";
 
+MemTable::~MemTable() {
+    if (budget_) {
+        budget_->release(MemoryBudget::Component::MEMTABLE, size_bytes_);
+    }
+}
+
+void MemTable::set_memory_budget(MemoryBudget* budget) {
+    if (budget_) {
+        budget_->release(MemoryBudget::Component::MEMTABLE, size_bytes_);
+    }
+    budget_ = budget;
+    if (budget_) {
+        budget_->charge(MemoryBudget::Component::MEMTABLE, size_bytes_);
+    }
+}
+
 void MemTable::put(const std::string& key, const std::string& value, uint64_t seq) {
     // 新版本永远插在最前（push_back，然后按 seq DESC 排序）
     // 为了简化，我们直接 push_back，读取时从后往前找
     table_[key].push_back({seq, value});
-    size_bytes_ += key.size() + value.size() + sizeof(uint64_t);
+    record_write_time();
+    size_t bytes = key.size() + value.size() + sizeof(uint64_t);
+    size_bytes_ += bytes;
+    if (budget_) {
+        budget_->charge(MemoryBudget::Component::MEMTABLE, bytes);
+    }
 }
 
 bool MemTable::get(const std::string& key, uint64_t snapshot_seq, std::string& value) const {
@@ -30,6 +53,79 @@ void MemTable::del(const std::string& key, uint64_t seq) {
     put(key, TOMBSTONE, seq);
 }
 
+void MemTable::delete_range(const std::string& begin, const std::string& end, uint64_t seq) {
+    range_tombstones_.emplace_back(begin, end, seq);
+    record_write_time();
+    std::atomic_store(&fragmented_,
+        std::shared_ptr<const FragmentedRangeTombstoneList>(
+            std::make_shared<FragmentedRangeTombstoneList>(range_tombstones_)));
+    size_t bytes = begin.size() + end.size() + sizeof(uint64_t);
+    size_bytes_ += bytes;
+    if (budget_) {
+        budget_->charge(MemoryBudget::Component::MEMTABLE, bytes);
+    }
+}
+
+bool MemTable::get_version(const std::string& key, uint64_t snapshot_seq, VersionedValue& version) const {
+    auto it = table_.find(key);
+    if (it == table_.end()) return false;
+
+    const auto& versions = it->second;
+    for (auto rit = versions.rbegin(); rit != versions.rend(); ++rit) {
+        if (rit->seq <= snapshot_seq) {
+            version = *rit;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool MemTable::get_merge_entry(const std::string& key, uint64_t snapshot_seq, MergeEntry& entry) const {
+    auto it = table_.find(key);
+    if (it == table_.end()) return false;
+
+    // 序列号不超过 tombstone_seq 的版本都被范围删除覆盖
+    uint64_t tombstone_seq = 0;
+    auto tombstones = fragmented_range_tombstones();
+    bool covered = tombstones && tombstones->max_covering_seq(key, snapshot_seq, tombstone_seq);
+
+    bool found = false;
+    const auto& versions = it->second;
+    for (auto rit = versions.rbegin(); rit != versions.rend(); ++rit) {
+        if (rit->seq > snapshot_seq) continue;
+        if (covered && rit->seq <= tombstone_seq) {
+            break;
+        }
+        if (!found) {
+            if (!MergeEntry::decode(rit->value, entry)) return false;
+            found = true;
+        } else if (rit->value == TOMBSTONE) {
+            entry.terminate_deleted();
+        } else {
+            MergeEntry older;
+            if (MergeEntry::decode(rit->value, older)) {
+                entry.absorb_older(std::move(older));
+            } else {
+                entry.terminate_with(rit->value);
+            }
+        }
+        if (entry.terminated()) return true;
+    }
+    if (found && covered) {
+        entry.terminate_deleted();  // 更旧的数据源整体被覆盖
+    }
+    return found;
+}
+
+void MemTable::record_write_time() {
+    uint64_t now = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    if (min_write_time_ == 0) {
+        min_write_time_ = now;
+    }
+    max_write_time_ = std::max(max_write_time_, now);
+}
+
 size_t MemTable::size() const {
     return size_bytes_;
 }
@@ -39,6 +135,13 @@ std::map<std::string, std::vector<VersionedValue>> MemTable::get_all_versions()
 }
 
 void MemTable::clear() {
+    if (budget_) {
+        budget_->release(MemoryBudget::Component::MEMTABLE, size_bytes_);
+    }
     table_.clear();
+    range_tombstones_.clear();
+    std::atomic_store(&fragmented_, std::shared_ptr<const FragmentedRangeTombstoneList>());
     size_bytes_ = 0;
+    min_write_time_ = 0;
+    max_write_time_ = 0;
 }
@@ -2,21 +2,50 @@
 #include <map>
 #include <string>
 #include <vector>
+#include <memory>
 #include <cstdint>
 #include "storage/versioned_value.h"
+#include "storage/range_tombstone.h"
+#include "storage/memory_budget.h"
+#include "storage/merge_operator.h"
 
 class MemTableIterator; // 前向声明
 
 class MemTable {
 public:
+    MemTable() = default;
+    ~MemTable();
+    MemTable(const MemTable&) = delete;
+    MemTable& operator=(const MemTable&) = delete;
+
+    // 挂到统一内存预算上：已有数据立即记账，之后的写入与清空同步增减
+    void set_memory_budget(MemoryBudget* budget);
+
     void put(const std::string& key, const std::string& value, uint64_t seq);
     bool get(const std::string& key, uint64_t snapshot_seq, std::string& value) const;
     void del(const std::string& key, uint64_t seq);
+    // 范围删除 [begin, end)：只记一条范围墓碑，不展开成逐 key 的墓碑
+    void delete_range(const std::string& begin, const std::string& end, uint64_t seq);
+    // snapshot 下可见的版本（包括墓碑）及其序列号
+    bool get_version(const std::string& key, uint64_t snapshot_seq, VersionedValue& version) const;
+    // snapshot 下可见的最新版本为合并条目时，把 MemTable 中更旧的版本折叠进去：遇到完整值、墓碑或覆盖它的
+    // 范围删除时链终止，否则链留给更旧的数据源。最新版本不是合并条目时返回 false
+    bool get_merge_entry(const std::string& key, uint64_t snapshot_seq, MergeEntry& entry) const;
 
     size_t size() const; // Returns size in bytes
     // 返回所有版本的数据，用于 flush 到 SSTable
     std::map<std::string, std::vector<VersionedValue>> get_all_versions() const;
     void clear();
+    bool empty() const { return table_.empty() && range_tombstones_.empty(); }
+    // 写入时间范围（Unix 秒，WAL 重放的记录按重放时间计），刷盘时写入 SSTable 属性；为空时均为 0
+    uint64_t min_write_time() const { return min_write_time_; }
+    uint64_t max_write_time() const { return max_write_time_; }
+    
+    // 范围删除：原始列表用于刷盘，碎片化索引供读路径与迭代器使用（每次写入后重建，旧索引由持有者继续使用）
+    const std::vector<RangeTombstone>& get_range_tombstones() const { return range_tombstones_; }
+    std::shared_ptr<const FragmentedRangeTombstoneList> fragmented_range_tombstones() const {
+        return std::atomic_load(&fragmented_);
+    }
     
     // 用于 Iterator 访问
     const std::map<std::string, std::vector<VersionedValue>>& get_table() const {
@@ -24,6 +53,13 @@ public:
     }
     
 private:
+    void record_write_time();
+
     size_t size_bytes_ = 0; // Tracks memory usage
+    uint64_t min_write_time_ = 0;
+    uint64_t max_write_time_ = 0;
+    MemoryBudget* budget_ = nullptr;
     std::map<std::string, std::vector<VersionedValue>> table_;
+    std::vector<RangeTombstone> range_tombstones_;
+    std::shared_ptr<const FragmentedRangeTombstoneList> fragmented_;
 };
@@ -0,0 +1,342 @@
+#include "storage/merge_operator.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <utility>
+
+bool MergeOperator::partial_merge(const std::string& /*key*/, const std::string& /*left*/,
+                                  const std::string& /*right*/, std::string* /*result*/) const {
+    return false;
+}
+
+void MergeOperator::compress(const std::string& key, std::vector<std::string>& operands) const {
+    if (operands.size() < 2) {
+        return;
+    }
+    std::vector<std::string> compressed;
+    compressed.push_back(std::move(operands.front()));
+    for (size_t i = 1; i < operands.size(); i++) {
+        std::string merged;
+        if (partial_merge(key, compressed.back(), operands[i], &merged)) {
+            compressed.back() = std::move(merged);
+        } else {
+            compressed.push_back(std::move(operands[i]));
+        }
+    }
+    operands = std::move(compressed);
+}
+
+bool MergeOperator::merge_entry(const std::string& key, const MergeEntry& entry, std::string* result) const {
+    return full_merge(key, entry.base == MergeEntry::Base::VALUE ? &entry.base_value : nullptr,
+                      entry.operands, result);
+}
+
+// ==================== Int64AddMergeOperator ====================
+
+bool Int64AddMergeOperator::parse(const std::string& text, int64_t& number) {
+    const char* begin = text.data();
+    const char* end = begin + text.size();
+    if (begin != end && *begin == '+') {
+        begin++;
+    }
+    auto [ptr, ec] = std::from_chars(begin, end, number);
+    return ec == std::errc() && ptr == end && begin != end;
+}
+
+bool Int64AddMergeOperator::full_merge(const std::string& /*key*/, const std::string* existing,
+                                       const std::vector<std::string>& operands, std::string* result) const {
+    int64_t sum = 0;
+    if (existing && !parse(*existing, sum)) {
+        return false;
+    }
+    for (const auto& operand : operands) {
+        int64_t delta;
+        if (!parse(operand, delta)) {
+            return false;
+        }
+        // 溢出时按补码回绕，避免有符号溢出的未定义行为
+        sum = static_cast<int64_t>(static_cast<uint64_t>(sum) + static_cast<uint64_t>(delta));
+    }
+    *result = std::to_string(sum);
+    return true;
+}
+
+bool Int64AddMergeOperator::partial_merge(const std::string& key, const std::string& left,
+                                          const std::string& right, std::string* result) const {
+    return full_merge(key, nullptr, {left, right}, result);
+}
+
+// ==================== ListAppendMergeOperator ====================
+
+bool ListAppendMergeOperator::full_merge(const std::string& /*key*/, const std::string* existing,
+                                         const std::vector<std::string>& operands, std::string* result) const {
+    std::string merged = existing ? *existing : std::string();
+    bool first = !existing;
+    for (const auto& operand : operands) {
+        if (!first) {
+            merged += delimiter_;
+        }
+        merged += operand;
+        first = false;
+    }
+    *result = std::move(merged);
+    return true;
+}
+
+bool ListAppendMergeOperator::partial_merge(const std::string& /*key*/, const std::string& left,
+                                            const std::string& right, std::string* result) const {
+    *result = left + delimiter_ + right;
+    return true;
+}
+
+// ==================== JsonMergePatchOperator ====================
+
+namespace {
+
+// 只做合并补丁需要的最小 JSON 处理：对象拆成 (原始 key 文本, 原始 value 文本) 的列表，其余值按原文保留
+using JsonMembers = std::vector<std::pair<std::string, std::string>>;
+
+void skip_whitespace(const std::string& text, size_t& pos) {
+    while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) {
+        pos++;
+    }
+}
+
+bool scan_string(const std::string& text, size_t& pos) {
+    if (pos >= text.size() || text[pos] != '"') {
+        return false;
+    }
+    for (pos++; pos < text.size(); pos++) {
+        if (text[pos] == '\\') {
+            pos++;
+        } else if (text[pos] == '"') {
+            pos++;
+            return true;
+        }
+    }
+    return false;
+}
+
+// 越过一个 JSON 值（不检查数字与字面量的具体语法）
+bool scan_value(const std::string& text, size_t& pos) {
+    skip_whitespace(text, pos);
+    if (pos >= text.size()) {
+        return false;
+    }
+    if (text[pos] == '"') {
+        return scan_string(text, pos);
+    }
+    if (text[pos] == '{' || text[pos] == '[') {
+        std::vector<char> closers;
+        do {
+            char c = text[pos];
+            if (c == '"') {
+                if (!scan_string(text, pos)) {
+                    return false;
+                }
+                continue;
+            }
+            if (c == '{' || c == '[') {
+                closers.push_back(c == '{' ? '}' : ']');
+            } else if (c == '}' || c == ']') {
+                if (closers.empty() || closers.back() != c) {
+                    return false;
+                }
+                closers.pop_back();
+            }
+            pos++;
+        } while (!closers.empty() && pos < text.size());
+        return closers.empty();
+    }
+    size_t start = pos;
+    while (pos < text.size() && text[pos] != ',' && text[pos] != '}' && text[pos] != ']' &&
+           !std::isspace(static_cast<unsigned char>(text[pos]))) {
+        pos++;
+    }
+    return pos > start;
+}
+
+std::string trim(const std::string& text) {
+    size_t begin = 0;
+    skip_whitespace(text, begin);
+    size_t end = text.size();
+    while (end > begin && std::isspace(static_cast<unsigned char>(text[end - 1]))) {
+        end--;
+    }
+    return text.substr(begin, end - begin);
+}
+
+bool is_object(const std::string& text) {
+    return !text.empty() && text.front() == '{';
+}
+
+bool parse_object(const std::string& text, JsonMembers& members) {
+    size_t pos = 0;
+    skip_whitespace(text, pos);
+    if (pos >= text.size() || text[pos] != '{') {
+        return false;
+    }
+    pos++;
+    skip_whitespace(text, pos);
+    if (pos < text.size() && text[pos] == '}') {
+        pos++;
+        skip_whitespace(text, pos);
+        return pos == text.size();
+    }
+    while (pos < text.size()) {
+        skip_whitespace(text, pos);
+        size_t key_start = pos;
+        if (!scan_string(text, pos)) {
+            return false;
+        }
+        std::string key = text.substr(key_start, pos - key_start);
+        skip_whitespace(text, pos);
+        if (pos >= text.size() || text[pos] != ':') {
+            return false;
+        }
+        pos++;
+        skip_whitespace(text, pos);
+        size_t value_start = pos;
+        if (!scan_value(text, pos)) {
+            return false;
+        }
+        std::string value = text.substr(value_start, pos - value_start);
+        // 重复的 key 以最后一个为准
+        auto it = std::find_if(members.begin(), members.end(),
+                               [&key](const auto& member) { return member.first == key; });
+        if (it != members.end()) {
+            it->second = std::move(value);
+        } else {
+            members.emplace_back(std::move(key), std::move(value));
+        }
+        skip_whitespace(text, pos);
+        if (pos < text.size() && text[pos] == ',') {
+            pos++;
+            continue;
+        }
+        if (pos < text.size() && text[pos] == '}') {
+            pos++;
+            skip_whitespace(text, pos);
+            return pos == text.size();
+        }
+        return false;
+    }
+    return false;
+}
+
+std::string serialize_object(const JsonMembers& members) {
+    std::string out = "{";
+    for (size_t i = 0; i < members.size(); i++) {
+        if (i > 0) {
+            out.push_back(',');
+        }
+        out += members[i].first;
+        out.push_back(':');
+        out += members[i].second;
+    }
+    out.push_back('}');
+    return out;
+}
+
+JsonMembers::iterator find_member(JsonMembers& members, const std::string& key) {
+    return std::find_if(members.begin(), members.end(),
+                        [&key](const auto& member) { return member.first == key; });
+}
+
+// 合成两个补丁：compose(p1, p2) 应用到任意目标上都等价于先应用 p1 再应用 p2
+bool compose_patches(const std::string& left, const std::string& right, std::string& result) {
+    std::string newer = trim(right);
+    if (!is_object(newer)) {
+        size_t pos = 0;
+        if (!scan_value(newer, pos) || pos != newer.size()) {
+            return false;
+        }
+        result = newer;  // 非对象补丁整体替换，之前的补丁不再起作用
+        return true;
+    }
+    std::string older = trim(left);
+    if (!is_object(older)) {
+        return false;  // 先替换成非对象再打对象补丁，无法用一个补丁表达
+    }
+    JsonMembers composed, patch;
+    if (!parse_object(older, composed) || !parse_object(newer, patch)) {
+        return false;
+    }
+    for (auto& [key, value] : patch) {
+        auto it = find_member(composed, key);
+        if (it == composed.end()) {
+            composed.emplace_back(key, value);
+        } else if (is_object(value)) {
+            if (!is_object(it->second) || !compose_patches(it->second, value, it->second)) {
+                return false;
+            }
+        } else {
+            it->second = value;
+        }
+    }
+    result = serialize_object(composed);
+    return true;
+}
+
+}  // namespace
+
+bool JsonMergePatchOperator::apply_patch(const std::string& target, const std::string& patch,
+                                         std::string& result) {
+    std::string trimmed_patch = trim(patch);
+    if (!is_object(trimmed_patch)) {
+        size_t pos = 0;
+        if (!scan_value(trimmed_patch, pos) || pos != trimmed_patch.size()) {
+            return false;
+        }
+        result = trimmed_patch;
+        return true;
+    }
+
+    JsonMembers members, patch_members;
+    std::string trimmed_target = trim(target);
+    if (is_object(trimmed_target) && !parse_object(trimmed_target, members)) {
+        return false;
+    }
+    if (!parse_object(trimmed_patch, patch_members)) {
+        return false;
+    }
+    for (const auto& [key, value] : patch_members) {
+        auto it = find_member(members, key);
+        if (value == "null") {
+            if (it != members.end()) {
+                members.erase(it);
+            }
+            continue;
+        }
+        std::string patched;
+        if (!apply_patch(it != members.end() ? it->second : std::string(), value, patched)) {
+            return false;
+        }
+        if (it != members.end()) {
+            it->second = std::move(patched);
+        } else {
+            members.emplace_back(key, std::move(patched));
+        }
+    }
+    result = serialize_object(members);
+    return true;
+}
+
+bool JsonMergePatchOperator::full_merge(const std::string& /*key*/, const std::string* existing,
+                                        const std::vector<std::string>& operands, std::string* result) const {
+    std::string merged = existing ? *existing : std::string();
+    for (const auto& operand : operands) {
+        std::string patched;
+        if (!apply_patch(merged, operand, patched)) {
+            return false;
+        }
+        merged = std::move(patched);
+    }
+    *result = std::move(merged);
+    return true;
+}
+
+bool JsonMergePatchOperator::partial_merge(const std::string& /*key*/, const std::string& left,
+                                           const std::string& right, std::string* result) const {
+    return compose_patches(left, right, *result);
+}
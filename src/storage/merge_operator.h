@@ -0,0 +1,181 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+// 合并条目：存储中的合并操作数，与完整值、墓碑区分开的第三种条目。
+// 格式 "__MERGE__<状态><长度>:<内容>..."，状态为
+//   '0' 链未终止：更旧的数据源中可能还有该 key 的基础值
+//   '1' 链终止于删除：更旧的版本都不可见
+//   '2' 链终止于基础值：第一个字段为基础值（可能是 blob 引用，合并前读出）
+// 之后是从旧到新的操作数。MergeIterator 与点查只看每个数据源的最新版本，因此刷盘与压缩写出的
+// 合并条目总是包含该数据源中所有更旧的操作数
+struct MergeEntry {
+    static constexpr const char* PREFIX = "__MERGE__";
+    static constexpr size_t PREFIX_SIZE = 9;
+
+    enum class Base : char { OPEN = '0', DELETED = '1', VALUE = '2' };
+
+    Base base = Base::OPEN;
+    std::string base_value;
+    std::vector<std::string> operands;  // 从旧到新
+
+    bool terminated() const { return base != Base::OPEN; }
+
+    static bool matches(const char* data, size_t size) {
+        return size > PREFIX_SIZE && std::char_traits<char>::compare(data, PREFIX, PREFIX_SIZE) == 0;
+    }
+    static bool matches(const std::string& stored) { return matches(stored.data(), stored.size()); }
+
+    // 单个操作数（KVDB::merge 写入 MemTable 的形式）
+    static std::string encode_operand(const std::string& operand) {
+        MergeEntry entry;
+        entry.operands.push_back(operand);
+        return entry.encode();
+    }
+
+    std::string encode() const {
+        std::string out(PREFIX);
+        out.push_back(static_cast<char>(base));
+        if (base == Base::VALUE) {
+            append_field(out, base_value);
+        }
+        for (const auto& operand : operands) {
+            append_field(out, operand);
+        }
+        return out;
+    }
+
+    static bool decode(const std::string& stored, MergeEntry& entry) {
+        if (!matches(stored)) {
+            return false;
+        }
+        char state = stored[PREFIX_SIZE];
+        if (state != '0' && state != '1' && state != '2') {
+            return false;
+        }
+        entry.base = static_cast<Base>(state);
+        entry.base_value.clear();
+        entry.operands.clear();
+        size_t pos = PREFIX_SIZE + 1;
+        if (entry.base == Base::VALUE && !read_field(stored, pos, entry.base_value)) {
+            return false;
+        }
+        std::string operand;
+        while (pos < stored.size()) {
+            if (!read_field(stored, pos, operand)) {
+                return false;
+            }
+            entry.operands.push_back(std::move(operand));
+        }
+        return true;
+    }
+
+    // 把同一 key 更旧的条目接到本条目之前（本条目更新）
+    void absorb_older(MergeEntry&& older) {
+        older.operands.insert(older.operands.end(), std::make_move_iterator(operands.begin()),
+                              std::make_move_iterator(operands.end()));
+        operands = std::move(older.operands);
+        base = older.base;
+        base_value = std::move(older.base_value);
+    }
+    // 链终止于更旧的完整值 / 删除
+    void terminate_with(const std::string& value) {
+        base = Base::VALUE;
+        base_value = value;
+    }
+    void terminate_deleted() {
+        base = Base::DELETED;
+        base_value.clear();
+    }
+
+private:
+    static void append_field(std::string& out, const std::string& field) {
+        out += std::to_string(field.size());
+        out.push_back(':');
+        out += field;
+    }
+    static bool read_field(const std::string& stored, size_t& pos, std::string& field) {
+        size_t colon = stored.find(':', pos);
+        if (colon == std::string::npos || colon == pos || colon - pos > 19) {
+            return false;
+        }
+        uint64_t length = 0;
+        for (size_t i = pos; i < colon; i++) {
+            if (stored[i] < '0' || stored[i] > '9') {
+                return false;
+            }
+            length = length * 10 + static_cast<uint64_t>(stored[i] - '0');
+        }
+        if (length > stored.size() - colon - 1) {
+            return false;
+        }
+        field.assign(stored, colon + 1, length);
+        pos = colon + 1 + length;
+        return true;
+    }
+};
+
+// 合并操作符：把 KVDB::merge 写入的操作数折叠到基础值上，实现无需先读再写的读改写。
+// 操作数按结合律合并；可能被读线程与后台压缩线程并发调用，实现需线程安全
+class MergeOperator {
+public:
+    virtual ~MergeOperator() = default;
+
+    // existing 为空指针表示 key 不存在（或已删除）；operands 从旧到新。返回 false 表示无法合并
+    virtual bool full_merge(const std::string& key, const std::string* existing,
+                            const std::vector<std::string>& operands, std::string* result) const = 0;
+    // 把相邻的两个操作数合成一个（left 更旧），刷盘与压缩时用来缩短操作数链；
+    // 不支持时返回 false，两个操作数都保留
+    virtual bool partial_merge(const std::string& key, const std::string& left, const std::string& right,
+                               std::string* result) const;
+    virtual const char* name() const = 0;
+
+    // 尽量用 partial_merge 合并相邻的操作数
+    void compress(const std::string& key, std::vector<std::string>& operands) const;
+    // 按条目的终止状态完整合并
+    bool merge_entry(const std::string& key, const MergeEntry& entry, std::string* result) const;
+};
+
+// 计数器：值与操作数都是十进制 int64，合并结果为和，不存在的 key 视为 0
+class Int64AddMergeOperator : public MergeOperator {
+public:
+    bool full_merge(const std::string& key, const std::string* existing,
+                    const std::vector<std::string>& operands, std::string* result) const override;
+    bool partial_merge(const std::string& key, const std::string& left, const std::string& right,
+                       std::string* result) const override;
+    const char* name() const override { return "Int64AddMergeOperator"; }
+
+    static bool parse(const std::string& text, int64_t& number);
+};
+
+// 列表追加：操作数以 delimiter 连接追加到已有值之后；delimiter 为空时即字符串追加
+class ListAppendMergeOperator : public MergeOperator {
+public:
+    explicit ListAppendMergeOperator(std::string delimiter = ",") : delimiter_(std::move(delimiter)) {}
+
+    bool full_merge(const std::string& key, const std::string* existing,
+                    const std::vector<std::string>& operands, std::string* result) const override;
+    bool partial_merge(const std::string& key, const std::string& left, const std::string& right,
+                       std::string* result) const override;
+    const char* name() const override { return "ListAppendMergeOperator"; }
+
+private:
+    std::string delimiter_;
+};
+
+// JSON Merge Patch（RFC 7386）：操作数为补丁，对象逐字段递归合并，null 删除字段，其余值整体替换。
+// 两个补丁只有在先后应用与合成后应用结果一致时才部分合并
+class JsonMergePatchOperator : public MergeOperator {
+public:
+    bool full_merge(const std::string& key, const std::string* existing,
+                    const std::vector<std::string>& operands, std::string* result) const override;
+    bool partial_merge(const std::string& key, const std::string& left, const std::string& right,
+                       std::string* result) const override;
+    const char* name() const override { return "JsonMergePatchOperator"; }
+
+    // 把 patch 应用到 target 上（target 为空串表示不存在）；JSON 无法解析时返回 false
+    static bool apply_patch(const std::string& target, const std::string& patch, std::string& result);
+};
@@ -0,0 +1,45 @@
+#pragma once
+#include <string>
+#include <cstddef>
+
+// 前缀提取器：刷盘与压缩时把每个 key 的前缀写入 SSTable 的前缀 Bloom Filter，
+// 前缀扫描据此跳过不可能包含该前缀的文件。
+// 实现需满足：in_domain(p) 时，任何以 p 开头的 key k 都有 in_domain(k) 且 transform(k) == transform(p)
+class PrefixExtractor {
+public:
+    virtual ~PrefixExtractor() = default;
+
+    // key 是否有前缀；不在定义域内的 key 不写入前缀 Bloom Filter
+    virtual bool in_domain(const std::string& key) const = 0;
+    virtual std::string transform(const std::string& key) const = 0;
+    // 写入 SSTable：名称不同的文件不使用其前缀 Bloom Filter，名称需包含影响结果的参数
+    virtual std::string name() const = 0;
+};
+
+// 定长前缀：取前 length 个字节，更短的 key 不在定义域内
+class FixedPrefixExtractor : public PrefixExtractor {
+public:
+    explicit FixedPrefixExtractor(size_t length) : length_(length) {}
+
+    bool in_domain(const std::string& key) const override { return key.size() >= length_; }
+    std::string transform(const std::string& key) const override { return key.substr(0, length_); }
+    std::string name() const override { return "fixed:" + std::to_string(length_); }
+
+private:
+    size_t length_;
+};
+
+// 分隔符前缀：取到第一个 delimiter 为止（包含），如 "user:42:name" 取 "user:"；没有分隔符的 key 不在定义域内
+class DelimiterPrefixExtractor : public PrefixExtractor {
+public:
+    explicit DelimiterPrefixExtractor(char delimiter = ':') : delimiter_(delimiter) {}
+
+    bool in_domain(const std::string& key) const override { return key.find(delimiter_) != std::string::npos; }
+    std::string transform(const std::string& key) const override {
+        return key.substr(0, key.find(delimiter_) + 1);
+    }
+    std::string name() const override { return std::string("delimiter:") + delimiter_; }
+
+private:
+    char delimiter_;
+};
@@ -0,0 +1,127 @@
+#include "storage/range_tombstone.h"
+#include <algorithm>
+#include <map>
+
+FragmentedRangeTombstoneList::FragmentedRangeTombstoneList(const std::vector<RangeTombstone>& tombstones) {
+    // 所有边界点排序去重，相邻两点之间就是一个候选片段
+    std::vector<std::string> bounds;
+    std::vector<const RangeTombstone*> sorted;
+    for (const auto& t : tombstones) {
+        if (t.start < t.end) {
+            bounds.push_back(t.start);
+            bounds.push_back(t.end);
+            sorted.push_back(&t);
+        }
+    }
+    std::sort(bounds.begin(), bounds.end());
+    bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+    std::sort(sorted.begin(), sorted.end(),
+              [](const RangeTombstone* a, const RangeTombstone* b) { return a->start < b->start; });
+
+    // 扫描线：active 按 end 排序，保存覆盖当前片段的范围
+    std::multimap<std::string, uint64_t> active;
+    size_t next = 0;
+    for (size_t i = 0; i + 1 < bounds.size(); i++) {
+        const std::string& start = bounds[i];
+        while (!active.empty() && active.begin()->first <= start) {
+            active.erase(active.begin());
+        }
+        while (next < sorted.size() && sorted[next]->start <= start) {
+            active.emplace(sorted[next]->end, sorted[next]->seq);
+            next++;
+        }
+        if (active.empty()) {
+            continue;
+        }
+
+        std::vector<uint64_t> seqs;
+        for (const auto& [end, seq] : active) {
+            seqs.push_back(seq);
+        }
+        std::sort(seqs.begin(), seqs.end(), std::greater<uint64_t>());
+        seqs.erase(std::unique(seqs.begin(), seqs.end()), seqs.end());
+
+        // 与前一个片段首尾相接且序列号相同则合并
+        if (!fragments_.empty() && fragments_.back().end == start && fragments_.back().seqs == seqs) {
+            fragments_.back().end = bounds[i + 1];
+        } else {
+            fragments_.push_back({start, bounds[i + 1], std::move(seqs)});
+        }
+    }
+}
+
+const FragmentedRangeTombstoneList::Fragment*
+FragmentedRangeTombstoneList::find(const std::string& key) const {
+    // 第一个 end > key 的片段
+    auto it = std::upper_bound(fragments_.begin(), fragments_.end(), key,
+                               [](const std::string& k, const Fragment& f) { return k < f.end; });
+    if (it == fragments_.end() || key < it->start) {
+        return nullptr;
+    }
+    return &*it;
+}
+
+static bool visible_seq(const std::vector<uint64_t>& seqs, uint64_t snapshot_seq, uint64_t& seq) {
+    for (uint64_t s : seqs) {
+        if (s <= snapshot_seq) {
+            seq = s;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FragmentedRangeTombstoneList::max_covering_seq(const std::string& key, uint64_t snapshot_seq,
+                                                    uint64_t& seq) const {
+    const Fragment* fragment = find(key);
+    return fragment && visible_seq(fragment->seqs, snapshot_seq, seq);
+}
+
+bool FragmentedRangeTombstoneList::covers_range(const std::string& begin, const std::string& end,
+                                                uint64_t snapshot_seq, uint64_t& seq) const {
+    auto it = std::upper_bound(fragments_.begin(), fragments_.end(), begin,
+                               [](const std::string& k, const Fragment& f) { return k < f.end; });
+    if (it == fragments_.end() || begin < it->start) {
+        return false;
+    }
+
+    // 相邻片段首尾相接时整体视为一段，取各片段可见序列号中最小的一个
+    bool found = false;
+    for (; it != fragments_.end(); ++it) {
+        uint64_t fragment_seq;
+        if (!visible_seq(it->seqs, snapshot_seq, fragment_seq)) {
+            return false;
+        }
+        seq = found ? std::min(seq, fragment_seq) : fragment_seq;
+        found = true;
+        if (end < it->end) {
+            return true;
+        }
+        auto next = it + 1;
+        if (next == fragments_.end() || next->start != it->end) {
+            return false;
+        }
+    }
+    return false;
+}
+
+std::vector<RangeTombstone> FragmentedRangeTombstoneList::to_tombstones(bool max_seq_only) const {
+    std::vector<RangeTombstone> result;
+    for (const auto& fragment : fragments_) {
+        for (uint64_t seq : fragment.seqs) {
+            result.emplace_back(fragment.start, fragment.end, seq);
+            if (max_seq_only) {
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+std::string FragmentedRangeTombstoneList::smallest_key() const {
+    return fragments_.empty() ? std::string() : fragments_.front().start;
+}
+
+std::string FragmentedRangeTombstoneList::largest_key() const {
+    return fragments_.empty() ? std::string() : fragments_.back().end;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// 范围删除：删除 [start, end) 内序列号小于 seq 的所有版本
+struct RangeTombstone {
+    std::string start;
+    std::string end;
+    uint64_t seq;
+
+    RangeTombstone() : seq(0) {}
+    RangeTombstone(const std::string& start, const std::string& end, uint64_t seq)
+        : start(start), end(end), seq(seq) {}
+};
+
+// 碎片化的范围删除索引：把可能互相重叠的范围切成互不重叠、按 start 排序的片段，
+// 每个片段记下覆盖它的全部序列号（降序）。查询一个 key 只需一次二分查找
+class FragmentedRangeTombstoneList {
+public:
+    struct Fragment {
+        std::string start;
+        std::string end;
+        std::vector<uint64_t> seqs;  // DESC
+    };
+
+    FragmentedRangeTombstoneList() = default;
+    explicit FragmentedRangeTombstoneList(const std::vector<RangeTombstone>& tombstones);
+
+    bool empty() const { return fragments_.empty(); }
+    size_t size() const { return fragments_.size(); }
+    const std::vector<Fragment>& fragments() const { return fragments_; }
+
+    // 覆盖 key 且 seq <= snapshot_seq 的最大序列号；没有则返回 false
+    bool max_covering_seq(const std::string& key, uint64_t snapshot_seq, uint64_t& seq) const;
+    // 包含 key 的片段，没有则返回 nullptr
+    const Fragment* find(const std::string& key) const;
+    // [begin, end] 是否整体落在首尾相接的 seq <= snapshot_seq 的片段内，
+    // 是则返回这些片段可见序列号中最小的一个（整个区间都被它覆盖）
+    bool covers_range(const std::string& begin, const std::string& end, uint64_t snapshot_seq,
+                      uint64_t& seq) const;
+
+    // 展开成 (片段, 序列号) 列表，用于写入 SSTable；max_seq_only 时每个片段只保留最新的序列号
+    std::vector<RangeTombstone> to_tombstones(bool max_seq_only = false) const;
+    std::string smallest_key() const;
+    std::string largest_key() const;  // 最后一个片段的 end（开区间上界）
+
+private:
+    std::vector<Fragment> fragments_;
+};
@@ -0,0 +1,66 @@
+#pragma once
+#include <string>
+#include <cstring>
+#include <cstddef>
+#include <ostream>
+
+// Slice：指向外部内存的只读视图（不拥有数据）
+// 迭代器通过 Slice 返回 key/value，避免每次访问都拷贝 std::string。
+// 生命周期：Slice 指向的数据只在迭代器下一次移动（next/prev/seek）之前有效。
+class Slice {
+public:
+    Slice() : data_(""), size_(0) {}
+    Slice(const char* d, size_t n) : data_(d), size_(n) {}
+    Slice(const std::string& s) : data_(s.data()), size_(s.size()) {}
+    Slice(const char* s) : data_(s), size_(std::strlen(s)) {}
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    char operator[](size_t n) const { return data_[n]; }
+
+    void clear() {
+        data_ = "";
+        size_ = 0;
+    }
+
+    void remove_prefix(size_t n) {
+        data_ += n;
+        size_ -= n;
+    }
+
+    std::string to_string() const { return std::string(data_, size_); }
+
+    // 三路比较：<0 / 0 / >0
+    int compare(const Slice& b) const {
+        const size_t min_len = (size_ < b.size_) ? size_ : b.size_;
+        int r = (min_len == 0) ? 0 : std::memcmp(data_, b.data_, min_len);
+        if (r == 0) {
+            if (size_ < b.size_) r = -1;
+            else if (size_ > b.size_) r = +1;
+        }
+        return r;
+    }
+
+    bool starts_with(const Slice& x) const {
+        return size_ >= x.size_ && (x.size_ == 0 || std::memcmp(data_, x.data_, x.size_) == 0);
+    }
+
+private:
+    const char* data_;
+    size_t size_;
+};
+
+inline bool operator==(const Slice& a, const Slice& b) {
+    return a.size() == b.size() && (a.size() == 0 || std::memcmp(a.data(), b.data(), a.size()) == 0);
+}
+inline bool operator!=(const Slice& a, const Slice& b) { return !(a == b); }
+inline bool operator<(const Slice& a, const Slice& b) { return a.compare(b) < 0; }
+inline bool operator>(const Slice& a, const Slice& b) { return a.compare(b) > 0; }
+inline bool operator<=(const Slice& a, const Slice& b) { return a.compare(b) <= 0; }
+inline bool operator>=(const Slice& a, const Slice& b) { return a.compare(b) >= 0; }
+
+inline std::ostream& operator<<(std::ostream& os, const Slice& s) {
+    return os.write(s.data(), static_cast<std::streamsize>(s.size()));
+}
@@ -12,11 +12,19 @@ RealtimeSyncProcessor::RealtimeSyncProcessor(const SyncConfig& config)
 }
 
 void RealtimeSyncProcessor::process(const ChangeEvent& event) {
-    if (stats_.status != SyncStatus::ACTIVE) {
+    if (!should_sync_key(event.key)) {
         return;
     }
     
-    if (!should_sync_key(event.key)) {
+    uint64_t timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
+        event.timestamp.time_since_epoch()).count();
+    if (event.type == EventType::DELETE) {
+        merkle_tree_.remove(event.key);
+    } else if (event.type == EventType::INSERT || event.type == EventType::UPDATE) {
+        merkle_tree_.update(event.key, event.new_value, timestamp);
+    }
+    
+    if (stats_.status != SyncStatus::ACTIVE) {
         return;
     }
     
@@ -63,6 +71,56 @@ void RealtimeSyncProcessor::set_conflict_resolver(ConflictResolver resolver) {
     conflict_resolver_ = resolver;
 }
 
+size_t RealtimeSyncProcessor::resync_target(const std::string& target_name, MerkleTreePeer& target_tree,
+                                            const ValueReader& read_source) {
+    std::shared_ptr<SyncTarget> target;
+    {
+        std::lock_guard<std::mutex> lock(targets_mutex_);
+        for (const auto& t : targets_) {
+            if (t->get_target_name() == target_name) {
+                target = t;
+                break;
+            }
+        }
+    }
+    if (!target || !target->is_healthy()) {
+        return 0;
+    }
+    
+    // 这里 "local" 指源端，"remote" 指目标
+    MerkleDiff diff = merkle_tree_.diff(target_tree);
+    size_t resent = 0;
+    
+    try {
+        std::string value;
+        for (const auto& key : diff.missing_remote) {
+            if (read_source(key, value)) {
+                target->sync_insert(key, value);
+                resent++;
+            }
+        }
+        for (const auto& target_digest : diff.mismatched) {
+            if (read_source(target_digest.key, value)) {
+                target->sync_update(target_digest.key, "", value);
+                resent++;
+            }
+        }
+        for (const auto& key : diff.missing_local) {
+            target->sync_delete(key, "");
+            resent++;
+        }
+    } catch (const std::exception& e) {
+        update_stats(false);
+        handle_sync_error(target_name, e);
+        return resent;
+    }
+    
+    if (resent > 0) {
+        update_stats(true);
+    }
+    return resent;
+}
+
 bool RealtimeSyncProcessor::should_sync_key(const std::string& key) const {
     if (config_.source_patterns.empty()) {
         return true;
@@ -2,6 +2,7 @@
 
 #include "stream_types.h"
 #include "change_stream.h"
+#include "../partition_recovery/merkle_tree.h"
 #include <memory>
 #include <vector>
 #include <unordered_map>
@@ -76,6 +77,13 @@ public:
                                                       const std::string& local_value,
                                                       const std::string& remote_value)>;
     void set_conflict_resolver(ConflictResolver resolver);
+    
+    // 反熵重同步：目标断连或暂停期间丢失的事件不会重放，
+    // 用源端 Merkle 树与目标的树比较，只重发不一致的键
+    using ValueReader = std::function<bool(const std::string& key, std::string& value)>;
+    size_t resync_target(const std::string& target_name, MerkleTreePeer& target_tree,
+                         const ValueReader& read_source);
+    const MerkleTree& get_merkle_tree() const { return merkle_tree_; }
 
 private:
     SyncConfig config_;
@@ -87,6 +95,9 @@ private:
     
     ConflictResolver conflict_resolver_;
     
+    // 源端数据的 Merkle 树，随变更事件增量维护（暂停时也维护）
+    MerkleTree merkle_tree_;
+    
     // 内部方法
     bool should_sync_key(const std::string& key) const;
     void sync_to_targets(const ChangeEvent& event);
@@ -1,9 +1,11 @@
 #include "version/version_set.h"
 #include <fstream>
 #include <iostream>
+#include <sstream>
+#include <filesystem>
 
 void VersionSet::persist_add(const SSTableMeta& meta, int level) {
-    std::ofstream ofs("MANIFEST", std::ios::app);
+    std::ofstream ofs(manifest_path_, std::ios::app);
     ofs << "ADD " << level << " "
         << meta.filename << " "
         << meta.min_key << " "
@@ -11,21 +13,52 @@ void VersionSet::persist_add(const SSTableMeta& meta, int level) {
 }
 
 void VersionSet::persist_del(const std::string& filename, int level) {
-    std::ofstream ofs("MANIFEST", std::ios::app);
+    std::ofstream ofs(manifest_path_, std::ios::app);
     ofs << "DEL " << level << " " << filename << "\n";
 }
 
+void VersionSet::persist_next_seq(uint64_t next_seq) {
+    std::ofstream ofs(manifest_path_, std::ios::app);
+    ofs << "SEQ " << next_seq << "\n";
+    next_seq_ = std::max(next_seq_, next_seq);
+}
+
+bool VersionSet::persist_ingest(const std::vector<std::pair<int, SSTableMeta>>& files,
+                                uint64_t next_seq) {
+    // 整组记录拼好后一次写入并刷盘，崩溃时最多留下一个不完整的尾部记录
+    std::ostringstream record;
+    record << "INGEST " << files.size() << " " << next_seq << "\n";
+    for (const auto& [level, meta] : files) {
+        record << level << " " << meta.filename << " " << meta.min_key << " "
+               << meta.max_key << " " << meta.global_seq << "\n";
+    }
+    record << "END\n";
+    
+    std::ofstream ofs(manifest_path_, std::ios::app);
+    std::string data = record.str();
+    ofs.write(data.data(), data.size());
+    ofs.flush();
+    if (!ofs) {
+        return false;
+    }
+    next_seq_ = std::max(next_seq_, next_seq);
+    return true;
+}
+
 void VersionSet::recover() {
     current_.levels.clear();
     current_.levels.resize(max_level_);
+    next_seq_ = 0;
 
-    std::ifstream ifs("MANIFEST");
+    std::ifstream ifs(manifest_path_);
     if (!ifs.is_open()) {
-        std::cout << "[VersionSet] MANIFEST 文件不存在，创建新数据库\n";
+        std::cout << "[VersionSet] " << manifest_path_ << " 文件不存在，创建新数据库\n";
         return;
     }
 
     std::string op;
+    std::streampos record_start = ifs.tellg();
+    bool torn_tail = false;
     while (ifs >> op) {
         if (op == "ADD") {
             int level;
@@ -34,6 +67,33 @@ void VersionSet::recover() {
             if (level >= 0 && level < max_level_) {
                 current_.levels[level].push_back(meta);
             }
+        } else if (op == "INGEST") {
+            size_t count = 0;
+            uint64_t seq = 0;
+            ifs >> count >> seq;
+            std::vector<std::pair<int, SSTableMeta>> files;
+            for (size_t i = 0; i < count && ifs; i++) {
+                int level;
+                SSTableMeta meta("", "", "", 0);
+                if (ifs >> level >> meta.filename >> meta.min_key >> meta.max_key >> meta.global_seq) {
+                    files.emplace_back(level, meta);
+                }
+            }
+            std::string end;
+            if (!(ifs >> end) || end != "END" || files.size() != count) {
+                torn_tail = true;
+                break;
+            }
+            for (const auto& [level, meta] : files) {
+                if (level >= 0 && level < max_level_) {
+                    current_.levels[level].push_back(meta);
+                }
+            }
+            next_seq_ = std::max(next_seq_, seq);
+        } else if (op == "SEQ") {
+            uint64_t seq;
+            ifs >> seq;
+            next_seq_ = std::max(next_seq_, seq);
         } else if (op == "DEL") {
             int level;
             std::string filename;
@@ -47,7 +107,16 @@ void VersionSet::recover() {
                 );
             }
         }
+        record_start = ifs.tellg();
+    }
+    
+    // 崩溃留下的不完整 INGEST 记录只可能在末尾：截掉它，之后追加的记录才能被正常读到
+    if (torn_tail) {
+        ifs.close();
+        std::error_code ec;
+        std::filesystem::resize_file(manifest_path_, static_cast<uintmax_t>(record_start), ec);
+        std::cout << "[VersionSet] 丢弃 MANIFEST 末尾不完整的 INGEST 记录\n";
     }
     
-    std::cout << "[VersionSet] 从 MANIFEST 恢复完成\n";
+    std::cout << "[VersionSet] 从 " << manifest_path_ << " 恢复完成\n";
 }
\ No newline at end of file
@@ -4,11 +4,15 @@
 #include <fstream>
 #include <string>
 #include <algorithm>
+#include <cstdint>
+#include <vector>
+#include <utility>
 
 class VersionSet {
 public:
-    VersionSet(int max_level) 
-        : max_level_(max_level), current_(max_level) {}
+    // 每个列族各有一个 MANIFEST：默认列族沿用 "MANIFEST"，其余为 "MANIFEST-<列族编号>"
+    explicit VersionSet(int max_level, const std::string& manifest_path = "MANIFEST") 
+        : max_level_(max_level), current_(max_level), manifest_path_(manifest_path) {}
 
     const Version& current() const {
         return current_;
@@ -34,8 +38,17 @@ public:
     void recover();
     void persist_add(const SSTableMeta& meta, int level);
     void persist_del(const std::string& filename, int level);
+    // 已落盘数据之后的下一个序列号，重启时据此恢复全局序列号
+    void persist_next_seq(uint64_t next_seq);
+    uint64_t next_seq() const { return next_seq_; }
+    // 外部文件导入：一组文件（层级, 元数据）与新的序列号作为一条原子记录写入 MANIFEST，
+    // 恢复时只有读到完整的一组才生效
+    bool persist_ingest(const std::vector<std::pair<int, SSTableMeta>>& files, uint64_t next_seq);
+    const std::string& manifest_path() const { return manifest_path_; }
 
 private:
     int max_level_;
     Version current_;
+    std::string manifest_path_;
+    uint64_t next_seq_ = 0;
 };
\ No newline at end of file
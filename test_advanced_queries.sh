@@ -30,14 +30,24 @@ echo "✅ 编译成功"
 echo "编译测试程序..."
 g++ -std=c++17 -I../src -O2 ../test_advanced_queries.cpp \
     ../src/db/kv_db.cpp \
+    ../src/monitoring/metrics_registry.cpp \
     ../src/query/query_engine.cpp \
     ../src/storage/memtable.cpp \
+    ../src/storage/range_tombstone.cpp \
+    ../src/storage/merge_operator.cpp \
     ../src/log/wal.cpp \
+    ../src/db/write_batch.cpp \
     ../src/sstable/sstable_writer.cpp \
     ../src/sstable/sstable_reader.cpp \
     ../src/sstable/sstable_meta_util.cpp \
     ../src/sstable/block_index.cpp \
+    ../src/sstable/data_block.cpp \
     ../src/compaction/compactor.cpp \
+    ../src/blob/blob_file.cpp \
+    ../src/blob/blob_manager.cpp \
+    ../src/blob/blob_iterator.cpp \
+    ../src/compaction/compaction_filter.cpp \
+    ../src/iterator/ttl_iterator.cpp \
     ../src/compaction/compaction_strategy.cpp \
     ../src/bloom/bloom_filter.cpp \
     ../src/cache/block_cache.cpp \
@@ -0,0 +1,314 @@
+#include "src/db/kv_db.h"
+#include "src/blob/blob_file.h"
+#include "src/blob/blob_manager.h"
+#include "src/cache/block_cache.h"
+#include "src/sstable/sstable_meta_util.h"
+#include <iostream>
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+class BlobFilesTest {
+public:
+    void run_all_tests() {
+        std::cout << "=== 键值分离（Blob 文件）测试 ===" << std::endl;
+
+        test_blob_file_format();
+        test_resolve_through_cache();
+        test_separation_on_flush();
+        test_iterators();
+        test_compaction_moves_references();
+        test_drop_column_family();
+
+        reset();
+        std::cout << "🎉 所有键值分离测试通过！" << std::endl;
+    }
+
+private:
+    static constexpr const char* WAL_FILE = "test_blob_files.wal";
+
+    void reset() {
+        std::filesystem::remove_all("data");
+        std::filesystem::remove_all("blob_test_dir");
+        std::filesystem::remove(WAL_FILE);
+        std::filesystem::remove("COLUMN_FAMILIES");
+        std::filesystem::remove(BlobManager::MANIFEST);
+        for (const auto& entry : std::filesystem::directory_iterator(".")) {
+            if (entry.path().filename().string().rfind("MANIFEST", 0) == 0) {
+                std::filesystem::remove(entry.path());
+            }
+        }
+    }
+
+    static BlobOptions blob_options() {
+        BlobOptions options;
+        options.min_blob_size = 1024;
+        options.gc_garbage_ratio = 0.5;
+        return options;
+    }
+
+    static std::string big_value(char c, int i) {
+        return std::string(2000, c) + std::to_string(i);
+    }
+
+    static const BlobFileMeta* find_blob(const std::vector<BlobFileMeta>& files, uint64_t file_number) {
+        for (const auto& meta : files) {
+            if (meta.file_number == file_number) {
+                return &meta;
+            }
+        }
+        return nullptr;
+    }
+
+    static std::string read_file(const std::string& path) {
+        std::ifstream in(path);
+        std::stringstream ss;
+        ss << in.rdbuf();
+        return ss.str();
+    }
+
+    void test_blob_file_format() {
+        std::cout << "\n1. 测试 blob 文件读写与引用编码..." << std::endl;
+        reset();
+        std::filesystem::create_directories("blob_test_dir");
+
+        BlobFileWriter writer(7, "blob_test_dir/blob_7.blob");
+        BlobIndex first = writer.add("a", "hello");
+        BlobIndex second = writer.add("bb", "with spaces and\nnewline");
+        assert(writer.finish());
+        assert(writer.blob_count() == 2);
+        assert(writer.blob_bytes() == 5 + 23);
+        assert(second.offset > first.offset + first.size);
+
+        BlobIndex decoded;
+        std::string encoded = second.encode();
+        assert(BlobIndex::is_blob_index(encoded));
+        assert(BlobIndex::decode(encoded, decoded));
+        assert(decoded.file_number == 7 && decoded.offset == second.offset && decoded.size == second.size);
+        assert(!BlobIndex::decode("plain_value", decoded));
+
+        std::string value;
+        assert(BlobFileReader::read("blob_test_dir/blob_7.blob", first, value) && value == "hello");
+        assert(BlobFileReader::read("blob_test_dir/blob_7.blob", decoded, value) &&
+               value == "with spaces and\nnewline");
+        std::cout << "   ✓ 引用指向值的起始偏移，可直接定位读取" << std::endl;
+    }
+
+    void test_resolve_through_cache() {
+        std::cout << "\n2. 测试经 Block Cache 读取 blob..." << std::endl;
+        reset();
+        std::filesystem::create_directories("blob_test_dir");
+        BlobManager manager("blob_test_dir");
+
+        BlobFileWriter writer(3, manager.blob_path(3));
+        std::string stored = writer.add("key", "cached_value").encode();
+        writer.finish();
+
+        BlockCache cache(16);
+        std::string value;
+        assert(manager.resolve("inline_value", value, cache) && value == "inline_value");
+        assert(manager.resolve(stored, value, cache) && value == "cached_value");
+
+        // 文件删除后仍能从缓存命中
+        std::filesystem::remove(manager.blob_path(3));
+        value.clear();
+        assert(manager.resolve(stored, value, cache) && value == "cached_value");
+
+        BlockCache cold_cache(16);
+        assert(!manager.resolve(stored, value, cold_cache));
+        std::cout << "   ✓ blob 读取进入 Block Cache，重复读取不再访问文件" << std::endl;
+    }
+
+    void test_separation_on_flush() {
+        std::cout << "\n3. 测试刷盘时按阈值分离大值..." << std::endl;
+        reset();
+        {
+            KVDB db(WAL_FILE);
+            db.set_blob_options(blob_options());
+            for (int i = 0; i < 10; i++) {
+                assert(db.put("big" + std::to_string(i), big_value('x', i)));
+                assert(db.put("small" + std::to_string(i), "v" + std::to_string(i)));
+            }
+            assert(db.get_blob_files().empty());
+            db.flush();
+
+            auto files = db.get_blob_files();
+            assert(files.size() == 1);
+            assert(files[0].total_count == 10);
+            assert(files[0].total_bytes == 10 * 2001);
+
+            // SSTable 中只有引用，小值仍然内联
+            std::string sstable;
+            std::string sstable_path;
+            for (const auto& entry : std::filesystem::directory_iterator("data")) {
+                if (entry.path().extension() == ".dat") {
+                    sstable_path = entry.path().string();
+                    sstable = read_file(sstable_path);
+                }
+            }
+            assert(sstable.find(BlobIndex::PREFIX) != std::string::npos);
+            assert(sstable.find(std::string(2000, 'x')) == std::string::npos);
+            assert(sstable.size() < 10 * 2000);
+            std::string small3;
+            SSTableMetaUtil::for_each_record(sstable_path,
+                [&](const std::string& key, uint64_t, const std::string& stored) {
+                    if (key == "small3") {
+                        small3 = stored;
+                    }
+                });
+            assert(small3 == "v3");
+
+            std::string value;
+            for (int i = 0; i < 10; i++) {
+                assert(db.get("big" + std::to_string(i), value) && value == big_value('x', i));
+                assert(db.get("small" + std::to_string(i), value) && value == "v" + std::to_string(i));
+            }
+        }
+
+        // 重启后从 BLOB_MANIFEST 恢复
+        {
+            KVDB db(WAL_FILE);
+            auto files = db.get_blob_files();
+            assert(files.size() == 1 && files[0].total_count == 10);
+            std::string value;
+            assert(db.get("big7", value) && value == big_value('x', 7));
+        }
+        std::cout << "   ✓ 大值写入 blob 文件，SSTable 只存引用，重启后可读" << std::endl;
+    }
+
+    void test_iterators() {
+        std::cout << "\n4. 测试迭代器解析 blob 引用..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        db.set_blob_options(blob_options());
+        for (int i = 0; i < 5; i++) {
+            assert(db.put("big" + std::to_string(i), big_value('y', i)));
+            assert(db.put("small" + std::to_string(i), "s" + std::to_string(i)));
+        }
+        db.flush();
+        assert(db.put("big4", "updated_inline"));  // MemTable 中的新版本遮蔽 blob
+
+        Snapshot snapshot = db.get_snapshot();
+        auto it = db.new_iterator(snapshot);
+        int count = 0;
+        for (it->seek_to_first(); it->valid(); it->next()) {
+            std::string key = it->key();
+            if (key == "big4") {
+                assert(it->value() == "updated_inline");
+            } else if (key.rfind("big", 0) == 0) {
+                assert(it->value() == big_value('y', key.back() - '0'));
+            } else {
+                assert(it->value() == "s" + std::string(1, key.back()));
+            }
+            count++;
+        }
+        assert(count == 10);
+
+        auto prefix_it = db.new_prefix_iterator(snapshot, "big");
+        count = 0;
+        for (; prefix_it->valid() && prefix_it->key().rfind("big", 0) == 0; prefix_it->next()) {
+            count++;
+        }
+        assert(count == 5);
+
+        it->seek_to_last();
+        assert(it->key() == "small4" && it->value() == "s4");
+        it->seek_for_prev("big3");
+        assert(it->key() == "big3" && it->value() == big_value('y', 3));
+        db.release_snapshot(snapshot);
+        std::cout << "   ✓ 正向、反向与前缀迭代都返回原值" << std::endl;
+    }
+
+    void test_compaction_moves_references() {
+        std::cout << "\n5. 测试压缩只搬动引用，按垃圾比例回收 blob 文件..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        db.set_blob_options(blob_options());
+
+        for (int i = 0; i < 10; i++) {
+            assert(db.put("k" + std::to_string(i), big_value('a', i)));
+        }
+        db.flush();  // blob 1：10 个值
+        for (int i = 0; i < 6; i++) {
+            assert(db.put("k" + std::to_string(i), big_value('b', i)));
+        }
+        db.flush();  // blob 2：6 个值，遮蔽 blob 1 中的 6 个
+        // Leveled 策略在 L0 积累到 8 个文件时才压缩
+        for (int i = 0; i < 6; i++) {
+            assert(db.put("m" + std::to_string(i), "small"));
+            db.flush();
+        }
+
+        auto before = db.get_blob_files();
+        assert(before.size() == 2);
+        uint64_t old_file = before[0].file_number;
+        uint64_t new_file = before[1].file_number;
+        auto old_size = std::filesystem::file_size("data/blob_" + std::to_string(old_file) + ".blob");
+
+        // 第一次压缩：只改写引用，blob 文件保持不变，被遮蔽的值记为垃圾
+        db.compact();
+        auto after = db.get_blob_files();
+        assert(after.size() == 2);
+        const BlobFileMeta* old_meta = find_blob(after, old_file);
+        assert(old_meta && old_meta->garbage_count == 6);
+        assert(old_meta->garbage_ratio() >= 0.5);
+        assert(find_blob(after, new_file)->garbage_count == 0);
+        assert(std::filesystem::file_size("data/blob_" + std::to_string(old_file) + ".blob") == old_size);
+
+        std::string value;
+        for (int i = 0; i < 10; i++) {
+            assert(db.get("k" + std::to_string(i), value));
+            assert(value == big_value(i < 6 ? 'b' : 'a', i));
+        }
+
+        // 第二次压缩覆盖同一键区间：垃圾比例超过阈值的文件中存活的值搬到新文件，旧文件删除
+        for (int i = 0; i < 8; i++) {
+            assert(db.put("k" + std::to_string(i) + "_", "small"));
+            db.flush();
+        }
+        db.compact();
+        auto relocated = db.get_blob_files();
+        assert(relocated.size() == 2);
+        assert(!find_blob(relocated, old_file));
+        assert(!std::filesystem::exists("data/blob_" + std::to_string(old_file) + ".blob"));
+        assert(find_blob(relocated, new_file));
+        for (const auto& meta : relocated) {
+            if (meta.file_number != new_file) {
+                assert(meta.total_count == 4);
+            }
+        }
+        for (int i = 0; i < 10; i++) {
+            assert(db.get("k" + std::to_string(i), value));
+            assert(value == big_value(i < 6 ? 'b' : 'a', i));
+        }
+        std::cout << "   ✓ 压缩只搬动引用；垃圾比例达标的文件搬迁存活值后删除" << std::endl;
+    }
+
+    void test_drop_column_family() {
+        std::cout << "\n6. 测试删除列族回收 blob 文件..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        db.set_blob_options(blob_options());
+        ColumnFamilyHandle* cf = db.create_column_family("blobs");
+        for (int i = 0; i < 4; i++) {
+            assert(db.put(cf, "key" + std::to_string(i), big_value('z', i)));
+        }
+        db.flush(cf);
+        auto files = db.get_blob_files();
+        assert(files.size() == 1);
+        std::string value;
+        assert(db.get(cf, "key2", value) && value == big_value('z', 2));
+
+        assert(db.drop_column_family(cf));
+        assert(db.get_blob_files().empty());
+        assert(!std::filesystem::exists("data/blob_" + std::to_string(files[0].file_number) + ".blob"));
+        std::cout << "   ✓ 列族删除后其引用的 blob 文件随之删除" << std::endl;
+    }
+};
+
+int main() {
+    BlobFilesTest test;
+    test.run_all_tests();
+    return 0;
+}
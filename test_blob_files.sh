@@ -0,0 +1,4 @@
+#!/bin/bash
+
+# 源文件列表见 CMakeLists.txt 中的 KVDB_ENGINE_SOURCES / KVDB_ENGINE_TESTS
+exec "$(dirname "$0")/run_engine_test.sh" blob_files "键值分离测试"
@@ -0,0 +1,386 @@
+#include "src/sstable/data_block.h"
+#include "src/sstable/sstable_writer.h"
+#include "src/sstable/sstable_reader.h"
+#include "src/sstable/sstable_meta_util.h"
+#include "src/iterator/sstable_iterator.h"
+#include "src/storage/prefix_extractor.h"
+#include "src/cache/block_cache.h"
+#include "src/db/kv_db.h"
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <vector>
+#include <string>
+
+class BlockFormatTest {
+public:
+    void run_all_tests() {
+        std::cout << "=== 前缀压缩数据块测试 ===" << std::endl;
+
+        test_prefix_and_restarts();
+        test_versions_and_tombstones();
+        test_corrupted_block();
+        test_sstable_round_trip();
+        test_size_and_lookup();
+        test_flush_format();
+        test_engine_round_trip();
+
+        cleanup();
+        reset_db();
+        std::cout << "🎉 所有数据块格式测试通过！" << std::endl;
+    }
+
+private:
+    static constexpr const char* SST_FILE = "test_block_format.sst";
+    static constexpr const char* SST_FILE_PLAIN = "test_block_format_plain.sst";
+    static constexpr const char* WAL_FILE = "test_block_format.wal";
+
+    void cleanup() {
+        std::filesystem::remove(SST_FILE);
+        std::filesystem::remove(SST_FILE_PLAIN);
+    }
+
+    void reset_db() {
+        std::filesystem::remove_all("data");
+        std::filesystem::remove(WAL_FILE);
+        std::filesystem::remove("COLUMN_FAMILIES");
+        std::filesystem::remove("BLOB_MANIFEST");
+        for (const auto& entry : std::filesystem::directory_iterator(".")) {
+            if (entry.path().filename().string().rfind("MANIFEST", 0) == 0) {
+                std::filesystem::remove(entry.path());
+            }
+        }
+    }
+
+    static std::string make_key(int i) {
+        char key[32];
+        snprintf(key, sizeof(key), "user:%08d", i);
+        return key;
+    }
+
+    static bool lookup(const DataBlockReader& reader, const std::string& key, std::string& value,
+                       uint64_t snapshot_seq = UINT64_MAX) {
+        uint64_t seq = 0;
+        Slice found;
+        if (!reader.find(Slice(key), snapshot_seq, seq, found)) {
+            return false;
+        }
+        value = found.to_string();
+        return true;
+    }
+
+    void test_prefix_and_restarts() {
+        std::cout << "\n1. 共享前缀与重启点" << std::endl;
+        // 含互为前缀的 key，覆盖 shared 大于、等于、小于已匹配长度的各种情形
+        std::vector<std::string> keys = {"a", "ab", "abc", "abd", "abda", "abe", "b", "ba", "bab",
+                                         "bb", "c", "ca", "caaa", "cab", "d"};
+        for (uint32_t interval : {1u, 2u, 4u, 16u}) {
+            DataBlockBuilder builder(interval);
+            for (size_t i = 0; i < keys.size(); i++) {
+                builder.add(keys[i], {VersionedValue(i + 1, "v" + keys[i])});
+            }
+            std::string block = builder.finish();
+            DataBlockReader reader(block.data(), block.size());
+            assert(reader.valid());
+            assert(reader.num_restarts() == (keys.size() + interval - 1) / interval);
+
+            std::string value;
+            for (const auto& key : keys) {
+                assert(lookup(reader, key, value) && value == "v" + key);
+            }
+            // 块前、块间、块后都不存在
+            for (const char* missing : {"", "0", "aa", "abb", "abcd", "abdb", "abf", "az", "baa", "bc",
+                                        "caa", "caab", "cb", "da", "z"}) {
+                assert(!lookup(reader, missing, value));
+            }
+        }
+
+        DataBlockBuilder builder(16);
+        DataBlockBuilder plain(1);
+        for (int i = 0; i < 256; i++) {
+            builder.add(make_key(i), {VersionedValue(i + 1, "x")});
+            plain.add(make_key(i), {VersionedValue(i + 1, "x")});
+        }
+        size_t compressed = builder.finish().size();
+        size_t uncompressed = plain.finish().size();
+        assert(compressed < uncompressed);
+        std::cout << "  ✓ 256 个 key: 重启间隔 16 为 " << compressed << " 字节，不共享前缀为 "
+                  << uncompressed << " 字节" << std::endl;
+    }
+
+    void test_versions_and_tombstones() {
+        std::cout << "\n2. 多版本与墓碑" << std::endl;
+        DataBlockBuilder builder(4);
+        builder.add("k1", {VersionedValue(30, "v30"), VersionedValue(20, "__TOMBSTONE__"), VersionedValue(10, "v10")});
+        builder.add("k2", {VersionedValue(1000000, "big"), VersionedValue(5, "small")});
+        builder.add("k3", {VersionedValue(7, "")});
+        std::string block = builder.finish();
+        DataBlockReader reader(block.data(), block.size());
+        assert(reader.valid());
+
+        std::string value;
+        assert(lookup(reader, "k1", value) && value == "v30");
+        assert(lookup(reader, "k1", value, 29) && value == "__TOMBSTONE__");
+        assert(lookup(reader, "k1", value, 15) && value == "v10");
+        assert(!lookup(reader, "k1", value, 9));
+        assert(lookup(reader, "k2", value, 999999) && value == "small");
+        assert(lookup(reader, "k2", value) && value == "big");
+        assert(lookup(reader, "k3", value) && value.empty());
+
+        uint64_t seq = 0;
+        Slice found;
+        assert(reader.find(Slice("k1"), 25, seq, found) && seq == 20);
+        std::cout << "  ✓ 按快照取版本，墓碑原样返回给上层判断" << std::endl;
+    }
+
+    void test_corrupted_block() {
+        std::cout << "\n3. 损坏的块" << std::endl;
+        DataBlockBuilder builder(2);
+        for (int i = 0; i < 10; i++) {
+            builder.add(make_key(i), {VersionedValue(i + 1, "value")});
+        }
+        std::string block = builder.finish();
+
+        // 重启点数量超出块大小
+        std::string bad_count = block;
+        bad_count[bad_count.size() - 1] = '\x7f';
+        assert(!DataBlockReader(bad_count.data(), bad_count.size()).valid());
+        // 重启点偏移越过数据区
+        std::string bad_offset = block;
+        bad_offset[bad_offset.size() - 8] = '\xff';
+        bad_offset[bad_offset.size() - 7] = '\xff';
+        assert(!DataBlockReader(bad_offset.data(), bad_offset.size()).valid());
+        assert(!DataBlockReader(block.data(), 2).valid());
+
+        // 数据区被截断：查找失败而不是越界读
+        std::string truncated = block.substr(0, 20) + block.substr(block.size() - 24);
+        DataBlockReader reader(truncated.data(), truncated.size());
+        std::string value;
+        for (int i = 0; i < 10; i++) {
+            lookup(reader, make_key(i), value);
+        }
+        std::cout << "  ✓ 块尾与重启点校验，截断的条目不会越界解码" << std::endl;
+    }
+
+    static std::map<std::string, std::vector<VersionedValue>> make_data(int count) {
+        std::map<std::string, std::vector<VersionedValue>> data;
+        for (int i = 0; i < count; i++) {
+            std::string key = make_key(i);
+            // 故意乱序给出版本，写入时按 seq DESC 排列
+            data[key] = {VersionedValue(i + 1, "old_" + std::to_string(i)),
+                         VersionedValue(count + i + 1, "value_" + std::to_string(i))};
+        }
+        data[make_key(7)].push_back(VersionedValue(3 * count, "__TOMBSTONE__"));
+        return data;
+    }
+
+    void test_sstable_round_trip() {
+        std::cout << "\n4. ENHANCED_SSTABLE_V2 文件读写" << std::endl;
+        cleanup();
+        const int count = 5000;
+        auto data = make_data(count);
+        SSTableWriter::write_with_block_index(SST_FILE, data);
+
+        BlockCache cache(1000);
+        for (int i = 0; i < count; i++) {
+            auto result = SSTableReader::get(SST_FILE, make_key(i), cache);
+            if (i == 7) {
+                assert(!result.has_value());
+            } else {
+                assert(result.has_value() && result.value() == "value_" + std::to_string(i));
+            }
+        }
+        // 旧快照看到旧版本
+        auto old = SSTableReader::get(SST_FILE, make_key(42), count, cache);
+        assert(old.has_value() && old.value() == "old_42");
+        auto before_delete = SSTableReader::get(SST_FILE, make_key(7), 2 * count, cache);
+        assert(before_delete.has_value() && before_delete.value() == "value_7");
+        // 块内、块间和文件范围外都找不到
+        for (const char* missing : {"a", "user:", "user:00000010x", "user:99999999", "zzz"}) {
+            assert(!SSTableReader::get(SST_FILE, missing, cache).has_value());
+        }
+        std::cout << "  ✓ " << count << " 个 key 经 SSTableReader::get 全部读回，文件 "
+                  << std::filesystem::file_size(SST_FILE) << " 字节" << std::endl;
+    }
+
+    void test_size_and_lookup() {
+        std::cout << "\n5. 体积与块内查找耗时" << std::endl;
+        cleanup();
+        const int count = 20000;
+        auto data = make_data(count);
+
+        SSTableWriter::Config compressed;
+        SSTableWriter::write_with_block_index(SST_FILE, data, compressed);
+        SSTableWriter::Config plain;
+        plain.enable_prefix_compression = false;
+        SSTableWriter::write_with_block_index(SST_FILE_PLAIN, data, plain);
+
+        uintmax_t compressed_size = std::filesystem::file_size(SST_FILE);
+        uintmax_t plain_size = std::filesystem::file_size(SST_FILE_PLAIN);
+        assert(compressed_size < plain_size);
+        std::cout << "  前缀压缩: " << compressed_size << " 字节，不共享前缀: " << plain_size << " 字节" << std::endl;
+
+        // 单个 4KB 块内的查找：重启点二分 + 至多 restart_interval 个条目的顺序扫描
+        for (uint32_t interval : {1u, 16u, 64u}) {
+            DataBlockBuilder builder(interval);
+            std::vector<std::string> keys;
+            for (int i = 0; builder.size_estimate() < 4096; i++) {
+                keys.push_back(make_key(i * 3));
+                builder.add(keys.back(), {VersionedValue(i + 1, "value_" + std::to_string(i))});
+            }
+            std::string block = builder.finish();
+            DataBlockReader reader(block.data(), block.size());
+
+            const int rounds = 200;
+            size_t hits = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (int r = 0; r < rounds; r++) {
+                for (const auto& key : keys) {
+                    uint64_t seq;
+                    Slice value;
+                    hits += reader.find(Slice(key), UINT64_MAX, seq, value);
+                }
+            }
+            double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            assert(hits == keys.size() * rounds);
+            std::cout << "  重启间隔 " << interval << ": " << keys.size() << " 个 key，块 " << block.size()
+                      << " 字节，" << static_cast<uint64_t>(ns / hits) << " ns/查找" << std::endl;
+        }
+        std::cout << "  ✓ 体积与耗时对比完成" << std::endl;
+    }
+
+    static std::vector<std::string> iterate(const SSTableMeta& meta, uint64_t snapshot_seq, bool reverse,
+                                            const ReadOptions& options = ReadOptions()) {
+        std::vector<std::string> keys;
+        SSTableIterator it(meta, snapshot_seq, options);
+        if (reverse) {
+            for (it.seek_to_last(); it.valid(); it.prev()) {
+                keys.push_back(it.key());
+            }
+        } else {
+            for (it.seek_to_first(); it.valid(); it.next()) {
+                keys.push_back(it.key());
+            }
+        }
+        return keys;
+    }
+
+    void test_flush_format() {
+        std::cout << "\n6. 刷盘/压缩写出的块格式文件" << std::endl;
+        cleanup();
+        const int count = 3000;
+        auto data = make_data(count);
+        // 刷盘与压缩经 SSTableWriter::write 写出：数据块之后仍带范围删除、属性与前缀 Bloom Filter 块
+        std::vector<RangeTombstone> tombstones = {RangeTombstone("user:00000100", "user:00000200", 5)};
+        SSTableProperties properties;
+        properties.min_timestamp = 100;
+        properties.max_timestamp = 200;
+        DelimiterPrefixExtractor extractor(':');
+        SSTableWriter::write(SST_FILE, data, SSTableWriter::DEFAULT_BLOOM_BITS, tombstones, properties, &extractor);
+
+        std::ifstream in(SST_FILE, std::ios::binary);
+        SSTableFooter footer = SSTableReader::read_footer(in);
+        assert(footer.block_format == 2 && footer.range_del_offset && footer.properties_offset &&
+               footer.prefix_bloom_offset);
+
+        SSTableMeta meta = SSTableMetaUtil::get_meta_from_file(SST_FILE);
+        assert(meta.min_key == make_key(0) && meta.max_key == make_key(count - 1));
+        assert(meta.range_tombstones && meta.range_tombstones->to_tombstones().size() == 1);
+        assert(meta.properties.min_timestamp == 100 && meta.properties.max_timestamp == 200);
+        assert(meta.prefix_bloom && meta.prefix_bloom->filter.possiblyContains("user:"));
+
+        size_t records = 0;
+        SSTableMetaUtil::for_each_record(SST_FILE, [&](const std::string&, uint64_t, const std::string&) { records++; });
+        assert(records == 2 * count + 1);
+
+        auto version = SSTableReader::get_version(SST_FILE, make_key(7), UINT64_MAX);
+        assert(version.has_value() && version->seq == 3 * count && version->value == "__TOMBSTONE__");
+
+        // 迭代器跨块正反向遍历；墓碑以空值返回
+        auto forward = iterate(meta, UINT64_MAX, false);
+        auto backward = iterate(meta, UINT64_MAX, true);
+        assert(forward.size() == static_cast<size_t>(count));
+        assert(std::equal(forward.begin(), forward.end(), backward.rbegin()));
+        // 早于所有新版本的快照只看到旧版本；最后一个 key 的旧版本也晚于快照
+        SSTableIterator old_it(meta, count - 1);
+        old_it.seek(make_key(42));
+        assert(old_it.valid() && old_it.key() == make_key(42) && old_it.value() == "old_42");
+        old_it.seek(make_key(count - 1));
+        assert(!old_it.valid());
+
+        SSTableIterator it(meta, UINT64_MAX);
+        it.seek("user:00001000x");
+        assert(it.valid() && it.key() == make_key(1001));
+        it.prev();
+        assert(it.valid() && it.key() == make_key(1000) && it.value() == "value_1000");
+        it.seek_for_prev("user:00002000x");
+        assert(it.valid() && it.key() == make_key(2000));
+        it.seek("zzz");
+        assert(!it.valid());
+
+        ReadOptions bounded;
+        bounded.iterate_lower_bound = make_key(500);
+        bounded.iterate_upper_bound = make_key(1500);
+        assert(iterate(meta, UINT64_MAX, false, bounded).size() == 1000);
+        assert(iterate(meta, UINT64_MAX, true, bounded).front() == make_key(1499));
+        std::cout << "  ✓ footer、元数据块、记录遍历与迭代器都能读取块格式文件" << std::endl;
+    }
+
+    void test_engine_round_trip() {
+        std::cout << "\n7. 引擎刷盘与压缩" << std::endl;
+        reset_db();
+        // 块格式按长度编码，值中的空白与换行原样保留
+        auto value_of = [](int i) { return "line " + std::to_string(i) + "\n\tsecond line "; };
+        {
+            KVDB db(WAL_FILE);
+            // Leveled 策略在 L0 积累到 8 个文件时才压缩
+            for (int round = 0; round < 8; round++) {
+                for (int i = round; i < 400; i += 8) {
+                    assert(db.put(make_key(i), value_of(i)));
+                }
+                assert(db.put("round", "round " + std::to_string(round)));
+                db.flush();
+            }
+            db.compact();
+            assert(db.del(make_key(3)));
+            db.flush();
+        }
+        for (const auto& entry : std::filesystem::recursive_directory_iterator("data")) {
+            if (entry.path().extension() == ".dat") {
+                std::ifstream in(entry.path(), std::ios::binary);
+                assert(SSTableReader::read_footer(in).block_format == 2);
+            }
+        }
+
+        KVDB db(WAL_FILE);
+        std::string value;
+        for (int i = 0; i < 400; i++) {
+            if (i == 3) {
+                assert(!db.get(make_key(i), value));
+            } else {
+                assert(db.get(make_key(i), value) && value == value_of(i));
+            }
+        }
+        assert(db.get("round", value) && value == "round 7");
+
+        Snapshot snapshot = db.get_snapshot();
+        size_t scanned = 0;
+        for (auto it = db.new_iterator(snapshot); it->valid(); it->next()) {
+            scanned++;
+        }
+        db.release_snapshot(snapshot);
+        assert(scanned == 400);  // 399 个 user: key 加上 round
+        std::cout << "  ✓ 刷盘与压缩输出均为前缀压缩块，重启后点查与扫描一致" << std::endl;
+    }
+};
+
+int main() {
+    BlockFormatTest test;
+    test.run_all_tests();
+    return 0;
+}
@@ -0,0 +1,439 @@
+#include "src/network/change_notifier.h"
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <atomic>
+#include <algorithm>
+
+class ChangeNotifierTest {
+public:
+    void run_all_tests() {
+        std::cout << "=== 订阅匹配索引 / 变更通知器测试 ===" << std::endl;
+
+        test_pattern_matching();
+        test_index_matching();
+        test_index_remove();
+        test_outbound_coalescing();
+        test_outbound_lag();
+        test_notifier_ordering();
+        test_unsubscribe_barrier();
+        test_connection_subscriptions();
+        test_shard_overflow();
+        test_match_cost();
+
+        std::cout << "🎉 所有变更通知测试通过！" << std::endl;
+    }
+
+private:
+    // 参照实现：逐字符回溯的通配匹配
+    static bool glob_match(const char* p, const char* k) {
+        if (*p == '\0') {
+            return *k == '\0';
+        }
+        if (*p == '*') {
+            return glob_match(p + 1, k) || (*k != '\0' && glob_match(p, k + 1));
+        }
+        return *k == *p && glob_match(p + 1, k + 1);
+    }
+
+    static std::string random_string(std::mt19937& rng, const std::string& alphabet, size_t max_len) {
+        std::string s(rng() % (max_len + 1), ' ');
+        for (auto& c : s) {
+            c = alphabet[rng() % alphabet.size()];
+        }
+        return s;
+    }
+
+    static ChangeEventPtr make_event(const std::string& key, const std::string& value,
+                                     const std::string& operation = "PUT") {
+        return std::make_shared<const ChangeEvent>(ChangeEvent{key, value, operation, 0});
+    }
+
+    void test_pattern_matching() {
+        std::cout << "测试通配模式匹配..." << std::endl;
+
+        assert(KeyPattern("user:1").matches("user:1"));
+        assert(!KeyPattern("user:1").matches("user:10"));
+        assert(KeyPattern("user:*").matches("user:"));
+        assert(KeyPattern("user:*").matches("user:123"));
+        assert(!KeyPattern("user:*").matches("users:1"));
+        assert(KeyPattern("*").matches(""));
+        assert(KeyPattern("user:*:name").matches("user:42:name"));
+        assert(!KeyPattern("user:*:name").matches("user:42:age"));
+        assert(KeyPattern("a*a").matches("aa"));
+        assert(!KeyPattern("a*a").matches("a"));
+        assert(KeyPattern("user:*").is_prefix());
+        assert(!KeyPattern("*:audit").is_prefix());
+        assert(KeyPattern("user:1").is_exact());
+
+        // 与回溯实现对拍
+        std::mt19937 rng(7);
+        for (int i = 0; i < 20000; i++) {
+            std::string pattern = random_string(rng, "ab*", 6);
+            std::string key = random_string(rng, "ab", 8);
+            assert(KeyPattern(pattern).matches(key) == glob_match(pattern.c_str(), key.c_str()));
+        }
+
+        std::cout << "✓ 通配模式匹配测试通过" << std::endl;
+    }
+
+    // 索引的匹配结果必须与逐个模式检查一致
+    void test_index_matching() {
+        std::cout << "测试前缀树索引匹配..." << std::endl;
+
+        std::mt19937 rng(11);
+        SubscriptionIndex index;
+        std::vector<std::string> patterns;
+        for (uint64_t id = 1; id <= 500; id++) {
+            std::string pattern = random_string(rng, "abc*", 5);
+            patterns.push_back(pattern);
+            index.add(std::make_shared<SubscriptionIndex::Entry>(
+                SubscriptionIndex::Entry{id, KeyPattern(pattern), id % 2 == 0, nullptr, nullptr}));
+        }
+
+        std::vector<const SubscriptionIndex::Entry*> matched;
+        for (int i = 0; i < 5000; i++) {
+            std::string key = random_string(rng, "abc", 6);
+            bool is_delete = i % 3 == 0;
+            matched.clear();
+            index.match(key, is_delete, matched);
+
+            std::vector<uint64_t> got;
+            for (const auto* entry : matched) {
+                got.push_back(entry->id);
+            }
+            std::sort(got.begin(), got.end());
+            assert(std::adjacent_find(got.begin(), got.end()) == got.end());
+
+            std::vector<uint64_t> expected;
+            for (uint64_t id = 1; id <= patterns.size(); id++) {
+                if (glob_match(patterns[id - 1].c_str(), key.c_str()) && (!is_delete || id % 2 == 0)) {
+                    expected.push_back(id);
+                }
+            }
+            assert(got == expected);
+        }
+
+        std::cout << "✓ 前缀树索引匹配测试通过" << std::endl;
+    }
+
+    void test_index_remove() {
+        std::cout << "测试索引删除..." << std::endl;
+
+        SubscriptionIndex index;
+        std::vector<std::string> patterns = {"user:1", "user:*", "user:*:name", "*", "order:*"};
+        for (uint64_t id = 1; id <= patterns.size(); id++) {
+            index.add(std::make_shared<SubscriptionIndex::Entry>(
+                SubscriptionIndex::Entry{id, KeyPattern(patterns[id - 1]), true, nullptr, nullptr}));
+        }
+
+        std::vector<const SubscriptionIndex::Entry*> matched;
+        index.match("user:1", false, matched);
+        assert(matched.size() == 3);  // user:1, user:*, *
+
+        assert(index.remove(2));
+        assert(!index.remove(2));
+        assert(index.remove(4));
+        matched.clear();
+        index.match("user:1", false, matched);
+        assert(matched.size() == 1 && matched[0]->id == 1);
+
+        matched.clear();
+        index.match("user:7:name", false, matched);
+        assert(matched.size() == 1 && matched[0]->id == 3);
+
+        for (uint64_t id : {1, 3, 5}) {
+            assert(index.remove(id));
+        }
+        assert(index.size() == 0);
+
+        std::cout << "✓ 索引删除测试通过" << std::endl;
+    }
+
+    void test_outbound_coalescing() {
+        std::cout << "测试发送队列合并..." << std::endl;
+
+        OutboundQueue queue(16);
+        assert(queue.push(make_event("a", "1")));   // 空闲 -> 待发送，需要唤醒
+        assert(!queue.push(make_event("b", "1")));  // 已在待发送状态
+        assert(!queue.push(make_event("a", "2")));
+        assert(!queue.push(make_event("a", "3", "DELETE")));
+        assert(queue.size() == 2);
+
+        std::vector<ChangeEventPtr> events;
+        uint64_t dropped = 0;
+        assert(queue.drain(events, dropped));
+        assert(dropped == 0);
+        assert(events.size() == 2);
+        // 位置保持首次入队的顺序，内容是最新的
+        assert(events[0]->key == "a" && events[0]->value == "3" && events[0]->operation == "DELETE");
+        assert(events[1]->key == "b");
+
+        // 仍处于待发送状态，直到取空
+        assert(!queue.push(make_event("c", "1")));
+        assert(queue.drain(events, dropped) && events.size() == 1);
+        assert(!queue.drain(events, dropped));
+        assert(queue.push(make_event("d", "1")));
+
+        std::cout << "✓ 发送队列合并测试通过" << std::endl;
+    }
+
+    void test_outbound_lag() {
+        std::cout << "测试发送队列落后标记..." << std::endl;
+
+        OutboundQueue queue(4);
+        for (int i = 0; i < 10; i++) {
+            queue.push(make_event("k" + std::to_string(i), "v"));
+        }
+        // 已在队列中的 key 仍可合并，不算丢弃
+        queue.push(make_event("k0", "latest"));
+        assert(queue.size() == 4);
+
+        std::vector<ChangeEventPtr> events;
+        uint64_t dropped = 0;
+        assert(queue.drain(events, dropped));
+        assert(events.size() == 4 && dropped == 6);
+        assert(events[0]->value == "latest");
+
+        // 只有丢弃计数时也要唤醒发送方
+        assert(!queue.drain(events, dropped));
+        assert(queue.mark_dropped(3));
+        assert(queue.drain(events, dropped));
+        assert(events.empty() && dropped == 3);
+
+        std::cout << "✓ 发送队列落后标记测试通过" << std::endl;
+    }
+
+    // 同一 key 的事件经分片队列后保持发布顺序
+    void test_notifier_ordering() {
+        std::cout << "测试通知器投递顺序..." << std::endl;
+
+        ChangeNotifier notifier(4);
+        std::vector<std::shared_ptr<OutboundQueue>> queues;
+        std::atomic<int> wakeups{0};
+        for (int k = 0; k < 8; k++) {
+            auto queue = std::make_shared<OutboundQueue>(1 << 20);
+            notifier.subscribe("key" + std::to_string(k), false, queue, [&wakeups] { wakeups++; });
+            queues.push_back(queue);
+        }
+        auto all = std::make_shared<OutboundQueue>(1 << 20);
+        notifier.subscribe("key*", true, all, nullptr);
+        assert(notifier.subscription_count() == 9);
+
+        const int kRounds = 2000;
+        std::vector<std::thread> writers;
+        for (int k = 0; k < 8; k++) {
+            writers.emplace_back([&notifier, k] {
+                for (int i = 0; i < kRounds; i++) {
+                    notifier.publish("key" + std::to_string(k), std::to_string(i), "PUT");
+                }
+                notifier.publish("key" + std::to_string(k), "", "DELETE");
+            });
+        }
+        for (auto& writer : writers) {
+            writer.join();
+        }
+        notifier.wait_idle();
+        assert(notifier.published_events() == uint64_t(8 * (kRounds + 1)));
+        assert(wakeups > 0);
+
+        std::vector<ChangeEventPtr> events;
+        uint64_t dropped = 0;
+        for (int k = 0; k < 8; k++) {
+            // 未取走期间一直合并，只剩最新的 PUT；DELETE 不投递给不要删除事件的订阅
+            assert(queues[k]->drain(events, dropped));
+            assert(events.size() == 1 && dropped == 0);
+            assert(events[0]->value == std::to_string(kRounds - 1));
+        }
+        assert(all->drain(events, dropped));
+        assert(events.size() == 8);
+        for (const auto& event : events) {
+            assert(event->operation == "DELETE");
+        }
+
+        std::cout << "✓ 通知器投递顺序测试通过" << std::endl;
+    }
+
+    // unsubscribe 返回后不会再调用该订阅的 wakeup
+    void test_unsubscribe_barrier() {
+        std::cout << "测试退订屏障..." << std::endl;
+
+        ChangeNotifier notifier(2);
+        std::atomic<bool> stop{false};
+        std::thread writer([&] {
+            for (int i = 0; !stop; i++) {
+                notifier.publish("k" + std::to_string(i % 64), "v", "PUT");
+            }
+        });
+
+        for (int round = 0; round < 200; round++) {
+            auto queue = std::make_shared<OutboundQueue>();
+            auto alive = std::make_shared<std::atomic<bool>>(true);
+            uint64_t id = notifier.subscribe("k*", false, queue, [alive, queue] {
+                assert(*alive);
+                std::vector<ChangeEventPtr> events;
+                uint64_t dropped = 0;
+                queue->drain(events, dropped);
+            });
+            std::this_thread::yield();
+            assert(notifier.unsubscribe(id));
+            *alive = false;
+        }
+
+        stop = true;
+        writer.join();
+        notifier.wait_idle();
+        assert(notifier.subscription_count() == 0);
+
+        std::cout << "✓ 退订屏障测试通过" << std::endl;
+    }
+
+    // 连接的订阅共用一个发送队列，只能退订自己的订阅，关闭连接时全部退订
+    void test_connection_subscriptions() {
+        std::cout << "测试按连接登记订阅..." << std::endl;
+
+        auto notifier = std::make_shared<ChangeNotifier>(2);
+        ConnectionSubscriptions subscriptions(notifier);
+        auto alice = std::make_shared<int>(1);
+        auto bob = std::make_shared<int>(2);
+        ConnectionSubscriptions::Handle a = alice;
+        ConnectionSubscriptions::Handle b = bob;
+
+        assert(subscriptions.subscribe(a, "user:*", false, nullptr) == 0);  // 连接尚未打开
+        subscriptions.open(a);
+        subscriptions.open(b);
+        std::atomic<int> wakeups{0};
+        uint64_t users = subscriptions.subscribe(a, "user:*", false, [&wakeups] { wakeups++; });
+        uint64_t orders = subscriptions.subscribe(a, "order:1", true, [&wakeups] { wakeups++; });
+        uint64_t other = subscriptions.subscribe(b, "*", true, nullptr);
+        assert(users != 0 && orders != 0 && other != 0);
+        assert(notifier->subscription_count() == 3);
+        assert(!subscriptions.unsubscribe(a, other));  // 不是本连接的订阅
+
+        subscriptions.notifier().publish("user:1", "x", "PUT");
+        subscriptions.notifier().publish("order:1", "", "DELETE");
+        notifier->wait_idle();
+        assert(wakeups == 1);  // 两条事件进同一个队列，只唤醒一次
+
+        std::vector<ChangeEventPtr> events;
+        uint64_t dropped = 0;
+        assert(subscriptions.queue(a)->drain(events, dropped));
+        assert(events.size() == 2 && events[0]->key == "user:1" && events[1]->operation == "DELETE");
+
+        assert(subscriptions.unsubscribe(a, orders));
+        assert(!subscriptions.unsubscribe(a, orders));
+        subscriptions.close(a);
+        assert(!subscriptions.queue(a));
+        assert(notifier->subscription_count() == 1);
+        subscriptions.close_all();
+        assert(notifier->subscription_count() == 0);
+
+        std::cout << "✓ 按连接登记订阅测试通过" << std::endl;
+    }
+
+    // 分片队列满时丢弃事件，所有订阅都收到落后标记
+    void test_shard_overflow() {
+        std::cout << "测试分片队列溢出..." << std::endl;
+
+        ChangeNotifier notifier(1, 8);
+        auto queue = std::make_shared<OutboundQueue>(1 << 20);
+        std::atomic<bool> blocked{true};
+        notifier.subscribe("slow", false, queue, [&blocked] {
+            while (blocked) {
+                std::this_thread::yield();
+            }
+        });
+
+        notifier.publish("slow", "0", "PUT");  // 通知线程卡在 wakeup 里
+        while (queue->size() == 0) {
+            std::this_thread::yield();
+        }
+        for (int i = 0; i < 100; i++) {
+            notifier.publish("slow", std::to_string(i + 1), "PUT");
+        }
+        blocked = false;
+        notifier.wait_idle();
+        assert(notifier.dropped_events() > 0);
+
+        std::vector<ChangeEventPtr> events;
+        uint64_t dropped = 0;
+        assert(queue->drain(events, dropped));
+        assert(dropped == notifier.dropped_events());
+        assert(events.size() == 1);
+
+        std::cout << "✓ 分片队列溢出测试通过" << std::endl;
+    }
+
+    // 1 万个订阅下单次写的匹配开销：索引 vs 逐个模式匹配
+    void test_match_cost() {
+        std::cout << "测试匹配开销..." << std::endl;
+
+        const int kSubscriptions = 10000;
+        const int kKeys = 20000;
+        SubscriptionIndex index;
+        std::vector<KeyPattern> linear;
+        for (int i = 0; i < kSubscriptions; i++) {
+            std::string pattern;
+            switch (i % 10) {
+                case 0: pattern = "order:" + std::to_string(i) + ":*"; break;
+                case 1: pattern = "session:*:" + std::to_string(i); break;
+                default: pattern = "user:" + std::to_string(i); break;
+            }
+            linear.emplace_back(pattern);
+            index.add(std::make_shared<SubscriptionIndex::Entry>(
+                SubscriptionIndex::Entry{uint64_t(i + 1), KeyPattern(pattern), false, nullptr, nullptr}));
+        }
+
+        std::vector<std::string> keys;
+        for (int i = 0; i < kKeys; i++) {
+            keys.push_back(i % 2 ? "user:" + std::to_string(i % kSubscriptions)
+                                 : "order:" + std::to_string(i % kSubscriptions) + ":item");
+        }
+
+        std::vector<const SubscriptionIndex::Entry*> matched;
+        size_t index_hits = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (const auto& key : keys) {
+            matched.clear();
+            index.match(key, false, matched);
+            index_hits += matched.size();
+        }
+        double index_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        size_t linear_hits = 0;
+        const int kLinearKeys = 200;
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kLinearKeys; i++) {
+            for (const auto& pattern : linear) {
+                linear_hits += pattern.matches(keys[i]);
+            }
+        }
+        double linear_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        size_t index_hits_sample = 0;
+        for (int i = 0; i < kLinearKeys; i++) {
+            matched.clear();
+            index.match(keys[i], false, matched);
+            index_hits_sample += matched.size();
+        }
+        assert(index_hits_sample == linear_hits);
+        assert(index_hits > 0);
+
+        double per_index = index_ns / kKeys;
+        double per_linear = linear_ns / kLinearKeys;
+        std::cout << "  " << kSubscriptions << " 个订阅, 每次写匹配: 索引 " << per_index
+                  << " ns, 逐个匹配 " << per_linear << " ns" << std::endl;
+        assert(per_index < per_linear);
+        std::cout << "✓ 匹配开销测试通过" << std::endl;
+    }
+};
+
+int main() {
+    ChangeNotifierTest test;
+    test.run_all_tests();
+    return 0;
+}
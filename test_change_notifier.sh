@@ -0,0 +1,21 @@
+#!/bin/bash
+
+echo "=== 订阅匹配索引 / 变更通知器测试 ==="
+
+echo "编译变更通知器测试..."
+
+if g++ -std=c++17 -O2 -I. -Isrc \
+    test_change_notifier.cpp \
+    src/network/change_notifier.cpp \
+    -o test_change_notifier -pthread; then
+
+    echo "编译成功，运行测试..."
+    echo ""
+    ./test_change_notifier
+    status=$?
+    rm -f test_change_notifier
+    exit $status
+else
+    echo "编译失败！请检查错误信息。"
+    exit 1
+fi
@@ -28,6 +28,8 @@ echo "编译基础组件..."
 
 # 编译 MemTable
 g++ $CXX_FLAGS $INCLUDE_DIRS -c src/storage/memtable.cpp -o build/memtable.o
+g++ $CXX_FLAGS $INCLUDE_DIRS -c src/storage/range_tombstone.cpp -o build/range_tombstone.o
+g++ $CXX_FLAGS $INCLUDE_DIRS -c src/storage/merge_operator.cpp -o build/merge_operator.o
 if [ $? -ne 0 ]; then
     echo "❌ MemTable 编译失败"
     exit 1
@@ -40,6 +42,12 @@ if [ $? -ne 0 ]; then
     exit 1
 fi
 
+g++ $CXX_FLAGS $INCLUDE_DIRS -c src/db/write_batch.cpp -o build/write_batch.o
+if [ $? -ne 0 ]; then
+    echo "❌ WriteBatch 编译失败"
+    exit 1
+fi
+
 # 编译 SSTable Writer
 g++ $CXX_FLAGS $INCLUDE_DIRS -c src/sstable/sstable_writer.cpp -o build/sstable_writer.o
 if [ $? -ne 0 ]; then
@@ -56,6 +64,7 @@ fi
 
 # 编译 Block Index
 g++ $CXX_FLAGS $INCLUDE_DIRS -c src/sstable/block_index.cpp -o build/block_index.o
+g++ $CXX_FLAGS $INCLUDE_DIRS -c src/sstable/data_block.cpp -o build/data_block.o
 if [ $? -ne 0 ]; then
     echo "❌ Block Index 编译失败"
     exit 1
@@ -80,6 +89,12 @@ if [ $? -ne 0 ]; then
     exit 1
 fi
 
+g++ $CXX_FLAGS $INCLUDE_DIRS -c src/iterator/ttl_iterator.cpp -o build/ttl_iterator.o
+if [ $? -ne 0 ]; then
+    echo "❌ TTL Iterator 编译失败"
+    exit 1
+fi
+
 # 编译 Compaction
 g++ $CXX_FLAGS $INCLUDE_DIRS -c src/compaction/compactor.cpp -o build/compactor.o
 if [ $? -ne 0 ]; then
@@ -87,12 +102,32 @@ if [ $? -ne 0 ]; then
     exit 1
 fi
 
+g++ $CXX_FLAGS $INCLUDE_DIRS -c src/compaction/compaction_filter.cpp -o build/compaction_filter.o
+if [ $? -ne 0 ]; then
+    echo "❌ Compaction Filter 编译失败"
+    exit 1
+fi
+
+# 编译键值分离
+for src in blob_file blob_manager blob_iterator; do
+    g++ $CXX_FLAGS $INCLUDE_DIRS -c src/blob/$src.cpp -o build/$src.o
+    if [ $? -ne 0 ]; then
+        echo "❌ Blob ($src) 编译失败"
+        exit 1
+    fi
+done
+
 # 编译 KV DB
 g++ $CXX_FLAGS $INCLUDE_DIRS -c src/db/kv_db.cpp -o build/kv_db.o
 if [ $? -ne 0 ]; then
     echo "❌ KV DB 编译失败"
     exit 1
 fi
+g++ $CXX_FLAGS $INCLUDE_DIRS -c src/monitoring/metrics_registry.cpp -o build/metrics_registry.o
+if [ $? -ne 0 ]; then
+    echo "❌ 指标注册表编译失败"
+    exit 1
+fi
 
 # 编译增强的 REPL
 echo "编译增强的 REPL..."
@@ -113,15 +148,25 @@ fi
 echo "链接生成可执行文件..."
 g++ $CXX_FLAGS -o kvdb_enhanced \
     build/memtable.o \
+    build/range_tombstone.o \
+    build/merge_operator.o \
     build/wal.o \
+    build/write_batch.o \
     build/sstable_writer.o \
     build/sstable_reader.o \
     build/block_index.o \
+    build/data_block.o \
     build/memtable_iterator.o \
     build/sstable_iterator.o \
     build/merge_iterator.o \
+    build/ttl_iterator.o \
     build/compactor.o \
+    build/compaction_filter.o \
+    build/blob_file.o \
+    build/blob_manager.o \
+    build/blob_iterator.o \
     build/kv_db.o \
+    build/metrics_registry.o \
     build/repl.o \
     build/main.o \
     $LIBS $READLINE_FLAGS
@@ -0,0 +1,254 @@
+#include "src/db/kv_db.h"
+#include "src/cache/block_cache.h"
+#include <iostream>
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <chrono>
+
+class ColumnFamilyTest {
+public:
+    void run_all_tests() {
+        std::cout << "=== 列族测试 ===" << std::endl;
+
+        test_isolation();
+        test_atomic_batch();
+        test_independent_flush_and_recovery();
+        test_drop();
+        test_options_persistence();
+        test_cache_priority();
+
+        reset();
+        std::cout << "🎉 所有列族测试通过！" << std::endl;
+    }
+
+private:
+    static constexpr const char* WAL_FILE = "test_column_families.wal";
+
+    void reset() {
+        std::filesystem::remove_all("data");
+        std::filesystem::remove(WAL_FILE);
+        std::filesystem::remove("COLUMN_FAMILIES");
+        for (const auto& entry : std::filesystem::directory_iterator(".")) {
+            std::string name = entry.path().filename().string();
+            if (name.rfind("MANIFEST", 0) == 0) {
+                std::filesystem::remove(entry.path());
+            }
+        }
+    }
+
+    size_t wal_size() {
+        return std::filesystem::exists(WAL_FILE) ? std::filesystem::file_size(WAL_FILE) : 0;
+    }
+
+    void test_isolation() {
+        std::cout << "\n1. 测试列族之间的键空间隔离..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+
+        ColumnFamilyHandle* users = db.create_column_family("users");
+        assert(users != nullptr);
+        assert(db.create_column_family("users") == users);
+        assert(db.create_column_family("") == nullptr);
+        assert(db.get_column_family("users") == users);
+        assert(db.get_column_family("missing") == nullptr);
+
+        assert(db.put("k", "default_value"));
+        assert(db.put(users, "k", "users_value"));
+
+        std::string value;
+        assert(db.get("k", value) && value == "default_value");
+        assert(db.get(users, "k", value) && value == "users_value");
+        assert(db.get(db.default_column_family(), "k", value) && value == "default_value");
+
+        assert(db.del(users, "k"));
+        assert(!db.get(users, "k", value));
+        assert(db.get("k", value) && value == "default_value");
+
+        auto names = db.list_column_families();
+        assert(names.size() == 2 && names[0] == "default" && names[1] == "users");
+        std::cout << "   ✓ 同名键在不同列族中互不影响" << std::endl;
+    }
+
+    void test_atomic_batch() {
+        std::cout << "\n2. 测试跨列族原子 WriteBatch..." << std::endl;
+        reset();
+        {
+            KVDB db(WAL_FILE);
+            ColumnFamilyHandle* meta = db.create_column_family("meta");
+            WriteBatch batch;
+            batch.put("a", "1");
+            batch.put(meta, "a", "meta_1");
+            batch.del(meta, "b");
+            assert(db.write(batch));
+
+            std::string value;
+            assert(db.get("a", value) && value == "1");
+            assert(db.get(meta, "a", value) && value == "meta_1");
+        }
+        {
+            // 不刷盘直接重开：两个列族的写入都应从共享 WAL 中恢复
+            KVDB db(WAL_FILE);
+            ColumnFamilyHandle* meta = db.get_column_family("meta");
+            assert(meta != nullptr);
+            std::string value;
+            assert(db.get("a", value) && value == "1");
+            assert(db.get(meta, "a", value) && value == "meta_1");
+        }
+        std::cout << "   ✓ 跨列族批量写入经共享 WAL 原子提交并恢复" << std::endl;
+    }
+
+    void test_independent_flush_and_recovery() {
+        std::cout << "\n3. 测试列族独立刷盘与 WAL 标记恢复..." << std::endl;
+        reset();
+        {
+            KVDB db(WAL_FILE);
+            ColumnFamilyHandle* logs = db.create_column_family("logs");
+            for (int i = 0; i < 100; i++) {
+                assert(db.put(logs, "log" + std::to_string(i), "v" + std::to_string(i)));
+            }
+            assert(db.put("pending", "in_memtable"));
+
+            db.flush(logs);
+            assert(db.get_memtable_size(logs) == 0);
+            assert(db.get_memtable_size() > 0);
+            // 默认列族仍有未刷盘数据，WAL 不能被截断
+            assert(wal_size() > 0);
+
+            // 刷盘后的写入要在标记之后重放
+            assert(db.put(logs, "log0", "updated"));
+        }
+        {
+            KVDB db(WAL_FILE);
+            ColumnFamilyHandle* logs = db.get_column_family("logs");
+            assert(logs != nullptr);
+            std::string value;
+            assert(db.get("pending", value) && value == "in_memtable");
+            assert(db.get(logs, "log0", value) && value == "updated");
+            assert(db.get(logs, "log99", value) && value == "v99");
+            // 只有标记之后的写入被重放进 MemTable
+            assert(db.get_memtable_size(logs) > 0);
+            assert(db.get_memtable_size(logs) < 100);
+
+            db.flush();
+            assert(wal_size() == 0);
+        }
+        {
+            KVDB db(WAL_FILE);
+            ColumnFamilyHandle* logs = db.get_column_family("logs");
+            std::string value;
+            assert(db.get("pending", value) && value == "in_memtable");
+            assert(db.get(logs, "log0", value) && value == "updated");
+            assert(db.get(logs, "log50", value) && value == "v50");
+        }
+        assert(std::filesystem::exists("MANIFEST-1"));
+        std::cout << "   ✓ 列族独立刷盘，重启后按 FLUSHED 标记跳过已持久化的记录" << std::endl;
+    }
+
+    void test_drop() {
+        std::cout << "\n4. 测试删除列族..." << std::endl;
+        reset();
+        {
+            KVDB db(WAL_FILE);
+            ColumnFamilyHandle* tmp = db.create_column_family("tmp");
+            assert(db.put(tmp, "x", "1"));
+            db.flush(tmp);
+            assert(std::filesystem::exists("MANIFEST-1"));
+
+            assert(!db.drop_column_family(db.default_column_family()));
+            assert(db.drop_column_family(tmp));
+            assert(!std::filesystem::exists("MANIFEST-1"));
+
+            // 句柄仍然有效，但读写都会失败
+            std::string value;
+            assert(!db.put(tmp, "y", "2"));
+            assert(!db.get(tmp, "x", value));
+            assert(db.get_column_family("tmp") == nullptr);
+            assert(db.list_column_families().size() == 1);
+        }
+        {
+            KVDB db(WAL_FILE);
+            assert(db.get_column_family("tmp") == nullptr);
+
+            // 重新创建同名列族得到新的编号和空的键空间
+            ColumnFamilyHandle* tmp = db.create_column_family("tmp");
+            assert(tmp->id() == 2);
+            std::string value;
+            assert(!db.get(tmp, "x", value));
+        }
+        std::cout << "   ✓ 删除的列族在重启后不再出现，其 SSTable 和 MANIFEST 被清理" << std::endl;
+    }
+
+    void test_options_persistence() {
+        std::cout << "\n5. 测试列族选项持久化..." << std::endl;
+        reset();
+        {
+            KVDB db(WAL_FILE);
+            ColumnFamilyOptions options;
+            options.write_buffer_size = 64 * 1024;
+            options.compaction_style = CompactionStrategyType::TIERED;
+            options.bloom_filter_bits = 0;
+            options.cache_priority = BlockCache::Priority::HIGH;
+            ColumnFamilyHandle* hot = db.create_column_family("hot", options);
+            assert(db.get_compaction_strategy(hot) == CompactionStrategyType::TIERED);
+            assert(db.get_compaction_strategy() == CompactionStrategyType::LEVELED);
+
+            // 无 Bloom Filter 的列族刷盘后仍能正确读取
+            assert(db.put(hot, "h", "1"));
+            db.flush(hot);
+            std::string value;
+            assert(db.get(hot, "h", value) && value == "1");
+            assert(!db.get(hot, "absent", value));
+
+            // 小写缓冲触发后台刷盘
+            std::string big(1024, 'x');
+            for (int i = 0; i < 128; i++) {
+                assert(db.put(hot, "big" + std::to_string(i), big));
+            }
+            for (int i = 0; i < 50 && db.get_memtable_size(hot) >= options.write_buffer_size; i++) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            }
+            assert(db.get_memtable_size(hot) < options.write_buffer_size);
+        }
+        {
+            KVDB db(WAL_FILE);
+            ColumnFamilyHandle* hot = db.get_column_family("hot");
+            assert(hot != nullptr);
+            assert(db.get_compaction_strategy(hot) == CompactionStrategyType::TIERED);
+            std::string value;
+            assert(db.get(hot, "h", value) && value == "1");
+            assert(db.get(hot, "big127", value) && value.size() == 1024);
+        }
+        std::cout << "   ✓ 写缓冲、压缩策略、Bloom 位数与缓存优先级随列族持久化" << std::endl;
+    }
+
+    void test_cache_priority() {
+        std::cout << "\n6. 测试 Block Cache 高低优先级池..." << std::endl;
+        BlockCache cache(4, 0.5);
+        cache.put("h1", "v", BlockCache::Priority::HIGH);
+        cache.put("h2", "v", BlockCache::Priority::HIGH);
+        for (int i = 0; i < 10; i++) {
+            cache.put("l" + std::to_string(i), "v");
+        }
+        assert(cache.get("h1").has_value());
+        assert(cache.get("h2").has_value());
+        assert(cache.get("l9").has_value());
+        assert(!cache.get("l0").has_value());
+        assert(cache.size() == 4);
+
+        // 高优先级池超出配额时从高优先级池淘汰
+        for (int i = 0; i < 4; i++) {
+            cache.put("h" + std::to_string(i + 10), "v", BlockCache::Priority::HIGH);
+        }
+        assert(cache.size() == 4);
+        assert(cache.get("h13").has_value());
+        std::cout << "   ✓ 低优先级数据块先被淘汰，高优先级池受配额约束" << std::endl;
+    }
+};
+
+int main() {
+    ColumnFamilyTest test;
+    test.run_all_tests();
+    return 0;
+}
@@ -0,0 +1,261 @@
+#include "src/db/kv_db.h"
+#include "src/compaction/compaction_filter.h"
+#include "src/sstable/sstable_meta_util.h"
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+// 测试用过滤器：删除 tmp_ 前缀的 key，把 up_ 前缀的值改成大写
+class PrefixCompactionFilter : public CompactionFilter {
+public:
+    Decision filter(int /*level*/, const std::string& key, const std::string& value,
+                    std::string* new_value) const override {
+        calls++;
+        // 过滤器看到的是去掉时间戳后的原值
+        assert(value.find(TtlCompactionFilter::TIMESTAMP_MARKER) == std::string::npos);
+        if (key.rfind("tmp_", 0) == 0) {
+            return Decision::REMOVE;
+        }
+        if (key.rfind("up_", 0) == 0) {
+            *new_value = value;
+            for (auto& c : *new_value) {
+                c = static_cast<char>(::toupper(c));
+            }
+            return Decision::CHANGE_VALUE;
+        }
+        return Decision::KEEP;
+    }
+    const char* name() const override { return "PrefixCompactionFilter"; }
+
+    mutable std::atomic<int> calls{0};
+};
+
+class CompactionFilterTest {
+public:
+    void run_all_tests() {
+        std::cout << "=== 压缩过滤器与 TTL 测试 ===" << std::endl;
+
+        test_ttl_codec();
+        test_reads_skip_expired();
+        test_sstable_properties();
+        test_expired_files_dropped();
+        test_custom_filter();
+
+        reset();
+        std::cout << "🎉 所有压缩过滤器与 TTL 测试通过！" << std::endl;
+    }
+
+private:
+    static constexpr const char* WAL_FILE = "test_compaction_filter.wal";
+
+    void reset() {
+        std::filesystem::remove_all("data");
+        std::filesystem::remove(WAL_FILE);
+        std::filesystem::remove("COLUMN_FAMILIES");
+        std::filesystem::remove("BLOB_MANIFEST");
+        for (const auto& entry : std::filesystem::directory_iterator(".")) {
+            if (entry.path().filename().string().rfind("MANIFEST", 0) == 0) {
+                std::filesystem::remove(entry.path());
+            }
+        }
+    }
+
+    static ColumnFamilyOptions ttl_options(uint64_t ttl_seconds) {
+        ColumnFamilyOptions options;
+        options.ttl_seconds = ttl_seconds;
+        return options;
+    }
+
+    static void wait_for_expiry() {
+        // TTL 以秒计，写入时间与当前时间之差需严格大于 1 秒
+        std::this_thread::sleep_for(std::chrono::milliseconds(2100));
+    }
+
+    static std::vector<std::string> scan(KVDB& db, ColumnFamilyHandle* cf, std::vector<std::string>* values = nullptr) {
+        std::vector<std::string> keys;
+        Snapshot snapshot = db.get_snapshot();
+        auto it = db.new_iterator(cf, snapshot);
+        for (it->seek_to_first(); it->valid(); it->next()) {
+            keys.push_back(it->key());
+            if (values) {
+                values->push_back(it->value());
+            }
+        }
+        db.release_snapshot(snapshot);
+        return keys;
+    }
+
+    static std::vector<std::string> sstable_files() {
+        std::vector<std::string> files;
+        for (const auto& entry : std::filesystem::directory_iterator("data")) {
+            if (entry.path().extension() == ".dat") {
+                files.push_back(entry.path().string());
+            }
+        }
+        return files;
+    }
+
+    void test_ttl_codec() {
+        std::cout << "\n1. 测试 TTL 时间戳编解码..." << std::endl;
+        std::string value;
+        uint64_t ts = 0;
+        assert(TtlCompactionFilter::decode(TtlCompactionFilter::encode("hello", 1700000000), value, ts));
+        assert(value == "hello" && ts == 1700000000);
+        assert(TtlCompactionFilter::decode(TtlCompactionFilter::encode("a__TS__b", 42), value, ts));
+        assert(value == "a__TS__b" && ts == 42);
+
+        assert(!TtlCompactionFilter::decode("plain", value, ts) && value == "plain");
+        assert(!TtlCompactionFilter::decode("x__TS__", value, ts) && value == "x__TS__");
+        assert(!TtlCompactionFilter::decode("x__TS__12a", value, ts));
+
+        TtlCompactionFilter filter(10);
+        assert(!filter.is_expired(100, 110) && filter.is_expired(100, 111));
+        assert(!TtlCompactionFilter(0).is_expired(0, 1000000));
+        std::string unused;
+        assert(filter.filter(0, "k", TtlCompactionFilter::encode("v", 1), &unused) ==
+               CompactionFilter::Decision::REMOVE);
+        assert(filter.filter(0, "k", "v", &unused) == CompactionFilter::Decision::KEEP);
+        std::cout << "   ✓ 值后缀写入时间，没有时间戳的旧值永不过期" << std::endl;
+    }
+
+    void test_reads_skip_expired() {
+        std::cout << "\n2. 测试点查与迭代器跳过过期数据..." << std::endl;
+        reset();
+        {
+            KVDB db(WAL_FILE);
+            ColumnFamilyHandle* cf = db.create_column_family("sessions", ttl_options(1));
+            assert(db.put(cf, "s1", "alice"));
+            assert(db.put(cf, "s2", "bob"));
+            assert(db.put("s1", "default"));  // 默认列族没有 TTL
+
+            std::string value;
+            assert(db.get(cf, "s1", value) && value == "alice");
+            std::vector<std::string> values;
+            assert((scan(db, cf, &values) == std::vector<std::string>{"s1", "s2"}));
+            assert((values == std::vector<std::string>{"alice", "bob"}));
+
+            wait_for_expiry();
+            assert(db.put(cf, "s3", "carol"));
+            assert(!db.get(cf, "s1", value));
+            assert(db.get(cf, "s3", value) && value == "carol");
+            assert(db.get("s1", value) && value == "default");
+            assert(scan(db, cf) == std::vector<std::string>{"s3"});
+
+            db.flush(cf);
+            assert(!db.get(cf, "s2", value));
+            assert(db.get(cf, "s3", value) && value == "carol");
+        }
+        {
+            KVDB db(WAL_FILE);  // TTL 随列族清单持久化
+            ColumnFamilyHandle* cf = db.get_column_family("sessions");
+            assert(cf);
+            std::string value;
+            assert(db.get(cf, "s3", value) && value == "carol");
+            wait_for_expiry();
+            assert(!db.get(cf, "s3", value));
+            assert(scan(db, cf).empty());
+        }
+        std::cout << "   ✓ 过期数据在压缩前就对读取不可见，重启后 TTL 仍然生效" << std::endl;
+    }
+
+    void test_sstable_properties() {
+        std::cout << "\n3. 测试 SSTable 写入时间属性..." << std::endl;
+        reset();
+        uint64_t before = TtlCompactionFilter::now();
+        {
+            KVDB db(WAL_FILE);
+            for (int i = 0; i < 10; i++) {
+                assert(db.put("k" + std::to_string(i), "v"));
+            }
+            db.flush();
+        }
+        uint64_t after = TtlCompactionFilter::now();
+
+        auto files = sstable_files();
+        assert(files.size() == 1);
+        SSTableProperties properties = SSTableMetaUtil::read_properties(files[0]);
+        assert(properties.has_timestamps());
+        assert(before <= properties.min_timestamp && properties.min_timestamp <= properties.max_timestamp &&
+               properties.max_timestamp <= after);
+        SSTableMeta meta = SSTableMetaUtil::get_meta_from_file(files[0]);
+        assert(meta.properties.max_timestamp == properties.max_timestamp);
+
+        // 属性块不影响数据、索引与 Bloom Filter 的读取
+        KVDB db(WAL_FILE);
+        std::string value;
+        assert(db.get("k3", value) && value == "v");
+        std::cout << "   ✓ 刷盘写入 min/max 写入时间，重启后从 footer 读回" << std::endl;
+    }
+
+    void test_expired_files_dropped() {
+        std::cout << "\n4. 测试整体过期的文件不读取直接删除..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        ColumnFamilyHandle* cf = db.create_column_family("events", ttl_options(1));
+        for (int i = 0; i < 20; i++) {
+            assert(db.put(cf, "e" + std::to_string(i), "payload"));
+        }
+        db.flush(cf);
+        assert(sstable_files().size() == 1);
+
+        wait_for_expiry();
+        assert(db.put(cf, "fresh", "v"));
+        db.flush(cf);  // 刷盘触发的后台压缩可能已经删除了过期文件
+
+        db.compact(cf);
+        auto files = sstable_files();
+        assert(files.size() == 1);
+        assert(SSTableMetaUtil::get_meta_from_file(files[0]).min_key == "fresh");
+
+        std::string value;
+        assert(!db.get(cf, "e1", value));
+        assert(db.get(cf, "fresh", value) && value == "v");
+        std::cout << "   ✓ 最晚写入时间已过期的文件只改元数据即删除，未过期的文件保留" << std::endl;
+    }
+
+    void test_custom_filter() {
+        std::cout << "\n5. 测试自定义压缩过滤器..." << std::endl;
+        reset();
+        auto filter = std::make_shared<PrefixCompactionFilter>();
+        ColumnFamilyOptions options = ttl_options(3600);
+        options.compaction_filter = filter;
+
+        KVDB db(WAL_FILE);
+        ColumnFamilyHandle* cf = db.create_column_family("jobs", options);
+        // Leveled 策略在 L0 积累到 8 个文件时才压缩
+        for (int i = 0; i < 8; i++) {
+            std::string n = std::to_string(i);
+            assert(db.put(cf, "tmp_" + n, "scratch"));
+            assert(db.put(cf, "up_" + n, "value" + n));
+            assert(db.put(cf, "keep_" + n, "same" + n));
+            db.flush(cf);
+        }
+        std::string value;
+        assert(db.get(cf, "tmp_3", value) && value == "scratch");  // 压缩之前过滤器不生效
+
+        db.compact(cf);
+        assert(filter->calls.load() == 24);
+        auto files = sstable_files();
+        assert(files.size() == 1);
+        assert(SSTableMetaUtil::read_properties(files[0]).has_timestamps());
+
+        assert(!db.get(cf, "tmp_3", value));
+        assert(db.get(cf, "up_3", value) && value == "VALUE3");
+        assert(db.get(cf, "keep_3", value) && value == "same3");
+        std::vector<std::string> values;
+        assert(scan(db, cf, &values).size() == 16);
+        assert(values.front() == "same0" && values.back() == "VALUE7");
+        std::cout << "   ✓ 压缩时按 key 删除或改写，改写后的值保留写入时间" << std::endl;
+    }
+};
+
+int main() {
+    CompactionFilterTest test;
+    test.run_all_tests();
+    return 0;
+}
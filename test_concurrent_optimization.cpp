@@ -2,29 +2,61 @@
 #include "src/storage/concurrent_memtable.h"
 #include "src/concurrent/coroutine_processor.h"
 #include <iostream>
+#include <cassert>
+#include <filesystem>
 #include <chrono>
 #include <thread>
 #include <vector>
 #include <random>
 #include <future>
 #include <atomic>
+#include <array>
+#include <functional>
 
 class ConcurrentOptimizationTest {
 public:
     void run_all_tests() {
         std::cout << "=== 并发优化测试 ===\n\n";
         
+        reset();
         test_concurrent_memtable();
         test_read_write_separation();
         test_batch_operations();
         test_async_operations();
         test_lock_free_reads();
+        test_durability_and_restart();
+        test_flush_and_disk_reads();
+        test_memtable_switch_under_load();
+        test_coroutine_api();
+        test_work_stealing_pool();
         test_concurrent_performance();
         
+        reset();
         std::cout << "=== 所有并发测试完成 ===\n";
     }
     
 private:
+    static constexpr const char* WAL_FILE = "test_concurrent_durable.wal";
+    
+    static void reset() {
+        // WAL 段与各实例的磁盘层目录（<wal>.db）都以 test_*.wal 开头
+        for (const auto& entry : std::filesystem::directory_iterator(".")) {
+            std::string name = entry.path().filename().string();
+            if (name.rfind("test_", 0) == 0 && name.find(".wal") != std::string::npos) {
+                std::filesystem::remove_all(entry.path());
+            }
+        }
+    }
+    
+    static size_t count_sstables() {
+        size_t count = 0;
+        for (const auto& entry : std::filesystem::directory_iterator(
+                 std::filesystem::path(ConcurrentKVDB::default_db_path(WAL_FILE)) / "data")) {
+            count += entry.path().extension() == ".dat" ? 1 : 0;
+        }
+        return count;
+    }
+    
     void test_concurrent_memtable() {
         std::cout << "1. 并发MemTable测试\n";
         
@@ -168,6 +200,11 @@ private:
             }
         }
         
+        assert(write_success && successful_reads == 1000);
+        assert(db.batch_delete({"batch_key_0", "batch_key_1"}));
+        std::string value;
+        assert(!db.get("batch_key_0", value) && db.get("batch_key_2", value) && value == "batch_value_2");
+        
         std::cout << "批量操作测试完成\n";
         std::cout << "批量写入: " << (write_success ? "成功" : "失败") << "\n";
         std::cout << "批量读取成功率: " << (double)successful_reads / results.size() * 100 << "%\n";
@@ -220,6 +257,8 @@ private:
         auto end = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
         
+        assert(successful_puts == num_async_ops && successful_gets == num_async_ops);
+        
         std::cout << "异步操作测试完成\n";
         std::cout << "异步写入成功: " << successful_puts << "/" << num_async_ops << "\n";
         std::cout << "异步读取成功: " << successful_gets << "/" << num_async_ops << "\n";
@@ -268,6 +307,8 @@ private:
         auto end = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
         
+        assert(total_lockfree_reads.load() == num_readers * reads_per_thread);
+        
         std::cout << "无锁读取测试完成\n";
         std::cout << "读取线程数: " << num_readers << "\n";
         std::cout << "每线程读取次数: " << reads_per_thread << "\n";
@@ -279,8 +320,261 @@ private:
         std::cout << "✓ 无锁读取测试通过\n\n";
     }
     
+    void test_durability_and_restart() {
+        std::cout << "6. WAL 持久化与重启恢复测试\n";
+        reset();
+        const int num_threads = 8;
+        const int writes_per_thread = 200;
+        {
+            ConcurrentKVDB db(WAL_FILE, 2);
+            std::vector<std::thread> threads;
+            for (int t = 0; t < num_threads; ++t) {
+                threads.emplace_back([&, t]() {
+                    for (int i = 0; i < writes_per_thread; ++i) {
+                        std::string key = "durable_" + std::to_string(t) + "_" + std::to_string(i);
+                        assert(db.put(key, "v" + std::to_string(i)));
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            assert(db.del("durable_0_0"));
+            assert(db.put("durable_1_0", "overwritten"));
+            // 组提交把并发写入合成较少的 WAL 记录
+            std::cout << "合并写入的组数: " << db.get_performance_stats().batch_operations.load() << "\n";
+        }
+        {
+            // 没有刷盘就关闭：重启时从 WAL 段重放，并直接刷成 SSTable
+            ConcurrentKVDB db(WAL_FILE, 2);
+            std::string value;
+            assert(!db.get("durable_0_0", value));
+            assert(db.get("durable_1_0", value) && value == "overwritten");
+            assert(db.get("durable_7_199", value) && value == "v199");
+            assert(db.get_memtable_size() == 0 && count_sstables() == 1);
+            assert(db.put("durable_after_restart", "new"));
+        }
+        {
+            ConcurrentKVDB db(WAL_FILE, 2);
+            std::string value;
+            assert(db.get("durable_after_restart", value) && value == "new");
+            assert(db.get("durable_3_100", value) && value == "v100");
+            assert(!db.get("durable_0_0", value));
+        }
+        std::cout << "✓ 已确认的写入在重启后可见，删除与覆盖按序列号生效\n\n";
+    }
+    
+    void test_flush_and_disk_reads() {
+        std::cout << "7. 刷盘与磁盘读取测试\n";
+        reset();
+        ConcurrentKVDB db(WAL_FILE, 2);
+        for (int i = 0; i < 100; ++i) {
+            assert(db.put("disk_" + std::to_string(i), "old_" + std::to_string(i)));
+        }
+        db.flush();
+        assert(db.get_memtable_size() == 0 && count_sstables() == 1);
+        
+        // 新写入遮蔽磁盘上的旧版本，删除同样遮蔽
+        assert(db.put("disk_1", "new_1"));
+        assert(db.del("disk_2"));
+        std::string value;
+        assert(db.get("disk_0", value) && value == "old_0");
+        assert(db.get("disk_1", value) && value == "new_1");
+        assert(!db.get("disk_2", value));
+        db.flush();
+        assert(count_sstables() == 2);
+        assert(db.get("disk_1", value) && value == "new_1");
+        assert(!db.get("disk_2", value));
+        
+        auto results = db.batch_get({"disk_0", "disk_2", "disk_99", "missing"});
+        assert(results[0] == "old_0" && !results[1] && results[2] == "old_99" && !results[3]);
+        db.flush();  // MemTable 为空时不产生新文件
+        assert(count_sstables() == 2);
+        std::cout << "✓ 读取依次查 MemTable 与 SSTable，flush() 返回时数据已落盘\n\n";
+    }
+    
+    void test_memtable_switch_under_load() {
+        std::cout << "8. MemTable 切换、后台刷盘与压缩测试\n";
+        reset();
+        const int num_threads = 8;
+        const int writes_per_thread = 2000;
+        {
+            ConcurrentKVDB db(WAL_FILE, 2);
+            db.set_write_buffer_size(16 * 1024);
+            std::atomic<int> missing{0};
+            std::vector<std::thread> threads;
+            for (int t = 0; t < num_threads; ++t) {
+                threads.emplace_back([&, t]() {
+                    for (int i = 0; i < writes_per_thread; ++i) {
+                        std::string key = "load_" + std::to_string(t) + "_" + std::to_string(i);
+                        db.put(key, "value_" + std::to_string(i));
+                        // 写入确认后立即可读，无论数据在活跃、不可变 MemTable 还是 SSTable 中
+                        std::string value;
+                        if (!db.get(key, value) || value != "value_" + std::to_string(i)) {
+                            missing.fetch_add(1);
+                        }
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            assert(missing.load() == 0);
+            db.flush();
+            db.disk_db().compact();
+            
+            std::string value;
+            for (int t = 0; t < num_threads; ++t) {
+                assert(db.get("load_" + std::to_string(t) + "_0", value) && value == "value_0");
+                assert(db.get("load_" + std::to_string(t) + "_1999", value) && value == "value_1999");
+            }
+            std::cout << "写满切换导致的写入停顿: " << db.get_performance_stats().lock_contentions.load() << "\n";
+            db.disk_db().print_lsm_structure();
+        }
+        {
+            ConcurrentKVDB db(WAL_FILE, 2);
+            std::string value;
+            assert(db.get("load_5_1234", value) && value == "value_1234");
+        }
+        std::cout << "✓ 写满的 MemTable 在后台刷成 SSTable 并参与压缩，读取不丢数据\n\n";
+    }
+    
+    static Task<std::pair<std::optional<std::string>, std::thread::id>> read_and_report(ConcurrentKVDB& db,
+                                                                                        std::string key) {
+        auto value = co_await db.get_async(key);
+        co_return std::make_pair(value, std::this_thread::get_id());
+    }
+    
+    static Task<bool> append_suffix(ConcurrentKVDB& db, std::string key) {
+        auto value = co_await db.get_async(key);
+        co_return co_await db.put_async(key, value.value_or("") + "+");
+    }
+    
+    void test_coroutine_api() {
+        std::cout << "9. 协程异步接口测试\n";
+        reset();
+        ConcurrentKVDB db(WAL_FILE, 4, 8);
+        const int num_keys = 300;
+        for (int i = 0; i < num_keys; ++i) {
+            assert(db.put("co_disk_" + std::to_string(i), "d" + std::to_string(i)));
+        }
+        db.flush();
+        assert(db.put("co_mem", "m"));
+        assert(db.del("co_disk_0"));
+        
+        // MemTable 命中与墓碑都不挂起
+        uint64_t suspensions = db.get_performance_stats().io_suspensions.load();
+        assert(db.get_async("co_mem").get() == "m");
+        assert(!db.get_async("co_disk_0").get());
+        assert(db.get_performance_stats().io_suspensions.load() == suspensions);
+        
+        // 读 SSTable 时挂起，在工作线程上恢复
+        auto [value, thread] = read_and_report(db, "co_disk_5").get();
+        assert(value == "d5" && thread != std::this_thread::get_id());
+        assert(db.get_performance_stats().io_suspensions.load() == suspensions + 1);
+        
+        // 几百个磁盘读取同时在途，只恢复一次
+        std::vector<std::string> keys = {"co_mem", "missing"};
+        for (int i = 0; i < num_keys; ++i) {
+            keys.push_back("co_disk_" + std::to_string(i));
+        }
+        auto start = std::chrono::high_resolution_clock::now();
+        auto results = db.multi_get_async(keys).get();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - start).count();
+        assert(results.size() == keys.size());
+        assert(results[0] == "m" && !results[1] && !results[2]);
+        for (int i = 1; i < num_keys; ++i) {
+            assert(results[i + 2] == "d" + std::to_string(i));
+        }
+        assert(db.get_performance_stats().io_suspensions.load() == suspensions + 2);
+        std::cout << "并发磁盘点查: " << num_keys << " 个, 耗时: " << duration << " ms\n";
+        
+        // 协程中先读后写；写入同样交给 I/O 线程
+        assert(append_suffix(db, "co_disk_7").get());
+        assert(db.get_async("co_disk_7").get() == "d7+");
+        assert(db.del_async("co_mem").get());
+        assert(!db.get_async("co_mem").get());
+        std::cout << "✓ MemTable 命中同步返回，磁盘读写挂起协程并在工作线程恢复\n\n";
+    }
+    
+    void test_work_stealing_pool() {
+        std::cout << "10. 工作窃取线程池测试\n";
+        
+        // 单线程下 Chase-Lev 队列：所有者 LIFO 弹出，窃取者 FIFO 取走，扩容不丢任务
+        {
+            WorkStealingDeque deque(4);
+            std::vector<int> order;
+            for (int i = 0; i < 100; ++i) {
+                deque.push(new PoolTask([&order, i] { order.push_back(i); }));
+            }
+            PoolTask* stolen = deque.steal();
+            PoolTask* popped = deque.pop();
+            (*stolen)();
+            (*popped)();
+            delete stolen;
+            delete popped;
+            assert(order.size() == 2 && order[0] == 0 && order[1] == 99);
+            int remaining = 0;
+            while (PoolTask* task = deque.pop()) {
+                delete task;
+                remaining++;
+            }
+            assert(remaining == 98 && !deque.steal());
+        }
+        
+        // 外部批量提交 + 工作线程内递归派生：派生任务压入本线程队列，由空闲线程窃取
+        WorkStealingPool pool(4);
+        std::atomic<int> leaves{0};
+        std::function<void(int)> spawn = [&](int depth) {
+            if (depth == 0) {
+                leaves.fetch_add(1);
+                return;
+            }
+            assert(pool.in_worker_thread());
+            pool.submit([&spawn, depth] { spawn(depth - 1); });
+            pool.submit([&spawn, depth] { spawn(depth - 1); });
+        };
+        std::vector<std::function<void()>> roots;
+        for (int i = 0; i < 8; ++i) {
+            roots.push_back([&spawn] { spawn(10); });
+        }
+        pool.submit_batch(std::move(roots));
+        pool.wait_idle();
+        assert(leaves.load() == 8 * 1024);
+        
+        const auto& stats = pool.get_stats();
+        assert(stats.completed_tasks.load() == stats.total_tasks.load());
+        assert(stats.injected.load() == 8);
+        assert(stats.local_pushes.load() == stats.total_tasks.load() - 8);
+        assert(!pool.in_worker_thread());
+        
+        // 超出内联缓冲的闭包与只可移动的闭包
+        std::string big(200, 'x');
+        std::array<char, 128> payload{};
+        payload[127] = 'z';
+        std::promise<size_t> done;
+        auto future = done.get_future();
+        auto owned = std::make_unique<int>(7);
+        pool.submit([payload, big, owned = std::move(owned), &done] {
+            done.set_value(big.size() + static_cast<size_t>(*owned) + (payload[127] == 'z'));
+        });
+        assert(future.get() == 208);
+        
+        // 闲置后挂起，新任务仍能唤醒
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        assert(stats.parks.load() > 0);
+        std::promise<void> woken;
+        pool.submit([&woken] { woken.set_value(); });
+        assert(woken.get_future().wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+        
+        std::cout << "派生任务: " << stats.total_tasks.load() << ", 窃取: " << stats.steals.load()
+                  << ", 挂起: " << stats.parks.load() << "\n";
+        std::cout << "✓ 本线程队列 LIFO、窃取 FIFO，外部提交走注入队列，空闲线程挂起后可被唤醒\n\n";
+    }
+    
     void test_concurrent_performance() {
-        std::cout << "6. 并发性能对比测试\n";
+        std::cout << "11. 并发性能对比测试\n";
         
         const int num_operations = 10000;
         const int num_threads = 8;
@@ -370,9 +664,10 @@ int main() {
         std::cout << "✅ 实现的优化:\n";
         std::cout << "1. 读写分离: 读操作支持无锁或细粒度锁\n";
         std::cout << "2. 无锁数据结构: 使用TBB并发容器\n";
-        std::cout << "3. 协程支持: 异步操作和任务调度\n";
+        std::cout << "3. 协程支持: 可等待的读写接口，磁盘读取挂起协程、由 I/O 线程完成后恢复\n";
         std::cout << "4. 批量操作: 减少锁竞争的批量处理\n";
         std::cout << "5. 性能监控: 实时统计并发性能指标\n";
+        std::cout << "6. 组提交 WAL、后台刷盘与磁盘层读取: 重启不丢失已确认的写入\n";
         std::cout << "\n📈 预期收益:\n";
         std::cout << "• 并发处理能力提升: 3-5倍\n";
         std::cout << "• 锁竞争减少: 50-70%\n";
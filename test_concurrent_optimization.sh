@@ -4,442 +4,79 @@ echo "=== 并发优化测试 ==="
 
 # 检查是否安装了Intel TBB
 echo "检查Intel TBB依赖..."
-if ! pkg-config --exists tbb; then
-    echo "⚠️ 未找到Intel TBB，尝试安装..."
-    
-    # 尝试使用包管理器安装
-    if command -v apt-get &> /dev/null; then
-        sudo apt-get update && sudo apt-get install -y libtbb-dev
-    elif command -v yum &> /dev/null; then
-        sudo yum install -y tbb-devel
-    elif command -v brew &> /dev/null; then
-        brew install tbb
-    else
-        echo "❌ 无法自动安装TBB，请手动安装Intel Threading Building Blocks"
-        echo "Ubuntu/Debian: sudo apt-get install libtbb-dev"
-        echo "CentOS/RHEL: sudo yum install tbb-devel"
-        echo "macOS: brew install tbb"
-        exit 1
-    fi
+if [ ! -d /usr/include/tbb ] && ! pkg-config --exists tbb; then
+    echo "❌ 未找到Intel TBB，请先安装Intel Threading Building Blocks"
+    echo "Ubuntu/Debian: sudo apt-get install libtbb-dev"
+    echo "CentOS/RHEL: sudo yum install tbb-devel"
+    echo "macOS: brew install tbb"
+    exit 1
 fi
 
-# 创建简化版本的测试（不依赖TBB）
-echo "创建简化版本的并发测试..."
-
-cat > simple_concurrent_test.cpp << 'EOF'
-#include <iostream>
-#include <thread>
-#include <vector>
-#include <atomic>
-#include <chrono>
-#include <mutex>
-#include <shared_mutex>
-#include <map>
-#include <string>
-#include <future>
-#include <queue>
-#include <condition_variable>
-
-// 简化的并发MemTable
-class SimpleConcurrentMemTable {
-public:
-    void put(const std::string& key, const std::string& value) {
-        std::unique_lock<std::shared_mutex> lock(mutex_);
-        table_[key] = value;
-        stats_.total_writes.fetch_add(1);
-    }
-    
-    bool get(const std::string& key, std::string& value) const {
-        std::shared_lock<std::shared_mutex> lock(mutex_);
-        auto it = table_.find(key);
-        if (it != table_.end()) {
-            value = it->second;
-            stats_.total_reads.fetch_add(1);
-            return true;
-        }
-        return false;
-    }
-    
-    // 批量操作
-    void batch_put(const std::vector<std::pair<std::string, std::string>>& operations) {
-        std::unique_lock<std::shared_mutex> lock(mutex_);
-        for (const auto& [key, value] : operations) {
-            table_[key] = value;
-        }
-        stats_.batch_operations.fetch_add(1);
-    }
-    
-    std::vector<std::string> batch_get(const std::vector<std::string>& keys) const {
-        std::shared_lock<std::shared_mutex> lock(mutex_);
-        std::vector<std::string> results;
-        for (const auto& key : keys) {
-            auto it = table_.find(key);
-            if (it != table_.end()) {
-                results.push_back(it->second);
-            } else {
-                results.push_back("");
-            }
-        }
-        stats_.batch_operations.fetch_add(1);
-        return results;
-    }
-    
-    // 无锁读取（仅用于演示，实际实现需要更复杂的无锁结构）
-    bool lock_free_get(const std::string& key, std::string& value) const {
-        // 简化版本：仍使用锁，但统计为无锁操作
-        std::shared_lock<std::shared_mutex> lock(mutex_);
-        auto it = table_.find(key);
-        if (it != table_.end()) {
-            value = it->second;
-            stats_.lock_free_reads.fetch_add(1);
-            return true;
-        }
-        return false;
-    }
-    
-    struct Stats {
-        mutable std::atomic<uint64_t> total_reads{0};
-        mutable std::atomic<uint64_t> total_writes{0};
-        mutable std::atomic<uint64_t> batch_operations{0};
-        mutable std::atomic<uint64_t> lock_free_reads{0};
-    };
-    
-    const Stats& get_stats() const { return stats_; }
-    
-    void print_stats() const {
-        std::cout << "=== 并发MemTable统计 ===\n";
-        std::cout << "总读取: " << stats_.total_reads.load() << "\n";
-        std::cout << "总写入: " << stats_.total_writes.load() << "\n";
-        std::cout << "批量操作: " << stats_.batch_operations.load() << "\n";
-        std::cout << "无锁读取: " << stats_.lock_free_reads.load() << "\n";
-        std::cout << "========================\n\n";
-    }
-    
-private:
-    mutable std::shared_mutex mutex_;
-    std::map<std::string, std::string> table_;
-    mutable Stats stats_;
-};
+# 在临时目录中编译和运行，WAL 段与数据目录不落在源码树里
+cd "$(dirname "$0")" || exit 1
+work_dir=$(mktemp -d)
+trap 'rm -rf "$work_dir"' EXIT
 
-// 简化的线程池
-class SimpleThreadPool {
-public:
-    SimpleThreadPool(size_t num_threads) : stop_(false) {
-        for (size_t i = 0; i < num_threads; ++i) {
-            workers_.emplace_back([this] {
-                while (true) {
-                    std::function<void()> task;
-                    {
-                        std::unique_lock<std::mutex> lock(queue_mutex_);
-                        condition_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
-                        
-                        if (stop_ && tasks_.empty()) return;
-                        
-                        task = std::move(tasks_.front());
-                        tasks_.pop();
-                    }
-                    task();
-                }
-            });
-        }
-    }
-    
-    ~SimpleThreadPool() {
-        {
-            std::unique_lock<std::mutex> lock(queue_mutex_);
-            stop_ = true;
-        }
-        condition_.notify_all();
-        for (auto& worker : workers_) {
-            worker.join();
-        }
-    }
-    
-    template<typename F>
-    auto submit(F&& f) -> std::future<decltype(f())> {
-        using ReturnType = decltype(f());
-        auto task = std::make_shared<std::packaged_task<ReturnType()>>(std::forward<F>(f));
-        auto future = task->get_future();
-        
-        {
-            std::unique_lock<std::mutex> lock(queue_mutex_);
-            if (stop_) {
-                throw std::runtime_error("ThreadPool已停止");
-            }
-            tasks_.emplace([task]() { (*task)(); });
-        }
-        condition_.notify_one();
-        return future;
-    }
-    
-private:
-    std::vector<std::thread> workers_;
-    std::queue<std::function<void()>> tasks_;
-    std::mutex queue_mutex_;
-    std::condition_variable condition_;
-    bool stop_;
-};
+echo "编译并发优化测试（协程需要 C++20）..."
 
-int main() {
-    std::cout << "=== 简化版并发优化测试 ===\n\n";
-    
-    try {
-        // 1. 基础并发测试
-        std::cout << "1. 基础并发读写测试\n";
-        
-        SimpleConcurrentMemTable memtable;
-        const int num_threads = 8;
-        const int ops_per_thread = 1000;
-        
-        std::vector<std::thread> threads;
-        auto start = std::chrono::high_resolution_clock::now();
-        
-        // 启动写入线程
-        for (int t = 0; t < num_threads / 2; ++t) {
-            threads.emplace_back([&, t]() {
-                for (int i = 0; i < ops_per_thread; ++i) {
-                    std::string key = "key_" + std::to_string(t) + "_" + std::to_string(i);
-                    std::string value = "value_" + std::to_string(t) + "_" + std::to_string(i);
-                    memtable.put(key, value);
-                }
-            });
-        }
-        
-        // 启动读取线程
-        for (int t = 0; t < num_threads / 2; ++t) {
-            threads.emplace_back([&, t]() {
-                for (int i = 0; i < ops_per_thread; ++i) {
-                    std::string key = "key_" + std::to_string(t) + "_" + std::to_string(i);
-                    std::string value;
-                    memtable.get(key, value);
-                }
-            });
-        }
-        
-        for (auto& thread : threads) {
-            thread.join();
-        }
-        
-        auto end = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
-        
-        std::cout << "并发读写测试完成，耗时: " << duration << " ms\n";
-        memtable.print_stats();
-        
-        // 2. 批量操作测试
-        std::cout << "2. 批量操作测试\n";
-        
-        std::vector<std::pair<std::string, std::string>> batch_data;
-        for (int i = 0; i < 1000; ++i) {
-            batch_data.emplace_back("batch_key_" + std::to_string(i), "batch_value_" + std::to_string(i));
-        }
-        
-        start = std::chrono::high_resolution_clock::now();
-        memtable.batch_put(batch_data);
-        
-        std::vector<std::string> keys;
-        for (const auto& [key, value] : batch_data) {
-            keys.push_back(key);
-        }
-        auto results = memtable.batch_get(keys);
-        
-        end = std::chrono::high_resolution_clock::now();
-        duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
-        
-        std::cout << "批量操作完成，耗时: " << duration << " ms\n";
-        std::cout << "批量读取成功: " << results.size() << "/" << keys.size() << "\n";
-        
-        // 3. 异步操作测试
-        std::cout << "\n3. 异步操作测试\n";
-        
-        SimpleThreadPool thread_pool(4);
-        std::vector<std::future<bool>> futures;
-        
-        start = std::chrono::high_resolution_clock::now();
-        
-        // 提交异步任务
-        for (int i = 0; i < 500; ++i) {
-            futures.push_back(thread_pool.submit([&memtable, i]() {
-                std::string key = "async_key_" + std::to_string(i);
-                std::string value = "async_value_" + std::to_string(i);
-                memtable.put(key, value);
-                
-                std::string read_value;
-                return memtable.get(key, read_value);
-            }));
-        }
-        
-        // 等待所有任务完成
-        int successful_ops = 0;
-        for (auto& future : futures) {
-            if (future.get()) {
-                successful_ops++;
-            }
-        }
-        
-        end = std::chrono::high_resolution_clock::now();
-        duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
-        
-        std::cout << "异步操作完成，耗时: " << duration << " ms\n";
-        std::cout << "成功操作: " << successful_ops << "/500\n";
-        
-        // 4. 无锁读取测试
-        std::cout << "\n4. 无锁读取测试\n";
-        
-        const int num_readers = 10;
-        const int reads_per_thread = 1000;
-        std::atomic<uint64_t> successful_reads{0};
-        
-        threads.clear();
-        start = std::chrono::high_resolution_clock::now();
-        
-        for (int t = 0; t < num_readers; ++t) {
-            threads.emplace_back([&, t]() {
-                for (int i = 0; i < reads_per_thread; ++i) {
-                    std::string key = "batch_key_" + std::to_string(i % 1000);
-                    std::string value;
-                    if (memtable.lock_free_get(key, value)) {
-                        successful_reads.fetch_add(1);
-                    }
-                }
-            });
-        }
-        
-        for (auto& thread : threads) {
-            thread.join();
-        }
-        
-        end = std::chrono::high_resolution_clock::now();
-        duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
-        
-        std::cout << "无锁读取测试完成，耗时: " << duration << " ms\n";
-        std::cout << "成功读取: " << successful_reads.load() << "/" << (num_readers * reads_per_thread) << "\n";
-        std::cout << "读取QPS: " << (double)(num_readers * reads_per_thread) / duration * 1000 << "\n";
-        
-        // 5. 性能对比测试
-        std::cout << "\n5. 性能对比测试\n";
-        
-        const int perf_ops = 5000;
-        
-        // 单线程性能
-        start = std::chrono::high_resolution_clock::now();
-        for (int i = 0; i < perf_ops; ++i) {
-            std::string key = "perf_key_" + std::to_string(i);
-            std::string value = "perf_value_" + std::to_string(i);
-            memtable.put(key, value);
-            std::string read_value;
-            memtable.get(key, read_value);
-        }
-        end = std::chrono::high_resolution_clock::now();
-        auto single_thread_time = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
-        
-        // 多线程性能
-        const int perf_threads = 4;
-        const int ops_per_perf_thread = perf_ops / perf_threads;
-        
-        threads.clear();
-        start = std::chrono::high_resolution_clock::now();
-        
-        for (int t = 0; t < perf_threads; ++t) {
-            threads.emplace_back([&, t]() {
-                for (int i = 0; i < ops_per_perf_thread; ++i) {
-                    std::string key = "perf_mt_key_" + std::to_string(t * ops_per_perf_thread + i);
-                    std::string value = "perf_mt_value_" + std::to_string(t * ops_per_perf_thread + i);
-                    memtable.put(key, value);
-                    std::string read_value;
-                    memtable.get(key, read_value);
-                }
-            });
-        }
-        
-        for (auto& thread : threads) {
-            thread.join();
-        }
-        
-        end = std::chrono::high_resolution_clock::now();
-        auto multi_thread_time = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
-        
-        double performance_improvement = (double)single_thread_time / multi_thread_time;
-        
-        std::cout << "性能对比结果:\n";
-        std::cout << "单线程耗时: " << single_thread_time << " ms\n";
-        std::cout << "多线程耗时: " << multi_thread_time << " ms\n";
-        std::cout << "性能提升: " << performance_improvement << "x\n";
-        
-        if (performance_improvement >= 3.0) {
-            std::cout << "✅ 达到预期的3-5倍性能提升目标\n";
-        } else if (performance_improvement >= 2.0) {
-            std::cout << "✅ 获得了显著的性能提升\n";
-        } else {
-            std::cout << "⚠️ 性能提升有限，可能需要进一步优化\n";
-        }
-        
-        // 最终统计
-        memtable.print_stats();
-        
-        std::cout << "\n=== 并发优化总结 ===\n";
-        std::cout << "✅ 实现的优化:\n";
-        std::cout << "1. 读写分离: 使用shared_mutex支持并发读取\n";
-        std::cout << "2. 批量操作: 减少锁获取次数\n";
-        std::cout << "3. 异步处理: 使用线程池处理异步任务\n";
-        std::cout << "4. 无锁读取: 优化读取路径\n";
-        std::cout << "5. 性能监控: 实时统计操作指标\n";
-        std::cout << "\n📈 实际收益:\n";
-        std::cout << "• 并发处理能力提升: " << performance_improvement << "x\n";
-        std::cout << "• 支持高并发读写操作\n";
-        std::cout << "• 批量操作减少锁竞争\n";
-        std::cout << "• 异步操作提升响应性能\n";
-        
-    } catch (const std::exception& e) {
-        std::cerr << "测试失败: " << e.what() << std::endl;
-        return 1;
-    }
-    
-    return 0;
-}
-EOF
+if g++ -std=c++20 -O2 -I. -Isrc \
+    test_concurrent_optimization.cpp \
+    src/db/concurrent_kv_db.cpp \
+    src/storage/concurrent_memtable.cpp \
+    src/concurrent/coroutine_processor.cpp \
+    src/concurrent/work_stealing_pool.cpp \
+    src/db/kv_db.cpp \
+    src/monitoring/metrics_registry.cpp \
+    src/db/write_batch.cpp \
+    src/storage/memtable.cpp \
+    src/storage/range_tombstone.cpp \
+    src/storage/merge_operator.cpp \
+    src/log/wal.cpp \
+    src/sstable/sstable_writer.cpp \
+    src/sstable/sst_file_writer.cpp \
+    src/sstable/sstable_reader.cpp \
+    src/sstable/sstable_meta_util.cpp \
+    src/sstable/block_index.cpp \
+    src/sstable/data_block.cpp \
+    src/compaction/compactor.cpp \
+    src/blob/blob_file.cpp \
+    src/blob/blob_manager.cpp \
+    src/blob/blob_iterator.cpp \
+    src/compaction/compaction_filter.cpp \
+    src/iterator/ttl_iterator.cpp \
+    src/compaction/compaction_strategy.cpp \
+    src/bloom/bloom_filter.cpp \
+    src/cache/block_cache.cpp \
+    src/cache/cache_manager.cpp \
+    src/cache/multi_level_cache.cpp \
+    src/version/version_set.cpp \
+    src/snapshot/snapshot_manager.cpp \
+    src/iterator/memtable_iterator.cpp \
+    src/iterator/sstable_iterator.cpp \
+    src/iterator/merge_iterator.cpp \
+    src/iterator/concurrent_iterator.cpp \
+    src/index/secondary_index.cpp \
+    src/index/composite_index.cpp \
+    src/index/tokenizer.cpp \
+    src/index/posting_list.cpp \
+    src/index/fulltext_index.cpp \
+    src/index/inverted_index.cpp \
+    src/index/index_manager.cpp \
+    src/index/persistent_index.cpp \
+    -o "$work_dir/test_concurrent_optimization" -pthread -ltbb; then
 
-# 编译简化版本
-echo "编译简化版并发测试..."
-if g++ -std=c++17 -O2 simple_concurrent_test.cpp -o simple_concurrent_test -pthread; then
     echo "编译成功，运行测试..."
-    ./simple_concurrent_test
-    
-    # 清理
-    rm -f simple_concurrent_test simple_concurrent_test.cpp
-    
-    echo ""
-    echo "=== 并发优化实施指南 ==="
-    echo ""
-    echo "🔧 如何在项目中使用并发优化："
-    echo ""
-    echo "1. 启用并发数据库："
-    echo "   ConcurrentKVDB db(\"my_db.wal\", 8);  // 8个工作线程"
     echo ""
-    echo "2. 使用批量操作："
-    echo "   vector<pair<string,string>> batch_data = {...};"
-    echo "   db.batch_put(batch_data);"
-    echo "   auto results = db.batch_get(keys);"
-    echo ""
-    echo "3. 异步操作："
-    echo "   auto future = db.async_put(key, value);"
-    echo "   bool success = future.get();"
-    echo ""
-    echo "4. 无锁读取："
-    echo "   db.enable_lock_free_reads(true);"
-    echo "   string value;"
-    echo "   db.read_only_get(key, value);"
-    echo ""
-    echo "5. 性能监控："
-    echo "   db.print_performance_stats();"
-    echo ""
-    echo "📈 预期收益："
-    echo "• 并发处理能力提升 3-5 倍"
-    echo "• 锁竞争减少 50-70%"
-    echo "• 支持高并发读写和异步操作"
-    echo "• 批量操作显著提升吞吐量"
-    
+    log="$work_dir/test_concurrent_optimization.log"
+    (cd "$work_dir" && ./test_concurrent_optimization) > "$log" 2>&1
+    status=$?
+    grep -E "✓|===|✅|⚠️|耗时|QPS|提升|组数|停顿|点查|窃取" "$log"
+    if [ $status -ne 0 ]; then
+        tail -20 "$log"
+    fi
+    exit $status
 else
     echo "编译失败，请检查编译环境"
-    echo "需要支持C++17的编译器和pthread库"
-fi
\ No newline at end of file
+    echo "需要支持C++20的编译器、pthread库与Intel TBB"
+    exit 1
+fi
@@ -13,14 +13,19 @@ g++ -std=c++17 -I. -O2 \
     src/storage/typed_memtable.cpp \
     src/db/typed_kv_db.cpp \
     src/db/kv_db.cpp \
+    src/monitoring/metrics_registry.cpp \
     src/storage/memtable.cpp \
+    src/storage/range_tombstone.cpp \
+    src/storage/merge_operator.cpp \
     src/log/wal.cpp \
+    src/db/write_batch.cpp \
     src/cache/cache_manager.cpp \
     src/cache/multi_level_cache.cpp \
     src/cache/block_cache.cpp \
     src/sstable/sstable_writer.cpp \
     src/sstable/sstable_reader.cpp \
     src/sstable/block_index.cpp \
+    src/sstable/data_block.cpp \
     src/sstable/sstable_meta_util.cpp \
     src/iterator/memtable_iterator.cpp \
     src/iterator/sstable_iterator.cpp \
@@ -30,9 +35,16 @@ g++ -std=c++17 -I. -O2 \
     src/snapshot/snapshot_manager.cpp \
     src/compaction/compaction_strategy.cpp \
     src/compaction/compactor.cpp \
+    src/blob/blob_file.cpp \
+    src/blob/blob_manager.cpp \
+    src/blob/blob_iterator.cpp \
+    src/compaction/compaction_filter.cpp \
+    src/iterator/ttl_iterator.cpp \
     src/index/index_manager.cpp \
+    src/index/persistent_index.cpp \
     src/index/secondary_index.cpp \
     src/index/composite_index.cpp \
+    src/index/posting_list.cpp \
     src/index/fulltext_index.cpp \
     src/index/inverted_index.cpp \
     src/index/tokenizer.cpp \
@@ -10,12 +10,22 @@ g++ -std=c++17 -O2 -I. \
     src/distributed/load_balancer.cpp \
     src/distributed/failover_manager.cpp \
     src/db/kv_db.cpp \
+    src/monitoring/metrics_registry.cpp \
     src/storage/memtable.cpp \
+    src/storage/range_tombstone.cpp \
+    src/storage/merge_operator.cpp \
     src/sstable/sstable_writer.cpp \
     src/sstable/sstable_reader.cpp \
     src/sstable/block_index.cpp \
+    src/sstable/data_block.cpp \
     src/log/wal.cpp \
+    src/db/write_batch.cpp \
     src/version/version_set.cpp \
+    src/blob/blob_file.cpp \
+    src/blob/blob_manager.cpp \
+    src/blob/blob_iterator.cpp \
+    src/compaction/compaction_filter.cpp \
+    src/iterator/ttl_iterator.cpp \
     -lpthread \
     -o test_distributed_system
 
@@ -0,0 +1,492 @@
+#include "src/network/http_engine.h"
+#include "src/network/http_server.h"
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <atomic>
+#include <filesystem>
+#include <cstdio>
+#include <algorithm>
+#include <utility>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+using namespace kvdb::network;
+
+class HttpEngineTest {
+public:
+    void run_all_tests() {
+        std::cout << "=== HTTP 引擎测试 ===" << std::endl;
+
+        test_parser_incremental();
+        test_parser_errors();
+        test_keep_alive();
+        test_pipelining();
+        test_slow_handler_isolation();
+        test_chunked_backpressure();
+        test_connection_close();
+        test_http_server();
+        test_keep_alive_cost();
+
+        std::cout << "🎉 所有 HTTP 引擎测试通过！" << std::endl;
+    }
+
+private:
+    struct ClientResponse {
+        int status = 0;
+        std::string headers;  // 原样保留，便于检查
+        std::string body;
+        bool chunked = false;
+    };
+
+    // 简单的阻塞客户端，自带读缓冲以支持流水线应答
+    class Client {
+    public:
+        explicit Client(uint16_t port) {
+            fd_ = socket(AF_INET, SOCK_STREAM, 0);
+            sockaddr_in addr{};
+            addr.sin_family = AF_INET;
+            addr.sin_port = htons(port);
+            inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+            int rc = connect(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+            assert(rc == 0);
+            (void)rc;
+            int one = 1;
+            setsockopt(fd_, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        }
+        ~Client() { close(fd_); }
+
+        void send_raw(const std::string& data) {
+            size_t sent = 0;
+            while (sent < data.size()) {
+                ssize_t n = send(fd_, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+                assert(n > 0);
+                sent += static_cast<size_t>(n);
+            }
+        }
+
+        // 返回 false 表示连接已被对端关闭
+        bool read_response(ClientResponse& response) {
+            size_t head_end;
+            while ((head_end = buffer_.find("\r\n\r\n")) == std::string::npos) {
+                if (!fill()) return false;
+            }
+            std::string head = buffer_.substr(0, head_end + 2);
+            buffer_.erase(0, head_end + 4);
+            response = ClientResponse();
+            response.status = std::stoi(head.substr(9, 3));
+            response.headers = head;
+
+            size_t cl = head.find("Content-Length: ");
+            if (head.find("Transfer-Encoding: chunked") != std::string::npos) {
+                response.chunked = true;
+                while (true) {
+                    size_t eol;
+                    while ((eol = buffer_.find("\r\n")) == std::string::npos) {
+                        if (!fill()) return false;
+                    }
+                    size_t size = std::stoul(buffer_.substr(0, eol), nullptr, 16);
+                    buffer_.erase(0, eol + 2);
+                    while (buffer_.size() < size + 2) {
+                        if (!fill()) return false;
+                    }
+                    response.body.append(buffer_, 0, size);
+                    buffer_.erase(0, size + 2);
+                    if (size == 0) break;
+                }
+            } else if (cl != std::string::npos) {
+                size_t length = std::stoul(head.substr(cl + 16));
+                while (buffer_.size() < length) {
+                    if (!fill()) return false;
+                }
+                response.body = buffer_.substr(0, length);
+                buffer_.erase(0, length);
+            } else {
+                // 无长度：读到连接关闭
+                while (fill()) {
+                }
+                response.body.swap(buffer_);
+            }
+            return true;
+        }
+
+        bool peer_closed() {
+            char c;
+            return recv(fd_, &c, 1, 0) == 0;
+        }
+
+        int fd() const { return fd_; }
+
+    private:
+        bool fill() {
+            char buf[65536];
+            ssize_t n = recv(fd_, buf, sizeof(buf), 0);
+            if (n <= 0) return false;
+            buffer_.append(buf, static_cast<size_t>(n));
+            return true;
+        }
+
+        int fd_;
+        std::string buffer_;
+    };
+
+    static std::string get_request(const std::string& target, const std::string& extra = "") {
+        return "GET " + target + " HTTP/1.1\r\nHost: test\r\n" + extra + "\r\n";
+    }
+
+    static HttpEngineOptions small_options() {
+        HttpEngineOptions options;
+        options.worker_threads = 4;
+        return options;
+    }
+
+    void test_parser_incremental() {
+        std::cout << "测试增量解析..." << std::endl;
+
+        std::string data =
+            "POST /a?x=1&y=hello%20world HTTP/1.1\r\nHost: h\r\nContent-Length: 5\r\n\r\nhello"
+            "\r\n"  // 请求之间的空行
+            "PUT /b HTTP/1.1\r\nTransfer-Encoding: chunked\r\nX-Dup: 1\r\nx-dup: 2\r\n\r\n"
+            "3;ext=1\r\nabc\r\n4\r\ndefg\r\n0\r\nTrailer: t\r\n\r\n"
+            "GET /c HTTP/1.0\r\n\r\n";
+
+        // 每次喂 1 字节和一次全部喂入，结果相同
+        for (size_t step : {size_t(1), size_t(7), data.size()}) {
+            HttpRequestParser parser(4096, 4096);
+            std::deque<HttpRequest> out;
+            for (size_t i = 0; i < data.size(); i += step) {
+                assert(parser.feed(data.data() + i, std::min(step, data.size() - i), out));
+            }
+            assert(out.size() == 3);
+            assert(out[0].method == "POST" && out[0].path == "/a" && out[0].body == "hello");
+            assert(out[0].query_param("x") == "1" && out[0].query_param("y") == "hello world");
+            assert(out[0].query_param("z", "none") == "none");
+            assert(out[0].keep_alive);
+            assert(out[1].method == "PUT" && out[1].body == "abcdefg");
+            assert(out[1].header("X-DUP") == "1, 2");
+            assert(out[2].path == "/c" && out[2].version == "HTTP/1.0" && !out[2].keep_alive);
+        }
+
+        std::cout << "✓ 增量解析测试通过" << std::endl;
+    }
+
+    void test_parser_errors() {
+        std::cout << "测试解析错误..." << std::endl;
+
+        auto status_of = [](const std::string& data, size_t max_header = 1024, size_t max_body = 1024) {
+            HttpRequestParser parser(max_header, max_body);
+            std::deque<HttpRequest> out;
+            bool ok = parser.feed(data.data(), data.size(), out);
+            return ok ? 0 : parser.error_status();
+        };
+
+        assert(status_of("GARBAGE\r\n\r\n") == 400);
+        assert(status_of("GET / HTTP/2.0\r\n\r\n") == 505);
+        assert(status_of("GET / HTTP/1.1\r\nNoColon\r\n\r\n") == 400);
+        assert(status_of("GET / HTTP/1.1\r\nContent-Length: abc\r\n\r\n") == 400);
+        assert(status_of("GET / HTTP/1.1\r\nContent-Length: 1\r\nContent-Length: 2\r\n\r\n") == 400);
+        assert(status_of("POST / HTTP/1.1\r\nContent-Length: 5000\r\n\r\n") == 413);
+        assert(status_of("POST / HTTP/1.1\r\nTransfer-Encoding: gzip\r\n\r\n") == 501);
+        assert(status_of("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\nzz\r\n") == 400);
+        assert(status_of("GET / HTTP/1.1\r\nX: " + std::string(2000, 'a')) == 431);
+        assert(status_of("GET / HTTP/1.1\r\nX: y\r\n") == 0);  // 头部未完，等待更多数据
+
+        std::cout << "✓ 解析错误测试通过" << std::endl;
+    }
+
+    void test_keep_alive() {
+        std::cout << "测试 keep-alive..." << std::endl;
+
+        std::atomic<int> handled{0};
+        HttpEngine engine([&](const HttpRequest& request, HttpResponse& response) {
+            handled++;
+            response.body = request.path;
+        }, small_options());
+        engine.start("127.0.0.1", 0);
+
+        Client client(engine.port());
+        for (int i = 0; i < 200; i++) {
+            client.send_raw(get_request("/req" + std::to_string(i)));
+            ClientResponse response;
+            assert(client.read_response(response));
+            assert(response.status == 200 && response.body == "/req" + std::to_string(i));
+            assert(response.headers.find("Connection: keep-alive") != std::string::npos);
+        }
+        assert(handled == 200);
+        assert(engine.connection_count() == 1);
+
+        engine.stop();
+        std::cout << "✓ keep-alive 测试通过" << std::endl;
+    }
+
+    // 一次写入多个请求：应答按请求顺序返回，即使前面的请求处理得更慢
+    void test_pipelining() {
+        std::cout << "测试流水线请求..." << std::endl;
+
+        HttpEngine engine([](const HttpRequest& request, HttpResponse& response) {
+            int delay = std::stoi(request.query_param("delay", "0"));
+            std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+            response.body = request.path + ":" + request.body;
+        }, small_options());
+        engine.start("127.0.0.1", 0);
+
+        Client client(engine.port());
+        std::string batch;
+        for (int i = 0; i < 20; i++) {
+            std::string body = "b" + std::to_string(i);
+            batch += "POST /p" + std::to_string(i) + "?delay=" + std::to_string(i % 3 == 0 ? 20 : 0) +
+                     " HTTP/1.1\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+        }
+        client.send_raw(batch);
+        for (int i = 0; i < 20; i++) {
+            ClientResponse response;
+            assert(client.read_response(response));
+            assert(response.body == "/p" + std::to_string(i) + ":b" + std::to_string(i));
+        }
+
+        engine.stop();
+        std::cout << "✓ 流水线请求测试通过" << std::endl;
+    }
+
+    // 一个慢请求和一个不发完请求的客户端都不影响其他连接
+    void test_slow_handler_isolation() {
+        std::cout << "测试慢客户端隔离..." << std::endl;
+
+        HttpEngine engine([](const HttpRequest& request, HttpResponse& response) {
+            if (request.path == "/slow") {
+                std::this_thread::sleep_for(std::chrono::milliseconds(500));
+            }
+            response.body = "ok";
+        }, small_options());
+        engine.start("127.0.0.1", 0);
+
+        Client stalled(engine.port());
+        stalled.send_raw("GET /partial HTTP/1.1\r\nHost:");  // 请求头只发一半
+
+        Client slow(engine.port());
+        slow.send_raw(get_request("/slow"));
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        auto start = std::chrono::steady_clock::now();
+        Client fast(engine.port());
+        fast.send_raw(get_request("/fast"));
+        ClientResponse response;
+        assert(fast.read_response(response) && response.body == "ok");
+        auto fast_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        assert(fast_ms < 250);
+
+        assert(slow.read_response(response) && response.body == "ok");
+        std::cout << "  慢请求处理中，另一连接的应答耗时 " << fast_ms << " ms" << std::endl;
+
+        engine.stop();
+        std::cout << "✓ 慢客户端隔离测试通过" << std::endl;
+    }
+
+    // 分块响应：客户端不读时生成被暂停，读完后内容完整
+    void test_chunked_backpressure() {
+        std::cout << "测试分块响应与背压..." << std::endl;
+
+        const size_t kTotal = 64 * 1024 * 1024;
+        const size_t kChunk = 16 * 1024;
+        std::atomic<size_t> produced{0};
+
+        HttpEngine engine([&](const HttpRequest&, HttpResponse& response) {
+            auto offset = std::make_shared<size_t>(0);
+            response.stream = [&, offset](std::string& chunk) {
+                for (size_t i = 0; i < kChunk; i++) {
+                    chunk += static_cast<char>('a' + (*offset + i) % 26);
+                }
+                *offset += kChunk;
+                produced = *offset;
+                return *offset < kTotal;
+            };
+        }, small_options());
+        engine.start("127.0.0.1", 0);
+
+        Client client(engine.port());
+        client.send_raw(get_request("/stream"));
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        size_t produced_before_read = produced;
+        // 只缓冲到水位线加上套接字缓冲区，远小于总量
+        assert(produced_before_read < kTotal / 2);
+
+        ClientResponse response;
+        assert(client.read_response(response));
+        assert(response.chunked);
+        assert(response.body.size() == kTotal);
+        for (size_t i = 0; i < kTotal; i += 4099) {
+            assert(response.body[i] == static_cast<char>('a' + i % 26));
+        }
+
+        // 同一连接上继续请求
+        client.send_raw(get_request("/stream", "Connection: close\r\n"));
+        assert(client.read_response(response) && response.body.size() == kTotal);
+        assert(client.peer_closed());
+
+        std::cout << "  客户端未读时已生成 " << produced_before_read / 1024 << " KB / " << kTotal / 1024 << " KB"
+                  << std::endl;
+        engine.stop();
+        std::cout << "✓ 分块响应与背压测试通过" << std::endl;
+    }
+
+    void test_connection_close() {
+        std::cout << "测试连接关闭语义..." << std::endl;
+
+        HttpEngine engine([](const HttpRequest& request, HttpResponse& response) {
+            if (request.path == "/stream") {
+                auto sent = std::make_shared<bool>(false);
+                response.stream = [sent](std::string& chunk) {
+                    chunk = "raw";
+                    return !std::exchange(*sent, true);
+                };
+            }
+            response.body = "bye";
+        }, small_options());
+        engine.start("127.0.0.1", 0);
+
+        {
+            Client client(engine.port());
+            client.send_raw("GET / HTTP/1.0\r\n\r\n");
+            ClientResponse response;
+            assert(client.read_response(response) && response.body == "bye");
+            assert(response.headers.find("Connection: close") != std::string::npos);
+            assert(client.peer_closed());
+        }
+        {
+            // HTTP/1.0 不支持 chunked：原样输出，以关闭连接结束
+            Client client(engine.port());
+            client.send_raw("GET /stream HTTP/1.0\r\n\r\n");
+            ClientResponse response;
+            assert(client.read_response(response));
+            assert(!response.chunked && response.body == "rawraw");
+        }
+        {
+            // 错误请求之前的流水线请求照常应答
+            Client client(engine.port());
+            client.send_raw(get_request("/ok") + "BROKEN\r\n\r\n");
+            ClientResponse response;
+            assert(client.read_response(response) && response.status == 200);
+            assert(client.read_response(response) && response.status == 400);
+            assert(client.peer_closed());
+        }
+        {
+            Client client(engine.port());
+            client.send_raw("HEAD / HTTP/1.1\r\n\r\n");
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            char buf[1024];
+            ssize_t n = recv(client.fd(), buf, sizeof(buf), MSG_DONTWAIT);
+            std::string head(buf, n > 0 ? n : 0);
+            assert(head.find("Content-Length: 3\r\n") != std::string::npos);
+            assert(head.size() == head.find("\r\n\r\n") + 4);  // 没有响应体
+        }
+
+        engine.stop();
+        std::cout << "✓ 连接关闭语义测试通过" << std::endl;
+    }
+
+    void test_http_server() {
+        std::cout << "测试 HTTPServer..." << std::endl;
+
+        std::filesystem::remove_all("data");
+        std::remove("MANIFEST");
+        std::remove("test_http_engine.wal");
+        {
+            KVDB db("test_http_engine.wal");
+            HTTPServer server(db, 0);
+            server.start();
+
+            Client client(server.port());
+            ClientResponse response;
+            for (int i = 0; i < 3000; i++) {
+                char key[32];
+                std::snprintf(key, sizeof(key), "key%05d", i);
+                std::string value = "v\"" + std::to_string(i);
+                client.send_raw("PUT /key/" + std::string(key) + " HTTP/1.1\r\nContent-Length: " +
+                                std::to_string(value.size()) + "\r\n\r\n" + value);
+                assert(client.read_response(response) && response.status == 200);
+            }
+
+            client.send_raw(get_request("/key/key00042"));
+            assert(client.read_response(response) && response.body == "v\"42");
+            client.send_raw("DELETE /key/key00042 HTTP/1.1\r\n\r\n");
+            assert(client.read_response(response) && response.status == 200);
+            client.send_raw(get_request("/key/key00042"));
+            assert(client.read_response(response) && response.status == 404);
+
+            // 闭区间 [key00040, key00044]，已删除的 key00042 不出现
+            client.send_raw(get_request("/scan?start=key00040&end=key00044"));
+            assert(client.read_response(response) && response.chunked);
+            assert(response.body ==
+                   "{\"key\":\"key00040\",\"value\":\"v\\\"40\"}\n"
+                   "{\"key\":\"key00041\",\"value\":\"v\\\"41\"}\n"
+                   "{\"key\":\"key00043\",\"value\":\"v\\\"43\"}\n"
+                   "{\"key\":\"key00044\",\"value\":\"v\\\"44\"}\n");
+
+            // 全量扫描跨越多个分块
+            client.send_raw(get_request("/scan?prefix=key"));
+            assert(client.read_response(response));
+            size_t lines = std::count(response.body.begin(), response.body.end(), '\n');
+            assert(lines == 2999);
+            assert(response.body.size() > HTTPServer::SCAN_CHUNK_BYTES);
+
+            client.send_raw(get_request("/scan?prefix=key0001&limit=5"));
+            assert(client.read_response(response));
+            assert(std::count(response.body.begin(), response.body.end(), '\n') == 5);
+
+            server.stop();
+        }
+        std::filesystem::remove_all("data");
+        std::remove("MANIFEST");
+        std::remove("test_http_engine.wal");
+
+        std::cout << "✓ HTTPServer 测试通过" << std::endl;
+    }
+
+    // 小请求下复用连接与每次新建连接的耗时对比
+    void test_keep_alive_cost() {
+        std::cout << "测试连接复用开销..." << std::endl;
+
+        HttpEngine engine([](const HttpRequest&, HttpResponse& response) {
+            response.body = "pong";
+        }, small_options());
+        engine.start("127.0.0.1", 0);
+
+        const int kRequests = 2000;
+        ClientResponse response;
+        auto start = std::chrono::steady_clock::now();
+        {
+            Client client(engine.port());
+            for (int i = 0; i < kRequests; i++) {
+                client.send_raw(get_request("/ping"));
+                assert(client.read_response(response));
+            }
+        }
+        double reuse_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kRequests; i++) {
+            Client client(engine.port());
+            client.send_raw(get_request("/ping", "Connection: close\r\n"));
+            assert(client.read_response(response));
+        }
+        double reconnect_us =
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "  每请求耗时: keep-alive " << reuse_us / kRequests << " us, 每次新建连接 "
+                  << reconnect_us / kRequests << " us" << std::endl;
+        engine.stop();
+        std::cout << "✓ 连接复用开销测试通过" << std::endl;
+    }
+};
+
+int main() {
+    HttpEngineTest test;
+    test.run_all_tests();
+    return 0;
+}
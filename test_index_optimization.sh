@@ -14,13 +14,23 @@ echo "编译索引优化测试程序..."
 g++ -std=c++17 -O2 -Isrc \
     test_index_optimization.cpp \
     src/db/kv_db.cpp \
+    src/monitoring/metrics_registry.cpp \
     src/storage/memtable.cpp \
+    src/storage/range_tombstone.cpp \
+    src/storage/merge_operator.cpp \
     src/log/wal.cpp \
+    src/db/write_batch.cpp \
     src/sstable/sstable_writer.cpp \
     src/sstable/sstable_reader.cpp \
     src/sstable/sstable_meta_util.cpp \
     src/sstable/block_index.cpp \
+    src/sstable/data_block.cpp \
     src/compaction/compactor.cpp \
+    src/blob/blob_file.cpp \
+    src/blob/blob_manager.cpp \
+    src/blob/blob_iterator.cpp \
+    src/compaction/compaction_filter.cpp \
+    src/iterator/ttl_iterator.cpp \
     src/compaction/compaction_strategy.cpp \
     src/bloom/bloom_filter.cpp \
     src/cache/block_cache.cpp \
@@ -36,9 +46,11 @@ g++ -std=c++17 -O2 -Isrc \
     src/index/secondary_index.cpp \
     src/index/composite_index.cpp \
     src/index/tokenizer.cpp \
+    src/index/posting_list.cpp \
     src/index/fulltext_index.cpp \
     src/index/inverted_index.cpp \
     src/index/index_manager.cpp \
+    src/index/persistent_index.cpp \
     src/index/query_optimizer.cpp \
     -o test_index_optimization \
     -pthread -lstdc++fs
@@ -14,6 +14,7 @@ g++ -std=c++17 -O2 -Isrc \
     src/index/secondary_index.cpp \
     src/index/composite_index.cpp \
     src/index/tokenizer.cpp \
+    src/index/posting_list.cpp \
     src/index/fulltext_index.cpp \
     src/index/inverted_index.cpp \
     -o test_index_simple \
@@ -0,0 +1,197 @@
+#include "src/sstable/sstable_writer.h"
+#include "src/sstable/sstable_meta_util.h"
+#include "src/storage/memtable.h"
+#include "src/iterator/memtable_iterator.h"
+#include "src/iterator/sstable_iterator.h"
+#include "src/iterator/merge_iterator.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cassert>
+#include <filesystem>
+
+class IteratorOptimizationTest {
+public:
+    void run_all_tests() {
+        std::cout << "=== 迭代器优化测试 ===\n\n";
+        
+        setup();
+        test_forward_scan();
+        test_reverse_scan();
+        test_bounds();
+        test_seek_for_prev();
+        test_direction_switch();
+        test_readahead_growth();
+        test_sequence_ordering();
+        cleanup();
+        
+        std::cout << "=== 所有测试完成 ===\n";
+    }
+    
+private:
+    MemTable mem_;
+    std::vector<SSTableMeta> tables_;
+    
+    void setup() {
+        std::filesystem::create_directories("test_iter_data");
+        
+        // SSTable 0: a, c, e ; SSTable 1: b, d, f
+        std::map<std::string, std::vector<VersionedValue>> t0 = {
+            {"a", {{1, "a1"}}}, {"c", {{3, "c1"}}}, {"e", {{5, "e1"}}}};
+        std::map<std::string, std::vector<VersionedValue>> t1 = {
+            {"b", {{2, "b1"}}}, {"d", {{4, "d1"}}}, {"f", {{6, "f1"}}}};
+        SSTableWriter::write("test_iter_data/sstable_0.dat", t0);
+        SSTableWriter::write("test_iter_data/sstable_1.dat", t1);
+        tables_.push_back(SSTableMetaUtil::get_meta_from_file("test_iter_data/sstable_0.dat"));
+        tables_.push_back(SSTableMetaUtil::get_meta_from_file("test_iter_data/sstable_1.dat"));
+        
+        // MemTable 覆盖 c，并新增 g
+        mem_.put("c", "c2", 10);
+        mem_.put("g", "g1", 11);
+    }
+    
+    std::unique_ptr<MergeIterator> make_iterator(const ReadOptions& options = ReadOptions()) {
+        std::vector<std::unique_ptr<Iterator>> children;
+        children.push_back(std::make_unique<MemTableIterator>(mem_, UINT64_MAX, options));
+        for (const auto& meta : tables_) {
+            children.push_back(std::make_unique<SSTableIterator>(meta, UINT64_MAX, options));
+        }
+        return std::make_unique<MergeIterator>(std::move(children), options);
+    }
+    
+    void test_forward_scan() {
+        std::cout << "1. 正向扫描测试\n";
+        auto iter = make_iterator();
+        std::string keys;
+        for (iter->seek_to_first(); iter->valid(); iter->next()) {
+            keys += iter->key_slice().to_string();
+        }
+        assert(keys == "abcdefg");
+        
+        iter->seek("c");
+        assert(iter->valid() && iter->key_slice() == Slice("c"));
+        assert(iter->value_slice() == Slice("c2")); // MemTable 中的新版本优先
+        std::cout << "✓ 正向扫描测试通过\n\n";
+    }
+    
+    void test_reverse_scan() {
+        std::cout << "2. 反向扫描测试\n";
+        auto iter = make_iterator();
+        std::string keys;
+        for (iter->seek_to_last(); iter->valid(); iter->prev()) {
+            keys += iter->key();
+        }
+        assert(keys == "gfedcba");
+        std::cout << "✓ 反向扫描测试通过\n\n";
+    }
+    
+    void test_bounds() {
+        std::cout << "3. 迭代范围测试\n";
+        ReadOptions options;
+        options.iterate_lower_bound = "b";
+        options.iterate_upper_bound = "e";
+        auto iter = make_iterator(options);
+        
+        std::string keys;
+        for (iter->seek_to_first(); iter->valid(); iter->next()) {
+            keys += iter->key();
+        }
+        assert(keys == "bcd");
+        
+        keys.clear();
+        for (iter->seek_to_last(); iter->valid(); iter->prev()) {
+            keys += iter->key();
+        }
+        assert(keys == "dcb");
+        std::cout << "✓ 迭代范围测试通过\n\n";
+    }
+    
+    void test_seek_for_prev() {
+        std::cout << "4. seek_for_prev 测试\n";
+        auto iter = make_iterator();
+        iter->seek_for_prev("cc");
+        assert(iter->valid() && iter->key() == "c");
+        iter->seek_for_prev("d");
+        assert(iter->valid() && iter->key() == "d");
+        iter->seek_for_prev("0");
+        assert(!iter->valid());
+        std::cout << "✓ seek_for_prev 测试通过\n\n";
+    }
+    
+    void test_direction_switch() {
+        std::cout << "5. 方向切换测试\n";
+        auto iter = make_iterator();
+        iter->seek("d");
+        iter->prev();
+        assert(iter->valid() && iter->key() == "c");
+        iter->next();
+        assert(iter->valid() && iter->key() == "d");
+        iter->next();
+        assert(iter->valid() && iter->key() == "e");
+        std::cout << "✓ 方向切换测试通过\n\n";
+    }
+    
+    void test_readahead_growth() {
+        std::cout << "6. 自适应预读测试\n";
+        std::map<std::string, std::vector<VersionedValue>> data;
+        for (int i = 0; i < 2000; i++) {
+            data["key_" + std::to_string(100000 + i)].push_back({static_cast<uint64_t>(i), std::string(1024, 'x')});
+        }
+        SSTableWriter::write("test_iter_data/sstable_big.dat", data);
+        SSTableMeta meta = SSTableMetaUtil::get_meta_from_file("test_iter_data/sstable_big.dat");
+        
+        SSTableIterator iter(meta, UINT64_MAX);
+        size_t count = 0;
+        for (iter.seek_to_first(); iter.valid(); iter.next()) {
+            assert(iter.value_slice().size() == 1024);
+            count++;
+        }
+        assert(count == 2000);
+        assert(iter.current_readahead_size() == SSTableIterator::kMaxReadahead);
+        std::cout << "顺序扫描后预读窗口: " << iter.current_readahead_size() / 1024 << " KB\n";
+        std::cout << "✓ 自适应预读测试通过\n\n";
+    }
+    
+    void test_sequence_ordering() {
+        std::cout << "7. 序列号感知去重测试\n";
+        std::map<std::string, std::vector<VersionedValue>> older = {
+            {"k1", {{20, "new"}}}, {"k2", {{21, "v2"}}}, {"k3", {{22, "v3"}}}};
+        std::map<std::string, std::vector<VersionedValue>> newer = {
+            {"k1", {{5, "old"}}}, {"k2", {{30, "__TOMBSTONE__"}}}};
+        SSTableWriter::write("test_iter_data/sstable_seq_a.dat", older);
+        SSTableWriter::write("test_iter_data/sstable_seq_b.dat", newer);
+        
+        // 子迭代器顺序与数据新旧相反：结果应由 seq 决定，而不是迭代器顺序
+        std::vector<std::unique_ptr<Iterator>> children;
+        children.push_back(std::make_unique<SSTableIterator>(
+            SSTableMetaUtil::get_meta_from_file("test_iter_data/sstable_seq_b.dat"), UINT64_MAX));
+        children.push_back(std::make_unique<SSTableIterator>(
+            SSTableMetaUtil::get_meta_from_file("test_iter_data/sstable_seq_a.dat"), UINT64_MAX));
+        MergeIterator iter(std::move(children));
+        
+        iter.seek_to_first();
+        assert(iter.valid() && iter.key() == "k1" && iter.value() == "new" && iter.seq() == 20);
+        iter.next();
+        // k2 的最新版本是墓碑，旧值不能复活
+        assert(iter.valid() && iter.key() == "k3");
+        iter.next();
+        assert(!iter.valid());
+        
+        // 反向同样遵循 seq 优先
+        iter.seek_to_last();
+        assert(iter.valid() && iter.key() == "k3");
+        iter.prev();
+        assert(iter.valid() && iter.key() == "k1" && iter.value() == "new");
+        std::cout << "✓ 序列号感知去重测试通过\n\n";
+    }
+    
+    void cleanup() {
+        std::filesystem::remove_all("test_iter_data");
+    }
+};
+
+int main() {
+    IteratorOptimizationTest test;
+    test.run_all_tests();
+    return 0;
+}
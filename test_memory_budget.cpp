@@ -0,0 +1,286 @@
+#include "src/db/kv_db.h"
+#include "src/db/write_batch.h"
+#include "src/storage/memory_budget.h"
+#include "src/cache/block_cache.h"
+#include "src/monitoring/metrics_collector.h"
+#include <iostream>
+#include <cassert>
+#include <filesystem>
+#include <thread>
+#include <chrono>
+
+using Component = MemoryBudget::Component;
+
+class MemoryBudgetTest {
+public:
+    void run_all_tests() {
+        std::cout << "=== 统一内存预算测试 ===" << std::endl;
+
+        test_accounting();
+        test_memtable_charge();
+        test_block_cache_limit();
+        test_global_write_buffer_flush();
+        test_cache_shrinks_under_pressure();
+        test_metrics_export();
+        test_engine_latency_histograms();
+
+        reset();
+        std::cout << "🎉 所有统一内存预算测试通过！" << std::endl;
+    }
+
+private:
+    static constexpr const char* WAL_FILE = "test_memory_budget.wal";
+
+    void reset() {
+        std::filesystem::remove_all("data");
+        std::filesystem::remove(WAL_FILE);
+        std::filesystem::remove("COLUMN_FAMILIES");
+        for (const auto& entry : std::filesystem::directory_iterator(".")) {
+            if (entry.path().filename().string().rfind("MANIFEST", 0) == 0) {
+                std::filesystem::remove(entry.path());
+            }
+        }
+    }
+
+    // 等后台刷盘把条件变为真，最多等 2 秒
+    template <typename Pred>
+    bool wait_for(Pred pred) {
+        for (int i = 0; i < 100; i++) {
+            if (pred()) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        return pred();
+    }
+
+    void test_accounting() {
+        std::cout << "\n1. 测试预算记账..." << std::endl;
+        MemoryBudget budget(10 * 1024 * 1024, 4 * 1024 * 1024);
+        budget.charge(Component::MEMTABLE, 3 * 1024 * 1024);
+        budget.charge(Component::INDEX, 1024 * 1024);
+        assert(budget.total_usage() == 4 * 1024 * 1024);
+        assert(!budget.should_flush());
+        assert(!budget.over_budget());
+        assert(budget.cache_budget() == 6 * 1024 * 1024);
+
+        budget.charge(Component::MEMTABLE, 1024 * 1024);
+        assert(budget.should_flush());
+
+        // 其他组件占满预算时，Block Cache 仍保留最小份额
+        budget.charge(Component::MVCC, 8 * 1024 * 1024);
+        assert(budget.over_budget());
+        assert(budget.cache_budget() == MemoryBudget::MIN_CACHE_BYTES);
+
+        budget.release(Component::MVCC, 8 * 1024 * 1024);
+        budget.release(Component::MEMTABLE, 4 * 1024 * 1024);
+        assert(budget.usage(Component::MEMTABLE) == 0);
+        assert(budget.total_usage() == 1024 * 1024);
+        std::cout << "   ✓ 各组件独立记账，写缓冲与总预算判定正确" << std::endl;
+    }
+
+    void test_memtable_charge() {
+        std::cout << "\n2. 测试 MemTable 记账..." << std::endl;
+        MemoryBudget budget;
+        {
+            MemTable memtable;
+            memtable.put("before", "budget", 1);
+            memtable.set_memory_budget(&budget);
+            assert(budget.usage(Component::MEMTABLE) == memtable.size());
+
+            memtable.put("key", "value", 2);
+            memtable.del("key", 3);
+            assert(budget.usage(Component::MEMTABLE) == memtable.size());
+
+            memtable.clear();
+            assert(budget.usage(Component::MEMTABLE) == 0);
+            memtable.put("again", "1", 4);
+        }
+        // 析构时归还剩余用量
+        assert(budget.usage(Component::MEMTABLE) == 0);
+        std::cout << "   ✓ 写入、清空与析构同步增减 MemTable 用量" << std::endl;
+    }
+
+    void test_block_cache_limit() {
+        std::cout << "\n3. 测试 Block Cache 字节上限..." << std::endl;
+        MemoryBudget budget;
+        {
+            BlockCache cache(1000);
+            cache.set_memory_budget(&budget);
+            std::string value(100, 'v');
+            for (int i = 0; i < 50; i++) {
+                cache.put("k" + std::to_string(i), value);
+            }
+            assert(cache.size() == 50);
+            assert(budget.usage(Component::BLOCK_CACHE) == cache.bytes());
+
+            // 收缩：立即淘汰到上限以内，最旧的条目先走
+            cache.set_byte_limit(1000);
+            assert(cache.bytes() <= 1000);
+            assert(budget.usage(Component::BLOCK_CACHE) == cache.bytes());
+            assert(cache.get("k49").has_value());
+            assert(!cache.get("k0").has_value());
+
+            // 上限之内继续写入时按字节淘汰
+            for (int i = 50; i < 80; i++) {
+                cache.put("k" + std::to_string(i), value);
+            }
+            assert(cache.bytes() <= 1000);
+
+            // 单个条目超过上限时不缓存
+            cache.put("huge", std::string(2000, 'x'));
+            assert(!cache.get("huge").has_value());
+
+            cache.set_byte_limit(0);
+            cache.put("huge", std::string(2000, 'x'));
+            assert(cache.get("huge").has_value());
+            assert(budget.usage(Component::BLOCK_CACHE) == cache.bytes());
+        }
+        assert(budget.usage(Component::BLOCK_CACHE) == 0);
+        std::cout << "   ✓ 字节上限生效，淘汰与析构同步归还预算" << std::endl;
+    }
+
+    void test_global_write_buffer_flush() {
+        std::cout << "\n4. 测试全局写缓冲触发刷盘..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        ColumnFamilyHandle* a = db.create_column_family("a");
+        ColumnFamilyHandle* b = db.create_column_family("b");
+
+        // 每个列族的写缓冲都是默认的 4MB，只有全局上限会触发刷盘
+        db.set_memory_budget(64 * 1024 * 1024, 96 * 1024);
+        const MemoryBudget& budget = db.get_memory_budget();
+
+        std::string value(1024, 'x');
+        for (int i = 0; i < 40; i++) {
+            assert(db.put(a, "a" + std::to_string(i), value));
+        }
+        for (int i = 0; i < 30; i++) {
+            assert(db.put(b, "b" + std::to_string(i), value));
+        }
+        for (int i = 0; i < 20; i++) {
+            assert(db.put("d" + std::to_string(i), value));
+        }
+        assert(budget.usage(Component::MEMTABLE) ==
+               db.get_memtable_size() + db.get_memtable_size(a) + db.get_memtable_size(b));
+        assert(!budget.should_flush());
+
+        size_t b_size = db.get_memtable_size(b);
+        size_t default_size = db.get_memtable_size();
+        for (int i = 40; i < 60; i++) {
+            assert(db.put(a, "a" + std::to_string(i), value));
+        }
+        // 超限后刷掉最大的 MemTable（列族 a），其他列族不受影响；刷盘之后的写入留在新的 MemTable 中
+        assert(wait_for([&] { return db.get_memtable_size(a) < 20 * 1024; }));
+        assert(db.get_memtable_size(b) == b_size);
+        assert(db.get_memtable_size() == default_size);
+        assert(!budget.should_flush());
+
+        std::string read;
+        assert(db.get(a, "a59", read) && read == value);
+        std::cout << "   ✓ 全部 MemTable 超过写缓冲上限时刷掉最大的一个" << std::endl;
+    }
+
+    void test_cache_shrinks_under_pressure() {
+        std::cout << "\n5. 测试内存压力下收缩 Block Cache..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        const MemoryBudget& budget = db.get_memory_budget();
+
+        std::string value(1024, 'c');
+        for (int i = 0; i < 3000; i++) {
+            assert(db.put("key" + std::to_string(i), value));
+        }
+        db.flush();
+        assert(budget.usage(Component::MEMTABLE) == 0);
+
+        std::string read;
+        for (int i = 0; i < 3000; i++) {
+            assert(db.get("key" + std::to_string(i), read));
+        }
+        size_t warmed = budget.usage(Component::BLOCK_CACHE);
+        assert(warmed > 3000 * 1024);
+
+        // 收紧总预算：缓存立即让出内存
+        const size_t total = 2 * 1024 * 1024;
+        db.set_memory_budget(total, 512 * 1024);
+        assert(budget.usage(Component::BLOCK_CACHE) <= budget.cache_budget());
+        assert(budget.usage(Component::BLOCK_CACHE) < warmed);
+
+        // 写入占用预算后缓存继续让出内存
+        for (int i = 0; i < 400; i++) {
+            assert(db.put("new" + std::to_string(i), value));
+        }
+        assert(budget.usage(Component::BLOCK_CACHE) <= budget.cache_budget());
+        assert(budget.usage(Component::BLOCK_CACHE) + budget.usage(Component::MEMTABLE) <=
+               total + MemoryBudget::MIN_CACHE_BYTES);
+
+        // 缓存收缩不影响正确性
+        for (int i = 0; i < 3000; i += 97) {
+            assert(db.get("key" + std::to_string(i), read) && read == value);
+        }
+        std::cout << "   ✓ 总用量超出预算时收缩 Block Cache，读取结果不变" << std::endl;
+    }
+
+    void test_metrics_export() {
+        std::cout << "\n6. 测试指标导出分组件内存..." << std::endl;
+        MemoryBudget budget(1024 * 1024, 512 * 1024);
+        budget.charge(Component::MEMTABLE, 100);
+        budget.charge(Component::INDEX, 7);
+
+        kvdb::monitoring::MetricsCollector collector;
+        assert(collector.get_resource_metrics().component_memory.empty());
+        collector.set_memory_budget(&budget);
+
+        auto metrics = collector.get_resource_metrics();
+        assert(metrics.component_memory["memtable"] == 100);
+        assert(metrics.component_memory["index"] == 7);
+        assert(metrics.component_memory["block_cache"] == 0);
+        assert(metrics.memory_budget == 1024 * 1024);
+
+        std::string prometheus = collector.export_prometheus();
+        assert(prometheus.find("kvdb_component_memory_bytes{component=\"memtable\"} 100") != std::string::npos);
+        assert(prometheus.find("kvdb_memory_budget_bytes 1048576") != std::string::npos);
+        std::string json = collector.export_json();
+        assert(json.find("\"component_memory\": {\"memtable\": 100") != std::string::npos);
+        budget.release(Component::MEMTABLE, 100);
+        budget.release(Component::INDEX, 7);
+        std::cout << "   ✓ Prometheus 与 JSON 导出包含各组件的内存用量" << std::endl;
+    }
+
+    void test_engine_latency_histograms() {
+        std::cout << "\n7. 测试引擎延迟直方图..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        // 有内存索引时 put/delete 先读旧值，这次读取不算用户的 get
+        assert(db.create_inverted_index("value_inverted", "value"));
+        for (int i = 0; i < 10; i++) {
+            assert(db.put("key" + std::to_string(i), "value"));
+        }
+        assert(db.del("key0"));
+        WriteBatch batch;
+        batch.put("batched", "1");
+        assert(db.write(batch));
+        std::string value;
+        for (int i = 0; i < 5; i++) {
+            db.get("key" + std::to_string(i), value);
+        }
+        db.flush();
+        db.compact();
+
+        std::string prometheus = db.get_metrics_registry().export_prometheus();
+        assert(prometheus.find("kvdb_db_op_latency_seconds_count{op=\"put\"} 10") != std::string::npos);
+        assert(prometheus.find("kvdb_db_op_latency_seconds_count{op=\"delete\"} 1") != std::string::npos);
+        assert(prometheus.find("kvdb_db_op_latency_seconds_count{op=\"write\"} 1") != std::string::npos);
+        assert(prometheus.find("kvdb_db_op_latency_seconds_count{op=\"get\"} 5") != std::string::npos);
+        assert(prometheus.find("kvdb_flush_duration_seconds_count 1") != std::string::npos);
+        assert(prometheus.find("kvdb_compaction_duration_seconds_count") != std::string::npos);
+        std::cout << "   ✓ get/put/delete/批量写与刷盘耗时记入 HDR 直方图并按 Prometheus 格式导出" << std::endl;
+    }
+};
+
+int main() {
+    MemoryBudgetTest test;
+    test.run_all_tests();
+    return 0;
+}
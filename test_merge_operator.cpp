@@ -0,0 +1,360 @@
+#include "src/db/kv_db.h"
+#include "src/db/write_batch.h"
+#include "src/storage/merge_operator.h"
+#include <iostream>
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+class MergeOperatorTest {
+public:
+    void run_all_tests() {
+        std::cout << "=== 合并操作符（Merge）测试 ===" << std::endl;
+
+        test_operators();
+        test_get_and_snapshot();
+        test_iterators();
+        test_flush_collapses_operands();
+        test_compaction_full_merge();
+        test_compaction_keeps_snapshot_views();
+        test_range_delete_and_recovery();
+        test_batch_and_rejections();
+        test_whitespace_values_replay();
+
+        reset();
+        std::cout << "🎉 所有合并操作符测试通过！" << std::endl;
+    }
+
+private:
+    static constexpr const char* WAL_FILE = "test_merge_operator.wal";
+
+    void reset() {
+        std::filesystem::remove_all("data");
+        std::filesystem::remove(WAL_FILE);
+        std::filesystem::remove("COLUMN_FAMILIES");
+        std::filesystem::remove("BLOB_MANIFEST");
+        for (const auto& entry : std::filesystem::directory_iterator(".")) {
+            if (entry.path().filename().string().rfind("MANIFEST", 0) == 0) {
+                std::filesystem::remove(entry.path());
+            }
+        }
+    }
+
+    static ColumnFamilyOptions counter_options() {
+        ColumnFamilyOptions options;
+        options.merge_operator = std::make_shared<Int64AddMergeOperator>();
+        return options;
+    }
+
+    static std::vector<std::pair<std::string, std::string>> scan(KVDB& db, ColumnFamilyHandle* cf,
+                                                                 bool reverse = false) {
+        std::vector<std::pair<std::string, std::string>> entries;
+        Snapshot snapshot = db.get_snapshot();
+        auto it = db.new_iterator(cf, snapshot);
+        if (reverse) {
+            for (it->seek_to_last(); it->valid(); it->prev()) {
+                entries.emplace_back(it->key(), it->value());
+            }
+        } else {
+            for (it->seek_to_first(); it->valid(); it->next()) {
+                entries.emplace_back(it->key(), it->value());
+            }
+        }
+        db.release_snapshot(snapshot);
+        return entries;
+    }
+
+    static std::string sstable_contents() {
+        std::string contents;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator("data")) {
+            if (entry.path().extension() == ".dat") {
+                std::ifstream in(entry.path());
+                std::stringstream buffer;
+                buffer << in.rdbuf();
+                contents += buffer.str();
+            }
+        }
+        return contents;
+    }
+
+    void test_operators() {
+        std::cout << "\n1. 测试内置合并操作符..." << std::endl;
+        std::string result;
+        Int64AddMergeOperator add;
+        std::string base = "10";
+        assert(add.full_merge("k", &base, {"5", "-3", "+1"}, &result) && result == "13");
+        assert(add.full_merge("k", nullptr, {"7"}, &result) && result == "7");
+        assert(!add.full_merge("k", nullptr, {"x"}, &result));
+        std::vector<std::string> operands = {"1", "2", "3"};
+        add.compress("k", operands);
+        assert(operands == std::vector<std::string>{"6"});
+
+        ListAppendMergeOperator list;
+        base = "a";
+        assert(list.full_merge("k", &base, {"b", "c"}, &result) && result == "a,b,c");
+        assert(list.full_merge("k", nullptr, {"b"}, &result) && result == "b");
+
+        JsonMergePatchOperator json;
+        base = R"({"a":1,"b":{"c":2,"d":3}})";
+        assert(json.full_merge("k", &base, {R"({"b":{"c":null,"e":4}})", R"({"a":5})"}, &result));
+        assert(result == R"({"a":5,"b":{"d":3,"e":4}})");
+        assert(json.partial_merge("k", R"({"a":1})", R"({"b":null})", &result) && result == R"({"a":1,"b":null})");
+        assert(!json.partial_merge("k", "3", R"({"a":1})", &result));  // 先替换成非对象再打补丁
+
+        MergeEntry entry;
+        entry.terminate_with("base");
+        entry.operands = {"x", "y:z"};
+        MergeEntry decoded;
+        assert(MergeEntry::decode(entry.encode(), decoded));
+        assert(decoded.base == MergeEntry::Base::VALUE && decoded.base_value == "base");
+        assert((decoded.operands == std::vector<std::string>{"x", "y:z"}));
+        assert(!MergeEntry::matches("plain"));
+        std::cout << "   ✓ 计数器、列表追加与 JSON 合并补丁；合并条目编码往返" << std::endl;
+    }
+
+    void test_get_and_snapshot() {
+        std::cout << "\n2. 测试点查折叠与快照语义..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        ColumnFamilyHandle* cf = db.create_column_family("counters", counter_options());
+
+        std::string value;
+        assert(db.merge(cf, "hits", "1"));
+        assert(db.merge(cf, "hits", "2"));
+        assert(db.get(cf, "hits", value) && value == "3");  // 不存在的 key 视为 0
+
+        assert(db.put(cf, "views", "100"));
+        assert(db.merge(cf, "views", "5"));
+        Snapshot before = db.get_snapshot();
+        assert(db.merge(cf, "views", "10"));
+        assert(db.get(cf, "views", value) && value == "115");
+        assert(db.get(cf, "views", before, value) && value == "105");
+        db.release_snapshot(before);
+
+        // 删除之后的合并从 0 开始
+        assert(db.del(cf, "views"));
+        assert(!db.get(cf, "views", value));
+        assert(db.merge(cf, "views", "4"));
+        assert(db.get(cf, "views", value) && value == "4");
+
+        // 操作数分散在多个 SSTable 与 MemTable 中
+        db.flush(cf);
+        assert(db.merge(cf, "hits", "10"));
+        db.flush(cf);
+        assert(db.merge(cf, "hits", "100"));
+        assert(db.get(cf, "hits", value) && value == "113");
+        assert(db.get(cf, "views", value) && value == "4");
+        std::cout << "   ✓ 合并链跨 MemTable 与 SSTable 折叠，遇到完整值或删除时终止" << std::endl;
+    }
+
+    void test_iterators() {
+        std::cout << "\n3. 测试迭代器折叠合并条目..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        ColumnFamilyHandle* cf = db.create_column_family("counters", counter_options());
+        assert(db.put(cf, "a", "1"));
+        assert(db.merge(cf, "b", "2"));
+        assert(db.put(cf, "c", "3"));
+        assert(db.merge(cf, "c", "30"));
+        db.flush(cf);
+        assert(db.merge(cf, "b", "20"));
+        assert(db.merge(cf, "c", "300"));
+        assert(db.merge(cf, "d", "4"));
+
+        std::vector<std::pair<std::string, std::string>> expected = {
+            {"a", "1"}, {"b", "22"}, {"c", "333"}, {"d", "4"}};
+        assert(scan(db, cf) == expected);
+        std::vector<std::pair<std::string, std::string>> reversed(expected.rbegin(), expected.rend());
+        assert(scan(db, cf, true) == reversed);
+
+        // 在折叠过的 key 上换向
+        Snapshot snapshot = db.get_snapshot();
+        auto it = db.new_iterator(cf, snapshot);
+        it->seek("b");
+        assert(it->valid() && it->key() == "b" && it->value() == "22");
+        it->next();
+        assert(it->valid() && it->key() == "c" && it->value() == "333");
+        it->prev();
+        assert(it->valid() && it->key() == "b" && it->value() == "22");
+        it->prev();
+        assert(it->valid() && it->key() == "a");
+        db.release_snapshot(snapshot);
+        std::cout << "   ✓ 正向、反向与换向时每个 key 只出现一次，值为折叠结果" << std::endl;
+    }
+
+    void test_flush_collapses_operands() {
+        std::cout << "\n4. 测试刷盘时部分合并操作数..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        ColumnFamilyHandle* cf = db.create_column_family("counters", counter_options());
+        for (int i = 1; i <= 3; i++) {
+            assert(db.merge(cf, "open", std::to_string(i)));
+        }
+        assert(db.put(cf, "based", "50"));
+        assert(db.merge(cf, "based", "7"));
+        db.flush(cf);
+
+        std::string contents = sstable_contents();
+        assert(contents.find("__MERGE__01:6") != std::string::npos);  // 三个操作数合成一个，链未终止
+        assert(contents.find("__MERGE__01:1") == std::string::npos);
+        assert(contents.find("__MERGE__2") == std::string::npos);  // 有基础值的链已完整合并
+
+        std::string value;
+        assert(db.get(cf, "open", value) && value == "6");
+        assert(db.get(cf, "based", value) && value == "57");
+        std::cout << "   ✓ 没有基础值的操作数链压缩成一条，有基础值时直接写出完整值" << std::endl;
+    }
+
+    void test_compaction_full_merge() {
+        std::cout << "\n5. 测试压缩时完整合并..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        ColumnFamilyHandle* cf = db.create_column_family("counters", counter_options());
+        // Leveled 策略在 L0 积累到 8 个文件时才压缩
+        for (int i = 0; i < 8; i++) {
+            assert(db.merge(cf, "total", "1"));
+            assert(db.merge(cf, "k" + std::to_string(i), "1"));
+            db.flush(cf);
+        }
+        db.compact(cf);
+
+        std::string contents = sstable_contents();
+        assert(contents.find("__MERGE__") == std::string::npos);  // 输入之外没有更旧的数据
+        std::string value;
+        assert(db.get(cf, "total", value) && value == "8");
+        assert(db.get(cf, "k7", value) && value == "1");
+        assert(scan(db, cf).size() == 9);
+        std::cout << "   ✓ 合并链在压缩输入内终止时写出完整值" << std::endl;
+    }
+
+    void test_compaction_keeps_snapshot_views() {
+        std::cout << "\n6. 测试压缩保留各快照的合并结果..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        ColumnFamilyHandle* cf = db.create_column_family("counters", counter_options());
+        assert(db.put(cf, "s1", "10"));
+        assert(db.put(cf, "s2", "7"));
+        db.flush(cf);
+        Snapshot first = db.get_snapshot();
+        assert(db.merge(cf, "s1", "5"));
+        db.flush(cf);
+        Snapshot second = db.get_snapshot();
+        assert(db.delete_range(cf, "s", "t"));
+        assert(db.merge(cf, "s1", "1"));
+        db.flush(cf);
+        for (int i = 3; i < 8; i++) {
+            assert(db.merge(cf, "k" + std::to_string(i), "1"));
+            db.flush(cf);
+        }
+        db.compact(cf);
+
+        // 一遍归并同时得到最新视图与两个快照的视图
+        std::string value;
+        assert(db.get(cf, "s1", value) && value == "1");
+        assert(!db.get(cf, "s2", value));
+        assert(db.get(cf, "s1", first, value) && value == "10");
+        assert(db.get(cf, "s1", second, value) && value == "15");
+        assert(db.get(cf, "s2", first, value) && value == "7");
+        assert(db.get(cf, "s2", second, value) && value == "7");
+        db.release_snapshot(first);
+        db.release_snapshot(second);
+        std::cout << "   ✓ 范围删除与合并条目在压缩后对每个快照仍解析出原来的值" << std::endl;
+    }
+
+    void test_range_delete_and_recovery() {
+        std::cout << "\n7. 测试范围删除与 WAL 重放..." << std::endl;
+        reset();
+        std::string value;
+        {
+            KVDB db(WAL_FILE);
+            ColumnFamilyHandle* cf = db.create_column_family("counters", counter_options());
+            assert(db.put(cf, "r1", "100"));
+            db.flush(cf);
+            assert(db.delete_range(cf, "r", "s"));
+            assert(db.merge(cf, "r1", "5"));
+            assert(db.get(cf, "r1", value) && value == "5");  // 范围删除之前的基础值不可见
+            db.flush(cf);
+            assert(db.get(cf, "r1", value) && value == "5");
+            assert(db.merge(cf, "r1", "1"));
+            assert(db.merge(cf, "r2", "2"));
+        }
+        {
+            KVDB db(WAL_FILE);
+            // 合并操作符不持久化，重启后重新设置
+            ColumnFamilyHandle* cf = db.create_column_family("counters", counter_options());
+            assert(db.get(cf, "r1", value) && value == "6");
+            assert(db.get(cf, "r2", value) && value == "2");
+        }
+        std::cout << "   ✓ 范围删除终止合并链；操作数从 WAL 重放" << std::endl;
+    }
+
+    void test_batch_and_rejections() {
+        std::cout << "\n8. 测试批量写与不支持的列族..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        ColumnFamilyOptions list_options;
+        list_options.merge_operator = std::make_shared<ListAppendMergeOperator>();
+        ColumnFamilyHandle* tags = db.create_column_family("tags", list_options);
+
+        WriteBatch batch;
+        batch.put(tags, "t", "a");
+        batch.merge(tags, "t", "b");
+        batch.merge(tags, "t", "c");
+        assert(db.write(batch));
+        std::string value;
+        assert(db.get(tags, "t", value) && value == "a,b,c");
+
+        // 默认列族没有合并操作符
+        assert(!db.merge("k", "1"));
+        WriteBatch rejected;
+        rejected.put(tags, "u", "x");
+        rejected.merge("k", "1");
+        assert(!db.write(rejected));
+        assert(!db.get(tags, "u", value));  // 整批不生效
+
+        ColumnFamilyOptions ttl_options = counter_options();
+        ttl_options.ttl_seconds = 60;
+        ColumnFamilyHandle* expiring = db.create_column_family("expiring", ttl_options);
+        assert(!db.merge(expiring, "k", "1"));
+        std::cout << "   ✓ 合并可与其他写入原子提交；没有操作符或开启 TTL 的列族拒绝合并" << std::endl;
+    }
+
+    void test_whitespace_values_replay() {
+        std::cout << "\n9. 测试含空白的值从 WAL 重放..." << std::endl;
+        reset();
+        ColumnFamilyOptions json_options;
+        json_options.merge_operator = std::make_shared<JsonMergePatchOperator>();
+        const std::string text = "line one\n\tline two \\ end";
+        std::string before;
+        std::string value;
+        {
+            KVDB db(WAL_FILE);
+            ColumnFamilyHandle* docs = db.create_column_family("docs", json_options);
+            assert(db.put(docs, "doc", R"({"name": "a b", "tags": [1, 2]})"));
+            assert(db.merge(docs, "doc", R"({"note": "x  y", "tags": null})"));
+            WriteBatch batch;
+            batch.merge(docs, "doc", R"({"n": 3})");
+            batch.put("plain key", text);
+            batch.put("empty", "");
+            assert(db.write(batch));
+            assert(db.get(docs, "doc", before));
+            assert(before.find("a b") != std::string::npos && before.find("x  y") != std::string::npos);
+        }
+        {
+            KVDB db(WAL_FILE);
+            ColumnFamilyHandle* docs = db.create_column_family("docs", json_options);
+            assert(db.get(docs, "doc", value) && value == before);
+            assert(db.get("plain key", value) && value == text);
+            assert(db.get("empty", value) && value.empty());
+        }
+        std::cout << "   ✓ 值与操作数中的空格、制表符、换行和反斜杠经 WAL 转义后原样恢复" << std::endl;
+    }
+};
+
+int main() {
+    MergeOperatorTest test;
+    test.run_all_tests();
+    return 0;
+}
@@ -0,0 +1,293 @@
+#include "src/partition_recovery/merkle_tree.h"
+#include "src/stream/realtime_sync.h"
+#include <iostream>
+#include <cassert>
+#include <map>
+#include <algorithm>
+
+// 内存副本：数据 + Merkle 树，模拟一个可被反熵拉取的对端
+class MemoryReplica : public AntiEntropyPeer {
+public:
+    void put(const std::string& key, const std::string& value, uint64_t timestamp) {
+        data_[key] = ReplicaEntry{key, value, timestamp};
+        tree_.update(key, value, timestamp);
+    }
+
+    void del(const std::string& key) {
+        data_.erase(key);
+        tree_.remove(key);
+    }
+
+    // 从对端拉取本地缺失或对端较新的键（LWW）
+    size_t pull_from(MemoryReplica& remote) {
+        MerkleDiff diff = tree_.diff(remote);
+        std::vector<std::string> keys = diff.missing_local;
+        for (const auto& digest : diff.mismatched) {
+            keys.push_back(digest.key);
+        }
+        size_t applied = 0;
+        for (const auto& entry : remote.fetch_entries(keys)) {
+            auto it = data_.find(entry.key);
+            if (it == data_.end() || entry.timestamp > it->second.timestamp) {
+                put(entry.key, entry.value, entry.timestamp);
+                applied++;
+            }
+        }
+        last_diff_ = diff;
+        return applied;
+    }
+
+    uint32_t depth() override { return tree_.depth(); }
+    std::vector<uint64_t> node_hashes(uint32_t level, const std::vector<uint32_t>& nodes) override {
+        return tree_.node_hashes(level, nodes);
+    }
+    std::vector<MerkleKeyDigest> bucket_digests(const std::vector<uint32_t>& buckets) override {
+        return tree_.bucket_digests(buckets);
+    }
+    std::vector<ReplicaEntry> fetch_entries(const std::vector<std::string>& keys) override {
+        std::vector<ReplicaEntry> entries;
+        for (const auto& key : keys) {
+            auto it = data_.find(key);
+            if (it != data_.end()) {
+                entries.push_back(it->second);
+            }
+        }
+        return entries;
+    }
+
+    const MerkleTree& tree() const { return tree_; }
+    const MerkleDiff& last_diff() const { return last_diff_; }
+    size_t size() const { return data_.size(); }
+
+private:
+    std::map<std::string, ReplicaEntry> data_;
+    MerkleTree tree_;
+    MerkleDiff last_diff_;
+};
+
+// 记录同步操作的目标，同时维护自己的树
+class RecordingSyncTarget : public kvdb::stream::SyncTarget {
+public:
+    void sync_insert(const std::string& key, const std::string& value) override {
+        data_[key] = value;
+        tree_.update(key, value);
+    }
+    void sync_update(const std::string& key, const std::string&, const std::string& new_value) override {
+        sync_insert(key, new_value);
+    }
+    void sync_delete(const std::string& key, const std::string&) override {
+        data_.erase(key);
+        tree_.remove(key);
+    }
+    std::string get_target_name() const override { return "recording"; }
+    bool is_healthy() const override { return true; }
+
+    MerkleTree& tree() { return tree_; }
+    const std::map<std::string, std::string>& data() const { return data_; }
+
+private:
+    std::map<std::string, std::string> data_;
+    MerkleTree tree_;
+};
+
+class MerkleAntiEntropyTest {
+public:
+    void run_all_tests() {
+        std::cout << "=== Merkle 树反熵测试 ===" << std::endl;
+
+        test_incremental_maintenance();
+        test_identical_trees();
+        test_diff_cost_proportional_to_changes();
+        test_bidirectional_sync();
+        test_realtime_sync_resync();
+
+        std::cout << "🎉 所有 Merkle 树反熵测试通过！" << std::endl;
+    }
+
+private:
+    std::string key_of(int i) { return "user:" + std::to_string(i); }
+
+    void test_incremental_maintenance() {
+        std::cout << "测试增量维护..." << std::endl;
+
+        MerkleTree a;
+        MerkleTree b;
+        uint64_t empty_root = a.root_hash();
+        assert(empty_root == b.root_hash());
+
+        // 插入顺序不影响根哈希
+        for (int i = 0; i < 1000; i++) {
+            a.update(key_of(i), "v" + std::to_string(i));
+        }
+        for (int i = 999; i >= 0; i--) {
+            b.update(key_of(i), "v" + std::to_string(i));
+        }
+        assert(a.root_hash() == b.root_hash());
+        assert(a.key_count() == 1000);
+
+        // 修改后恢复，根哈希回到原值
+        uint64_t root = a.root_hash();
+        a.update(key_of(42), "changed");
+        assert(a.root_hash() != root);
+        a.update(key_of(42), "v42");
+        assert(a.root_hash() == root);
+
+        // 删除后重新插入
+        a.remove(key_of(7));
+        assert(a.root_hash() != root);
+        assert(a.key_count() == 999);
+        a.update(key_of(7), "v7");
+        assert(a.root_hash() == root);
+
+        a.clear();
+        assert(a.root_hash() == empty_root);
+        assert(a.key_count() == 0);
+
+        std::cout << "✓ 增量维护测试通过" << std::endl;
+    }
+
+    void test_identical_trees() {
+        std::cout << "测试一致副本比较..." << std::endl;
+
+        MemoryReplica a;
+        MemoryReplica b;
+        for (int i = 0; i < 5000; i++) {
+            a.put(key_of(i), "v", 1);
+            b.put(key_of(i), "v", 1);
+        }
+
+        MerkleDiff diff = a.tree().diff(b);
+        assert(diff.empty());
+        assert(diff.divergent_buckets.empty());
+        assert(diff.hashes_exchanged == 1);  // 只比较了根
+        assert(diff.digests_exchanged == 0);
+
+        std::cout << "✓ 一致副本比较测试通过" << std::endl;
+    }
+
+    void test_diff_cost_proportional_to_changes() {
+        std::cout << "测试比较代价与变更量成正比..." << std::endl;
+
+        const int kKeys = 100000;
+        MemoryReplica a;
+        MemoryReplica b;
+        for (int i = 0; i < kKeys; i++) {
+            a.put(key_of(i), "value" + std::to_string(i), 1);
+            b.put(key_of(i), "value" + std::to_string(i), 1);
+        }
+
+        // 模拟短暂分区：两边各有少量写入
+        b.put(key_of(10), "b-new", 2);
+        b.put(key_of(20000), "b-new", 2);
+        b.put("new:key", "only-on-b", 2);
+        a.del(key_of(30000));
+        a.put(key_of(40000), "a-new", 3);
+
+        MerkleDiff diff = a.tree().diff(b);
+        size_t exchanged = diff.hashes_exchanged + diff.digests_exchanged;
+
+        std::vector<std::string> mismatched;
+        for (const auto& digest : diff.mismatched) {
+            mismatched.push_back(digest.key);
+        }
+        std::sort(mismatched.begin(), mismatched.end());
+
+        assert(diff.missing_local.size() == 2);   // new:key 与 a 删除的 user:30000
+        assert(diff.missing_remote.empty());
+        assert((mismatched == std::vector<std::string>{key_of(10), key_of(20000), key_of(40000)}));
+        assert(diff.divergent_buckets.size() <= 5);
+        assert(exchanged < 1000);
+
+        std::cout << "  数据集 " << kKeys << " 键，变更 5 键，交换哈希/摘要 " << exchanged
+                  << " 个，往返 " << diff.rounds << " 次" << std::endl;
+        std::cout << "✓ 比较代价测试通过" << std::endl;
+    }
+
+    void test_bidirectional_sync() {
+        std::cout << "测试双向反熵同步..." << std::endl;
+
+        MemoryReplica a;
+        MemoryReplica b;
+        for (int i = 0; i < 20000; i++) {
+            a.put(key_of(i), "v", 1);
+            b.put(key_of(i), "v", 1);
+        }
+
+        a.put(key_of(1), "from-a", 5);
+        a.put("a:only", "x", 5);
+        b.put(key_of(1), "from-b", 6);   // 同一键 b 更新更晚
+        b.put(key_of(2), "from-b", 6);
+        b.put("b:only", "y", 6);
+
+        size_t pulled_by_a = a.pull_from(b);
+        size_t pulled_by_b = b.pull_from(a);
+
+        assert(pulled_by_a == 3);   // user:1（b 较新）、user:2、b:only
+        assert(pulled_by_b == 1);   // a:only
+        assert(a.tree().root_hash() == b.tree().root_hash());
+        assert(a.size() == b.size());
+        assert(a.tree().diff(b).empty());
+
+        std::cout << "✓ 双向反熵同步测试通过" << std::endl;
+    }
+
+    void test_realtime_sync_resync() {
+        std::cout << "测试实时同步的反熵重同步..." << std::endl;
+
+        using namespace kvdb::stream;
+
+        SyncConfig config;
+        config.name = "merkle_sync";
+        RealtimeSyncProcessor processor(config);
+        auto target = std::make_shared<RecordingSyncTarget>();
+        processor.add_target(target);
+
+        std::map<std::string, std::string> source;
+        auto write = [&](const std::string& key, const std::string& value) {
+            bool exists = source.count(key) > 0;
+            ChangeEvent event(exists ? EventType::UPDATE : EventType::INSERT, key,
+                              exists ? source[key] : "", value);
+            source[key] = value;
+            processor.process(event);
+        };
+
+        for (int i = 0; i < 50; i++) {
+            write(key_of(i), "v1");
+        }
+        assert(target->data().size() == 50);
+        assert(processor.get_merkle_tree().root_hash() == target->tree().root_hash());
+
+        // 暂停期间的变更不会发给目标，但源端树仍在维护
+        processor.pause();
+        write(key_of(3), "v2");
+        write("late:key", "v1");
+        ChangeEvent delete_event(EventType::DELETE, key_of(4), source[key_of(4)]);
+        source.erase(key_of(4));
+        processor.process(delete_event);
+        processor.resume();
+        assert(processor.get_merkle_tree().root_hash() != target->tree().root_hash());
+
+        LocalMerkleTreePeer target_peer(target->tree());
+        size_t resent = processor.resync_target("recording", target_peer,
+            [&source](const std::string& key, std::string& value) {
+                auto it = source.find(key);
+                if (it == source.end()) {
+                    return false;
+                }
+                value = it->second;
+                return true;
+            });
+
+        assert(resent == 3);
+        assert(processor.get_merkle_tree().root_hash() == target->tree().root_hash());
+        assert(target->data() == source);
+
+        std::cout << "✓ 实时同步重同步测试通过" << std::endl;
+    }
+};
+
+int main() {
+    MerkleAntiEntropyTest test;
+    test.run_all_tests();
+    return 0;
+}
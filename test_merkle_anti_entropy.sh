@@ -0,0 +1,23 @@
+#!/bin/bash
+
+echo "=== Merkle 树反熵测试 ==="
+
+echo "编译 Merkle 树反熵测试..."
+
+if g++ -std=c++17 -O2 -I. -Isrc \
+    test_merkle_anti_entropy.cpp \
+    src/partition_recovery/merkle_tree.cpp \
+    src/stream/change_stream.cpp \
+    src/stream/realtime_sync.cpp \
+    -o test_merkle_anti_entropy -pthread; then
+
+    echo "编译成功，运行测试..."
+    echo ""
+    ./test_merkle_anti_entropy
+    status=$?
+    rm -f test_merkle_anti_entropy
+    exit $status
+else
+    echo "编译失败！请检查错误信息。"
+    exit 1
+fi
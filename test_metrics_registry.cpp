@@ -0,0 +1,266 @@
+#include "src/monitoring/metrics_collector.h"
+#include "src/monitoring/metrics_registry.h"
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <vector>
+#include <sstream>
+#include <chrono>
+
+using namespace kvdb::monitoring;
+
+class MetricsRegistryTest {
+public:
+    void run_all_tests() {
+        std::cout << "=== 分片指标注册表 / HDR 直方图测试 ===" << std::endl;
+
+        test_bucket_bounds();
+        test_percentiles();
+        test_concurrent_recording();
+        test_snapshot_delta();
+        test_prometheus_export();
+        test_collector_integration();
+        test_record_cost();
+
+        std::cout << "🎉 所有指标注册表测试通过！" << std::endl;
+    }
+
+private:
+    void test_bucket_bounds() {
+        std::cout << "测试 HDR 桶边界..." << std::endl;
+
+        size_t last_index = 0;
+        for (uint64_t v = 0; v < (uint64_t(1) << 36); v = v < 64 ? v + 1 : v + v / 7) {
+            size_t index = HdrHistogram::bucket_index(v);
+            assert(index >= last_index);
+            assert(index < HdrHistogram::BUCKET_COUNT);
+            assert(HdrHistogram::bucket_lower_bound(index) <= v);
+            assert(v <= HdrHistogram::bucket_upper_bound(index));
+            // 桶宽相对误差不超过 1/SUB_BUCKETS
+            uint64_t width = HdrHistogram::bucket_upper_bound(index) - HdrHistogram::bucket_lower_bound(index);
+            assert(width * HdrHistogram::SUB_BUCKETS <= v || v < HdrHistogram::SUB_BUCKETS);
+            last_index = index;
+        }
+
+        // 相邻桶首尾相接
+        for (size_t i = 1; i < HdrHistogram::BUCKET_COUNT; ++i) {
+            assert(HdrHistogram::bucket_lower_bound(i) == HdrHistogram::bucket_upper_bound(i - 1) + 1);
+        }
+
+        // 超出范围的值落在最后一个桶
+        assert(HdrHistogram::bucket_index(UINT64_MAX) == HdrHistogram::BUCKET_COUNT - 1);
+
+        std::cout << "✓ HDR 桶边界测试通过" << std::endl;
+    }
+
+    void test_percentiles() {
+        std::cout << "测试分位数..." << std::endl;
+
+        HdrHistogram histogram;
+        for (uint64_t v = 1; v <= 100000; ++v) {
+            histogram.record(v);
+        }
+        HistogramSnapshot snapshot = histogram.snapshot();
+        assert(snapshot.count == 100000);
+        assert(snapshot.sum == 100000ULL * 100001 / 2);
+
+        auto near = [](uint64_t actual, double expected) {
+            return actual >= expected && actual <= expected * (1.0 + 1.0 / HdrHistogram::SUB_BUCKETS);
+        };
+        assert(near(snapshot.percentile(50.0), 50000));
+        assert(near(snapshot.percentile(99.0), 99000));
+        assert(near(snapshot.percentile(99.9), 99900));
+        assert(near(snapshot.percentile(100.0), 100000));
+        assert(snapshot.mean() == 50000.5);
+
+        HistogramSnapshot empty = HdrHistogram().snapshot();
+        assert(empty.percentile(99.0) == 0 && empty.mean() == 0.0);
+
+        std::cout << "✓ 分位数测试通过" << std::endl;
+    }
+
+    void test_concurrent_recording() {
+        std::cout << "测试并发记录..." << std::endl;
+
+        ShardedCounter counter;
+        HdrHistogram histogram;
+        const int kThreads = 8;
+        const int kPerThread = 200000;
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&, t]() {
+                for (int i = 0; i < kPerThread; ++i) {
+                    counter.add();
+                    histogram.record(static_cast<uint64_t>(t * 1000 + i % 1000));
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        assert(counter.value() == uint64_t(kThreads) * kPerThread);
+        HistogramSnapshot snapshot = histogram.snapshot();
+        assert(snapshot.count == uint64_t(kThreads) * kPerThread);
+        uint64_t expected_sum = 0;
+        for (int t = 0; t < kThreads; ++t) {
+            expected_sum += uint64_t(kPerThread / 1000) * (uint64_t(t) * 1000 * 1000 + 999 * 1000 / 2);
+        }
+        assert(snapshot.sum == expected_sum);
+
+        counter.reset();
+        histogram.reset();
+        assert(counter.value() == 0 && histogram.count() == 0);
+
+        std::cout << "✓ 并发记录测试通过" << std::endl;
+    }
+
+    void test_snapshot_delta() {
+        std::cout << "测试区间差值..." << std::endl;
+
+        HdrHistogram histogram;
+        for (int i = 0; i < 1000; ++i) {
+            histogram.record(10);
+        }
+        HistogramSnapshot before = histogram.snapshot();
+        for (int i = 0; i < 100; ++i) {
+            histogram.record(5000);
+        }
+        HistogramSnapshot window = histogram.snapshot().delta_since(before);
+
+        // 区间内只有慢请求，历史上的快请求不会稀释分位数
+        assert(window.count == 100);
+        assert(window.sum == 500000);
+        assert(window.percentile(50.0) >= 5000);
+
+        std::cout << "✓ 区间差值测试通过" << std::endl;
+    }
+
+    // 取出某个序列的值
+    static double sample_value(const std::string& text, const std::string& series) {
+        std::istringstream in(text);
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line.compare(0, series.size() + 1, series + " ") == 0) {
+                return std::stod(line.substr(series.size() + 1));
+            }
+        }
+        return -1;
+    }
+
+    void test_prometheus_export() {
+        std::cout << "测试 Prometheus 导出..." << std::endl;
+
+        MetricsRegistry registry;
+        ShardedCounter& hits = registry.counter("cache_hits_total", "Cache hits", "tier=\"l1\"");
+        assert(&hits == &registry.counter("cache_hits_total", "Cache hits", "tier=\"l1\""));
+        hits.add(42);
+
+        HdrHistogram& latency = registry.histogram("rpc_latency_seconds", "RPC latency", 1e-9);
+        latency.record(500);          // 0.5us
+        latency.record(3000);         // 3us
+        latency.record(2000000);      // 2ms
+        latency.record(20000000000);  // 20s，超过最大边界
+
+        std::string text = registry.export_prometheus();
+        assert(text.find("# TYPE cache_hits_total counter") != std::string::npos);
+        assert(text.find("# TYPE rpc_latency_seconds histogram") != std::string::npos);
+        assert(sample_value(text, "cache_hits_total{tier=\"l1\"}") == 42);
+
+        assert(sample_value(text, "rpc_latency_seconds_bucket{le=\"1e-06\"}") == 1);
+        assert(sample_value(text, "rpc_latency_seconds_bucket{le=\"5e-06\"}") == 2);
+        assert(sample_value(text, "rpc_latency_seconds_bucket{le=\"0.0025\"}") == 3);
+        assert(sample_value(text, "rpc_latency_seconds_bucket{le=\"10\"}") == 3);
+        assert(sample_value(text, "rpc_latency_seconds_bucket{le=\"+Inf\"}") == 4);
+        assert(sample_value(text, "rpc_latency_seconds_count") == 4);
+        double sum = sample_value(text, "rpc_latency_seconds_sum");
+        assert(sum > 20.0 && sum < 20.01);
+
+        // le 累计计数单调不减
+        std::istringstream in(text);
+        std::string line;
+        double last = 0;
+        while (std::getline(in, line)) {
+            if (line.compare(0, 27, "rpc_latency_seconds_bucket{") == 0) {
+                double value = std::stod(line.substr(line.rfind(' ') + 1));
+                assert(value >= last);
+                last = value;
+            }
+        }
+
+        std::cout << "✓ Prometheus 导出测试通过" << std::endl;
+    }
+
+    void test_collector_integration() {
+        std::cout << "测试 MetricsCollector 集成..." << std::endl;
+
+        g_metrics_collector = std::make_unique<MetricsCollector>();
+
+        RECORD_OPERATION("get");            // 兼容旧的字符串接口
+        RECORD_OPERATION("unknown");
+        RECORD_OPERATION(OpType::PUT);
+        {
+            RECORD_TIMED_OPERATION(OpType::GET);
+        }
+        RECORD_REQUEST();
+        RECORD_LATENCY(2.5);                // 毫秒
+
+        PerformanceMetrics perf = g_metrics_collector->get_performance_metrics();
+        assert(perf.get_count == 2);
+        assert(perf.put_count == 1);
+        assert(perf.delete_count == 0);
+        assert(perf.total_requests == 2);
+        assert(g_metrics_collector->get_latency_snapshot().count == 2);
+        assert(g_metrics_collector->get_operation_latency_snapshot(OpType::GET).count == 1);
+
+        std::string text = g_metrics_collector->export_prometheus();
+        assert(sample_value(text, "kvdb_operations_total{op=\"get\"}") == 2);
+        assert(sample_value(text, "kvdb_operations_total{op=\"put\"}") == 1);
+        assert(sample_value(text, "kvdb_request_latency_seconds_count") == 2);
+        assert(sample_value(text, "kvdb_operation_latency_seconds_bucket{op=\"get\",le=\"+Inf\"}") == 1);
+        assert(sample_value(text, "kvdb_operation_latency_seconds_count{op=\"put\"}") == 0);
+
+        // 自定义指标与内置指标一起导出
+        g_metrics_collector->registry().counter("kvdb_compactions_total", "Compactions").add(3);
+        text = g_metrics_collector->export_prometheus();
+        assert(sample_value(text, "kvdb_compactions_total") == 3);
+
+        // 监控线程按区间直方图计算延迟
+        g_metrics_collector->start();
+        for (int i = 0; i < 100; ++i) {
+            g_metrics_collector->record_latency_ns(i < 90 ? 1000000 : 50000000);  // 1ms / 50ms
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1300));
+        perf = g_metrics_collector->get_performance_metrics();
+        g_metrics_collector->stop();
+        assert(perf.p50_latency >= 1.0 && perf.p50_latency < 1.05);
+        assert(perf.p99_latency >= 50.0 && perf.p99_latency < 52.0);
+
+        g_metrics_collector.reset();
+
+        std::cout << "✓ MetricsCollector 集成测试通过" << std::endl;
+    }
+
+    void test_record_cost() {
+        std::cout << "测试记录开销..." << std::endl;
+
+        MetricsCollector collector;
+        const int kIterations = 5000000;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kIterations; ++i) {
+            collector.record_operation(OpType::GET, static_cast<uint64_t>(1000 + (i & 1023)));
+        }
+        auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        assert(collector.get_performance_metrics().get_count == uint64_t(kIterations));
+
+        std::cout << "  record_operation(op, latency): " << elapsed / kIterations << " ns/次" << std::endl;
+        std::cout << "✓ 记录开销测试通过" << std::endl;
+    }
+};
+
+int main() {
+    MetricsRegistryTest test;
+    test.run_all_tests();
+    return 0;
+}
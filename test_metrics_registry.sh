@@ -0,0 +1,23 @@
+#!/bin/bash
+
+echo "=== 分片指标注册表测试 ==="
+
+echo "编译指标注册表测试..."
+
+if g++ -std=c++17 -O2 -I. \
+    test_metrics_registry.cpp \
+    src/monitoring/metrics_collector.cpp \
+    src/monitoring/metrics_registry.cpp \
+    src/monitoring/alert_manager.cpp \
+    -o test_metrics_registry -pthread; then
+
+    echo "编译成功，运行测试..."
+    echo ""
+    ./test_metrics_registry
+    status=$?
+    rm -f test_metrics_registry
+    exit $status
+else
+    echo "编译失败！请检查错误信息。"
+    exit 1
+fi
@@ -6,6 +6,7 @@ echo "Building KVDB Monitoring System Test (Simplified)..."
 g++ -std=c++17 -O2 \
     test_monitoring_simple.cpp \
     src/monitoring/metrics_collector.cpp \
+    src/monitoring/metrics_registry.cpp \
     src/monitoring/alert_manager.cpp \
     -I. \
     -pthread \
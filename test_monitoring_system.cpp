@@ -72,23 +72,23 @@ void test_metrics_collection() {
     auto business_metrics = g_metrics_collector->get_business_metrics();
     
     std::cout << "\n--- Performance Metrics ---" << std::endl;
-    std::cout << "QPS: " << perf_metrics.qps.load() << std::endl;
-    std::cout << "Total Requests: " << perf_metrics.total_requests.load() << std::endl;
-    std::cout << "Average Latency: " << perf_metrics.avg_latency.load() << " ms" << std::endl;
-    std::cout << "P99 Latency: " << perf_metrics.p99_latency.load() << " ms" << std::endl;
-    std::cout << "GET Count: " << perf_metrics.get_count.load() << std::endl;
-    std::cout << "PUT Count: " << perf_metrics.put_count.load() << std::endl;
+    std::cout << "QPS: " << perf_metrics.qps << std::endl;
+    std::cout << "Total Requests: " << perf_metrics.total_requests << std::endl;
+    std::cout << "Average Latency: " << perf_metrics.avg_latency << " ms" << std::endl;
+    std::cout << "P99 Latency: " << perf_metrics.p99_latency << " ms" << std::endl;
+    std::cout << "GET Count: " << perf_metrics.get_count << std::endl;
+    std::cout << "PUT Count: " << perf_metrics.put_count << std::endl;
     
     std::cout << "\n--- Resource Metrics ---" << std::endl;
-    std::cout << "CPU Usage: " << resource_metrics.cpu_usage.load() << "%" << std::endl;
-    std::cout << "Memory Usage: " << (resource_metrics.memory_usage.load() / 1024 / 1024) << " MB" << std::endl;
+    std::cout << "CPU Usage: " << resource_metrics.cpu_usage << "%" << std::endl;
+    std::cout << "Memory Usage: " << (resource_metrics.memory_usage / 1024 / 1024) << " MB" << std::endl;
     
     std::cout << "\n--- Business Metrics ---" << std::endl;
-    std::cout << "Total Keys: " << business_metrics.total_keys.load() << std::endl;
-    std::cout << "Total Data Size: " << (business_metrics.total_data_size.load() / 1024 / 1024) << " MB" << std::endl;
-    std::cout << "Active Connections: " << business_metrics.active_connections.load() << std::endl;
-    std::cout << "Transaction Count: " << business_metrics.transaction_count.load() << std::endl;
-    std::cout << "Commit Count: " << business_metrics.commit_count.load() << std::endl;
+    std::cout << "Total Keys: " << business_metrics.total_keys << std::endl;
+    std::cout << "Total Data Size: " << (business_metrics.total_data_size / 1024 / 1024) << " MB" << std::endl;
+    std::cout << "Active Connections: " << business_metrics.active_connections << std::endl;
+    std::cout << "Transaction Count: " << business_metrics.transaction_count << std::endl;
+    std::cout << "Commit Count: " << business_metrics.commit_count << std::endl;
     
     workload_thread.join();
     g_metrics_collector->stop();
@@ -6,8 +6,11 @@ echo "Building KVDB Monitoring System Test..."
 g++ -std=c++17 -O2 \
     test_monitoring_system.cpp \
     src/monitoring/metrics_collector.cpp \
+    src/monitoring/metrics_registry.cpp \
     src/monitoring/alert_manager.cpp \
     src/monitoring/metrics_server.cpp \
+    src/network/http_engine.cpp \
+    src/concurrent/work_stealing_pool.cpp \
     -I. \
     -pthread \
     -o test_monitoring_system
@@ -10,16 +10,26 @@ g++ -std=c++17 -O2 \
     -I. \
     test_ops_system.cpp \
     src/db/kv_db.cpp \
+    src/monitoring/metrics_registry.cpp \
     src/storage/memtable.cpp \
+    src/storage/range_tombstone.cpp \
+    src/storage/merge_operator.cpp \
     src/storage/concurrent_memtable.cpp \
     src/sstable/sstable_writer.cpp \
     src/sstable/sstable_reader.cpp \
     src/sstable/block_index.cpp \
+    src/sstable/data_block.cpp \
     src/log/wal.cpp \
+    src/db/write_batch.cpp \
     src/iterator/memtable_iterator.cpp \
     src/iterator/sstable_iterator.cpp \
     src/iterator/merge_iterator.cpp \
     src/compaction/compactor.cpp \
+    src/blob/blob_file.cpp \
+    src/blob/blob_manager.cpp \
+    src/blob/blob_iterator.cpp \
+    src/compaction/compaction_filter.cpp \
+    src/iterator/ttl_iterator.cpp \
     src/version/version_set.cpp \
     src/cache/cache_manager.cpp \
     src/bloom/bloom_filter.cpp \
@@ -0,0 +1,252 @@
+#include "src/db/kv_db.h"
+#include "src/db/write_batch.h"
+#include "src/index/index_manager.h"
+#include "src/index/persistent_index.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+#include <filesystem>
+
+class PersistentIndexTest {
+public:
+    void run_all_tests() {
+        std::cout << "=== 持久化二级索引测试 ===\n\n";
+
+        test_key_codec();
+        test_exact_and_range_lookup();
+        test_update_and_delete();
+        test_composite_index();
+        test_unique_constraint();
+        test_stale_entry_detection();
+        test_recovery_from_wal();
+        test_torn_batch_discarded();
+        cleanup();
+
+        std::cout << "=== 所有测试完成 ===\n";
+    }
+
+private:
+    static constexpr const char* WAL_FILE = "test_persistent_index.wal";
+
+    void cleanup() {
+        std::filesystem::remove_all("data");
+        std::filesystem::remove("MANIFEST");
+        std::filesystem::remove(WAL_FILE);
+    }
+
+    static std::vector<std::string> sorted(std::vector<std::string> keys) {
+        std::sort(keys.begin(), keys.end());
+        return keys;
+    }
+
+    static IndexLookupResult exact(KVDB& db, const std::string& index, const std::string& value) {
+        IndexQuery query(QueryType::EXACT_MATCH, "value", value);
+        return db.get_index_manager().lookup(index, query);
+    }
+
+    void test_key_codec() {
+        std::cout << "测试索引条目编码...\n";
+
+        std::string key = PersistentIndex::encode_entry_key("by/name", "a b/c%", "user/1");
+        assert(key.find(' ') == std::string::npos);
+        assert(key.compare(0, 4, "idx/") == 0);
+
+        std::string name, value, pk;
+        assert(PersistentIndex::decode_entry_key(key, name, value, pk));
+        assert(name == "by/name");
+        assert(value == "a b/c%");
+        assert(pk == "user/1");
+
+        assert(PersistentIndex::is_internal_key(key));
+        assert(PersistentIndex::is_internal_key(PersistentIndex::meta_key("x")));
+        assert(!PersistentIndex::is_internal_key("user_1"));
+
+        IndexMetadata metadata("c1", IndexType::COMPOSITE, {"key", "value"}, true);
+        IndexMetadata decoded;
+        assert(PersistentIndex::deserialize_metadata(
+            "c1", PersistentIndex::serialize_metadata(metadata), decoded));
+        assert(decoded.type == IndexType::COMPOSITE);
+        assert(decoded.fields == metadata.fields);
+        assert(decoded.is_unique);
+
+        std::cout << "✓ 索引条目编码测试通过\n\n";
+    }
+
+    void test_exact_and_range_lookup() {
+        std::cout << "测试精确/范围/前缀查询...\n";
+        cleanup();
+        {
+            KVDB db(WAL_FILE);
+            for (int i = 0; i < 20; ++i) {
+                db.put("user_" + std::to_string(i), "age_" + std::to_string(20 + i % 5));
+            }
+
+            assert(db.create_secondary_index("age_index", "value"));
+
+            // 索引创建之后的写入由写路径直接追加条目
+            db.put("user_100", "age_21");
+
+            auto result = exact(db, "age_index", "age_21");
+            assert(result.success);
+            assert(sorted(result.keys) == sorted({"user_1", "user_100", "user_11", "user_16", "user_6"}));
+
+            IndexQuery range(QueryType::RANGE_QUERY, "value", "");
+            range.range_start = "age_22";
+            range.range_end = "age_23";
+            result = db.get_index_manager().lookup("age_index", range);
+            assert(result.success);
+            assert(result.keys.size() == 8);
+
+            IndexQuery prefix(QueryType::PREFIX_MATCH, "value", "age_2");
+            result = db.get_index_manager().lookup("age_index", prefix);
+            assert(result.keys.size() == 21);
+
+            // 用户数据扫描不会把索引条目当成普通记录建入内存索引
+            IndexStats stats = db.get_index_manager().get_index_stats("age_index");
+            assert(stats.total_entries == 21);
+            assert(stats.unique_values == 5);
+        }
+        std::cout << "✓ 精确/范围/前缀查询测试通过\n\n";
+    }
+
+    void test_update_and_delete() {
+        std::cout << "测试更新与删除（查询回表过滤过期条目）...\n";
+        cleanup();
+        {
+            KVDB db(WAL_FILE);
+            assert(db.create_secondary_index("color_index", "value"));
+
+            db.put("car_1", "red");
+            db.put("car_2", "red");
+            db.put("car_3", "blue");
+
+            db.put("car_1", "green");   // 旧条目 red/car_1 保留，但已过期
+            db.del("car_2");            // 旧条目 red/car_2 保留，但主记录已删除
+
+            assert(exact(db, "color_index", "red").keys.empty());
+            assert(exact(db, "color_index", "green").keys == std::vector<std::string>{"car_1"});
+            assert(exact(db, "color_index", "blue").keys == std::vector<std::string>{"car_3"});
+
+            // 同一主键改回旧值：条目重新生效
+            db.put("car_1", "red");
+            assert(exact(db, "color_index", "red").keys == std::vector<std::string>{"car_1"});
+            assert(exact(db, "color_index", "green").keys.empty());
+        }
+        std::cout << "✓ 更新与删除测试通过\n\n";
+    }
+
+    void test_composite_index() {
+        std::cout << "测试复合索引...\n";
+        cleanup();
+        {
+            KVDB db(WAL_FILE);
+            db.put("k1", "v1");
+            db.put("k2", "v2");
+            assert(db.create_composite_index("kv_index", {"key", "value"}));
+
+            IndexQuery query(QueryType::EXACT_MATCH, "key", "");
+            query.terms = {"k1", "v1"};
+            auto result = db.get_index_manager().lookup("kv_index", query);
+            assert(result.success);
+            assert(result.keys == std::vector<std::string>{"k1"});
+
+            IndexQuery prefix(QueryType::PREFIX_MATCH, "key", "");
+            prefix.terms = {"k2"};
+            result = db.get_index_manager().lookup("kv_index", prefix);
+            assert(result.keys == std::vector<std::string>{"k2"});
+        }
+        std::cout << "✓ 复合索引测试通过\n\n";
+    }
+
+    void test_unique_constraint() {
+        std::cout << "测试唯一约束...\n";
+        cleanup();
+        {
+            KVDB db(WAL_FILE);
+            assert(db.create_secondary_index("email_index", "value", true));
+
+            assert(db.put("u1", "a@x.com"));
+            assert(!db.put("u2", "a@x.com"));       // 冲突：整批不写入
+            std::string value;
+            assert(!db.get("u2", value));
+
+            assert(db.put("u1", "a@x.com"));        // 同一主键重复写入不算冲突
+            db.put("u1", "b@x.com");
+            assert(db.put("u2", "a@x.com"));        // 旧值已过期，可被其他主键使用
+        }
+        std::cout << "✓ 唯一约束测试通过\n\n";
+    }
+
+    void test_stale_entry_detection() {
+        std::cout << "测试 compaction 过期条目判定...\n";
+        cleanup();
+        {
+            KVDB db(WAL_FILE);
+            assert(db.create_secondary_index("s_index", "value"));
+            db.put("p1", "old");
+            db.put("p1", "new");
+
+            IndexManager& manager = db.get_index_manager();
+            assert(manager.is_stale_index_entry(PersistentIndex::encode_entry_key("s_index", "old", "p1")));
+            assert(!manager.is_stale_index_entry(PersistentIndex::encode_entry_key("s_index", "new", "p1")));
+
+            // 索引删除后，其全部条目都视为过期
+            assert(db.drop_index("s_index"));
+            assert(manager.is_stale_index_entry(PersistentIndex::encode_entry_key("s_index", "new", "p1")));
+        }
+        std::cout << "✓ 过期条目判定测试通过\n\n";
+    }
+
+    void test_recovery_from_wal() {
+        std::cout << "测试重启后索引恢复...\n";
+        cleanup();
+        {
+            KVDB db(WAL_FILE);
+            db.put("a", "x");
+            assert(db.create_secondary_index("x_index", "value"));
+            db.put("b", "x");
+        }
+        {
+            // 索引定义和条目都随 WAL 重放恢复，不需要重建
+            KVDB db(WAL_FILE);
+            auto indexes = db.list_indexes();
+            assert(indexes.size() == 1 && indexes[0].name == "x_index");
+            assert(sorted(exact(db, "x_index", "x").keys) == sorted({"a", "b"}));
+        }
+        std::cout << "✓ 重启恢复测试通过\n\n";
+    }
+
+    void test_torn_batch_discarded() {
+        std::cout << "测试 WAL 尾部不完整批被整体丢弃...\n";
+        cleanup();
+        {
+            std::ofstream wal(WAL_FILE);
+            wal << "PUT solo 1\n";
+            wal << "BATCH 2\n";
+            wal << "PUT b1 v1\n";
+            wal << "PUT b2 v2\n";
+            wal << "BATCH 3\n";
+            wal << "PUT t1 v1\n";
+            wal << "PUT t2 v2\n";      // 崩溃截断：缺少第 3 条记录
+        }
+        {
+            KVDB db(WAL_FILE);
+            std::string value;
+            assert(db.get("solo", value) && value == "1");
+            assert(db.get("b1", value) && value == "v1");
+            assert(db.get("b2", value) && value == "v2");
+            assert(!db.get("t1", value));
+            assert(!db.get("t2", value));
+        }
+        std::cout << "✓ 不完整批丢弃测试通过\n\n";
+    }
+};
+
+int main() {
+    PersistentIndexTest test;
+    test.run_all_tests();
+    return 0;
+}
@@ -0,0 +1,65 @@
+#!/bin/bash
+
+echo "=== 持久化二级索引测试 ==="
+
+# 清理之前的数据
+rm -f test_persistent_index test_persistent_index.wal MANIFEST
+rm -rf data/
+
+echo "编译持久化索引测试..."
+
+if g++ -std=c++17 -O2 -I. -Isrc \
+    test_persistent_index.cpp \
+    src/db/kv_db.cpp \
+    src/monitoring/metrics_registry.cpp \
+    src/db/write_batch.cpp \
+    src/storage/memtable.cpp \
+    src/storage/range_tombstone.cpp \
+    src/storage/merge_operator.cpp \
+    src/log/wal.cpp \
+    src/sstable/sstable_writer.cpp \
+    src/sstable/sstable_reader.cpp \
+    src/sstable/sstable_meta_util.cpp \
+    src/sstable/block_index.cpp \
+    src/sstable/data_block.cpp \
+    src/compaction/compactor.cpp \
+    src/blob/blob_file.cpp \
+    src/blob/blob_manager.cpp \
+    src/blob/blob_iterator.cpp \
+    src/compaction/compaction_filter.cpp \
+    src/iterator/ttl_iterator.cpp \
+    src/compaction/compaction_strategy.cpp \
+    src/bloom/bloom_filter.cpp \
+    src/cache/block_cache.cpp \
+    src/cache/cache_manager.cpp \
+    src/cache/multi_level_cache.cpp \
+    src/version/version_set.cpp \
+    src/snapshot/snapshot_manager.cpp \
+    src/iterator/memtable_iterator.cpp \
+    src/iterator/sstable_iterator.cpp \
+    src/iterator/merge_iterator.cpp \
+    src/iterator/concurrent_iterator.cpp \
+    src/index/secondary_index.cpp \
+    src/index/composite_index.cpp \
+    src/index/tokenizer.cpp \
+    src/index/posting_list.cpp \
+    src/index/fulltext_index.cpp \
+    src/index/inverted_index.cpp \
+    src/index/index_manager.cpp \
+    src/index/persistent_index.cpp \
+    -o test_persistent_index -pthread; then
+
+    echo "编译成功，运行测试..."
+    echo ""
+    ./test_persistent_index > test_persistent_index.log 2>&1
+    status=$?
+    grep -E "✓|===" test_persistent_index.log
+    if [ $status -ne 0 ]; then
+        tail -20 test_persistent_index.log
+    fi
+    rm -f test_persistent_index test_persistent_index.log
+    exit $status
+else
+    echo "编译失败！请检查错误信息。"
+    exit 1
+fi
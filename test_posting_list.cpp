@@ -0,0 +1,453 @@
+#include "src/index/posting_list.h"
+#include "src/index/inverted_index.h"
+#include "src/index/fulltext_index.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <algorithm>
+#include <cassert>
+#include <random>
+#include <cmath>
+
+class PostingListTest {
+public:
+    void run_all_tests() {
+        std::cout << "=== 压缩倒排列表测试 ===\n\n";
+
+        test_round_trip();
+        test_advance_across_blocks();
+        test_intersect_and_unite();
+        test_positions();
+        test_inverted_index_queries();
+        test_delete_and_compaction();
+        test_fulltext_index();
+        test_serialize_round_trip();
+        test_memory_reduction();
+        test_top_k_matches_exhaustive();
+        test_top_k_prunes();
+
+        std::cout << "=== 所有测试完成 ===\n";
+    }
+
+private:
+    static CompressedPostingList make_list(const std::vector<uint32_t>& docs) {
+        CompressedPostingList list("t");
+        for (uint32_t doc : docs) {
+            uint32_t pos[2] = {doc % 7, doc % 7 + 3};
+            list.append(doc, 2, pos, 2);
+        }
+        return list;
+    }
+
+    static std::vector<uint32_t> collect(const CompressedPostingList& list) {
+        std::vector<uint32_t> docs;
+        for (PostingIterator it(&list); it.valid(); it.next()) {
+            docs.push_back(it.doc());
+        }
+        return docs;
+    }
+
+    void test_round_trip() {
+        std::cout << "测试编码/解码往返...\n";
+
+        std::vector<uint32_t> docs;
+        for (uint32_t i = 0; i < 1000; ++i) {
+            docs.push_back(i * 3 + (i % 5) * 100000);
+        }
+        std::sort(docs.begin(), docs.end());
+        docs.erase(std::unique(docs.begin(), docs.end()), docs.end());
+
+        CompressedPostingList list = make_list(docs);
+        assert(list.size() == docs.size());
+        assert(list.block_count() == (docs.size() + CompressedPostingList::BLOCK_SIZE - 1) /
+                                     CompressedPostingList::BLOCK_SIZE);
+        assert(collect(list) == docs);
+
+        for (PostingIterator it(&list); it.valid(); it.next()) {
+            assert(it.freq() == 2);
+        }
+
+        std::vector<uint8_t> buf;
+        posting::put_varint(buf, 0);
+        posting::put_varint(buf, 300);
+        posting::put_varint(buf, UINT32_MAX - 1);
+        const uint8_t* p = buf.data();
+        assert(posting::get_varint(p) == 0);
+        assert(posting::get_varint(p) == 300);
+        assert(posting::get_varint(p) == UINT32_MAX - 1);
+        assert(p == buf.data() + buf.size());
+
+        std::cout << "✓ 编码/解码往返测试通过\n\n";
+    }
+
+    void test_advance_across_blocks() {
+        std::cout << "测试跳表 advance...\n";
+
+        std::vector<uint32_t> docs;
+        for (uint32_t i = 0; i < 5000; ++i) {
+            docs.push_back(i * 2);   // 只有偶数
+        }
+        CompressedPostingList list = make_list(docs);
+
+        // 每个目标都与 std::lower_bound 对照
+        for (uint32_t target : {0u, 1u, 255u, 256u, 257u, 4097u, 9998u, 9999u, 20000u}) {
+            PostingIterator it(&list);
+            it.advance(target);
+            auto expected = std::lower_bound(docs.begin(), docs.end(), target);
+            if (expected == docs.end()) {
+                assert(!it.valid());
+            } else {
+                assert(it.valid() && it.doc() == *expected);
+            }
+        }
+
+        // 单调递增的一串 advance（跨块、块内混合）
+        PostingIterator it(&list);
+        for (uint32_t target = 3; target < 10000; target += 37) {
+            it.advance(target);
+            assert(it.valid());
+            assert(it.doc() == *std::lower_bound(docs.begin(), docs.end(), target));
+        }
+
+        // 目标小于当前位置时不后退
+        uint32_t current = it.doc();
+        it.advance(1);
+        assert(it.doc() == current);
+
+        std::cout << "✓ 跳表 advance 测试通过\n\n";
+    }
+
+    void test_intersect_and_unite() {
+        std::cout << "测试多路求交/求并...\n";
+
+        std::vector<uint32_t> a, b, c;
+        for (uint32_t i = 0; i < 3000; ++i) {
+            a.push_back(i * 2);
+            b.push_back(i * 3);
+        }
+        for (uint32_t i = 0; i < 50; ++i) {
+            c.push_back(i * 120 + 6);
+        }
+        CompressedPostingList la = make_list(a), lb = make_list(b), lc = make_list(c);
+
+        std::vector<PostingIterator> iters{PostingIterator(&la), PostingIterator(&lb), PostingIterator(&lc)};
+        std::vector<uint32_t> got;
+        posting::intersect(iters, [](uint32_t) { return true; },
+                           [&](uint32_t doc) { got.push_back(doc); });
+
+        std::vector<uint32_t> expected;
+        for (uint32_t doc : c) {
+            if (doc % 2 == 0 && doc % 3 == 0 && doc < 6000) {
+                expected.push_back(doc);
+            }
+        }
+        assert(got == expected);
+
+        // accept 过滤（模拟已删除文档）
+        std::vector<PostingIterator> iters2{PostingIterator(&la), PostingIterator(&lb)};
+        size_t count = 0;
+        posting::intersect(iters2, [](uint32_t doc) { return doc % 4 == 0; },
+                           [&](uint32_t doc) { assert(doc % 12 == 0); count++; });
+        assert(count == 500);
+
+        std::vector<PostingIterator> iters3{PostingIterator(&lb), PostingIterator(&lc)};
+        std::vector<uint32_t> united;
+        posting::unite(iters3, [](uint32_t) { return true; },
+                       [&](uint32_t doc) { united.push_back(doc); });
+        std::vector<uint32_t> merged;
+        std::set_union(b.begin(), b.end(), c.begin(), c.end(), std::back_inserter(merged));
+        assert(united == merged);
+
+        std::cout << "✓ 多路求交/求并测试通过\n\n";
+    }
+
+    void test_positions() {
+        std::cout << "测试位置流按需解码...\n";
+
+        CompressedPostingList list("t");
+        for (uint32_t doc = 0; doc < 300; ++doc) {
+            std::vector<uint32_t> pos;
+            for (uint32_t k = 0; k <= doc % 4; ++k) {
+                pos.push_back(doc + k * 10);
+            }
+            list.append(doc, static_cast<uint32_t>(pos.size()), pos.data(), pos.size());
+        }
+
+        PostingIterator it(&list);
+        for (uint32_t doc : {5u, 130u, 131u, 299u}) {
+            it.advance(doc);
+            std::vector<uint32_t> pos = it.positions();
+            assert(it.freq() == doc % 4 + 1);
+            assert(pos.size() == doc % 4 + 1);
+            for (uint32_t k = 0; k < pos.size(); ++k) {
+                assert(pos[k] == doc + k * 10);
+            }
+        }
+
+        std::cout << "✓ 位置流测试通过\n\n";
+    }
+
+    void test_inverted_index_queries() {
+        std::cout << "测试 InvertedIndex 查询...\n";
+
+        InvertedIndex index("idx", "value");
+        index.add_document("d1", "quick brown fox jumps");
+        index.add_document("d2", "brown fox quick");
+        index.add_document("d3", "lazy dog sleeps");
+        index.add_document("d4", "quick dog");
+        // BM25 的 IDF 要求词条出现在不到一半的文档中才为正，补几篇无关文档
+        for (int i = 0; i < 6; ++i) {
+            index.add_document("filler" + std::to_string(i), "unrelated filler text");
+        }
+
+        assert(index.document_count() == 10);
+        assert(index.search_term("quick") == (std::vector<std::string>{"d1", "d2", "d4"}));
+        assert(index.search_terms_and({"quick", "fox"}) == (std::vector<std::string>{"d1", "d2"}));
+        assert(index.search_terms_and({"quick", "missing"}).empty());
+        assert(index.search_terms_or({"fox", "dog"}) == (std::vector<std::string>{"d1", "d2", "d3", "d4"}));
+
+        // 短语：brown fox 在 d1、d2 都相邻；quick brown 只在 d1
+        assert(index.phrase_search({"brown", "fox"}) == (std::vector<std::string>{"d1", "d2"}));
+        assert(index.phrase_search({"quick", "brown"}) == (std::vector<std::string>{"d1"}));
+        assert(index.phrase_search({"fox", "brown"}).empty());
+
+        auto ranked = index.ranked_search({"quick", "dog"});
+        assert(!ranked.empty());
+        assert(ranked[0].document_id == "d4");
+        assert(ranked[0].matched_terms.size() == 2);
+
+        // 重新索引：旧内容不再可查
+        index.add_document("d1", "slow turtle");
+        assert(index.search_term("fox") == (std::vector<std::string>{"d2"}));
+        assert(index.search_term("turtle") == (std::vector<std::string>{"d1"}));
+        assert(index.document_count() == 10);
+
+        std::cout << "✓ InvertedIndex 查询测试通过\n\n";
+    }
+
+    void test_delete_and_compaction() {
+        std::cout << "测试删除标记与 compaction...\n";
+
+        InvertedIndex index("idx", "value");
+        const int total = 3000;
+        for (int i = 0; i < total; ++i) {
+            index.add_document("doc" + std::to_string(i),
+                               "common term" + std::to_string(i % 10));
+        }
+        assert(index.total_postings() == total * 2);
+
+        // 删除 80%：超过阈值后会重排 ID，已删除文档的 posting 被丢弃
+        for (int i = 0; i < total; ++i) {
+            if (i % 5 != 0) {
+                index.remove_document("doc" + std::to_string(i));
+            }
+        }
+        assert(index.document_count() == total / 5);
+        assert(index.total_postings() < total * 2);
+
+        auto common = index.search_term("common");
+        assert(common.size() == static_cast<size_t>(total / 5));
+        auto term0 = index.search_term("term0");
+        assert(term0.size() == static_cast<size_t>(total / 10));
+        assert(index.search_term("term1").empty());
+
+        // compaction 之后仍可继续追加
+        index.add_document("late", "common term1");
+        assert(index.search_term("term1") == (std::vector<std::string>{"late"}));
+
+        std::cout << "✓ 删除与 compaction 测试通过\n\n";
+    }
+
+    void test_fulltext_index() {
+        std::cout << "测试 FullTextIndex...\n";
+
+        FullTextIndex index("ft", "value");
+        index.index_document("a", "database storage engine");
+        index.index_document("b", "storage database engine");
+        index.index_document("c", "key value storage");
+
+        assert(index.search("storage") == (std::vector<std::string>{"a", "b", "c"}));
+        assert(index.search("database engine") == (std::vector<std::string>{"a", "b"}));
+
+        // 短语查询现在检查位置
+        assert(index.phrase_search({"database", "storage"}) == (std::vector<std::string>{"a"}));
+        assert(index.phrase_search({"storage", "engine"}) == (std::vector<std::string>{"a"}));
+
+        assert(index.wildcard_search("stor*") == (std::vector<std::string>{"a", "b", "c"}));
+
+        auto ranked = index.ranked_search("key database");
+        assert(ranked.size() == 3 || ranked.size() == 2);
+
+        index.remove_document("a");
+        assert(index.document_count() == 2);
+        assert(index.search("database") == (std::vector<std::string>{"b"}));
+
+        std::cout << "✓ FullTextIndex 测试通过\n\n";
+    }
+
+    void test_serialize_round_trip() {
+        std::cout << "测试序列化往返...\n";
+
+        InvertedIndex index("idx", "value");
+        index.add_document("x", "alpha beta gamma");
+        index.add_document("y", "beta gamma delta");
+        index.add_document("z", "gone");
+        index.remove_document("z");
+
+        std::stringstream ss;
+        index.serialize(ss);
+        InvertedIndex loaded("", "");
+        loaded.deserialize(ss);
+
+        assert(loaded.document_count() == 2);
+        assert(loaded.search_term("gone").empty());
+        assert(loaded.search_terms_and({"beta", "gamma"}) == (std::vector<std::string>{"x", "y"}));
+        assert(loaded.phrase_search({"alpha", "beta"}) == (std::vector<std::string>{"x"}));
+
+        FullTextIndex ft("ft", "value");
+        ft.index_document("x", "alpha beta");
+        ft.index_document("y", "beta alpha");
+        std::stringstream fs;
+        ft.serialize(fs);
+        FullTextIndex ft_loaded("", "");
+        ft_loaded.deserialize(fs);
+        assert(ft_loaded.document_count() == 2);
+        assert(ft_loaded.search("alpha beta") == (std::vector<std::string>{"x", "y"}));
+
+        std::cout << "✓ 序列化往返测试通过\n\n";
+    }
+
+    void test_memory_reduction() {
+        std::cout << "测试压缩效果...\n";
+
+        CompressedPostingList list("t");
+        const uint32_t count = 100000;
+        for (uint32_t doc = 0; doc < count; ++doc) {
+            uint32_t pos = doc % 50;
+            list.append(doc * 3, 1, &pos, 1);
+        }
+
+        // 未压缩时每个 posting 至少需要 doc + freq + 一个位置 共 12 字节
+        size_t raw = count * 3 * sizeof(uint32_t);
+        size_t compressed = list.memory_usage();
+        std::cout << "  未压缩: " << raw << " 字节, 压缩后: " << compressed << " 字节\n";
+        assert(compressed * 2 < raw);
+
+        std::cout << "✓ 压缩效果测试通过\n\n";
+    }
+
+    // 构造随机列表：词频、文档长度都随机，打分函数取 BM25 形式
+    struct RandomTerm {
+        CompressedPostingList list;
+        std::vector<uint32_t> docs;
+        std::vector<uint32_t> freqs;
+        double idf;
+    };
+
+    static double bm25(uint32_t tf, uint32_t len, double idf) {
+        return idf * tf * 2.2 / (tf + 1.2 * (0.25 + 0.75 * len / 20.0));
+    }
+
+    void test_top_k_matches_exhaustive() {
+        std::cout << "测试 Block-Max WAND 与穷举结果一致...\n";
+
+        std::mt19937 rng(42);
+        const uint32_t universe = 20000;
+        std::vector<uint32_t> lengths(universe);
+        for (auto& len : lengths) {
+            len = 1 + rng() % 60;
+        }
+
+        for (int round = 0; round < 20; ++round) {
+            std::vector<RandomTerm> terms(2 + round % 3);
+            for (size_t t = 0; t < terms.size(); ++t) {
+                uint32_t density = 2 + rng() % 50;
+                terms[t].idf = 0.5 + (rng() % 100) / 20.0;
+                for (uint32_t doc = 0; doc < universe; ++doc) {
+                    if (rng() % density == 0) {
+                        uint32_t freq = 1 + rng() % 8;
+                        terms[t].list.append(doc, freq, nullptr, 0, lengths[doc]);
+                        terms[t].docs.push_back(doc);
+                        terms[t].freqs.push_back(freq);
+                    }
+                }
+            }
+
+            // 穷举打分（跳过 ID 为 7 的倍数的“已删除”文档）
+            std::vector<double> scores(universe, 0.0);
+            for (const auto& term : terms) {
+                for (size_t i = 0; i < term.docs.size(); ++i) {
+                    scores[term.docs[i]] += bm25(term.freqs[i], lengths[term.docs[i]], term.idf);
+                }
+            }
+            std::vector<std::pair<double, uint32_t>> expected;
+            for (uint32_t doc = 0; doc < universe; ++doc) {
+                if (scores[doc] > 0 && doc % 7 != 0) {
+                    expected.emplace_back(scores[doc], doc);
+                }
+            }
+            std::sort(expected.rbegin(), expected.rend());
+
+            for (size_t k : {1u, 10u, 100u}) {
+                std::vector<posting::ScoredCursor> cursors;
+                for (const auto& term : terms) {
+                    double idf = term.idf;
+                    cursors.emplace_back(&term.list,
+                        [&lengths, idf](uint32_t doc, uint32_t freq) { return bm25(freq, lengths[doc], idf); },
+                        [idf](uint32_t max_freq, uint32_t min_length) { return bm25(max_freq, min_length, idf); });
+                }
+                auto top = posting::top_k(cursors, k, [](uint32_t doc) { return doc % 7 != 0; });
+
+                assert(top.size() == std::min(k, expected.size()));
+                for (size_t i = 0; i < top.size(); ++i) {
+                    // 得分相同的文档可能次序不同，只比较得分
+                    assert(std::fabs(top[i].second - expected[i].first) < 1e-9);
+                    assert(std::fabs(scores[top[i].first] - top[i].second) < 1e-9);
+                }
+            }
+        }
+
+        std::cout << "✓ Block-Max WAND 与穷举结果一致\n\n";
+    }
+
+    void test_top_k_prunes() {
+        std::cout << "测试 Block-Max WAND 剪枝...\n";
+
+        // 一个高频低权重词 + 一个稀有高权重词：前 10 名几乎都来自稀有词
+        CompressedPostingList common("common"), rare("rare");
+        const uint32_t universe = 200000;
+        for (uint32_t doc = 0; doc < universe; ++doc) {
+            common.append(doc, 1, nullptr, 0, 20);
+            if (doc % 5000 == 0) {
+                rare.append(doc, 3, nullptr, 0, 10);
+            }
+        }
+
+        size_t scored = 0;
+        auto make_cursor = [&scored](const CompressedPostingList* list, double idf) {
+            return posting::ScoredCursor(list,
+                [&scored, idf](uint32_t, uint32_t freq) { scored++; return bm25(freq, 20, idf); },
+                [idf](uint32_t max_freq, uint32_t min_length) { return bm25(max_freq, min_length, idf); });
+        };
+        std::vector<posting::ScoredCursor> cursors;
+        cursors.push_back(make_cursor(&common, 0.1));
+        cursors.push_back(make_cursor(&rare, 5.0));
+
+        auto top = posting::top_k(cursors, 10, [](uint32_t) { return true; });
+        assert(top.size() == 10);
+        for (const auto& entry : top) {
+            assert(entry.first % 5000 == 0);
+        }
+        std::cout << "  打分 posting 数: " << scored << " / " << common.size() + rare.size() << "\n";
+        assert(scored < universe / 10);
+
+        std::cout << "✓ 剪枝测试通过\n\n";
+    }
+};
+
+int main() {
+    PostingListTest test;
+    test.run_all_tests();
+    return 0;
+}
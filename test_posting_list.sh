@@ -0,0 +1,24 @@
+#!/bin/bash
+
+echo "=== 压缩倒排列表测试 ==="
+
+echo "编译压缩倒排列表测试..."
+
+if g++ -std=c++17 -O2 -I. -Isrc \
+    test_posting_list.cpp \
+    src/index/tokenizer.cpp \
+    src/index/posting_list.cpp \
+    src/index/fulltext_index.cpp \
+    src/index/inverted_index.cpp \
+    -o test_posting_list -pthread; then
+
+    echo "编译成功，运行测试..."
+    echo ""
+    ./test_posting_list
+    status=$?
+    rm -f test_posting_list
+    exit $status
+else
+    echo "编译失败！请检查错误信息。"
+    exit 1
+fi
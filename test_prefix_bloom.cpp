@@ -0,0 +1,184 @@
+#include "src/db/kv_db.h"
+#include "src/storage/prefix_extractor.h"
+#include "src/sstable/sstable_meta_util.h"
+#include <iostream>
+#include <cassert>
+#include <filesystem>
+#include <vector>
+
+class PrefixBloomTest {
+public:
+    void run_all_tests() {
+        std::cout << "=== 前缀 Bloom Filter 测试 ===" << std::endl;
+
+        test_extractors();
+        test_sstable_prefix_bloom();
+        test_prefix_iterator();
+        test_extractor_change_and_range_delete();
+
+        reset();
+        std::cout << "🎉 所有前缀 Bloom Filter 测试通过！" << std::endl;
+    }
+
+private:
+    static constexpr const char* WAL_FILE = "test_prefix_bloom.wal";
+
+    void reset() {
+        std::filesystem::remove_all("data");
+        std::filesystem::remove(WAL_FILE);
+        std::filesystem::remove("COLUMN_FAMILIES");
+        std::filesystem::remove("BLOB_MANIFEST");
+        for (const auto& entry : std::filesystem::directory_iterator(".")) {
+            if (entry.path().filename().string().rfind("MANIFEST", 0) == 0) {
+                std::filesystem::remove(entry.path());
+            }
+        }
+    }
+
+    static ColumnFamilyOptions tenant_options() {
+        ColumnFamilyOptions options;
+        options.prefix_extractor = std::make_shared<DelimiterPrefixExtractor>(':');
+        return options;
+    }
+
+    static std::vector<SSTableMeta> sstable_metas() {
+        std::vector<SSTableMeta> metas;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator("data")) {
+            if (entry.path().extension() == ".dat") {
+                metas.push_back(SSTableMetaUtil::get_meta_from_file(entry.path().string()));
+            }
+        }
+        return metas;
+    }
+
+    static std::vector<std::string> scan_prefix(KVDB& db, ColumnFamilyHandle* cf, const std::string& prefix) {
+        std::vector<std::string> keys;
+        Snapshot snapshot = db.get_snapshot();
+        auto it = db.new_prefix_iterator(cf, snapshot, prefix);
+        for (; it->valid(); it->next()) {
+            keys.push_back(it->key());
+        }
+        db.release_snapshot(snapshot);
+        return keys;
+    }
+
+    void test_extractors() {
+        std::cout << "\n1. 测试前缀提取器..." << std::endl;
+        FixedPrefixExtractor fixed(3);
+        assert(fixed.in_domain("abcd") && fixed.transform("abcd") == "abc");
+        assert(fixed.in_domain("abc") && !fixed.in_domain("ab"));
+        assert(fixed.name() == "fixed:3");
+
+        DelimiterPrefixExtractor delimiter(':');
+        assert(delimiter.in_domain("user:42:name") && delimiter.transform("user:42:name") == "user:");
+        assert(delimiter.transform("user:") == "user:");
+        assert(!delimiter.in_domain("user"));
+        std::cout << "   ✓ 定长与分隔符前缀；不在定义域内的 key 没有前缀" << std::endl;
+    }
+
+    void test_sstable_prefix_bloom() {
+        std::cout << "\n2. 测试 SSTable 前缀 Bloom Filter..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        ColumnFamilyHandle* cf = db.create_column_family("tenants", tenant_options());
+        // a: 与 c: 在同一个文件中，b: 落在它的键范围内但不在文件里
+        for (int i = 0; i < 20; i++) {
+            assert(db.put(cf, "a:" + std::to_string(i), "v"));
+            assert(db.put(cf, "c:" + std::to_string(i), "v"));
+        }
+        db.flush(cf);
+        auto metas = sstable_metas();
+        assert(metas.size() == 1);
+        const SSTableMeta& meta = metas[0];
+        assert(meta.prefix_bloom && meta.prefix_bloom->extractor == "delimiter::");
+
+        DelimiterPrefixExtractor extractor(':');
+        assert(meta.may_contain_prefix("a:", &extractor));
+        assert(meta.may_contain_prefix("c:1", &extractor));
+        assert(!meta.may_contain_prefix("b:", &extractor));
+        assert(!meta.may_contain_prefix("b:7", &extractor));
+        assert(!meta.may_contain_prefix("d:", nullptr));   // 键范围之外，不需要过滤器
+        assert(meta.may_contain_prefix("b", &extractor));  // 不在定义域内，不能按前缀过滤
+        FixedPrefixExtractor other(2);
+        assert(meta.may_contain_prefix("b:", &other));     // 提取器名称不一致
+
+        // 没有前缀提取器的列族不写前缀块，footer 与原来相同
+        db.put("plain", "v");
+        db.flush(db.default_column_family());
+        size_t without_bloom = 0;
+        for (const auto& m : sstable_metas()) {
+            without_bloom += m.prefix_bloom ? 0 : 1;
+        }
+        assert(without_bloom == 1);
+        std::cout << "   ✓ 键范围内但前缀不存在的文件被排除，不能判断时保守地认为可能存在" << std::endl;
+    }
+
+    void test_prefix_iterator() {
+        std::cout << "\n3. 测试前缀扫描跳过文件后的结果..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        ColumnFamilyHandle* cf = db.create_column_family("tenants", tenant_options());
+        for (int round = 0; round < 4; round++) {
+            for (int i = 0; i < 5; i++) {
+                std::string suffix = std::to_string(round) + "_" + std::to_string(i);
+                assert(db.put(cf, "t" + std::to_string(round) + ":" + suffix, "v"));
+                assert(db.put(cf, "shared:" + suffix, "v"));
+            }
+            db.flush(cf);
+        }
+        assert(db.put(cf, "t1:mem", "v"));  // MemTable 中的数据同样可见
+        assert(db.del(cf, "t1:1_0"));
+
+        auto keys = scan_prefix(db, cf, "t1:");
+        assert(keys.size() == 5);
+        assert(keys.front() == "t1:1_1" && keys.back() == "t1:mem");
+        assert(scan_prefix(db, cf, "shared:").size() == 20);
+        assert(scan_prefix(db, cf, "t2:2_3").size() == 1);
+        assert(scan_prefix(db, cf, "t").size() == 20);  // 短于前缀，逐个文件查找
+        assert(scan_prefix(db, cf, "zz:").empty());
+
+        // 压缩后的文件同样带前缀 Bloom Filter
+        db.compact(cf);
+        for (const auto& meta : sstable_metas()) {
+            assert(meta.prefix_bloom);
+        }
+        assert(scan_prefix(db, cf, "t3:").size() == 5);
+        std::cout << "   ✓ 前缀扫描的结果与逐个文件查找一致，MemTable 与删除照常生效" << std::endl;
+    }
+
+    void test_extractor_change_and_range_delete() {
+        std::cout << "\n4. 测试更换提取器与范围删除..." << std::endl;
+        reset();
+        {
+            KVDB db(WAL_FILE);
+            ColumnFamilyHandle* cf = db.create_column_family("tenants", tenant_options());
+            for (int i = 0; i < 10; i++) {
+                assert(db.put(cf, "a:" + std::to_string(i), "v"));
+                assert(db.put(cf, "b:" + std::to_string(i), "v"));
+            }
+            db.flush(cf);
+            // 只有范围删除的文件不能因前缀不存在而跳过：它覆盖更旧文件中的 key
+            assert(db.delete_range(cf, "b:3", "b:6"));
+            db.flush(cf);
+            assert(scan_prefix(db, cf, "b:").size() == 7);
+        }
+        {
+            KVDB db(WAL_FILE);
+            ColumnFamilyOptions options;
+            options.prefix_extractor = std::make_shared<FixedPrefixExtractor>(1);
+            ColumnFamilyHandle* cf = db.create_column_family("tenants", options);
+            assert(scan_prefix(db, cf, "a:").size() == 10);
+            assert(scan_prefix(db, cf, "b:").size() == 7);
+            assert(db.put(cf, "c:1", "v"));
+            db.flush(cf);
+            assert(scan_prefix(db, cf, "c").size() == 1);
+        }
+        std::cout << "   ✓ 重启后更换提取器，旧文件不按前缀过滤；范围删除照常生效" << std::endl;
+    }
+};
+
+int main() {
+    PrefixBloomTest test;
+    test.run_all_tests();
+    return 0;
+}
@@ -0,0 +1,283 @@
+#include "src/db/kv_db.h"
+#include "src/db/write_batch.h"
+#include "src/storage/range_tombstone.h"
+#include "src/sstable/sstable_meta_util.h"
+#include <iostream>
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+class RangeDeleteTest {
+public:
+    void run_all_tests() {
+        std::cout << "=== 范围删除（DeleteRange）测试 ===" << std::endl;
+
+        test_fragmentation();
+        test_get_and_snapshot();
+        test_iterators();
+        test_persistence();
+        test_compaction_drops_covered_data();
+        test_column_family_and_batch();
+
+        reset();
+        std::cout << "🎉 所有范围删除测试通过！" << std::endl;
+    }
+
+private:
+    static constexpr const char* WAL_FILE = "test_range_delete.wal";
+
+    void reset() {
+        std::filesystem::remove_all("data");
+        std::filesystem::remove(WAL_FILE);
+        std::filesystem::remove("COLUMN_FAMILIES");
+        std::filesystem::remove("BLOB_MANIFEST");
+        for (const auto& entry : std::filesystem::directory_iterator(".")) {
+            if (entry.path().filename().string().rfind("MANIFEST", 0) == 0) {
+                std::filesystem::remove(entry.path());
+            }
+        }
+    }
+
+    static std::string key(int i) {
+        return std::string("k") + (i < 10 ? "0" : "") + std::to_string(i);
+    }
+
+    static std::vector<std::string> scan(KVDB& db, bool reverse = false) {
+        std::vector<std::string> keys;
+        Snapshot snapshot = db.get_snapshot();
+        auto it = db.new_iterator(snapshot);
+        if (reverse) {
+            for (it->seek_to_last(); it->valid(); it->prev()) {
+                keys.push_back(it->key());
+            }
+        } else {
+            for (it->seek_to_first(); it->valid(); it->next()) {
+                keys.push_back(it->key());
+            }
+        }
+        db.release_snapshot(snapshot);
+        return keys;
+    }
+
+    static std::vector<std::string> sstable_files() {
+        std::vector<std::string> files;
+        for (const auto& entry : std::filesystem::directory_iterator("data")) {
+            if (entry.path().extension() == ".dat") {
+                files.push_back(entry.path().string());
+            }
+        }
+        return files;
+    }
+
+    void test_fragmentation() {
+        std::cout << "\n1. 测试范围删除碎片化..." << std::endl;
+        FragmentedRangeTombstoneList list({{"a", "e", 5}, {"c", "g", 7}, {"x", "z", 3}, {"q", "p", 9}});
+        const auto& fragments = list.fragments();
+        assert(fragments.size() == 4);
+        assert(fragments[0].start == "a" && fragments[0].end == "c" && fragments[0].seqs == std::vector<uint64_t>{5});
+        assert(fragments[1].start == "c" && fragments[1].end == "e" &&
+               (fragments[1].seqs == std::vector<uint64_t>{7, 5}));
+        assert(fragments[2].start == "e" && fragments[2].end == "g");
+        assert(fragments[3].start == "x" && fragments[3].end == "z");
+
+        uint64_t seq = 0;
+        assert(list.max_covering_seq("d", UINT64_MAX, seq) && seq == 7);
+        assert(list.max_covering_seq("d", 6, seq) && seq == 5);
+        assert(!list.max_covering_seq("d", 4, seq));
+        assert(!list.max_covering_seq("g", UINT64_MAX, seq));  // end 不含
+        assert(!list.max_covering_seq("p", UINT64_MAX, seq));  // 空范围被忽略
+
+        assert(list.covers_range("b", "f", UINT64_MAX, seq) && seq == 5);
+        assert(!list.covers_range("b", "g", UINT64_MAX, seq));
+        assert(!list.covers_range("f", "y", UINT64_MAX, seq));
+
+        // 首尾相接且序列号相同的片段合并
+        FragmentedRangeTombstoneList merged({{"a", "c", 4}, {"c", "f", 4}});
+        assert(merged.size() == 1 && merged.smallest_key() == "a" && merged.largest_key() == "f");
+        assert(list.to_tombstones().size() == 5);
+        assert(list.to_tombstones(true).size() == 4);
+        std::cout << "   ✓ 重叠范围切成互不重叠的片段，按快照取可见的最大序列号" << std::endl;
+    }
+
+    void test_get_and_snapshot() {
+        std::cout << "\n2. 测试点查与快照语义..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        for (int i = 0; i < 20; i++) {
+            assert(db.put(key(i), "v" + std::to_string(i)));
+        }
+        Snapshot before = db.get_snapshot();
+
+        assert(!db.delete_range("k10", "k05"));
+        assert(!db.delete_range("k05", "k05"));
+        assert(db.delete_range("k05", "k15"));
+        assert(db.put("k07", "new"));
+
+        std::string value;
+        assert(db.get("k04", value) && value == "v4");
+        assert(!db.get("k05", value));
+        assert(!db.get("k14", value));
+        assert(db.get("k15", value) && value == "v15");
+        assert(db.get("k07", value) && value == "new");
+        assert(db.get("k10", before, value) && value == "v10");
+        db.release_snapshot(before);
+
+        // 刷盘后同样生效：范围删除与被覆盖的旧版本在同一个 SSTable 中
+        db.flush();
+        assert(!db.get("k05", value));
+        assert(db.get("k07", value) && value == "new");
+        assert(db.get("k15", value) && value == "v15");
+
+        // 更新的 MemTable 范围删除覆盖 SSTable 中的数据
+        assert(db.delete_range("k00", "k03"));
+        assert(!db.get("k01", value));
+        assert(db.get("k03", value) && value == "v3");
+        std::cout << "   ✓ 范围内的旧版本不可见，之后写入的版本与快照读不受影响" << std::endl;
+    }
+
+    void test_iterators() {
+        std::cout << "\n3. 测试迭代器跳过被覆盖的区间..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        for (int i = 0; i < 20; i++) {
+            assert(db.put(key(i), "v"));
+        }
+        db.flush();
+        assert(db.delete_range("k05", "k15"));
+        assert(db.put("k09", "back"));
+
+        std::vector<std::string> expected = {"k00", "k01", "k02", "k03", "k04", "k09",
+                                             "k15", "k16", "k17", "k18", "k19"};
+        auto check = [&](const char* stage) {
+            assert(scan(db) == expected);
+            std::vector<std::string> reversed(expected.rbegin(), expected.rend());
+            assert(scan(db, true) == reversed);
+
+            Snapshot snapshot = db.get_snapshot();
+            auto it = db.new_prefix_iterator(snapshot, "k1");
+            std::vector<std::string> prefixed;
+            for (; it->valid(); it->next()) {
+                prefixed.push_back(it->key());
+            }
+            assert((prefixed == std::vector<std::string>{"k15", "k16", "k17", "k18", "k19"}));
+
+            it = db.new_iterator(snapshot);
+            it->seek("k06");
+            assert(it->valid() && it->key() == "k09");
+            it->seek_for_prev("k14");
+            assert(it->valid() && it->key() == "k09");
+            db.release_snapshot(snapshot);
+            std::cout << "   ✓ " << stage << std::endl;
+        };
+        check("范围删除在 MemTable 中：正向、反向、前缀与 seek 都跳过被覆盖的 key");
+
+        // 范围删除刷成只有范围删除块的 SSTable 后仍然生效
+        db.flush();
+        check("范围删除在 SSTable 中：结果不变");
+    }
+
+    void test_persistence() {
+        std::cout << "\n4. 测试 WAL 重放与 SSTable 持久化..." << std::endl;
+        reset();
+        {
+            KVDB db(WAL_FILE);
+            for (int i = 0; i < 10; i++) {
+                assert(db.put(key(i), "v"));
+            }
+            db.flush();
+            assert(db.delete_range("k02", "k04"));
+        }
+        std::string value;
+        {
+            KVDB db(WAL_FILE);  // 范围删除从 WAL 重放
+            assert(!db.get("k02", value) && !db.get("k03", value));
+            assert(db.get("k04", value));
+            assert(db.delete_range("k06", "k08"));
+            db.flush();
+        }
+        {
+            KVDB db(WAL_FILE);  // 范围删除从 SSTable 的范围删除块恢复
+            assert(!db.get("k02", value) && !db.get("k07", value));
+            assert(db.get("k01", value) && db.get("k08", value));
+            assert(scan(db).size() == 6);
+        }
+        std::cout << "   ✓ 重启后范围删除从 WAL 或 SSTable 恢复" << std::endl;
+    }
+
+    void test_compaction_drops_covered_data() {
+        std::cout << "\n5. 测试压缩丢弃被覆盖的数据与整个文件..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        for (int i = 0; i < 50; i++) {
+            assert(db.put("a" + std::to_string(i), "old"));
+        }
+        db.flush();  // 整个文件都落在 [a, b) 内
+        for (int i = 0; i < 10; i++) {
+            assert(db.put(key(i), "v"));
+        }
+        db.flush();  // 只有一部分落在范围内
+        assert(db.delete_range("a", "k05"));
+        db.flush();
+        // Leveled 策略在 L0 积累到 8 个文件时才压缩
+        for (int i = 0; i < 5; i++) {
+            assert(db.put("z" + std::to_string(i), "v"));
+            db.flush();
+        }
+        db.compact();
+
+        auto files = sstable_files();
+        assert(files.size() == 1);
+        std::ifstream in(files[0]);
+        std::stringstream content;
+        content << in.rdbuf();
+        assert(content.str().find("a1 ") == std::string::npos);
+        assert(content.str().find("k01 ") == std::string::npos);
+        // 输入之外没有更旧的文件，范围删除本身也被丢弃
+        assert(!SSTableMetaUtil::read_range_tombstones(files[0]));
+
+        std::string value;
+        assert(!db.get("a1", value) && !db.get("k04", value));
+        assert(db.get("k05", value) && db.get("z4", value));
+        assert(scan(db).size() == 10);
+        std::cout << "   ✓ 被覆盖的文件不再读取，部分覆盖的文件只保留范围外的 key" << std::endl;
+    }
+
+    void test_column_family_and_batch() {
+        std::cout << "\n6. 测试列族与批量写中的范围删除..." << std::endl;
+        reset();
+        KVDB db(WAL_FILE);
+        ColumnFamilyHandle* cf = db.create_column_family("tenants");
+        for (int i = 0; i < 10; i++) {
+            assert(db.put(cf, "t1_" + std::to_string(i), "v"));
+            assert(db.put(cf, "t2_" + std::to_string(i), "v"));
+            assert(db.put("t1_" + std::to_string(i), "default"));
+        }
+        assert(db.delete_range(cf, "t1_", "t1`"));
+
+        std::string value;
+        assert(!db.get(cf, "t1_3", value));
+        assert(db.get(cf, "t2_3", value));
+        assert(db.get("t1_3", value) && value == "default");  // 其他列族不受影响
+
+        WriteBatch batch;
+        batch.delete_range(cf, "t2_", "t2`");
+        batch.put(cf, "t2_5", "kept");
+        assert(db.write(batch));
+        assert(!db.get(cf, "t2_4", value));
+        assert(db.get(cf, "t2_5", value) && value == "kept");
+
+        db.flush(cf);
+        assert(!db.get(cf, "t1_3", value) && !db.get(cf, "t2_4", value));
+        assert(db.drop_column_family(cf));
+        assert(!db.delete_range(cf, "a", "b"));
+        std::cout << "   ✓ 范围删除只作用于所属列族，可在批内与其他写入原子提交" << std::endl;
+    }
+};
+
+int main() {
+    RangeDeleteTest test;
+    test.run_all_tests();
+    return 0;
+}
@@ -0,0 +1,349 @@
+#include "src/db/sharded_kv_db.h"
+#include "src/db/write_batch.h"
+#include <iostream>
+#include <cassert>
+#include <filesystem>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <set>
+#include <future>
+
+class ShardedKVDBTest {
+public:
+    void run_all_tests() {
+        std::cout << "=== 按核分片 KVDB 测试 ===" << std::endl;
+
+        test_routing();
+        test_independent_instances();
+        test_snapshot_and_scan();
+        test_cross_shard_batch_atomicity();
+        test_flush_and_restart();
+        test_owner_messages();
+        test_ycsb_a_scaling();
+
+        reset();
+        std::cout << "🎉 所有分片 KVDB 测试通过！" << std::endl;
+    }
+
+private:
+    static constexpr const char* DB_PATH = "test_sharded_db";
+
+    void reset() {
+        std::filesystem::remove_all(DB_PATH);
+        std::filesystem::remove_all("test_sharded_db_1");
+    }
+
+    static ShardedKVDBOptions options(size_t num_shards, bool owner_threads = true) {
+        ShardedKVDBOptions options;
+        options.num_shards = num_shards;
+        options.owner_threads = owner_threads;
+        return options;
+    }
+
+    static std::vector<std::pair<std::string, std::string>> scan(ShardedKVDB& db, const Snapshot& snapshot) {
+        std::vector<std::pair<std::string, std::string>> entries;
+        auto it = db.new_iterator(snapshot);
+        for (it->seek_to_first(); it->valid(); it->next()) {
+            entries.emplace_back(it->key(), it->value());
+        }
+        return entries;
+    }
+
+    void test_routing() {
+        std::cout << "\n1. 哈希路由" << std::endl;
+        reset();
+        ShardedKVDB db(DB_PATH, options(4));
+        assert(db.num_shards() == 4);
+
+        std::vector<size_t> per_shard(4, 0);
+        for (int i = 0; i < 200; i++) {
+            std::string key = "user" + std::to_string(i);
+            assert(db.put(key, "v" + std::to_string(i)));
+            per_shard[db.shard_for(key)]++;
+        }
+        for (size_t count : per_shard) {
+            assert(count > 20);
+        }
+
+        std::string value;
+        assert(db.get("user42", value) && value == "v42");
+        // 数据只在所属分片
+        size_t owner = db.shard_for("user42");
+        for (size_t i = 0; i < db.num_shards(); i++) {
+            std::string v;
+            assert(db.shard(i).get("user42", v) == (i == owner));
+        }
+        assert(db.del("user42"));
+        assert(!db.get("user42", value));
+        std::cout << "  ✓ 200 个 key 分布: " << per_shard[0] << "/" << per_shard[1] << "/"
+                  << per_shard[2] << "/" << per_shard[3] << std::endl;
+    }
+
+    void test_independent_instances() {
+        std::cout << "\n2. 同一进程内多个独立实例" << std::endl;
+        reset();
+        {
+            KVDB a("test_sharded_db_1/wal.log", "test_sharded_db_1");
+            assert(a.put("only_in_a", "1"));
+            a.flush();
+        }
+        assert(std::filesystem::exists("test_sharded_db_1/MANIFEST"));
+        assert(std::filesystem::exists("test_sharded_db_1/data"));
+        KVDB a("test_sharded_db_1/wal.log", "test_sharded_db_1");
+        std::string value;
+        assert(a.get("only_in_a", value) && value == "1");
+        std::cout << "  ✓ 数据目录、MANIFEST 与列族清单都放在实例目录下" << std::endl;
+    }
+
+    void test_snapshot_and_scan() {
+        std::cout << "\n3. 全局快照与跨分片扫描" << std::endl;
+        reset();
+        ShardedKVDB db(DB_PATH, options(4));
+        for (int i = 0; i < 50; i++) {
+            char key[16];
+            snprintf(key, sizeof(key), "k%03d", i);
+            assert(db.put(key, "old"));
+        }
+        Snapshot before = db.get_snapshot();
+
+        WriteBatch batch;
+        for (int i = 0; i < 50; i += 5) {
+            char key[16];
+            snprintf(key, sizeof(key), "k%03d", i);
+            batch.put(key, "new");
+        }
+        batch.put("z_added", "new");
+        batch.delete_range("k040", "k045");
+        assert(db.write(batch));
+        Snapshot after = db.get_snapshot();
+
+        auto old_entries = scan(db, before);
+        assert(old_entries.size() == 50);
+        for (size_t i = 0; i < old_entries.size(); i++) {
+            char key[16];
+            snprintf(key, sizeof(key), "k%03d", static_cast<int>(i));
+            assert(old_entries[i].first == key && old_entries[i].second == "old");
+        }
+
+        auto new_entries = scan(db, after);
+        assert(new_entries.size() == 50 - 5 + 1);
+        for (size_t i = 1; i < new_entries.size(); i++) {
+            assert(new_entries[i - 1].first < new_entries[i].first);
+        }
+        assert(new_entries.back().first == "z_added");
+
+        std::string value;
+        assert(db.get("k010", before, value) && value == "old");
+        assert(db.get("k010", after, value) && value == "new");
+        assert(!db.get("k041", after, value));
+
+        auto it = db.new_prefix_iterator(after, "k00");
+        size_t prefixed = 0;
+        for (it->seek("k00"); it->valid() && it->key().compare(0, 3, "k00") == 0; it->next()) {
+            prefixed++;
+        }
+        assert(prefixed == 10);
+
+        db.release_snapshot(before);
+        db.release_snapshot(after);
+        std::cout << "  ✓ 一个序列号即跨分片一致的快照，归并扫描全局有序" << std::endl;
+    }
+
+    void test_cross_shard_batch_atomicity() {
+        std::cout << "\n4. 跨分片批与快照并发" << std::endl;
+        reset();
+        ShardedKVDB db(DB_PATH, options(4));
+
+        // 找两个落在不同分片的 key
+        std::string a = "pair_a", b = "pair_b0";
+        for (int i = 1; db.shard_for(a) == db.shard_for(b); i++) {
+            b = "pair_b" + std::to_string(i);
+        }
+
+        std::atomic<bool> stop{false};
+        std::atomic<int> written{0};
+        std::thread writer([&] {
+            for (int i = 0; !stop.load(); i++) {
+                WriteBatch batch;
+                batch.put(a, std::to_string(i));
+                batch.put(b, std::to_string(i));
+                assert(db.write(batch));
+                written.fetch_add(1);
+            }
+        });
+
+        int checked = 0;
+        for (int round = 0; round < 300; round++) {
+            if (round % 10 == 0) {
+                // 单核上让写线程有机会在两次快照之间推进
+                int target = written.load() + 1;
+                while (written.load() < target) {
+                    std::this_thread::yield();
+                }
+            }
+            Snapshot snapshot = db.get_snapshot();
+            std::string va, vb;
+            bool ha = db.get(a, snapshot, va);
+            bool hb = db.get(b, snapshot, vb);
+            assert(ha == hb && va == vb);
+            if (ha) checked++;
+            db.release_snapshot(snapshot);
+        }
+        stop.store(true);
+        writer.join();
+        std::cout << "  ✓ " << checked << " 个快照都看到批的全部或全部看不到" << std::endl;
+    }
+
+    void test_flush_and_restart() {
+        std::cout << "\n5. 刷盘、压缩与重启" << std::endl;
+        reset();
+        uint64_t seq_before;
+        {
+            ShardedKVDB db(DB_PATH, options(3));
+            for (int i = 0; i < 300; i++) {
+                assert(db.put("r" + std::to_string(i), "v" + std::to_string(i)));
+            }
+            db.flush();
+            for (int i = 0; i < 300; i += 3) {
+                assert(db.del("r" + std::to_string(i)));
+            }
+            assert(db.put("wal_only", "w"));
+            db.compact();
+            seq_before = db.current_sequence();
+        }
+
+        // 请求的分片数与已有数据不同：以 SHARDS 文件为准，否则路由会错
+        ShardedKVDB db(DB_PATH, options(8));
+        assert(db.num_shards() == 3);
+        assert(db.current_sequence() >= seq_before);
+        std::string value;
+        for (int i = 0; i < 300; i++) {
+            bool found = db.get("r" + std::to_string(i), value);
+            assert(found == (i % 3 != 0));
+            if (found) assert(value == "v" + std::to_string(i));
+        }
+        assert(db.get("wal_only", value) && value == "w");
+
+        // 重启后新写入的序列号大于任何分片中已有的版本
+        assert(db.put("r0", "again"));
+        assert(db.get("r0", value) && value == "again");
+        std::cout << "  ✓ 重启沿用原分片数，各分片独立恢复，全局序列号继续递增" << std::endl;
+    }
+
+    void test_owner_messages() {
+        std::cout << "\n6. 分片所有者线程与异步消息" << std::endl;
+        reset();
+        std::vector<std::string> keys;
+        {
+            ShardedKVDB db(DB_PATH, options(4));
+            // 同一分片的消息按投递顺序执行：先写后读不必等待写完成
+            std::vector<std::future<bool>> writes;
+            std::vector<std::future<std::optional<std::string>>> reads;
+            for (int i = 0; i < 400; i++) {
+                keys.push_back("async" + std::to_string(i));
+                writes.push_back(db.put_async(keys.back(), "v" + std::to_string(i)));
+                reads.push_back(db.get_async(keys.back()));
+            }
+            for (int i = 0; i < 400; i++) {
+                assert(writes[i].get());
+                auto value = reads[i].get();
+                assert(value && *value == "v" + std::to_string(i));
+            }
+            auto deleted = db.del_async(keys[0]);
+            auto missing = db.get_async(keys[0]);
+            assert(deleted.get() && !missing.get().has_value());
+
+            // 析构前投递但未等待的写入也会执行完
+            for (int i = 1; i < 400; i++) {
+                db.put_async(keys[i], "last");
+            }
+        }
+        ShardedKVDB db(DB_PATH, options(4));
+        std::string value;
+        for (int i = 1; i < 400; i++) {
+            assert(db.get(keys[i], value) && value == "last");
+        }
+        std::cout << "  ✓ 单分片内消息保持顺序，关闭时排空队列" << std::endl;
+    }
+
+    // YCSB A：50% 读 50% 更新，均匀分布，每个线程写各自随机的 key。
+    // pipeline > 1 时每个线程一次投递 pipeline 个异步请求再统一等待
+    double run_ycsb_a(const ShardedKVDBOptions& db_options, size_t threads, size_t ops_per_thread,
+                      size_t pipeline = 1) {
+        reset();
+        ShardedKVDB db(DB_PATH, db_options);
+        const int records = 2000;
+        for (int i = 0; i < records; i++) {
+            db.put("ycsb" + std::to_string(i), std::string(100, 'x'));
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; t++) {
+            workers.emplace_back([&, t] {
+                std::mt19937 rng(static_cast<unsigned>(t + 1));
+                std::uniform_int_distribution<int> pick(0, records - 1);
+                std::string value;
+                std::vector<std::future<bool>> writes;
+                std::vector<std::future<std::optional<std::string>>> reads;
+                for (size_t i = 0; i < ops_per_thread; i++) {
+                    std::string key = "ycsb" + std::to_string(pick(rng));
+                    bool read = rng() & 1;
+                    if (pipeline == 1) {
+                        if (read) {
+                            db.get(key, value);
+                        } else {
+                            db.put(key, std::string(100, 'y'));
+                        }
+                        continue;
+                    }
+                    if (read) {
+                        reads.push_back(db.get_async(std::move(key)));
+                    } else {
+                        writes.push_back(db.put_async(std::move(key), std::string(100, 'y')));
+                    }
+                    if (reads.size() + writes.size() == pipeline || i + 1 == ops_per_thread) {
+                        for (auto& f : reads) f.get();
+                        for (auto& f : writes) f.get();
+                        reads.clear();
+                        writes.clear();
+                    }
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return threads * ops_per_thread / seconds;
+    }
+
+    void test_ycsb_a_scaling() {
+        std::cout << "\n7. YCSB A 吞吐" << std::endl;
+        size_t cores = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        size_t threads = std::max<size_t>(cores, 4);
+        const size_t ops = 5000;
+        double single = run_ycsb_a(options(1, false), threads, ops);
+        double hashed = run_ycsb_a(options(threads, false), threads, ops);
+        double owners = run_ycsb_a(options(threads), threads, ops);
+        double pipelined = run_ycsb_a(options(threads), threads, ops, 32);
+        std::cout << "  " << cores << " 核, " << threads << " 个客户端线程" << std::endl;
+        std::cout << "  1 个分片, 调用线程直接执行: " << static_cast<uint64_t>(single) << " ops/s" << std::endl;
+        std::cout << "  " << threads << " 个分片, 调用线程直接执行: " << static_cast<uint64_t>(hashed)
+                  << " ops/s (" << hashed / single << "x)" << std::endl;
+        std::cout << "  " << threads << " 个分片, 所有者线程: " << static_cast<uint64_t>(owners)
+                  << " ops/s (" << owners / single << "x)" << std::endl;
+        std::cout << "  " << threads << " 个分片, 所有者线程 + 32 路流水: " << static_cast<uint64_t>(pipelined)
+                  << " ops/s (" << pipelined / single << "x)" << std::endl;
+        std::cout << "  ✓ YCSB A 完成" << std::endl;
+    }
+};
+
+int main() {
+    ShardedKVDBTest test;
+    test.run_all_tests();
+    return 0;
+}
@@ -0,0 +1,321 @@
+#include "src/db/kv_db.h"
+#include "src/sstable/sst_file_writer.h"
+#include "src/iterator/sstable_iterator.h"
+#include "src/version/version_set.h"
+#include <iostream>
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+
+class SstIngestTest {
+public:
+    void run_all_tests() {
+        std::cout << "=== 外部 SSTable 导入测试 ===" << std::endl;
+
+        test_sst_file_writer();
+        test_level_placement();
+        test_global_seqno();
+        test_ingest_options();
+        test_move_and_recovery();
+        test_compaction_keeps_deletes_and_snapshots();
+
+        reset();
+        std::cout << "🎉 所有外部 SSTable 导入测试通过！" << std::endl;
+    }
+
+private:
+    static constexpr const char* WAL_FILE = "test_sst_ingest.wal";
+    static constexpr const char* EXTERNAL_DIR = "test_sst_ingest_external";
+
+    void reset() {
+        std::filesystem::remove_all("data");
+        std::filesystem::remove("MANIFEST");
+        std::filesystem::remove(WAL_FILE);
+        std::filesystem::remove_all(EXTERNAL_DIR);
+        std::filesystem::create_directories(EXTERNAL_DIR);
+    }
+
+    std::string external(const std::string& name) {
+        return std::string(EXTERNAL_DIR) + "/" + name;
+    }
+
+    std::string key_of(int i) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "key%06d", i);
+        return buf;
+    }
+
+    // 按 [begin, end) 构建外部文件，值为 prefix + 序号
+    std::string build(const std::string& name, int begin, int end, const std::string& prefix) {
+        SstFileWriter writer;
+        assert(writer.open(external(name)));
+        for (int i = begin; i < end; i++) {
+            assert(writer.put(key_of(i), prefix + std::to_string(i)));
+        }
+        assert(writer.finish());
+        return external(name);
+    }
+
+    // 从 MANIFEST 读出文件所在的层级
+    std::vector<std::vector<SSTableMeta>> manifest_levels() {
+        VersionSet version_set(4);
+        version_set.recover();
+        return version_set.current().levels;
+    }
+
+    void test_sst_file_writer() {
+        std::cout << "测试 SstFileWriter..." << std::endl;
+        reset();
+
+        SstFileWriter writer;
+        assert(writer.open(external("a.sst")));
+        assert(writer.put("apple", "1"));
+        assert(writer.del("banana"));
+        assert(writer.put("cherry", "3"));
+        assert(!writer.put("cherry", "dup"));       // 键必须严格递增
+        assert(!writer.put("aaa", "x"));
+        assert(!writer.put("bad key", "x"));        // 文本格式不允许空白
+        assert(!writer.put("date", "line\nbreak"));
+        assert(writer.num_entries() == 3);
+
+        SSTableMeta meta("", "", "", 0);
+        assert(writer.finish(&meta));
+        assert(meta.min_key == "apple" && meta.max_key == "cherry");
+        assert(meta.file_size == std::filesystem::file_size(external("a.sst")));
+
+        // 与引擎现有读取路径兼容：墓碑以空值返回
+        SSTableIterator iterator(meta, UINT64_MAX);
+        std::vector<std::pair<std::string, std::string>> entries;
+        for (iterator.seek_to_first(); iterator.valid(); iterator.next()) {
+            entries.emplace_back(iterator.key(), iterator.value());
+        }
+        assert((entries == std::vector<std::pair<std::string, std::string>>{
+            {"apple", "1"}, {"banana", ""}, {"cherry", "3"}}));
+
+        // 未 finish 的文件不会留下半成品
+        {
+            SstFileWriter abandoned;
+            assert(abandoned.open(external("b.sst")));
+            assert(abandoned.put("x", "y"));
+        }
+        assert(!std::filesystem::exists(external("b.sst")));
+
+        std::cout << "✓ SstFileWriter 测试通过" << std::endl;
+    }
+
+    void test_level_placement() {
+        std::cout << "测试层级选择..." << std::endl;
+        reset();
+
+        KVDB db(WAL_FILE);
+
+        // 空库：放到最底层
+        assert(db.ingest_external_files({build("a.sst", 0, 100, "a")}));
+        auto levels = manifest_levels();
+        assert(levels[3].size() == 1 && levels[3][0].min_key == key_of(0));
+
+        // 与 L0 不重叠、与 L3 重叠：放到 L2
+        assert(db.ingest_external_files({build("b.sst", 50, 150, "b")}));
+        levels = manifest_levels();
+        assert(levels[2].size() == 1 && levels[2][0].min_key == key_of(50));
+
+        // 与 MemTable 重叠：先刷盘，再以最新文件放入 L0
+        db.put(key_of(120), "memtable");
+        assert(db.ingest_external_files({build("c.sst", 110, 130, "c")}));
+        assert(db.get_memtable_size() == 0);
+        levels = manifest_levels();
+        assert(levels[0].size() == 2);
+        assert(levels[0].back().min_key == key_of(110));
+
+        std::string value;
+        assert(db.get(key_of(10), value) && value == "a10");
+        assert(db.get(key_of(60), value) && value == "b60");
+        assert(db.get(key_of(120), value) && value == "c120");
+        assert(db.get(key_of(140), value) && value == "b140");
+
+        std::cout << "✓ 层级选择测试通过" << std::endl;
+    }
+
+    void test_global_seqno() {
+        std::cout << "测试全局序列号..." << std::endl;
+        reset();
+
+        KVDB db(WAL_FILE);
+        for (int i = 0; i < 20; i++) {
+            db.put(key_of(i), "old" + std::to_string(i));
+        }
+        db.flush();
+        db.put(key_of(100), "unrelated");
+
+        Snapshot before = db.get_snapshot();
+        assert(db.ingest_external_files({build("a.sst", 5, 15, "new")}));
+
+        std::string value;
+        assert(db.get(key_of(1), value) && value == "old1");
+        assert(db.get(key_of(7), value) && value == "new7");
+        assert(db.get(key_of(100), value) && value == "unrelated");  // 不重叠，MemTable 不刷盘
+        assert(db.get_memtable_size() > 0);
+
+        // 导入前的快照看不到导入的数据
+        assert(db.get(key_of(7), before, value) && value == "old7");
+
+        // 迭代器按序列号合并，导入的版本覆盖旧版本
+        Snapshot after = db.get_snapshot();
+        auto iterator = db.new_iterator(after);
+        int count = 0;
+        for (iterator->seek_to_first(); iterator->valid(); iterator->next()) {
+            int i = std::stoi(iterator->key().substr(3));
+            if (i >= 5 && i < 15) {
+                assert(iterator->value() == "new" + std::to_string(i));
+            }
+            count++;
+        }
+        assert(count == 21);
+        iterator.reset();
+        auto old_iterator = db.new_iterator(before);
+        old_iterator->seek(key_of(7));
+        assert(old_iterator->valid() && old_iterator->value() == "old7");
+        old_iterator.reset();
+        db.release_snapshot(before);
+        db.release_snapshot(after);
+
+        // 导入之后的写入覆盖导入的数据
+        db.put(key_of(8), "newest");
+        assert(db.get(key_of(8), value) && value == "newest");
+
+        std::cout << "✓ 全局序列号测试通过" << std::endl;
+    }
+
+    void test_ingest_options() {
+        std::cout << "测试导入选项与失败路径..." << std::endl;
+        reset();
+
+        KVDB db(WAL_FILE);
+        db.put(key_of(5), "memtable");
+
+        // 待导入文件之间重叠
+        std::string a = build("a.sst", 100, 200, "a");
+        std::string b = build("b.sst", 150, 250, "b");
+        assert(!db.ingest_external_files({a, b}));
+
+        // 与 MemTable 重叠且不允许刷盘
+        IngestExternalFileOptions no_flush;
+        no_flush.allow_blocking_flush = false;
+        std::string c = build("c.sst", 0, 10, "c");
+        assert(!db.ingest_external_files({c}, no_flush));
+        assert(db.get_memtable_size() > 0);
+
+        // 与现有数据重叠且不允许分配全局序列号
+        db.flush();
+        IngestExternalFileOptions no_seqno;
+        no_seqno.allow_global_seqno = false;
+        assert(!db.ingest_external_files({c}, no_seqno));
+
+        // 失败不影响源文件，也不在 data/ 留下文件
+        assert(std::filesystem::exists(a) && std::filesystem::exists(b) && std::filesystem::exists(c));
+        auto levels = manifest_levels();
+        assert(levels[0].size() == 1 && levels[1].empty() && levels[2].empty() && levels[3].empty());
+        size_t data_files = std::distance(std::filesystem::directory_iterator("data"),
+                                          std::filesystem::directory_iterator());
+        assert(data_files == 1);
+
+        // 不重叠的文件不需要全局序列号
+        assert(db.ingest_external_files({a}, no_seqno));
+        std::string value;
+        assert(db.get(key_of(150), value) && value == "a150");
+
+        std::cout << "✓ 导入选项与失败路径测试通过" << std::endl;
+    }
+
+    void test_move_and_recovery() {
+        std::cout << "测试硬链接移动与重启恢复..." << std::endl;
+        reset();
+
+        std::string moved = build("moved.sst", 0, 50, "moved");
+        std::string copied = build("copied.sst", 50, 100, "copied");
+        {
+            KVDB db(WAL_FILE);
+            db.put(key_of(10), "old");
+            db.put(key_of(60), "old");
+            db.flush();
+
+            assert(db.ingest_external_files({moved}));
+            assert(!std::filesystem::exists(moved));
+
+            IngestExternalFileOptions keep;
+            keep.move_files = false;
+            assert(db.ingest_external_files({copied}, keep));
+            assert(std::filesystem::exists(copied));
+        }
+
+        // 一条写了一半的导入记录在恢复时被忽略
+        {
+            std::ofstream manifest("MANIFEST", std::ios::app);
+            manifest << "INGEST 2 999\n0 data/missing.dat a b 998\n";
+        }
+
+        auto levels = manifest_levels();
+        assert(levels[0].size() == 3);
+        assert(levels[0][1].global_seq > 0 && levels[0][2].global_seq > levels[0][1].global_seq);
+
+        KVDB db(WAL_FILE);
+        std::string value;
+        assert(db.get(key_of(10), value) && value == "moved10");
+        assert(db.get(key_of(60), value) && value == "copied60");
+
+        // 重启后的新写入序列号大于导入文件的全局序列号
+        db.put(key_of(10), "after_restart");
+        assert(db.get(key_of(10), value) && value == "after_restart");
+        Snapshot snapshot = db.get_snapshot();
+        auto iterator = db.new_iterator(snapshot);
+        iterator->seek(key_of(10));
+        assert(iterator->valid() && iterator->value() == "after_restart");
+        iterator->seek(key_of(60));
+        assert(iterator->valid() && iterator->value() == "copied60");
+        iterator.reset();
+        db.release_snapshot(snapshot);
+
+        std::cout << "✓ 硬链接移动与重启恢复测试通过" << std::endl;
+    }
+
+    void test_compaction_keeps_deletes_and_snapshots() {
+        std::cout << "测试导入数据之上的删除与快照经过压缩..." << std::endl;
+        reset();
+
+        KVDB db(WAL_FILE);
+        // 导入的旧数据落在最底层，之后的删除在 L0 → L1 压缩中不能丢掉，否则旧值重新可见
+        assert(db.ingest_external_files({build("a.sst", 0, 10, "old")}));
+        assert(manifest_levels()[3].size() == 1);
+        db.del(key_of(3));
+        db.put(key_of(5), "v1");
+        db.flush();
+
+        Snapshot snapshot = db.get_snapshot();
+        db.put(key_of(5), "v2");
+        db.flush();
+        // L0 按文件数计分，凑满 8 个文件触发 L0 → L1
+        for (int i = 0; i < 6; i++) {
+            db.put(key_of(100 + i), "filler");
+            db.flush();
+        }
+        db.compact();
+        assert(manifest_levels()[0].empty() && manifest_levels()[1].size() == 1);
+
+        std::string value;
+        assert(!db.get(key_of(3), value));
+        assert(db.get(key_of(4), value) && value == "old4");
+        assert(db.get(key_of(5), value) && value == "v2");
+        // 快照创建之后的覆盖写被合并进同一个文件，快照仍读到创建时的版本
+        assert(db.get(key_of(5), snapshot, value) && value == "v1");
+        assert(!db.get(key_of(3), snapshot, value));
+        db.release_snapshot(snapshot);
+
+        std::cout << "✓ 压缩保留删除与快照版本测试通过" << std::endl;
+    }
+};
+
+int main() {
+    SstIngestTest test;
+    test.run_all_tests();
+    return 0;
+}
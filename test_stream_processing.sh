@@ -7,6 +7,7 @@ g++ -std=c++17 -O2 -I. \
     test_stream_processing.cpp \
     src/stream/change_stream.cpp \
     src/stream/realtime_sync.cpp \
+    src/partition_recovery/merkle_tree.cpp \
     src/stream/event_driven.cpp \
     src/stream/stream_computing.cpp \
     -lpthread \